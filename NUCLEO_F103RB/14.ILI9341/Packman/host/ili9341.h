@@ -0,0 +1,23 @@
+/*
+ * host/ili9341.h
+ * Stand-in for the board header pulled in by ili9341_bus.h and disp_ili9341.c.
+ * The PC build replaces ili9341.c / ili9341_bus.c; only CS/RS pins and the size are needed.
+ */
+
+#ifndef HOST_ILI9341_H
+#define HOST_ILI9341_H
+
+#include "stm32f1xx_hal.h"
+
+#define LCD_RS_PORT     GPIOA
+#define LCD_RS_PIN      GPIO_PIN_4
+#define LCD_CS_PORT     GPIOB
+#define LCD_CS_PIN      GPIO_PIN_0
+
+#define ILI9341_WIDTH   240
+#define ILI9341_HEIGHT  320
+
+void ILI9341_Init(void);
+void ILI9341_SetAddress(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2);
+
+#endif /* HOST_ILI9341_H */
@@ -0,0 +1,283 @@
+/*
+ * host/packman_host.c
+ * Runs packman.c on a PC against an ILI9341 memory model.
+ *
+ *   - Bus bytes are decoded as ILI9341 commands (0x2A/0x2B/0x2C) into a 240x320 screen
+ *   - Counts bus bytes (WR strobes) and windows per tick, estimates the bus time
+ *   - Pacman is steered by an autopilot (shortest path to the nearest dot) so
+ *     dots, power pellets, frightened/eaten ghosts, deaths and restarts all happen;
+ *     two button presses in between exercise PAUSE and resume
+ *   - After every playing tick, the screen must equal a full Packman_Redraw()
+ *   - Saves the final screen as packman.ppm (and every N-th tick with an argument)
+ *
+ * packman.c is included directly so the autopilot can read the maze and sprites.
+ * It draws through the shared display core (36.Vector/05_Display_HAL disp.c) and
+ * its ILI9341 backend (disp_ili9341.c); ili9341.c / ili9341_bus.c are replaced here.
+ *
+ * Build (from the Packman folder):
+ *   gcc -O2 -Wall -I. -Ihost -I../../36.Vector/05_Display_HAL -o packman_host host/packman_host.c \
+ *       ../../36.Vector/05_Display_HAL/disp.c ../../36.Vector/05_Display_HAL/disp_ili9341.c
+ *   ./packman_host          final frame only
+ *   ./packman_host 100      also packman_0100.ppm, packman_0200.ppm, ...
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "packman.c"
+#include "disp_panels.h"
+
+#define LCD_W           240
+#define LCD_H           320
+#define TICKS           6000
+#define PAUSE_TICK      400         // button press here (pauses 0.5 s later) and 20 ticks later
+#define READY_TICKS     ((2000 + TICK_MS - 1) / TICK_MS + 1)
+
+// Estimate, not a board measurement: 153,600 bytes in about 30 ms (README of 14.ILI9341)
+// gives ~0.2 us per table-driven byte
+#define US_PER_BYTE     0.2
+
+GPIO_TypeDef host_gpioa, host_gpiob;
+static uint32_t host_ms;
+
+uint32_t HAL_GetTick(void) { return host_ms; }
+void HAL_Delay(uint32_t ms) { host_ms += ms; }
+
+// ============================================================================
+// ILI9341 memory model
+// ============================================================================
+
+static uint16_t fb[LCD_H][LCD_W];
+static struct {
+    uint8_t rs;                 // 0 = command, 1 = data
+    uint8_t cmd, n, p[4];
+    uint16_t xs, xe, ys, ye, x, y;
+    uint8_t hi, have_hi;
+} lcd;
+
+static struct {
+    uint32_t bytes, windows, overflow;
+} cnt;
+
+// RS is written as BRR (low) / BSRR (high) on PA4 just before the bytes it applies to
+static void Sync_RS(void) {
+    if (host_gpioa.BRR & GPIO_PIN_4)  { lcd.rs = 0; host_gpioa.BRR = 0; }
+    if (host_gpioa.BSRR & GPIO_PIN_4) { lcd.rs = 1; host_gpioa.BSRR = 0; }
+}
+
+static void Lcd_Byte(uint8_t b) {
+    cnt.bytes++;
+
+    if (!lcd.rs) {
+        lcd.cmd = b;
+        lcd.n = 0;
+        lcd.have_hi = 0;
+        if (b == 0x2C) { lcd.x = lcd.xs; lcd.y = lcd.ys; cnt.windows++; }
+        return;
+    }
+
+    switch (lcd.cmd) {
+    case 0x2A:
+    case 0x2B:
+        if (lcd.n < 4) lcd.p[lcd.n++] = b;
+        if (lcd.n == 4) {
+            uint16_t s = lcd.p[0] << 8 | lcd.p[1], e = lcd.p[2] << 8 | lcd.p[3];
+            if (lcd.cmd == 0x2A) { lcd.xs = s; lcd.xe = e; }
+            else                 { lcd.ys = s; lcd.ye = e; }
+        }
+        break;
+
+    case 0x2C:
+        if (!lcd.have_hi) { lcd.hi = b; lcd.have_hi = 1; break; }
+        lcd.have_hi = 0;
+        if (lcd.y > lcd.ye || lcd.x >= LCD_W || lcd.y >= LCD_H) { cnt.overflow++; break; }
+        fb[lcd.y][lcd.x] = lcd.hi << 8 | b;
+        if (++lcd.x > lcd.xe) { lcd.x = lcd.xs; lcd.y++; }
+        break;
+    }
+}
+
+// ============================================================================
+// ili9341.c / ili9341_bus.c replacement
+// ============================================================================
+
+void ILI9341_Bus_Init(void) {}
+void ILI9341_Init(void) {}
+
+// Same bytes as ili9341.c: CASET + 4, PASET + 4, RAMWR (11 bytes)
+void ILI9341_SetAddress(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2) {
+    const uint8_t caset[4] = { x1 >> 8, x1 & 0xFF, x2 >> 8, x2 & 0xFF };
+    const uint8_t paset[4] = { y1 >> 8, y1 & 0xFF, y2 >> 8, y2 & 0xFF };
+
+    Sync_RS();
+    lcd.rs = 0; Lcd_Byte(0x2A);
+    lcd.rs = 1; for (int i = 0; i < 4; i++) Lcd_Byte(caset[i]);
+    lcd.rs = 0; Lcd_Byte(0x2B);
+    lcd.rs = 1; for (int i = 0; i < 4; i++) Lcd_Byte(paset[i]);
+    lcd.rs = 0; Lcd_Byte(0x2C);
+}
+
+void ILI9341_Bus_Write8(uint8_t data) {
+    Sync_RS();
+    Lcd_Byte(data);
+}
+
+void ILI9341_Bus_WriteBuf(const uint8_t *buf, uint32_t len) {
+    Sync_RS();
+    while (len--) Lcd_Byte(*buf++);
+}
+
+void ILI9341_Bus_Repeat16(uint16_t color, uint32_t count) {
+    Sync_RS();
+    while (count--) { Lcd_Byte(color >> 8); Lcd_Byte(color & 0xFF); }
+}
+
+void ILI9341_Bus_WritePixels(const uint16_t *px, uint32_t count) {
+    Sync_RS();
+    while (count--) { Lcd_Byte(*px >> 8); Lcd_Byte(*px & 0xFF); px++; }
+}
+
+// ============================================================================
+// Autopilot
+// ============================================================================
+
+// First step of the shortest walkable path to the nearest dot or power pellet
+static Dir_t Autopilot(void) {
+    static int8_t from[MAZE_ROWS][MAZE_COLS];
+    static int8_t queue[MAZE_ROWS * MAZE_COLS][2];
+    int head = 0, tail = 0;
+
+    memset(from, 0, sizeof(from));
+    from[pac.row][pac.col] = -1;
+    queue[tail][0] = pac.col; queue[tail][1] = pac.row; tail++;
+
+    while (head < tail) {
+        int8_t c = queue[head][0], r = queue[head][1];
+        head++;
+
+        int8_t s = maze_state[r][c];
+        if ((s == CELL_DOT || s == CELL_POWER) && from[r][c] != -1) {
+            // Walk back to the cell next to Pacman
+            Dir_t d = (Dir_t)from[r][c];
+            while (1) {
+                int8_t pc = c, pr = r;
+                switch (d) {
+                    case DIR_R: pc--; break;
+                    case DIR_L: pc++; break;
+                    case DIR_U: pr++; break;
+                    case DIR_D: pr--; break;
+                    default: break;
+                }
+                if (pc == pac.col && pr == pac.row) return d;
+                c = pc; r = pr;
+                d = (Dir_t)from[r][c];
+            }
+        }
+
+        for (Dir_t d = DIR_R; d <= DIR_U; d++) {
+            int8_t nc = c, nr = r;
+            switch (d) {
+                case DIR_R: nc++; break;
+                case DIR_L: nc--; break;
+                case DIR_U: nr--; break;
+                case DIR_D: nr++; break;
+                default: break;
+            }
+            if (!is_walkable(nc, nr) || from[nr][nc]) continue;
+            from[nr][nc] = d;
+            queue[tail][0] = nc; queue[tail][1] = nr; tail++;
+        }
+    }
+    return DIR_NONE;
+}
+
+// ============================================================================
+
+static int Cmp_U32(const void *a, const void *b) {
+    uint32_t x = *(const uint32_t *)a, y = *(const uint32_t *)b;
+    return (x > y) - (x < y);
+}
+
+static void Save(const char *path) {
+    FILE *f = fopen(path, "wb");
+    if (!f) return;
+    fprintf(f, "P6\n%d %d\n255\n", LCD_W, LCD_H);
+    for (int y = 0; y < LCD_H; y++)
+        for (int x = 0; x < LCD_W; x++) {
+            uint16_t c = fb[y][x];
+            uint8_t rgb[3] = { (c >> 11) << 3, ((c >> 5) & 0x3F) << 2, (c & 0x1F) << 3 };
+            fwrite(rgb, 1, 3, f);
+        }
+    fclose(f);
+}
+
+int main(int argc, char **argv) {
+    int save_every = argc > 1 ? atoi(argv[1]) : 0;
+    static uint16_t ref[LCD_H][LCD_W];
+    static uint32_t tick_bytes[TICKS];
+    uint32_t ticks = 0;
+    uint64_t bytes_sum = 0, windows_sum = 0;
+    int since_init = 0, games = 1, mismatches = 0;
+
+    srand(1);
+    Disp_Init(DispILI9341_Init());
+    Packman_Init();
+    printf("Packman_Init      %7u bytes %4u windows | %6.1f ms\n",
+           cnt.bytes, cnt.windows, cnt.bytes * US_PER_BYTE / 1000.0);
+
+    for (int t = 1; t <= TICKS; t++) {
+        host_ms += TICK_MS;
+        if (g_game_state == GS_GAMEOVER || g_game_state == GS_WIN) {
+            if (t % 20 == 0) {              // leave the end text up for a while
+                Packman_OnButton();
+                games++;
+                since_init = 0;
+            }
+        } else if (t == PAUSE_TICK || t == PAUSE_TICK + 20) {
+            Packman_OnButton();
+        } else if (g_game_state == GS_PLAY) {
+            Dir_t d = Autopilot();
+            if (d != DIR_NONE) {
+                pac.next_dir = d;
+                if (pac.dir == DIR_NONE) pac.dir = d;
+            }
+        }
+
+        memset(&cnt, 0, sizeof(cnt));
+        Packman_Tick();
+        since_init++;
+
+        if (g_game_state != GS_PLAY || since_init <= READY_TICKS) continue;
+
+        // Playing tick: bus traffic, then the screen against a full repaint
+        tick_bytes[ticks++] = cnt.bytes;
+        bytes_sum += cnt.bytes;
+        windows_sum += cnt.windows;
+
+        memcpy(ref, fb, sizeof(fb));
+        Packman_Redraw();
+        if (memcmp(ref, fb, sizeof(fb)) != 0) {
+            if (mismatches++ == 0) printf("tick %d: screen differs from a full redraw\n", t);
+        }
+
+        if (save_every && t % save_every == 0) {
+            char name[32];
+            snprintf(name, sizeof(name), "packman_%04d.ppm", t);
+            Save(name);
+        }
+    }
+    Save("packman.ppm");
+
+    // Deaths repaint the whole maze, so look at the median and the 99th percentile too
+    qsort(tick_bytes, ticks, sizeof(tick_bytes[0]), Cmp_U32);
+    uint32_t p50 = tick_bytes[ticks / 2], p99 = tick_bytes[ticks * 99 / 100], max = tick_bytes[ticks - 1];
+
+    printf("%u playing ticks, %d game(s)\n", ticks, games);
+    printf("bytes/tick        avg %.0f  p50 %u  p99 %u  max %u | %.1f windows avg\n",
+           (double)bytes_sum / ticks, p50, p99, max, (double)windows_sum / ticks);
+    printf("bus time/tick     p50 %.2f ms  p99 %.2f ms  max %.2f ms (tick %d ms)\n",
+           p50 * US_PER_BYTE / 1000.0, p99 * US_PER_BYTE / 1000.0, max * US_PER_BYTE / 1000.0, TICK_MS);
+    printf("overflow %u, redraw mismatches %d\n", cnt.overflow, mismatches);
+    printf("%s\n", mismatches == 0 ? "# OK" : "# FAIL");
+    return mismatches != 0;
+}
@@ -0,0 +1,28 @@
+/*
+ * host/stm32f1xx_hal.h
+ * Minimal HAL for the PC build (only what packman.c and the display core use).
+ * CS/RS writes land in plain structs; host/packman_host.c decodes them.
+ */
+
+#ifndef HOST_STM32F1XX_HAL_H
+#define HOST_STM32F1XX_HAL_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+typedef struct { volatile uint32_t BSRR, BRR; } GPIO_TypeDef;
+extern GPIO_TypeDef host_gpioa, host_gpiob;
+#define GPIOA (&host_gpioa)
+#define GPIOB (&host_gpiob)
+
+#define GPIO_PIN_0  0x0001
+#define GPIO_PIN_4  0x0010
+
+// Only named by the other panel constructors in disp_panels.h
+typedef struct { int unused; } SPI_HandleTypeDef;
+typedef struct { int unused; } I2C_HandleTypeDef;
+
+uint32_t HAL_GetTick(void);
+void HAL_Delay(uint32_t ms);
+
+#endif /* HOST_STM32F1XX_HAL_H */
@@ -1,135 +1,10 @@
 #include "packman.h"
+#include "disp.h"
 
 // ============================================================================
-// Fast LCD drawing (direct GPIO register access)
+// LCD output goes through the shared display core (36.Vector/05_Display_HAL):
+// main.c calls Disp_Init(DispILI9341_Init()), packman.c only uses Disp_*.
 // ============================================================================
-#define LCD_CS_LOW()    GPIOB->BRR = GPIO_PIN_0
-#define LCD_CS_HIGH()   GPIOB->BSRR = GPIO_PIN_0
-#define LCD_RS_LOW()    GPIOA->BRR = GPIO_PIN_4
-#define LCD_RS_HIGH()   GPIOA->BSRR = GPIO_PIN_4
-#define LCD_WR_LOW()    GPIOA->BRR = GPIO_PIN_1
-#define LCD_WR_HIGH()   GPIOA->BSRR = GPIO_PIN_1
-
-static inline void LCD_Write8(uint8_t data) {
-    uint32_t pa_set = 0, pa_clr = 0;
-    if (data & 0x01) pa_set |= GPIO_PIN_9;  else pa_clr |= GPIO_PIN_9;
-    if (data & 0x04) pa_set |= GPIO_PIN_10; else pa_clr |= GPIO_PIN_10;
-    if (data & 0x80) pa_set |= GPIO_PIN_8;  else pa_clr |= GPIO_PIN_8;
-
-    uint32_t pb_set = 0, pb_clr = 0;
-    if (data & 0x08) pb_set |= GPIO_PIN_3;  else pb_clr |= GPIO_PIN_3;
-    if (data & 0x10) pb_set |= GPIO_PIN_5;  else pb_clr |= GPIO_PIN_5;
-    if (data & 0x20) pb_set |= GPIO_PIN_4;  else pb_clr |= GPIO_PIN_4;
-    if (data & 0x40) pb_set |= GPIO_PIN_10; else pb_clr |= GPIO_PIN_10;
-
-    uint32_t pc_set = 0, pc_clr = 0;
-    if (data & 0x02) pc_set |= GPIO_PIN_7;  else pc_clr |= GPIO_PIN_7;
-
-    GPIOA->BSRR = pa_set | (pa_clr << 16);
-    GPIOB->BSRR = pb_set | (pb_clr << 16);
-    GPIOC->BSRR = pc_set | (pc_clr << 16);
-
-    LCD_WR_LOW();
-    __NOP();
-    LCD_WR_HIGH();
-}
-
-static inline void LCD_Write16(uint16_t color) {
-    LCD_Write8(color >> 8);
-    LCD_Write8(color & 0xFF);
-}
-
-static void LCD_WriteCmd(uint8_t cmd) {
-    LCD_CS_LOW();
-    LCD_RS_LOW();
-    LCD_Write8(cmd);
-    LCD_CS_HIGH();
-}
-
-static void LCD_WriteData(uint8_t data) {
-    LCD_CS_LOW();
-    LCD_RS_HIGH();
-    LCD_Write8(data);
-    LCD_CS_HIGH();
-}
-
-static void LCD_SetWindow(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2) {
-    LCD_WriteCmd(0x2A);
-    LCD_CS_LOW();
-    LCD_RS_HIGH();
-    LCD_Write8(x1 >> 8); LCD_Write8(x1 & 0xFF);
-    LCD_Write8(x2 >> 8); LCD_Write8(x2 & 0xFF);
-    LCD_CS_HIGH();
-
-    LCD_WriteCmd(0x2B);
-    LCD_CS_LOW();
-    LCD_RS_HIGH();
-    LCD_Write8(y1 >> 8); LCD_Write8(y1 & 0xFF);
-    LCD_Write8(y2 >> 8); LCD_Write8(y2 & 0xFF);
-    LCD_CS_HIGH();
-
-    LCD_WriteCmd(0x2C);
-}
-
-static void LCD_FillRect(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color) {
-    if (x >= 240 || y >= 320 || w == 0 || h == 0) return;
-    if (x + w > 240) w = 240 - x;
-    if (y + h > 320) h = 320 - y;
-
-    LCD_SetWindow(x, y, x + w - 1, y + h - 1);
-
-    uint32_t total = (uint32_t)w * h;
-    uint8_t hi = color >> 8;
-    uint8_t lo = color & 0xFF;
-
-    LCD_CS_LOW();
-    LCD_RS_HIGH();
-
-    while (total >= 8) {
-        LCD_Write8(hi); LCD_Write8(lo);
-        LCD_Write8(hi); LCD_Write8(lo);
-        LCD_Write8(hi); LCD_Write8(lo);
-        LCD_Write8(hi); LCD_Write8(lo);
-        LCD_Write8(hi); LCD_Write8(lo);
-        LCD_Write8(hi); LCD_Write8(lo);
-        LCD_Write8(hi); LCD_Write8(lo);
-        LCD_Write8(hi); LCD_Write8(lo);
-        total -= 8;
-    }
-    while (total--) {
-        LCD_Write8(hi);
-        LCD_Write8(lo);
-    }
-    LCD_CS_HIGH();
-}
-
-static void LCD_HLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
-    if (y < 0 || y >= 320 || w <= 0) return;
-    if (x < 0) { w += x; x = 0; }
-    if (x + w > 240) w = 240 - x;
-    if (w <= 0) return;
-
-    LCD_SetWindow(x, y, x + w - 1, y);
-    uint8_t hi = color >> 8;
-    uint8_t lo = color & 0xFF;
-    LCD_CS_LOW();
-    LCD_RS_HIGH();
-    while (w--) { LCD_Write8(hi); LCD_Write8(lo); }
-    LCD_CS_HIGH();
-}
-
-static void LCD_FillCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color) {
-    int16_t x = r, y = 0, err = 1 - r;
-    while (x >= y) {
-        LCD_HLine(x0 - x, y0 + y, x * 2 + 1, color);
-        LCD_HLine(x0 - x, y0 - y, x * 2 + 1, color);
-        LCD_HLine(x0 - y, y0 + x, y * 2 + 1, color);
-        LCD_HLine(x0 - y, y0 - x, y * 2 + 1, color);
-        y++;
-        if (err < 0) err += 2 * y + 1;
-        else { x--; err += 2 * (y - x + 1); }
-    }
-}
 
 // ============================================================================
 // Colors
@@ -237,74 +112,93 @@ static int8_t is_walkable_ghost(int8_t col, int8_t row) {
 }
 
 // ============================================================================
-// Drawing helpers
+// Tile canvas
 // ============================================================================
-static void cell_rect(int8_t col, int8_t row, uint16_t *x, uint16_t *y) {
-    *x = GAME_LEFT + col * CELL_SZ;
-    *y = GAME_TOP + row * CELL_SZ;
+// Maze cells are composed in RAM (maze cell, then Pacman, then ghosts) and a
+// run of adjacent dirty cells in one maze row goes out as one LCD window.
+// All draw_* functions below use cell-local coordinates (0..CELL_SZ-1).
+#define RUN_TILES   8                       // cells per window at most
+#define RUN_W       (RUN_TILES * CELL_SZ)
+
+static uint16_t run_buf[CELL_SZ][RUN_W];    // one run of cells (1.6KB)
+static uint16_t *cv;                        // top-left of the cell being drawn
+
+static void cv_rect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    if (x < 0) { w += x; x = 0; }
+    if (y < 0) { h += y; y = 0; }
+    if (x + w > CELL_SZ) w = CELL_SZ - x;
+    if (y + h > CELL_SZ) h = CELL_SZ - y;
+
+    for (int16_t j = 0; j < h; j++) {
+        uint16_t *p = cv + (y + j) * RUN_W + x;
+        for (int16_t i = 0; i < w; i++) p[i] = color;
+    }
+}
+
+// Midpoint circle scanlines (close to the r*r+r disc of Disp_FillCircle)
+static void cv_circle(int16_t x0, int16_t y0, int16_t r, uint16_t color) {
+    int16_t x = r, y = 0, err = 1 - r;
+    while (x >= y) {
+        cv_rect(x0 - x, y0 + y, x * 2 + 1, 1, color);
+        cv_rect(x0 - x, y0 - y, x * 2 + 1, 1, color);
+        cv_rect(x0 - y, y0 + x, y * 2 + 1, 1, color);
+        cv_rect(x0 - y, y0 - x, y * 2 + 1, 1, color);
+        y++;
+        if (err < 0) err += 2 * y + 1;
+        else { x--; err += 2 * (y - x + 1); }
+    }
 }
 
-static void draw_wall(int8_t col, int8_t row) {
-    uint16_t x, y;
-    cell_rect(col, row, &x, &y);
-    LCD_FillRect(x, y, CELL_SZ, CELL_SZ, COL_WALL);
+// ============================================================================
+// Drawing helpers
+// ============================================================================
+static void draw_wall(void) {
+    cv_rect(0, 0, CELL_SZ, CELL_SZ, COL_WALL);
 }
 
-static void draw_dot(int8_t col, int8_t row) {
-    uint16_t x, y;
-    cell_rect(col, row, &x, &y);
-    LCD_FillRect(x, y, CELL_SZ, CELL_SZ, COL_BG);
-    LCD_FillRect(x + 4, y + 4, 2, 2, COL_DOT);
+static void draw_dot(void) {
+    cv_rect(0, 0, CELL_SZ, CELL_SZ, COL_BG);
+    cv_rect(4, 4, 2, 2, COL_DOT);
 }
 
-static void draw_power(int8_t col, int8_t row) {
-    uint16_t x, y;
-    cell_rect(col, row, &x, &y);
-    LCD_FillRect(x, y, CELL_SZ, CELL_SZ, COL_BG);
-    LCD_FillCircle(x + 5, y + 5, 4, COL_POWER);
+static void draw_power(void) {
+    cv_rect(0, 0, CELL_SZ, CELL_SZ, COL_BG);
+    cv_circle(5, 5, 4, COL_POWER);
 }
 
-static void draw_empty(int8_t col, int8_t row) {
-    uint16_t x, y;
-    cell_rect(col, row, &x, &y);
-    LCD_FillRect(x, y, CELL_SZ, CELL_SZ, COL_BG);
+static void draw_empty(void) {
+    cv_rect(0, 0, CELL_SZ, CELL_SZ, COL_BG);
 }
 
 static void draw_ghouse(int8_t col, int8_t row) {
-    uint16_t x, y;
-    cell_rect(col, row, &x, &y);
-    LCD_FillRect(x, y, CELL_SZ, CELL_SZ, COL_BG);
+    cv_rect(0, 0, CELL_SZ, CELL_SZ, COL_BG);
     // Only draw outer borders (skip if neighbor is also ghost house)
     if (row == 0 || maze_state[row-1][col] != CELL_GHOUSE)
-        LCD_FillRect(x + 1, y + 1, CELL_SZ - 2, 1, COL_WALL); // top
+        cv_rect(1, 1, CELL_SZ - 2, 1, COL_WALL); // top
     if (row == MAZE_ROWS-1 || maze_state[row+1][col] != CELL_GHOUSE)
-        LCD_FillRect(x + 1, y + CELL_SZ - 2, CELL_SZ - 2, 1, COL_WALL); // bottom
+        cv_rect(1, CELL_SZ - 2, CELL_SZ - 2, 1, COL_WALL); // bottom
     if (col == 0 || maze_state[row][col-1] != CELL_GHOUSE)
-        LCD_FillRect(x + 1, y + 1, 1, CELL_SZ - 2, COL_WALL); // left
+        cv_rect(1, 1, 1, CELL_SZ - 2, COL_WALL); // left
     if (col == MAZE_COLS-1 || maze_state[row][col+1] != CELL_GHOUSE)
-        LCD_FillRect(x + CELL_SZ - 2, y + 1, 1, CELL_SZ - 2, COL_WALL); // right
+        cv_rect(CELL_SZ - 2, 1, 1, CELL_SZ - 2, COL_WALL); // right
 }
 
-static void draw_gdoor(int8_t col, int8_t row) {
-    uint16_t x, y;
-    cell_rect(col, row, &x, &y);
-    LCD_FillRect(x, y, CELL_SZ, CELL_SZ, COL_BG);
-    LCD_FillRect(x + 1, y + 4, CELL_SZ - 2, 2, 0xF81F); // pink door
+static void draw_gdoor(void) {
+    cv_rect(0, 0, CELL_SZ, CELL_SZ, COL_BG);
+    cv_rect(1, 4, CELL_SZ - 2, 2, 0xF81F); // pink door
 }
 
 // ============================================================================
 // Draw Pacman
 // ============================================================================
-static void draw_pacman(int8_t col, int8_t row, Dir_t dir, uint8_t mouth) {
-    uint16_t x, y;
-    cell_rect(col, row, &x, &y);
-    int16_t cx = x + 5;
-    int16_t cy = y + 5;
+static void draw_pacman(Dir_t dir, uint8_t mouth) {
+    int16_t cx = 5;
+    int16_t cy = 5;
 
-    LCD_FillRect(x, y, CELL_SZ, CELL_SZ, COL_BG);
+    cv_rect(0, 0, CELL_SZ, CELL_SZ, COL_BG);
 
     // Body circle
-    LCD_FillCircle(cx, cy, 4, COL_PACMAN);
+    cv_circle(cx, cy, 4, COL_PACMAN);
 
     if (mouth) {
         // Mouth direction vector
@@ -324,13 +218,13 @@ static void draw_pacman(int8_t col, int8_t row, Dir_t dir, uint8_t mouth) {
             int hw = d * 3 / 5;  // wedge half-width
             int px = -sy * hw;
             int py = sx * hw;
-            LCD_FillRect(nx - px, ny - py, 2 * abs(px) + 1, 2 * abs(py) + 1, COL_BG);
+            cv_rect(nx - px, ny - py, 2 * abs(px) + 1, 2 * abs(py) + 1, COL_BG);
         }
     }
 
     // Eye (opposite mouth direction)
     if (dir == DIR_NONE) {
-        LCD_FillCircle(cx + 1, cy - 2, 1, COL_PUPIL);
+        cv_circle(cx + 1, cy - 2, 1, COL_PUPIL);
     } else {
         int8_t ex = 0, ey = 0;
         switch (dir) {
@@ -340,68 +234,68 @@ static void draw_pacman(int8_t col, int8_t row, Dir_t dir, uint8_t mouth) {
             case DIR_D: ex = 1; ey = 1; break;
             default: break;
         }
-        LCD_FillCircle(cx + ex, cy + ey, 1, COL_PUPIL);
+        cv_circle(cx + ex, cy + ey, 1, COL_PUPIL);
     }
 }
 
 // ============================================================================
 // Draw Ghost
 // ============================================================================
-static void draw_ghost(int8_t col, int8_t row, uint16_t color, Dir_t dir, GhostMode_t mode) {
-    uint16_t x, y;
-    cell_rect(col, row, &x, &y);
-    int16_t cx = x + 5;
-    int16_t cy = y + 5;
+static uint16_t ghost_body_color(const Ghost_t *g) {
+    if (g->mode == GM_FRIGHT) return fright_blink_on ? COL_FWHITE : COL_FRIGHT;
+    return g->color;
+}
+
+static void draw_ghost(const Ghost_t *g) {
+    int16_t cx = 5;
+    int16_t cy = 5;
 
     // Clear cell
-    LCD_FillRect(x, y, CELL_SZ, CELL_SZ, COL_BG);
+    cv_rect(0, 0, CELL_SZ, CELL_SZ, COL_BG);
 
-    if (mode == GM_EATEN) {
+    if (g->mode == GM_EATEN) {
         // Just draw eyes floating back to house
-        LCD_FillCircle(cx - 2, cy - 2, 1, COL_EYE);
-        LCD_FillCircle(cx + 2, cy - 2, 1, COL_EYE);
+        cv_circle(cx - 2, cy - 2, 1, COL_EYE);
+        cv_circle(cx + 2, cy - 2, 1, COL_EYE);
         return;
     }
 
-    uint16_t body_color = color;
-    if (mode == GM_FRIGHT) {
-        body_color = fright_blink_on ? COL_FWHITE : COL_FRIGHT;
-    }
+    uint16_t body_color = ghost_body_color(g);
 
     // Ghost body (rounded top + body) — stays within cell (y to y+9)
-    LCD_FillCircle(cx, cy - 1, 4, body_color);  // center (cx, y+4), radius 4 → top y, bottom y+8
-    LCD_FillRect(cx - 4, cy - 1, 8, 4, body_color); // y+4 to y+7
+    cv_circle(cx, cy - 1, 4, body_color);  // center (cx, y+4), radius 4 → top y, bottom y+8
+    cv_rect(cx - 4, cy - 1, 8, 4, body_color); // y+4 to y+7
 
     // Wavy bottom skirt
-    LCD_FillRect(cx - 4, cy + 3, 2, 2, body_color); // y+8
-    LCD_FillRect(cx - 1, cy + 3, 2, 2, body_color); // y+8
-    LCD_FillRect(cx + 2, cy + 3, 2, 2, body_color); // y+8
+    cv_rect(cx - 4, cy + 3, 2, 2, body_color); // y+8
+    cv_rect(cx - 1, cy + 3, 2, 2, body_color); // y+8
+    cv_rect(cx + 2, cy + 3, 2, 2, body_color); // y+8
 
-    if (mode == GM_FRIGHT) {
+    if (g->mode == GM_FRIGHT) {
         // Frightened face
-        LCD_FillCircle(cx - 2, cy - 2, 1, COL_FWHITE);
-        LCD_FillCircle(cx + 2, cy - 2, 1, COL_FWHITE);
-        LCD_FillCircle(cx - 2, cy - 2, 1, COL_PUPIL);
-        LCD_FillCircle(cx + 2, cy - 2, 1, COL_PUPIL);
+        cv_circle(cx - 2, cy - 2, 1, COL_FWHITE);
+        cv_circle(cx + 2, cy - 2, 1, COL_FWHITE);
+        cv_circle(cx - 2, cy - 2, 1, COL_PUPIL);
+        cv_circle(cx + 2, cy - 2, 1, COL_PUPIL);
         // Wavy mouth
-        LCD_FillRect(cx - 2, cy + 1, 1, 1, COL_FWHITE);
-        LCD_FillRect(cx, cy, 1, 1, COL_FWHITE);
-        LCD_FillRect(cx + 2, cy + 1, 1, 1, COL_FWHITE);
+        cv_rect(cx - 2, cy + 1, 1, 1, COL_FWHITE);
+        cv_rect(cx, cy, 1, 1, COL_FWHITE);
+        cv_rect(cx + 2, cy + 1, 1, 1, COL_FWHITE);
     } else {
         // Normal eyes
-        LCD_FillCircle(cx - 2, cy - 2, 2, COL_EYE);
-        LCD_FillCircle(cx + 2, cy - 2, 2, COL_EYE);
+        cv_circle(cx - 2, cy - 2, 2, COL_EYE);
+        cv_circle(cx + 2, cy - 2, 2, COL_EYE);
         // Pupils look in direction
         int8_t px = 0, py = 0;
-        switch (dir) {
+        switch (g->dir) {
             case DIR_R: px = 1; break;
             case DIR_L: px = -1; break;
             case DIR_U: py = -1; break;
             case DIR_D: py = 1; break;
             default: break;
         }
-        LCD_FillCircle(cx - 2 + px, cy - 2 + py, 1, COL_PUPIL);
-        LCD_FillCircle(cx + 2 + px, cy - 2 + py, 1, COL_PUPIL);
+        cv_circle(cx - 2 + px, cy - 2 + py, 1, COL_PUPIL);
+        cv_circle(cx + 2 + px, cy - 2 + py, 1, COL_PUPIL);
     }
 }
 
@@ -411,81 +305,199 @@ static void draw_ghost(int8_t col, int8_t row, uint16_t color, Dir_t dir, GhostM
 static void draw_maze_cell(int8_t col, int8_t row) {
     int8_t c = maze_state[row][col];
     switch (c) {
-        case CELL_WALL:   draw_wall(col, row); break;
-        case CELL_DOT:    draw_dot(col, row); break;
-        case CELL_POWER:  draw_power(col, row); break;
-        case CELL_EMPTY:  draw_empty(col, row); break;
+        case CELL_WALL:   draw_wall(); break;
+        case CELL_DOT:    draw_dot(); break;
+        case CELL_POWER:  draw_power(); break;
+        case CELL_EMPTY:  draw_empty(); break;
         case CELL_GHOUSE: draw_ghouse(col, row); break;
-        case CELL_GDOOR:  draw_gdoor(col, row); break;
+        case CELL_GDOOR:  draw_gdoor(); break;
         default: break;
     }
 }
 
-static void draw_maze_full(void) {
-    for (int8_t r = 0; r < MAZE_ROWS; r++)
-        for (int8_t c = 0; c < MAZE_COLS; c++)
-            draw_maze_cell(c, r);
-}
-
 // ============================================================================
-// HUD
+// Dirty cells
 // ============================================================================
-static void draw_hud(void) {
-    LCD_FillRect(0, 0, 240, 20, COL_BG);
-    LCD_FillRect(0, 300, 240, 20, COL_BG);
+// One bit per maze cell. Sprites are tracked by what was last sent for them:
+// when position or look changes, the old and the new cell are marked.
+typedef struct {
+    int8_t col, row;
+    uint8_t shown;
+    uint8_t look;           // dir, mouth / mode, blink
+} SpriteView_t;
+
+static uint32_t dirty[MAZE_ROWS];
+static SpriteView_t view[5];                // 0 = Pacman, 1..4 = ghosts
+
+static void mark_cell(int8_t col, int8_t row) {
+    if (col < 0 || col >= MAZE_COLS || row < 0 || row >= MAZE_ROWS) return;
+    dirty[row] |= 1u << col;
+}
 
-    // Score
-    char buf[12];
-    int s = g_score;
-    uint8_t len = 0;
-    if (s == 0) { buf[0] = '0'; len = 1; }
-    else {
-        uint8_t i = 0;
-        while (s > 0 && i < 10) {
-            buf[i++] = '0' + (s % 10);
-            s /= 10;
-        }
-        len = i;
-        // Reverse
-        for (uint8_t j = 0; j < len / 2; j++) {
-            char t = buf[j];
-            buf[j] = buf[len - 1 - j];
-            buf[len - 1 - j] = t;
+// Cells under a screen rectangle (text overlays)
+static void mark_rect(int16_t x, int16_t y, int16_t w, int16_t h) {
+    int16_t c0 = (x - GAME_LEFT) / CELL_SZ, c1 = (x + w - 1 - GAME_LEFT) / CELL_SZ;
+    int16_t r0 = (y - GAME_TOP) / CELL_SZ,  r1 = (y + h - 1 - GAME_TOP) / CELL_SZ;
+    for (int16_t r = r0; r <= r1; r++)
+        for (int16_t c = c0; c <= c1; c++)
+            mark_cell(c, r);
+}
+
+static void mark_all(void) {
+    for (int8_t r = 0; r < MAZE_ROWS; r++) dirty[r] = (1u << MAZE_COLS) - 1;
+}
+
+static SpriteView_t sprite_view(uint8_t i) {
+    SpriteView_t v;
+    if (i == 0) {
+        v.col = pac.col; v.row = pac.row;
+        v.shown = 1;
+        v.look = pac.dir | (pac.mouth_frame << 3);
+    } else {
+        const Ghost_t *g = &ghosts[i - 1];
+        v.col = g->col; v.row = g->row;
+        v.shown = !g->in_house;
+        v.look = g->dir | (g->mode << 3) | ((ghost_body_color(g) == COL_FWHITE) << 5);
+    }
+    return v;
+}
+
+// Maze cell + sprites on it, later ghosts on top (same order as the old per-sprite draws)
+static void compose_cell(int8_t col, int8_t row) {
+    draw_maze_cell(col, row);
+    if (pac.col == col && pac.row == row)
+        draw_pacman(pac.dir, pac.mouth_frame);
+    for (int i = 0; i < 4; i++) {
+        if (!ghosts[i].in_house && ghosts[i].col == col && ghosts[i].row == row)
+            draw_ghost(&ghosts[i]);
+    }
+}
+
+// run_buf rows are RUN_W pixels apart: blit the whole buffer clipped to the n cells (one window)
+static void send_run(int8_t col, int8_t row, uint8_t n) {
+    int16_t x = GAME_LEFT + col * CELL_SZ;
+    int16_t y = GAME_TOP + row * CELL_SZ;
+
+    Disp_SetClip(x, y, n * CELL_SZ, CELL_SZ);
+    Disp_Blit(x, y, RUN_W, CELL_SZ, &run_buf[0][0]);
+    Disp_ResetClip();
+}
+
+// Mark cells of changed sprites, then send every dirty run
+static void render_frame(void) {
+    for (uint8_t i = 0; i < 5; i++) {
+        SpriteView_t v = sprite_view(i);
+        SpriteView_t *o = &view[i];
+        if (v.col != o->col || v.row != o->row || v.shown != o->shown || v.look != o->look) {
+            if (o->shown) mark_cell(o->col, o->row);
+            if (v.shown) mark_cell(v.col, v.row);
+            *o = v;
         }
     }
-    buf[len] = '\0';
-
-    // Simple draw score digits
-    int16_t sx = 10;
-    for (uint8_t i = 0; i < len; i++) {
-        // Draw digit using rectangles (simplified 3x5 font)
-        uint8_t ch = buf[i] - '0';
-        static const uint8_t digits[10][5] = {
-            {0x06,0x09,0x09,0x09,0x06}, // 0
-            {0x02,0x06,0x02,0x02,0x07}, // 1
-            {0x06,0x09,0x02,0x04,0x0F}, // 2
-            {0x06,0x09,0x02,0x09,0x06}, // 3
-            {0x02,0x06,0x0A,0x0F,0x02}, // 4
-            {0x0F,0x08,0x0E,0x01,0x0E}, // 5
-            {0x06,0x08,0x0E,0x09,0x06}, // 6
-            {0x0F,0x01,0x02,0x04,0x04}, // 7
-            {0x06,0x09,0x06,0x09,0x06}, // 8
-            {0x06,0x09,0x07,0x01,0x06}, // 9
-        };
-        for (uint8_t row = 0; row < 5; row++) {
-            for (uint8_t col = 0; col < 4; col++) {
-                if (digits[ch][row] & (0x08 >> col)) {
-                    LCD_FillRect(sx + col * 2, 5 + row * 3, 2, 2, COL_SCR);
-                }
+
+    for (int8_t row = 0; row < MAZE_ROWS; row++) {
+        uint32_t bits = dirty[row];
+        int8_t col = 0;
+        dirty[row] = 0;
+
+        while (bits) {
+            while (!(bits & 1)) { bits >>= 1; col++; }
+
+            uint8_t n = 0;
+            while ((bits & 1) && n < RUN_TILES) {
+                cv = &run_buf[0][n * CELL_SZ];
+                compose_cell(col + n, row);
+                bits >>= 1;
+                n++;
             }
+            send_run(col, row, n);
+            col += n;
+        }
+    }
+}
+
+// ============================================================================
+// HUD
+// ============================================================================
+#define SCORE_X      10
+#define SCORE_Y      5
+#define SCORE_DIGITS 5              // g_score is 16-bit
+#define DIGIT_W      14
+#define DIGIT_H      14             // 5 rows of 2px + 1px gap
+
+static uint16_t hud_score;
+static uint8_t hud_lives;
+static uint8_t hud_len;             // digits currently on screen
+
+// Score as one window: built in RAM from the 3x5 font (2x2 dots), then one Disp_Blit
+static void draw_score(void) {
+    static const uint8_t digits[10][5] = {
+        {0x06,0x09,0x09,0x09,0x06}, // 0
+        {0x02,0x06,0x02,0x02,0x07}, // 1
+        {0x06,0x09,0x02,0x04,0x0F}, // 2
+        {0x06,0x09,0x02,0x09,0x06}, // 3
+        {0x02,0x06,0x0A,0x0F,0x02}, // 4
+        {0x0F,0x08,0x0E,0x01,0x0E}, // 5
+        {0x06,0x08,0x0E,0x09,0x06}, // 6
+        {0x0F,0x01,0x02,0x04,0x04}, // 7
+        {0x06,0x09,0x06,0x09,0x06}, // 8
+        {0x06,0x09,0x07,0x01,0x06}, // 9
+    };
+    uint8_t buf[SCORE_DIGITS];
+    uint16_t s = g_score;
+    uint8_t len = 0;
+
+    do {
+        buf[SCORE_DIGITS - 1 - len++] = s % 10;
+        s /= 10;
+    } while (s > 0);
+
+    // Also covers the digits of a longer previous score
+    uint8_t cols = len > hud_len ? len : hud_len;
+    const uint8_t *d = &buf[SCORE_DIGITS - len];
+    static uint16_t px[DIGIT_H * SCORE_DIGITS * DIGIT_W];
+    uint16_t w = cols * DIGIT_W;
+
+    for (uint8_t y = 0; y < DIGIT_H; y++) {
+        uint8_t bits_row = y / 3;
+        uint16_t *line = &px[y * w];
+        for (uint16_t x = 0; x < w; x++) {
+            uint8_t i = x / DIGIT_W, dx = x % DIGIT_W;
+            uint8_t on = i < len && dx < 8 && (y % 3) < 2 && (digits[d[i]][bits_row] & (0x08 >> (dx / 2)));
+            line[x] = on ? COL_SCR : COL_BG;
         }
-        sx += 14;
     }
+    Disp_Blit(SCORE_X, SCORE_Y, w, DIGIT_H, px);
+
+    hud_score = g_score;
+    hud_len = len;
+}
+
+// Band + small Pacmans composed in one pass (each pixel sent once)
+static void draw_lives(void) {
+    DispShape_t s[DISP_MAX_SHAPES];
+    uint8_t n = 0;
 
-    // Lives (small Pacmans)
-    for (uint8_t i = 0; i < g_lives; i++) {
-        LCD_FillCircle(200 + i * 14, 310, 5, COL_LIFE);
+    s[n++] = (DispShape_t){ DISP_RECT, 0, 300, 239, 319, 0, COL_BG };
+    for (uint8_t i = 0; i < g_lives && n < DISP_MAX_SHAPES; i++) {
+        int16_t x = 200 + i * 14;
+        s[n++] = (DispShape_t){ DISP_CIRCLE, x, 310, x, 310, 5, COL_LIFE };
     }
+    Disp_DrawShapes(s, n);
+    hud_lives = g_lives;
+}
+
+static void draw_hud(void) {
+    Disp_FillRect(0, 0, 240, 20, COL_BG);
+    hud_len = 0;
+    draw_score();
+    draw_lives();
+}
+
+// Only the parts whose value changed
+static void update_hud(void) {
+    if (g_score != hud_score) draw_score();
+    if (g_lives != hud_lives) draw_lives();
 }
 
 // Draw text string using 4x5 pixel font
@@ -531,7 +543,7 @@ static void draw_text(int16_t x, int16_t y, const char *str, uint16_t color) {
             for (uint8_t row = 0; row < 5; row++) {
                 for (uint8_t col = 0; col < 4; col++) {
                     if (excl[row] & (0x08 >> col))
-                        LCD_FillRect(x + col * 2, y + row * 3, 2, 2, color);
+                        Disp_FillRect(x + col * 2, y + row * 3, 2, 2, color);
                 }
             }
             x += 12;
@@ -542,7 +554,7 @@ static void draw_text(int16_t x, int16_t y, const char *str, uint16_t color) {
             for (uint8_t row = 0; row < 5; row++) {
                 for (uint8_t col = 0; col < 4; col++) {
                     if (chars[ch][row] & (0x08 >> col))
-                        LCD_FillRect(x + col * 2, y + row * 3, 2, 2, color);
+                        Disp_FillRect(x + col * 2, y + row * 3, 2, 2, color);
                 }
             }
         }
@@ -628,8 +640,7 @@ static void move_pacman(void) {
     handle_tunnel(&nc, pac.row);
 
     if (is_walkable(nc, nr)) {
-        // Clear old cell
-        draw_maze_cell(pac.col, pac.row);
+        // Old cell is restored by render_frame()
         pac.col = nc;
         pac.row = nr;
         pac.mouth_frame = !pac.mouth_frame;
@@ -803,10 +814,6 @@ static void move_ghost(Ghost_t *g) {
         }
     }
 
-    // Save old position for redraw
-    int8_t old_col = g->col;
-    int8_t old_row = g->row;
-
     g->dir = best_dir;
     switch (g->dir) {
         case DIR_R: g->col++; break;
@@ -816,9 +823,6 @@ static void move_ghost(Ghost_t *g) {
         default: break;
     }
     handle_tunnel(&g->col, g->row);
-
-    // Redraw old cell
-    draw_maze_cell(old_col, old_row);
 }
 
 // ============================================================================
@@ -859,12 +863,8 @@ static void check_collisions(void) {
                     ghosts[2].dir = DIR_NONE; ghosts[3].dir = DIR_NONE;
 
                     // Redraw
-                    draw_maze_full();
-                    draw_pacman(pac.col, pac.row, pac.dir, 1);
-                    for (int j = 0; j < 4; j++) {
-                        if (!ghosts[j].in_house)
-                            draw_ghost(ghosts[j].col, ghosts[j].row, ghosts[j].color, ghosts[j].dir, ghosts[j].mode);
-                    }
+                    mark_all();
+                    render_frame();
                 }
             }
         }
@@ -973,21 +973,9 @@ void Packman_Init(void) {
     g_lives = 3;
     power_active = 0;
 
-    // Clear screen
-    LCD_FillRect(0, 0, 240, 320, COL_BG);
-
-    // Draw maze
-    draw_maze_full();
-
-    // Draw HUD
-    draw_hud();
-
-    // Draw initial positions
-    draw_pacman(pac.col, pac.row, pac.dir, 1);
-    for (int i = 0; i < 4; i++) {
-        if (!ghosts[i].in_house)
-            draw_ghost(ghosts[i].col, ghosts[i].row, ghosts[i].color, ghosts[i].dir, ghosts[i].mode);
-    }
+    // Maze cells + HUD bars cover the whole screen, no separate clear
+    for (int i = 0; i < 5; i++) view[i].shown = 0;
+    Packman_Redraw();
 
     mode_phase = 0;
     mode_phase_start = HAL_GetTick();
@@ -1002,6 +990,15 @@ void Packman_Init(void) {
     draw_text(70, 142, "READY", COL_POWER);
 }
 
+// ============================================================================
+// Public: full repaint from the game state
+// ============================================================================
+void Packman_Redraw(void) {
+    mark_all();
+    render_frame();
+    draw_hud();
+}
+
 // ============================================================================
 // Public: Tick (call every ~TICK_MS)
 // ============================================================================
@@ -1026,7 +1023,8 @@ void Packman_Tick(void) {
             g_game_state = GS_PAUSE;
             return;
         } else if (g_game_state == GS_PAUSE) {
-            LCD_FillRect(70, 140, 80, 20, COL_BG);
+            mark_rect(70, 140, 80, 20);
+            render_frame();
             g_game_state = GS_PLAY;
             // Reset mode phase timer to avoid time jump
             mode_phase_start = now;
@@ -1040,16 +1038,9 @@ void Packman_Tick(void) {
     // Show READY! message for 2 seconds before starting play
     if (!ready_to_play) {
         if (HAL_GetTick() - ready_start_ms > 2000) {
-            // Restore maze cells covered by READY text (rows 12-13, cols 0-23)
-            for (int c = 0; c < MAZE_COLS; c++) {
-                draw_maze_cell(c, 12);
-                draw_maze_cell(c, 13);
-            }
-            // Restore ghosts in those rows too
-            for (int i = 0; i < 4; i++) {
-                if (!ghosts[i].in_house)
-                    draw_ghost(ghosts[i].col, ghosts[i].row, ghosts[i].color, ghosts[i].dir, ghosts[i].mode);
-            }
+            // Restore the cells under the READY text (sprites on them included)
+            mark_rect(70, 140, 80, 20);
+            render_frame();
             ready_to_play = 1;
         }
         return;
@@ -1067,14 +1058,8 @@ void Packman_Tick(void) {
         }
     }
 
-    // Redraw pacman
-    draw_pacman(pac.col, pac.row, pac.dir, pac.mouth_frame);
-
-    // Redraw ghosts
-    for (int i = 0; i < 4; i++) {
-        if (!ghosts[i].in_house)
-            draw_ghost(ghosts[i].col, ghosts[i].row, ghosts[i].color, ghosts[i].dir, ghosts[i].mode);
-    }
+    // Redraw the cells sprites left or entered
+    render_frame();
 
     // Check collisions
     check_collisions();
@@ -1129,8 +1114,9 @@ void Packman_Tick(void) {
     // Check win
     check_win();
 
-    // Update HUD
-    draw_hud();
+    // Show fright/respawn/release changes now, then the HUD
+    render_frame();
+    update_hud();
 
     last_tick_ms = now;
 }
@@ -56,6 +56,7 @@ extern uint8_t g_lives;
 
 void Packman_Init(void);
 void Packman_Tick(void);
+void Packman_Redraw(void);      // Repaint maze, sprites and HUD (e.g. after drawing over the game)
 void Packman_OnButton(void);
 
 #endif
@@ -0,0 +1,57 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+ili9341_bus.c/h 사본 점검
+
+이 폴더의 ili9341_bus.c / ili9341_bus.h 가 원본이고,
+아래 폴더들은 같은 파일을 바이트 단위로 그대로 들고 있어야 합니다.
+
+  python3 bus_sync.py          원본과 다른 사본이 있으면 목록을 찍고 1 로 끝남
+  python3 bus_sync.py --fix    원본을 사본 자리에 덮어씀
+"""
+
+import os
+import sys
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+FILES = ["ili9341_bus.c", "ili9341_bus.h"]
+COPIES = [
+    "Packman",
+    "../36.Vector/03_ILI9341_Parallel_240x320",
+    "../36.Vector/04_ILI9341_Touch_Project",
+    "../../NUCLEO_F411RE/14.ILI9341",
+]
+
+
+def read(path):
+    with open(path, "rb") as f:
+        return f.read()
+
+
+def main():
+    fix = "--fix" in sys.argv[1:]
+    stale = 0
+
+    for name in FILES:
+        master = read(os.path.join(HERE, name))
+        for folder in COPIES:
+            path = os.path.normpath(os.path.join(HERE, folder, name))
+            if os.path.exists(path) and read(path) == master:
+                continue
+            if fix:
+                with open(path, "wb") as f:
+                    f.write(master)
+                print("updated", os.path.relpath(path, HERE))
+            else:
+                print("differs", os.path.relpath(path, HERE))
+                stale += 1
+
+    if stale:
+        print("# FAIL: %d copies differ from 14.ILI9341 (run with --fix)" % stale)
+        return 1
+    print("# OK")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,136 @@
+#include "ili9341_bus.h"
+
+// Data pin map (from ili9341.h)
+static GPIO_TypeDef * const data_port[8] = {
+    LCD_D0_PORT, LCD_D1_PORT, LCD_D2_PORT, LCD_D3_PORT,
+    LCD_D4_PORT, LCD_D5_PORT, LCD_D6_PORT, LCD_D7_PORT
+};
+static const uint16_t data_pin[8] = {
+    LCD_D0_PIN, LCD_D1_PIN, LCD_D2_PIN, LCD_D3_PIN,
+    LCD_D4_PIN, LCD_D5_PIN, LCD_D6_PIN, LCD_D7_PIN
+};
+
+// Byte value -> BSRR word for each bus port (set bits low half, reset bits high half)
+static GPIO_TypeDef *bus_port[ILI9341_BUS_PORTS];
+static uint32_t bus_lut[256][ILI9341_BUS_PORTS];
+
+#define WR_LOW()    (LCD_WR_PORT->BSRR = (uint32_t)LCD_WR_PIN << 16)
+#define WR_HIGH()   (LCD_WR_PORT->BSRR = LCD_WR_PIN)
+
+// Put one table entry on the bus (ports kept in registers by the callers)
+#define BUS_PUT(w)      do { p0->BSRR = (w)[0]; p1->BSRR = (w)[1]; p2->BSRR = (w)[2]; } while (0)
+
+// ILI9341 write timing: twrl >= 15 ns, twrh >= 15 ns, twc >= 66 ns.
+// F103 @64MHz (15.6 ns/cycle): one NOP with WR low, the next byte's table stores cover twc.
+// F411 @100MHz (10 ns/cycle): stores alone come out under twc, so hold WR low for
+// 3 cycles and high for 2 more (a table byte + strobe is then >= 10 cycles = 100 ns).
+#if defined(STM32F4)
+#define WR_HOLD()       do { __NOP(); __NOP(); __NOP(); } while (0)
+#define WR_RECOVER()    do { __NOP(); __NOP(); } while (0)
+#else
+#define WR_HOLD()       __NOP()
+#define WR_RECOVER()    do { } while (0)
+#endif
+
+// WR low -> high latches the data
+#define BUS_STROBE()    do { wr->BSRR = wr_lo; WR_HOLD(); wr->BSRR = wr_hi; WR_RECOVER(); } while (0)
+
+void ILI9341_Bus_Init(void) {
+    uint8_t slot[8];
+    uint8_t ports = 0;
+
+    // Group the data pins by port
+    for (uint8_t b = 0; b < 8; b++) {
+        uint8_t k = 0;
+        while (k < ports && bus_port[k] != data_port[b]) k++;
+        if (k == ports && ports < ILI9341_BUS_PORTS) bus_port[ports++] = data_port[b];
+        slot[b] = k;
+    }
+
+    // Unused slots write 0 to BSRR of the first port, which changes nothing
+    for (uint8_t k = ports; k < ILI9341_BUS_PORTS; k++) bus_port[k] = bus_port[0];
+
+    for (uint16_t v = 0; v < 256; v++) {
+        for (uint8_t k = 0; k < ILI9341_BUS_PORTS; k++) bus_lut[v][k] = 0;
+        for (uint8_t b = 0; b < 8; b++) {
+            if (slot[b] >= ILI9341_BUS_PORTS) continue;
+            bus_lut[v][slot[b]] |= (v & (1u << b)) ? data_pin[b] : (uint32_t)data_pin[b] << 16;
+        }
+    }
+}
+
+void ILI9341_Bus_Write8(uint8_t data) {
+    GPIO_TypeDef *p0 = bus_port[0], *p1 = bus_port[1], *p2 = bus_port[2];
+
+    BUS_PUT(bus_lut[data]);
+    WR_LOW();
+    WR_HOLD();
+    WR_HIGH();
+    WR_RECOVER();
+}
+
+void ILI9341_Bus_WriteBuf(const uint8_t *buf, uint32_t len) {
+    GPIO_TypeDef *p0 = bus_port[0], *p1 = bus_port[1], *p2 = bus_port[2];
+    GPIO_TypeDef *wr = LCD_WR_PORT;
+    const uint32_t wr_lo = (uint32_t)LCD_WR_PIN << 16, wr_hi = LCD_WR_PIN;
+
+    while (len--) {
+        BUS_PUT(bus_lut[*buf++]);
+        BUS_STROBE();
+    }
+}
+
+void ILI9341_Bus_Repeat16(uint16_t color, uint32_t count) {
+    GPIO_TypeDef *p0 = bus_port[0], *p1 = bus_port[1], *p2 = bus_port[2];
+    GPIO_TypeDef *wr = LCD_WR_PORT;
+    const uint32_t wr_lo = (uint32_t)LCD_WR_PIN << 16, wr_hi = LCD_WR_PIN;
+    const uint8_t hi = color >> 8;
+    const uint8_t lo = color & 0xFF;
+
+    if (hi == lo) {
+        // Both bytes equal (BLACK, WHITE, ...): set the data pins once, then strobe only
+        uint32_t n = count * 2;
+
+        BUS_PUT(bus_lut[hi]);
+        while (n >= 8) {
+            BUS_STROBE(); __NOP(); BUS_STROBE(); __NOP();
+            BUS_STROBE(); __NOP(); BUS_STROBE(); __NOP();
+            BUS_STROBE(); __NOP(); BUS_STROBE(); __NOP();
+            BUS_STROBE(); __NOP(); BUS_STROBE(); __NOP();
+            n -= 8;
+        }
+        while (n--) { BUS_STROBE(); __NOP(); }
+        return;
+    }
+
+    // Keep both table entries in registers for the whole run
+    const uint32_t h0 = bus_lut[hi][0], h1 = bus_lut[hi][1], h2 = bus_lut[hi][2];
+    const uint32_t l0 = bus_lut[lo][0], l1 = bus_lut[lo][1], l2 = bus_lut[lo][2];
+
+#define PIXEL() do { \
+        p0->BSRR = h0; p1->BSRR = h1; p2->BSRR = h2; BUS_STROBE(); \
+        p0->BSRR = l0; p1->BSRR = l1; p2->BSRR = l2; BUS_STROBE(); \
+    } while (0)
+
+    while (count >= 4) {
+        PIXEL(); PIXEL(); PIXEL(); PIXEL();
+        count -= 4;
+    }
+    while (count--) PIXEL();
+
+#undef PIXEL
+}
+
+void ILI9341_Bus_WritePixels(const uint16_t *px, uint32_t count) {
+    GPIO_TypeDef *p0 = bus_port[0], *p1 = bus_port[1], *p2 = bus_port[2];
+    GPIO_TypeDef *wr = LCD_WR_PORT;
+    const uint32_t wr_lo = (uint32_t)LCD_WR_PIN << 16, wr_hi = LCD_WR_PIN;
+
+    while (count--) {
+        uint16_t c = *px++;
+        BUS_PUT(bus_lut[c >> 8]);
+        BUS_STROBE();
+        BUS_PUT(bus_lut[c & 0xFF]);
+        BUS_STROBE();
+    }
+}
@@ -0,0 +1,197 @@
+/*
+ * gauge_demo.c
+ * 전체 화면 애니메이션 계기판 데모 (36.Vector/05_Display_HAL 의 Disp_* 로 그림)
+ *
+ * GaugeDemo_Run      : 매 프레임 배경부터 전부 다시 그림 → 패널 전송 속도가 그대로 FPS
+ * GaugeDemo_RunDelta : 첫 프레임만 전부, 이후는 값이 바뀐 각도 구간(고리)과 바늘, 숫자만
+ * 측정한 FPS 는 화면 아래쪽 초록 숫자.
+ *
+ * 프로젝트에 05_Display_HAL 의 disp.c/h, disp_panels.h, disp_gc9a01.c, disp_spi.c/h 를 같이 추가
+ * (GC9A01_Init 과 핀/색 정의는 이 폴더의 gc9a01_driver.c/h)
+ *
+ * main.c:
+ *   Disp_Init(DispGC9A01_Init(&hspi1));
+ *   GaugeDemo_Run();       // 또는 GaugeDemo_RunDelta();
+ */
+
+#include "gauge_demo.h"
+#include "gc9a01_driver.h"
+#include "disp.h"
+
+#define CX          120
+#define CY          120
+#define FACE_R      118
+#define ARC_IN      104         // 값 고리
+#define ARC_OUT     114
+#define TICK_IN     88
+#define TICK_OUT    98
+#define NEEDLE_R    80
+#define NEEDLE_W    4
+#define HUB_R       8
+#define TICKS       11          // 0, 10, ... 100
+#define START_DEG   225         // 0 위치 (7시 반, 12시 기준 시계 방향)
+#define SWEEP_DEG   270
+
+#define COLOR_FACE  COLOR_NAVY
+#define COLOR_TRACK 0x2104      // 고리 빈 부분
+#define COLOR_ARC   COLOR_CYAN
+
+static int16_t tick_xy[TICKS][4];
+static uint8_t ticks_ready;
+static uint8_t shown_value;
+static uint16_t shown_fps;
+
+// 눈금 좌표는 한 번만 계산 (Disp_Polar = 정수 sin 표)
+static void Ticks_Init(void) {
+    for (uint8_t i = 0; i < TICKS; i++) {
+        int16_t deg = START_DEG + SWEEP_DEG * i / (TICKS - 1);
+        Disp_Polar(CX, CY, TICK_IN, deg, &tick_xy[i][0], &tick_xy[i][1]);
+        Disp_Polar(CX, CY, TICK_OUT, deg, &tick_xy[i][2], &tick_xy[i][3]);
+    }
+    ticks_ready = 1;
+}
+
+static int16_t Value_Deg(uint8_t value) {
+    return SWEEP_DEG * value / 100;
+}
+
+static DispShape_t Needle(uint8_t value, uint16_t color) {
+    DispShape_t s = { DISP_LINE, CX, CY, CX, CY, NEEDLE_W, color };
+    Disp_Polar(CX, CY, NEEDLE_R, START_DEG + Value_Deg(value), &s.x1, &s.y1);
+    return s;
+}
+
+// 칸 [bx, bx+bw) 가운데에 숫자 - 글자 창 좌/우 빈 곳만 배경으로 채워 칸 화소를 한 번씩만 보냄
+static void Draw_Number(int16_t bx, int16_t y, int16_t bw, uint16_t num, uint16_t color, uint8_t scale) {
+    char buf[6];
+    uint8_t n = sizeof(buf) - 1;
+
+    buf[n] = '\0';
+    do {
+        buf[--n] = (char)('0' + num % 10);
+        num /= 10;
+    } while (num && n);
+
+    int16_t w = (int16_t)((sizeof(buf) - 1 - n) * 6 * scale);
+    int16_t x = bx + (bw - w) / 2;
+    int16_t h = 8 * scale;
+
+    Disp_FillRect(bx, y, x - bx, h, COLOR_FACE);
+    Disp_DrawText(x, y, &buf[n], color, COLOR_FACE, scale);
+    Disp_FillRect(x + w, y, bx + bw - x - w, h, COLOR_FACE);
+}
+
+static void Draw_Value(uint8_t value) {
+    Draw_Number(90, 160, 60, value, COLOR_WHITE, 3);
+}
+
+static void Draw_Fps(uint16_t fps) {
+    Draw_Number(96, 195, 48, fps, COLOR_GREEN, 2);
+}
+
+void GaugeDemo_Frame(uint8_t value, uint16_t fps) {
+    if (!ticks_ready) Ticks_Init();
+    if (value > 100) value = 100;
+
+    Disp_BeginFrame();
+
+    // 화면 가장자리까지 검정 → 테두리 2px → 계기판 원: 세 원을 행마다 합성해 화소마다 한 번씩만 보내고,
+    // 원형 패널에 안 보이는 네 귀퉁이는 보내지 않음. 같은 행의 고리/원 run 은 창 하나로 나감
+    // (보이는 원의 중심은 119.5 라서 반지름 121 까지 칠해야 왼쪽/위 가장자리가 다 덮임)
+    const DispShape_t face[] = {
+        { DISP_CIRCLE, CX, CY, CX, CY, LCD_WIDTH / 2 + 1, COLOR_BLACK },
+        { DISP_CIRCLE, CX, CY, CX, CY, FACE_R,            COLOR_WHITE },
+        { DISP_CIRCLE, CX, CY, CX, CY, FACE_R - 2,        COLOR_FACE },
+    };
+    Disp_DrawShapes(face, 3);
+
+    // 값 고리: 0~value 는 값 색, 나머지는 트랙 (반열린 구간이라 경계에 틈/겹침 없음)
+    int16_t a = Value_Deg(value);
+    Disp_FillArc(CX, CY, ARC_IN, ARC_OUT, START_DEG, a, COLOR_ARC);
+    Disp_FillArc(CX, CY, ARC_IN, ARC_OUT, START_DEG + a, SWEEP_DEG - a, COLOR_TRACK);
+
+    for (uint8_t i = 0; i < TICKS; i++)
+        Disp_ThickLine(tick_xy[i][0], tick_xy[i][1], tick_xy[i][2], tick_xy[i][3], 2, COLOR_WHITE);
+
+    const DispShape_t needle[] = {
+        Needle(value, COLOR_RED),
+        { DISP_CIRCLE, CX, CY, CX, CY, HUB_R, COLOR_ORANGE },
+    };
+    Disp_DrawShapes(needle, 2);
+
+    Draw_Value(value);
+    Draw_Fps(fps);
+
+    Disp_EndFrame();
+    shown_value = value;
+    shown_fps = fps;
+}
+
+// 바뀐 것만: 고리는 이전 값~새 값 각도 구간만 칠함 (FillArc 가 끝 각도를 빼므로 이어 칠해도 틈/겹침 없음)
+void GaugeDemo_Update(uint8_t value, uint16_t fps) {
+    if (value > 100) value = 100;
+
+    Disp_BeginFrame();
+
+    if (value != shown_value) {
+        int16_t a_old = Value_Deg(shown_value);
+        int16_t a_new = Value_Deg(value);
+
+        if (a_new > a_old)
+            Disp_FillArc(CX, CY, ARC_IN, ARC_OUT, START_DEG + a_old, a_new - a_old, COLOR_ARC);
+        else if (a_new < a_old)
+            Disp_FillArc(CX, CY, ARC_IN, ARC_OUT, START_DEG + a_new, a_old - a_new, COLOR_TRACK);
+
+        // 이전 바늘(배경색) → 새 바늘 → 허브를 한 번에 합성: 겹친 화소는 최종 색으로 한 번만
+        const DispShape_t needle[] = {
+            Needle(shown_value, COLOR_FACE),
+            Needle(value, COLOR_RED),
+            { DISP_CIRCLE, CX, CY, CX, CY, HUB_R, COLOR_ORANGE },
+        };
+        Disp_DrawShapes(needle, 3);
+
+        Draw_Value(value);
+        shown_value = value;
+    }
+
+    if (fps != shown_fps) {
+        Draw_Fps(fps);
+        shown_fps = fps;
+    }
+
+    Disp_EndFrame();
+}
+
+static void Run(uint8_t delta) {
+    uint8_t value = 0;
+    int8_t step = 1;
+    uint16_t fps = 0;
+    uint16_t frames = 0;
+    uint32_t t0 = HAL_GetTick();
+
+    GaugeDemo_Frame(value, fps);
+
+    while (1) {
+        value += step;
+        if (value == 0 || value == 100) step = -step;
+
+        if (delta) GaugeDemo_Update(value, fps);
+        else       GaugeDemo_Frame(value, fps);
+
+        frames++;
+        uint32_t dt = HAL_GetTick() - t0;
+        if (dt >= 1000) {
+            fps = (uint16_t)(frames * 1000u / dt);
+            frames = 0;
+            t0 += dt;
+        }
+    }
+}
+
+void GaugeDemo_Run(void) {
+    Run(0);
+}
+
+void GaugeDemo_RunDelta(void) {
+    Run(1);
+}
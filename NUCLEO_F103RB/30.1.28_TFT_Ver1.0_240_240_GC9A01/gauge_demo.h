@@ -0,0 +1,16 @@
+/*
+ * gauge_demo.h
+ * 전체 화면 애니메이션 계기판 데모 (전부 / 바뀐 부분만 다시 그리기, FPS 화면 표시)
+ */
+
+#ifndef GAUGE_DEMO_H
+#define GAUGE_DEMO_H
+
+#include <stdint.h>
+
+void GaugeDemo_Frame(uint8_t value, uint16_t fps);   // 한 프레임 전부 (value 0~100)
+void GaugeDemo_Update(uint8_t value, uint16_t fps);  // 직전 프레임에서 바뀐 부분만
+void GaugeDemo_Run(void);                            // 무한 루프 (매 프레임 전부), 1초마다 FPS 갱신
+void GaugeDemo_RunDelta(void);                       // 무한 루프 (바뀐 부분만)
+
+#endif // GAUGE_DEMO_H
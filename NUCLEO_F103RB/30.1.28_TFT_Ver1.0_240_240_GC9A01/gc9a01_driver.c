@@ -11,6 +11,19 @@
 
 static SPI_HandleTypeDef *spi_handle;
 
+// 픽셀 전송용 (16비트 프레임)
+#define GC9A01_LINE_PX  240         // 줄 버퍼 픽셀 수
+#define SPI_DMA_MAX     65535u      // DMA 1회 최대 프레임 수
+
+static uint16_t line_buf[GC9A01_LINE_PX];
+static uint16_t fill_color;         // 단색 DMA 원본 (메모리 주소 고정)
+
+// 원형 화면의 보이는 영역: 행마다 [disc_l, disc_r] (Init / SetRotation 때 계산)
+// 픽셀 중심이 지름 240 원 안에 있으면 보임 → 57,600 중 약 45,200 픽셀
+static uint8_t disc_l[LCD_HEIGHT];
+static uint8_t disc_r[LCD_HEIGHT];
+static uint8_t disc_clip = 1;
+
 // 5x7 폰트 (ASCII 숫자와 콜론)
 static const uint8_t font5x7[][5] = {
     {0x00, 0x00, 0x00, 0x00, 0x00}, // ' ' (space) - index 0
@@ -35,7 +48,111 @@ static const uint8_t font5x7[][5] = {
 #define RST_LOW() HAL_GPIO_WritePin(LCD_RST_PORT, LCD_RST_PIN, GPIO_PIN_RESET)
 #define RST_HIGH() HAL_GPIO_WritePin(LCD_RST_PORT, LCD_RST_PIN, GPIO_PIN_SET)
 
+// SPI 프레임 크기 전환 (명령/파라미터 = 8비트, 픽셀 = 16비트)
+// 16비트 프레임이면 RGB565 uint16_t 를 바이트 교환 없이 그대로 보낼 수 있음
+static void SPI_Frame16(uint8_t on) {
+    uint32_t size = on ? SPI_DATASIZE_16BIT : SPI_DATASIZE_8BIT;
+    if (spi_handle->Init.DataSize == size) return;
+
+    while (spi_handle->Instance->SR & SPI_SR_BSY) { }
+    __HAL_SPI_DISABLE(spi_handle);              // DFF 는 SPE 꺼진 상태에서만 변경 가능
+    if (on) spi_handle->Instance->CR1 |= SPI_CR1_DFF;
+    else    spi_handle->Instance->CR1 &= ~SPI_CR1_DFF;
+    spi_handle->Init.DataSize = size;           // HAL 이 8/16비트 포인터 선택에 사용
+    __HAL_SPI_ENABLE(spi_handle);
+}
+
+// 창 안에 같은 색 count 픽셀
+//   DMA 있음: 메모리 증가(MINC) 끄고 fill_color 한 칸을 최대 65535번 → 240x240 = DMA 1번
+//   DMA 없음: 줄 버퍼를 색으로 채워 240픽셀씩 전송
+static void WriteColor(uint16_t color, uint32_t count) {
+    DC_HIGH();
+    CS_LOW();
+    SPI_Frame16(1);
+
+    if (spi_handle->hdmatx != NULL) {
+        DMA_Channel_TypeDef *ch = spi_handle->hdmatx->Instance;
+
+        fill_color = color;
+        ch->CCR &= ~DMA_CCR_MINC;
+        while (count) {
+            uint16_t k = (count > SPI_DMA_MAX) ? SPI_DMA_MAX : (uint16_t)count;
+            HAL_SPI_Transmit_DMA(spi_handle, (uint8_t *)&fill_color, k);
+            while (spi_handle->State != HAL_SPI_STATE_READY) { }
+            count -= k;
+        }
+        ch->CCR |= DMA_CCR_MINC;
+    } else {
+        uint16_t n = (count > GC9A01_LINE_PX) ? GC9A01_LINE_PX : (uint16_t)count;
+        for (uint16_t i = 0; i < n; i++) line_buf[i] = color;
+        while (count) {
+            uint16_t k = (count > GC9A01_LINE_PX) ? GC9A01_LINE_PX : (uint16_t)count;
+            HAL_SPI_Transmit(spi_handle, (uint8_t *)line_buf, k, HAL_MAX_DELAY);
+            count -= k;
+        }
+    }
+
+    CS_HIGH();
+}
+
+// 창 안에 픽셀 배열 (DMA 있으면 DMA, 끝날 때까지 대기)
+static void WritePixels(const uint16_t *px, uint16_t count) {
+    DC_HIGH();
+    CS_LOW();
+    SPI_Frame16(1);
+
+    if (spi_handle->hdmatx != NULL) {
+        HAL_SPI_Transmit_DMA(spi_handle, (uint8_t *)px, count);
+        while (spi_handle->State != HAL_SPI_STATE_READY) { }
+    } else {
+        HAL_SPI_Transmit(spi_handle, (uint8_t *)px, count, HAL_MAX_DELAY);
+    }
+
+    CS_HIGH();
+}
+
+// 파라미터 여러 바이트를 한 번에
+static void WriteDataBuf(const uint8_t *data, uint16_t n) {
+    SPI_Frame16(0);
+    DC_HIGH();
+    CS_LOW();
+    HAL_SPI_Transmit(spi_handle, (uint8_t *)data, n, HAL_MAX_DELAY);
+    CS_HIGH();
+}
+
+// 정수 제곱근 (floor)
+static uint16_t isqrt32(uint32_t v) {
+    uint32_t r = 0, bit = 1UL << 30;
+    while (bit > v) bit >>= 2;
+    while (bit) {
+        if (v >= r + bit) { v -= r + bit; r = (r >> 1) + bit; }
+        else              { r >>= 1; }
+        bit >>= 2;
+    }
+    return (uint16_t)r;
+}
+
+// 보이는 원의 행 span 표
+// (2x+1-W)^2 + (2y+1-H)^2 <= W^2 인 픽셀 (중심 (W/2, H/2), 반지름 W/2)
+// 원이 화면 중앙에 있어 회전(MADCTL)과 무관하게 같은 표가 나오지만, 회전을 바꿀 때 다시 계산해 둠
+static void Disc_Build(void) {
+    for (int16_t y = 0; y < LCD_HEIGHT; y++) {
+        int32_t dy = 2 * y + 1 - LCD_HEIGHT;
+        uint16_t k = isqrt32((uint32_t)LCD_WIDTH * LCD_WIDTH - dy * dy);
+        disc_l[y] = (LCD_WIDTH - k) / 2;
+        disc_r[y] = (LCD_WIDTH - 1 + k) / 2;
+    }
+}
+
+// 사각형이 통째로 원 안인지 (원은 볼록이라 네 모서리만 보면 됨)
+static uint8_t Disc_RectInside(int16_t x, int16_t y, int16_t w, int16_t h) {
+    if (!disc_clip) return 1;
+    return x >= disc_l[y] && x + w - 1 <= disc_r[y] &&
+           x >= disc_l[y + h - 1] && x + w - 1 <= disc_r[y + h - 1];
+}
+
 void GC9A01_WriteCommand(uint8_t cmd) {
+    SPI_Frame16(0);
     DC_LOW();
     CS_LOW();
     HAL_SPI_Transmit(spi_handle, &cmd, 1, HAL_MAX_DELAY);
@@ -43,6 +160,7 @@ void GC9A01_WriteCommand(uint8_t cmd) {
 }
 
 void GC9A01_WriteData(uint8_t data) {
+    SPI_Frame16(0);
     DC_HIGH();
     CS_LOW();
     HAL_SPI_Transmit(spi_handle, &data, 1, HAL_MAX_DELAY);
@@ -51,6 +169,7 @@ void GC9A01_WriteData(uint8_t data) {
 
 void GC9A01_WriteData16(uint16_t data) {
     uint8_t buffer[2] = {data >> 8, data & 0xFF};
+    SPI_Frame16(0);
     DC_HIGH();
     CS_LOW();
     HAL_SPI_Transmit(spi_handle, buffer, 2, HAL_MAX_DELAY);
@@ -59,6 +178,7 @@ void GC9A01_WriteData16(uint16_t data) {
 
 void GC9A01_Init(SPI_HandleTypeDef *hspi) {
     spi_handle = hspi;
+    Disc_Build();
 
     // 하드웨어 리셋
     CS_HIGH();
@@ -306,13 +426,14 @@ void GC9A01_Init(SPI_HandleTypeDef *hspi) {
 }
 
 void GC9A01_SetWindow(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1) {
+    uint8_t ca[4] = {x0 >> 8, x0 & 0xFF, x1 >> 8, x1 & 0xFF};
+    uint8_t ra[4] = {y0 >> 8, y0 & 0xFF, y1 >> 8, y1 & 0xFF};
+
     GC9A01_WriteCommand(GC9A01_CASET);
-    GC9A01_WriteData16(x0);
-    GC9A01_WriteData16(x1);
+    WriteDataBuf(ca, 4);
 
     GC9A01_WriteCommand(GC9A01_RASET);
-    GC9A01_WriteData16(y0);
-    GC9A01_WriteData16(y1);
+    WriteDataBuf(ra, 4);
 
     GC9A01_WriteCommand(GC9A01_RAMWR);
 }
@@ -323,6 +444,7 @@ void GC9A01_FillScreen(uint16_t color) {
 
 void GC9A01_DrawPixel(int16_t x, int16_t y, uint16_t color) {
     if (x < 0 || x >= LCD_WIDTH || y < 0 || y >= LCD_HEIGHT) return;
+    if (disc_clip && (x < disc_l[y] || x > disc_r[y])) return;
 
     GC9A01_SetWindow(x, y, x, y);
     GC9A01_WriteData16(color);
@@ -336,34 +458,77 @@ void GC9A01_FillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
     if (y < 0) { h += y; y = 0; }
     if (w <= 0 || h <= 0) return;
 
-    GC9A01_SetWindow(x, y, x + w - 1, y + h - 1);
+    if (Disc_RectInside(x, y, w, h)) {
+        GC9A01_SetWindow(x, y, x + w - 1, y + h - 1);
+        WriteColor(color, (uint32_t)w * h);
+        return;
+    }
+
+    // 원 밖으로 걸치면 행마다 원 안쪽만, 잘린 구간이 같은 행들은 창 하나로
+    int16_t by = y, bl = 0, br = -1;        // 모으는 중인 블록
+    for (int16_t row = y; row <= y + h; row++) {
+        int16_t l = 0, r = -1;
+        if (row < y + h) {
+            l = (x > disc_l[row]) ? x : disc_l[row];
+            r = (x + w - 1 < disc_r[row]) ? x + w - 1 : disc_r[row];
+            if (l == bl && r == br) continue;
+        }
+        if (bl <= br) {
+            GC9A01_SetWindow(bl, by, br, row - 1);
+            WriteColor(color, (uint32_t)(br - bl + 1) * (row - by));
+        }
+        by = row; bl = l; br = r;
+    }
+}
 
-    uint8_t colorH = color >> 8;
-    uint8_t colorL = color & 0xFF;
+void GC9A01_DrawImage(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t *img) {
+    int16_t cx0 = (x < 0) ? 0 : x;
+    int16_t cy0 = (y < 0) ? 0 : y;
+    int16_t cx1 = (x + w > LCD_WIDTH) ? LCD_WIDTH - 1 : x + w - 1;
+    int16_t cy1 = (y + h > LCD_HEIGHT) ? LCD_HEIGHT - 1 : y + h - 1;
+    if (cx0 > cx1 || cy0 > cy1) return;
+
+    for (int16_t row = cy0; row <= cy1; ) {
+        int16_t l = cx0, r = cx1;
+        if (disc_clip) {
+            if (l < disc_l[row]) l = disc_l[row];
+            if (r > disc_r[row]) r = disc_r[row];
+        }
+        if (l > r) { row++; continue; }
 
-    DC_HIGH();
-    CS_LOW();
+        // 이미지 전체 폭이 보이는 행이 이어지면 원본이 연속이라 창 하나로
+        int16_t n = 1;
+        if (l == x && r == x + w - 1) {
+            while (row + n <= cy1 && (!disc_clip || (disc_l[row + n] <= x && disc_r[row + n] >= r)) &&
+                   (uint32_t)(n + 1) * w <= SPI_DMA_MAX) n++;
+        }
 
-    for (uint32_t i = 0; i < (uint32_t)w * h; i++) {
-        uint8_t buffer[2] = {colorH, colorL};
-        HAL_SPI_Transmit(spi_handle, buffer, 2, HAL_MAX_DELAY);
+        GC9A01_SetWindow(l, row, r, row + n - 1);
+        WritePixels(img + (int32_t)(row - y) * w + (l - x), (uint16_t)((r - l + 1) * n));
+        row += n;
     }
+}
 
-    CS_HIGH();
+// 두 점을 잇는 가로/세로 구간 하나 (순서 무관)
+static void DrawRun(int16_t xa, int16_t ya, int16_t xb, int16_t yb, uint16_t color) {
+    int16_t x = (xa < xb) ? xa : xb;
+    int16_t y = (ya < yb) ? ya : yb;
+    GC9A01_FillRect(x, y, abs(xb - xa) + 1, abs(yb - ya) + 1, color);
 }
 
+// Bresenham 과 같은 점들이지만, 주축 방향으로 이어지는 점은 구간 하나(창 1개)로 묶어서 전송
 void GC9A01_DrawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) {
     int16_t dx = abs(x1 - x0);
     int16_t dy = abs(y1 - y0);
     int16_t sx = (x0 < x1) ? 1 : -1;
     int16_t sy = (y0 < y1) ? 1 : -1;
     int16_t err = dx - dy;
+    int16_t rx = x0, ry = y0;           // 현재 구간 시작점
 
     while (1) {
-        GC9A01_DrawPixel(x0, y0, color);
-
         if (x0 == x1 && y0 == y1) break;
 
+        int16_t px = x0, py = y0;
         int16_t e2 = 2 * err;
         if (e2 > -dy) {
             err -= dy;
@@ -373,49 +538,83 @@ void GC9A01_DrawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t co
             err += dx;
             y0 += sy;
         }
+
+        // 부축 좌표가 바뀌면 지금까지의 구간 출력
+        if ((dx >= dy) ? (y0 != ry) : (x0 != rx)) {
+            DrawRun(rx, ry, px, py, color);
+            rx = x0;
+            ry = y0;
+        }
     }
+    DrawRun(rx, ry, x1, y1, color);
 }
 
+// 1/8 원의 같은 y 점들(x = xs..xe)을 8방향 대칭 구간으로 출력
+static void CircleRuns(int16_t x0, int16_t y0, int16_t xs, int16_t xe, int16_t y, uint16_t color) {
+    if (xs == 0) {
+        DrawRun(x0 - xe, y0 + y, x0 + xe, y0 + y, color);   // 위/아래 꼭대기는 한 줄
+        DrawRun(x0 - xe, y0 - y, x0 + xe, y0 - y, color);
+        DrawRun(x0 + y, y0 - xe, x0 + y, y0 + xe, color);   // 좌/우 끝은 한 세로줄
+        DrawRun(x0 - y, y0 - xe, x0 - y, y0 + xe, color);
+        return;
+    }
+    DrawRun(x0 + xs, y0 + y, x0 + xe, y0 + y, color);
+    DrawRun(x0 - xe, y0 + y, x0 - xs, y0 + y, color);
+    DrawRun(x0 + xs, y0 - y, x0 + xe, y0 - y, color);
+    DrawRun(x0 - xe, y0 - y, x0 - xs, y0 - y, color);
+    DrawRun(x0 + y, y0 + xs, x0 + y, y0 + xe, color);
+    DrawRun(x0 - y, y0 + xs, x0 - y, y0 + xe, color);
+    DrawRun(x0 + y, y0 - xe, x0 + y, y0 - xs, color);
+    DrawRun(x0 - y, y0 - xe, x0 - y, y0 - xs, color);
+}
+
+// 중점 원 알고리즘과 같은 점들, y 가 같은 점은 구간 하나로 묶음
 void GC9A01_DrawCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color) {
     int16_t f = 1 - r;
     int16_t ddF_x = 1;
     int16_t ddF_y = -2 * r;
     int16_t x = 0;
     int16_t y = r;
-
-    GC9A01_DrawPixel(x0, y0 + r, color);
-    GC9A01_DrawPixel(x0, y0 - r, color);
-    GC9A01_DrawPixel(x0 + r, y0, color);
-    GC9A01_DrawPixel(x0 - r, y0, color);
+    int16_t xs = 0;                     // 현재 y 에서 구간 시작 x
 
     while (x < y) {
         if (f >= 0) {
+            CircleRuns(x0, y0, xs, x, y, color);
             y--;
             ddF_y += 2;
             f += ddF_y;
+            xs = x + 1;
         }
         x++;
         ddF_x += 2;
         f += ddF_x;
-
-        GC9A01_DrawPixel(x0 + x, y0 + y, color);
-        GC9A01_DrawPixel(x0 - x, y0 + y, color);
-        GC9A01_DrawPixel(x0 + x, y0 - y, color);
-        GC9A01_DrawPixel(x0 - x, y0 - y, color);
-        GC9A01_DrawPixel(x0 + y, y0 + x, color);
-        GC9A01_DrawPixel(x0 - y, y0 + x, color);
-        GC9A01_DrawPixel(x0 + y, y0 - x, color);
-        GC9A01_DrawPixel(x0 - y, y0 - x, color);
     }
+    CircleRuns(x0, y0, xs, x, y, color);
 }
 
+// x*x + y*y <= r*r 인 점 (기존과 같은 모양), 반폭이 같은 행들은 사각형 하나로 묶음
 void GC9A01_FillCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color) {
-    for (int16_t y = -r; y <= r; y++) {
-        for (int16_t x = -r; x <= r; x++) {
-            if (x * x + y * y <= r * r) {
-                GC9A01_DrawPixel(x0 + x, y0 + y, color);
-            }
+    if (r < 0) return;
+
+    int32_t rr = (int32_t)r * r;
+    int16_t h = r;                      // 반폭
+    int16_t y = 0;
+
+    while (y <= r) {
+        while ((int32_t)h * h + (int32_t)y * y > rr) h--;
+
+        // 같은 반폭이 이어지는 행 수
+        int16_t n = 1;
+        while (y + n <= r && (int32_t)h * h + (int32_t)(y + n) * (y + n) <= rr) n++;
+
+        if (y == 0) {
+            // 가운데 행 포함: 위아래 대칭 한 사각형
+            GC9A01_FillRect(x0 - h, y0 - (n - 1), 2 * h + 1, 2 * n - 1, color);
+        } else {
+            GC9A01_FillRect(x0 - h, y0 + y, 2 * h + 1, n, color);
+            GC9A01_FillRect(x0 - h, y0 - y - n + 1, 2 * h + 1, n, color);
         }
+        y += n;
     }
 }
 
@@ -432,24 +631,50 @@ void GC9A01_DrawChar(int16_t x, int16_t y, char c, uint16_t color, uint16_t bg,
         return; // 지원하지 않는 문자
     }
 
-    for (uint8_t i = 0; i < 5; i++) {
-        uint8_t line = font5x7[index][i];
-        for (uint8_t j = 0; j < 8; j++) {
-            if (line & 0x01) {
-                if (size == 1) {
-                    GC9A01_DrawPixel(x + i, y + j, color);
-                } else {
-                    GC9A01_FillRect(x + i * size, y + j * size, size, size, color);
-                }
-            } else if (bg != color) {
-                if (size == 1) {
-                    GC9A01_DrawPixel(x + i, y + j, bg);
-                } else {
-                    GC9A01_FillRect(x + i * size, y + j * size, size, size, bg);
-                }
+    if (size == 0) return;
+
+    const uint8_t *glyph = font5x7[index];
+    int16_t w = 5 * size, h = 8 * size;
+
+    if (bg == color) {
+        // 투명 배경: 열마다 켜진 점이 이어지는 구간을 사각형 하나로
+        for (uint8_t i = 0; i < 5; i++) {
+            uint8_t line = glyph[i];
+            for (uint8_t j = 0; j < 8; ) {
+                if (!(line & (1 << j))) { j++; continue; }
+                uint8_t k = j;
+                while (k < 8 && (line & (1 << k))) k++;
+                GC9A01_FillRect(x + i * size, y + j * size, size, (k - j) * size, color);
+                j = k;
+            }
+        }
+        return;
+    }
+
+    if (x < 0 || y < 0 || x + w > LCD_WIDTH || y + h > LCD_HEIGHT || !Disc_RectInside(x, y, w, h)) {
+        // 화면/원 경계에 걸치면 점 단위 (FillRect 가 잘라 줌)
+        for (uint8_t i = 0; i < 5; i++) {
+            for (uint8_t j = 0; j < 8; j++) {
+                uint16_t c = (glyph[i] & (1 << j)) ? color : bg;
+                GC9A01_FillRect(x + i * size, y + j * size, size, size, c);
+            }
+        }
+        return;
+    }
+
+    // 글자 칸 = 창 1개, 줄 버퍼에 들어가는 만큼 행을 펼쳐서 전송
+    uint16_t rows = GC9A01_LINE_PX / w;
+    GC9A01_SetWindow(x, y, x + w - 1, y + h - 1);
+
+    for (int16_t py = 0; py < h; ) {
+        uint16_t n = 0;
+        for (uint16_t r = 0; r < rows && py < h; r++, py++) {
+            uint8_t bit = 1 << (py / size);
+            for (int16_t px = 0; px < w; px++) {
+                line_buf[n++] = (glyph[px / size] & bit) ? color : bg;
             }
-            line >>= 1;
         }
+        WritePixels(line_buf, n);
     }
 }
 
@@ -482,4 +707,122 @@ void GC9A01_SetRotation(uint8_t rotation) {
             GC9A01_WriteData(0xA8);
             break;
     }
+    Disc_Build();
+}
+
+void GC9A01_SetDiscClip(uint8_t on) {
+    disc_clip = on;
+}
+
+// ============================================================================
+// 극좌표 도형 (각도: 12시 방향 0도, 시계 방향 +)
+// ============================================================================
+
+#define PA_QUARTER  4096            // 의사 각도 90도
+#define PA_FULL     (4 * PA_QUARTER)
+
+// 의사 각도 - atan 대신 마름모 각도 (각도 순서만 같으면 되므로 나눗셈 1번)
+// 12시 = 0, 3시 = 4096, 6시 = 8192, 9시 = 12288
+static int32_t PseudoAngle(int32_t dx, int32_t dy) {
+    int32_t ax = abs(dx), ay = abs(dy);
+    if (ax + ay == 0) return 0;
+    if (dx >= 0 && dy < 0)  return                   (ax * PA_QUARTER) / (ax + ay);
+    if (dx > 0 && dy >= 0)  return PA_QUARTER     + (ay * PA_QUARTER) / (ax + ay);
+    if (dx <= 0 && dy > 0)  return 2 * PA_QUARTER + (ax * PA_QUARTER) / (ax + ay);
+    return                         3 * PA_QUARTER + (ay * PA_QUARTER) / (ax + ay);
+}
+
+static int32_t PseudoAngleDeg(int16_t deg) {
+    float a = deg * 3.14159265f / 180.0f;
+    return PseudoAngle((int32_t)lroundf(sinf(a) * 16384.0f), (int32_t)lroundf(-cosf(a) * 16384.0f));
+}
+
+// 한 행의 [xa, xb] 안에서 각도 범위 안쪽 점들을 구간으로 모아 출력
+static void ArcRow(int16_t cx, int16_t y, int16_t dy, int16_t xa, int16_t xb,
+                   int32_t pa0, int32_t span, uint8_t full, uint16_t color) {
+    int16_t run = xb + 1;                               // 진행 중인 구간 시작 (없으면 xb+1)
+
+    for (int16_t dx = xa; dx <= xb; dx++) {
+        uint8_t in = full || ((PseudoAngle(dx, dy) - pa0 + PA_FULL) % PA_FULL) < span;
+        if (in && run > xb) run = dx;
+        if (!in && run <= xb) {
+            GC9A01_FillRect(cx + run, y, dx - run, 1, color);
+            run = xb + 1;
+        }
+    }
+    if (run <= xb) GC9A01_FillRect(cx + run, y, xb - run + 1, 1, color);
+}
+
+// 반지름 r_in~r_out, start 부터 sweep 도(끝 각도 제외) 고리 조각
+// 행마다 고리 구간(구멍 좌/우)만 훑어서 각도 안쪽 점들을 구간으로 FillRect (원 클리핑 포함)
+// 끝 각도를 빼므로 [a,b) + [b,c) = [a,c) → 계기판 값 변화분만 칠해도 전체를 다시 그린 것과 같음
+void GC9A01_FillArc(int16_t cx, int16_t cy, int16_t r_in, int16_t r_out,
+                    int16_t start_deg, int16_t sweep_deg, uint16_t color) {
+    if (r_out < 0 || sweep_deg <= 0) return;
+    if (r_in < 0) r_in = 0;
+
+    uint8_t full = sweep_deg >= 360;
+    int32_t pa0 = PseudoAngleDeg(start_deg);
+    int32_t span = (PseudoAngleDeg(start_deg + sweep_deg) - pa0 + PA_FULL) % PA_FULL;
+    int32_t ro2 = (int32_t)r_out * r_out + r_out;       // 바깥: dx²+dy² <= r²+r
+    int32_t ri2 = (int32_t)r_in * r_in - r_in;          // 구멍: dx²+dy² <= r²-r (r_in > 0)
+
+    for (int16_t dy = -r_out; dy <= r_out; dy++) {
+        int16_t y = cy + dy;
+        if (y < 0 || y >= LCD_HEIGHT) continue;
+
+        int32_t dy2 = (int32_t)dy * dy;
+        int16_t ho = isqrt32(ro2 - dy2);
+
+        if (r_in > 0 && ri2 - dy2 >= 0) {
+            int16_t hi = isqrt32(ri2 - dy2);
+            ArcRow(cx, y, dy, -ho, -hi - 1, pa0, span, full, color);
+            ArcRow(cx, y, dy, hi + 1, ho, pa0, span, full, color);
+        } else {
+            ArcRow(cx, y, dy, -ho, ho, pa0, span, full, color);
+        }
+    }
+}
+
+void GC9A01_DrawArc(int16_t cx, int16_t cy, int16_t r, int16_t thick,
+                    int16_t start_deg, int16_t sweep_deg, uint16_t color) {
+    GC9A01_FillArc(cx, cy, r - thick + 1, r, start_deg, sweep_deg, color);
+}
+
+// 바늘 - 중심에서 r0~r1, 폭 width 인 사각형(회전)을 행 단위 span 으로
+// 같은 인자로 배경색을 다시 그리면 정확히 지워짐
+void GC9A01_DrawNeedle(int16_t cx, int16_t cy, int16_t r0, int16_t r1,
+                       int16_t deg, int16_t width, uint16_t color) {
+    float a = deg * 3.14159265f / 180.0f;
+    float ux = sinf(a), uy = -cosf(a);                  // 바늘 방향
+    float hx = -uy * width * 0.5f, hy = ux * width * 0.5f;  // 폭 방향 절반
+
+    float px[4] = { cx + ux * r0 + hx, cx + ux * r1 + hx, cx + ux * r1 - hx, cx + ux * r0 - hx };
+    float py[4] = { cy + uy * r0 + hy, cy + uy * r1 + hy, cy + uy * r1 - hy, cy + uy * r0 - hy };
+
+    float ymin = py[0], ymax = py[0];
+    for (uint8_t i = 1; i < 4; i++) {
+        if (py[i] < ymin) ymin = py[i];
+        if (py[i] > ymax) ymax = py[i];
+    }
+
+    // 픽셀 중심 (x+0.5, y+0.5) 이 사각형 안이면 칠함
+    for (int16_t y = (int16_t)ceilf(ymin - 0.5f); y + 0.5f <= ymax; y++) {
+        float sy = y + 0.5f;
+        float xl = 1e9f, xr = -1e9f;
+
+        for (uint8_t i = 0; i < 4; i++) {
+            uint8_t j = (i + 1) & 3;
+            if ((py[i] <= sy && py[j] >= sy) || (py[j] <= sy && py[i] >= sy)) {
+                float xi = (py[i] == py[j]) ? px[i]
+                         : px[i] + (sy - py[i]) * (px[j] - px[i]) / (py[j] - py[i]);
+                if (xi < xl) xl = xi;
+                if (xi > xr) xr = xi;
+            }
+        }
+
+        int16_t x0 = (int16_t)ceilf(xl - 0.5f);
+        int16_t x1 = (int16_t)floorf(xr - 0.5f);
+        if (x0 <= x1) GC9A01_FillRect(x0, y, x1 - x0 + 1, 1, color);
+    }
 }
@@ -60,6 +60,15 @@ void GC9A01_FillCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color);
 void GC9A01_DrawChar(int16_t x, int16_t y, char c, uint16_t color, uint16_t bg, uint8_t size);
 void GC9A01_DrawString(int16_t x, int16_t y, const char *str, uint16_t color, uint16_t bg, uint8_t size);
 void GC9A01_DrawNumber(int16_t x, int16_t y, int32_t num, uint16_t color, uint16_t bg, uint8_t size);
+void GC9A01_DrawImage(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t *img);
+
+// 원형 화면 클리핑 (기본 켜짐: 모든 채우기/이미지를 보이는 원 안으로 자름)
+void GC9A01_SetDiscClip(uint8_t on);
+
+// 극좌표 도형 (각도: 12시 방향 0도, 시계 방향 +, 끝 각도 제외)
+void GC9A01_FillArc(int16_t cx, int16_t cy, int16_t r_in, int16_t r_out, int16_t start_deg, int16_t sweep_deg, uint16_t color);
+void GC9A01_DrawArc(int16_t cx, int16_t cy, int16_t r, int16_t thick, int16_t start_deg, int16_t sweep_deg, uint16_t color);
+void GC9A01_DrawNeedle(int16_t cx, int16_t cy, int16_t r0, int16_t r1, int16_t deg, int16_t width, uint16_t color);
 
 // 내부 함수
 void GC9A01_WriteCommand(uint8_t cmd);
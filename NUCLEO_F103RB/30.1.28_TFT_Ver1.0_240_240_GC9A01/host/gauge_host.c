@@ -0,0 +1,112 @@
+/*
+ * host/gauge_host.c
+ * gauge_demo.c 를 PC 에서 돌려 보는 검증 프로그램 (05_Display_HAL 의 disp.c + disp_host.c 가상 패널)
+ *
+ *   - 매 프레임 전부 / 값 +1 / 임의 값 부분 갱신의 창 수, 화소 수, 버스 바이트를 셈
+ *     (창 1개 = CASET/RASET/RAMWR 11바이트, 화소 = 2바이트, SPI 32MHz 로 바이트 시간만 계산)
+ *   - GaugeDemo_Frame 이 보이는 원(지름 240) 안 화소를 모두 칠하는지 (귀퉁이는 안 보내도 됨)
+ *   - 부분 갱신을 거듭한 화면 = GaugeDemo_Frame 으로 전부 그린 화면 인지 확인
+ *   - 창 범위를 넘어 써진 화소 0, 결과 화면 gauge.ppm 저장
+ *
+ * 빌드 (프로젝트 폴더에서):
+ *   gcc -O2 -Wall -I. -Ihost -I../36.Vector/05_Display_HAL -o gauge_host gauge_demo.c \
+ *       ../36.Vector/05_Display_HAL/disp.c ../36.Vector/05_Display_HAL/disp_host.c host/gauge_host.c
+ *   ./gauge_host           마지막 줄이 "# OK" 면 통과
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "gc9a01_driver.h"
+#include "gauge_demo.h"
+#include "disp.h"
+#include "disp_host.h"
+
+#define WINDOW_BYTES    11          // CASET(1+4) + RASET(1+4) + RAMWR(1)
+#define US_PER_BYTE     0.25        // 8비트 / 32MHz
+
+static int failures;
+
+#define CHECK(cond, ...) do { \
+        if (!(cond)) { failures++; printf("FAIL: "); printf(__VA_ARGS__); printf("\n"); } \
+    } while (0)
+
+uint32_t HAL_GetTick(void) { return 0; }    // GaugeDemo_Run 용, 여기서는 안 부름
+
+static void Report(const char *what, int frames) {
+    DispHostStats_t hs;
+    DispHost_GetStats(&hs);
+
+    uint32_t bytes = hs.windows * WINDOW_BYTES + hs.pixels * 2;
+    double us = bytes * US_PER_BYTE / frames;
+    printf("%-16s %7u windows %8u px %9u bytes | %6.1f ms/frame %7.1f FPS\n",
+           what, hs.windows / frames, hs.pixels / frames, bytes / frames, us / 1000.0, 1e6 / us);
+    CHECK(hs.overflow == 0, "%s: %u pixels past window end", what, hs.overflow);
+    DispHost_ResetStats();
+}
+
+// 보이는 원: 화소 중심이 지름 240 원 안 (gc9a01_host.c 와 같은 기준)
+static int Visible(int x, int y) {
+    int dx = 2 * x + 1 - LCD_WIDTH, dy = 2 * y + 1 - LCD_HEIGHT;
+    return dx * dx + dy * dy <= LCD_WIDTH * LCD_WIDTH;
+}
+
+static uint32_t rng = 1;
+static int16_t Rand(int16_t lo, int16_t hi) {
+    rng = rng * 1103515245u + 12345u;
+    return lo + (int16_t)((rng >> 16) % (uint32_t)(hi - lo + 1));
+}
+
+int main(void) {
+    static uint16_t ref[LCD_WIDTH * LCD_HEIGHT];
+
+    Disp_Init(DispHost_Init(LCD_WIDTH, LCD_HEIGHT, 1));
+
+    // 1. 전체 프레임이 보이는 원 안을 빠짐없이 덮는지 (쓰레기 값 위에 그려 봄)
+    memset(DispHost_Frame(), 0x5A, sizeof(ref));
+    GaugeDemo_Frame(50, 0);
+    uint32_t stale = 0, corner = 0;
+    for (int y = 0; y < LCD_HEIGHT; y++)
+        for (int x = 0; x < LCD_WIDTH; x++) {
+            uint8_t left = DispHost_Frame()[y * LCD_WIDTH + x] == 0x5A5A;
+            if (Visible(x, y)) stale += left;
+            else corner += !left;
+        }
+    printf("GaugeDemo_Frame: %u visible pixels left unpainted, %u pixels sent outside the disc\n", stale, corner);
+    CHECK(stale == 0, "GaugeDemo_Frame leaves %u visible pixels unpainted", stale);
+    DispHost_ResetStats();
+
+    // 2. 매 프레임 전부
+    for (int v = 0; v < 100; v++) GaugeDemo_Frame(v, 0);
+    Report("GaugeDemo_Frame", 100);
+
+    // 3. 부분 갱신 - 값이 1씩 움직일 때, 임의로 튈 때
+    GaugeDemo_Frame(0, 0);
+    DispHost_ResetStats();
+    for (int v = 1; v <= 100; v++) GaugeDemo_Update(v, 0);
+    Report("Update +1", 100);
+
+    memcpy(ref, DispHost_Frame(), sizeof(ref));
+    GaugeDemo_Frame(100, 0);
+    CHECK(memcmp(ref, DispHost_Frame(), sizeof(ref)) == 0, "Update +1 to 100 differs from a full frame");
+    DispHost_ResetStats();
+
+    uint8_t v = 100;
+    uint16_t fps = 0;
+    for (int i = 0; i < 300; i++) {
+        v = (uint8_t)Rand(0, 100);
+        if (i % 50 == 0) fps = (uint16_t)Rand(0, 120);
+        GaugeDemo_Update(v, fps);
+    }
+    Report("Update random", 300);
+
+    // 4. 부분 갱신 결과 = 전부 다시 그린 결과
+    memcpy(ref, DispHost_Frame(), sizeof(ref));
+    GaugeDemo_Frame(v, fps);
+    uint32_t bad = 0;
+    for (uint32_t i = 0; i < LCD_WIDTH * LCD_HEIGHT; i++) bad += ref[i] != DispHost_Frame()[i];
+    CHECK(bad == 0, "Update random: %u pixels differ from a full frame", bad);
+    DispHost_SavePPM("gauge.ppm");
+
+    printf("\n%s\n", failures ? "# FAIL" : "# OK");
+    return failures ? 1 : 0;
+}
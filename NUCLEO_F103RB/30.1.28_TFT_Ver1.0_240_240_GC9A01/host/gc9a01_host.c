@@ -0,0 +1,231 @@
+/*
+ * host/gc9a01_host.c
+ * gc9a01_driver.c 를 PC 에서 돌려 보는 검증 프로그램
+ *
+ *   - SPI 바이트를 GC9A01 명령(CASET/RASET/RAMWR) 모델로 해석해 240x240 화면에 그림
+ *   - HAL 호출 수 / SPI 바이트 / DMA 전송 수를 세고 전송 시간과 FPS 를 추정
+ *   - 화면을 PPM 으로 저장 → 이전 드라이버로 만든 결과와 cmp 로 비교
+ *     (보이는 원 밖 화소는 0 으로 저장 - 원 클리핑 전후 결과를 그대로 비교 가능)
+ *   - 원 밖에 써진 화소 수, 고리 조각을 이어 칠한 결과 = 한 번에 칠한 결과 인지 확인
+ *   (계기판 데모는 Disp_* 로 옮겨서 host/gauge_host.c 가 따로 검증)
+ *
+ * 빌드 (프로젝트 폴더에서):
+ *   gcc -O2 -Wall -I. -Ihost -o gc9a01_host gc9a01_driver.c host/gc9a01_host.c -lm
+ *   ./gc9a01_host          DMA 있음 (CubeMX SPI1_TX DMA 설정)
+ *   ./gc9a01_host nodma    DMA 없음 (폴링 전송)
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "gc9a01_driver.h"
+
+// 추정 모델 (64MHz, SPI 32MHz)
+#define US_PER_BYTE     0.25        // 8비트 / 32MHz
+#define US_PER_HAL_SPI  2.0         // HAL_SPI_Transmit(_DMA) 호출 1회 고정 비용
+#define US_PER_GPIO     0.3         // HAL_GPIO_WritePin 1회
+
+GPIO_TypeDef host_gpioa, host_gpiob;
+
+static SPI_TypeDef spi_regs;
+static DMA_Channel_TypeDef dma_regs = { DMA_CCR_MINC };
+static DMA_HandleTypeDef hdma = { &dma_regs };
+static SPI_HandleTypeDef hspi = { &spi_regs, { SPI_DATASIZE_8BIT }, NULL, HAL_SPI_STATE_READY };
+
+static struct {
+    uint32_t spi_calls, dma_calls, gpio_calls, bytes;
+    uint32_t outside;           // 보이는 원 밖에 써진 화소
+} cnt;
+
+// ============================================================================
+// GC9A01 메모리 모델
+// ============================================================================
+
+static uint16_t fb[LCD_HEIGHT][LCD_WIDTH];
+
+// 보이는 원: 화소 중심이 지름 240 원 안 (드라이버 표와 별개로 계산)
+static int Visible(int x, int y) {
+    int dx = 2 * x + 1 - LCD_WIDTH, dy = 2 * y + 1 - LCD_HEIGHT;
+    return dx * dx + dy * dy <= LCD_WIDTH * LCD_WIDTH;
+}
+static struct {
+    uint8_t cmd, n;
+    uint8_t p[4];
+    uint16_t xs, xe, ys, ye, x, y;
+    uint8_t hi, have_hi;
+} lcd;
+
+static void Lcd_Byte(uint8_t b) {
+    cnt.bytes++;
+    if (host_gpioa.ODR & LCD_CS_PIN) return;        // CS High → 무시
+
+    if (!(host_gpioa.ODR & LCD_DC_PIN)) {           // 명령
+        lcd.cmd = b;
+        lcd.n = 0;
+        lcd.have_hi = 0;
+        if (b == GC9A01_RAMWR) { lcd.x = lcd.xs; lcd.y = lcd.ys; }
+        return;
+    }
+
+    switch (lcd.cmd) {
+    case GC9A01_CASET:
+    case GC9A01_RASET:
+        if (lcd.n < 4) lcd.p[lcd.n++] = b;
+        if (lcd.n == 4) {
+            uint16_t s = lcd.p[0] << 8 | lcd.p[1], e = lcd.p[2] << 8 | lcd.p[3];
+            if (lcd.cmd == GC9A01_CASET) { lcd.xs = s; lcd.xe = e; }
+            else                         { lcd.ys = s; lcd.ye = e; }
+        }
+        break;
+
+    case GC9A01_RAMWR:
+        if (!lcd.have_hi) { lcd.hi = b; lcd.have_hi = 1; break; }
+        lcd.have_hi = 0;
+        if (lcd.y <= lcd.ye && lcd.x < LCD_WIDTH && lcd.y < LCD_HEIGHT) {
+            fb[lcd.y][lcd.x] = lcd.hi << 8 | b;
+            if (!Visible(lcd.x, lcd.y)) cnt.outside++;
+        }
+        if (++lcd.x > lcd.xe) { lcd.x = lcd.xs; lcd.y++; }
+        break;
+    }
+}
+
+// 프레임 하나 (16비트 프레임이면 상위 바이트 먼저)
+static void Lcd_Frame(const uint8_t *p) {
+    if (spi_regs.CR1 & SPI_CR1_DFF) {
+        uint16_t v = *(const uint16_t *)p;
+        Lcd_Byte(v >> 8);
+        Lcd_Byte(v & 0xFF);
+    } else {
+        Lcd_Byte(*p);
+    }
+}
+
+// ============================================================================
+// HAL
+// ============================================================================
+
+void HAL_GPIO_WritePin(GPIO_TypeDef *port, uint16_t pin, GPIO_PinState state) {
+    cnt.gpio_calls++;
+    if (state) port->ODR |= pin;
+    else       port->ODR &= ~pin;
+}
+
+HAL_StatusTypeDef HAL_SPI_Transmit(SPI_HandleTypeDef *h, uint8_t *data, uint16_t size, uint32_t timeout) {
+    (void)timeout;
+    uint8_t step = (h->Instance->CR1 & SPI_CR1_DFF) ? 2 : 1;
+    cnt.spi_calls++;
+    for (uint16_t i = 0; i < size; i++) Lcd_Frame(data + i * step);
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_SPI_Transmit_DMA(SPI_HandleTypeDef *h, uint8_t *data, uint16_t size) {
+    uint8_t step = (h->Instance->CR1 & SPI_CR1_DFF) ? 2 : 1;
+    uint8_t inc = (h->hdmatx->Instance->CCR & DMA_CCR_MINC) != 0;
+    cnt.dma_calls++;
+    for (uint16_t i = 0; i < size; i++) Lcd_Frame(data + (inc ? i * step : 0));
+    h->State = HAL_SPI_STATE_READY;             // 완료 인터럽트까지 끝난 상태
+    return HAL_OK;
+}
+
+void HAL_Delay(uint32_t ms) { (void)ms; }
+uint32_t HAL_GetTick(void) { return 0; }
+
+// ============================================================================
+
+static void Save(const char *path) {
+    FILE *f = fopen(path, "wb");
+    fprintf(f, "P6\n%d %d\n255\n", LCD_WIDTH, LCD_HEIGHT);
+    for (int y = 0; y < LCD_HEIGHT; y++)
+        for (int x = 0; x < LCD_WIDTH; x++) {
+            uint16_t c = Visible(x, y) ? fb[y][x] : 0;
+            uint8_t rgb[3] = { (c >> 11) << 3, ((c >> 5) & 0x3F) << 2, (c & 0x1F) << 3 };
+            fwrite(rgb, 1, 3, f);
+        }
+    fclose(f);
+}
+
+static void Report(const char *what, int frames) {
+    double us = cnt.bytes * US_PER_BYTE
+              + (cnt.spi_calls + cnt.dma_calls) * US_PER_HAL_SPI
+              + cnt.gpio_calls * US_PER_GPIO;
+    us /= frames;
+    printf("%-14s %9u HAL_SPI %6u DMA %9u GPIO %9u bytes %6u out | %8.1f ms/frame  %6.1f FPS\n",
+           what, cnt.spi_calls / frames, cnt.dma_calls / frames, cnt.gpio_calls / frames,
+           cnt.bytes / frames, cnt.outside, us / 1000.0, 1e6 / us);
+    memset(&cnt, 0, sizeof(cnt));
+}
+
+static uint32_t rng = 1;
+static int16_t Rand(int16_t lo, int16_t hi) {
+    rng = rng * 1103515245u + 12345u;
+    return lo + (int16_t)((rng >> 16) % (uint32_t)(hi - lo + 1));
+}
+
+int main(int argc, char **argv) {
+    uint8_t dma = !(argc > 1 && strcmp(argv[1], "nodma") == 0);
+    hspi.hdmatx = dma ? &hdma : NULL;
+
+    GC9A01_Init(&hspi);
+    memset(&cnt, 0, sizeof(cnt));
+
+    // 1. 도형 모음 (경계 밖 좌표 포함) → test.ppm
+    GC9A01_FillScreen(COLOR_BLACK);
+    for (int i = 0; i < 300; i++) {
+        uint16_t c = (uint16_t)Rand(0, 32767) * 2 + 1;
+        switch (i % 6) {
+        case 0: GC9A01_DrawLine(Rand(-20, 260), Rand(-20, 260), Rand(-20, 260), Rand(-20, 260), c); break;
+        case 1: GC9A01_DrawCircle(Rand(-20, 260), Rand(-20, 260), Rand(0, 80), c); break;
+        case 2: GC9A01_FillCircle(Rand(-20, 260), Rand(-20, 260), Rand(0, 40), c); break;
+        case 3: GC9A01_FillRect(Rand(-20, 240), Rand(-20, 240), Rand(0, 60), Rand(0, 60), c); break;
+        case 4: GC9A01_DrawString(Rand(-20, 230), Rand(-20, 230), "12:34", c, c, Rand(1, 3)); break;
+        case 5: GC9A01_DrawNumber(Rand(-20, 230), Rand(-20, 230), Rand(0, 9999), c, ~c, Rand(1, 3)); break;
+        }
+    }
+    Save("test.ppm");
+    printf("test scene: %u pixels written outside the disc\n", cnt.outside);
+    memset(&cnt, 0, sizeof(cnt));
+
+    // 2. 개별 항목
+    GC9A01_FillScreen(COLOR_BLUE);
+    Report("FillScreen", 1);
+    GC9A01_FillCircle(120, 120, 100, COLOR_RED);
+    Report("FillCircle100", 1);
+    GC9A01_DrawCircle(120, 120, 100, COLOR_WHITE);
+    Report("DrawCircle100", 1);
+    GC9A01_DrawLine(10, 30, 230, 200, COLOR_GREEN);
+    Report("DrawLine", 1);
+    GC9A01_DrawString(48, 100, "12:34:56", COLOR_WHITE, COLOR_BLACK, 3);
+    Report("DrawString x3", 1);
+    GC9A01_FillArc(120, 120, 104, 114, 225, 270, COLOR_CYAN);
+    Report("FillArc 270", 1);
+    GC9A01_DrawNeedle(120, 120, 0, 80, 300, 4, COLOR_RED);
+    Report("DrawNeedle", 1);
+
+    static uint16_t img[LCD_HEIGHT * LCD_WIDTH];
+    for (int i = 0; i < LCD_HEIGHT * LCD_WIDTH; i++) img[i] = (uint16_t)(i * 37);
+    GC9A01_DrawImage(0, 0, LCD_WIDTH, LCD_HEIGHT, img);
+    Report("DrawImage", 1);
+
+    int bad = 0;
+    for (int y = 0; y < LCD_HEIGHT; y++)
+        for (int x = 0; x < LCD_WIDTH; x++)
+            if (Visible(x, y) && fb[y][x] != img[y * LCD_WIDTH + x]) bad++;
+    printf("DrawImage: %d visible pixels differ\n", bad);
+
+    // 3. 고리 조각 이어 칠하기 = 한 번에 칠하기
+    static uint16_t ref[LCD_HEIGHT][LCD_WIDTH];
+    GC9A01_FillScreen(COLOR_BLACK);
+    GC9A01_FillArc(120, 120, 60, 110, 200, 300, COLOR_WHITE);
+    memcpy(ref, fb, sizeof(fb));
+    GC9A01_FillScreen(COLOR_BLACK);
+    for (int16_t a = 200; a < 500; ) {
+        int16_t n = Rand(1, 40);
+        if (a + n > 500) n = 500 - a;
+        GC9A01_FillArc(120, 120, 60, 110, a, n, COLOR_WHITE);
+        a += n;
+    }
+    printf("FillArc pieces: %s\n", memcmp(ref, fb, sizeof(fb)) ? "DIFFERENT" : "same as one sweep");
+
+    return 0;
+}
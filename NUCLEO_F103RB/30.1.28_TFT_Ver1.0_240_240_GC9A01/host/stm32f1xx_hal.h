@@ -0,0 +1,58 @@
+/*
+ * host/stm32f1xx_hal.h
+ * PC 검증용 최소 HAL (gc9a01_driver.c 가 쓰는 것만)
+ * SPI 로 나가는 바이트를 GC9A01 메모리 모델(gc9a01_host.c)로 보냄
+ */
+
+#ifndef HOST_STM32F1XX_HAL_H
+#define HOST_STM32F1XX_HAL_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+typedef enum { HAL_OK = 0, HAL_ERROR } HAL_StatusTypeDef;
+typedef enum { GPIO_PIN_RESET = 0, GPIO_PIN_SET } GPIO_PinState;
+
+typedef struct { uint32_t ODR; } GPIO_TypeDef;
+extern GPIO_TypeDef host_gpioa, host_gpiob;
+#define GPIOA (&host_gpioa)
+#define GPIOB (&host_gpiob)
+
+#define GPIO_PIN_4  0x0010
+#define GPIO_PIN_8  0x0100
+#define GPIO_PIN_9  0x0200
+
+typedef struct { volatile uint32_t CR1, SR; } SPI_TypeDef;
+#define SPI_CR1_SPE     0x0040
+#define SPI_CR1_DFF     0x0800
+#define SPI_SR_BSY      0x0080
+
+typedef struct { volatile uint32_t CCR; } DMA_Channel_TypeDef;
+#define DMA_CCR_MINC    0x0080
+
+typedef struct { DMA_Channel_TypeDef *Instance; } DMA_HandleTypeDef;
+
+#define SPI_DATASIZE_8BIT   0x0000
+#define SPI_DATASIZE_16BIT  SPI_CR1_DFF
+
+typedef enum { HAL_SPI_STATE_READY = 1, HAL_SPI_STATE_BUSY_TX } HAL_SPI_StateTypeDef;
+
+typedef struct {
+    SPI_TypeDef *Instance;
+    struct { uint32_t DataSize; } Init;
+    DMA_HandleTypeDef *hdmatx;
+    volatile HAL_SPI_StateTypeDef State;
+} SPI_HandleTypeDef;
+
+#define __HAL_SPI_ENABLE(h)     ((h)->Instance->CR1 |= SPI_CR1_SPE)
+#define __HAL_SPI_DISABLE(h)    ((h)->Instance->CR1 &= ~SPI_CR1_SPE)
+
+#define HAL_MAX_DELAY   0xFFFFFFFFu
+
+void HAL_GPIO_WritePin(GPIO_TypeDef *port, uint16_t pin, GPIO_PinState state);
+HAL_StatusTypeDef HAL_SPI_Transmit(SPI_HandleTypeDef *h, uint8_t *data, uint16_t size, uint32_t timeout);
+HAL_StatusTypeDef HAL_SPI_Transmit_DMA(SPI_HandleTypeDef *h, uint8_t *data, uint16_t size);
+void HAL_Delay(uint32_t ms);
+uint32_t HAL_GetTick(void);
+
+#endif
@@ -12,55 +12,30 @@
  *
  * CubeMX 설정:
  *   - SPI1: Mode=Transmit Only Master, Prescaler=4
+ *   - DMA: SPI1_TX (DMA1 Channel3), Normal, Half Word / Half Word
+ *   - NVIC: DMA1 channel3 global interrupt Enable
  *   - GPIO Output: PA1, PA6, PB6
  *   - System Clock: 64MHz
  *
+ * 그리기: 05_Display_HAL 공통 코어 (Disp_*)
+ *   - 프로젝트에 disp.c, disp_st7735.c, disp_spi.c/h, disp.h, disp_panels.h 추가
+ *   - 오프셋(0,26), MADCTL 0x60 은 disp_st7735.c 에 있음
+ *
  * ============================================================================
  */
 
 #include "main.h"
+#include "disp_panels.h"
 #include <string.h>
 #include <stdlib.h>
 
 SPI_HandleTypeDef hspi1;
+DMA_HandleTypeDef hdma_spi1_tx;
 
 // ============================================================================
-// ST7735S LCD 설정
+// 화면 설정
 // ============================================================================
 
-#define LCD_WIDTH  160
-#define LCD_HEIGHT 80
-
-// ★ 오프셋 설정 (0.96" 160x80 LCD, 핀 위쪽) ★
-// 안 맞으면 다른 값 시도: (24,0), (26,1), (1,26), (0,24)
-#define X_OFFSET   0 //24
-#define Y_OFFSET   26
-
-// ST7735 Commands
-#define ST7735_SWRESET 0x01  // Software Reset - 디스플레이 소프트웨어 리셋
-#define ST7735_SLPOUT  0x11  // Sleep Out - 슬립 모드 해제, 정상 동작 모드 진입
-#define ST7735_NORON   0x13  // Normal Display Mode On - 일반 디스플레이 모드 활성화
-#define ST7735_INVOFF  0x20  // Display Inversion Off - 색상 반전 비활성화
-#define ST7735_INVON   0x21  // Display Inversion On - 색상 반전 활성화
-#define ST7735_DISPON  0x29  // Display On - 디스플레이 출력 활성화
-#define ST7735_CASET   0x2A  // Column Address Set - X축(열) 주소 범위 설정
-#define ST7735_RASET   0x2B  // Row Address Set - Y축(행) 주소 범위 설정
-#define ST7735_RAMWR   0x2C  // Memory Write - 디스플레이 RAM에 픽셀 데이터 쓰기 시작
-#define ST7735_COLMOD  0x3A  // Interface Pixel Format - 픽셀 포맷 설정 (12/16/18bit)
-#define ST7735_MADCTL  0x36  // Memory Access Control - 화면 방향, RGB/BGR 순서 설정
-#define ST7735_FRMCTR1 0xB1  // Frame Rate Control 1 - Normal 모드 프레임 레이트 설정
-#define ST7735_FRMCTR2 0xB2  // Frame Rate Control 2 - Idle 모드 프레임 레이트 설정
-#define ST7735_FRMCTR3 0xB3  // Frame Rate Control 3 - Partial 모드 프레임 레이트 설정
-#define ST7735_INVCTR  0xB4  // Display Inversion Control - 반전 모드 제어
-#define ST7735_PWCTR1  0xC0  // Power Control 1 - GVDD 전압 설정 (화면 밝기 관련)
-#define ST7735_PWCTR2  0xC1  // Power Control 2 - VGH/VGL 승압 회로 설정
-#define ST7735_PWCTR3  0xC2  // Power Control 3 - Normal 모드 Op-Amp 전류 설정
-#define ST7735_PWCTR4  0xC3  // Power Control 4 - Idle 모드 Op-Amp 전류 설정
-#define ST7735_PWCTR5  0xC4  // Power Control 5 - Partial 모드 Op-Amp 전류 설정
-#define ST7735_VMCTR1  0xC5  // VCOM Control 1 - VCOM 전압 설정 (대비/명암 관련)
-#define ST7735_GMCTRP1 0xE0  // Gamma '+' Polarity Correction - 양극성 감마 보정 (밝은 영역)
-#define ST7735_GMCTRN1 0xE1  // Gamma '-' Polarity Correction - 음극성 감마 보정 (어두운 영역)
-
 // Colors (RGB565)
 #define BLACK       0x0000
 #define WHITE       0xFFFF
@@ -81,14 +56,6 @@ SPI_HandleTypeDef hspi1;
 #define EYE_H           50
 #define EYE_R           10
 
-// GPIO 매크로
-#define LCD_CS_LOW()   HAL_GPIO_WritePin(GPIOB, GPIO_PIN_6, GPIO_PIN_RESET)
-#define LCD_CS_HIGH()  HAL_GPIO_WritePin(GPIOB, GPIO_PIN_6, GPIO_PIN_SET)
-#define LCD_DC_LOW()   HAL_GPIO_WritePin(GPIOA, GPIO_PIN_6, GPIO_PIN_RESET)
-#define LCD_DC_HIGH()  HAL_GPIO_WritePin(GPIOA, GPIO_PIN_6, GPIO_PIN_SET)
-#define LCD_RES_LOW()  HAL_GPIO_WritePin(GPIOA, GPIO_PIN_1, GPIO_PIN_RESET)
-#define LCD_RES_HIGH() HAL_GPIO_WritePin(GPIOA, GPIO_PIN_1, GPIO_PIN_SET)
-
 // Expression 타입
 typedef enum {
     EXPR_NORMAL, EXPR_HAPPY, EXPR_SAD, EXPR_ANGRY,
@@ -101,252 +68,71 @@ static Expression_t current_expr = EXPR_NORMAL;
 static uint32_t last_blink = 0;
 static uint32_t last_action = 0;
 
-// ============================================================================
-// LCD 기본 함수
-// ============================================================================
-
-static void LCD_Cmd(uint8_t cmd) {
-    LCD_DC_LOW();
-    LCD_CS_LOW();
-    HAL_SPI_Transmit(&hspi1, &cmd, 1, HAL_MAX_DELAY);
-    LCD_CS_HIGH();
-}
-
-static void LCD_Data(uint8_t data) {
-    LCD_DC_HIGH();
-    LCD_CS_LOW();
-    HAL_SPI_Transmit(&hspi1, &data, 1, HAL_MAX_DELAY);
-    LCD_CS_HIGH();
-}
-
-// ★ 오프셋 적용된 SetWindow ★
-static void LCD_SetWindow(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1) {
-    LCD_Cmd(ST7735_CASET);
-    LCD_Data(0); LCD_Data(x0 + X_OFFSET);
-    LCD_Data(0); LCD_Data(x1 + X_OFFSET);
-
-    LCD_Cmd(ST7735_RASET);
-    LCD_Data(0); LCD_Data(y0 + Y_OFFSET);
-    LCD_Data(0); LCD_Data(y1 + Y_OFFSET);
-
-    LCD_Cmd(ST7735_RAMWR);
-}
-
-// 고속 색상 출력
-static void LCD_WriteColorFast(uint16_t color, uint32_t count) {
-    uint8_t hi = color >> 8;
-    uint8_t lo = color & 0xFF;
-
-    LCD_DC_HIGH();
-    LCD_CS_LOW();
-    while(count--) {
-        HAL_SPI_Transmit(&hspi1, &hi, 1, HAL_MAX_DELAY);
-        HAL_SPI_Transmit(&hspi1, &lo, 1, HAL_MAX_DELAY);
-    }
-    LCD_CS_HIGH();
-}
-
-// 사각형 채우기
-static void LCD_FillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
-    if(x >= LCD_WIDTH || y >= LCD_HEIGHT || w <= 0 || h <= 0) return;
-    if(x < 0) { w += x; x = 0; }
-    if(y < 0) { h += y; y = 0; }
-    if(x + w > LCD_WIDTH) w = LCD_WIDTH - x;
-    if(y + h > LCD_HEIGHT) h = LCD_HEIGHT - y;
-    if(w <= 0 || h <= 0) return;
-
-    LCD_SetWindow(x, y, x + w - 1, y + h - 1);
-    LCD_WriteColorFast(color, (uint32_t)w * h);
-}
-
-// 수평선
-static void LCD_HLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
-    if(y < 0 || y >= LCD_HEIGHT || w <= 0) return;
-    if(x < 0) { w += x; x = 0; }
-    if(x + w > LCD_WIDTH) w = LCD_WIDTH - x;
-    if(w <= 0) return;
-
-    LCD_SetWindow(x, y, x + w - 1, y);
-    LCD_WriteColorFast(color, w);
-}
-
-// 채워진 원
-static void LCD_FillCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color) {
-    int16_t x = r, y = 0;
-    int16_t err = 1 - r;
-
-    while(x >= y) {
-        LCD_HLine(x0 - x, y0 + y, x * 2 + 1, color);
-        LCD_HLine(x0 - x, y0 - y, x * 2 + 1, color);
-        LCD_HLine(x0 - y, y0 + x, y * 2 + 1, color);
-        LCD_HLine(x0 - y, y0 - x, y * 2 + 1, color);
-
-        y++;
-        if(err < 0) err += 2 * y + 1;
-        else { x--; err += 2 * (y - x + 1); }
-    }
-}
-
-// 둥근 사각형
-static void LCD_RoundRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, uint16_t color) {
-    if(w > 2*r) LCD_FillRect(x + r, y, w - 2*r, h, color);
-    if(h > 2*r) {
-        LCD_FillRect(x, y + r, r, h - 2*r, color);
-        LCD_FillRect(x + w - r, y + r, r, h - 2*r, color);
-    }
-    LCD_FillCircle(x + r, y + r, r, color);
-    LCD_FillCircle(x + w - r - 1, y + r, r, color);
-    LCD_FillCircle(x + r, y + h - r - 1, r, color);
-    LCD_FillCircle(x + w - r - 1, y + h - r - 1, r, color);
-}
-
-// 두꺼운 선
-static void LCD_ThickLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t t, uint16_t color) {
-    int16_t dx = (x1 > x0) ? (x1 - x0) : (x0 - x1);
-    int16_t dy = (y1 > y0) ? (y1 - y0) : (y0 - y1);
-
-    if(dy <= 2) {
-        int16_t minX = (x0 < x1) ? x0 : x1;
-        int16_t maxX = (x0 > x1) ? x0 : x1;
-        LCD_FillRect(minX, (y0 + y1)/2 - t/2, maxX - minX + 1, t, color);
-        return;
-    }
-    if(dx <= 2) {
-        int16_t minY = (y0 < y1) ? y0 : y1;
-        int16_t maxY = (y0 > y1) ? y0 : y1;
-        LCD_FillRect((x0 + x1)/2 - t/2, minY, t, maxY - minY + 1, color);
-        return;
-    }
-
-    int16_t sx = (x0 < x1) ? 1 : -1;
-    int16_t sy = (y0 < y1) ? 1 : -1;
-    int16_t err = dx - dy;
-
-    while(1) {
-        LCD_FillRect(x0 - t/2, y0 - t/2, t, t, color);
-        if(x0 == x1 && y0 == y1) break;
-        int16_t e2 = 2 * err;
-        if(e2 > -dy) { err -= dy; x0 += sx; }
-        if(e2 < dx) { err += dx; y0 += sy; }
-    }
-}
-
-// ============================================================================
-// LCD 초기화
-// ============================================================================
-
-static void LCD_Init(void) {
-    LCD_RES_LOW(); HAL_Delay(50);
-    LCD_RES_HIGH(); HAL_Delay(50);
-
-    LCD_Cmd(ST7735_SWRESET); HAL_Delay(150);
-    LCD_Cmd(ST7735_SLPOUT); HAL_Delay(150);
-
-    LCD_Cmd(ST7735_FRMCTR1);
-    LCD_Data(0x01); LCD_Data(0x2C); LCD_Data(0x2D);
-    LCD_Cmd(ST7735_FRMCTR2);
-    LCD_Data(0x01); LCD_Data(0x2C); LCD_Data(0x2D);
-    LCD_Cmd(ST7735_FRMCTR3);
-    LCD_Data(0x01); LCD_Data(0x2C); LCD_Data(0x2D);
-    LCD_Data(0x01); LCD_Data(0x2C); LCD_Data(0x2D);
-
-    LCD_Cmd(ST7735_INVCTR); LCD_Data(0x07);
-    LCD_Cmd(ST7735_PWCTR1); LCD_Data(0xA2); LCD_Data(0x02); LCD_Data(0x84);
-    LCD_Cmd(ST7735_PWCTR2); LCD_Data(0xC5);
-    LCD_Cmd(ST7735_PWCTR3); LCD_Data(0x0A); LCD_Data(0x00);
-    LCD_Cmd(ST7735_PWCTR4); LCD_Data(0x8A); LCD_Data(0x2A);
-    LCD_Cmd(ST7735_PWCTR5); LCD_Data(0x8A); LCD_Data(0xEE);
-    LCD_Cmd(ST7735_VMCTR1); LCD_Data(0x0E);
-
-    LCD_Cmd(ST7735_INVOFF);
-
-    // ★ MADCTL: 핀 위쪽, 가로 모드 ★
-    // 안 맞으면 0xC8, 0x60, 0x68, 0xA0, 0xA8 등 시도
-    LCD_Cmd(ST7735_MADCTL); LCD_Data(0x60); //C0);
-
-    LCD_Cmd(ST7735_COLMOD); LCD_Data(0x05);  // 16-bit color
-
-    LCD_Cmd(ST7735_GMCTRP1);
-    uint8_t gp[] = {0x02,0x1c,0x07,0x12,0x37,0x32,0x29,0x2d,0x29,0x25,0x2B,0x39,0x00,0x01,0x03,0x10};
-    for(int i=0;i<16;i++) LCD_Data(gp[i]);
-    LCD_Cmd(ST7735_GMCTRN1);
-    uint8_t gn[] = {0x03,0x1d,0x07,0x06,0x2E,0x2C,0x29,0x2D,0x2E,0x2E,0x37,0x3F,0x00,0x00,0x02,0x10};
-    for(int i=0;i<16;i++) LCD_Data(gn[i]);
-
-    LCD_Cmd(ST7735_NORON); HAL_Delay(10);
-    LCD_Cmd(ST7735_DISPON); HAL_Delay(100);
-}
-
-// 전체 화면 클리어
-static void LCD_Clear(uint16_t color) {
-    LCD_FillRect(0, 0, LCD_WIDTH, LCD_HEIGHT, color);
-}
-
 // ============================================================================
 // 눈 그리기 함수
 // ============================================================================
 
 static void Eye_Normal(int16_t cx, int16_t ox, int16_t oy) {
-    LCD_RoundRect(cx - EYE_W/2, CY - EYE_H/2, EYE_W, EYE_H, EYE_R, EYE_COLOR);
-    LCD_FillCircle(cx - 5 + ox, CY - 8 + oy, 4, EYE_BRIGHT);
+    Disp_RoundRect(cx - EYE_W/2, CY - EYE_H/2, EYE_W, EYE_H, EYE_R, EYE_COLOR);
+    Disp_FillCircle(cx - 5 + ox, CY - 8 + oy, 4, EYE_BRIGHT);
 }
 
 static void Eye_Closed(int16_t cx) {
-    LCD_FillRect(cx - EYE_W/2 + 3, CY - 3, EYE_W - 6, 6, EYE_COLOR);
+    Disp_FillRect(cx - EYE_W/2 + 3, CY - 3, EYE_W - 6, 6, EYE_COLOR);
 }
 
 static void Eye_Half(int16_t cx, uint8_t pct) {
     int16_t h = (EYE_H * pct) / 100;
     if(h < 10) { Eye_Closed(cx); return; }
     int16_t top = CY + EYE_H/2 - h;
-    LCD_RoundRect(cx - EYE_W/2, top, EYE_W, h, EYE_R/2, EYE_COLOR);
+    Disp_RoundRect(cx - EYE_W/2, top, EYE_W, h, EYE_R/2, EYE_COLOR);
 }
 
 static void Eye_Happy(int16_t cx) {
     for(int16_t i = -EYE_W/2 + 2; i <= EYE_W/2 - 2; i++) {
         int32_t n = (int32_t)i * i * 100 / ((EYE_W/2) * (EYE_W/2));
         int16_t y = CY + 5 - (12 * (100 - n) / 100);
-        LCD_FillRect(cx + i, y - 3, 2, 5, EYE_COLOR);
+        Disp_FillRect(cx + i, y - 3, 2, 5, EYE_COLOR);
     }
 }
 
 static void Eye_Sad(int16_t cx) {
-    LCD_RoundRect(cx - EYE_W/2, CY - EYE_H/2 + 6, EYE_W, EYE_H - 6, EYE_R, EYE_COLOR);
-    LCD_ThickLine(cx - EYE_W/2 - 2, CY - EYE_H/2 - 2,
+    Disp_RoundRect(cx - EYE_W/2, CY - EYE_H/2 + 6, EYE_W, EYE_H - 6, EYE_R, EYE_COLOR);
+    Disp_ThickLine(cx - EYE_W/2 - 2, CY - EYE_H/2 - 2,
                   cx + EYE_W/2 + 2, CY - EYE_H/2 + 8, 4, EYE_COLOR);
 }
 
 static void Eye_Angry(int16_t cx, uint8_t is_left) {
-    LCD_RoundRect(cx - EYE_W/2, CY - EYE_H/2 + 8, EYE_W, EYE_H - 12, EYE_R - 2, EYE_COLOR);
+    Disp_RoundRect(cx - EYE_W/2, CY - EYE_H/2 + 8, EYE_W, EYE_H - 12, EYE_R - 2, EYE_COLOR);
     if(is_left) {
-        LCD_ThickLine(cx - EYE_W/2 - 3, CY - EYE_H/2 + 6,
+        Disp_ThickLine(cx - EYE_W/2 - 3, CY - EYE_H/2 + 6,
                       cx + EYE_W/2 + 3, CY - EYE_H/2 - 6, 5, EYE_COLOR);
     } else {
-        LCD_ThickLine(cx - EYE_W/2 - 3, CY - EYE_H/2 - 6,
+        Disp_ThickLine(cx - EYE_W/2 - 3, CY - EYE_H/2 - 6,
                       cx + EYE_W/2 + 3, CY - EYE_H/2 + 6, 5, EYE_COLOR);
     }
 }
 
 static void Eye_Surprised(int16_t cx) {
-    LCD_FillCircle(cx, CY, EYE_H/2 - 2, EYE_COLOR);
-    LCD_FillCircle(cx, CY, EYE_H/2 - 10, EYE_DIM);
-    LCD_FillCircle(cx - 5, CY - 6, 5, EYE_BRIGHT);
-    LCD_FillCircle(cx + 3, CY + 3, 3, EYE_BRIGHT);
+    Disp_FillCircle(cx, CY, EYE_H/2 - 2, EYE_COLOR);
+    Disp_FillCircle(cx, CY, EYE_H/2 - 10, EYE_DIM);
+    Disp_FillCircle(cx - 5, CY - 6, 5, EYE_BRIGHT);
+    Disp_FillCircle(cx + 3, CY + 3, 3, EYE_BRIGHT);
 }
 
 static void Eye_Heart(int16_t cx) {
     int16_t s = 14;
-    LCD_FillCircle(cx - s/2, CY - s/3, s/2, EYE_COLOR);
-    LCD_FillCircle(cx + s/2, CY - s/3, s/2, EYE_COLOR);
+    Disp_FillCircle(cx - s/2, CY - s/3, s/2, EYE_COLOR);
+    Disp_FillCircle(cx + s/2, CY - s/3, s/2, EYE_COLOR);
     for(int16_t r = 0; r < s; r++) {
-        LCD_FillRect(cx - (s - r), CY - s/3 + r, (s - r) * 2 + 1, 1, EYE_COLOR);
+        Disp_FillRect(cx - (s - r), CY - s/3 + r, (s - r) * 2 + 1, 1, EYE_COLOR);
     }
 }
 
 static void Eye_X(int16_t cx) {
     int16_t s = EYE_H/2 - 6;
-    LCD_ThickLine(cx - s, CY - s, cx + s, CY + s, 5, EYE_COLOR);
-    LCD_ThickLine(cx + s, CY - s, cx - s, CY + s, 5, EYE_COLOR);
+    Disp_ThickLine(cx - s, CY - s, cx + s, CY + s, 5, EYE_COLOR);
+    Disp_ThickLine(cx + s, CY - s, cx - s, CY + s, 5, EYE_COLOR);
 }
 
 // ============================================================================
@@ -354,7 +140,7 @@ static void Eye_X(int16_t cx) {
 // ============================================================================
 
 static void Draw_Expression(Expression_t expr, int16_t ox, int16_t oy) {
-    LCD_Clear(BLACK);
+    Disp_Fill(BLACK);
 
     switch(expr) {
         case EXPR_NORMAL:
@@ -430,16 +216,16 @@ static void Anim_SetExpr(Expression_t expr) {
 // ============================================================================
 
 static void Anim_Blink(void) {
-    LCD_Clear(BLACK);
+    Disp_Fill(BLACK);
     Eye_Half(LX, 50);
     Eye_Half(RX, 50);
 
-    LCD_Clear(BLACK);
+    Disp_Fill(BLACK);
     Eye_Closed(LX);
     Eye_Closed(RX);
     HAL_Delay(50);
 
-    LCD_Clear(BLACK);
+    Disp_Fill(BLACK);
     Eye_Half(LX, 50);
     Eye_Half(RX, 50);
 
@@ -447,7 +233,7 @@ static void Anim_Blink(void) {
 }
 
 static void Anim_WinkL(void) {
-    LCD_Clear(BLACK);
+    Disp_Fill(BLACK);
     Eye_Closed(LX);
     Eye_Normal(RX, 0, 0);
     HAL_Delay(200);
@@ -455,7 +241,7 @@ static void Anim_WinkL(void) {
 }
 
 static void Anim_WinkR(void) {
-    LCD_Clear(BLACK);
+    Disp_Fill(BLACK);
     Eye_Normal(LX, 0, 0);
     Eye_Closed(RX);
     HAL_Delay(200);
@@ -514,6 +300,7 @@ static void Anim_Demo(void) {
 
 void SystemClock_Config(void);
 static void MX_GPIO_Init(void);
+static void MX_DMA_Init(void);
 static void MX_SPI1_Init(void);
 
 int main(void)
@@ -521,10 +308,11 @@ int main(void)
     HAL_Init();
     SystemClock_Config();
     MX_GPIO_Init();
+    MX_DMA_Init();
     MX_SPI1_Init();
 
-    LCD_Init();
-    LCD_Clear(BLACK);
+    Disp_Init(DispST7735_Init(&hspi1));   // 리셋 + 초기화 시퀀스 (disp_st7735.c)
+    Disp_Fill(BLACK);
 
     srand(HAL_GetTick());
 
@@ -568,6 +356,13 @@ void SystemClock_Config(void) {
     }
 }
 
+// 픽셀/단색 채우기는 disp_spi.c 가 SPI1_TX DMA 로 전송
+static void MX_DMA_Init(void) {
+    __HAL_RCC_DMA1_CLK_ENABLE();
+    HAL_NVIC_SetPriority(DMA1_Channel3_IRQn, 0, 0);
+    HAL_NVIC_EnableIRQ(DMA1_Channel3_IRQn);
+}
+
 static void MX_SPI1_Init(void) {
     hspi1.Instance = SPI1;
     hspi1.Init.Mode = SPI_MODE_MASTER;
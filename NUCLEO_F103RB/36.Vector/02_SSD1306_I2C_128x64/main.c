@@ -10,6 +10,10 @@
  *   - I2C1: Fast Mode 400kHz
  *   - System Clock: 64MHz
  * 
+ * 그리기: 05_Display_HAL 공통 코어 (Disp_*)
+ *   - 프로젝트에 disp.c, disp_ssd1306.c, disp.h, disp_panels.h 추가
+ *   - 1KB 프레임버퍼와 I2C 전송은 disp_ssd1306.c 에 있음
+ * 
  * I2C 주소:
  *   - 기본: 0x3C (코드에서는 0x78 = 0x3C << 1)
  *   - 대안: 0x3D (코드에서는 0x7A = 0x3D << 1)
@@ -18,43 +22,19 @@
  */
 
 #include "main.h"
+#include "disp_panels.h"
 #include <string.h>
 #include <stdlib.h>
 
 I2C_HandleTypeDef hi2c1;
 
 // ============================================================================
-// SSD1306 설정
+// 화면 설정
 // ============================================================================
 
-#define SSD1306_I2C_ADDR        0x78    // 0x3C << 1 (안되면 0x7A 시도)
-#define SSD1306_WIDTH           128
-#define SSD1306_HEIGHT          64
-
-// SSD1306 Commands
-#define SSD1306_CMD             0x00
-#define SSD1306_DATA            0x40
-#define SSD1306_DISPLAY_OFF     0xAE
-#define SSD1306_DISPLAY_ON      0xAF
-#define SSD1306_SET_DISPLAY_CLOCK_DIV 0xD5
-#define SSD1306_SET_MULTIPLEX   0xA8
-#define SSD1306_SET_DISPLAY_OFFSET 0xD3
-#define SSD1306_SET_START_LINE  0x40
-#define SSD1306_CHARGE_PUMP     0x8D
-#define SSD1306_MEMORY_MODE     0x20
-#define SSD1306_SEG_REMAP       0xA0
-#define SSD1306_COM_SCAN_DEC    0xC8
-#define SSD1306_SET_COM_PINS    0xDA
-#define SSD1306_SET_CONTRAST    0x81
-#define SSD1306_SET_PRECHARGE   0xD9
-#define SSD1306_SET_VCOM_DETECT 0xDB
-#define SSD1306_DISPLAY_ALL_ON_RESUME 0xA4
-#define SSD1306_NORMAL_DISPLAY  0xA6
-#define SSD1306_COLUMN_ADDR     0x21
-#define SSD1306_PAGE_ADDR       0x22
-
-// 프레임버퍼 (128 x 64 / 8 = 1024 bytes)
-static uint8_t frame_buffer[SSD1306_WIDTH * SSD1306_HEIGHT / 8];
+// 코어는 RGB565 로 그림, disp_ssd1306.c 가 밝기 기준으로 켜고 끔
+#define BLACK           0x0000
+#define WHITE           0xFFFF
 
 // 눈 영역 (버퍼 내 좌표)
 #define LX              32
@@ -78,142 +58,10 @@ static Expression_t current_expr = EXPR_NORMAL;
 static uint32_t last_blink = 0;
 static uint32_t last_action = 0;
 
-// ============================================================================
-// SSD1306 I2C 함수
-// ============================================================================
-
-static void SSD1306_WriteCmd(uint8_t cmd) {
-    uint8_t data[2] = {SSD1306_CMD, cmd};
-    HAL_I2C_Master_Transmit(&hi2c1, SSD1306_I2C_ADDR, data, 2, HAL_MAX_DELAY);
-}
-
-static void SSD1306_Init(void) {
-    HAL_Delay(100);
-    
-    SSD1306_WriteCmd(SSD1306_DISPLAY_OFF);
-    SSD1306_WriteCmd(SSD1306_SET_DISPLAY_CLOCK_DIV);
-    SSD1306_WriteCmd(0x80);
-    SSD1306_WriteCmd(SSD1306_SET_MULTIPLEX);
-    SSD1306_WriteCmd(SSD1306_HEIGHT - 1);
-    SSD1306_WriteCmd(SSD1306_SET_DISPLAY_OFFSET);
-    SSD1306_WriteCmd(0x00);
-    SSD1306_WriteCmd(SSD1306_SET_START_LINE | 0x00);
-    SSD1306_WriteCmd(SSD1306_CHARGE_PUMP);
-    SSD1306_WriteCmd(0x14);
-    SSD1306_WriteCmd(SSD1306_MEMORY_MODE);
-    SSD1306_WriteCmd(0x00);
-    SSD1306_WriteCmd(SSD1306_SEG_REMAP | 0x01);
-    SSD1306_WriteCmd(SSD1306_COM_SCAN_DEC);
-    SSD1306_WriteCmd(SSD1306_SET_COM_PINS);
-    SSD1306_WriteCmd(0x12);
-    SSD1306_WriteCmd(SSD1306_SET_CONTRAST);
-    SSD1306_WriteCmd(0xCF);
-    SSD1306_WriteCmd(SSD1306_SET_PRECHARGE);
-    SSD1306_WriteCmd(0xF1);
-    SSD1306_WriteCmd(SSD1306_SET_VCOM_DETECT);
-    SSD1306_WriteCmd(0x40);
-    SSD1306_WriteCmd(SSD1306_DISPLAY_ALL_ON_RESUME);
-    SSD1306_WriteCmd(SSD1306_NORMAL_DISPLAY);
-    SSD1306_WriteCmd(SSD1306_DISPLAY_ON);
-}
-
-static void SSD1306_Update(void) {
-    SSD1306_WriteCmd(SSD1306_COLUMN_ADDR);
-    SSD1306_WriteCmd(0);
-    SSD1306_WriteCmd(SSD1306_WIDTH - 1);
-    
-    SSD1306_WriteCmd(SSD1306_PAGE_ADDR);
-    SSD1306_WriteCmd(0);
-    SSD1306_WriteCmd(7);
-    
-    uint8_t buffer[1025];
-    buffer[0] = SSD1306_DATA;
-    memcpy(&buffer[1], frame_buffer, sizeof(frame_buffer));
-    
-    HAL_I2C_Master_Transmit(&hi2c1, SSD1306_I2C_ADDR, buffer, sizeof(buffer), HAL_MAX_DELAY);
-}
-
-// ============================================================================
-// 프레임버퍼 그리기 함수
-// ============================================================================
-
-static void Buf_Clear(void) {
-    memset(frame_buffer, 0, sizeof(frame_buffer));
-}
-
-static inline void Buf_SetPixel(int16_t x, int16_t y, uint8_t color) {
-    if(x < 0 || x >= SSD1306_WIDTH || y < 0 || y >= SSD1306_HEIGHT) return;
-    
-    if(color) {
-        frame_buffer[x + (y / 8) * SSD1306_WIDTH] |= (1 << (y & 7));
-    } else {
-        frame_buffer[x + (y / 8) * SSD1306_WIDTH] &= ~(1 << (y & 7));
-    }
-}
-
-static void Buf_FillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint8_t color) {
-    for(int16_t j = y; j < y + h; j++) {
-        for(int16_t i = x; i < x + w; i++) {
-            Buf_SetPixel(i, j, color);
-        }
-    }
-}
-
-static void Buf_FillCircle(int16_t cx, int16_t cy, int16_t r, uint8_t color) {
-    int16_t x = r, y = 0;
-    int16_t err = 1 - r;
-    
-    while(x >= y) {
-        for(int16_t i = cx - x; i <= cx + x; i++) {
-            Buf_SetPixel(i, cy + y, color);
-            Buf_SetPixel(i, cy - y, color);
-        }
-        for(int16_t i = cx - y; i <= cx + y; i++) {
-            Buf_SetPixel(i, cy + x, color);
-            Buf_SetPixel(i, cy - x, color);
-        }
-        y++;
-        if(err < 0) err += 2 * y + 1;
-        else { x--; err += 2 * (y - x + 1); }
-    }
-}
-
-static void Buf_RoundRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, uint8_t color) {
-    Buf_FillRect(x + r, y, w - 2*r, h, color);
-    Buf_FillRect(x, y + r, r, h - 2*r, color);
-    Buf_FillRect(x + w - r, y + r, r, h - 2*r, color);
-    Buf_FillCircle(x + r, y + r, r, color);
-    Buf_FillCircle(x + w - r - 1, y + r, r, color);
-    Buf_FillCircle(x + r, y + h - r - 1, r, color);
-    Buf_FillCircle(x + w - r - 1, y + h - r - 1, r, color);
-}
-
-static void Buf_HLine(int16_t x, int16_t y, int16_t w, int16_t thick, uint8_t color) {
-    Buf_FillRect(x, y - thick/2, w, thick, color);
-}
-
-static void Buf_ThickLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t t, uint8_t color) {
-    int16_t dx = (x1 > x0) ? (x1 - x0) : (x0 - x1);
-    int16_t dy = (y1 > y0) ? (y1 - y0) : (y0 - y1);
-    
-    if(dy <= 2) {
-        int16_t minX = (x0 < x1) ? x0 : x1;
-        int16_t maxX = (x0 > x1) ? x0 : x1;
-        Buf_FillRect(minX, (y0 + y1)/2 - t/2, maxX - minX + 1, t, color);
-        return;
-    }
-    
-    int16_t sx = (x0 < x1) ? 1 : -1;
-    int16_t sy = (y0 < y1) ? 1 : -1;
-    int16_t err = dx - dy;
-    
-    while(1) {
-        Buf_FillRect(x0 - t/2, y0 - t/2, t, t, color);
-        if(x0 == x1 && y0 == y1) break;
-        int16_t e2 = 2 * err;
-        if(e2 > -dy) { err -= dy; x0 += sx; }
-        if(e2 < dx) { err += dx; y0 += sy; }
-    }
+// 프레임 시작 - dirty 목록 비우고 화면 지움 (Disp_EndFrame 이 dirty 페이지 전송)
+static void Frame_Begin(void) {
+    Disp_BeginFrame();
+    Disp_Fill(BLACK);
 }
 
 // ============================================================================
@@ -221,59 +69,59 @@ static void Buf_ThickLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_
 // ============================================================================
 
 static void Eye_Normal(int16_t cx, int16_t ox, int16_t oy) {
-    Buf_RoundRect(cx - EYE_W/2, CY - EYE_H/2, EYE_W, EYE_H, EYE_R, 1);
+    Disp_RoundRect(cx - EYE_W/2, CY - EYE_H/2, EYE_W, EYE_H, EYE_R, WHITE);
 }
 
 static void Eye_Closed(int16_t cx) {
-    Buf_HLine(cx - EYE_W/2 + 2, CY, EYE_W - 4, 3, 1);
+    Disp_FillRect(cx - EYE_W/2 + 2, CY - 1, EYE_W - 4, 3, WHITE);
 }
 
 static void Eye_Half(int16_t cx, uint8_t pct) {
     int16_t h = (EYE_H * pct) / 100;
     if(h < 6) { Eye_Closed(cx); return; }
     int16_t top = CY + EYE_H/2 - h;
-    Buf_RoundRect(cx - EYE_W/2, top, EYE_W, h, EYE_R/2, 1);
+    Disp_RoundRect(cx - EYE_W/2, top, EYE_W, h, EYE_R/2, WHITE);
 }
 
 static void Eye_Happy(int16_t cx) {
     for(int16_t i = -EYE_W/2 + 2; i <= EYE_W/2 - 2; i++) {
         int32_t n = (int32_t)i * i * 100 / ((EYE_W/2) * (EYE_W/2));
         int16_t y = CY + 2 - (6 * (100 - n) / 100);
-        Buf_FillRect(cx + i, y - 2, 1, 3, 1);
+        Disp_FillRect(cx + i, y - 2, 1, 3, WHITE);
     }
 }
 
 static void Eye_Sad(int16_t cx) {
-    Buf_RoundRect(cx - EYE_W/2, CY - EYE_H/2 + 4, EYE_W, EYE_H - 4, EYE_R, 1);
-    Buf_ThickLine(cx - EYE_W/2, CY - EYE_H/2 - 1, cx + EYE_W/2, CY - EYE_H/2 + 5, 2, 1);
+    Disp_RoundRect(cx - EYE_W/2, CY - EYE_H/2 + 4, EYE_W, EYE_H - 4, EYE_R, WHITE);
+    Disp_ThickLine(cx - EYE_W/2, CY - EYE_H/2 - 1, cx + EYE_W/2, CY - EYE_H/2 + 5, 2, WHITE);
 }
 
 static void Eye_Angry(int16_t cx, uint8_t is_left) {
-    Buf_RoundRect(cx - EYE_W/2, CY - EYE_H/2 + 5, EYE_W, EYE_H - 8, EYE_R - 2, 1);
+    Disp_RoundRect(cx - EYE_W/2, CY - EYE_H/2 + 5, EYE_W, EYE_H - 8, EYE_R - 2, WHITE);
     if(is_left)
-        Buf_ThickLine(cx - EYE_W/2 - 1, CY - EYE_H/2 + 3, cx + EYE_W/2 + 1, CY - EYE_H/2 - 3, 3, 1);
+        Disp_ThickLine(cx - EYE_W/2 - 1, CY - EYE_H/2 + 3, cx + EYE_W/2 + 1, CY - EYE_H/2 - 3, 3, WHITE);
     else
-        Buf_ThickLine(cx - EYE_W/2 - 1, CY - EYE_H/2 - 3, cx + EYE_W/2 + 1, CY - EYE_H/2 + 3, 3, 1);
+        Disp_ThickLine(cx - EYE_W/2 - 1, CY - EYE_H/2 - 3, cx + EYE_W/2 + 1, CY - EYE_H/2 + 3, 3, WHITE);
 }
 
 static void Eye_Surprised(int16_t cx) {
-    Buf_FillCircle(cx, CY, EYE_H/2 - 2, 1);
-    Buf_FillCircle(cx, CY, EYE_H/2 - 6, 0);
+    Disp_FillCircle(cx, CY, EYE_H/2 - 2, WHITE);
+    Disp_FillCircle(cx, CY, EYE_H/2 - 6, BLACK);
 }
 
 static void Eye_Heart(int16_t cx) {
     int16_t s = 8;
-    Buf_FillCircle(cx - s/2, CY - s/3, s/2, 1);
-    Buf_FillCircle(cx + s/2, CY - s/3, s/2, 1);
+    Disp_FillCircle(cx - s/2, CY - s/3, s/2, WHITE);
+    Disp_FillCircle(cx + s/2, CY - s/3, s/2, WHITE);
     for(int16_t r = 0; r < s; r++) {
-        Buf_FillRect(cx - (s - r), CY - s/3 + r, (s - r) * 2 + 1, 1, 1);
+        Disp_FillRect(cx - (s - r), CY - s/3 + r, (s - r) * 2 + 1, 1, WHITE);
     }
 }
 
 static void Eye_X(int16_t cx) {
     int16_t s = EYE_H/2 - 4;
-    Buf_ThickLine(cx - s, CY - s, cx + s, CY + s, 3, 1);
-    Buf_ThickLine(cx + s, CY - s, cx - s, CY + s, 3, 1);
+    Disp_ThickLine(cx - s, CY - s, cx + s, CY + s, 3, WHITE);
+    Disp_ThickLine(cx + s, CY - s, cx - s, CY + s, 3, WHITE);
 }
 
 // ============================================================================
@@ -281,7 +129,7 @@ static void Eye_X(int16_t cx) {
 // ============================================================================
 
 static void Draw_Expression(Expression_t expr, int16_t ox, int16_t oy) {
-    Buf_Clear();
+    Frame_Begin();
     
     switch(expr) {
         case EXPR_NORMAL:
@@ -346,7 +194,7 @@ static void Draw_Expression(Expression_t expr, int16_t ox, int16_t oy) {
             break;
     }
     
-    SSD1306_Update();
+    Disp_EndFrame();
 }
 
 static void Anim_SetExpr(Expression_t expr) {
@@ -359,39 +207,39 @@ static void Anim_SetExpr(Expression_t expr) {
 // ============================================================================
 
 static void Anim_Blink(void) {
-    Buf_Clear();
+    Frame_Begin();
     Eye_Half(LX, 50);
     Eye_Half(RX, 50);
-    SSD1306_Update();
+    Disp_EndFrame();
     
-    Buf_Clear();
+    Frame_Begin();
     Eye_Closed(LX);
     Eye_Closed(RX);
-    SSD1306_Update();
+    Disp_EndFrame();
     HAL_Delay(40);
     
-    Buf_Clear();
+    Frame_Begin();
     Eye_Half(LX, 50);
     Eye_Half(RX, 50);
-    SSD1306_Update();
+    Disp_EndFrame();
     
     Draw_Expression(current_expr, 0, 0);
 }
 
 static void Anim_WinkL(void) {
-    Buf_Clear();
+    Frame_Begin();
     Eye_Closed(LX);
     Eye_Normal(RX, 0, 0);
-    SSD1306_Update();
+    Disp_EndFrame();
     HAL_Delay(180);
     Draw_Expression(EXPR_NORMAL, 0, 0);
 }
 
 static void Anim_WinkR(void) {
-    Buf_Clear();
+    Frame_Begin();
     Eye_Normal(LX, 0, 0);
     Eye_Closed(RX);
-    SSD1306_Update();
+    Disp_EndFrame();
     HAL_Delay(180);
     Draw_Expression(EXPR_NORMAL, 0, 0);
 }
@@ -457,9 +305,7 @@ int main(void)
     MX_GPIO_Init();
     MX_I2C1_Init();
     
-    SSD1306_Init();
-    Buf_Clear();
-    SSD1306_Update();
+    Disp_Init(DispSSD1306_Init(&hi2c1));   // 초기화 시퀀스 + 화면 지움 (disp_ssd1306.c)
     
     srand(HAL_GetTick());
     
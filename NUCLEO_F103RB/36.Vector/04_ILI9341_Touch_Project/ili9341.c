@@ -1,4 +1,5 @@
 #include "ili9341.h"
+#include "ili9341_bus.h"
 #include <math.h>
 
 // Complete 5x7 font data (ASCII 32-126)
@@ -100,20 +101,25 @@ const uint8_t font5x7[][5] = {
     {0x10, 0x08, 0x08, 0x10, 0x08}  // ~ (126)
 };
 
-// Control pin macros
-#define CS_LOW()    HAL_GPIO_WritePin(LCD_CS_PORT, LCD_CS_PIN, GPIO_PIN_RESET)
-#define CS_HIGH()   HAL_GPIO_WritePin(LCD_CS_PORT, LCD_CS_PIN, GPIO_PIN_SET)
-#define RS_LOW()    HAL_GPIO_WritePin(LCD_RS_PORT, LCD_RS_PIN, GPIO_PIN_RESET)  // Command
-#define RS_HIGH()   HAL_GPIO_WritePin(LCD_RS_PORT, LCD_RS_PIN, GPIO_PIN_SET)   // Data
-#define WR_LOW()    HAL_GPIO_WritePin(LCD_WR_PORT, LCD_WR_PIN, GPIO_PIN_RESET)
-#define WR_HIGH()   HAL_GPIO_WritePin(LCD_WR_PORT, LCD_WR_PIN, GPIO_PIN_SET)
-#define RD_LOW()    HAL_GPIO_WritePin(LCD_RD_PORT, LCD_RD_PIN, GPIO_PIN_RESET)
-#define RD_HIGH()   HAL_GPIO_WritePin(LCD_RD_PORT, LCD_RD_PIN, GPIO_PIN_SET)
+// Control pin macros (single BSRR store, works on F1 and F4)
+#define CS_LOW()    (LCD_CS_PORT->BSRR = (uint32_t)LCD_CS_PIN << 16)
+#define CS_HIGH()   (LCD_CS_PORT->BSRR = LCD_CS_PIN)
+#define RS_LOW()    (LCD_RS_PORT->BSRR = (uint32_t)LCD_RS_PIN << 16)  // Command
+#define RS_HIGH()   (LCD_RS_PORT->BSRR = LCD_RS_PIN)                 // Data
+#define WR_LOW()    (LCD_WR_PORT->BSRR = (uint32_t)LCD_WR_PIN << 16)
+#define WR_HIGH()   (LCD_WR_PORT->BSRR = LCD_WR_PIN)
+#define RD_LOW()    (LCD_RD_PORT->BSRR = (uint32_t)LCD_RD_PIN << 16)
+#define RD_HIGH()   (LCD_RD_PORT->BSRR = LCD_RD_PIN)
 #define RST_LOW()   HAL_GPIO_WritePin(LCD_RST_PORT, LCD_RST_PIN, GPIO_PIN_RESET)
 #define RST_HIGH()  HAL_GPIO_WritePin(LCD_RST_PORT, LCD_RST_PIN, GPIO_PIN_SET)
 
-// Write 8-bit data to parallel bus
+// Write 8-bit data to parallel bus (table driven, see ili9341_bus.c)
 void ILI9341_WriteData8(uint8_t data) {
+    ILI9341_Bus_Write8(data);
+}
+
+// Original per-pin HAL writer, kept only as the baseline for ILI9341_MeasureFill()
+static void ILI9341_WriteData8_HAL(uint8_t data) {
     // Set data pins
     HAL_GPIO_WritePin(LCD_D0_PORT, LCD_D0_PIN, (data & 0x01) ? GPIO_PIN_SET : GPIO_PIN_RESET);
     HAL_GPIO_WritePin(LCD_D1_PORT, LCD_D1_PIN, (data & 0x02) ? GPIO_PIN_SET : GPIO_PIN_RESET);
@@ -125,10 +131,10 @@ void ILI9341_WriteData8(uint8_t data) {
     HAL_GPIO_WritePin(LCD_D7_PORT, LCD_D7_PIN, (data & 0x80) ? GPIO_PIN_SET : GPIO_PIN_RESET);
 
     // Write strobe
-    WR_LOW();
+    HAL_GPIO_WritePin(LCD_WR_PORT, LCD_WR_PIN, GPIO_PIN_RESET);
     __NOP(); // Small delay
     __NOP();
-    WR_HIGH();
+    HAL_GPIO_WritePin(LCD_WR_PORT, LCD_WR_PIN, GPIO_PIN_SET);
 }
 
 // Read 8-bit data from parallel bus
@@ -249,6 +255,7 @@ void ILI9341_Init(void) {
 
     // Configure data pins as output initially
     ILI9341_SetDataPinsOutput();
+    ILI9341_Bus_Init();
 
     // Hardware reset
     RST_HIGH();
@@ -423,14 +430,34 @@ void ILI9341_FillRect(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t c
     CS_LOW();
     RS_HIGH(); // Data mode
 
-    for (uint32_t i = 0; i < w * h; i++) {
-        ILI9341_WriteData8(color >> 8);   // High byte
-        ILI9341_WriteData8(color & 0xFF); // Low byte
-    }
+    ILI9341_Bus_Repeat16(color, (uint32_t)w * h);
 
     CS_HIGH();
 }
 
+// Full-screen fill time in CPU cycles (DWT), legacy = 1 uses the old HAL per-pin writer
+uint32_t ILI9341_MeasureFill(uint16_t color, uint8_t legacy) {
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    uint32_t t0 = DWT->CYCCNT;
+
+    if (legacy) {
+        ILI9341_SetAddress(0, 0, ILI9341_WIDTH - 1, ILI9341_HEIGHT - 1);
+        CS_LOW();
+        RS_HIGH();
+        for (uint32_t i = 0; i < (uint32_t)ILI9341_WIDTH * ILI9341_HEIGHT; i++) {
+            ILI9341_WriteData8_HAL(color >> 8);
+            ILI9341_WriteData8_HAL(color & 0xFF);
+        }
+        CS_HIGH();
+    } else {
+        ILI9341_Fill(color);
+    }
+
+    return DWT->CYCCNT - t0;
+}
+
 void ILI9341_DrawLine(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color) {
     int16_t dx = abs(x1 - x0);
     int16_t dy = abs(y1 - y0);
@@ -0,0 +1,745 @@
+/* ============================================================================
+ * disp.c - 패널 공통 그래픽 코어
+ * ============================================================================
+ *
+ * 1. 모든 도형을 행 span 으로 바꾸고, 같은 span 이 이어지는 행은 사각형 하나로 합침
+ *    → 사각형마다 set_window 1번 + write_repeat 1번 (픽셀/스캔라인 단위 창 설정 없음)
+ * 2. 여러 도형은 행 안에서 덮어쓰기 합성 → 겹친 영역은 한 번만 전송
+ * 3. 이미지/글자는 줄 버퍼 2개에 펼쳐서 번갈아 전송 (비동기 백엔드면 전송 중에 다음 줄 준비)
+ * 4. 모든 출력은 클립 사각형으로 자르고, 자른 사각형을 dirty 목록에 모음
+ *
+ * 래스터라이저는 teamprj 1team 의 lcd_gfx.c 와 같은 알고리즘 (패널 독립으로 옮김)
+ *
+ * ============================================================================
+ */
+
+#include <stddef.h>
+#include "disp.h"
+
+// ============================================================================
+// 상태
+// ============================================================================
+
+static const DispPanel_t *panel;
+static DispRect_t clip;
+static DispStats_t stats;
+
+static DispRect_t dirty[DISP_DIRTY_MAX + 1];
+static uint8_t dirty_n;
+
+static uint16_t line_buf[2][DISP_LINE_PX];
+static uint8_t line_idx;
+
+// 5x7 폰트 (ASCII 32~126, 열 우선: 바이트 = 열, 비트 = 행)
+static const uint8_t font5x7[][5] = {
+    {0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x4F,0x00,0x00}, {0x00,0x07,0x00,0x07,0x00}, {0x14,0x7F,0x14,0x7F,0x14},
+    {0x24,0x2A,0x7F,0x2A,0x12}, {0x23,0x13,0x08,0x64,0x62}, {0x36,0x49,0x55,0x22,0x50}, {0x00,0x05,0x03,0x00,0x00},
+    {0x00,0x1C,0x22,0x41,0x00}, {0x00,0x41,0x22,0x1C,0x00}, {0x14,0x08,0x3E,0x08,0x14}, {0x08,0x08,0x3E,0x08,0x08},
+    {0x00,0x50,0x30,0x00,0x00}, {0x08,0x08,0x08,0x08,0x08}, {0x00,0x60,0x60,0x00,0x00}, {0x20,0x10,0x08,0x04,0x02},
+    {0x3E,0x51,0x49,0x45,0x3E}, {0x00,0x42,0x7F,0x40,0x00}, {0x42,0x61,0x51,0x49,0x46}, {0x21,0x41,0x45,0x4B,0x31},
+    {0x18,0x14,0x12,0x7F,0x10}, {0x27,0x45,0x45,0x45,0x39}, {0x3C,0x4A,0x49,0x49,0x30}, {0x01,0x71,0x09,0x05,0x03},
+    {0x36,0x49,0x49,0x49,0x36}, {0x06,0x49,0x49,0x29,0x1E}, {0x00,0x36,0x36,0x00,0x00}, {0x00,0x56,0x36,0x00,0x00},
+    {0x08,0x14,0x22,0x41,0x00}, {0x14,0x14,0x14,0x14,0x14}, {0x00,0x41,0x22,0x14,0x08}, {0x02,0x01,0x51,0x09,0x06},
+    {0x32,0x49,0x79,0x41,0x3E}, {0x7E,0x11,0x11,0x11,0x7E}, {0x7F,0x49,0x49,0x49,0x36}, {0x3E,0x41,0x41,0x41,0x22},
+    {0x7F,0x41,0x41,0x22,0x1C}, {0x7F,0x49,0x49,0x49,0x41}, {0x7F,0x09,0x09,0x09,0x01}, {0x3E,0x41,0x49,0x49,0x7A},
+    {0x7F,0x08,0x08,0x08,0x7F}, {0x00,0x41,0x7F,0x41,0x00}, {0x20,0x40,0x41,0x3F,0x01}, {0x7F,0x08,0x14,0x22,0x41},
+    {0x7F,0x40,0x40,0x40,0x40}, {0x7F,0x02,0x0C,0x02,0x7F}, {0x7F,0x04,0x08,0x10,0x7F}, {0x3E,0x41,0x41,0x41,0x3E},
+    {0x7F,0x09,0x09,0x09,0x06}, {0x3E,0x41,0x51,0x21,0x5E}, {0x7F,0x09,0x19,0x29,0x46}, {0x46,0x49,0x49,0x49,0x31},
+    {0x01,0x01,0x7F,0x01,0x01}, {0x3F,0x40,0x40,0x40,0x3F}, {0x1F,0x20,0x40,0x20,0x1F}, {0x3F,0x40,0x38,0x40,0x3F},
+    {0x63,0x14,0x08,0x14,0x63}, {0x07,0x08,0x70,0x08,0x07}, {0x61,0x51,0x49,0x45,0x43}, {0x00,0x7F,0x41,0x41,0x00},
+    {0x02,0x04,0x08,0x10,0x20}, {0x00,0x41,0x41,0x7F,0x00}, {0x04,0x02,0x01,0x02,0x04}, {0x40,0x40,0x40,0x40,0x40},
+    {0x00,0x01,0x02,0x04,0x00}, {0x20,0x54,0x54,0x54,0x78}, {0x7F,0x48,0x44,0x44,0x38}, {0x38,0x44,0x44,0x44,0x20},
+    {0x38,0x44,0x44,0x48,0x7F}, {0x38,0x54,0x54,0x54,0x18}, {0x08,0x7E,0x09,0x01,0x02}, {0x0C,0x52,0x52,0x52,0x3E},
+    {0x7F,0x08,0x04,0x04,0x78}, {0x00,0x44,0x7D,0x40,0x00}, {0x20,0x40,0x44,0x3D,0x00}, {0x7F,0x10,0x28,0x44,0x00},
+    {0x00,0x41,0x7F,0x40,0x00}, {0x7C,0x04,0x18,0x04,0x78}, {0x7C,0x08,0x04,0x04,0x78}, {0x38,0x44,0x44,0x44,0x38},
+    {0x7C,0x14,0x14,0x14,0x08}, {0x08,0x14,0x14,0x18,0x7C}, {0x7C,0x08,0x04,0x04,0x08}, {0x48,0x54,0x54,0x54,0x20},
+    {0x04,0x3F,0x44,0x40,0x20}, {0x3C,0x40,0x40,0x20,0x7C}, {0x1C,0x20,0x40,0x20,0x1C}, {0x3C,0x40,0x30,0x40,0x3C},
+    {0x44,0x28,0x10,0x28,0x44}, {0x0C,0x50,0x50,0x50,0x3C}, {0x44,0x64,0x54,0x4C,0x44}, {0x00,0x08,0x36,0x41,0x00},
+    {0x00,0x00,0x7F,0x00,0x00}, {0x00,0x41,0x36,0x08,0x00}, {0x10,0x08,0x08,0x10,0x08},
+};
+
+// ============================================================================
+// dirty 추적
+// ============================================================================
+
+static int32_t Rect_Area(const DispRect_t *r) {
+    return (int32_t)(r->x1 - r->x0 + 1) * (r->y1 - r->y0 + 1);
+}
+
+static DispRect_t Rect_Union(const DispRect_t *a, const DispRect_t *b) {
+    DispRect_t u;
+    u.x0 = (a->x0 < b->x0) ? a->x0 : b->x0;
+    u.y0 = (a->y0 < b->y0) ? a->y0 : b->y0;
+    u.x1 = (a->x1 > b->x1) ? a->x1 : b->x1;
+    u.y1 = (a->y1 > b->y1) ? a->y1 : b->y1;
+    return u;
+}
+
+// 겹치거나 맞닿으면 1
+static uint8_t Rect_Touch(const DispRect_t *a, const DispRect_t *b) {
+    return a->x0 <= b->x1 + 1 && b->x0 <= a->x1 + 1 &&
+           a->y0 <= b->y1 + 1 && b->y0 <= a->y1 + 1;
+}
+
+static void Dirty_Remove(uint8_t i) {
+    dirty[i] = dirty[--dirty_n];
+}
+
+// 사각형 추가 - 맞닿은 것과 합치고, 넘치면 합쳐서 늘어나는 넓이가 가장 작은 쌍을 합침
+static void Dirty_Add(int16_t x0, int16_t y0, int16_t x1, int16_t y1) {
+    DispRect_t r = { x0, y0, x1, y1 };
+
+    for (uint8_t i = 0; i < dirty_n; ) {
+        if (Rect_Touch(&dirty[i], &r)) {
+            r = Rect_Union(&dirty[i], &r);
+            Dirty_Remove(i);
+            i = 0;                      // 커진 사각형이 다른 것과 새로 닿을 수 있음
+        } else {
+            i++;
+        }
+    }
+    dirty[dirty_n++] = r;
+
+    if (dirty_n > DISP_DIRTY_MAX) {
+        uint8_t bi = 0, bj = 1;
+        int32_t best = 0x7FFFFFFF;
+        for (uint8_t i = 0; i < dirty_n; i++) {
+            for (uint8_t j = i + 1; j < dirty_n; j++) {
+                DispRect_t u = Rect_Union(&dirty[i], &dirty[j]);
+                int32_t cost = Rect_Area(&u) - Rect_Area(&dirty[i]) - Rect_Area(&dirty[j]);
+                if (cost < best) { best = cost; bi = i; bj = j; }
+            }
+        }
+        dirty[bi] = Rect_Union(&dirty[bi], &dirty[bj]);
+        Dirty_Remove(bj);
+    }
+}
+
+// ============================================================================
+// 출력 기본 단위
+// ============================================================================
+
+// 클립 적용, 비면 0
+static uint8_t Clip(int16_t *x0, int16_t *y0, int16_t *x1, int16_t *y1) {
+    if (*x0 < clip.x0) *x0 = clip.x0;
+    if (*y0 < clip.y0) *y0 = clip.y0;
+    if (*x1 > clip.x1) *x1 = clip.x1;
+    if (*y1 > clip.y1) *y1 = clip.y1;
+    return *x0 <= *x1 && *y0 <= *y1;
+}
+
+static void Window(int16_t x0, int16_t y0, int16_t x1, int16_t y1) {
+    panel->set_window((uint16_t)x0, (uint16_t)y0, (uint16_t)x1, (uint16_t)y1);
+    stats.windows++;
+    Dirty_Add(x0, y0, x1, y1);
+}
+
+// 이미 잘린 사각형 하나를 단색으로
+static void Emit_Rect(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) {
+    uint32_t n = (uint32_t)(x1 - x0 + 1) * (y1 - y0 + 1);
+
+    Window(x0, y0, x1, y1);
+    panel->write_repeat(color, n);
+    stats.repeat_px += n;
+}
+
+// 다음에 채울 줄 버퍼 (비동기면 반대편은 전송 중일 수 있음)
+static uint16_t *Line_Next(void) {
+    line_idx ^= 1;
+    return line_buf[line_idx];
+}
+
+static void Line_Send(const uint16_t *px, uint32_t n) {
+    if (panel->write_pixels_async) {
+        panel->write_pixels_async(px, n);
+        stats.async_px += n;
+    } else {
+        panel->write_pixels(px, n);
+    }
+    stats.stream_px += n;
+}
+
+// ============================================================================
+// 초기화 / 클립
+// ============================================================================
+
+void Disp_Init(const DispPanel_t *p) {
+    panel = p;
+    Disp_ResetClip();
+    Disp_BeginFrame();
+}
+
+const DispPanel_t *Disp_Panel(void) {
+    return panel;
+}
+
+void Disp_SetClip(int16_t x, int16_t y, int16_t w, int16_t h) {
+    Disp_ResetClip();
+    int16_t x1 = x + w - 1, y1 = y + h - 1;
+    if (!Clip(&x, &y, &x1, &y1)) { x1 = x - 1; }   // 빈 클립 → 아무것도 안 그림
+    clip = (DispRect_t){ x, y, x1, y1 };
+}
+
+void Disp_ResetClip(void) {
+    int16_t w = panel->width;
+    if (w > DISP_LINE_PX) w = DISP_LINE_PX;
+    clip = (DispRect_t){ 0, 0, w - 1, panel->height - 1 };
+}
+
+// ============================================================================
+// 사각형 / 선 / 점
+// ============================================================================
+
+void Disp_Fill(uint16_t color) {
+    Disp_FillRect(clip.x0, clip.y0, clip.x1 - clip.x0 + 1, clip.y1 - clip.y0 + 1, color);
+}
+
+void Disp_FillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    if (w <= 0 || h <= 0) return;
+    int16_t x1 = x + w - 1, y1 = y + h - 1;
+    if (!Clip(&x, &y, &x1, &y1)) return;
+    Emit_Rect(x, y, x1, y1, color);
+}
+
+void Disp_HLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+    Disp_FillRect(x, y, w, 1, color);
+}
+
+void Disp_VLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+    Disp_FillRect(x, y, 1, h, color);
+}
+
+void Disp_Pixel(int16_t x, int16_t y, uint16_t color) {
+    Disp_FillRect(x, y, 1, 1, color);
+}
+
+// ============================================================================
+// span 합성 (행마다 run 목록, 이어지는 행은 사각형으로 연장)
+// ============================================================================
+
+#define DISP_MAX_RUNS (DISP_MAX_SHAPES * 2 + 1)
+
+typedef struct {
+    int16_t  x0, x1;    // 포함 구간
+    uint16_t color;
+    int16_t  top;       // 열린 사각형의 시작 행 (open 목록에서만 사용)
+} DispRun_t;
+
+static DispRun_t row_runs[DISP_MAX_RUNS];
+static DispRun_t open_runs[DISP_MAX_RUNS];
+static uint8_t  row_n, open_n;
+
+// 현재 행 run 목록 위에 [x0,x1] span 을 덮어씀 (정렬/비중첩 유지)
+static void Runs_Paint(int16_t x0, int16_t x1, uint16_t color) {
+    DispRun_t out[DISP_MAX_RUNS];
+    uint8_t n = 0;
+    uint8_t placed = 0;
+
+    for (uint8_t i = 0; i < row_n; i++) {
+        DispRun_t r = row_runs[i];
+
+        if (r.x1 < x0 || r.x0 > x1) {
+            if (!placed && r.x0 > x1 && n < DISP_MAX_RUNS) {
+                out[n++] = (DispRun_t){ x0, x1, color, 0 };
+                placed = 1;
+            }
+            if (n < DISP_MAX_RUNS) out[n++] = r;
+            continue;
+        }
+
+        // 겹침: 새 span 왼쪽/오른쪽 잔여분만 남김
+        if (r.x0 < x0 && n < DISP_MAX_RUNS)
+            out[n++] = (DispRun_t){ r.x0, x0 - 1, r.color, 0 };
+        if (!placed && n < DISP_MAX_RUNS) {
+            out[n++] = (DispRun_t){ x0, x1, color, 0 };
+            placed = 1;
+        }
+        if (r.x1 > x1 && n < DISP_MAX_RUNS)
+            out[n++] = (DispRun_t){ x1 + 1, r.x1, r.color, 0 };
+    }
+    if (!placed && n < DISP_MAX_RUNS)
+        out[n++] = (DispRun_t){ x0, x1, color, 0 };
+
+    // 맞닿은 같은 색 run 병합
+    row_n = 0;
+    for (uint8_t i = 0; i < n; i++) {
+        if (row_n > 0 &&
+            row_runs[row_n - 1].color == out[i].color &&
+            row_runs[row_n - 1].x1 + 1 == out[i].x0) {
+            row_runs[row_n - 1].x1 = out[i].x1;
+        } else {
+            row_runs[row_n++] = out[i];
+        }
+    }
+}
+
+// 높이 1 로 끝나는 사각형 중 가로로 맞닿은 것은 창 하나로 묶어 줄 버퍼에서 전송
+// (원 위/아래 끝처럼 행마다 span 이 바뀌는 곳은 색이 달라도 행당 창 1개)
+static struct {
+    int16_t  x0, x1, y;
+    uint16_t color;     // 첫 run 색 (run 1개면 단색 출력)
+    uint16_t *buf;      // 두 번째 run 부터 사용
+} span;
+static uint8_t span_n;
+
+static void Span_Flush(void) {
+    if (span_n == 1) {
+        Emit_Rect(span.x0, span.y, span.x1, span.y, span.color);
+    } else if (span_n > 1) {
+        Window(span.x0, span.y, span.x1, span.y);
+        Line_Send(span.buf, (uint32_t)(span.x1 - span.x0 + 1));
+    }
+    span_n = 0;
+}
+
+static void Span_Add(int16_t x0, int16_t x1, int16_t y, uint16_t color) {
+    if (span_n > 0 && x0 == span.x1 + 1 && x1 - span.x0 < DISP_LINE_PX) {
+        if (span_n == 1) {                      // 두 번째 run 이 붙을 때 첫 run 을 버퍼에 펼침
+            span.buf = Line_Next();
+            for (int16_t x = span.x0; x <= span.x1; x++) span.buf[x - span.x0] = span.color;
+        }
+        for (int16_t x = x0; x <= x1; x++) span.buf[x - span.x0] = color;
+        span.x1 = x1;
+        span_n++;
+        return;
+    }
+    Span_Flush();
+    span.x0 = x0; span.x1 = x1; span.y = y;
+    span.color = color;
+    span_n = 1;
+}
+
+// 이전 행까지 열린 사각형과 현재 행 run 을 비교 - 같은 건 연장, 나머지는 출력
+static void Runs_Advance(int16_t y) {
+    DispRun_t next[DISP_MAX_RUNS];
+    uint8_t n = 0;
+    uint8_t i = 0, j = 0;
+
+    while (i < open_n || j < row_n) {
+        if (i < open_n && j < row_n &&
+            open_runs[i].x0 == row_runs[j].x0 &&
+            open_runs[i].x1 == row_runs[j].x1 &&
+            open_runs[i].color == row_runs[j].color) {
+            next[n++] = open_runs[i];           // 아래로 연장
+            i++; j++;
+        } else if (j >= row_n || (i < open_n && open_runs[i].x0 <= row_runs[j].x0)) {
+            const DispRun_t *r = &open_runs[i];
+            if (r->top == y - 1) Span_Add(r->x0, r->x1, r->top, r->color);
+            else                 Emit_Rect(r->x0, r->top, r->x1, y - 1, r->color);
+            i++;
+        } else {
+            next[n] = row_runs[j];
+            next[n].top = y;                    // 새 사각형 시작
+            n++;
+            j++;
+        }
+    }
+    Span_Flush();
+
+    for (uint8_t k = 0; k < n; k++) open_runs[k] = next[k];
+    open_n = n;
+}
+
+// 도형이 차지하는 행 범위
+static void Shape_Rows(const DispShape_t *s, int16_t *top, int16_t *bottom) {
+    switch (s->type) {
+    case DISP_CIRCLE:
+        *top    = s->y0 - s->r;
+        *bottom = s->y0 + s->r;
+        break;
+
+    case DISP_LINE: {
+        int16_t r = s->r / 2;
+        *top    = ((s->y0 < s->y1) ? s->y0 : s->y1) - r;
+        *bottom = ((s->y0 > s->y1) ? s->y0 : s->y1) + r;
+        break;
+    }
+
+    default:
+        *top    = s->y0;
+        *bottom = s->y1;
+        break;
+    }
+}
+
+void Disp_DrawShapes(const DispShape_t *list, uint8_t n) {
+    if (n == 0) return;
+    if (n > DISP_MAX_SHAPES) n = DISP_MAX_SHAPES;
+
+    int16_t top = 32767, bottom = -32768;
+    for (uint8_t k = 0; k < n; k++) {
+        int16_t t, b;
+        Shape_Rows(&list[k], &t, &b);
+        if (t < top) top = t;
+        if (b > bottom) bottom = b;
+    }
+    if (top < clip.y0) top = clip.y0;
+    if (bottom > clip.y1) bottom = clip.y1;
+    if (top > bottom) return;
+
+    open_n = 0;
+    for (int16_t y = top; y <= bottom; y++) {
+        row_n = 0;
+        for (uint8_t k = 0; k < n; k++) {
+            int16_t xl, xr;
+            if (!Disp_ShapeRowSpan(&list[k], y, &xl, &xr)) continue;
+            if (xl < clip.x0) xl = clip.x0;
+            if (xr > clip.x1) xr = clip.x1;
+            if (xl > xr) continue;
+            Runs_Paint(xl, xr, list[k].color);
+        }
+        Runs_Advance(y);
+    }
+
+    // 마지막 행까지 열린 사각형 출력
+    row_n = 0;
+    Runs_Advance(bottom + 1);
+}
+
+void Disp_FillCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color) {
+    DispShape_t s = { DISP_CIRCLE, x0, y0, x0, y0, r, color };
+    Disp_DrawShapes(&s, 1);
+}
+
+void Disp_RoundRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, uint16_t color) {
+    if (w <= 0 || h <= 0) return;
+    DispShape_t s = { DISP_RRECT, x, y, x + w - 1, y + h - 1, r, color };
+    Disp_DrawShapes(&s, 1);
+}
+
+void Disp_ThickLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t t, uint16_t color) {
+    DispShape_t s = { DISP_LINE, x0, y0, x1, y1, t, color };
+    Disp_DrawShapes(&s, 1);
+}
+
+// ============================================================================
+// 도형 → 행 span 변환
+// ============================================================================
+
+// 정수 제곱근 (floor)
+static int16_t isqrt(int32_t v) {
+    if (v <= 0) return 0;
+
+    int32_t r = 0;
+    int32_t bit = 1L << 30;
+    while (bit > v) bit >>= 2;
+
+    while (bit != 0) {
+        if (v >= r + bit) {
+            v -= r + bit;
+            r = (r >> 1) + bit;
+        } else {
+            r >>= 1;
+        }
+        bit >>= 2;
+    }
+    return (int16_t)r;
+}
+
+// 반지름 r 원의 중심에서 dy 떨어진 행의 반폭 (r*r + r 보정으로 중점 원과 유사)
+static inline int16_t circle_half(int16_t r, int16_t dy) {
+    return isqrt((int32_t)r * r + r - (int32_t)dy * dy);
+}
+
+// 두꺼운 선의 y행 span - Bresenham 점마다 찍는 원(얇으면 사각형)의 합집합
+static uint8_t line_row_span(const DispShape_t *s, int16_t y, int16_t *xl, int16_t *xr) {
+    int16_t x0 = s->x0, y0 = s->y0;
+    int16_t dx = (s->x1 > x0) ? (s->x1 - x0) : (x0 - s->x1);
+    int16_t dy = (s->y1 > y0) ? (s->y1 - y0) : (y0 - s->y1);
+    int16_t sx = (x0 < s->x1) ? 1 : -1;
+    int16_t sy = (y0 < s->y1) ? 1 : -1;
+    int16_t err = dx - dy;
+    int16_t t = s->r;
+    int16_t r = t / 2;
+    int16_t lo = 32767, hi = -32768;
+
+    while (1) {
+        int16_t d = y - y0;
+        if (t <= 2) {
+            if (d >= -r && d < t - r) {
+                if (x0 - r < lo) lo = x0 - r;
+                if (x0 - r + t - 1 > hi) hi = x0 - r + t - 1;
+            }
+        } else if (d >= -r && d <= r) {
+            int16_t h = circle_half(r, d);
+            if (x0 - h < lo) lo = x0 - h;
+            if (x0 + h > hi) hi = x0 + h;
+        }
+
+        if (x0 == s->x1 && y0 == s->y1) break;
+
+        int16_t e2 = 2 * err;
+        if (e2 > -dy) { err -= dy; x0 += sx; }
+        if (e2 <  dx) { err += dx; y0 += sy; }
+    }
+
+    if (lo > hi) return 0;
+    *xl = lo;
+    *xr = hi;
+    return 1;
+}
+
+uint8_t Disp_ShapeRowSpan(const DispShape_t *s, int16_t y, int16_t *xl, int16_t *xr) {
+    switch (s->type) {
+    case DISP_RECT:
+        if (y < s->y0 || y > s->y1) return 0;
+        *xl = s->x0;
+        *xr = s->x1;
+        return 1;
+
+    case DISP_RRECT: {
+        if (y < s->y0 || y > s->y1) return 0;
+
+        int16_t w = s->x1 - s->x0 + 1;
+        int16_t h = s->y1 - s->y0 + 1;
+        int16_t r = s->r;
+        if (r > w / 2) r = w / 2;
+        if (r > h / 2) r = h / 2;
+        if (r < 1) r = 1;
+
+        int16_t d = 0;
+        if (y < s->y0 + r)       d = s->y0 + r - y;
+        else if (y > s->y1 - r)  d = y - (s->y1 - r);
+
+        int16_t inset = (d == 0) ? 0 : r - circle_half(r, d);
+        *xl = s->x0 + inset;
+        *xr = s->x1 - inset;
+        return 1;
+    }
+
+    case DISP_CIRCLE: {
+        int16_t d = y - s->y0;
+        if (d < -s->r || d > s->r) return 0;
+        int16_t h = circle_half(s->r, d);
+        *xl = s->x0 - h;
+        *xr = s->x0 + h;
+        return 1;
+    }
+
+    case DISP_LINE:
+        return line_row_span(s, y, xl, xr);
+
+    default:
+        return 0;
+    }
+}
+
+// ============================================================================
+// 극좌표 (각도: 12시 방향 0도, 시계 방향 +)
+// ============================================================================
+
+#define PA_QUARTER  4096            // 의사 각도 90도
+#define PA_FULL     (4 * PA_QUARTER)
+
+// sin(0~90도) x 16384 (반올림)
+static const int16_t sin_q14[91] = {
+        0,   286,   572,   857,  1143,  1428,  1713,  1997,  2280,  2563,
+     2845,  3126,  3406,  3686,  3964,  4240,  4516,  4790,  5063,  5334,
+     5604,  5872,  6138,  6402,  6664,  6924,  7182,  7438,  7692,  7943,
+     8192,  8438,  8682,  8923,  9162,  9397,  9630,  9860, 10087, 10311,
+    10531, 10749, 10963, 11174, 11381, 11585, 11786, 11982, 12176, 12365,
+    12551, 12733, 12911, 13085, 13255, 13421, 13583, 13741, 13894, 14044,
+    14189, 14330, 14466, 14598, 14726, 14849, 14968, 15082, 15191, 15296,
+    15396, 15491, 15582, 15668, 15749, 15826, 15897, 15964, 16026, 16083,
+    16135, 16182, 16225, 16262, 16294, 16322, 16344, 16362, 16374, 16382,
+    16384,
+};
+
+static int32_t sin_deg(int16_t deg) {
+    deg %= 360;
+    if (deg < 0) deg += 360;
+    if (deg <= 90)  return sin_q14[deg];
+    if (deg <= 180) return sin_q14[180 - deg];
+    if (deg <= 270) return -sin_q14[deg - 180];
+    return -sin_q14[360 - deg];
+}
+
+// r * (x16384 값) → 정수 (0 에서 먼 쪽으로 반올림, 좌우/상하 대칭 유지)
+static int16_t q14_mul(int16_t r, int32_t s) {
+    int32_t v = (int32_t)r * s;
+    return (int16_t)((v >= 0) ? (v + 8192) / 16384 : -((-v + 8192) / 16384));
+}
+
+void Disp_Polar(int16_t cx, int16_t cy, int16_t r, int16_t deg, int16_t *x, int16_t *y) {
+    *x = cx + q14_mul(r, sin_deg(deg));
+    *y = cy - q14_mul(r, sin_deg(deg + 90));
+}
+
+// 의사 각도 - atan 대신 마름모 각도 (각도 순서만 같으면 되므로 나눗셈 1번)
+// 12시 = 0, 3시 = 4096, 6시 = 8192, 9시 = 12288
+static int32_t PseudoAngle(int32_t dx, int32_t dy) {
+    int32_t ax = (dx < 0) ? -dx : dx, ay = (dy < 0) ? -dy : dy;
+    if (ax + ay == 0) return 0;
+    if (dx >= 0 && dy < 0)  return                   (ax * PA_QUARTER) / (ax + ay);
+    if (dx > 0 && dy >= 0)  return PA_QUARTER     + (ay * PA_QUARTER) / (ax + ay);
+    if (dx <= 0 && dy > 0)  return 2 * PA_QUARTER + (ax * PA_QUARTER) / (ax + ay);
+    return                         3 * PA_QUARTER + (ay * PA_QUARTER) / (ax + ay);
+}
+
+static int32_t PseudoAngleDeg(int16_t deg) {
+    return PseudoAngle(sin_deg(deg), -sin_deg(deg + 90));
+}
+
+// 한 행의 [xa, xb] (중심 기준) 안에서 각도 범위 안쪽 점들을 run 으로 칠함
+static void Arc_Row(int16_t cx, int16_t dy, int16_t xa, int16_t xb,
+                    int32_t pa0, int32_t span, uint8_t full, uint16_t color) {
+    if (xa < clip.x0 - cx) xa = clip.x0 - cx;
+    if (xb > clip.x1 - cx) xb = clip.x1 - cx;
+    int16_t run = xb + 1;                               // 진행 중인 구간 시작 (없으면 xb+1)
+
+    for (int16_t dx = xa; dx <= xb; dx++) {
+        uint8_t in = full || ((PseudoAngle(dx, dy) - pa0 + PA_FULL) % PA_FULL) < span;
+        if (in && run > xb) run = dx;
+        if (!in && run <= xb) {
+            Runs_Paint(cx + run, cx + dx - 1, color);
+            run = xb + 1;
+        }
+    }
+    if (run <= xb) Runs_Paint(cx + run, cx + xb, color);
+}
+
+// 고리 조각 - 행마다 구멍 좌/우 구간만 훑어 각도 안쪽 run 을 만들고, Disp_DrawShapes 처럼
+// 이어지는 행의 같은 run 은 사각형 하나로 합쳐 출력
+// 끝 각도를 빼므로 [a,b) + [b,c) = [a,c) → 계기판 값 변화분만 칠해도 전체를 다시 그린 것과 같음
+void Disp_FillArc(int16_t cx, int16_t cy, int16_t r_in, int16_t r_out,
+                  int16_t start_deg, int16_t sweep_deg, uint16_t color) {
+    if (r_out < 0 || sweep_deg <= 0) return;
+    if (r_in < 0) r_in = 0;
+
+    uint8_t full = sweep_deg >= 360;
+    int32_t pa0 = PseudoAngleDeg(start_deg);
+    int32_t span = (PseudoAngleDeg(start_deg + sweep_deg) - pa0 + PA_FULL) % PA_FULL;
+    int32_t ro2 = (int32_t)r_out * r_out + r_out;       // 바깥: dx²+dy² <= r²+r
+    int32_t ri2 = (int32_t)r_in * r_in - r_in;          // 구멍: dx²+dy² <= r²-r (r_in > 0)
+
+    int16_t top = cy - r_out, bottom = cy + r_out;
+    if (top < clip.y0) top = clip.y0;
+    if (bottom > clip.y1) bottom = clip.y1;
+    if (top > bottom) return;
+
+    open_n = 0;
+    for (int16_t y = top; y <= bottom; y++) {
+        int16_t dy = y - cy;
+        int32_t dy2 = (int32_t)dy * dy;
+        int16_t ho = isqrt(ro2 - dy2);
+
+        row_n = 0;
+        if (r_in > 0 && ri2 - dy2 >= 0) {
+            int16_t hi = isqrt(ri2 - dy2);
+            Arc_Row(cx, dy, -ho, -hi - 1, pa0, span, full, color);
+            Arc_Row(cx, dy, hi + 1, ho, pa0, span, full, color);
+        } else {
+            Arc_Row(cx, dy, -ho, ho, pa0, span, full, color);
+        }
+        Runs_Advance(y);
+    }
+
+    row_n = 0;
+    Runs_Advance(bottom + 1);
+}
+
+// ============================================================================
+// 이미지 / 글자 (줄 버퍼 스트림)
+// ============================================================================
+
+// 이미지 - 잘린 사각형 = 창 1개, 줄 버퍼에 들어가는 만큼 행을 묶어서 전송
+void Disp_Blit(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t *px) {
+    if (w <= 0 || h <= 0 || px == NULL) return;
+    int16_t x0 = x, y0 = y, x1 = x + w - 1, y1 = y + h - 1;
+    if (!Clip(&x0, &y0, &x1, &y1)) return;
+
+    int16_t cw = x1 - x0 + 1;
+    int16_t rows = DISP_LINE_PX / cw;
+
+    Window(x0, y0, x1, y1);
+    for (int16_t row = y0; row <= y1; ) {
+        uint16_t *dst = Line_Next();
+        int16_t k = 0;
+        for (; k < rows && row <= y1; k++, row++) {
+            const uint16_t *src = px + (int32_t)(row - y) * w + (x0 - x);
+            for (int16_t i = 0; i < cw; i++) *dst++ = src[i];
+        }
+        Line_Send(line_buf[line_idx], (uint32_t)k * cw);
+    }
+}
+
+// 문자열 - 글자 칸 6x8 (x scale), 잘린 사각형 = 창 1개, 행마다 줄 버퍼에 펼침
+uint16_t Disp_DrawText(int16_t x, int16_t y, const char *str,
+                       uint16_t fg, uint16_t bg, uint8_t scale) {
+    if (str == NULL) return 0;
+    if (scale < 1) scale = 1;
+
+    uint16_t n = 0;
+    while (str[n]) n++;
+    if (n == 0) return 0;
+
+    int16_t cw = 6 * scale;
+    int16_t w = (int16_t)(n * cw);
+    int16_t x0 = x, y0 = y, x1 = x + w - 1, y1 = y + 8 * scale - 1;
+    if (!Clip(&x0, &y0, &x1, &y1)) return (uint16_t)w;
+
+    int16_t vw = x1 - x0 + 1;
+    int16_t rows = DISP_LINE_PX / vw;
+    int16_t c0 = (x0 - x) / cw;                 // 보이는 첫 글자
+    int16_t c1 = (x1 - x) / cw;                 // 보이는 마지막 글자
+
+    Window(x0, y0, x1, y1);
+    for (int16_t row = y0; row <= y1; ) {
+        uint16_t *dst = Line_Next();
+        int16_t k = 0;
+        for (; k < rows && row <= y1; k++, row++) {
+            uint8_t gr = (uint8_t)((row - y) / scale);
+            int16_t gx = x + c0 * cw;           // 글자 칸 왼쪽 끝
+
+            for (int16_t c = c0; c <= c1; c++, gx += cw) {
+                char ch = str[c];
+                if (ch < 32 || ch > 126) ch = '?';
+                const uint8_t *g = font5x7[ch - 32];
+
+                for (uint8_t col = 0; col < 6; col++) {
+                    uint16_t color = (col < 5 && (g[col] & (1u << gr))) ? fg : bg;
+                    for (uint8_t s = 0; s < scale; s++) {
+                        int16_t px = gx + col * scale + s;
+                        if (px >= x0 && px <= x1) *dst++ = color;
+                    }
+                }
+            }
+        }
+        Line_Send(line_buf[line_idx], (uint32_t)k * vw);
+    }
+    return (uint16_t)w;
+}
+
+// ============================================================================
+// 프레임 / 통계
+// ============================================================================
+
+void Disp_BeginFrame(void) {
+    dirty_n = 0;
+}
+
+uint8_t Disp_EndFrame(void) {
+    if (panel->wait) panel->wait();
+
+    for (uint8_t i = 0; i < dirty_n; i++) {
+        stats.dirty_px += (uint32_t)Rect_Area(&dirty[i]);
+        if (panel->flush) {
+            panel->flush(&dirty[i]);
+            stats.flushes++;
+        }
+    }
+    return dirty_n;
+}
+
+uint8_t Disp_GetDirty(const DispRect_t **rects) {
+    if (rects) *rects = dirty;
+    return dirty_n;
+}
+
+void Disp_GetStats(DispStats_t *out) {
+    *out = stats;
+}
+
+void Disp_ResetStats(void) {
+    stats = (DispStats_t){0};
+}
@@ -0,0 +1,128 @@
+/* ============================================================================
+ * disp.h - 패널 공통 그래픽 코어 (클리핑, span 래스터라이저, 5x7 글자, dirty 추적)
+ * ============================================================================
+ *
+ * 구조:
+ *   앱 ──▶ Disp_* (이 파일, HAL 없음) ──▶ DispPanel_t (백엔드 함수 표)
+ *                                          ├ disp_st7735.c   SPI 16비트 프레임 + DMA
+ *                                          ├ disp_gc9a01.c   SPI 16비트 프레임 + DMA
+ *                                          ├ disp_ili9341.c  8080 병렬 (BSRR 표)
+ *                                          ├ disp_ssd1306.c  I2C, 1KB 프레임버퍼 + dirty 페이지 전송
+ *                                          └ disp_host.c     PC, RGB565 메모리 → PPM 파일
+ *
+ * 픽셀은 모두 RGB565 (CPU 엔디안 uint16_t). 바이트 순서는 백엔드 담당
+ * (SPI는 16비트 프레임이라 그대로 DMA, 8080은 상위 바이트 먼저).
+ *
+ * ============================================================================
+ */
+
+#ifndef DISP_H
+#define DISP_H
+
+#include <stdint.h>
+
+// ============================================================================
+// 설정
+// ============================================================================
+
+#define DISP_LINE_PX        240     // 줄 버퍼 픽셀 수 (가장 넓은 패널 폭 이상)
+#define DISP_MAX_SHAPES     16      // Disp_DrawShapes 한 번에 합성할 최대 도형 수
+#define DISP_DIRTY_MAX      8       // 프레임당 dirty 사각형 수 (넘치면 가장 싼 쌍을 합침)
+
+// ============================================================================
+// 백엔드 인터페이스
+// ============================================================================
+
+typedef struct {
+    int16_t x0, y0, x1, y1;         // 양 끝 포함
+} DispRect_t;
+
+/*
+ * 백엔드 규칙:
+ *   - set_window 다음의 write_* 는 창을 왼쪽→오른쪽, 위→아래로 채움
+ *   - write_pixels_async 는 이전 비동기 전송이 끝나길 기다린 뒤 출발하고 바로 반환
+ *     (코어는 줄 버퍼 2개를 번갈아 채우므로 "다음 출발 전 대기"만으로 안전)
+ *   - set_window / write_pixels / write_repeat 도 진행 중인 비동기 전송을 먼저 기다림
+ *   - 선택 항목은 NULL 가능
+ */
+typedef struct {
+    const char *name;
+    uint16_t width, height;
+
+    void (*set_window)(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1);
+    void (*write_pixels)(const uint16_t *px, uint32_t n);           // 블로킹
+    void (*write_repeat)(uint16_t color, uint32_t n);               // 같은 색 n 픽셀
+
+    void (*write_pixels_async)(const uint16_t *px, uint32_t n);     // 선택: DMA
+    void (*wait)(void);                                             // 선택: 비동기 완료 대기
+    void (*flush)(const DispRect_t *r);                             // 선택: 프레임버퍼 패널 (dirty 사각형 전송)
+} DispPanel_t;
+
+// ============================================================================
+// 도형 기술자 (행 단위 span 래스터라이저 입력)
+// ============================================================================
+
+typedef enum {
+    DISP_RECT = 0,      // (x0,y0)~(x1,y1) 포함 사각형
+    DISP_RRECT,         // (x0,y0)~(x1,y1) 둥근 사각형, r = 모서리 반지름
+    DISP_CIRCLE,        // 중심 (x0,y0), r = 반지름
+    DISP_LINE           // (x0,y0)→(x1,y1), r = 두께
+} DispShapeType_t;
+
+typedef struct {
+    uint8_t  type;
+    int16_t  x0, y0, x1, y1;
+    int16_t  r;
+    uint16_t color;
+} DispShape_t;
+
+// ============================================================================
+// 통계 (호스트 처리량 측정, 보드 디버깅용)
+// ============================================================================
+
+typedef struct {
+    uint32_t windows;       // set_window 호출 수
+    uint32_t repeat_px;     // write_repeat 픽셀 수
+    uint32_t stream_px;     // write_pixels(+async) 픽셀 수
+    uint32_t async_px;      //   그중 비동기
+    uint32_t flushes;       // flush 호출 수 (프레임버퍼 패널)
+    uint32_t dirty_px;      // EndFrame 때 dirty 사각형 넓이 합
+} DispStats_t;
+
+// ============================================================================
+// API
+// ============================================================================
+
+void Disp_Init(const DispPanel_t *panel);
+const DispPanel_t *Disp_Panel(void);
+
+void Disp_SetClip(int16_t x, int16_t y, int16_t w, int16_t h);     // 이후 모든 그리기를 이 사각형으로 자름
+void Disp_ResetClip(void);                                          // 화면 전체
+
+void Disp_Fill(uint16_t color);
+void Disp_FillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+void Disp_HLine(int16_t x, int16_t y, int16_t w, uint16_t color);
+void Disp_VLine(int16_t x, int16_t y, int16_t h, uint16_t color);
+void Disp_Pixel(int16_t x, int16_t y, uint16_t color);
+void Disp_FillCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color);
+void Disp_RoundRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, uint16_t color);
+void Disp_ThickLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t t, uint16_t color);
+void Disp_DrawShapes(const DispShape_t *list, uint8_t n);           // 겹침 합성 후 사각형 단위 출력 (나중 도형이 위)
+void Disp_FillArc(int16_t cx, int16_t cy, int16_t r_in, int16_t r_out,  // 고리 조각 [start, start+sweep) 도
+                  int16_t start_deg, int16_t sweep_deg, uint16_t color);    // (12시 0도, 시계 방향 +)
+void Disp_Polar(int16_t cx, int16_t cy, int16_t r, int16_t deg,     // 중심에서 r, deg 방향 점 (sin 표, math.h 없음)
+                int16_t *x, int16_t *y);
+void Disp_Blit(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t *px);
+uint16_t Disp_DrawText(int16_t x, int16_t y, const char *str,       // 문자열 = 창 1개, 그린 폭 반환
+                       uint16_t fg, uint16_t bg, uint8_t scale);
+
+void Disp_BeginFrame(void);                                         // dirty 목록 비움
+uint8_t Disp_EndFrame(void);                                        // flush (있으면), dirty 사각형 수 반환
+uint8_t Disp_GetDirty(const DispRect_t **rects);
+
+uint8_t Disp_ShapeRowSpan(const DispShape_t *s, int16_t y, int16_t *xl, int16_t *xr);   // 클리핑 없음
+
+void Disp_GetStats(DispStats_t *out);
+void Disp_ResetStats(void);
+
+#endif /* DISP_H */
@@ -0,0 +1,578 @@
+/* ============================================================================
+ * disp_check.c - 코어(disp.c) PC 검증 + 전송량 비교
+ * ============================================================================
+ *
+ * 빌드 / 실행 (이 폴더에서):
+ *   gcc -O2 -Wall -o disp_check disp.c disp_host.c disp_check.c -lm && ./disp_check
+ *
+ * 1. 임의 도형/클립/이미지/글자를 그려 화소 단위 기준 구현과 비교
+ *    (원: dx²+dy² <= r²+r, 둥근 사각형: 모서리 원, 두꺼운 선: Bresenham 점마다 원의 합집합,
+ *     고리 조각: 바깥 원 안 + 구멍 밖 + 의사 각도 [시작, 끝))
+ * 2. 바뀐 화소가 모두 dirty 사각형 안에 있는지 확인
+ * 3. 예제 장면의 창 수 / 버스 바이트를 "도형마다 스캔라인 창" 방식과 비교
+ * 4. 장면을 PPM 으로 저장 (scene_*.ppm)
+ *
+ * 마지막 줄이 "# OK" 면 통과
+ *
+ * ============================================================================
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "disp.h"
+#include "disp_host.h"
+
+static int failures;
+
+#define CHECK(cond, ...) do { \
+        if (!(cond)) { \
+            if (failures++ < 10) { printf("FAIL: "); printf(__VA_ARGS__); printf("\n"); } \
+        } \
+    } while (0)
+
+// ============================================================================
+// 난수 (xorshift32, 재현 가능)
+// ============================================================================
+
+static uint32_t rng = 0x12345678;
+
+static uint32_t Rand(void) {
+    rng ^= rng << 13;
+    rng ^= rng >> 17;
+    rng ^= rng << 5;
+    return rng;
+}
+
+static int16_t RandIn(int16_t lo, int16_t hi) {
+    return lo + (int16_t)(Rand() % (uint32_t)(hi - lo + 1));
+}
+
+// ============================================================================
+// 기준 구현 (화소 하나씩 판정)
+// ============================================================================
+
+static uint8_t In_Disc(int32_t dx, int32_t dy, int32_t r) {
+    return dx * dx + dy * dy <= r * r + r;
+}
+
+static uint8_t Ref_Inside(const DispShape_t *s, int16_t x, int16_t y) {
+    switch (s->type) {
+    case DISP_RECT:
+        return x >= s->x0 && x <= s->x1 && y >= s->y0 && y <= s->y1;
+
+    case DISP_CIRCLE:
+        return In_Disc(x - s->x0, y - s->y0, s->r);
+
+    case DISP_RRECT: {
+        if (x < s->x0 || x > s->x1 || y < s->y0 || y > s->y1) return 0;
+        int16_t w = s->x1 - s->x0 + 1, h = s->y1 - s->y0 + 1, r = s->r;
+        if (r > w / 2) r = w / 2;
+        if (r > h / 2) r = h / 2;
+        if (r < 1) r = 1;
+
+        int16_t cy, cx;
+        if (y < s->y0 + r)      cy = s->y0 + r;
+        else if (y > s->y1 - r) cy = s->y1 - r;
+        else return 1;
+        if (x < s->x0 + r)      cx = s->x0 + r;
+        else if (x > s->x1 - r) cx = s->x1 - r;
+        else return 1;
+        return In_Disc(x - cx, y - cy, r);
+    }
+
+    case DISP_LINE: {
+        int16_t x0 = s->x0, y0 = s->y0;
+        int16_t dx = abs(s->x1 - x0), dy = abs(s->y1 - y0);
+        int16_t sx = (x0 < s->x1) ? 1 : -1, sy = (y0 < s->y1) ? 1 : -1;
+        int16_t err = dx - dy, t = s->r, r = t / 2;
+
+        while (1) {
+            if (t <= 2) {
+                if (x >= x0 - r && x < x0 - r + t && y >= y0 - r && y < y0 - r + t) return 1;
+            } else if (In_Disc(x - x0, y - y0, r)) {
+                return 1;
+            }
+            if (x0 == s->x1 && y0 == s->y1) return 0;
+            int16_t e2 = 2 * err;
+            if (e2 > -dy) { err -= dy; x0 += sx; }
+            if (e2 <  dx) { err += dx; y0 += sy; }
+        }
+    }
+    }
+    return 0;
+}
+
+// ============================================================================
+// 공통 검사 도구
+// ============================================================================
+
+static const uint16_t sizes[][2] = { {160, 80}, {240, 240}, {240, 320}, {128, 64} };
+
+static uint16_t *ref;
+static uint16_t *before;
+static uint16_t W, H;
+static DispRect_t cl;
+
+static void Setup(uint8_t size, uint8_t async) {
+    W = sizes[size][0];
+    H = sizes[size][1];
+    Disp_Init(DispHost_Init(W, H, async));
+
+    free(ref);
+    free(before);
+    ref = calloc((size_t)W * H, 2);
+    before = calloc((size_t)W * H, 2);
+
+    // 임의 배경
+    for (uint32_t i = 0; i < (uint32_t)W * H; i++) ref[i] = (uint16_t)Rand();
+    memcpy(DispHost_Frame(), ref, (size_t)W * H * 2);
+}
+
+static void Random_Clip(void) {
+    if (Rand() % 3 == 0) {
+        Disp_ResetClip();
+        cl = (DispRect_t){ 0, 0, W - 1, H - 1 };
+        return;
+    }
+    int16_t x = RandIn(-20, W - 1), y = RandIn(-20, H - 1);
+    int16_t w = RandIn(1, W), h = RandIn(1, H);
+    Disp_SetClip(x, y, w, h);
+
+    cl.x0 = (x < 0) ? 0 : x;
+    cl.y0 = (y < 0) ? 0 : y;
+    cl.x1 = (x + w - 1 >= W) ? W - 1 : x + w - 1;
+    cl.y1 = (y + h - 1 >= H) ? H - 1 : y + h - 1;
+}
+
+static uint8_t In_Clip(int16_t x, int16_t y) {
+    return x >= cl.x0 && x <= cl.x1 && y >= cl.y0 && y <= cl.y1;
+}
+
+// 화면 = 기준, 바뀐 화소 ⊆ dirty, 호스트 패널 집계 일치
+static void Compare(const char *what, int trial) {
+    const uint16_t *fb = DispHost_Frame();
+    const DispRect_t *d;
+    uint8_t nd = Disp_GetDirty(&d);
+    uint32_t bad = 0, undirty = 0;
+    int16_t bx = -1, by = -1;
+
+    CHECK(nd <= DISP_DIRTY_MAX, "%s #%d: %u dirty rects", what, trial, nd);
+    for (uint8_t k = 0; k < nd; k++) {
+        CHECK(d[k].x0 >= cl.x0 && d[k].y0 >= cl.y0 && d[k].x1 <= cl.x1 && d[k].y1 <= cl.y1,
+              "%s #%d: dirty rect outside clip", what, trial);
+    }
+
+    for (int16_t y = 0; y < H; y++) {
+        for (int16_t x = 0; x < W; x++) {
+            uint32_t i = (uint32_t)y * W + x;
+            if (fb[i] != ref[i]) {
+                if (!bad) { bx = x; by = y; }
+                bad++;
+            }
+            if (fb[i] != before[i]) {
+                uint8_t in = 0;
+                for (uint8_t k = 0; k < nd && !in; k++)
+                    in = x >= d[k].x0 && x <= d[k].x1 && y >= d[k].y0 && y <= d[k].y1;
+                if (!in) undirty++;
+            }
+        }
+    }
+    CHECK(bad == 0, "%s #%d (%ux%u): %u pixels differ, first at %d,%d (got %04X want %04X)",
+          what, trial, W, H, bad, bx, by, fb[by * W + bx], ref[by * W + bx]);
+    CHECK(undirty == 0, "%s #%d: %u changed pixels outside dirty rects", what, trial, undirty);
+
+    DispHostStats_t hs;
+    DispStats_t cs;
+    DispHost_GetStats(&hs);
+    Disp_GetStats(&cs);
+    CHECK(hs.overflow == 0, "%s #%d: %u pixels past window end", what, trial, hs.overflow);
+    CHECK(hs.pixels == cs.repeat_px + cs.stream_px, "%s #%d: pixel count mismatch", what, trial);
+    CHECK(hs.windows == cs.windows, "%s #%d: window count mismatch", what, trial);
+}
+
+static void Begin(void) {
+    memcpy(before, DispHost_Frame(), (size_t)W * H * 2);
+    DispHost_ResetStats();
+    Disp_ResetStats();
+    Disp_BeginFrame();
+}
+
+// ============================================================================
+// 1. 도형
+// ============================================================================
+
+static DispShape_t Random_Shape(void) {
+    DispShape_t s;
+    s.type = Rand() % 4;
+    s.color = (uint16_t)Rand();
+    s.x0 = RandIn(-30, W + 30);
+    s.y0 = RandIn(-30, H + 30);
+
+    switch (s.type) {
+    case DISP_CIRCLE:
+        s.r = RandIn(0, 60);
+        s.x1 = s.x0; s.y1 = s.y0;
+        break;
+    case DISP_LINE:
+        s.x1 = RandIn(-30, W + 30);
+        s.y1 = RandIn(-30, H + 30);
+        s.r = RandIn(1, 12);
+        break;
+    default:
+        s.x1 = s.x0 + RandIn(0, 100);
+        s.y1 = s.y0 + RandIn(0, 80);
+        s.r = RandIn(0, 30);
+        break;
+    }
+    return s;
+}
+
+static void Test_Shapes(int trials) {
+    for (int t = 0; t < trials; t++) {
+        Setup(t % 4, t & 4);
+        Random_Clip();
+        Begin();
+
+        DispShape_t list[DISP_MAX_SHAPES];
+        uint8_t n = 1 + Rand() % 6;
+        for (uint8_t k = 0; k < n; k++) list[k] = Random_Shape();
+
+        Disp_DrawShapes(list, n);
+        for (int16_t y = cl.y0; y <= cl.y1; y++)
+            for (int16_t x = cl.x0; x <= cl.x1; x++)
+                for (uint8_t k = 0; k < n; k++)
+                    if (Ref_Inside(&list[k], x, y)) ref[y * W + x] = list[k].color;
+
+        Compare("shapes", t);
+    }
+}
+
+// ============================================================================
+// 2. 사각형 / 이미지
+// ============================================================================
+
+static void Test_Rects(int trials) {
+    for (int t = 0; t < trials; t++) {
+        Setup(t % 4, t & 1);
+        Random_Clip();
+        Begin();
+
+        for (uint8_t k = 0; k < 12; k++) {
+            int16_t x = RandIn(-40, W), y = RandIn(-40, H);
+            int16_t w = RandIn(-2, 80), h = RandIn(-2, 60);
+            uint16_t c = (uint16_t)Rand();
+            Disp_FillRect(x, y, w, h, c);
+            for (int16_t j = y; j < y + h; j++)
+                for (int16_t i = x; i < x + w; i++)
+                    if (In_Clip(i, j)) ref[j * W + i] = c;
+        }
+        Compare("rects", t);
+    }
+}
+
+static void Test_Blit(int trials) {
+    static uint16_t img[100 * 90];
+
+    for (int t = 0; t < trials; t++) {
+        Setup(t % 4, t & 1);
+        Random_Clip();
+        Begin();
+
+        int16_t w = RandIn(1, 100), h = RandIn(1, 90);
+        int16_t x = RandIn(-w, W), y = RandIn(-h, H);
+        for (int32_t i = 0; i < w * h; i++) img[i] = (uint16_t)Rand();
+
+        Disp_Blit(x, y, w, h, img);
+        for (int16_t j = 0; j < h; j++)
+            for (int16_t i = 0; i < w; i++)
+                if (In_Clip(x + i, y + j)) ref[(y + j) * W + x + i] = img[j * w + i];
+
+        Compare("blit", t);
+    }
+}
+
+// ============================================================================
+// 3. 글자 - 자른 결과 = 안 자른 결과의 해당 부분, 'A' 모양 확인
+// ============================================================================
+
+static void Test_Text(int trials) {
+    static const char *samples[] = { "Hello", "RPM 1234", "{|}~ !\"#", "Vector", "0123456789ABCDEF", "\x01\x7F" };
+
+    for (int t = 0; t < trials; t++) {
+        Setup(t % 4, t & 1);
+
+        const char *str = samples[t % 6];
+        uint8_t scale = 1 + Rand() % 4;
+        while (scale > 1 && strlen(str) * 6 * scale > DISP_LINE_PX) scale--;   // 기준 화면도 줄 버퍼 폭 이하
+        int16_t x = RandIn(-60, W - 10), y = RandIn(-20, H - 4);
+        uint16_t fg = (uint16_t)Rand(), bg = (uint16_t)Rand();
+
+        // 기준: 충분히 큰 가상 화면에 안 자르고 그린 결과
+        int16_t tw = (int16_t)(strlen(str) * 6 * scale), th = 8 * scale;
+        uint16_t *full = malloc((size_t)tw * th * 2);
+        {
+            Disp_Init(DispHost_Init(tw, th, 0));
+            Disp_DrawText(0, 0, str, fg, bg, scale);
+            memcpy(full, DispHost_Frame(), (size_t)tw * th * 2);
+        }
+
+        Setup(t % 4, t & 1);
+        Random_Clip();
+        Begin();
+        uint16_t ret = Disp_DrawText(x, y, str, fg, bg, scale);
+        CHECK(ret == tw, "text #%d: width %u, want %d", t, ret, tw);
+
+        for (int16_t j = 0; j < th; j++)
+            for (int16_t i = 0; i < tw; i++)
+                if (In_Clip(x + i, y + j)) ref[(y + j) * W + x + i] = full[j * tw + i];
+        free(full);
+
+        Compare("text", t);
+    }
+
+    // 'A' = {0x7E,0x11,0x11,0x11,0x7E}, 6번째 열은 배경
+    static const uint8_t A[5] = { 0x7E, 0x11, 0x11, 0x11, 0x7E };
+    Disp_Init(DispHost_Init(12, 16, 0));
+    Disp_DrawText(0, 0, "A", 0xFFFF, 0x0000, 2);
+    for (int16_t y = 0; y < 16; y++)
+        for (int16_t x = 0; x < 12; x++) {
+            uint8_t col = x / 2, row = y / 2;
+            uint16_t want = (col < 5 && (A[col] >> row & 1)) ? 0xFFFF : 0x0000;
+            CHECK(DispHost_Get(x, y) == want, "glyph A at %d,%d", x, y);
+        }
+}
+
+// ============================================================================
+// 4-1. 고리 조각 - 화소 단위 기준, 나눠 칠한 조각 = 한 번에 칠한 고리
+// ============================================================================
+
+// 기준: 바깥 원 안 + 구멍 밖 + 의사 각도가 [시작, 끝) 안 (경계 각도는 math.h 로 따로 계산)
+static int32_t Ref_Pseudo(int32_t dx, int32_t dy) {
+    int32_t ax = labs(dx), ay = labs(dy);
+    if (ax + ay == 0) return 0;
+    if (dx >= 0 && dy < 0)  return            (ax * 4096) / (ax + ay);
+    if (dx > 0 && dy >= 0)  return 4096     + (ay * 4096) / (ax + ay);
+    if (dx <= 0 && dy > 0)  return 2 * 4096 + (ax * 4096) / (ax + ay);
+    return                         3 * 4096 + (ay * 4096) / (ax + ay);
+}
+
+static int32_t Ref_PseudoDeg(int deg) {
+    double a = deg * M_PI / 180.0;
+    return Ref_Pseudo(lround(sin(a) * 16384.0), lround(-cos(a) * 16384.0));
+}
+
+static uint8_t Ref_InArc(int16_t dx, int16_t dy, int16_t r_in, int16_t r_out, int16_t start, int16_t sweep) {
+    if (sweep <= 0 || r_out < 0) return 0;
+    if (!In_Disc(dx, dy, r_out)) return 0;
+    if (r_in > 0 && (int32_t)dx * dx + (int32_t)dy * dy <= (int32_t)r_in * r_in - r_in) return 0;
+    if (sweep >= 360) return 1;
+    int32_t pa0 = Ref_PseudoDeg(start);
+    int32_t span = (Ref_PseudoDeg(start + sweep) - pa0 + 16384) % 16384;
+    return ((Ref_Pseudo(dx, dy) - pa0 + 16384) % 16384) < span;
+}
+
+static void Test_Arc(int trials) {
+    for (int t = 0; t < trials; t++) {
+        Setup(t % 4, t & 1);
+        Random_Clip();
+        Begin();
+
+        int16_t cx = RandIn(-20, W + 20), cy = RandIn(-20, H + 20);
+        int16_t r_out = RandIn(0, 120), r_in = RandIn(-2, r_out);
+        int16_t start = RandIn(-400, 400), sweep = RandIn(-10, 400);
+        uint16_t c = (uint16_t)Rand();
+
+        Disp_FillArc(cx, cy, r_in, r_out, start, sweep, c);
+        for (int16_t y = cl.y0; y <= cl.y1; y++)
+            for (int16_t x = cl.x0; x <= cl.x1; x++)
+                if (Ref_InArc(x - cx, y - cy, r_in, r_out, start, sweep)) ref[y * W + x] = c;
+
+        Compare("arc", t);
+    }
+
+    // 계기판 값 고리: start→start+sweep 를 1~7도씩 나눠 칠한 것 = 한 번에 칠한 것,
+    // 조각들이 보낸 화소 수 = 고리 화소 수 (겹친 화소 없음)
+    static uint16_t whole[240 * 240];
+    for (int t = 0; t < 20; t++) {
+        int16_t start = RandIn(0, 359), sweep = RandIn(1, 360);
+        DispHostStats_t hs;
+
+        Disp_Init(DispHost_Init(240, 240, 0));
+        Disp_FillArc(120, 120, 104, 114, start, sweep, 0x07FF);
+        memcpy(whole, DispHost_Frame(), sizeof(whole));
+        uint32_t area = 0;
+        for (uint32_t i = 0; i < 240 * 240; i++) area += whole[i] != 0;
+
+        Disp_Init(DispHost_Init(240, 240, 0));
+        DispHost_ResetStats();
+        for (int16_t a = 0; a < sweep; ) {
+            int16_t d = RandIn(1, 7);
+            if (a + d > sweep) d = sweep - a;
+            Disp_FillArc(120, 120, 104, 114, start + a, d, 0x07FF);
+            a += d;
+        }
+        DispHost_GetStats(&hs);
+        CHECK(memcmp(whole, DispHost_Frame(), sizeof(whole)) == 0, "arc pieces #%d: start %d sweep %d differ from one sweep",
+              t, start, sweep);
+        CHECK(hs.pixels == area, "arc pieces #%d: %u pixels sent for a %u pixel ring", t, hs.pixels, area);
+    }
+
+    // 극좌표 점 - 축 방향은 정확히, 45도는 r/√2 반올림
+    int16_t x, y;
+    Disp_Polar(120, 120, 100, 0, &x, &y);    CHECK(x == 120 && y == 20,  "polar 0: %d,%d", x, y);
+    Disp_Polar(120, 120, 100, 90, &x, &y);   CHECK(x == 220 && y == 120, "polar 90: %d,%d", x, y);
+    Disp_Polar(120, 120, 100, 180, &x, &y);  CHECK(x == 120 && y == 220, "polar 180: %d,%d", x, y);
+    Disp_Polar(120, 120, 100, -90, &x, &y);  CHECK(x == 20 && y == 120,  "polar -90: %d,%d", x, y);
+    Disp_Polar(120, 120, 100, 225, &x, &y);  CHECK(x == 49 && y == 191,  "polar 225: %d,%d", x, y);
+}
+
+// ============================================================================
+// 4. dirty 목록 - 흩어진 점이 많아도 DISP_DIRTY_MAX 개 이하로 합쳐지는지
+// ============================================================================
+
+static void Test_Dirty(int trials) {
+    for (int t = 0; t < trials; t++) {
+        Setup(t % 4, 0);
+        Random_Clip();
+        Begin();
+
+        for (uint8_t k = 0; k < 40; k++) {
+            int16_t x = RandIn(0, W - 1), y = RandIn(0, H - 1);
+            uint16_t c = (uint16_t)Rand();
+            Disp_Pixel(x, y, c);
+            if (In_Clip(x, y)) ref[y * W + x] = c;
+        }
+        Compare("dirty", t);
+    }
+}
+
+// ============================================================================
+// 5. 전송량 - 코어 vs 도형마다 스캔라인 창
+// ============================================================================
+
+#define WINDOW_BYTES 11     // CASET(1+4) + RASET(1+4) + RAMWR(1)
+
+typedef struct {
+    const char *name;
+    uint16_t w, h;
+    const DispShape_t *shapes;
+    uint8_t n;
+    const char *text;
+} Scene_t;
+
+// 01 의 눈 (둥근 사각형 2개 + 동공 원 2개, 눈동자 위에 겹침)
+static const DispShape_t eyes[] = {
+    { DISP_RRECT,  25, 15, 54, 64, 10, 0x07E0 },
+    { DISP_RRECT, 105, 15, 134, 64, 10, 0x07E0 },
+    { DISP_CIRCLE, 42, 38, 42, 38, 6, 0xAFE5 },
+    { DISP_CIRCLE, 122, 38, 122, 38, 6, 0xAFE5 },
+};
+
+// 원형 계기판 (배경 원, 눈금 링, 바늘, 허브)
+static const DispShape_t gauge[] = {
+    { DISP_CIRCLE, 120, 120, 120, 120, 119, 0x0000 },
+    { DISP_CIRCLE, 120, 120, 120, 120, 112, 0x4208 },
+    { DISP_CIRCLE, 120, 120, 120, 120, 104, 0x0000 },
+    { DISP_LINE,   120, 120, 50, 60, 5, 0xF800 },
+    { DISP_CIRCLE, 120, 120, 120, 120, 10, 0xFFFF },
+};
+
+// 128x64 OLED 눈
+static const DispShape_t oled[] = {
+    { DISP_RRECT, 20, 17, 43, 46, 8, 0xFFFF },
+    { DISP_RRECT, 84, 17, 107, 46, 8, 0xFFFF },
+    { DISP_LINE,  20, 12, 43, 16, 3, 0xFFFF },
+};
+
+static const Scene_t scenes[] = {
+    { "eyes",  160, 80,  eyes,  4, NULL },
+    { "gauge", 240, 240, gauge, 5, "RPM 3400" },
+    { "ili",   240, 320, gauge, 5, "240x320" },
+    { "oled",  128, 64,  oled,  3, NULL },
+};
+
+// 도형마다 행마다 창 1개 (01/02 의 LCD_HLine 방식)
+static void Naive_Cost(const Scene_t *s, uint32_t *windows, uint32_t *pixels) {
+    *windows = 0;
+    *pixels = 0;
+    for (uint8_t k = 0; k < s->n; k++) {
+        for (int16_t y = 0; y < s->h; y++) {
+            int16_t xl, xr;
+            if (!Disp_ShapeRowSpan(&s->shapes[k], y, &xl, &xr)) continue;
+            if (xl < 0) xl = 0;
+            if (xr >= s->w) xr = s->w - 1;
+            if (xl > xr) continue;
+            (*windows)++;
+            *pixels += xr - xl + 1;
+        }
+    }
+}
+
+static void Test_Throughput(void) {
+    printf("\n%-6s %9s | %8s %9s %9s | %8s %9s %9s | %6s\n",
+           "scene", "panel", "windows", "pixels", "bytes", "naive_w", "naive_px", "naive_B", "ratio");
+
+    for (uint8_t i = 0; i < sizeof(scenes) / sizeof(scenes[0]); i++) {
+        const Scene_t *s = &scenes[i];
+        Disp_Init(DispHost_Init(s->w, s->h, 1));
+        Disp_ResetStats();
+        Disp_BeginFrame();
+
+        Disp_Fill(0x0000);
+        Disp_DrawShapes(s->shapes, s->n);
+        if (s->text) Disp_DrawText(s->w / 2 - 24, s->h / 2 + 30, s->text, 0xFFFF, 0x0000, 1);
+        Disp_EndFrame();
+
+        DispStats_t st;
+        Disp_GetStats(&st);
+        uint32_t px = st.repeat_px + st.stream_px;
+        uint32_t bytes = st.windows * WINDOW_BYTES + px * 2;
+
+        uint32_t nw, np;
+        Naive_Cost(s, &nw, &np);
+        nw += 1;                            // 배경 채우기
+        np += (uint32_t)s->w * s->h;
+        if (s->text) {                      // 글자는 예전 방식도 글자당 창 1개
+            nw += strlen(s->text);
+            np += strlen(s->text) * 6 * 8;
+        }
+        uint32_t nbytes = nw * WINDOW_BYTES + np * 2;
+
+        printf("%-6s %4ux%-4u | %8u %9u %9u | %8u %9u %9u | %5.2fx\n",
+               s->name, s->w, s->h, st.windows, px, bytes, nw, np, nbytes, (double)nbytes / bytes);
+
+        char path[32];
+        snprintf(path, sizeof(path), "scene_%s.ppm", s->name);
+        DispHost_SavePPM(path);
+    }
+
+    // SSD1306: 눈 하나만 깜빡일 때 dirty 페이지 전송 vs 1KB 전체
+    Disp_Init(DispHost_Init(128, 64, 0));
+    Disp_BeginFrame();
+    Disp_FillRect(20, 17, 24, 30, 0x0000);
+    Disp_FillRect(20, 30, 24, 4, 0xFFFF);
+
+    const DispRect_t *d;
+    uint8_t nd = Disp_GetDirty(&d);
+    uint32_t bytes = 0;
+    for (uint8_t k = 0; k < nd; k++)
+        bytes += 6 * 3 + ((d[k].y1 >> 3) - (d[k].y0 >> 3) + 1) * (d[k].x1 - d[k].x0 + 2);
+    printf("\noled blink: %u dirty rect(s), %u I2C bytes (full frame 1025 + 18)\n", nd, bytes);
+}
+
+// ============================================================================
+
+int main(void) {
+    Test_Shapes(1500);
+    Test_Rects(300);
+    Test_Blit(300);
+    Test_Text(300);
+    Test_Arc(300);
+    Test_Dirty(200);
+    Test_Throughput();
+
+    printf("\n%s\n", failures ? "# FAIL" : "# OK");
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,49 @@
+/* ============================================================================
+ * disp_gc9a01.c - GC9A01 1.28" 240x240 원형 백엔드
+ * ============================================================================
+ *
+ * 초기화(긴 레지스터 시퀀스)는 30.1.28_TFT_Ver1.0_240_240_GC9A01/gc9a01_driver.c 의
+ * GC9A01_Init 을 그대로 쓰고, 픽셀 전송만 공통 SPI 전송(16비트 프레임 + DMA)으로 처리
+ * → gc9a01_driver.c/.h 를 프로젝트에 같이 추가
+ *
+ * 핀: gc9a01_driver.h (CS PA4, DC PA9, RST PA8)
+ *
+ * ============================================================================
+ */
+
+#include "disp_panels.h"
+#include "disp_spi.h"
+#include "gc9a01_driver.h"
+
+static DispSpi_t bus = {
+    .cs_port = LCD_CS_PORT, .cs_pin = LCD_CS_PIN,
+    .dc_port = LCD_DC_PORT, .dc_pin = LCD_DC_PIN,
+    .x_off = 0, .y_off = 0,
+};
+
+// ============================================================================
+// 함수 표
+// ============================================================================
+
+static void GC_Window(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1) { DispSpi_Window(&bus, x0, y0, x1, y1); }
+static void GC_Pixels(const uint16_t *px, uint32_t n)   { DispSpi_Pixels(&bus, px, n); }
+static void GC_Repeat(uint16_t color, uint32_t n)       { DispSpi_Repeat(&bus, color, n); }
+static void GC_Async(const uint16_t *px, uint32_t n)    { DispSpi_PixelsAsync(&bus, px, n); }
+static void GC_Wait(void)                               { DispSpi_Wait(&bus); }
+
+static const DispPanel_t panel = {
+    .name = "GC9A01",
+    .width = LCD_WIDTH, .height = LCD_HEIGHT,
+    .set_window = GC_Window,
+    .write_pixels = GC_Pixels,
+    .write_repeat = GC_Repeat,
+    .write_pixels_async = GC_Async,
+    .wait = GC_Wait,
+    .flush = NULL,
+};
+
+const DispPanel_t *DispGC9A01_Init(SPI_HandleTypeDef *hspi) {
+    bus.hspi = hspi;
+    GC9A01_Init(hspi);      // 8비트 블로킹 전송으로 초기화 (이후 프레임 크기는 disp_spi 가 관리)
+    return &panel;
+}
@@ -0,0 +1,137 @@
+/* ============================================================================
+ * disp_host.c - PC 용 가상 패널
+ * ============================================================================
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "disp_host.h"
+
+static DispPanel_t panel;
+static uint16_t *frame;
+static DispHostStats_t hstats;
+
+// 창 커서
+static struct {
+    int16_t x0, y0, x1, y1;
+    int16_t x, y;
+} cur;
+
+// 전송 중인 비동기 전송 - 다음 패널 호출 / wait 때 그 시점의 버퍼 내용을 씀 (DMA 처럼)
+static struct {
+    const uint16_t *px;
+    uint32_t n;
+} inflight;
+
+static void Put(uint16_t c) {
+    if (cur.y > cur.y1) {
+        hstats.overflow++;
+        return;
+    }
+    frame[cur.y * panel.width + cur.x] = c;
+    hstats.pixels++;
+    if (++cur.x > cur.x1) {
+        cur.x = cur.x0;
+        cur.y++;
+    }
+}
+
+static void Host_Wait(void) {
+    const uint16_t *px = inflight.px;
+    uint32_t n = inflight.n;
+
+    inflight.n = 0;
+    while (n--) Put(*px++);
+}
+
+// ============================================================================
+// 함수 표
+// ============================================================================
+
+static void Host_Window(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1) {
+    Host_Wait();
+    if (x1 >= panel.width || y1 >= panel.height || x0 > x1 || y0 > y1) {
+        fprintf(stderr, "disp_host: bad window %u,%u-%u,%u\n", x0, y0, x1, y1);
+        exit(1);
+    }
+    cur.x0 = x0; cur.y0 = y0; cur.x1 = x1; cur.y1 = y1;
+    cur.x = x0;  cur.y = y0;
+    hstats.windows++;
+}
+
+static void Host_Pixels(const uint16_t *px, uint32_t n) {
+    Host_Wait();
+    while (n--) Put(*px++);
+}
+
+static void Host_PixelsAsync(const uint16_t *px, uint32_t n) {
+    Host_Wait();
+    inflight.px = px;
+    inflight.n = n;
+}
+
+static void Host_Repeat(uint16_t color, uint32_t n) {
+    Host_Wait();
+    while (n--) Put(color);
+}
+
+// ============================================================================
+// API
+// ============================================================================
+
+const DispPanel_t *DispHost_Init(uint16_t w, uint16_t h, uint8_t async) {
+    free(frame);
+    frame = calloc((size_t)w * h, sizeof(uint16_t));
+
+    panel = (DispPanel_t){
+        .name = "host",
+        .width = w, .height = h,
+        .set_window = Host_Window,
+        .write_pixels = Host_Pixels,
+        .write_repeat = Host_Repeat,
+        .write_pixels_async = async ? Host_PixelsAsync : NULL,
+        .wait = async ? Host_Wait : NULL,
+        .flush = NULL,
+    };
+    hstats = (DispHostStats_t){0};
+    inflight.n = 0;
+    return &panel;
+}
+
+uint16_t DispHost_Get(int16_t x, int16_t y) {
+    Host_Wait();
+    return frame[y * panel.width + x];
+}
+
+uint16_t *DispHost_Frame(void) {
+    Host_Wait();
+    return frame;
+}
+
+void DispHost_GetStats(DispHostStats_t *out) {
+    Host_Wait();
+    *out = hstats;
+}
+
+void DispHost_ResetStats(void) {
+    hstats = (DispHostStats_t){0};
+}
+
+int DispHost_SavePPM(const char *path) {
+    Host_Wait();
+    FILE *f = fopen(path, "wb");
+    if (!f) return -1;
+
+    fprintf(f, "P6\n%u %u\n255\n", panel.width, panel.height);
+    for (uint32_t i = 0; i < (uint32_t)panel.width * panel.height; i++) {
+        uint16_t c = frame[i];
+        uint8_t rgb[3] = {
+            (uint8_t)((c >> 11) << 3),
+            (uint8_t)(((c >> 5) & 0x3F) << 2),
+            (uint8_t)((c & 0x1F) << 3),
+        };
+        fwrite(rgb, 1, 3, f);
+    }
+    fclose(f);
+    return 0;
+}
@@ -0,0 +1,32 @@
+/* ============================================================================
+ * disp_host.h - PC 용 가상 패널 (RGB565 메모리 화면, HAL 없음)
+ * ============================================================================
+ *
+ * 코어(disp.c)를 보드 없이 돌려 보기 위한 백엔드. disp_check.c 가 사용.
+ *
+ * ============================================================================
+ */
+
+#ifndef DISP_HOST_H
+#define DISP_HOST_H
+
+#include <stdint.h>
+#include "disp.h"
+
+typedef struct {
+    uint32_t windows;       // set_window 호출 수
+    uint32_t pixels;        // 창에 써진 픽셀 수 (겹쳐 그린 것 포함)
+    uint32_t overflow;      // 창 범위를 넘어 써진 픽셀 수 (0 이어야 정상)
+} DispHostStats_t;
+
+// async = 1 이면 write_pixels_async + wait 제공: 다음 패널 호출이나 wait 때 그 시점의 버퍼를 씀
+// → 전송 중인 줄 버퍼를 코어가 먼저 덮어쓰면 화소 비교에서 드러남
+const DispPanel_t *DispHost_Init(uint16_t w, uint16_t h, uint8_t async);
+
+uint16_t DispHost_Get(int16_t x, int16_t y);
+uint16_t *DispHost_Frame(void);                 // w*h RGB565
+void DispHost_GetStats(DispHostStats_t *out);
+void DispHost_ResetStats(void);
+int DispHost_SavePPM(const char *path);
+
+#endif /* DISP_HOST_H */
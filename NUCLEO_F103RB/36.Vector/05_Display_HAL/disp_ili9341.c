@@ -0,0 +1,59 @@
+/* ============================================================================
+ * disp_ili9341.c - ILI9341 2.8" 240x320 8080 병렬 백엔드
+ * ============================================================================
+ *
+ * 03_ILI9341_Parallel_240x320 의 ili9341.c / ili9341_bus.c / Ili9341.h 를 같이 추가
+ *   - 명령/초기화: ILI9341_Init, ILI9341_SetAddress
+ *   - 픽셀: ILI9341_Bus_Repeat16 / ILI9341_Bus_WritePixels (BSRR 표, 상위 바이트 먼저)
+ *
+ * DMA 가 없는 버스라 write_pixels_async 는 NULL (코어가 블로킹 전송으로 대체)
+ *
+ * ============================================================================
+ */
+
+#include "disp_panels.h"
+#include "ili9341.h"
+#include "ili9341_bus.h"
+
+#define CS_LOW()    (LCD_CS_PORT->BSRR = (uint32_t)LCD_CS_PIN << 16)
+#define CS_HIGH()   (LCD_CS_PORT->BSRR = LCD_CS_PIN)
+#define RS_HIGH()   (LCD_RS_PORT->BSRR = LCD_RS_PIN)                 // 데이터
+
+// ============================================================================
+// 함수 표
+// ============================================================================
+
+// RAMWR 뒤 CS Low + RS High 로 남겨 두고 픽셀을 이어 보냄
+static void ILI_Window(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1) {
+    ILI9341_SetAddress(x0, y0, x1, y1);
+    CS_LOW();
+    RS_HIGH();
+}
+
+static void ILI_Pixels(const uint16_t *px, uint32_t n) {
+    ILI9341_Bus_WritePixels(px, n);
+}
+
+static void ILI_Repeat(uint16_t color, uint32_t n) {
+    ILI9341_Bus_Repeat16(color, n);
+}
+
+static void ILI_Wait(void) {
+    CS_HIGH();
+}
+
+static const DispPanel_t panel = {
+    .name = "ILI9341",
+    .width = ILI9341_WIDTH, .height = ILI9341_HEIGHT,
+    .set_window = ILI_Window,
+    .write_pixels = ILI_Pixels,
+    .write_repeat = ILI_Repeat,
+    .write_pixels_async = NULL,
+    .wait = ILI_Wait,
+    .flush = NULL,
+};
+
+const DispPanel_t *DispILI9341_Init(void) {
+    ILI9341_Init();         // 버스 표(ILI9341_Bus_Init) 포함
+    return &panel;
+}
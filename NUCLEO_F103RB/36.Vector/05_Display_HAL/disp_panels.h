@@ -0,0 +1,26 @@
+/* ============================================================================
+ * disp_panels.h - 보드용 패널 백엔드 생성 함수
+ * ============================================================================
+ *
+ * 각 함수는 패널을 초기화하고 Disp_Init() 에 넘길 함수 표를 반환
+ *
+ *   Disp_Init(DispST7735_Init(&hspi1));
+ *   Disp_FillCircle(40, 40, 20, 0x07E0);
+ *
+ * 프로젝트에는 쓰는 패널의 disp_*.c 만 추가하면 됨
+ *
+ * ============================================================================
+ */
+
+#ifndef DISP_PANELS_H
+#define DISP_PANELS_H
+
+#include "stm32f1xx_hal.h"
+#include "disp.h"
+
+const DispPanel_t *DispST7735_Init(SPI_HandleTypeDef *hspi);   // 0.96" 160x80, PA1 RES / PA6 DC / PB6 CS
+const DispPanel_t *DispGC9A01_Init(SPI_HandleTypeDef *hspi);   // 1.28" 240x240 원형, gc9a01_driver 핀
+const DispPanel_t *DispILI9341_Init(void);                     // 2.8" 240x320 8080 병렬, ili9341.h 핀
+const DispPanel_t *DispSSD1306_Init(I2C_HandleTypeDef *hi2c);  // 0.96" 128x64 OLED, I2C 0x3C
+
+#endif /* DISP_PANELS_H */
@@ -0,0 +1,104 @@
+/* ============================================================================
+ * disp_spi.c - SPI 패널 공통 전송
+ * ============================================================================
+ */
+
+#include "disp_spi.h"
+
+#define CS_LOW(d)   ((d)->cs_port->BSRR = (uint32_t)(d)->cs_pin << 16)
+#define CS_HIGH(d)  ((d)->cs_port->BSRR = (d)->cs_pin)
+#define DC_LOW(d)   ((d)->dc_port->BSRR = (uint32_t)(d)->dc_pin << 16)   // 명령
+#define DC_HIGH(d)  ((d)->dc_port->BSRR = (d)->dc_pin)                   // 데이터
+
+#define SPI_DMA_MAX 65535u          // DMA 1회 최대 프레임 수
+
+// 프레임 크기 전환 - SPE 끈 상태에서만 DFF 변경 가능
+static void Spi_Size(DispSpi_t *d, uint32_t size) {
+    SPI_HandleTypeDef *h = d->hspi;
+    if (h->Init.DataSize == size) return;
+
+    __HAL_SPI_DISABLE(h);
+    if (size == SPI_DATASIZE_16BIT) h->Instance->CR1 |= SPI_CR1_DFF;
+    else                            h->Instance->CR1 &= ~SPI_CR1_DFF;
+    h->Init.DataSize = size;        // HAL 이 8/16비트 포인터 선택에 사용
+    __HAL_SPI_ENABLE(h);
+}
+
+// 진행 중인 DMA 완료 + 마지막 프레임이 선로를 떠날 때까지 대기
+void DispSpi_Wait(DispSpi_t *d) {
+    SPI_HandleTypeDef *h = d->hspi;
+
+    while (h->State != HAL_SPI_STATE_READY) { }
+    while (h->Instance->SR & SPI_SR_BSY) { }
+
+    if (d->fixed) {
+        h->hdmatx->Instance->CCR |= DMA_CCR_MINC;
+        d->fixed = 0;
+    }
+}
+
+void DispSpi_Cmd(DispSpi_t *d, uint8_t cmd, const uint8_t *param, uint8_t n) {
+    DispSpi_Wait(d);
+    Spi_Size(d, SPI_DATASIZE_8BIT);
+
+    CS_HIGH(d);
+    CS_LOW(d);
+    DC_LOW(d);
+    HAL_SPI_Transmit(d->hspi, &cmd, 1, HAL_MAX_DELAY);
+    DC_HIGH(d);
+    if (n) HAL_SPI_Transmit(d->hspi, (uint8_t *)param, n, HAL_MAX_DELAY);
+    CS_HIGH(d);
+}
+
+// 창 설정 후 CS Low + DC High + 16비트 프레임 상태로 남김 (이어서 픽셀 전송)
+void DispSpi_Window(DispSpi_t *d, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1) {
+    x0 += d->x_off; x1 += d->x_off;
+    y0 += d->y_off; y1 += d->y_off;
+
+    uint8_t ca[4] = { x0 >> 8, x0 & 0xFF, x1 >> 8, x1 & 0xFF };
+    uint8_t ra[4] = { y0 >> 8, y0 & 0xFF, y1 >> 8, y1 & 0xFF };
+    uint8_t ramwr = 0x2C;
+
+    DispSpi_Cmd(d, 0x2A, ca, 4);    // CASET
+    DispSpi_Cmd(d, 0x2B, ra, 4);    // RASET
+
+    CS_LOW(d);
+    DC_LOW(d);
+    HAL_SPI_Transmit(d->hspi, &ramwr, 1, HAL_MAX_DELAY);
+    DC_HIGH(d);
+    Spi_Size(d, SPI_DATASIZE_16BIT);
+}
+
+void DispSpi_Pixels(DispSpi_t *d, const uint16_t *px, uint32_t n) {
+    DispSpi_Wait(d);
+    while (n) {
+        uint16_t k = (n > SPI_DMA_MAX) ? SPI_DMA_MAX : (uint16_t)n;
+        HAL_SPI_Transmit(d->hspi, (uint8_t *)px, k, HAL_MAX_DELAY);
+        px += k;
+        n -= k;
+    }
+}
+
+// DMA 출발 후 바로 반환 (px 는 다음 전송 출발 전까지 유지해야 함)
+void DispSpi_PixelsAsync(DispSpi_t *d, const uint16_t *px, uint32_t n) {
+    while (n) {
+        uint16_t k = (n > SPI_DMA_MAX) ? SPI_DMA_MAX : (uint16_t)n;
+        DispSpi_Wait(d);
+        HAL_SPI_Transmit_DMA(d->hspi, (uint8_t *)px, k);
+        px += k;
+        n -= k;
+    }
+}
+
+// 단색 - MINC 끄고 d->fill 한 칸을 n번 (버퍼 없이 DMA 1회로 최대 65535픽셀)
+void DispSpi_Repeat(DispSpi_t *d, uint16_t color, uint32_t n) {
+    while (n) {
+        uint16_t k = (n > SPI_DMA_MAX) ? SPI_DMA_MAX : (uint16_t)n;
+        DispSpi_Wait(d);
+        d->fill = color;
+        d->hspi->hdmatx->Instance->CCR &= ~DMA_CCR_MINC;
+        d->fixed = 1;
+        HAL_SPI_Transmit_DMA(d->hspi, (uint8_t *)&d->fill, k);
+        n -= k;
+    }
+}
@@ -0,0 +1,41 @@
+/* ============================================================================
+ * disp_spi.h - SPI 패널 공통 전송 (ST7735 / GC9A01)
+ * ============================================================================
+ *
+ * 명령/파라미터는 8비트 프레임, 픽셀은 16비트 프레임 (CR1.DFF 전환)
+ *   → RGB565 uint16_t 를 바이트 교환 없이 그대로 DMA
+ * 단색 채우기는 DMA 메모리 증가(MINC)를 끈 채로 색 1개를 n번 전송
+ *
+ * CubeMX:
+ *   - SPIx: Transmit Only Master, 8 Bits (코드가 필요할 때 16비트로 바꿈)
+ *   - DMA: SPIx_TX, Normal, Memory Increment, Data Width = Half Word / Half Word
+ *   - NVIC: DMA 채널 인터럽트 Enable (HAL 전송 완료 처리에 필요)
+ *
+ * ============================================================================
+ */
+
+#ifndef DISP_SPI_H
+#define DISP_SPI_H
+
+#include "stm32f1xx_hal.h"
+
+typedef struct {
+    SPI_HandleTypeDef *hspi;
+    GPIO_TypeDef *cs_port;
+    uint16_t      cs_pin;
+    GPIO_TypeDef *dc_port;
+    uint16_t      dc_pin;
+    uint16_t      x_off, y_off;     // 패널 RAM 오프셋 (ST7735 0.96" = 0, 26)
+
+    uint16_t      fill;             // 단색 DMA 원본 (전송 중 유지)
+    volatile uint8_t fixed;         // MINC 꺼진 전송 진행 중
+} DispSpi_t;
+
+void DispSpi_Cmd(DispSpi_t *d, uint8_t cmd, const uint8_t *param, uint8_t n);
+void DispSpi_Window(DispSpi_t *d, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1);
+void DispSpi_Pixels(DispSpi_t *d, const uint16_t *px, uint32_t n);
+void DispSpi_PixelsAsync(DispSpi_t *d, const uint16_t *px, uint32_t n);
+void DispSpi_Repeat(DispSpi_t *d, uint16_t color, uint32_t n);
+void DispSpi_Wait(DispSpi_t *d);
+
+#endif /* DISP_SPI_H */
@@ -0,0 +1,139 @@
+/* ============================================================================
+ * disp_ssd1306.c - SSD1306 0.96" 128x64 OLED 백엔드 (02_SSD1306_I2C_128x64 와 같은 배선)
+ * ============================================================================
+ *
+ * 코어가 보내는 RGB565 픽셀을 밝기 기준으로 1비트로 바꿔 1KB 프레임버퍼에 씀
+ * EndFrame 때 dirty 사각형이 걸친 페이지 x 열 범위만 I2C 로 전송
+ *   (02 main.c 는 매 프레임 1KB 전체 전송)
+ *
+ * 핀: PB6(SCL), PB7(SDA), I2C1 Fast Mode 400kHz
+ * 초기화 시퀀스는 02 main.c 의 SSD1306_Init 그대로
+ *
+ * ============================================================================
+ */
+
+#include "disp_panels.h"
+
+#define SSD1306_I2C_ADDR    0x78    // 0x3C << 1 (안되면 0x7A 시도)
+#define SSD1306_WIDTH       128
+#define SSD1306_HEIGHT      64
+#define SSD1306_CMD         0x00
+#define SSD1306_DATA        0x40
+#define SSD1306_COLUMN_ADDR 0x21
+#define SSD1306_PAGE_ADDR   0x22
+
+#define SSD1306_LEVEL       64      // 밝기(0~255) 이 값 이상이면 켜짐
+
+static I2C_HandleTypeDef *i2c;
+static uint8_t frame_buffer[SSD1306_WIDTH * SSD1306_HEIGHT / 8];
+
+// 창 커서 (set_window 이후 왼쪽→오른쪽, 위→아래)
+static struct {
+    int16_t x0, x1;
+    int16_t x, y;
+} cur;
+
+// ============================================================================
+// 프레임버퍼
+// ============================================================================
+
+static inline uint8_t Mono(uint16_t c) {
+    uint16_t r = (c >> 11) << 3;
+    uint16_t g = ((c >> 5) & 0x3F) << 2;
+    uint16_t b = (c & 0x1F) << 3;
+    return ((r * 77 + g * 150 + b * 29) >> 8) >= SSD1306_LEVEL;
+}
+
+static inline void Put(uint8_t on) {
+    uint8_t *p = &frame_buffer[cur.x + (cur.y >> 3) * SSD1306_WIDTH];
+    uint8_t bit = 1u << (cur.y & 7);
+
+    if (cur.y < SSD1306_HEIGHT) *p = on ? (*p | bit) : (*p & ~bit);
+    if (++cur.x > cur.x1) {
+        cur.x = cur.x0;
+        cur.y++;
+    }
+}
+
+// ============================================================================
+// 함수 표
+// ============================================================================
+
+static void OLED_Window(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1) {
+    cur.x0 = x0; cur.x1 = x1;
+    cur.x = x0;  cur.y = y0;
+}
+
+static void OLED_Pixels(const uint16_t *px, uint32_t n) {
+    while (n--) Put(Mono(*px++));
+}
+
+static void OLED_Repeat(uint16_t color, uint32_t n) {
+    uint8_t on = Mono(color);
+    while (n--) Put(on);
+}
+
+static void WriteCmd(uint8_t cmd) {
+    uint8_t data[2] = { SSD1306_CMD, cmd };
+    HAL_I2C_Master_Transmit(i2c, SSD1306_I2C_ADDR, data, 2, HAL_MAX_DELAY);
+}
+
+// dirty 사각형 → 페이지 범위 x 열 범위만 전송 (가로 주소 모드라 창 안에서 자동 줄바꿈)
+static void OLED_Flush(const DispRect_t *r) {
+    uint8_t p0 = r->y0 >> 3, p1 = r->y1 >> 3;
+    uint16_t w = r->x1 - r->x0 + 1;
+
+    WriteCmd(SSD1306_COLUMN_ADDR); WriteCmd(r->x0); WriteCmd(r->x1);
+    WriteCmd(SSD1306_PAGE_ADDR);   WriteCmd(p0);    WriteCmd(p1);
+
+    for (uint8_t p = p0; p <= p1; p++) {
+        HAL_I2C_Mem_Write(i2c, SSD1306_I2C_ADDR, SSD1306_DATA, I2C_MEMADD_SIZE_8BIT,
+                          &frame_buffer[p * SSD1306_WIDTH + r->x0], w, HAL_MAX_DELAY);
+    }
+}
+
+static const DispPanel_t panel = {
+    .name = "SSD1306",
+    .width = SSD1306_WIDTH, .height = SSD1306_HEIGHT,
+    .set_window = OLED_Window,
+    .write_pixels = OLED_Pixels,
+    .write_repeat = OLED_Repeat,
+    .write_pixels_async = NULL,
+    .wait = NULL,
+    .flush = OLED_Flush,
+};
+
+// ============================================================================
+// 초기화
+// ============================================================================
+
+const DispPanel_t *DispSSD1306_Init(I2C_HandleTypeDef *hi2c) {
+    static const uint8_t init[] = {
+        0xAE,               // DISPLAY_OFF
+        0xD5, 0x80,         // SET_DISPLAY_CLOCK_DIV
+        0xA8, SSD1306_HEIGHT - 1,   // SET_MULTIPLEX
+        0xD3, 0x00,         // SET_DISPLAY_OFFSET
+        0x40,               // SET_START_LINE
+        0x8D, 0x14,         // CHARGE_PUMP
+        0x20, 0x00,         // MEMORY_MODE: 가로
+        0xA1,               // SEG_REMAP
+        0xC8,               // COM_SCAN_DEC
+        0xDA, 0x12,         // SET_COM_PINS
+        0x81, 0xCF,         // SET_CONTRAST
+        0xD9, 0xF1,         // SET_PRECHARGE
+        0xDB, 0x40,         // SET_VCOM_DETECT
+        0xA4,               // DISPLAY_ALL_ON_RESUME
+        0xA6,               // NORMAL_DISPLAY
+        0xAF,               // DISPLAY_ON
+    };
+
+    i2c = hi2c;
+    HAL_Delay(100);
+    for (uint8_t i = 0; i < sizeof(init); i++) WriteCmd(init[i]);
+
+    // 화면 전체를 한 번 지움
+    static const DispRect_t all = { 0, 0, SSD1306_WIDTH - 1, SSD1306_HEIGHT - 1 };
+    OLED_Flush(&all);
+
+    return &panel;
+}
@@ -0,0 +1,87 @@
+/* ============================================================================
+ * disp_st7735.c - ST7735S 0.96" 160x80 백엔드 (01_ST7735S_SPI_160x80 와 같은 배선)
+ * ============================================================================
+ *
+ * 핀: PA5(SCK), PA7(MOSI), PA1(RES), PA6(DC), PB6(CS)
+ * 초기화 시퀀스는 01 main.c 의 LCD_Init 그대로
+ *
+ * ============================================================================
+ */
+
+#include "disp_panels.h"
+#include "disp_spi.h"
+
+#define ST7735_WIDTH    160
+#define ST7735_HEIGHT   80
+#define ST7735_X_OFFSET 0
+#define ST7735_Y_OFFSET 26      // 0.96" 모듈의 RAM 위치 (핀 위쪽)
+
+static DispSpi_t bus = {
+    .cs_port = GPIOB, .cs_pin = GPIO_PIN_6,
+    .dc_port = GPIOA, .dc_pin = GPIO_PIN_6,
+    .x_off = ST7735_X_OFFSET, .y_off = ST7735_Y_OFFSET,
+};
+
+// ============================================================================
+// 함수 표
+// ============================================================================
+
+static void ST_Window(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1) { DispSpi_Window(&bus, x0, y0, x1, y1); }
+static void ST_Pixels(const uint16_t *px, uint32_t n)   { DispSpi_Pixels(&bus, px, n); }
+static void ST_Repeat(uint16_t color, uint32_t n)       { DispSpi_Repeat(&bus, color, n); }
+static void ST_Async(const uint16_t *px, uint32_t n)    { DispSpi_PixelsAsync(&bus, px, n); }
+static void ST_Wait(void)                               { DispSpi_Wait(&bus); }
+
+static const DispPanel_t panel = {
+    .name = "ST7735S",
+    .width = ST7735_WIDTH, .height = ST7735_HEIGHT,
+    .set_window = ST_Window,
+    .write_pixels = ST_Pixels,
+    .write_repeat = ST_Repeat,
+    .write_pixels_async = ST_Async,
+    .wait = ST_Wait,
+    .flush = NULL,
+};
+
+// ============================================================================
+// 초기화
+// ============================================================================
+
+static void Cmd(uint8_t cmd, const uint8_t *p, uint8_t n) {
+    DispSpi_Cmd(&bus, cmd, p, n);
+}
+
+const DispPanel_t *DispST7735_Init(SPI_HandleTypeDef *hspi) {
+    static const uint8_t frmctr[] = { 0x01, 0x2C, 0x2D };
+    static const uint8_t frmctr3[] = { 0x01, 0x2C, 0x2D, 0x01, 0x2C, 0x2D };
+    static const uint8_t gp[] = { 0x02,0x1c,0x07,0x12,0x37,0x32,0x29,0x2d,0x29,0x25,0x2B,0x39,0x00,0x01,0x03,0x10 };
+    static const uint8_t gn[] = { 0x03,0x1d,0x07,0x06,0x2E,0x2C,0x29,0x2D,0x2E,0x2E,0x37,0x3F,0x00,0x00,0x02,0x10 };
+
+    bus.hspi = hspi;
+
+    HAL_GPIO_WritePin(GPIOA, GPIO_PIN_1, GPIO_PIN_RESET); HAL_Delay(50);
+    HAL_GPIO_WritePin(GPIOA, GPIO_PIN_1, GPIO_PIN_SET);   HAL_Delay(50);
+
+    Cmd(0x01, NULL, 0); HAL_Delay(150);                     // SWRESET
+    Cmd(0x11, NULL, 0); HAL_Delay(150);                     // SLPOUT
+
+    Cmd(0xB1, frmctr, 3);                                   // FRMCTR1
+    Cmd(0xB2, frmctr, 3);                                   // FRMCTR2
+    Cmd(0xB3, frmctr3, 6);                                  // FRMCTR3
+    Cmd(0xB4, (const uint8_t[]){ 0x07 }, 1);                // INVCTR
+    Cmd(0xC0, (const uint8_t[]){ 0xA2, 0x02, 0x84 }, 3);    // PWCTR1
+    Cmd(0xC1, (const uint8_t[]){ 0xC5 }, 1);                // PWCTR2
+    Cmd(0xC2, (const uint8_t[]){ 0x0A, 0x00 }, 2);          // PWCTR3
+    Cmd(0xC3, (const uint8_t[]){ 0x8A, 0x2A }, 2);          // PWCTR4
+    Cmd(0xC4, (const uint8_t[]){ 0x8A, 0xEE }, 2);          // PWCTR5
+    Cmd(0xC5, (const uint8_t[]){ 0x0E }, 1);                // VMCTR1
+    Cmd(0x20, NULL, 0);                                     // INVOFF
+    Cmd(0x36, (const uint8_t[]){ 0x60 }, 1);                // MADCTL: 핀 위쪽, 가로
+    Cmd(0x3A, (const uint8_t[]){ 0x05 }, 1);                // COLMOD: 16비트
+    Cmd(0xE0, gp, 16);                                      // GMCTRP1
+    Cmd(0xE1, gn, 16);                                      // GMCTRN1
+    Cmd(0x13, NULL, 0); HAL_Delay(10);                      // NORON
+    Cmd(0x29, NULL, 0); HAL_Delay(100);                     // DISPON
+
+    return &panel;
+}
@@ -0,0 +1,150 @@
+/**
+  ******************************************************************************
+  * @file    bench.c
+  * @brief   버스 벤치마크 측정/출력 - 보드와 호스트 공통
+  *
+  * [측정 방법]
+  *   워밍업 1회 (플래시 ART 캐시, HAL 상태 준비) → BENCH_RUNS회 측정
+  *   → 정렬 후 최소 / 중앙 / 최대, 바이트당 값은 소수 1자리
+  *   회마다 BENCH_SETTLE() 로 버스를 쉬게 함 (측정 구간 밖)
+  *
+  * [출력]
+  *   bench,op,tier,bytes,runs,unit,min,med,max,min_pb,med_pb,max_pb,status
+  *   → "bench," 으로 시작하는 줄만 골라 CSV로 저장 (grep ^bench, log.txt)
+  *   이어서 사람이 읽는 표: 방식별 바이트당 중앙값 + 추천 방식
+  *
+  * [추천 방식]
+  *   가장 빠른 중앙값의 105% 안에 드는 것 중 가장 추상화가 높은 방식
+  *   → 버스가 느린 동작(I2C/UART)은 HAL로 충분, 빠른 버스(SPI)만 저수준이 이득
+  ******************************************************************************
+  */
+#include "bench.h"
+#include <stdio.h>
+
+#define RECOMMEND_PCT       105
+
+static uint8_t bench_buf[BENCH_BUF_SIZE] __attribute__((aligned(4)));
+
+const char *const bench_tier_name[TIER_COUNT] = { "HAL", "LL", "CMSIS", "REG", "ASM" };
+
+/* =========================================================================
+ * Bench_Fill : 송신 패턴 (호스트 검증도 같은 함수로 기대값 생성)
+ * =========================================================================*/
+void Bench_Fill(uint8_t *buf, uint16_t len)
+{
+    for (uint16_t i = 0; i < len; i++) buf[i] = (uint8_t)(0x30 + (i * 7) % 64);
+}
+
+static void sort_u32(uint32_t *a, int n)
+{
+    for (int i = 1; i < n; i++) {
+        uint32_t v = a[i]; int j = i - 1;
+        while (j >= 0 && a[j] > v) { a[j + 1] = a[j]; j--; }
+        a[j + 1] = v;
+    }
+}
+
+/* =========================================================================
+ * Bench_Run : 동작 1개 × 방식 1개 측정
+ * =========================================================================*/
+void Bench_Run(BenchOp_t op, BenchTier_t tier, BenchResult_t *r)
+{
+    BenchFn_t fn = bench_fn[op][tier];
+    uint16_t  len = bench_op[op].len;
+    uint32_t  t[BENCH_RUNS], t0;
+    int       st;
+
+    r->min = r->med = r->max = 0;
+    r->status = BENCH_OK;
+    if (fn == NULL) return;
+
+    Bench_Fill(bench_buf, len);
+    st = fn(bench_buf, len);                        /* 워밍업 */
+
+    for (int i = 0; i < BENCH_RUNS && st == BENCH_OK; i++) {
+        BENCH_SETTLE();
+        if (op != OP_ADC) Bench_Fill(bench_buf, len);
+        t0 = BENCH_NOW();
+        st = fn(bench_buf, len);
+        t[i] = BENCH_NOW() - t0;
+    }
+    if (st != BENCH_OK) { r->status = (int8_t)st; return; }
+
+    sort_u32(t, BENCH_RUNS);
+    r->min = t[0];
+    r->med = t[BENCH_RUNS / 2];
+    r->max = t[BENCH_RUNS - 1];
+}
+
+void Bench_RunAll(BenchResult_t res[OP_COUNT][TIER_COUNT])
+{
+    Bench_PrintCsvHeader();
+    for (int op = 0; op < OP_COUNT; op++) {
+        for (int tier = 0; tier < TIER_COUNT; tier++) {
+            if (bench_fn[op][tier] == NULL) continue;
+            Bench_Run((BenchOp_t)op, (BenchTier_t)tier, &res[op][tier]);
+            Bench_PrintCsv((BenchOp_t)op, (BenchTier_t)tier, &res[op][tier]);
+        }
+    }
+    Bench_PrintTable(res);
+}
+
+/* =========================================================================
+ * 출력
+ * =========================================================================*/
+
+/* 바이트당 값 × 10 (반올림) */
+static uint32_t per_byte_x10(uint32_t v, uint16_t len)
+{
+    return (v * 10U + len / 2U) / len;
+}
+
+void Bench_PrintCsvHeader(void)
+{
+    printf("bench,op,tier,bytes,runs,unit,min,med,max,min_pb,med_pb,max_pb,status\r\n");
+}
+
+void Bench_PrintCsv(BenchOp_t op, BenchTier_t tier, const BenchResult_t *r)
+{
+    uint16_t len = bench_op[op].len;
+    uint32_t a = per_byte_x10(r->min, len);
+    uint32_t b = per_byte_x10(r->med, len);
+    uint32_t c = per_byte_x10(r->max, len);
+
+    printf("bench,%s,%s,%u,%u,%s,%lu,%lu,%lu,%lu.%lu,%lu.%lu,%lu.%lu,%s\r\n",
+           bench_op[op].name, bench_tier_name[tier], len, BENCH_RUNS, BENCH_UNIT,
+           (unsigned long)r->min, (unsigned long)r->med, (unsigned long)r->max,
+           (unsigned long)(a / 10), (unsigned long)(a % 10),
+           (unsigned long)(b / 10), (unsigned long)(b % 10),
+           (unsigned long)(c / 10), (unsigned long)(c % 10),
+           r->status == BENCH_OK ? "ok" : "nack");
+}
+
+void Bench_PrintTable(BenchResult_t res[OP_COUNT][TIER_COUNT])
+{
+    printf("\r\n[중앙값, %s/B]     ", BENCH_UNIT);
+    for (int tier = 0; tier < TIER_COUNT; tier++) printf("%8s", bench_tier_name[tier]);
+    printf("   추천\r\n");
+
+    for (int op = 0; op < OP_COUNT; op++) {
+        uint16_t len = bench_op[op].len;
+        uint32_t best = UINT32_MAX;
+        int rec = -1;
+
+        printf("%-18s", bench_op[op].name);
+        for (int tier = 0; tier < TIER_COUNT; tier++) {
+            const BenchResult_t *r = &res[op][tier];
+            if (bench_fn[op][tier] == NULL)  { printf("%8s", "-");    continue; }
+            if (r->status != BENCH_OK)       { printf("%8s", "nack"); continue; }
+            uint32_t v = per_byte_x10(r->med, len);
+            printf("%6lu.%lu", (unsigned long)(v / 10), (unsigned long)(v % 10));
+            if (r->med < best) best = r->med;
+        }
+        for (int tier = 0; tier < TIER_COUNT && best != UINT32_MAX; tier++) {
+            const BenchResult_t *r = &res[op][tier];
+            if (bench_fn[op][tier] != NULL && r->status == BENCH_OK &&
+                (uint64_t)r->med * 100U <= (uint64_t)best * RECOMMEND_PCT) { rec = tier; break; }
+        }
+        printf("   %s\r\n", rec < 0 ? "-" : bench_tier_name[rec]);
+    }
+}
@@ -0,0 +1,106 @@
+/**
+  ******************************************************************************
+  * @file    bench.h
+  * @brief   버스 주변장치 5가지 접근 방식(HAL/LL/CMSIS/REG/ASM) 벤치마크 공통 헤더
+  * @board   NUCLEO-F411RE (호스트: host/ 의 모의 주변장치)
+  *
+  * [구성]
+  *   bench_ops.c  : 동작(OP) × 방식(TIER) 구현 25개 + bench_fn[][] 표
+  *   bench.c      : 측정(BENCH_RUNS회 → 최소/중앙/최대), CSV/표 출력
+  *   main_bench.c : 보드용 main (주변장치 초기화 후 측정)
+  *   host/        : PC용 main + 레지스터 주소를 흉내 내는 모의 주변장치
+  *
+  * [측정 단위]
+  *   보드   : DWT CYCCNT 사이클
+  *   호스트 : 주변장치 레지스터 접근 횟수 (결정적 → CI 회귀 검사용)
+  ******************************************************************************
+  */
+#ifndef BENCH_H
+#define BENCH_H
+
+#include <stdint.h>
+
+#ifdef BENCH_HOST
+#include "stm32_sim.h"              /* host/ : 레지스터 구조체 + LL/HAL 최소 구현 */
+#define BENCH_NOW()         Sim_Accesses()
+#define BENCH_SETTLE()      ((void)0)
+#define BENCH_UNIT          "acc"
+#else
+#include "main.h"
+#include "stm32f4xx_ll_spi.h"
+#include "stm32f4xx_ll_i2c.h"
+#include "stm32f4xx_ll_usart.h"
+#include "stm32f4xx_ll_adc.h"
+#define BENCH_NOW()         (DWT->CYCCNT)
+#define BENCH_SETTLE()      HAL_Delay(1)    /* I2C STOP 완료 등, 측정 구간 밖에서 대기 */
+#define BENCH_UNIT          "cyc"
+#endif
+
+/* ASM 방식은 Cortex-M(Thumb-2)에서만 - 호스트에서는 빈 칸 */
+#if defined(__arm__) || defined(__thumb__)
+#define BENCH_HAS_ASM       1
+#else
+#define BENCH_HAS_ASM       0
+#endif
+
+/* ── 측정 설정 ─────────────────────────────────────────────────────────── */
+#define BENCH_RUNS          11          /* 홀수 (중앙값), 워밍업 1회 별도 */
+#define BENCH_BUF_SIZE      64
+
+#define BENCH_I2C_DEV       0x27        /* PCF8574 (SET2 CLCD 모듈) */
+#define BENCH_I2C_ADDR_W    (BENCH_I2C_DEV << 1)
+
+#define BENCH_OK            0
+#define BENCH_ERR_NACK      (-1)        /* 주소 NACK (장치 없음) → STOP 후 리턴 */
+
+/* ── 방식 / 동작 ───────────────────────────────────────────────────────── */
+typedef enum {
+    TIER_HAL = 0,
+    TIER_LL,
+    TIER_CMSIS,
+    TIER_REG,
+    TIER_ASM,
+    TIER_COUNT
+} BenchTier_t;
+
+typedef enum {
+    OP_SPI_BURST = 0,           /* SPI2 64바이트 연속 쓰기       */
+    OP_I2C_BYTE,                /* I2C1 1바이트 쓰기 (S+주소+1+P) */
+    OP_I2C_BLOCK,               /* I2C1 16바이트 블록 쓰기       */
+    OP_UART_TX,                 /* USART1 16바이트 송신          */
+    OP_ADC,                     /* ADC1 CH0 8샘플 (16바이트)     */
+    OP_COUNT
+} BenchOp_t;
+
+/* buf: 보낼 데이터 (ADC는 uint16_t 샘플을 받을 곳), len: 바이트 수 */
+typedef int (*BenchFn_t)(uint8_t *buf, uint16_t len);
+
+typedef struct {
+    const char *name;           /* CSV op 열 */
+    uint16_t    len;            /* 1회 전송 바이트 */
+} BenchOpInfo_t;
+
+typedef struct {
+    uint32_t min, med, max;     /* 1회 전송 전체 (BENCH_UNIT) */
+    int8_t   status;            /* BENCH_OK / BENCH_ERR_* */
+} BenchResult_t;
+
+extern const BenchOpInfo_t bench_op[OP_COUNT];
+extern const char *const   bench_tier_name[TIER_COUNT];
+extern const BenchFn_t     bench_fn[OP_COUNT][TIER_COUNT];   /* NULL = 이 빌드에 없음 */
+
+/* main_bench.c (보드) / host/bench_host.c (호스트) 에서 정의 */
+extern SPI_HandleTypeDef  hspi2;
+extern I2C_HandleTypeDef  hi2c1;
+extern UART_HandleTypeDef huart1;
+extern ADC_HandleTypeDef  hadc1;
+
+/* ── bench.c ───────────────────────────────────────────────────────────── */
+void Bench_Fill(uint8_t *buf, uint16_t len);
+void Bench_Run(BenchOp_t op, BenchTier_t tier, BenchResult_t *r);
+void Bench_RunAll(BenchResult_t res[OP_COUNT][TIER_COUNT]);
+void Bench_PrintCsvHeader(void);
+void Bench_PrintCsv(BenchOp_t op, BenchTier_t tier, const BenchResult_t *r);
+void Bench_PrintTable(BenchResult_t res[OP_COUNT][TIER_COUNT]);
+
+#endif /* BENCH_H */
@@ -0,0 +1,427 @@
+/**
+  ******************************************************************************
+  * @file    bench_ops.c
+  * @brief   동작 5개(SPI/I2C 1바이트/I2C 블록/UART/ADC) × 방식 5개 구현
+  *
+  * [규칙]
+  *   - 방식마다 같은 레지스터 시퀀스를 수행 (차이는 접근 방식뿐)
+  *   - 전송 끝까지 기다린 뒤 리턴 (SPI: TXE→BSY, I2C: BTF→STOP, UART: TC)
+  *   - I2C 주소 NACK(AF)이면 STOP + AF 클리어 후 BENCH_ERR_NACK
+  *   - ASM은 Thumb-2 전용 (BENCH_HAS_ASM), 호스트 빌드에서는 표에서 빠짐
+  *
+  * [레지스터 - RM0383]
+  *   SPI2   0x40003800  SR +0x08 (TXE b1, BSY b7)   DR +0x0C
+  *   I2C1   0x40005400  CR1 +0x00 (START b8, STOP b9)  DR +0x10
+  *                      SR1 +0x14 (SB b0, ADDR b1, BTF b2, TXE b7, AF b10)  SR2 +0x18
+  *   USART1 0x40011000  SR +0x00 (TC b6, TXE b7)    DR +0x04
+  *   ADC1   0x40012000  SR +0x00 (EOC b1)  CR2 +0x08 (SWSTART b30)  DR +0x4C
+  ******************************************************************************
+  */
+#include <stddef.h>
+#include "bench.h"
+
+/* ── 절대 주소 (④ REG, ⑤ ASM) ─────────────────────────────────────────── */
+#define REG32(a)            (*(volatile uint32_t *)(a))
+#define REG8(a)             (*(volatile uint8_t  *)(a))
+
+#define SPI2_BASE_ADDR      0x40003800UL
+#define I2C1_BASE_ADDR      0x40005400UL
+#define USART1_BASE_ADDR    0x40011000UL
+#define ADC1_BASE_ADDR      0x40012000UL
+
+#define SPI2_SR_REG         REG32(SPI2_BASE_ADDR + 0x08UL)
+#define SPI2_DR_REG8        REG8(SPI2_BASE_ADDR + 0x0CUL)
+#define SPI2_DR_REG         REG32(SPI2_BASE_ADDR + 0x0CUL)
+
+#define I2C1_CR1_REG        REG32(I2C1_BASE_ADDR + 0x00UL)
+#define I2C1_DR_REG         REG32(I2C1_BASE_ADDR + 0x10UL)
+#define I2C1_SR1_REG        REG32(I2C1_BASE_ADDR + 0x14UL)
+#define I2C1_SR2_REG        REG32(I2C1_BASE_ADDR + 0x18UL)
+
+#define USART1_SR_REG       REG32(USART1_BASE_ADDR + 0x00UL)
+#define USART1_DR_REG       REG32(USART1_BASE_ADDR + 0x04UL)
+
+#define ADC1_SR_REG         REG32(ADC1_BASE_ADDR + 0x00UL)
+#define ADC1_CR2_REG        REG32(ADC1_BASE_ADDR + 0x08UL)
+#define ADC1_DR_REG         REG32(ADC1_BASE_ADDR + 0x4CUL)
+
+#define B_SPI_TXE           (1U << 1)
+#define B_SPI_BSY           (1U << 7)
+#define B_I2C_START         (1U << 8)
+#define B_I2C_STOP          (1U << 9)
+#define B_I2C_SB            (1U << 0)
+#define B_I2C_ADDR          (1U << 1)
+#define B_I2C_BTF           (1U << 2)
+#define B_I2C_TXE           (1U << 7)
+#define B_I2C_AF            (1U << 10)
+#define B_UART_TC           (1U << 6)
+#define B_UART_TXE          (1U << 7)
+#define B_ADC_EOC           (1U << 1)
+#define B_ADC_SWSTART       (1U << 30)
+
+#define HAL_TIMEOUT_MS      10
+
+const BenchOpInfo_t bench_op[OP_COUNT] = {
+    [OP_SPI_BURST] = { "spi_burst",  64 },
+    [OP_I2C_BYTE]  = { "i2c_byte",    1 },
+    [OP_I2C_BLOCK] = { "i2c_block",  16 },
+    [OP_UART_TX]   = { "uart_tx",    16 },
+    [OP_ADC]       = { "adc_sample", 16 },     /* 8샘플 × 2바이트 */
+};
+
+/* =========================================================================
+ * SPI2 연속 쓰기 : TXE 대기 → DR ... → TXE → BSY=0 → OVR 클리어(DR, SR 읽기)
+ * =========================================================================*/
+static int SPI_HAL(uint8_t *buf, uint16_t len)
+{
+    return HAL_SPI_Transmit(&hspi2, buf, len, HAL_TIMEOUT_MS) == HAL_OK ? BENCH_OK : BENCH_ERR_NACK;
+}
+
+static int SPI_LL(uint8_t *buf, uint16_t len)
+{
+    for (uint16_t i = 0; i < len; i++) {
+        while (!LL_SPI_IsActiveFlag_TXE(SPI2));
+        LL_SPI_TransmitData8(SPI2, buf[i]);
+    }
+    while (!LL_SPI_IsActiveFlag_TXE(SPI2));
+    while (LL_SPI_IsActiveFlag_BSY(SPI2));
+    LL_SPI_ClearFlag_OVR(SPI2);
+    return BENCH_OK;
+}
+
+static int SPI_CMSIS(uint8_t *buf, uint16_t len)
+{
+    for (uint16_t i = 0; i < len; i++) {
+        while (!(SPI2->SR & SPI_SR_TXE));
+        *(volatile uint8_t *)&SPI2->DR = buf[i];
+    }
+    while (!(SPI2->SR & SPI_SR_TXE));
+    while (SPI2->SR & SPI_SR_BSY);
+    (void)SPI2->DR; (void)SPI2->SR;
+    return BENCH_OK;
+}
+
+static int SPI_REG(uint8_t *buf, uint16_t len)
+{
+    for (uint16_t i = 0; i < len; i++) {
+        while (!(SPI2_SR_REG & B_SPI_TXE));
+        SPI2_DR_REG8 = buf[i];
+    }
+    while (!(SPI2_SR_REG & B_SPI_TXE));
+    while (SPI2_SR_REG & B_SPI_BSY);
+    (void)SPI2_DR_REG; (void)SPI2_SR_REG;
+    return BENCH_OK;
+}
+
+#if BENCH_HAS_ASM
+static int SPI_ASM(uint8_t *buf, uint16_t len)
+{
+    uint32_t n = len;
+    __asm volatile (
+        "LDR   r2, =%c[base]    \n\t"   /* r2 = SPI2 베이스              */
+        "1:                     \n\t"
+        "LDR   r3, [r2, #0x08]  \n\t"   /* SR 읽기                       */
+        "TST   r3, #0x02        \n\t"   /* TXE(bit1)                     */
+        "BEQ   1b               \n\t"
+        "LDRB  r3, [%[p]], #1   \n\t"   /* r3 = *p++                     */
+        "STRB  r3, [r2, #0x0C]  \n\t"   /* DR = r3 (8비트)               */
+        "SUBS  %[n], %[n], #1   \n\t"
+        "BNE   1b               \n\t"
+        "2:                     \n\t"
+        "LDR   r3, [r2, #0x08]  \n\t"   /* 마지막 바이트 TXE             */
+        "TST   r3, #0x02        \n\t"
+        "BEQ   2b               \n\t"
+        "3:                     \n\t"
+        "LDR   r3, [r2, #0x08]  \n\t"   /* BSY(bit7)=0 까지              */
+        "TST   r3, #0x80        \n\t"
+        "BNE   3b               \n\t"
+        "LDR   r3, [r2, #0x0C]  \n\t"   /* OVR 클리어: DR → SR 읽기      */
+        "LDR   r3, [r2, #0x08]  \n\t"
+        : [p] "+r"(buf), [n] "+r"(n)
+        : [base] "i"(SPI2_BASE_ADDR)
+        : "r2", "r3", "cc", "memory"
+    );
+    return BENCH_OK;
+}
+#endif
+
+/* =========================================================================
+ * I2C1 쓰기 : START → SB → 주소 → ADDR(또는 AF) → SR1/SR2 읽기
+ *             → (TXE → DR) × len → BTF → STOP
+ *   1바이트/블록 동작이 같은 함수 사용 (len만 다름)
+ * =========================================================================*/
+static int I2C_HAL(uint8_t *buf, uint16_t len)
+{
+    return HAL_I2C_Master_Transmit(&hi2c1, BENCH_I2C_ADDR_W, buf, len, HAL_TIMEOUT_MS) == HAL_OK
+           ? BENCH_OK : BENCH_ERR_NACK;
+}
+
+static int I2C_LL(uint8_t *buf, uint16_t len)
+{
+    LL_I2C_GenerateStartCondition(I2C1);
+    while (!LL_I2C_IsActiveFlag_SB(I2C1));
+    LL_I2C_TransmitData8(I2C1, BENCH_I2C_ADDR_W);
+    while (!LL_I2C_IsActiveFlag_ADDR(I2C1)) {
+        if (LL_I2C_IsActiveFlag_AF(I2C1)) {
+            LL_I2C_GenerateStopCondition(I2C1);
+            LL_I2C_ClearFlag_AF(I2C1);
+            return BENCH_ERR_NACK;
+        }
+    }
+    LL_I2C_ClearFlag_ADDR(I2C1);
+    for (uint16_t i = 0; i < len; i++) {
+        while (!LL_I2C_IsActiveFlag_TXE(I2C1));
+        LL_I2C_TransmitData8(I2C1, buf[i]);
+    }
+    while (!LL_I2C_IsActiveFlag_BTF(I2C1));
+    LL_I2C_GenerateStopCondition(I2C1);
+    return BENCH_OK;
+}
+
+static int I2C_CMSIS(uint8_t *buf, uint16_t len)
+{
+    I2C1->CR1 |= I2C_CR1_START;
+    while (!(I2C1->SR1 & I2C_SR1_SB));
+    I2C1->DR = BENCH_I2C_ADDR_W;
+    while (!(I2C1->SR1 & I2C_SR1_ADDR)) {
+        if (I2C1->SR1 & I2C_SR1_AF) {
+            I2C1->CR1 |= I2C_CR1_STOP;
+            I2C1->SR1 &= ~I2C_SR1_AF;
+            return BENCH_ERR_NACK;
+        }
+    }
+    (void)I2C1->SR1; (void)I2C1->SR2;
+    for (uint16_t i = 0; i < len; i++) {
+        while (!(I2C1->SR1 & I2C_SR1_TXE));
+        I2C1->DR = buf[i];
+    }
+    while (!(I2C1->SR1 & I2C_SR1_BTF));
+    I2C1->CR1 |= I2C_CR1_STOP;
+    return BENCH_OK;
+}
+
+static int I2C_REG(uint8_t *buf, uint16_t len)
+{
+    I2C1_CR1_REG |= B_I2C_START;
+    while (!(I2C1_SR1_REG & B_I2C_SB));
+    I2C1_DR_REG = BENCH_I2C_ADDR_W;
+    while (!(I2C1_SR1_REG & B_I2C_ADDR)) {
+        if (I2C1_SR1_REG & B_I2C_AF) {
+            I2C1_CR1_REG |= B_I2C_STOP;
+            I2C1_SR1_REG &= ~B_I2C_AF;
+            return BENCH_ERR_NACK;
+        }
+    }
+    (void)I2C1_SR1_REG; (void)I2C1_SR2_REG;
+    for (uint16_t i = 0; i < len; i++) {
+        while (!(I2C1_SR1_REG & B_I2C_TXE));
+        I2C1_DR_REG = buf[i];
+    }
+    while (!(I2C1_SR1_REG & B_I2C_BTF));
+    I2C1_CR1_REG |= B_I2C_STOP;
+    return BENCH_OK;
+}
+
+#if BENCH_HAS_ASM
+static int I2C_ASM(uint8_t *buf, uint16_t len)
+{
+    uint32_t n = len;
+    int32_t  rc;
+    __asm volatile (
+        "LDR   r2, =%c[base]    \n\t"   /* r2 = I2C1 베이스              */
+        "LDR   r3, [r2, #0x00]  \n\t"
+        "ORR   r3, r3, #0x100   \n\t"   /* CR1 |= START(bit8)            */
+        "STR   r3, [r2, #0x00]  \n\t"
+        "1:                     \n\t"
+        "LDR   r3, [r2, #0x14]  \n\t"   /* SR1.SB 대기                   */
+        "TST   r3, #0x01        \n\t"
+        "BEQ   1b               \n\t"
+        "MOV   r3, %[addr]      \n\t"
+        "STR   r3, [r2, #0x10]  \n\t"   /* DR = 주소+W                   */
+        "2:                     \n\t"
+        "LDR   r3, [r2, #0x14]  \n\t"   /* SR1: AF(bit10)면 NACK 처리    */
+        "TST   r3, #0x400       \n\t"
+        "BNE   5f               \n\t"
+        "TST   r3, #0x02        \n\t"   /* ADDR(bit1) 대기 (SR1 읽음)    */
+        "BEQ   2b               \n\t"
+        "LDR   r3, [r2, #0x18]  \n\t"   /* SR2 읽기 → ADDR 클리어        */
+        "3:                     \n\t"
+        "LDR   r3, [r2, #0x14]  \n\t"   /* SR1.TXE(bit7) 대기            */
+        "TST   r3, #0x80        \n\t"
+        "BEQ   3b               \n\t"
+        "LDRB  r3, [%[p]], #1   \n\t"
+        "STR   r3, [r2, #0x10]  \n\t"   /* DR = *p++                     */
+        "SUBS  %[n], %[n], #1   \n\t"
+        "BNE   3b               \n\t"
+        "4:                     \n\t"
+        "LDR   r3, [r2, #0x14]  \n\t"   /* SR1.BTF(bit2) 대기            */
+        "TST   r3, #0x04        \n\t"
+        "BEQ   4b               \n\t"
+        "MOV   %[rc], #0        \n\t"
+        "B     6f               \n\t"
+        "5:                     \n\t"
+        "BIC   r3, r3, #0x400   \n\t"   /* SR1 &= ~AF                    */
+        "STR   r3, [r2, #0x14]  \n\t"
+        "MVN   %[rc], #0        \n\t"   /* rc = -1 (BENCH_ERR_NACK)      */
+        "6:                     \n\t"
+        "LDR   r3, [r2, #0x00]  \n\t"
+        "ORR   r3, r3, #0x200   \n\t"   /* CR1 |= STOP(bit9)             */
+        "STR   r3, [r2, #0x00]  \n\t"
+        : [rc] "=&r"(rc), [p] "+r"(buf), [n] "+r"(n)
+        : [base] "i"(I2C1_BASE_ADDR), [addr] "i"(BENCH_I2C_ADDR_W)
+        : "r2", "r3", "cc", "memory"
+    );
+    return rc;
+}
+#endif
+
+/* =========================================================================
+ * USART1 송신 : (TXE → DR) × len → TC
+ * =========================================================================*/
+static int UART_HAL(uint8_t *buf, uint16_t len)
+{
+    return HAL_UART_Transmit(&huart1, buf, len, HAL_TIMEOUT_MS) == HAL_OK ? BENCH_OK : BENCH_ERR_NACK;
+}
+
+static int UART_LL(uint8_t *buf, uint16_t len)
+{
+    for (uint16_t i = 0; i < len; i++) {
+        while (!LL_USART_IsActiveFlag_TXE(USART1));
+        LL_USART_TransmitData8(USART1, buf[i]);
+    }
+    while (!LL_USART_IsActiveFlag_TC(USART1));
+    return BENCH_OK;
+}
+
+static int UART_CMSIS(uint8_t *buf, uint16_t len)
+{
+    for (uint16_t i = 0; i < len; i++) {
+        while (!(USART1->SR & USART_SR_TXE));
+        USART1->DR = buf[i];
+    }
+    while (!(USART1->SR & USART_SR_TC));
+    return BENCH_OK;
+}
+
+static int UART_REG(uint8_t *buf, uint16_t len)
+{
+    for (uint16_t i = 0; i < len; i++) {
+        while (!(USART1_SR_REG & B_UART_TXE));
+        USART1_DR_REG = buf[i];
+    }
+    while (!(USART1_SR_REG & B_UART_TC));
+    return BENCH_OK;
+}
+
+#if BENCH_HAS_ASM
+static int UART_ASM(uint8_t *buf, uint16_t len)
+{
+    uint32_t n = len;
+    __asm volatile (
+        "LDR   r2, =%c[base]    \n\t"   /* r2 = USART1 베이스            */
+        "1:                     \n\t"
+        "LDR   r3, [r2, #0x00]  \n\t"   /* SR.TXE(bit7) 대기             */
+        "TST   r3, #0x80        \n\t"
+        "BEQ   1b               \n\t"
+        "LDRB  r3, [%[p]], #1   \n\t"
+        "STR   r3, [r2, #0x04]  \n\t"   /* DR = *p++                     */
+        "SUBS  %[n], %[n], #1   \n\t"
+        "BNE   1b               \n\t"
+        "2:                     \n\t"
+        "LDR   r3, [r2, #0x00]  \n\t"   /* SR.TC(bit6) 대기              */
+        "TST   r3, #0x40        \n\t"
+        "BEQ   2b               \n\t"
+        : [p] "+r"(buf), [n] "+r"(n)
+        : [base] "i"(USART1_BASE_ADDR)
+        : "r2", "r3", "cc", "memory"
+    );
+    return BENCH_OK;
+}
+#endif
+
+/* =========================================================================
+ * ADC1 단일 변환 × (len/2) : SWSTART → EOC → DR 읽기(EOC 클리어)
+ *   채널/샘플링 시간은 main_bench.c 초기화 (CH0, 3 사이클)
+ * =========================================================================*/
+static int ADC_HAL(uint8_t *buf, uint16_t len)
+{
+    uint16_t *s = (uint16_t *)buf;
+    for (uint16_t i = 0; i < len / 2; i++) {
+        HAL_ADC_Start(&hadc1);
+        if (HAL_ADC_PollForConversion(&hadc1, HAL_TIMEOUT_MS) != HAL_OK) return BENCH_ERR_NACK;
+        s[i] = (uint16_t)HAL_ADC_GetValue(&hadc1);
+    }
+    return BENCH_OK;
+}
+
+static int ADC_LL(uint8_t *buf, uint16_t len)
+{
+    uint16_t *s = (uint16_t *)buf;
+    for (uint16_t i = 0; i < len / 2; i++) {
+        LL_ADC_REG_StartConversionSWStart(ADC1);
+        while (!LL_ADC_IsActiveFlag_EOCS(ADC1));
+        s[i] = LL_ADC_REG_ReadConversionData12(ADC1);
+    }
+    return BENCH_OK;
+}
+
+static int ADC_CMSIS(uint8_t *buf, uint16_t len)
+{
+    uint16_t *s = (uint16_t *)buf;
+    for (uint16_t i = 0; i < len / 2; i++) {
+        ADC1->CR2 |= ADC_CR2_SWSTART;
+        while (!(ADC1->SR & ADC_SR_EOC));
+        s[i] = (uint16_t)ADC1->DR;
+    }
+    return BENCH_OK;
+}
+
+static int ADC_REG(uint8_t *buf, uint16_t len)
+{
+    uint16_t *s = (uint16_t *)buf;
+    for (uint16_t i = 0; i < len / 2; i++) {
+        ADC1_CR2_REG |= B_ADC_SWSTART;
+        while (!(ADC1_SR_REG & B_ADC_EOC));
+        s[i] = (uint16_t)ADC1_DR_REG;
+    }
+    return BENCH_OK;
+}
+
+#if BENCH_HAS_ASM
+static int ADC_ASM(uint8_t *buf, uint16_t len)
+{
+    uint32_t n = len / 2;
+    __asm volatile (
+        "LDR   r2, =%c[base]    \n\t"   /* r2 = ADC1 베이스              */
+        "1:                     \n\t"
+        "LDR   r3, [r2, #0x08]  \n\t"
+        "ORR   r3, r3, #0x40000000 \n\t" /* CR2 |= SWSTART(bit30)        */
+        "STR   r3, [r2, #0x08]  \n\t"
+        "2:                     \n\t"
+        "LDR   r3, [r2, #0x00]  \n\t"   /* SR.EOC(bit1) 대기             */
+        "TST   r3, #0x02        \n\t"
+        "BEQ   2b               \n\t"
+        "LDR   r3, [r2, #0x4C]  \n\t"   /* DR 읽기 → EOC 클리어          */
+        "STRH  r3, [%[p]], #2   \n\t"   /* *s++ = r3                     */
+        "SUBS  %[n], %[n], #1   \n\t"
+        "BNE   1b               \n\t"
+        : [p] "+r"(buf), [n] "+r"(n)
+        : [base] "i"(ADC1_BASE_ADDR)
+        : "r2", "r3", "cc", "memory"
+    );
+    return BENCH_OK;
+}
+#else
+#define SPI_ASM     NULL
+#define I2C_ASM     NULL
+#define UART_ASM    NULL
+#define ADC_ASM     NULL
+#endif
+
+const BenchFn_t bench_fn[OP_COUNT][TIER_COUNT] = {
+    [OP_SPI_BURST] = { SPI_HAL,  SPI_LL,  SPI_CMSIS,  SPI_REG,  SPI_ASM  },
+    [OP_I2C_BYTE]  = { I2C_HAL,  I2C_LL,  I2C_CMSIS,  I2C_REG,  I2C_ASM  },
+    [OP_I2C_BLOCK] = { I2C_HAL,  I2C_LL,  I2C_CMSIS,  I2C_REG,  I2C_ASM  },
+    [OP_UART_TX]   = { UART_HAL, UART_LL, UART_CMSIS, UART_REG, UART_ASM },
+    [OP_ADC]       = { ADC_HAL,  ADC_LL,  ADC_CMSIS,  ADC_REG,  ADC_ASM  },
+};
@@ -0,0 +1,154 @@
+/**
+  ******************************************************************************
+  * @file    bench_host.c
+  * @brief   호스트 벤치마크 실행기 - 방식별 출력 검증 + 접근 횟수 표 + 기준선 비교 (CI용)
+  *
+  * [검사]
+  *   1. 방식마다 동작 1회 → 모의 주변장치 캡처가 기대값과 같은지
+  *      SPI/UART: Bench_Fill 바이트열, I2C: START 주소 데이터 STOP, ADC: Sim_AdcSample 순서
+  *   2. I2C는 장치 없음(NACK)도 → BENCH_ERR_NACK 리턴 + STOP으로 끝나는지
+  *   3. Bench_Run 으로 접근 횟수 측정 → CSV + 표 (bench.c, 보드와 같은 형식)
+  *   4. -c 기준선.csv : 방식별 중앙값이 기준선보다 늘면 실패
+  *
+  * 종료 코드: 0 = 통과, 1 = 검증/회귀 실패
+  ******************************************************************************
+  */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "bench.h"
+
+SPI_HandleTypeDef  hspi2  = { SPI2 };
+I2C_HandleTypeDef  hi2c1  = { I2C1 };
+UART_HandleTypeDef huart1 = { USART1 };
+ADC_HandleTypeDef  hadc1  = { ADC1 };
+
+static const SimPort_t op_port[OP_COUNT] = {
+    [OP_SPI_BURST] = SIM_SPI2,
+    [OP_I2C_BYTE]  = SIM_I2C1,
+    [OP_I2C_BLOCK] = SIM_I2C1,
+    [OP_UART_TX]   = SIM_USART1,
+    [OP_ADC]       = SIM_ADC1,
+};
+
+static int is_i2c(BenchOp_t op)
+{
+    return op == OP_I2C_BYTE || op == OP_I2C_BLOCK;
+}
+
+/* 기대 캡처 (ADC는 캡처 대신 버퍼 내용) */
+static uint16_t expected(BenchOp_t op, uint16_t *exp)
+{
+    uint8_t  buf[BENCH_BUF_SIZE];
+    uint16_t len = bench_op[op].len, n = 0;
+
+    if (op == OP_ADC) {
+        for (uint16_t i = 0; i < len / 2; i++) exp[n++] = Sim_AdcSample(i);
+        return n;
+    }
+    Bench_Fill(buf, len);
+    if (is_i2c(op)) {
+        exp[n++] = SIM_EV_START;
+        exp[n++] = SIM_EV_ADDR | BENCH_I2C_ADDR_W;
+    }
+    for (uint16_t i = 0; i < len; i++) exp[n++] = buf[i];
+    if (is_i2c(op)) exp[n++] = SIM_EV_STOP;
+    return n;
+}
+
+static int Verify(BenchOp_t op, BenchTier_t tier)
+{
+    uint8_t  buf[BENCH_BUF_SIZE] __attribute__((aligned(4)));
+    uint16_t exp[BENCH_BUF_SIZE + 3], n_exp, n_got;
+    const uint16_t *got;
+    uint16_t len = bench_op[op].len;
+    int rc;
+
+    Sim_Reset();
+    Bench_Fill(buf, len);
+    rc = bench_fn[op][tier](buf, len);
+    n_exp = expected(op, exp);
+
+    if (op == OP_ADC) {
+        for (uint16_t i = 0; i < n_exp; i++) {
+            if (((uint16_t *)buf)[i] != exp[i]) {
+                printf("# FAIL %s/%s: 샘플 %u = %u (기대 %u)\n", bench_op[op].name, bench_tier_name[tier],
+                       i, ((uint16_t *)buf)[i], exp[i]);
+                return 0;
+            }
+        }
+    } else {
+        got = Sim_Capture(op_port[op], &n_got);
+        if (rc != BENCH_OK || n_got != n_exp || memcmp(got, exp, n_exp * sizeof(uint16_t)) != 0) {
+            printf("# FAIL %s/%s: rc %d, 캡처 %u개 (기대 %u개)\n", bench_op[op].name, bench_tier_name[tier],
+                   rc, n_got, n_exp);
+            return 0;
+        }
+    }
+
+    if (is_i2c(op)) {                               /* 장치 없음 → NACK + STOP */
+        Sim_Reset();
+        Sim_SetI2cDevice(BENCH_I2C_DEV + 1);
+        rc = bench_fn[op][tier](buf, len);
+        Sim_SetI2cDevice(BENCH_I2C_DEV);
+        got = Sim_Capture(SIM_I2C1, &n_got);
+        if (rc != BENCH_ERR_NACK || n_got != 3 || got[2] != SIM_EV_STOP) {
+            printf("# FAIL %s/%s: NACK 처리 (rc %d, 캡처 %u개)\n", bench_op[op].name, bench_tier_name[tier],
+                   rc, n_got);
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/* 기준선 CSV에서 중앙값 읽어 비교 → 늘어난 항목 수 */
+static int Check_Baseline(const char *path, BenchResult_t res[OP_COUNT][TIER_COUNT])
+{
+    char line[256], op[32], tier[16];
+    unsigned long med;
+    int worse = 0, seen = 0;
+    FILE *f = fopen(path, "r");
+
+    if (!f) { perror(path); return 1; }
+    while (fgets(line, sizeof(line), f)) {
+        if (sscanf(line, "bench,%31[^,],%15[^,],%*u,%*u,%*[^,],%*u,%lu", op, tier, &med) != 3) continue;
+        for (int o = 0; o < OP_COUNT; o++) {
+            for (int t = 0; t < TIER_COUNT; t++) {
+                if (strcmp(op, bench_op[o].name) || strcmp(tier, bench_tier_name[t]) || !bench_fn[o][t]) continue;
+                seen++;
+                if (res[o][t].med > med) {
+                    printf("# REGRESSION %s/%s: 중앙값 %lu → %lu\n", op, tier, med, (unsigned long)res[o][t].med);
+                    worse++;
+                }
+            }
+        }
+    }
+    fclose(f);
+    printf("# 기준선 %s: %d항목 비교, 증가 %d\n", path, seen, worse);
+    return worse;
+}
+
+int main(int argc, char **argv)
+{
+    static BenchResult_t res[OP_COUNT][TIER_COUNT];
+    const char *baseline = NULL;
+    int fail = 0;
+
+    if (argc == 3 && strcmp(argv[1], "-c") == 0) baseline = argv[2];
+    else if (argc != 1) {
+        fprintf(stderr, "사용법: %s [-c 기준선.csv]\n", argv[0]);
+        return 2;
+    }
+
+    Sim_Init();
+    for (int op = 0; op < OP_COUNT; op++)
+        for (int tier = 0; tier < TIER_COUNT; tier++)
+            if (bench_fn[op][tier] && !Verify((BenchOp_t)op, (BenchTier_t)tier)) fail++;
+
+    Sim_Reset();
+    Bench_RunAll(res);
+
+    if (baseline) fail += Check_Baseline(baseline, res);
+    printf("# %s\n", fail ? "FAIL" : "OK");
+    return fail ? 1 : 0;
+}
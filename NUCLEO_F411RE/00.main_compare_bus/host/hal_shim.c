@@ -0,0 +1,137 @@
+/**
+  ******************************************************************************
+  * @file    hal_shim.c
+  * @brief   호스트용 HAL 폴링 전송 최소 구현 - stm32f4xx_hal_{spi,i2c,uart,adc}.c 와 같은 레지스터 순서
+  *
+  *   HAL_SPI_Transmit        : SPE 확인 → (TXE → DR) × n → TXE → BSY → OVR 클리어
+  *   HAL_I2C_Master_Transmit : BUSY 대기 → PE 확인 → POS 해제 → START → SB → 주소 → ADDR/AF
+  *                             → ADDR 클리어 → (TXE/AF → DR, BTF면 1바이트 더) → BTF/AF → STOP
+  *   HAL_UART_Transmit       : (TXE → DR) × n → TC
+  *   HAL_ADC_Start           : ADON 확인 → EOC/OVR 클리어 → SWSTART
+  *   HAL_ADC_PollForConversion / HAL_ADC_GetValue : EOC → STRT/EOC 클리어 / DR
+  *
+  * 핸들 상태/락/HAL_GetTick 타임아웃은 없음 (SIM_SPIN_MAX 로 대신)
+  ******************************************************************************
+  */
+#include <stddef.h>
+#include "stm32_sim.h"
+
+#define WAIT_SET(cond)      do { uint32_t _n = 0; while (!(cond)) if (++_n > SIM_SPIN_MAX) return HAL_TIMEOUT; } while (0)
+
+/* ===== SPI ===== */
+HAL_StatusTypeDef HAL_SPI_Transmit(SPI_HandleTypeDef *h, uint8_t *p, uint16_t n, uint32_t timeout)
+{
+    SPI_TypeDef *s = h->Instance;
+    __IO uint32_t tmp;
+    (void)timeout;
+
+    if (p == NULL || n == 0) return HAL_ERROR;
+    if ((s->CR1 & SPI_CR1_SPE) != SPI_CR1_SPE) s->CR1 |= SPI_CR1_SPE;
+
+    if (n == 1) {                                   /* 1바이트는 TXE 확인 없이 */
+        *(__IO uint8_t *)&s->DR = *p++;
+        n--;
+    }
+    while (n > 0) {
+        WAIT_SET(s->SR & SPI_SR_TXE);
+        *(__IO uint8_t *)&s->DR = *p++;
+        n--;
+    }
+    WAIT_SET(s->SR & SPI_SR_TXE);
+    WAIT_SET(!(s->SR & SPI_SR_BSY));
+    tmp = s->DR;                                    /* __HAL_SPI_CLEAR_OVRFLAG */
+    tmp = s->SR;
+    (void)tmp;
+    return HAL_OK;
+}
+
+/* ===== I2C ===== */
+static HAL_StatusTypeDef I2C_Nack(I2C_TypeDef *i)
+{
+    i->CR1 |= I2C_CR1_STOP;
+    i->SR1 = ~I2C_SR1_AF;                           /* __HAL_I2C_CLEAR_FLAG(AF) */
+    return HAL_ERROR;
+}
+
+HAL_StatusTypeDef HAL_I2C_Master_Transmit(I2C_HandleTypeDef *h, uint16_t addr, uint8_t *p, uint16_t n, uint32_t timeout)
+{
+    I2C_TypeDef *i = h->Instance;
+    __IO uint32_t tmp;
+    (void)timeout;
+
+    WAIT_SET(!(i->SR2 & I2C_SR2_BUSY));
+    if ((i->CR1 & I2C_CR1_PE) != I2C_CR1_PE) i->CR1 |= I2C_CR1_PE;
+    i->CR1 &= ~I2C_CR1_POS;
+
+    i->CR1 |= I2C_CR1_START;                        /* I2C_MasterRequestWrite */
+    WAIT_SET(i->SR1 & I2C_SR1_SB);
+    i->DR = (uint8_t)addr;
+    for (uint32_t k = 0; !(i->SR1 & I2C_SR1_ADDR); k++) {
+        if (i->SR1 & I2C_SR1_AF) return I2C_Nack(i);
+        if (k > SIM_SPIN_MAX) return HAL_TIMEOUT;
+    }
+    tmp = i->SR1;                                   /* __HAL_I2C_CLEAR_ADDRFLAG */
+    tmp = i->SR2;
+    (void)tmp;
+
+    while (n > 0) {
+        for (uint32_t k = 0; !(i->SR1 & I2C_SR1_TXE); k++) {
+            if (i->SR1 & I2C_SR1_AF) return I2C_Nack(i);
+            if (k > SIM_SPIN_MAX) return HAL_TIMEOUT;
+        }
+        i->DR = *p++;
+        n--;
+        if ((i->SR1 & I2C_SR1_BTF) && n != 0) {
+            i->DR = *p++;
+            n--;
+        }
+        for (uint32_t k = 0; !(i->SR1 & I2C_SR1_BTF); k++) {
+            if (i->SR1 & I2C_SR1_AF) return I2C_Nack(i);
+            if (k > SIM_SPIN_MAX) return HAL_TIMEOUT;
+        }
+    }
+    i->CR1 |= I2C_CR1_STOP;
+    return HAL_OK;
+}
+
+/* ===== UART ===== */
+HAL_StatusTypeDef HAL_UART_Transmit(UART_HandleTypeDef *h, const uint8_t *p, uint16_t n, uint32_t timeout)
+{
+    USART_TypeDef *u = h->Instance;
+    (void)timeout;
+
+    if (p == NULL || n == 0) return HAL_ERROR;
+    while (n > 0) {
+        WAIT_SET(u->SR & USART_SR_TXE);
+        u->DR = (uint8_t)(*p++ & 0xFFU);
+        n--;
+    }
+    WAIT_SET(u->SR & USART_SR_TC);
+    return HAL_OK;
+}
+
+/* ===== ADC ===== */
+HAL_StatusTypeDef HAL_ADC_Start(ADC_HandleTypeDef *h)
+{
+    ADC_TypeDef *a = h->Instance;
+
+    if ((a->CR2 & ADC_CR2_ADON) != ADC_CR2_ADON) a->CR2 |= ADC_CR2_ADON;
+    a->SR = ~(ADC_SR_EOC | ADC_SR_OVR);
+    a->CR2 |= ADC_CR2_SWSTART;
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_ADC_PollForConversion(ADC_HandleTypeDef *h, uint32_t timeout)
+{
+    ADC_TypeDef *a = h->Instance;
+    (void)timeout;
+
+    WAIT_SET(a->SR & ADC_SR_EOC);
+    a->SR = ~(ADC_SR_STRT | ADC_SR_EOC);
+    return HAL_OK;
+}
+
+uint32_t HAL_ADC_GetValue(ADC_HandleTypeDef *h)
+{
+    return h->Instance->DR;
+}
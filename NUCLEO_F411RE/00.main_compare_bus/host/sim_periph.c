@@ -0,0 +1,242 @@
+/**
+  ******************************************************************************
+  * @file    sim_periph.c
+  * @brief   호스트 모의 주변장치 - 레지스터 접근을 페이지 폴트로 가로채 SPI2/I2C1/USART1/ADC1 흉내
+  *
+  * [접근 1번 처리]
+  *   1. 0x40000000~ 영역은 PROT_NONE → 읽기/쓰기 모두 SIGSEGV
+  *      (x86 페이지 폴트 오류 코드 bit1 = 쓰기)
+  *   2. 영역을 열고, 읽기면 읽기 전 동작(상태 비트 갱신, DR 읽기 부수효과) 수행
+  *   3. EFLAGS.TF 를 켜고 복귀 → 명령어 1개 실행 후 SIGTRAP
+  *   4. 쓰기였으면 이전/새 값으로 쓰기 동작(DR 캡처, START/STOP, SWSTART ...) 수행
+  *   5. TF 끄고 다시 PROT_NONE
+  *   → 펌웨어 코드는 그대로, 접근 1번 = 횟수 1 (BENCH_NOW)
+  *
+  * [모델] 전송은 즉시 끝남 (TXE/TC/BSY=0 항상 준비), 상태 비트 순서만 실제와 같게
+  *   SPI2   DR 쓰기 → 캡처, RXNE (읽지 않고 또 쓰면 OVR), DR 읽기 → RXNE/OVR 해제
+  *   I2C1   START → SB+BUSY, SB 중 DR 쓰기 → 주소 (장치면 ADDR, 아니면 AF)
+  *          SR2 읽기 → ADDR 해제 + TXE, DR 쓰기 → 캡처 + TXE+BTF, STOP → 버스 해제
+  *          SR1 쓰기는 rc_w0 (오류 비트만 0으로 지워짐)
+  *   USART1 DR 쓰기 → 캡처
+  *   ADC1   CR2.SWSTART → DR = Sim_AdcSample(k++) + EOC, DR 읽기 → EOC 해제, SR 쓰기는 rc_w0
+  ******************************************************************************
+  */
+#define _GNU_SOURCE
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <ucontext.h>
+#include "stm32_sim.h"
+
+#define SIM_BASE        0x40000000UL
+#define SIM_SIZE        0x00014000UL        /* APB1 ~ ADC1 */
+#define BLOCK_MASK      0x3FFUL             /* 주변장치 1개 = 1KB */
+#define EFL_TF          0x100
+#define PF_WRITE        0x2
+
+#define I2C_SR1_RCW0    0xDF00UL            /* 오류 비트 (AF, ARLO, BERR ...) */
+#define ADC_SR_RCW0     0x3FUL
+
+typedef struct {
+    uint16_t buf[SIM_CAPTURE_MAX];
+    uint16_t n;
+} Capture_t;
+
+static uint8_t   *mem;
+static uint32_t   accesses;
+static uintptr_t  pend_addr;                /* 단일 스텝 중인 쓰기 (워드 정렬) */
+static uint32_t   pend_old;
+static int        pend_write;
+
+static Capture_t  cap[SIM_PORT_COUNT];
+static uint8_t    i2c_dev = 0x27;
+static uint8_t    i2c_addr_phase;
+static uint32_t   adc_k;
+
+static void cap_put(SimPort_t port, uint16_t v)
+{
+    if (cap[port].n < SIM_CAPTURE_MAX) cap[port].buf[cap[port].n++] = v;
+}
+
+static volatile uint32_t *reg(uintptr_t addr)
+{
+    return (volatile uint32_t *)addr;
+}
+
+/* =========================================================================
+ * 읽기 전 / 쓰기 후 동작
+ * =========================================================================*/
+static void On_Read(uintptr_t a)
+{
+    uintptr_t base = a & ~BLOCK_MASK, off = a & BLOCK_MASK;
+
+    if (base == SPI2_BASE && off == 0x0C) {
+        SPI2->SR &= ~(SPI_SR_RXNE | SPI_SR_OVR);
+    }
+    else if (base == I2C1_BASE && off == 0x18) {
+        if (I2C1->SR1 & I2C_SR1_ADDR) {             /* ADDR 클리어 (SR1 → SR2 읽기) */
+            I2C1->SR1 = (I2C1->SR1 & ~I2C_SR1_ADDR) | I2C_SR1_TXE;
+            I2C1->SR2 |= I2C_SR2_TRA;
+        }
+    }
+    else if (base == ADC1_BASE && off == 0x4C) {
+        ADC1->SR &= ~ADC_SR_EOC;
+    }
+}
+
+static void On_Write(uintptr_t a, uint32_t old, uint32_t v)
+{
+    uintptr_t base = a & ~BLOCK_MASK, off = a & BLOCK_MASK;
+
+    if (base == SPI2_BASE && off == 0x0C) {
+        cap_put(SIM_SPI2, (uint16_t)(v & 0xFF));
+        if (SPI2->SR & SPI_SR_RXNE) SPI2->SR |= SPI_SR_OVR;
+        SPI2->SR |= SPI_SR_RXNE;
+    }
+    else if (base == I2C1_BASE && off == 0x00) {
+        if (v & I2C_CR1_START) {
+            I2C1->CR1 = v & ~I2C_CR1_START;         /* 하드웨어가 지움 */
+            I2C1->SR1 = (I2C1->SR1 & ~(I2C_SR1_BTF | I2C_SR1_TXE)) | I2C_SR1_SB;
+            I2C1->SR2 |= I2C_SR2_MSL | I2C_SR2_BUSY;
+            i2c_addr_phase = 1;
+            cap_put(SIM_I2C1, SIM_EV_START);
+        }
+        if (v & I2C_CR1_STOP) {
+            I2C1->CR1 = I2C1->CR1 & ~I2C_CR1_STOP;
+            I2C1->SR1 &= ~(I2C_SR1_SB | I2C_SR1_ADDR | I2C_SR1_BTF | I2C_SR1_TXE);
+            I2C1->SR2 = 0;
+            i2c_addr_phase = 0;
+            cap_put(SIM_I2C1, SIM_EV_STOP);
+        }
+    }
+    else if (base == I2C1_BASE && off == 0x10) {
+        uint8_t b = (uint8_t)v;
+        if (i2c_addr_phase && (I2C1->SR1 & I2C_SR1_SB)) {
+            I2C1->SR1 &= ~I2C_SR1_SB;
+            I2C1->SR1 |= ((b >> 1) == i2c_dev) ? I2C_SR1_ADDR : I2C_SR1_AF;
+            i2c_addr_phase = 0;
+            cap_put(SIM_I2C1, (uint16_t)(SIM_EV_ADDR | b));
+        } else {
+            cap_put(SIM_I2C1, b);
+            I2C1->SR1 |= I2C_SR1_TXE | I2C_SR1_BTF;
+        }
+    }
+    else if (base == I2C1_BASE && off == 0x14) {
+        I2C1->SR1 = old & (v | ~I2C_SR1_RCW0);
+    }
+    else if (base == USART1_BASE && off == 0x04) {
+        cap_put(SIM_USART1, (uint16_t)(v & 0xFF));
+    }
+    else if (base == ADC1_BASE && off == 0x08) {
+        if ((v & ADC_CR2_SWSTART) && (v & ADC_CR2_ADON)) {
+            ADC1->CR2 = v & ~ADC_CR2_SWSTART;
+            ADC1->DR  = Sim_AdcSample(adc_k++);
+            ADC1->SR |= ADC_SR_EOC | ADC_SR_STRT;
+        }
+    }
+    else if (base == ADC1_BASE && off == 0x00) {
+        ADC1->SR = old & (v | ~ADC_SR_RCW0);
+    }
+}
+
+/* =========================================================================
+ * 폴트 / 단일 스텝
+ * =========================================================================*/
+static void On_Segv(int sig, siginfo_t *si, void *ctx)
+{
+    ucontext_t *uc = (ucontext_t *)ctx;
+    uintptr_t a = (uintptr_t)si->si_addr;
+
+    if (a < SIM_BASE || a >= SIM_BASE + SIM_SIZE) {
+        signal(sig, SIG_DFL);                       /* 진짜 잘못된 접근 → 복귀 후 기본 동작 */
+        return;
+    }
+
+    accesses++;
+    pend_addr  = a & ~(uintptr_t)3;
+    pend_write = (uc->uc_mcontext.gregs[REG_ERR] & PF_WRITE) != 0;
+
+    mprotect(mem, SIM_SIZE, PROT_READ | PROT_WRITE);
+    if (pend_write) pend_old = *reg(pend_addr);
+    else            On_Read(pend_addr);
+
+    uc->uc_mcontext.gregs[REG_EFL] |= EFL_TF;
+}
+
+static void On_Trap(int sig, siginfo_t *si, void *ctx)
+{
+    ucontext_t *uc = (ucontext_t *)ctx;
+    (void)sig; (void)si;
+
+    uc->uc_mcontext.gregs[REG_EFL] &= ~EFL_TF;
+    if (pend_write) On_Write(pend_addr, pend_old, *reg(pend_addr));
+    pend_write = 0;
+    mprotect(mem, SIM_SIZE, PROT_NONE);
+}
+
+/* =========================================================================
+ * API
+ * =========================================================================*/
+void Sim_Init(void)
+{
+    struct sigaction sa;
+
+    mem = mmap((void *)SIM_BASE, SIM_SIZE, PROT_READ | PROT_WRITE,
+               MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0);
+    if (mem != (uint8_t *)SIM_BASE) {
+        perror("sim: 0x40000000 매핑 실패");
+        exit(2);
+    }
+
+    memset(&sa, 0, sizeof(sa));
+    sa.sa_flags = SA_SIGINFO;
+    sa.sa_sigaction = On_Segv;
+    sigaction(SIGSEGV, &sa, NULL);
+    sa.sa_sigaction = On_Trap;
+    sigaction(SIGTRAP, &sa, NULL);
+
+    Sim_Reset();
+}
+
+void Sim_Reset(void)
+{
+    mprotect(mem, SIM_SIZE, PROT_READ | PROT_WRITE);
+    memset(mem, 0, SIM_SIZE);
+
+    /* main_bench.c 초기화가 끝난 상태 */
+    SPI2->CR1   = SPI_CR1_MSTR | SPI_CR1_SPE;
+    SPI2->SR    = SPI_SR_TXE;
+    I2C1->CR1   = I2C_CR1_PE;
+    USART1->CR1 = USART_CR1_UE | USART_CR1_TE;
+    USART1->SR  = USART_SR_TXE | USART_SR_TC;
+    ADC1->CR2   = ADC_CR2_ADON;
+
+    memset(cap, 0, sizeof(cap));
+    i2c_addr_phase = 0;
+    adc_k = 0;
+    accesses = 0;
+    mprotect(mem, SIM_SIZE, PROT_NONE);
+}
+
+uint32_t Sim_Accesses(void)
+{
+    return accesses;
+}
+
+const uint16_t *Sim_Capture(SimPort_t port, uint16_t *n)
+{
+    *n = cap[port].n;
+    return cap[port].buf;
+}
+
+void Sim_SetI2cDevice(uint8_t addr7)
+{
+    i2c_dev = addr7;
+}
+
+uint16_t Sim_AdcSample(uint32_t k)
+{
+    return (uint16_t)((k * 2654435761UL >> 7) & 0x0FFF);     /* 12비트 의사 난수 */
+}
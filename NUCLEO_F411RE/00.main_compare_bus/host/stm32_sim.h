@@ -0,0 +1,157 @@
+/**
+  ******************************************************************************
+  * @file    stm32_sim.h
+  * @brief   호스트용 STM32F411 최소 정의 - 레지스터 구조체, LL 인라인, HAL 최소 구현
+  *
+  * [원리]
+  *   SPI2/I2C1/USART1/ADC1 을 보드와 같은 주소(0x4000xxxx)에 접근 금지 페이지로 매핑
+  *   → 레지스터를 읽거나 쓸 때마다 SIGSEGV → sim_periph.c 가 주변장치 동작을 흉내 냄
+  *   → CMSIS 구조체(SPI2->SR)와 REG 절대주소(*(volatile uint32_t *)0x40003808)가 그대로 동작
+  *
+  * [LL / HAL]
+  *   LL  : stm32f4xx_ll_*.h 의 해당 함수와 같은 레지스터 접근 (인라인)
+  *   HAL : hal_shim.c - stm32f4xx_hal_*.c 의 폴링 전송과 같은 레지스터 순서,
+  *         상태 기계/락/타임아웃 계산은 없음 → HAL 오버헤드는 보드에서만 의미 있음
+  *
+  * Linux x86-64 + gcc 전용 (폴트 주소/단일 스텝에 ucontext 사용)
+  ******************************************************************************
+  */
+#ifndef STM32_SIM_H
+#define STM32_SIM_H
+
+#include <stdint.h>
+
+#define __IO    volatile
+
+/* ── 레지스터 구조체 (stm32f411xe.h 와 같은 배치) ─────────────────────── */
+typedef struct {
+    __IO uint32_t CR1, CR2, SR, DR, CRCPR, RXCRCR, TXCRCR, I2SCFGR, I2SPR;
+} SPI_TypeDef;
+
+typedef struct {
+    __IO uint32_t CR1, CR2, OAR1, OAR2, DR, SR1, SR2, CCR, TRISE, FLTR;
+} I2C_TypeDef;
+
+typedef struct {
+    __IO uint32_t SR, DR, BRR, CR1, CR2, CR3, GTPR;
+} USART_TypeDef;
+
+typedef struct {
+    __IO uint32_t SR, CR1, CR2, SMPR1, SMPR2, JOFR1, JOFR2, JOFR3, JOFR4;
+    __IO uint32_t HTR, LTR, SQR1, SQR2, SQR3, JSQR, JDR1, JDR2, JDR3, JDR4, DR;
+} ADC_TypeDef;
+
+#define SPI2_BASE       0x40003800UL
+#define I2C1_BASE       0x40005400UL
+#define USART1_BASE     0x40011000UL
+#define ADC1_BASE       0x40012000UL
+
+#define SPI2            ((SPI_TypeDef *)SPI2_BASE)
+#define I2C1            ((I2C_TypeDef *)I2C1_BASE)
+#define USART1          ((USART_TypeDef *)USART1_BASE)
+#define ADC1            ((ADC_TypeDef *)ADC1_BASE)
+
+/* ── 비트 ──────────────────────────────────────────────────────────────── */
+#define SPI_CR1_MSTR        (1U << 2)
+#define SPI_CR1_SPE         (1U << 6)
+#define SPI_SR_RXNE         (1U << 0)
+#define SPI_SR_TXE          (1U << 1)
+#define SPI_SR_OVR          (1U << 6)
+#define SPI_SR_BSY          (1U << 7)
+
+#define I2C_CR1_PE          (1U << 0)
+#define I2C_CR1_START       (1U << 8)
+#define I2C_CR1_STOP        (1U << 9)
+#define I2C_CR1_ACK         (1U << 10)
+#define I2C_CR1_POS         (1U << 11)
+#define I2C_SR1_SB          (1U << 0)
+#define I2C_SR1_ADDR        (1U << 1)
+#define I2C_SR1_BTF         (1U << 2)
+#define I2C_SR1_TXE         (1U << 7)
+#define I2C_SR1_AF          (1U << 10)
+#define I2C_SR2_MSL         (1U << 0)
+#define I2C_SR2_BUSY        (1U << 1)
+#define I2C_SR2_TRA         (1U << 2)
+
+#define USART_SR_TC         (1U << 6)
+#define USART_SR_TXE        (1U << 7)
+#define USART_CR1_TE        (1U << 3)
+#define USART_CR1_UE        (1U << 13)
+
+#define ADC_SR_EOC          (1U << 1)
+#define ADC_SR_STRT         (1U << 4)
+#define ADC_SR_OVR          (1U << 5)
+#define ADC_CR2_ADON        (1U << 0)
+#define ADC_CR2_SWSTART     (1U << 30)
+
+/* ── LL (stm32f4xx_ll_*.h 와 같은 접근) ────────────────────────────────── */
+static inline uint32_t LL_SPI_IsActiveFlag_TXE(SPI_TypeDef *s) { return (s->SR & SPI_SR_TXE) == SPI_SR_TXE; }
+static inline uint32_t LL_SPI_IsActiveFlag_BSY(SPI_TypeDef *s) { return (s->SR & SPI_SR_BSY) == SPI_SR_BSY; }
+static inline void LL_SPI_TransmitData8(SPI_TypeDef *s, uint8_t d) { *((__IO uint8_t *)&s->DR) = d; }
+static inline void LL_SPI_ClearFlag_OVR(SPI_TypeDef *s)
+{
+    __IO uint32_t tmp;
+    tmp = s->DR;
+    tmp = s->SR;
+    (void)tmp;
+}
+
+static inline void LL_I2C_GenerateStartCondition(I2C_TypeDef *i) { i->CR1 |= I2C_CR1_START; }
+static inline void LL_I2C_GenerateStopCondition(I2C_TypeDef *i)  { i->CR1 |= I2C_CR1_STOP; }
+static inline uint32_t LL_I2C_IsActiveFlag_SB(I2C_TypeDef *i)   { return (i->SR1 & I2C_SR1_SB) == I2C_SR1_SB; }
+static inline uint32_t LL_I2C_IsActiveFlag_ADDR(I2C_TypeDef *i) { return (i->SR1 & I2C_SR1_ADDR) == I2C_SR1_ADDR; }
+static inline uint32_t LL_I2C_IsActiveFlag_BTF(I2C_TypeDef *i)  { return (i->SR1 & I2C_SR1_BTF) == I2C_SR1_BTF; }
+static inline uint32_t LL_I2C_IsActiveFlag_TXE(I2C_TypeDef *i)  { return (i->SR1 & I2C_SR1_TXE) == I2C_SR1_TXE; }
+static inline uint32_t LL_I2C_IsActiveFlag_AF(I2C_TypeDef *i)   { return (i->SR1 & I2C_SR1_AF) == I2C_SR1_AF; }
+static inline void LL_I2C_ClearFlag_AF(I2C_TypeDef *i) { i->SR1 &= ~I2C_SR1_AF; }
+static inline void LL_I2C_ClearFlag_ADDR(I2C_TypeDef *i)
+{
+    __IO uint32_t tmp;
+    tmp = i->SR1;
+    tmp = i->SR2;
+    (void)tmp;
+}
+static inline void LL_I2C_TransmitData8(I2C_TypeDef *i, uint8_t d) { i->DR = d; }
+
+static inline uint32_t LL_USART_IsActiveFlag_TXE(USART_TypeDef *u) { return (u->SR & USART_SR_TXE) == USART_SR_TXE; }
+static inline uint32_t LL_USART_IsActiveFlag_TC(USART_TypeDef *u)  { return (u->SR & USART_SR_TC) == USART_SR_TC; }
+static inline void LL_USART_TransmitData8(USART_TypeDef *u, uint8_t d) { u->DR = d; }
+
+static inline void LL_ADC_REG_StartConversionSWStart(ADC_TypeDef *a) { a->CR2 |= ADC_CR2_SWSTART; }
+static inline uint32_t LL_ADC_IsActiveFlag_EOCS(ADC_TypeDef *a) { return (a->SR & ADC_SR_EOC) == ADC_SR_EOC; }
+static inline uint16_t LL_ADC_REG_ReadConversionData12(ADC_TypeDef *a) { return (uint16_t)(a->DR & 0x0FFFU); }
+
+/* ── HAL 최소 (hal_shim.c) ─────────────────────────────────────────────── */
+typedef enum { HAL_OK = 0, HAL_ERROR, HAL_BUSY, HAL_TIMEOUT } HAL_StatusTypeDef;
+
+typedef struct { SPI_TypeDef   *Instance; } SPI_HandleTypeDef;
+typedef struct { I2C_TypeDef   *Instance; } I2C_HandleTypeDef;
+typedef struct { USART_TypeDef *Instance; } UART_HandleTypeDef;
+typedef struct { ADC_TypeDef   *Instance; } ADC_HandleTypeDef;
+
+HAL_StatusTypeDef HAL_SPI_Transmit(SPI_HandleTypeDef *h, uint8_t *p, uint16_t n, uint32_t timeout);
+HAL_StatusTypeDef HAL_I2C_Master_Transmit(I2C_HandleTypeDef *h, uint16_t addr, uint8_t *p, uint16_t n, uint32_t timeout);
+HAL_StatusTypeDef HAL_UART_Transmit(UART_HandleTypeDef *h, const uint8_t *p, uint16_t n, uint32_t timeout);
+HAL_StatusTypeDef HAL_ADC_Start(ADC_HandleTypeDef *h);
+HAL_StatusTypeDef HAL_ADC_PollForConversion(ADC_HandleTypeDef *h, uint32_t timeout);
+uint32_t          HAL_ADC_GetValue(ADC_HandleTypeDef *h);
+
+/* ── 모의 주변장치 (sim_periph.c) ──────────────────────────────────────── */
+typedef enum { SIM_SPI2 = 0, SIM_I2C1, SIM_USART1, SIM_ADC1, SIM_PORT_COUNT } SimPort_t;
+
+/* 캡처 기록: 데이터 바이트 그대로, I2C 조건은 아래 값 */
+#define SIM_EV_START        0x100
+#define SIM_EV_ADDR         0x200       /* | 주소 바이트 */
+#define SIM_EV_STOP         0x300
+
+#define SIM_CAPTURE_MAX     512
+#define SIM_SPIN_MAX        100000      /* HAL 최소 구현의 플래그 대기 상한 (타임아웃 대신) */
+
+void            Sim_Init(void);
+void            Sim_Reset(void);                        /* 레지스터 초기값 + 캡처/접근 횟수 비움 */
+uint32_t        Sim_Accesses(void);                     /* 레지스터 접근 횟수 (BENCH_NOW) */
+const uint16_t *Sim_Capture(SimPort_t port, uint16_t *n);
+void            Sim_SetI2cDevice(uint8_t addr7);        /* ACK하는 7비트 주소 (기본 BENCH_I2C_DEV) */
+uint16_t        Sim_AdcSample(uint32_t k);              /* k번째 변환 결과 (기대값 계산용) */
+
+#endif /* STM32_SIM_H */
@@ -0,0 +1,227 @@
+/**
+  ******************************************************************************
+  * @file    main_bench.c
+  * @brief   버스 주변장치 5가지 접근 방식 DWT 벤치마크 - 보드용 main
+  * @board   NUCLEO-F411RE
+  * @uart    USART2 PA2(TX) 115200bps → ST-Link Virtual COM (결과 출력)
+  * @sysclk  84MHz (APB1 42MHz, APB2 84MHz)
+  *
+  * [측정 대상]
+  *   SPI2   PB13(SCK) PB15(MOSI)  /2 = 21MHz   → 바이트당 버스 하한 32 cyc
+  *   I2C1   PB8(SCL)  PB9(SDA)    400kHz       → 바이트당 9클럭 ≈ 1890 cyc
+  *          PCF8574 CLCD 모듈 (0x27, SET2와 같은 배선) - 없으면 i2c는 nack
+  *   USART1 PA9(TX)               115200bps    → 바이트당 10비트 ≈ 7292 cyc
+  *   ADC1   PA0(IN0)  PCLK2/4 = 21MHz, 3+12 ADCCLK → 샘플당 60 cyc (30 cyc/B)
+  *
+  * [CubeMX 설정] SPI2 Transmit Only Master, I2C1 Fast Mode, USART1 Asynchronous,
+  *               ADC1 IN0 - 아래 MX_*_Init 과 같은 값 (MspInit 은 CubeMX 생성 파일)
+  *
+  * [출력] bench,... CSV 줄 + 방식별 바이트당 중앙값 표 (bench.c)
+  *        B1(PC13) 누르면 다시 측정
+  *
+  * [사용법] bench.c, bench_ops.c, bench.h 를 Core/Src·Core/Inc 에 추가,
+  *          이 파일을 Core/Src/main.c 로 복사 후 빌드
+  *          Project Manager → Advanced Settings 에서 SPI/I2C/USART/ADC 드라이버 LL 헤더 포함
+  ******************************************************************************
+  */
+#include "main.h"
+#include "bench.h"
+#include <stdio.h>
+
+SPI_HandleTypeDef  hspi2;
+I2C_HandleTypeDef  hi2c1;
+UART_HandleTypeDef huart1;
+UART_HandleTypeDef huart2;
+ADC_HandleTypeDef  hadc1;
+
+static BenchResult_t results[OP_COUNT][TIER_COUNT];
+
+void SystemClock_Config(void);
+static void MX_GPIO_Init(void);
+static void MX_USART2_UART_Init(void);
+static void MX_USART1_UART_Init(void);
+static void MX_SPI2_Init(void);
+static void MX_I2C1_Init(void);
+static void MX_ADC1_Init(void);
+static void DWT_Init(void);
+
+#ifdef __GNUC__
+int __io_putchar(int ch)
+{
+    HAL_UART_Transmit(&huart2, (uint8_t *)&ch, 1, 0xFFFF);
+    return ch;
+}
+#endif
+
+int main(void)
+{
+    HAL_Init();
+    SystemClock_Config();
+    MX_GPIO_Init();
+    MX_USART2_UART_Init();
+    MX_USART1_UART_Init();
+    MX_SPI2_Init();
+    MX_I2C1_Init();
+    MX_ADC1_Init();
+    DWT_Init();
+
+    /* HAL 이외 방식은 켜진 주변장치를 가정 (HAL은 첫 호출에서 켬) */
+    __HAL_SPI_ENABLE(&hspi2);
+    __HAL_ADC_ENABLE(&hadc1);
+    HAL_Delay(200);
+
+    while (1)
+    {
+        printf("\r\n[BUS BENCH] NUCLEO-F411RE 84MHz | %d회 측정, 최소/중앙/최대\r\n", BENCH_RUNS);
+        printf("SPI2 21MHz, I2C1 400kHz (0x%02X), USART1 115200, ADC1 IN0 3cyc\r\n\r\n", BENCH_I2C_DEV);
+
+        Bench_RunAll(results);
+
+        printf("\r\n[버스 하한, cyc/B] spi 32 | i2c 1890 | uart 7292 | adc 30\r\n");
+        printf("[B1] 다시 측정\r\n");
+
+        while (HAL_GPIO_ReadPin(GPIOC, GPIO_PIN_13) == GPIO_PIN_SET) HAL_Delay(10);
+        while (HAL_GPIO_ReadPin(GPIOC, GPIO_PIN_13) == GPIO_PIN_RESET) HAL_Delay(10);
+    }
+}
+
+/* =========================================================================
+ * DWT_Init
+ * =========================================================================*/
+static void DWT_Init(void)
+{
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0;
+    DWT->CTRL  |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+/* =========================================================================
+ * 주변장치 초기화
+ * =========================================================================*/
+void SystemClock_Config(void)
+{
+    RCC_OscInitTypeDef RCC_OscInitStruct = {0};
+    RCC_ClkInitTypeDef RCC_ClkInitStruct = {0};
+
+    __HAL_RCC_PWR_CLK_ENABLE();
+    __HAL_PWR_VOLTAGESCALING_CONFIG(PWR_REGULATOR_VOLTAGE_SCALE1);
+
+    RCC_OscInitStruct.OscillatorType      = RCC_OSCILLATORTYPE_HSI;
+    RCC_OscInitStruct.HSIState            = RCC_HSI_ON;
+    RCC_OscInitStruct.HSICalibrationValue = RCC_HSICALIBRATION_DEFAULT;
+    RCC_OscInitStruct.PLL.PLLState        = RCC_PLL_ON;
+    RCC_OscInitStruct.PLL.PLLSource       = RCC_PLLSOURCE_HSI;
+    RCC_OscInitStruct.PLL.PLLM            = 16;
+    RCC_OscInitStruct.PLL.PLLN            = 336;
+    RCC_OscInitStruct.PLL.PLLP            = RCC_PLLP_DIV4;
+    RCC_OscInitStruct.PLL.PLLQ            = 4;
+    if (HAL_RCC_OscConfig(&RCC_OscInitStruct) != HAL_OK) { Error_Handler(); }
+
+    RCC_ClkInitStruct.ClockType      = RCC_CLOCKTYPE_HCLK | RCC_CLOCKTYPE_SYSCLK
+                                     | RCC_CLOCKTYPE_PCLK1 | RCC_CLOCKTYPE_PCLK2;
+    RCC_ClkInitStruct.SYSCLKSource   = RCC_SYSCLKSOURCE_PLLCLK;
+    RCC_ClkInitStruct.AHBCLKDivider  = RCC_SYSCLK_DIV1;
+    RCC_ClkInitStruct.APB1CLKDivider = RCC_HCLK_DIV2;
+    RCC_ClkInitStruct.APB2CLKDivider = RCC_HCLK_DIV1;
+    if (HAL_RCC_ClockConfig(&RCC_ClkInitStruct, FLASH_LATENCY_2) != HAL_OK) { Error_Handler(); }
+}
+
+static void MX_GPIO_Init(void)
+{
+    GPIO_InitTypeDef GPIO_InitStruct = {0};
+    __HAL_RCC_GPIOC_CLK_ENABLE();
+    __HAL_RCC_GPIOA_CLK_ENABLE();
+    __HAL_RCC_GPIOB_CLK_ENABLE();
+
+    GPIO_InitStruct.Pin  = GPIO_PIN_13;   /* B1 */
+    GPIO_InitStruct.Mode = GPIO_MODE_INPUT;
+    GPIO_InitStruct.Pull = GPIO_NOPULL;
+    HAL_GPIO_Init(GPIOC, &GPIO_InitStruct);
+}
+
+static void MX_USART2_UART_Init(void)
+{
+    huart2.Instance          = USART2;
+    huart2.Init.BaudRate     = 115200;
+    huart2.Init.WordLength   = UART_WORDLENGTH_8B;
+    huart2.Init.StopBits     = UART_STOPBITS_1;
+    huart2.Init.Parity       = UART_PARITY_NONE;
+    huart2.Init.Mode         = UART_MODE_TX_RX;
+    huart2.Init.HwFlowCtl    = UART_HWCONTROL_NONE;
+    huart2.Init.OverSampling = UART_OVERSAMPLING_16;
+    if (HAL_UART_Init(&huart2) != HAL_OK) { Error_Handler(); }
+}
+
+static void MX_USART1_UART_Init(void)
+{
+    huart1.Instance          = USART1;
+    huart1.Init.BaudRate     = 115200;
+    huart1.Init.WordLength   = UART_WORDLENGTH_8B;
+    huart1.Init.StopBits     = UART_STOPBITS_1;
+    huart1.Init.Parity       = UART_PARITY_NONE;
+    huart1.Init.Mode         = UART_MODE_TX;
+    huart1.Init.HwFlowCtl    = UART_HWCONTROL_NONE;
+    huart1.Init.OverSampling = UART_OVERSAMPLING_16;
+    if (HAL_UART_Init(&huart1) != HAL_OK) { Error_Handler(); }
+}
+
+static void MX_SPI2_Init(void)
+{
+    hspi2.Instance               = SPI2;
+    hspi2.Init.Mode              = SPI_MODE_MASTER;
+    hspi2.Init.Direction         = SPI_DIRECTION_2LINES;
+    hspi2.Init.DataSize          = SPI_DATASIZE_8BIT;
+    hspi2.Init.CLKPolarity       = SPI_POLARITY_LOW;
+    hspi2.Init.CLKPhase          = SPI_PHASE_1EDGE;
+    hspi2.Init.NSS               = SPI_NSS_SOFT;
+    hspi2.Init.BaudRatePrescaler = SPI_BAUDRATEPRESCALER_2;
+    hspi2.Init.FirstBit          = SPI_FIRSTBIT_MSB;
+    hspi2.Init.TIMode            = SPI_TIMODE_DISABLE;
+    hspi2.Init.CRCCalculation    = SPI_CRCCALCULATION_DISABLE;
+    hspi2.Init.CRCPolynomial     = 10;
+    if (HAL_SPI_Init(&hspi2) != HAL_OK) { Error_Handler(); }
+}
+
+static void MX_I2C1_Init(void)
+{
+    hi2c1.Instance             = I2C1;
+    hi2c1.Init.ClockSpeed      = 400000;
+    hi2c1.Init.DutyCycle       = I2C_DUTYCYCLE_2;
+    hi2c1.Init.OwnAddress1     = 0;
+    hi2c1.Init.AddressingMode  = I2C_ADDRESSINGMODE_7BIT;
+    hi2c1.Init.DualAddressMode = I2C_DUALADDRESS_DISABLE;
+    hi2c1.Init.OwnAddress2     = 0;
+    hi2c1.Init.GeneralCallMode = I2C_GENERALCALL_DISABLE;
+    hi2c1.Init.NoStretchMode   = I2C_NOSTRETCH_DISABLE;
+    if (HAL_I2C_Init(&hi2c1) != HAL_OK) { Error_Handler(); }
+}
+
+static void MX_ADC1_Init(void)
+{
+    ADC_ChannelConfTypeDef sConfig = {0};
+
+    hadc1.Instance                   = ADC1;
+    hadc1.Init.ClockPrescaler        = ADC_CLOCK_SYNC_PCLK_DIV4;
+    hadc1.Init.Resolution            = ADC_RESOLUTION_12B;
+    hadc1.Init.ScanConvMode          = DISABLE;
+    hadc1.Init.ContinuousConvMode    = DISABLE;
+    hadc1.Init.DiscontinuousConvMode = DISABLE;
+    hadc1.Init.ExternalTrigConvEdge  = ADC_EXTERNALTRIGCONVEDGE_NONE;
+    hadc1.Init.ExternalTrigConv      = ADC_SOFTWARE_START;
+    hadc1.Init.DataAlign             = ADC_DATAALIGN_RIGHT;
+    hadc1.Init.NbrOfConversion       = 1;
+    hadc1.Init.DMAContinuousRequests = DISABLE;
+    hadc1.Init.EOCSelection          = ADC_EOC_SINGLE_CONV;
+    if (HAL_ADC_Init(&hadc1) != HAL_OK) { Error_Handler(); }
+
+    sConfig.Channel      = ADC_CHANNEL_0;
+    sConfig.Rank         = 1;
+    sConfig.SamplingTime = ADC_SAMPLETIME_3CYCLES;
+    if (HAL_ADC_ConfigChannel(&hadc1, &sConfig) != HAL_OK) { Error_Handler(); }
+}
+
+void Error_Handler(void)
+{
+    __disable_irq();
+    while (1) {}
+}
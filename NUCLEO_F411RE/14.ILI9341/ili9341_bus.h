@@ -0,0 +1,30 @@
+/*
+ * ili9341_bus.h
+ *
+ *  8080 8-bit parallel bus backend for the ILI9341.
+ *  D0..D7 are scattered over up to three GPIO ports, so every byte value is
+ *  precomputed once into one BSRR word per port (256-entry table, 3KB RAM).
+ *  Writing a byte is then three table stores plus the WR strobe.
+ *
+ *  CS/RS are left to the caller; these functions only drive D0..D7 and WR.
+ *
+ *  The master copy lives in NUCLEO_F103RB/14.ILI9341. Packman, 36.Vector/03, 04
+ *  and NUCLEO_F411RE/14.ILI9341 carry byte-identical copies; edit the master and
+ *  run `python3 bus_sync.py --fix` there (without --fix it only checks).
+ */
+
+#ifndef INC_ILI9341_BUS_H_
+#define INC_ILI9341_BUS_H_
+
+#include "ili9341.h"
+
+// Maximum number of GPIO ports the data pins may span
+#define ILI9341_BUS_PORTS   3
+
+void ILI9341_Bus_Init(void);                                // Build the table (call before the first write)
+void ILI9341_Bus_Write8(uint8_t data);                      // One byte + WR strobe
+void ILI9341_Bus_WriteBuf(const uint8_t *buf, uint32_t len); // Byte stream (e.g. big-endian RGB565 line)
+void ILI9341_Bus_Repeat16(uint16_t color, uint32_t count);  // Same RGB565 pixel count times
+void ILI9341_Bus_WritePixels(const uint16_t *px, uint32_t count); // RGB565 pixels, high byte first
+
+#endif /* INC_ILI9341_BUS_H_ */
@@ -0,0 +1,46 @@
+/**
+ * @file drive_ctrl.h
+ * @brief 차동 구동 제어 (v, ω → 좌우 듀티, 가감속 제한, PI) 헤더
+ *
+ * HAL에 의존하지 않음 → 보드: drivers/motor.c 가 타이머 인터럽트에서 호출,
+ *                       PC: tools/host/drive_sim.c 가 모터 모델과 같이 실행
+ *
+ * 단위: 속도와 듀티 모두 천분율 (-1000 ~ 1000, 부호 = 방향)
+ */
+
+#ifndef DRIVE_CTRL_H
+#define DRIVE_CTRL_H
+
+#include <stdint.h>
+
+/* ===== 설정 ===== */
+#define DRIVE_CTRL_HZ       100     // Drive_Step 호출 주기
+#define DRIVE_ACCEL_PM_S    3000    // 가속 한도 (천분율/초) → 정지에서 최고속까지 0.33초
+#define DRIVE_DECEL_PM_S    6000    // 감속 한도 (멈출 때는 더 빨리)
+#define DRIVE_DUTY_MIN      300     // 모터가 돌기 시작하는 듀티 (이 아래는 소리만 남) → 0이 아닌 출력은 여기부터
+#define DRIVE_KP_Q8         128     // PI 비례 이득 (Q8, 0.5)
+#define DRIVE_KI_Q8         20      // PI 적분 이득 (Q8, 스텝마다)
+#define DRIVE_INTEG_MAX     400     // 적분 항 한도 (천분율) → 막혔을 때 와인드업 방지
+
+#define DRIVE_ACCEL_STEP    (DRIVE_ACCEL_PM_S / DRIVE_CTRL_HZ)
+#define DRIVE_DECEL_STEP    (DRIVE_DECEL_PM_S / DRIVE_CTRL_HZ)
+
+enum { DRIVE_L = 0, DRIVE_R = 1 };
+
+typedef struct {
+    int16_t target[2];      // 바퀴 목표 속도 (v, ω 혼합 결과)
+    int16_t setpoint[2];    // 가감속 제한을 거친 설정값
+    int16_t duty[2];        // 출력 듀티 (불감대 보정 포함)
+    int16_t meas[2];        // 마지막 측정 속도 (개루프면 0)
+    int32_t integ[2];       // PI 적분 (Q8)
+    uint8_t closed;         // 1 = 측정값으로 PI
+} Drive_t;
+
+/* ===== API ===== */
+void Drive_Init(Drive_t *d, uint8_t closed_loop);
+void Drive_SetVW(Drive_t *d, int16_t v, int16_t w);    // v: 전진 속도, w: 회전 (양수 = 왼쪽으로)
+void Drive_Halt(Drive_t *d);                            // 가감속 없이 즉시 0 (비상 정지)
+void Drive_Step(Drive_t *d, const int16_t *meas);       // 제어 1스텝 - meas[2] (NULL = 개루프)
+int16_t Drive_SpeedFromPeriod(uint32_t period_us, uint32_t full_period_us);  // 엔코더 펄스 간격 → 속도
+
+#endif /* DRIVE_CTRL_H */
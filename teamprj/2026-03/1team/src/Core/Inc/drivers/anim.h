@@ -1,6 +1,20 @@
 #pragma once
 #include "eyes.h"
 
+#define ANIM_FRAME_MS       30      // 애니 프레임 주기 (약 33 FPS, main 루프에서 사용)
+#define ANIM_TWEEN_MS       180     // 표정 전환 시간
+#define ANIM_BLINK_TWEEN_MS 60      // 깜빡임 전환 시간 (감기/뜨기 각각)
+
+typedef struct {
+    uint16_t frames;        // 그린 트윈 프레임 수
+    uint16_t skipped;       // 서보 이동 중이라 건너뛴 프레임 수
+    uint16_t last_us;       // 마지막 프레임 합성+전송 시간 (us)
+    uint16_t max_us;        // 최대 프레임 시간 (us)
+    uint8_t  last_bands;    // 마지막 프레임에서 전송한 밴드 수 (팔레트 모드는 창 수)
+} AnimStats_t;
+
 void Anim_Init(void);
 void Anim_Update(void);
 void Anim_Set(Expression_t expr);
+void Anim_GetStats(AnimStats_t *out);
+void Anim_ResetStats(void);
@@ -1,6 +1,6 @@
 /**
  * @file buzzer.h
- * @brief PWM 부저 드라이버 헤더 (TIM3 기반)
+ * @brief PWM 부저 드라이버 헤더 (TIM3 기반, DMA 버스트로 하드웨어 재생)
  */
 
 #ifndef __BUZZER_H
@@ -8,88 +8,39 @@
 
 #include <stdint.h>
 #include "stm32f1xx_hal.h"
+#include "drivers/buzzer_seq.h"     // 음표 정의, BuzzerNote_t, 시퀀서
 
-/* ===== 음표 주파수 정의 (Hz) - 전체 음계 ===== */
-// 4옥타브
-#define NOTE_C4  262
-#define NOTE_CS4 277
-#define NOTE_D4  294
-#define NOTE_DS4 311
-#define NOTE_E4  330
-#define NOTE_F4  349
-#define NOTE_FS4 370
-#define NOTE_G4  392
-#define NOTE_GS4 415
-#define NOTE_A4  440
-#define NOTE_AS4 466
-#define NOTE_B4  494
-
-// 5옥타브
-#define NOTE_C5  523
-#define NOTE_CS5 554
-#define NOTE_D5  587
-#define NOTE_DS5 622
-#define NOTE_E5  659
-#define NOTE_F5  698
-#define NOTE_FS5 740
-#define NOTE_G5  784
-#define NOTE_GS5 831
-#define NOTE_A5  880
-#define NOTE_AS5 932
-#define NOTE_B5  988
-
-// 6옥타브
-#define NOTE_C6  1047
-#define NOTE_CS6 1109
-#define NOTE_D6  1175
-#define NOTE_DS6 1245
-#define NOTE_E6  1319
-#define NOTE_F6  1397
-#define NOTE_FS6 1480
-#define NOTE_G6  1568
-#define NOTE_GS6 1661
-#define NOTE_A6  1760
-#define NOTE_AS6 1865
-#define NOTE_B6  1976
-
-// 7옥타브
-#define NOTE_C7  2093
-#define NOTE_CS7 2217
-#define NOTE_D7  2349
-#define NOTE_DS7 2489
-#define NOTE_E7  2637
-#define NOTE_F7  2794
-#define NOTE_FS7 2960
-#define NOTE_G7  3136
-#define NOTE_GS7 3322
-#define NOTE_A7  3520
-#define NOTE_AS7 3729
-#define NOTE_B7  3951
-
-#define REST 0
-
-/* ===== 음표 길이 (ms) ===== */
-#define WHOLE     1400
-#define HALF      700
-#define QUARTER   350
-#define EIGHTH    175
-#define SIXTEENTH 90
-
-/* ===== 음표 구조체 ===== */
+/* ===== 재생 통계 ===== */
 typedef struct {
-    uint16_t frequency;  // 주파수 (Hz)
-    uint16_t duration;   // 재생 시간 (ms)
-} BuzzerNote_t;
+    uint32_t melodies;      // 재생 시작 수
+    uint32_t refills;       // DMA 반쪽 채우기 수
+    uint32_t max_fill_cycles;   // 반쪽 채우기 최대 사이클
+    uint32_t late;          // 채우기 전에 DMA가 그 반쪽에 들어간 횟수 (소리 깨짐)
+} BuzzerStats_t;
 
 /* ===== API ===== */
-void Buzzer_Init(TIM_HandleTypeDef *htim, uint32_t channel);
-void Buzzer_PlayTone(uint16_t freq, uint16_t duration);
+void Buzzer_Init(TIM_HandleTypeDef *htim, uint32_t channel);   // channel은 TIM_CHANNEL_1 (버스트가 CCR1에 씀)
+void Buzzer_PlayTone(uint16_t freq, uint16_t duration);         // 논블로킹 (음 1개짜리 멜로디)
 void Buzzer_PlayMelody(const BuzzerNote_t *melody, uint16_t length);
+void Buzzer_PlayTune(BuzzerTune_t tune);
 void Buzzer_PlayElise(void);
 void Buzzer_PlayAlert(void);
 void Buzzer_PlayMario(void);
+void Buzzer_PlayReset(void);
+void Buzzer_PlayStop(void);
+void Buzzer_PlayStart(void);
+void Buzzer_PlayOk(void);
+void Buzzer_PlayPing(void);
 void Buzzer_Stop(void);
-void Buzzer_Update(void);
+void Buzzer_SetVolume(uint8_t volume);                          // 0~255, 다음 채우기부터 적용
 uint8_t Buzzer_IsPlaying(void);
 
+/* DMA 콜백 (main.c의 HAL_TIM_PWM_PulseFinished[HalfCplt]Callback에서) */
+void Buzzer_DmaHalfCallback(TIM_HandleTypeDef *htim);
+void Buzzer_DmaCpltCallback(TIM_HandleTypeDef *htim);
+
+void Buzzer_GetStats(BuzzerStats_t *out);
+void Buzzer_ResetStats(void);
+void Buzzer_PrintStats(void);
+
 #endif /* __BUZZER_H */
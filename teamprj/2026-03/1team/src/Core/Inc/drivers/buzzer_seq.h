@@ -0,0 +1,134 @@
+/**
+ * @file buzzer_seq.h
+ * @brief 부저 시퀀서 - 멜로디 → 주기별 {ARR, CCR} 표 (HAL 없음)
+ *
+ * 보드: drivers/buzzer.c 가 TIM3 DMA 버스트로 재생, PC: tools/host/buzzer_wav.c 가 WAV로 렌더
+ */
+
+#ifndef __BUZZER_SEQ_H
+#define __BUZZER_SEQ_H
+
+#include <stdint.h>
+
+/* ===== 음표 주파수 정의 (Hz) - 전체 음계 ===== */
+// 4옥타브
+#define NOTE_C4  262
+#define NOTE_CS4 277
+#define NOTE_D4  294
+#define NOTE_DS4 311
+#define NOTE_E4  330
+#define NOTE_F4  349
+#define NOTE_FS4 370
+#define NOTE_G4  392
+#define NOTE_GS4 415
+#define NOTE_A4  440
+#define NOTE_AS4 466
+#define NOTE_B4  494
+
+// 5옥타브
+#define NOTE_C5  523
+#define NOTE_CS5 554
+#define NOTE_D5  587
+#define NOTE_DS5 622
+#define NOTE_E5  659
+#define NOTE_F5  698
+#define NOTE_FS5 740
+#define NOTE_G5  784
+#define NOTE_GS5 831
+#define NOTE_A5  880
+#define NOTE_AS5 932
+#define NOTE_B5  988
+
+// 6옥타브
+#define NOTE_C6  1047
+#define NOTE_CS6 1109
+#define NOTE_D6  1175
+#define NOTE_DS6 1245
+#define NOTE_E6  1319
+#define NOTE_F6  1397
+#define NOTE_FS6 1480
+#define NOTE_G6  1568
+#define NOTE_GS6 1661
+#define NOTE_A6  1760
+#define NOTE_AS6 1865
+#define NOTE_B6  1976
+
+// 7옥타브
+#define NOTE_C7  2093
+#define NOTE_CS7 2217
+#define NOTE_D7  2349
+#define NOTE_DS7 2489
+#define NOTE_E7  2637
+#define NOTE_F7  2794
+#define NOTE_FS7 2960
+#define NOTE_G7  3136
+#define NOTE_GS7 3322
+#define NOTE_A7  3520
+#define NOTE_AS7 3729
+#define NOTE_B7  3951
+
+#define REST 0
+
+/* ===== 음표 길이 (ms) ===== */
+#define WHOLE     1400
+#define HALF      700
+#define QUARTER   350
+#define EIGHTH    175
+#define SIXTEENTH 90
+
+/* ===== 음표 구조체 ===== */
+typedef struct {
+    uint16_t frequency;  // 주파수 (Hz)
+    uint16_t duration;   // 재생 시간 (ms)
+} BuzzerNote_t;
+
+/* ===== 시퀀서 설정 ===== */
+#define BUZ_TICK_HZ         1000000 // TIM3 카운터 (PSC 63 → 1MHz)
+#define BUZ_GAP_MS          30      // 음표 사이 무음 (음 구분)
+#define BUZ_REST_ARR        999     // 쉼표 주기 = 1ms
+#define BUZ_MAX_STEPS       96      // 컴파일된 단계 수 (음표 + 간격)
+#define BUZ_WORDS           3       // 주기 1개 = DMA 버스트 {ARR, RCR(자리만), CCR1}
+
+/* 엔벨로프 (듀티로 음량): 어택 → 감쇠 → 지속 → 릴리스 */
+#define BUZ_ATTACK_MS       4
+#define BUZ_DECAY_MS        40
+#define BUZ_SUSTAIN_Q8      160     // 지속 음량 (256 = 최대)
+#define BUZ_RELEASE_MS      20
+
+/* 컴파일된 단계 1개 - 같은 ARR로 periods 주기 */
+typedef struct {
+    uint16_t arr;           // 0 = 쉼표 (BUZ_REST_ARR, 무음)
+    uint16_t periods;
+    uint16_t attack;        // 어택 주기 수
+    uint16_t decay;         // 감쇠 끝 주기
+    uint16_t release;       // 릴리스 시작 주기
+} BuzzerStep_t;
+
+typedef struct {
+    BuzzerStep_t steps[BUZ_MAX_STEPS];
+    uint16_t n;             // 단계 수
+    uint16_t cur;           // 지금 단계
+    uint16_t pos;           // 단계 안 주기 위치
+    uint8_t  volume;        // 0~255 (255 = 듀티 50%)
+    uint32_t total_us;      // 컴파일된 전체 길이 (주기 합)
+} BuzzerSeq_t;
+
+/* 내장 멜로디 (보드의 Buzzer_PlayXxx()와 PC 렌더러가 같은 표를 씀) */
+typedef enum {
+    BUZ_TUNE_MARIO = 0,
+    BUZ_TUNE_ALERT,
+    BUZ_TUNE_ELISE,
+    BUZ_TUNE_RESET,
+    BUZ_TUNE_STOP,
+    BUZ_TUNE_START,
+    BUZ_TUNE_OK,
+    BUZ_TUNE_PING,
+    BUZ_TUNES
+} BuzzerTune_t;
+
+/* ===== API ===== */
+const BuzzerNote_t *BuzzerSeq_Tune(BuzzerTune_t t, uint16_t *length, const char **name);  // 범위 밖이면 NULL
+uint16_t BuzzerSeq_Compile(BuzzerSeq_t *s, const BuzzerNote_t *melody, uint16_t length);  // 단계 수 반환
+uint16_t BuzzerSeq_Fill(BuzzerSeq_t *s, uint16_t *buf, uint16_t periods);  // buf에 주기 periods개, 소리 있는 주기 수 반환 (0 = 끝)
+
+#endif /* __BUZZER_SEQ_H */
@@ -0,0 +1,46 @@
+/**
+ * @file clcd_i2c.h
+ * @brief HD44780 문자 LCD (PCF8574 I2C 확장) 비동기 드라이버 헤더
+ */
+
+#ifndef __CLCD_I2C_H
+#define __CLCD_I2C_H
+
+#include <stdint.h>
+#include "stm32f1xx_hal.h"
+
+/* ===== 설정 ===== */
+#define CLCD_MAX_COLS       20      // 16x2, 20x4 모두 지원
+#define CLCD_MAX_ROWS       4
+#define CLCD_BATCH_MAX      (CLCD_MAX_ROWS * (CLCD_MAX_COLS + 1) * 4)  // 화면 전체 + 줄마다 주소 명령
+
+/* PCF8574 → HD44780 핀 (P0..P7 = RS, RW, EN, BL, D4..D7) */
+#define CLCD_RS             0x01
+#define CLCD_EN             0x04
+#define CLCD_BL             0x08
+
+/* ===== 통계 ===== */
+typedef struct {
+    uint32_t flushes;       // 시작한 I2C 전송 수
+    uint32_t bytes;         // 버스로 보낸 바이트 (PCF8574 쓰기 수)
+    uint32_t cells;         // 다시 쓴 글자 수
+    uint32_t addr_cmds;     // DDRAM 주소 명령 수
+    uint32_t max_bytes;     // 한 번에 보낸 최대 바이트
+    uint32_t busy_skips;    // 이전 전송이 안 끝나서 다음으로 미룬 횟수
+    uint32_t errors;        // I2C 에러 (NACK 등) → 화면 전체 다시 보냄
+} ClcdStats_t;
+
+/* ===== API ===== */
+HAL_StatusTypeDef CLCD_Init(I2C_HandleTypeDef *hi2c, uint8_t addr7,  // 부팅 시 1회 (블로킹, 약 60ms)
+                            uint8_t cols, uint8_t rows);
+void CLCD_Clear(void);                                      // 화면 버퍼만 공백으로
+void CLCD_Print(uint8_t x, uint8_t y, const char *str);     // 화면 버퍼에 쓰기 (줄 끝에서 자름)
+void CLCD_PrintLine(uint8_t y, const char *str);            // 한 줄 전체 (남는 칸은 공백)
+uint8_t CLCD_Flush(void);                                   // 바뀐 칸만 I2C 인터럽트 전송 시작, 시작했으면 1
+uint8_t CLCD_Busy(void);
+void CLCD_Invalidate(void);                                 // 다음 Flush에서 화면 전체 다시 보냄
+void CLCD_GetStats(ClcdStats_t *out);
+void CLCD_ResetStats(void);
+void CLCD_PrintStats(void);
+
+#endif /* __CLCD_I2C_H */
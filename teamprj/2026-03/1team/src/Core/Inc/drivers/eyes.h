@@ -20,11 +20,26 @@ typedef enum {
     EXPR_LOOK_RIGHT     // 스캔
 } Expression_t;
 
+/* ===== 파라메트릭 눈 (트윈용, 모든 값 Q8.8 픽셀) ===== */
+#define EYE_Q8(v)   ((int16_t)((v) * 256))
+
+typedef struct {
+    int16_t cy;         // 눈 중심 Y
+    int16_t w, h;       // 눈 폭 / 높이
+    int16_t r;          // 모서리 반지름
+    int16_t lid;        // 눈꺼풀 기울기: 왼쪽 눈 기준 오른쪽 끝이 내려가는 픽셀 (오른쪽 눈은 반대)
+    int16_t pupil_x;    // 동공 X 오프셋 (눈 중심 기준)
+    int16_t pupil_w;    // 동공 폭 (1픽셀 미만이면 안 그림)
+    int16_t pupil_h;    // 동공 높이
+} EyeShape_t;
+
 /* ===== API ===== */
 void Eyes_Draw(Expression_t expr);          // 강제 그리기
 void Eyes_SetExpression(Expression_t expr); // 표정 설정 (lazy)
 Expression_t Eyes_GetExpression(void);      // 현재 표정 반환
 void Eyes_Update(void);                     // dirty 시에만 그리기
 void Eyes_Invalidate(void);                 // 강제 갱신 플래그
+void Eyes_GetShape(Expression_t expr, EyeShape_t *out);   // 표정의 파라메트릭 모양
+uint8_t Eyes_DrawShape(const EyeShape_t *s); // 파라메트릭 모양 그리기 (트윈 중간 프레임), 전송 밴드(팔레트 모드는 창) 수 반환
 
 #endif /* __EYES_H */
@@ -0,0 +1,19 @@
+/**
+ * @file eyes_atlas.h
+ * @brief 눈 표정 RLE 아틀라스 (tools/gen_eyes_atlas.py 로 생성, 직접 수정 금지)
+ */
+
+#ifndef __EYES_ATLAS_H
+#define __EYES_ATLAS_H
+
+#include <stdint.h>
+#include "lcd_band.h"
+
+#define EYES_ATLAS_EXPR_COUNT  8
+#define EYES_ATLAS_RUN_COUNT   680
+
+extern const uint16_t  eyes_atlas_palette[2];
+extern const uint16_t  eyes_atlas_runs[EYES_ATLAS_RUN_COUNT];
+extern const BandRle_t eyes_atlas_bands[EYES_ATLAS_EXPR_COUNT][BAND_COUNT];
+
+#endif /* __EYES_ATLAS_H */
@@ -0,0 +1,42 @@
+/**
+ * @file lcd_band.h
+ * @brief 밴드(스트립) 합성기 헤더 - 도형을 RAM에서 합성 후 바뀐 밴드만 전송
+ */
+
+#ifndef __LCD_BAND_H
+#define __LCD_BAND_H
+
+#include <stdint.h>
+#include "lcd_gfx.h"
+
+/* ===== 밴드 설정 ===== */
+#define BAND_H          8                           // 밴드 높이 (행)
+#define BAND_COUNT      (LCD_HEIGHT / BAND_H)       // 160x80 → 10개
+#define BAND_MAX_SHAPES 16                          // 한 프레임 최대 도형 수
+
+/* ===== RLE 밴드 (플래시 아틀라스용) ===== */
+/* run = [15:12] 팔레트 인덱스, [11:0] 길이-1 (밴드 경계를 넘지 않음) */
+#define BAND_RLE_INDEX(run)  ((run) >> 12)
+#define BAND_RLE_LEN(run)    (((run) & 0x0FFF) + 1)
+
+typedef struct {
+    uint16_t run_start;     // runs 배열 시작 위치
+    uint16_t run_count;     // run 개수
+    uint32_t hash;          // 디코딩된 밴드의 FNV-1a 해시 (Band_Commit과 동일)
+    uint8_t  xl, xr;        // 배경(palette[0])이 아닌 열 범위, 비었으면 xl > xr
+} BandRle_t;
+
+/* ===== API ===== */
+void Band_Begin(uint16_t bg);                       // 새 프레임 (디스플레이 리스트 비움)
+void Band_Add(const GfxShape_t *s);                 // 도형 추가 (그리는 순서 = 추가 순서)
+void Band_FillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+void Band_RoundRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, uint16_t color);
+void Band_FillCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color);
+void Band_ThickLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t t, uint16_t color);
+uint8_t Band_Commit(void);                          // 합성 + diff + 전송, 전송한 밴드 수 반환
+void Band_Invalidate(void);                         // 다음 Commit에서 전체 밴드 재전송
+uint8_t Band_CommitRle(const BandRle_t *bands,      // BAND_COUNT개 RLE 밴드 중 바뀐 것만 디코딩/전송
+                       const uint16_t *runs,
+                       const uint16_t *palette);
+
+#endif /* __LCD_BAND_H */
@@ -9,6 +9,28 @@
 #include <stdint.h>
 #include "lcd_st7735.h"
 
+/* ===== 도형 기술자 (행 단위 span 래스터라이저 입력) ===== */
+typedef enum {
+    GFX_RECT = 0,   // (x0,y0)~(x1,y1) 포함 사각형
+    GFX_RRECT,      // (x0,y0)~(x1,y1) 둥근 사각형, r = 모서리 반지름, skew = 기울기
+    GFX_CIRCLE,     // 중심 (x0,y0), r = 반지름
+    GFX_LINE        // (x0,y0)→(x1,y1), r = 두께
+} GfxShapeType_t;
+
+typedef struct {
+    uint8_t  type;
+    int16_t  x0, y0, x1, y1;
+    int16_t  r;
+    uint16_t color;
+    int16_t  skew;  // GFX_RRECT: 오른쪽 끝이 왼쪽 끝보다 내려가는 픽셀 수 (0 = 수평)
+} GfxShape_t;
+
+#define GFX_MAX_SHAPES 16   // Gfx_DrawShapes 한 번에 합성할 최대 도형 수
+
+void    Gfx_ShapeRows(const GfxShape_t *s, int16_t *top, int16_t *bottom);
+uint8_t Gfx_ShapeRowSpan(const GfxShape_t *s, int16_t y, int16_t *xl, int16_t *xr);
+void    Gfx_DrawShapes(const GfxShape_t *list, uint8_t n);   // 겹침 병합 후 사각형 단위 출력
+
 /* ===== 그래픽 함수 ===== */
 void LCD_FillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
 void LCD_FillCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color);
@@ -0,0 +1,51 @@
+/**
+ * @file lcd_pal.h
+ * @brief 팔레트 프레임버퍼 헤더 - 화면 전체를 2/4bpp 인덱스로 RAM에 그리고 바뀐 행만 전송
+ */
+
+#ifndef __LCD_PAL_H
+#define __LCD_PAL_H
+
+#include <stdint.h>
+#include "lcd_gfx.h"
+#include "lcd_band.h"   // BandRle_t (아틀라스 형식 공유)
+
+/* ===== 설정 ===== */
+#define PAL_BPP         2                               // 2 (4색, 3.2KB) 또는 4 (16색, 6.4KB)
+#define PAL_COLORS      (1 << PAL_BPP)
+#define PAL_STRIDE      (LCD_WIDTH * PAL_BPP / 8)       // 한 행 바이트 수
+#define PAL_FB_SIZE     (PAL_STRIDE * LCD_HEIGHT)
+
+/* ===== 통계 ===== */
+typedef struct {
+    uint32_t frames;        // Pal_Commit 호출 수
+    uint32_t full_frames;   // 전체 화면을 보낸 Commit 수
+    uint32_t windows;       // 보낸 창 수
+    uint32_t rows;          // 보낸 행 수
+    uint32_t pixels;        // 보낸 픽셀 수 (x 2 = SPI 바이트)
+    uint32_t last_cycles;   // 마지막 Commit (행 비교 + 전송 완료까지)
+    uint32_t max_cycles;
+    uint32_t full_cycles;   // 마지막 전체 화면 Commit
+    uint32_t nearest;       // 팔레트가 가득 차서 가장 가까운 색으로 바꾼 횟수
+} PalStats_t;
+
+/* ===== API ===== */
+void    Pal_SetPalette(const uint16_t *colors, uint8_t n);  // 팔레트 지정 (나머지 칸은 비움) → 다음 Commit 전체 전송
+uint8_t Pal_Color(uint16_t color);                          // RGB565 → 인덱스 (없으면 빈 칸에 추가)
+void Pal_Begin(uint16_t bg);                                // 새 프레임 (배경색으로 지움)
+void Pal_Add(const GfxShape_t *s);                          // 도형을 바로 그림 (행 span → 인덱스 채우기)
+void Pal_FillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+void Pal_RoundRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, uint16_t color);
+void Pal_FillCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color);
+void Pal_ThickLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t t, uint16_t color);
+void Pal_DrawRle(const BandRle_t *bands,                    // 밴드 RLE 아틀라스를 통째로 그림 (Pal_Begin 포함)
+                 const uint16_t *runs,
+                 const uint16_t *palette);
+uint8_t Pal_Commit(void);                                   // 바뀐 행만 전송 (이어진 행 = 창 1개), 창 수 반환
+void Pal_Invalidate(void);                                  // 다음 Commit에서 전체 화면 전송
+
+void Pal_GetStats(PalStats_t *out);
+void Pal_ResetStats(void);
+void Pal_PrintStats(void);
+
+#endif /* __LCD_PAL_H */
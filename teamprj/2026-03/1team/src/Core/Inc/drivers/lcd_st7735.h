@@ -12,12 +12,52 @@
 #define LCD_WIDTH   160
 #define LCD_HEIGHT  80
 
+/* ===== 버스 통계 (SPI 명령/바이트 카운터) ===== */
+typedef struct {
+    uint32_t cmd_count;   // 명령 바이트 수 (DC=LOW)
+    uint32_t windows;     // LCD_SetWindow 호출 수
+    uint32_t bytes;       // SPI로 나간 총 바이트 수
+    uint32_t dma_kicks;   // DMA 전송 시작 횟수
+    uint32_t errors;      // DMA 실패/타임아웃
+    uint32_t texts;       // LCD_DrawText 호출 수 (문자열 1개 = 창 1개)
+    uint32_t glyph_misses;  // 글리프 캐시에 없어서 폰트에서 새로 펼친 글자 수
+} LCD_BusStats_t;
+
+/* ===== 글자 (5x7 폰트, 칸 6x8) ===== */
+#define LCD_CHAR_W      6
+#define LCD_CHAR_H      8
+#define LCD_TEXT_MAX    (LCD_WIDTH / LCD_CHAR_W)    // 한 줄 최대 글자 수 (배율 1)
+
+/* ===== 인덱스 픽셀 span (팔레트 프레임버퍼 → 전송 중 RGB565로 확장) ===== */
+/* 픽셀은 바이트 안에서 MSB 먼저 (4bpp: 짝수 x = 상위 니블) */
+typedef struct {
+    const uint8_t  *fb;         // (0, 0) 픽셀이 있는 바이트
+    const uint16_t *palette;    // RGB565, (1 << bpp)개
+    uint16_t stride;            // 한 행의 바이트 수
+    uint16_t x, w;              // 보낼 열 범위 (x는 바이트 경계가 아니어도 됨)
+    uint16_t y, h;              // 보낼 행 범위
+    uint8_t  bpp;               // 1, 2, 4
+} LCD_Indexed_t;
+
 /* ===== API ===== */
 void LCD_Init(void);
 void LCD_Clear(uint16_t color);
 void LCD_SetWindow(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1);
 void LCD_WriteColorFast(uint16_t color, uint32_t count);
 void LCD_WriteBuffer(uint16_t *buf, uint32_t count);
+
+/* 논블로킹 span 제출 / 완료 폴링 (핑퐁 DMA) */
+void LCD_SubmitColor(uint16_t color, uint32_t count);
+void LCD_SubmitBuffer(const uint16_t *buf, uint32_t count);
+void LCD_SubmitIndexed(const LCD_Indexed_t *src);   // w x h 픽셀, fb는 완료까지 유지
+uint8_t LCD_IsIdle(void);
+void LCD_WaitIdle(void);
+
+void LCD_GetBusStats(LCD_BusStats_t *out);
+void LCD_ResetBusStats(void);
+
+/* 문자열 = 창 1개 + DMA span 1개 (논블로킹, 문자열은 복사) → 그린 폭(px) 반환, 화면 밖 글자는 잘림 */
+uint16_t LCD_DrawText(uint16_t x, uint16_t y, const char *str, uint16_t fg, uint16_t bg, uint8_t scale);
 void LCD_DrawChar(uint16_t x, uint16_t y, char c, uint16_t fg, uint16_t bg);
 void LCD_DrawString(uint16_t x, uint16_t y, const char *str, uint16_t fg, uint16_t bg);
 
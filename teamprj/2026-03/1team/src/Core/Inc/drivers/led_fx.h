@@ -0,0 +1,69 @@
+/**
+ * @file led_fx.h
+ * @brief RGB LED 효과 플레이어 - 깜빡임/숨쉬기/페이드 기술자 → 프레임별 밝기 → 소프트 PWM 에지 표 (HAL 없음)
+ *
+ * 보드: drivers/rgb_led.c 가 TIM4 CC3 연속 비교로 재생, PC: tools/host/led_fx_check.c 가 파형 검사
+ */
+
+#ifndef __LED_FX_H
+#define __LED_FX_H
+
+#include <stdint.h>
+
+#define LEDFX_CH        3       // R, G, B
+
+/* ===== 효과 종류 ===== */
+typedef enum {
+    LEDFX_SOLID = 0,    // a 색 유지 (바로 끝)
+    LEDFX_BLINK,        // 앞 반주기 a, 뒤 반주기 b
+    LEDFX_BREATHE,      // a → b → a 삼각파
+    LEDFX_FADE,         // a → b 한 번 (repeat 무시)
+} LedFxKind_t;
+
+/* ===== 효과 기술자 (10바이트, 상수 표로 둠) ===== */
+/* 밝기 0~255 는 눈에 보이는 밝기 - 듀티로 바꿀 때 감마(제곱) 보정 */
+/* repeat 주기가 끝나면 마지막 값 유지: 깜빡임 = b, 숨쉬기 = a, 페이드 = b */
+typedef struct {
+    uint8_t  kind;              // LedFxKind_t
+    uint8_t  repeat;            // 주기 수 (0 = 무한)
+    uint16_t period_ms;         // 한 주기 (페이드는 전체 길이)
+    uint8_t  a[LEDFX_CH];
+    uint8_t  b[LEDFX_CH];
+} LedFx_t;
+
+/* ===== 재생 상태 ===== */
+typedef struct {
+    LedFx_t  fx;                // 복사본 (호출한 쪽 기술자가 사라져도 됨)
+    uint32_t t_ms;              // 지금 주기 안 위치 (페이드는 시작부터)
+    uint8_t  cycles;            // 끝난 주기 수
+    uint8_t  done;
+    uint8_t  level[LEDFX_CH];   // 지금 밝기
+} LedFxPlay_t;
+
+/* ===== 소프트 PWM 한 주기 (주기 시작에 on 켜고, t[k]에 off[k] 끔) ===== */
+typedef struct {
+    uint16_t all;               // 채널 핀 전체
+    uint16_t on;                // 주기 시작에 켤 핀 (나머지는 끔)
+    uint8_t  n;                 // 끄기 에지 수 (0 = 정적 → PWM 인터럽트 필요 없음)
+    uint16_t t[LEDFX_CH];       // 주기 시작부터 us, 오름차순
+    uint16_t off[LEDFX_CH];     // 그 시각에 끌 핀
+} LedFxFrame_t;
+
+/* 내장 효과 (보드의 RGB_PlayEffect()와 PC 검사기가 같은 표를 씀) */
+typedef enum {
+    LEDFX_FX_REVERSE = 0,       // 후진: 주황 250ms 깜빡임
+    LEDFX_FX_IDLE,              // 대기: 파랑 3초 숨쉬기
+    LEDFX_FX_ALERT,             // 경고: 빨강 빠른 깜빡임 3번 → 꺼짐
+    LEDFX_FX_FADE_OUT,          // 초록 → 꺼짐 0.8초
+    LEDFX_FX_COUNT
+} LedFxId_t;
+
+/* ===== API ===== */
+const LedFx_t *LedFx_Effect(LedFxId_t id, const char **name);  // 범위 밖이면 NULL
+void    LedFx_Start(LedFxPlay_t *p, const LedFx_t *fx);         // level = 시작 밝기
+uint8_t LedFx_Step(LedFxPlay_t *p, uint16_t dt_ms);             // dt_ms 진행, 밝기가 바뀌었으면 1
+void    LedFx_Compile(const uint8_t level[LEDFX_CH], const uint16_t pin[LEDFX_CH],
+                      uint16_t period_us, uint16_t min_us, LedFxFrame_t *f);
+uint16_t LedFx_OnTime(uint8_t level, uint16_t period_us);        // 감마 보정 켜짐 시간 (us)
+
+#endif /* __LED_FX_H */
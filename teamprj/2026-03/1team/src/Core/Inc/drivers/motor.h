@@ -2,6 +2,7 @@
 #define __MOTOR_H
 
 #include "stm32f1xx_hal.h"
+#include <stdint.h>
 
 /* 방향 정의 */
 typedef enum {
@@ -10,12 +11,33 @@ typedef enum {
     MOTOR_BACKWARD
 } MotorDir_t;
 
+/* 바퀴 (MOTOR_TRIM 순서) */
+typedef enum {
+    MOTOR_RF = 0,
+    MOTOR_RB,
+    MOTOR_LF,
+    MOTOR_LB,
+    MOTOR_WHEELS
+} MotorWheel_t;
+
+/* 소프트 PWM / 제어 통계 */
+typedef struct {
+    uint32_t periods;       // PWM 주기 수
+    uint32_t ctrl_steps;    // Drive_Step 호출 수 (DRIVE_CTRL_HZ)
+    uint32_t edges;         // 끄기 에지 인터럽트 수 (주기 시작 제외)
+    uint32_t max_isr_cycles;// 인터럽트 1번 최대 사이클 (제어 스텝 포함)
+    int16_t  v, w;          // 마지막 명령
+    int16_t  duty[MOTOR_WHEELS];    // 지금 출력 듀티 (보정 후, 부호 = 방향)
+    int16_t  speed[2];      // 좌우 측정 속도 (엔코더 없으면 0)
+} MotorStats_t;
+
 /* 기본 제어 */
-void Motor_Init(void);
-void Motor_Stop(void);
-void Motor_Forward(void);
+void Motor_Init(void);                      // 정지 + 소프트 PWM 시작 (Time_Init 뒤)
+void Motor_Drive(int16_t v, int16_t w);     // 천분율: v = 전진 속도, w = 회전 (양수 = 왼쪽), 가감속 제한 적용
+void Motor_Stop(void);                      // 즉시 정지 (가감속 없음)
+void Motor_Forward(void);                   // Motor_Drive(±MOTOR_BASE_SPEED, 0)
 void Motor_Backward(void);
-void Motor_Left(void);
+void Motor_Left(void);                      // Motor_Drive(0, ±MOTOR_TURN_SPEED) 제자리 회전
 void Motor_Right(void);
 
 /* 회전 */
@@ -24,4 +46,10 @@ void Motor_TurnRight_Front(void);
 void Motor_TurnLeft_Back(void);
 void Motor_TurnRight_Back(void);
 
+/* 엔코더 / 통계 */
+void Motor_EncoderPulse(uint8_t side);      // EXTI 콜백에서 (0 = 왼쪽, 1 = 오른쪽), MOTOR_ENCODER=1일 때만 사용
+void Motor_GetStats(MotorStats_t *out);
+void Motor_ResetStats(void);
+void Motor_PrintStats(void);
+
 #endif
@@ -1,11 +1,34 @@
+/**
+ * @file rgb_led.h
+ * @brief RGB 상태 LED 드라이버 헤더 - 고정 색 + 효과 재생 (TIM4 CC3 소프트 PWM)
+ */
+
 #ifndef __RGB_LED_H
 #define __RGB_LED_H
 
 #include "main.h"
+#include "drivers/led_fx.h"     // LedFx_t, 내장 효과
+
+/* ===== 재생 통계 ===== */
+typedef struct {
+    uint32_t plays;         // 효과 시작 수
+    uint32_t frames;        // 효과 스텝 수 (RGB_FRAME_PERIODS 주기마다 1번)
+    uint32_t compiles;      // 밝기가 바뀌어 에지 표를 다시 만든 수
+    uint32_t periods;       // 주기 시작 인터럽트 (정적 프레임은 프레임당 1번)
+    uint32_t edges;         // 끄기 에지 인터럽트
+    uint32_t max_isr_cycles;
+} RgbStats_t;
 
 /* RGB LED 함수 선언 */
 void RGB_Init(void);
-void RGB_Set(int color);    // ★ int 타입으로 선언!
+void RGB_Set(int color);    // ★ int 타입으로 선언! (재생 중인 효과는 멈춤)
 void RGB_Off(void);
+void RGB_Play(const LedFx_t *fx);   // 논블로킹 - 인터럽트가 끝까지 재생 (메인 루프 관여 없음)
+void RGB_PlayEffect(LedFxId_t id);
+uint8_t RGB_IsPlaying(void);
+
+void RGB_GetStats(RgbStats_t *out);
+void RGB_ResetStats(void);
+void RGB_PrintStats(void);
 
 #endif /* __RGB_LED_H */
@@ -0,0 +1,95 @@
+/**
+ * @file uart_link.h
+ * @brief UART 프레임 링크 헤더 (DMA 원형 버퍼 + IDLE/HT/TC 이벤트, 복사 없는 파서)
+ */
+
+#ifndef __UART_LINK_H
+#define __UART_LINK_H
+
+#include <stdint.h>
+#include "stm32f1xx_hal.h"
+
+/* ===== 설정 ===== */
+#define LINK_RX_BUF_SIZE    256     // 포트별 DMA 원형 버퍼 (2의 거듭제곱)
+#define LINK_RX_GUARD       16      // 읽기 위치가 DMA에 이만큼 가까워지면 랩(overrun)으로 봄
+#define LINK_MAX_PAYLOAD    24      // 인쇄 가능한 ASCII(0x20~)는 길이로 해석될 수 없게
+#define LINK_FRAME_TIMEOUT_MS 20    // 덜 들어온 프레임을 기다리는 최대 시간
+
+/* ===== 프레임 형식 =====
+ * [0xA5][len][type][payload × len][crc8]
+ * crc8 = CRC-8 (다항식 0x07, 초기값 0) over len, type, payload
+ * 프레임 밖의 바이트는 기존 1글자 명령('t', 'x', 'w' ...)으로 그대로 전달
+ */
+#define LINK_SYNC           0xA5
+#define LINK_OVERHEAD       4
+
+/* 프레임 종류 */
+#define LINK_T_CMD          0x01    // payload = 1글자 명령들 (Handle_Command로 전달)
+#define LINK_T_PING         0x02    // payload를 그대로 LINK_T_PONG으로 되돌려 보냄
+#define LINK_T_PONG         0x82
+#define LINK_T_STATS        0x03    // 링크 통계 출력 요청
+#define LINK_T_TRACE        0x04    // 상태기계 전이 기록 요청 → HDR 1개 + REC 여러 개
+#define LINK_T_TRACE_HDR    0x84    // {clock_hz u32, count u16, dropped u32}
+#define LINK_T_TRACE_REC    0x85    // RobotTrace_t × 1~2 (12바이트씩)
+#define LINK_T_PROF         0x05    // payload[0] = 1 구간 기록 시작 / 0 정지 → HDR, NAME들, REC 스트림 (prof.c)
+#define LINK_T_PROF_HDR     0x86    // {clock_hz u32, dropped u32} - 시작할 때와 dropped가 바뀔 때마다
+#define LINK_T_PROF_NAME    0x87    // {id u8, 이름 ASCII}
+#define LINK_T_PROF_REC     0x88    // 기록 × 1~4 (6바이트씩: cyc u32, tag u8, ctx u8)
+
+typedef enum {
+    LINK_PORT_USB = 0,      // USART2 (ST-LINK VCP)
+    LINK_PORT_BT,           // USART3 (블루투스)
+    LINK_PORT_COUNT
+} LinkPort_t;
+
+/* 수신 프레임 - DMA 버퍼를 그대로 가리킴 (콜백 안에서만 유효) */
+typedef struct {
+    const uint8_t *buf;     // 포트의 DMA 원형 버퍼
+    uint16_t start;         // payload 첫 바이트 인덱스 (끝에서 0으로 감길 수 있음)
+    uint8_t  len;           // payload 길이
+    uint8_t  type;
+    LinkPort_t port;
+} LinkFrame_t;
+
+/* payload i번째 바이트 (원형 버퍼 감김 처리) */
+static inline uint8_t Link_Byte(const LinkFrame_t *f, uint8_t i)
+{
+    return f->buf[(f->start + i) & (LINK_RX_BUF_SIZE - 1)];
+}
+
+typedef void (*LinkFrameFn_t)(const LinkFrame_t *f);
+typedef void (*LinkByteFn_t)(uint8_t c);        // 프레임 밖 바이트 (기존 Handle_Command 형태)
+
+/* ===== 포트별 통계 ===== */
+typedef struct {
+    uint32_t rx_bytes;      // 파서가 소비한 바이트
+    uint32_t frames;        // CRC 통과 프레임
+    uint32_t legacy;        // 프레임 밖 1글자 명령
+    uint32_t crc_errors;    // CRC 불일치 (프레임 길이만큼 버림)
+    uint32_t len_errors;    // 길이 초과 / 프레임 시간 초과
+    uint32_t dropped;       // 읽기 전에 DMA가 덮어써서 버린 바이트 (overrun)
+    uint32_t line_errors;   // USART FE/NE/ORE 플래그 (IDLE 인터럽트에서 확인, 근사치)
+    uint32_t restarts;      // DMA 수신 재시작
+    uint32_t events;        // HT/TC/IDLE 이벤트 수
+    uint32_t max_backlog;   // 파서 진입 시 최대 미처리 바이트
+    uint32_t parse_cycles;  // 파싱에 쓴 CPU 사이클 (DWT, 콜백 시간 제외)
+} LinkStats_t;
+
+/* ===== API ===== */
+void Link_Init(LinkFrameFn_t on_frame, LinkByteFn_t on_byte);
+HAL_StatusTypeDef Link_Start(LinkPort_t port, UART_HandleTypeDef *huart);  // IDLE 수신 DMA 시작
+void Link_Poll(void);                       // 메인 컨텍스트: 이벤트가 있었던 포트만 파싱
+void Link_Send(LinkPort_t port, uint8_t type, const uint8_t *payload, uint8_t len);
+uint8_t Link_Encode(uint8_t *out, uint8_t type, const uint8_t *payload, uint8_t len);  // 프레임 만들기, 길이 반환
+HAL_StatusTypeDef Link_SendDma(LinkPort_t port, const uint8_t *data, uint16_t len);    // 송신 DMA (끝날 때까지 data 유지)
+uint8_t Link_TxBusy(LinkPort_t port);
+void Link_TxWait(LinkPort_t port);          // 송신 DMA가 끝날 때까지 대기 (printf/Link_Send 전에)
+void Link_GetStats(LinkPort_t port, LinkStats_t *out);
+void Link_ResetStats(void);
+void Link_PrintStats(void);
+
+/* 인터럽트 연결 */
+void Link_IRQ(UART_HandleTypeDef *huart);           // USARTx_IRQHandler에서 HAL 처리 전에 호출
+void Link_ErrorCallback(UART_HandleTypeDef *huart); // HAL_UART_ErrorCallback에서 호출
+
+#endif
@@ -4,9 +4,34 @@
 #include "stm32f1xx_hal.h"   // TIM_HandleTypeDef 때문에 필요
 #include <stdint.h>
 
+/* ===== 측정 설정 ===== */
+/* TIM2: 1us 틱, 60ms 주기 (CubeMX), CH1 PWM = TRIG 10us 펄스, CH2 입력캡처 = ECHO */
+#define ULTRA_NO_ECHO       999     // 유효 거리 없음
+#define ULTRA_RING_SIZE     16      // 타임스탬프 에코 폭 링 (2의 거듭제곱)
+#define ULTRA_FILTER_N      5       // 중앙값 필터 창 (최근 N개)
+#define ULTRA_MIN_US        116     // 2cm
+#define ULTRA_MAX_US        23200   // 400cm
+
+/* 에코 샘플 1개 */
+typedef struct {
+    uint16_t width_us;      // 에코 폭, 0 = 에코 없음/범위 밖
+    uint32_t t_ms;          // 하강 에지 시각 (HAL_GetTick)
+} UltraSample_t;
+
+/* 필터링된 최신 거리 */
+typedef struct {
+    uint16_t cm;            // 중앙값 거리, 유효 샘플이 없으면 ULTRA_NO_ECHO
+    uint8_t  confidence;    // 0~100: 창 안에서 중앙값 근처(inlier) 샘플 비율
+    uint8_t  samples;       // Ultrasonic_Restart() 이후 창에 들어온 샘플 수 (최대 ULTRA_FILTER_N)
+    uint32_t t_ms;          // 가장 최근 샘플 시각
+    uint32_t seq;           // 샘플마다 증가 (새 값 확인용)
+} UltraRange_t;
+
 void Ultrasonic_Init(void);
-void Ultrasonic_Trigger(void);
-uint16_t Ultrasonic_Read(void);
+void Ultrasonic_Restart(void);                          // 필터 창 비우기 (서보가 움직인 뒤 등)
+void Ultrasonic_GetRange(UltraRange_t *out);            // 최신 필터 값 (락 없이, 블로킹 X)
+uint8_t Ultrasonic_GetSamples(UltraSample_t *out, uint8_t n);  // 최근 원시 샘플 n개 (최신순)
+uint16_t Ultrasonic_Read(void);                         // 새 값이 있으면 cm, 없으면 ULTRA_NO_ECHO
 void Ultrasonic_IC_Callback(TIM_HandleTypeDef *htim);
 
 #endif
@@ -56,8 +56,6 @@ void HAL_TIM_MspPostInit(TIM_HandleTypeDef *htim);
 void Error_Handler(void);
 
 /* USER CODE BEGIN EFP */
-/* 함수 선언 추가 - RGB LED 관련 */
-void Set_LED_By_State(RobotState_t state);
 
 /* USER CODE END EFP */
 
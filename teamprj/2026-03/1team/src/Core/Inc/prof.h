@@ -0,0 +1,81 @@
+/**
+ * @file prof.h
+ * @brief 핫패스 구간 기록 (DWT 사이클 + 잠금 없는 링) 헤더
+ *
+ * 사용:
+ *   void Anim_Update(void)
+ *   {
+ *       PROF_SCOPE(PROF_ANIM);          // 여기서 시작, 블록을 나갈 때(return 포함) 끝
+ *       ...
+ *   }
+ *   PROF_BEGIN(PROF_LINK_RX); ... PROF_END(PROF_LINK_RX);   // 블록과 안 맞는 구간
+ *
+ * 기록은 PC(tools/prof_trace.py)가 LINK_T_PROF 프레임으로 켤 때만 - 꺼져 있으면 변수 1개 비교
+ * 이 헤더는 HAL에 의존하지 않음 (drivers에서 그대로 include)
+ */
+
+#ifndef PROF_H
+#define PROF_H
+
+#include <stdint.h>
+
+/* ===== 설정 ===== */
+#ifndef PROF_ENABLE
+#define PROF_ENABLE         1       // 0: 매크로가 아무 코드도 안 만듦
+#endif
+#define PROF_RING_SIZE      256     // 기록 수 (2의 거듭제곱, 8바이트씩)
+#define PROF_TX_FRAMES      4       // Prof_Poll 1번에 보내는 기록 프레임 수 (프레임당 4개)
+
+/* ===== 구간 id (tools/prof_trace.py 는 이름을 보드에서 받으므로 여기만 고치면 됨) ===== */
+typedef enum {
+    PROF_ANIM = 0,          // Anim_Update (표정 프레임)
+    PROF_UI,                // UI_Update (문자 LCD)
+    PROF_LCD_FILL,          // LCD_WriteColorFast (단색 DMA 제출)
+    PROF_LINK_RX,           // Link_Poll 포트 1개 처리 (UART 수신 DMA 비우기 + 명령 콜백)
+    PROF_COUNT
+} ProfId_t;
+
+#define PROF_F_END          0x80    // 기록 tag: id | PROF_F_END (끝)
+
+/* ===== 통계 ===== */
+typedef struct {
+    uint32_t records;       // 링에 들어간 기록
+    uint32_t dropped;       // 링이 가득 차서 버린 기록
+    uint32_t sent;          // 보낸 기록
+    uint32_t tx_bytes;      // 보낸 바이트 (프레임 포함)
+    uint32_t max_fill;      // 보낼 때 링에 쌓여 있던 최대 기록 수
+} ProfStats_t;
+
+/* ===== API ===== */
+void Prof_Start(uint8_t port);              // 기록 시작 + 이름/헤더부터 스트림 (uart_link 포트)
+void Prof_Stop(void);
+void Prof_Poll(void);                       // 메인 컨텍스트만: 쌓인 기록을 UART DMA로 (전송 중이면 바로 리턴)
+void Prof_Mark(uint8_t tag);                // 매크로용 - 인터럽트에서도 가능
+void Prof_GetStats(ProfStats_t *out);
+void Prof_ResetStats(void);
+void Prof_PrintStats(void);
+
+extern volatile uint8_t prof_on;
+
+#if PROF_ENABLE
+static inline uint8_t Prof_ScopeBegin(uint8_t id)
+{
+    if (prof_on) Prof_Mark(id);
+    return id;
+}
+
+static inline void Prof_ScopeEnd(const uint8_t *id)
+{
+    if (prof_on) Prof_Mark((uint8_t)(*id | PROF_F_END));
+}
+
+#define PROF_BEGIN(id)  do { if (prof_on) Prof_Mark((uint8_t)(id)); } while (0)
+#define PROF_END(id)    do { if (prof_on) Prof_Mark((uint8_t)((id) | PROF_F_END)); } while (0)
+#define PROF_SCOPE(id)  const uint8_t prof_scope_ __attribute__((cleanup(Prof_ScopeEnd), unused)) = Prof_ScopeBegin((uint8_t)(id))
+#else
+#define PROF_BEGIN(id)  ((void)0)
+#define PROF_END(id)    ((void)0)
+#define PROF_SCOPE(id)  ((void)0)
+#endif
+
+#endif /* PROF_H */
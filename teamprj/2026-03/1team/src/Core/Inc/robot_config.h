@@ -35,6 +35,20 @@
 #define MOTOR_LBB_PORT   LBB_GPIO_Port
 #define MOTOR_LBB_PIN    LBB_Pin
 
+/* 속도 (천분율, drive_ctrl.h 단위) */
+#define MOTOR_BASE_SPEED   700      // 전진/후진
+#define MOTOR_TURN_SPEED   600      // 제자리 회전 (ω)
+#define MOTOR_TRIM         { 1000, 1000, 1000, 1000 }   // RF, RB, LF, LB 출력 보정 (직진이 휘면 빠른 쪽을 낮춤)
+
+/* 소프트 PWM (TIM4 CC2 연속 비교) */
+#define MOTOR_PWM_US       1000     // PWM 주기 (1kHz)
+#define MOTOR_PWM_MIN_US   8        // 이보다 짧은 펄스/틈은 0%/100%로 (인터럽트 간격 확보)
+
+/* 엔코더 (선택): 1로 바꾸고 EXTI 콜백에서 Motor_EncoderPulse(좌/우) 호출 → 좌우 PI 폐루프 */
+#define MOTOR_ENCODER          0
+#define MOTOR_ENC_FULL_US      15000    // 최고속일 때 펄스 간격 (20슬롯 디스크, 약 200rpm)
+#define MOTOR_ENC_TIMEOUT_US   200000   // 이 시간 동안 펄스 없으면 정지로 봄
+
 
 /* ===============================
  * Ultrasonic Sensor
@@ -44,6 +58,10 @@
 #define ULTRASONIC_ECHO_PORT  ECHO_GPIO_Port
 #define ULTRASONIC_ECHO_PIN   ECHO_Pin
 
+#define SCAN_ECHO_SAMPLES     3     // 스캔 각도마다 최소 샘플 수 (3개 중앙값 = 이상치 1개 제거, TIM2 트리거 60ms 주기)
+#define SCAN_ECHO_CONF        80    // 최소 샘플의 confidence 가 이보다 낮으면 ULTRA_FILTER_N 개가 찰 때까지 기다림
+#define SCAN_ECHO_TIMEOUT_MS  340   // 샘플이 다 안 들어와도 다음 각도로 넘어가는 시간 (5 x 60ms + 여유)
+
 
 /* ===============================
  * Servo
@@ -59,6 +77,17 @@
  * =============================== */
 #define BUZZER_PORT  BUZZER_GPIO_Port
 #define BUZZER_PIN   BUZZER_Pin
+#define BUZZER_VOLUME        255  // 기본 음량 0~255 (듀티, 255 = 50%)
+#define BUZZER_RING_PERIODS  64   // DMA 원형 버퍼 (PWM 주기 수, 반쪽씩 채움)
+
+
+/* ===============================
+ * RGB LED (PC5/PC6/PC8 - 타이머 채널 없음 → 효과는 TIM4 CC3 소프트 PWM)
+ * =============================== */
+#define RGB_PORT           RED_GPIO_Port    // 세 핀이 같은 포트 (BSRR 1번에 같이 씀)
+#define RGB_PWM_US         2000     // 효과 재생 PWM 주기 (500Hz)
+#define RGB_PWM_MIN_US     8        // 이보다 짧은 펄스/틈은 0%/100%
+#define RGB_FRAME_PERIODS  10       // PWM 주기 이만큼마다 효과 1스텝 (20ms)
 
 
 /* ===============================
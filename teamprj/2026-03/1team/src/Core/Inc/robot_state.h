@@ -2,6 +2,9 @@
 #ifndef ROBOT_STATE_H
 #define ROBOT_STATE_H
 
+#include <stdint.h>
+
+/* 말단(leaf) 상태 - UI/LED가 보는 값 (상위 상태 AUTO, SWEEP는 robot_state.c 안에만 있음) */
 typedef enum
 {
     STATE_IDLE,
@@ -14,8 +17,52 @@ typedef enum
 	STATE_READ_ECHO,
 } RobotState_t;
 
+/* ===== 이벤트 ===== */
+typedef enum
+{
+    EV_NONE = 0,
+    EV_START,       // 't' 자동 주행
+    EV_STOP,        // 'x' 정지
+    EV_FORWARD,     // 'w' 수동 전진
+    EV_BACK,        // 's' 수동 후진
+    EV_LEFT,        // 'a' 수동 좌회전
+    EV_RIGHT,       // 'd' 수동 우회전
+    EV_TIMEOUT,     // 상태 타이머 만료
+    EV_RANGE,       // 초음파 새 샘플 (RANGE를 구독하는 상태에서만 발생)
+    EV_DONE,        // 완료 이벤트 (진입 동작이 바로 다음 판단을 요청)
+    EV_OBSTACLE,    // 스윕 중 정면 범위 지도 칸이 막힘
+    EV_COUNT
+} RobotEvent_t;
+
+#define ROBOT_EVQ_SIZE      16      // 이벤트 큐 (2의 거듭제곱)
+#define ROBOT_TRACE_SIZE    128     // 전이 기록 링 (2의 거듭제곱, 스윕 한 번 ≈ 40개)
+
+/* 전이 기록 1개 (12바이트, 리틀엔디언 그대로 전송 → tools/fsm_trace.py) */
+typedef struct {
+    uint32_t cyc;           // 전이 끝난 시각 (DWT CYCCNT)
+    uint32_t post_cyc;      // 그 이벤트가 큐에 들어간 시각
+    uint8_t  event;         // RobotEvent_t
+    uint8_t  from;          // RobotState_t
+    uint8_t  to;
+    uint8_t  flags;         // ROBOT_TRACE_*
+} RobotTrace_t;
+
+#define ROBOT_TRACE_INTERNAL    0x01    // 상태 변화 없는 내부 전이 (동작만 실행)
+
+/* 다른 모듈(UI, 애니메이션)이 보는 로봇 변수 */
+extern uint8_t  start_flag;
+extern uint8_t  manual_mode;
+extern uint8_t  manual_command;
+extern uint8_t  scan_angle;
+extern uint16_t g_distance;
+extern volatile uint8_t servo_moving;
+
 void Handle_State(RobotState_t state);  // ★ 이 줄 필수
 void RobotState_Init(void);
-void RobotState_Set(RobotState_t state);
 RobotState_t RobotState_Get(void);
+const char *RobotState_Name(RobotState_t state);
+uint8_t RobotState_Post(RobotEvent_t ev);   // 큐에 넣기 (ISR에서도 가능), 가득 차면 0
+void RobotState_Run(void);                  // 큐/타이머 처리 - 할 일 없으면 바로 리턴
+uint16_t RobotState_GetTrace(RobotTrace_t *out, uint16_t max);  // 오래된 순서
+uint32_t RobotState_GetDropped(void);       // 큐가 가득 차서 버린 이벤트 수
 #endif
@@ -0,0 +1,40 @@
+/**
+ * @file scan_map.h
+ * @brief 서보 스윕 극좌표 장애물 지도 헤더
+ */
+
+#ifndef SCAN_MAP_H
+#define SCAN_MAP_H
+
+#include <stdint.h>
+#include "robot_config.h"
+
+/* ===== 설정 ===== */
+#define MAP_BINS        ((SERVO_MAX_ANGLE - SERVO_MIN_ANGLE) / SERVO_STEP_ANGLE + 1)  // 서보 한 칸 = 칸 1개
+#define MAP_CONE_DEG    30      // 정면 판단 범위 (중앙 ± 30도)
+#define MAP_MAX_AGE_MS  3000    // 이보다 오래된 칸은 모름 (왕복 스윕 1회 ≈ 2.4초)
+#define MAP_CONF_MAX    3       // 신뢰도 상한 (에코 없음이 이만큼 연속이어야 막힌 칸이 풀림)
+#define MAP_AGREE_CM    8       // 이전 값과 이만큼 이내면 같은 물체로 보고 신뢰도 +1
+
+#if MAP_BINS > 16
+#error "MAP_BINS > 16: 막힘 비트마스크(uint16_t)를 늘려야 함"
+#endif
+
+/* ===== 칸 1개 ===== */
+typedef struct {
+    uint16_t cm;        // 거리 (ULTRA_NO_ECHO = 비어 있음/모름)
+    uint8_t  conf;      // 0 = 모름, 1..MAP_CONF_MAX
+    uint32_t tick;      // 마지막 갱신 (HAL_GetTick)
+} ScanBin_t;
+
+/* ===== API ===== */
+void ScanMap_Init(void);                                // 전부 모름으로
+void ScanMap_Clear(void);                               // 회전 등으로 지도가 무효일 때
+uint8_t ScanMap_Update(uint8_t angle, uint16_t cm);     // 측정 반영, 정면 범위 칸이 막혔으면 1
+uint8_t ScanMap_FrontBlocked(void);                     // 정면 범위에 막힌 칸이 있나 (O(1))
+int8_t ScanMap_TurnSide(void);                          // -1: 작은 각도 쪽이 더 막힘, +1: 큰 각도 쪽 (O(1))
+uint16_t ScanMap_BlockedMask(void);                     // bit i = 칸 i 막힘
+const ScanBin_t *ScanMap_Bin(uint8_t idx);
+void ScanMap_Print(void);                               // printf로 칸별 거리/신뢰도/나이
+
+#endif /* SCAN_MAP_H */
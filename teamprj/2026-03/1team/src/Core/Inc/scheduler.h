@@ -0,0 +1,39 @@
+/**
+ * @file scheduler.h
+ * @brief 협조형(cooperative) 데드라인 스케줄러 헤더
+ */
+
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+
+#include <stdint.h>
+
+/* ===== 설정 ===== */
+#define SCHED_MAX_TASKS     8       // 최대 태스크 수
+#ifndef SCHED_IDLE_WFI
+#define SCHED_IDLE_WFI      1       // 1: 할 일 없으면 __WFI()로 다음 인터럽트(SysTick 등)까지 대기
+#endif                              // 0: HAL 없이 빌드 (PC: -DSCHED_IDLE_WFI=0, 빈 틱은 바로 리턴)
+
+typedef void (*SchedFn_t)(void);
+
+/* ===== 태스크 통계 ===== */
+typedef struct {
+    uint32_t runs;          // 실행 횟수
+    uint32_t overruns;      // 실행 시간이 예산(budget)을 넘은 횟수
+    uint32_t missed;        // 한 주기 이상 늦어서 건너뛴 릴리스 수
+    uint32_t max_exec_us;   // 최대 실행 시간
+    uint32_t max_late_us;   // 최대 지연 (릴리스 시각 → 실제 시작, 지터)
+    uint32_t sum_late_us;   // 지연 합 (평균 = sum / runs)
+} SchedStats_t;
+
+/* ===== API ===== */
+void Sched_Init(void);                                  // 태스크 목록 비움 (시계는 Time_Init)
+int8_t Sched_Add(const char *name, SchedFn_t fn,       // 태스크 등록, id 반환 (가득 차면 -1)
+                 uint16_t period_ms, uint32_t budget_us);
+void Sched_Start(void);                                 // 모든 태스크를 지금 시각에 릴리스
+void Sched_RunOnce(void);                               // 릴리스된 것 중 데드라인 가장 이른 태스크 1개 실행
+void Sched_GetStats(uint8_t id, SchedStats_t *out);
+void Sched_ResetStats(void);
+void Sched_PrintStats(void);                            // printf로 태스크별 통계 출력
+
+#endif /* SCHEDULER_H */
@@ -60,6 +60,7 @@ void DMA1_Channel6_IRQHandler(void);
 void TIM2_IRQHandler(void);
 void USART2_IRQHandler(void);
 /* USER CODE BEGIN EFP */
+void DMA1_Channel7_IRQHandler(void);
 
 /* USER CODE END EFP */
 
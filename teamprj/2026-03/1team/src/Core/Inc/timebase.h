@@ -0,0 +1,60 @@
+/**
+ * @file timebase.h
+ * @brief 공용 us 시간축 (DWT 사이클 카운터 + TIM4 원샷) 헤더
+ *
+ * 보드: Core/Src/timebase.c, PC: tools/host/timebase_host.c (clock_gettime)
+ * → 이 헤더는 HAL에 의존하지 않음
+ */
+
+#ifndef TIMEBASE_H
+#define TIMEBASE_H
+
+#include <stdint.h>
+
+/* ===== 설정 ===== */
+#define TIME_ONESHOT_SLOTS  4       // 동시에 걸 수 있는 원샷 타이머 수
+#define TIME_CALIB_MS       100     // 보정 측정 시간 (SysTick 기준)
+
+/* 연속 비교 스트림 (Time_EdgeStart) - 스트림마다 TIM4 비교 채널 1개 */
+#define TIME_EDGE_MOTOR     0       // CC2 - 모터 소프트 PWM
+#define TIME_EDGE_RGB       1       // CC3 - RGB LED 소프트 PWM (CC3 DMA 요청은 SPI2와 같은 Ch5라 인터럽트만)
+#define TIME_EDGE_STREAMS   2
+
+typedef void (*TimeFn_t)(void *arg);
+typedef uint16_t (*TimeEdgeFn_t)(void);   // 다음 호출까지 us 반환 (0 = 멈춤)
+
+/* ===== 보정 결과 ===== */
+typedef struct {
+    uint32_t core_hz;           // SystemCoreClock (설정값)
+    uint32_t measured_hz;       // SysTick TIME_CALIB_MS 동안 DWT가 센 값으로 계산 (못 쟀으면 0)
+    int32_t  error_ppm;         // (측정 - 설정) / 설정
+    uint32_t tim_ticks_per_ms;  // TIM4 (1MHz가 정상 → 1000, 못 쟀으면 0)
+    uint32_t now_cycles;        // Time_Now_us() 1번 비용
+    uint32_t delay10_cycles;    // Time_Delay_us(10) 실제 걸린 사이클
+    int32_t  oneshot_late_us;   // 200us 원샷이 실제로 늦게 실행된 시간
+} TimeCalib_t;
+
+/* ===== API ===== */
+void Time_Init(void);                                   // DWT, TIM4 켜기 - 다른 모듈보다 먼저 1번
+uint32_t Time_Cycles(void);                             // CPU 사이클 카운터 (구간 측정용, 67초마다 한 바퀴)
+uint32_t Time_CyclesToUs(uint32_t cycles);
+uint32_t Time_Now_us(void);                             // us 시계 (인터럽트에서도 가능, 71분마다 한 바퀴)
+void Time_WaitUntil_us(uint32_t deadline_us);           // 바쁜 대기 - 수십 us 이하만
+void Time_Delay_us(uint32_t us);
+int8_t Time_Oneshot(uint32_t delay_us, TimeFn_t fn, void *arg);  // delay_us 뒤 fn(arg) 1번 (인터럽트 컨텍스트), id 반환 (가득 차면 -1)
+void Time_Cancel(int8_t id);
+void Time_EdgeStart(uint8_t id, uint16_t first_us, TimeEdgeFn_t fn);  // TIM4 CC2/CC3 연속 비교 - fn이 돌려준 간격마다 다시 호출 (소프트 PWM 등)
+void Time_EdgeStop(uint8_t id);
+int8_t Time_CalibrateStart(TimeCalib_t *out);           // 보정 시작 - 원샷 콜백으로 진행, 기다리지 않음 (진행 중이면 -1)
+uint8_t Time_CalibrateBusy(void);                       // 1 = 측정 중 (out 을 아직 읽지 말 것)
+void Time_Calibrate(TimeCalib_t *out);                  // 부팅 보정 (Start 후 끝날 때까지 기다림, 약 TIME_CALIB_MS)
+void Time_PrintCalibration(const TimeCalib_t *c);
+void Time_IRQ(void);                                    // TIM4_IRQHandler에서 호출
+
+/* 부호 있는 차이 (a가 b보다 뒤면 양수, 한 바퀴 넘김 처리) */
+static inline int32_t Time_Diff_us(uint32_t a, uint32_t b)
+{
+    return (int32_t)(a - b);
+}
+
+#endif /* TIMEBASE_H */
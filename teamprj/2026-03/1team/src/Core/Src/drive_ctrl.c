@@ -0,0 +1,136 @@
+/**
+ * @file drive_ctrl.c
+ * @brief 차동 구동 제어 - v, ω 혼합 → 가감속 제한 → (PI) → 불감대 보정
+ *
+ * 동작 (Drive_Step 1번 = 1/DRIVE_CTRL_HZ 초):
+ * 1. 혼합: 왼쪽 = v - ω, 오른쪽 = v + ω, 한쪽이 1000을 넘으면 비율 유지하며 둘 다 줄임
+ *    → 회전 반경이 속도 포화에도 그대로
+ * 2. 가감속 제한: 속도 크기가 커지는 쪽은 DRIVE_ACCEL_STEP, 줄어드는 쪽은 DRIVE_DECEL_STEP
+ *    → 출발/방향 전환 때 돌입 전류와 바퀴 미끄러짐 감소 (뱅뱅 ON/OFF 대신)
+ * 3. PI (엔코더가 있을 때): 설정값을 피드포워드로 두고 오차만 PI로 보정
+ *    - 적분은 가감속이 끝난 뒤에만, DRIVE_INTEG_MAX로 제한, 설정값 0이면 비움
+ * 4. 불감대 보정: 0이 아닌 출력은 DRIVE_DUTY_MIN ~ 1000 으로 옮김
+ *    → 낮은 속도 명령도 실제로 바퀴가 돎
+ *
+ * 정수 연산만 사용 (타이머 인터럽트 안에서 약 수 us)
+ */
+
+#include <stddef.h>
+#include "drive_ctrl.h"
+
+#define PM_MAX  1000
+
+/* ===== 내부 함수 ===== */
+
+static int16_t Clamp(int32_t x, int32_t lim)
+{
+    if (x > lim) return (int16_t)lim;
+    if (x < -lim) return (int16_t)-lim;
+    return (int16_t)x;
+}
+
+static int16_t Ramp(int16_t cur, int16_t tgt)
+{
+    int16_t diff = tgt - cur;
+
+    /* 0에서 멀어지는 쪽 = 가속, 0으로 다가가는 쪽 (0을 지나는 경우 포함) = 감속 */
+    int16_t lim = ((cur >= 0 && diff > 0) || (cur <= 0 && diff < 0)) ? DRIVE_ACCEL_STEP : DRIVE_DECEL_STEP;
+    if (cur > 0 && diff < -cur) lim = (lim < cur) ? lim : cur;     // 감속은 0에서 한 번 멈춤
+    if (cur < 0 && diff > -cur) lim = (lim < -cur) ? lim : -cur;
+
+    return cur + Clamp(diff, lim);
+}
+
+static int16_t Deadband(int32_t u)
+{
+    if (u == 0) return 0;
+
+    int32_t a = (u < 0) ? -u : u;
+    a = DRIVE_DUTY_MIN + a * (PM_MAX - DRIVE_DUTY_MIN) / PM_MAX;
+    return (int16_t)((u < 0) ? -a : a);
+}
+
+/* ===== 외부 API ===== */
+
+void Drive_Init(Drive_t *d, uint8_t closed_loop)
+{
+    *d = (Drive_t){ 0 };
+    d->closed = closed_loop;
+}
+
+void Drive_SetVW(Drive_t *d, int16_t v, int16_t w)
+{
+    int32_t l = (int32_t)v - w;
+    int32_t r = (int32_t)v + w;
+
+    int32_t m = (l < 0) ? -l : l;
+    int32_t mr = (r < 0) ? -r : r;
+    if (mr > m) m = mr;
+    if (m > PM_MAX)
+    {
+        l = l * PM_MAX / m;
+        r = r * PM_MAX / m;
+    }
+
+    d->target[DRIVE_L] = (int16_t)l;
+    d->target[DRIVE_R] = (int16_t)r;
+}
+
+void Drive_Halt(Drive_t *d)
+{
+    for (uint8_t i = 0; i < 2; i++)
+    {
+        d->target[i] = 0;
+        d->setpoint[i] = 0;
+        d->duty[i] = 0;
+        d->integ[i] = 0;
+    }
+}
+
+void Drive_Step(Drive_t *d, const int16_t *meas)
+{
+    for (uint8_t i = 0; i < 2; i++)
+    {
+        int16_t sp = Ramp(d->setpoint[i], d->target[i]);
+        d->setpoint[i] = sp;
+
+        if (sp == 0)
+        {
+            d->integ[i] = 0;
+            d->duty[i] = 0;
+            d->meas[i] = meas ? meas[i] : 0;
+            continue;
+        }
+
+        int32_t u = sp;                             // 피드포워드
+        if (d->closed && meas != NULL)
+        {
+            int32_t e = (int32_t)sp - meas[i];
+            d->meas[i] = meas[i];
+
+            if (sp == d->target[i])
+                d->integ[i] += e * DRIVE_KI_Q8;     // 가감속 중에는 적분 정지 (엔코더 지연 때문에 과적분 → 오버슈트)
+            if (d->integ[i] > ((int32_t)DRIVE_INTEG_MAX << 8))  d->integ[i] = (int32_t)DRIVE_INTEG_MAX << 8;
+            if (d->integ[i] < -((int32_t)DRIVE_INTEG_MAX << 8)) d->integ[i] = -((int32_t)DRIVE_INTEG_MAX << 8);
+
+            u += (e * DRIVE_KP_Q8 + d->integ[i]) >> 8;
+
+            /* 출력이 설정값과 반대 방향으로 넘어가지 않게 (엔코더는 방향을 모름) */
+            if ((sp > 0 && u < 0) || (sp < 0 && u > 0)) u = 0;
+        }
+
+        d->duty[i] = Deadband(Clamp(u, PM_MAX));
+    }
+}
+
+/**
+ * @brief 엔코더 펄스 간격 → 속도 (천분율)
+ * @param full_period_us 최고속(듀티 1000)일 때 펄스 간격
+ */
+int16_t Drive_SpeedFromPeriod(uint32_t period_us, uint32_t full_period_us)
+{
+    if (period_us == 0) return 0;
+
+    uint32_t s = full_period_us * PM_MAX / period_us;
+    return (int16_t)((s > 2 * PM_MAX) ? 2 * PM_MAX : s);
+}
@@ -6,12 +6,19 @@
  * 1. LCD_Init 중복 호출 제거
  * 2. 깜빡임 논블로킹 타이머 기반
  * 3. Eyes_Update() 통합으로 중복 드로잉 방지
+ * 4. 표정 전환 트윈: 파라메트릭 눈 모양을 Q8.8 고정소수점으로 보간
+ *    - 중간 프레임은 Eyes_DrawShape() (밴드 합성기 → 바뀐 밴드/열만 전송)
+ *    - 끝나면 Eyes_Update()가 아틀라스의 정확한 표정으로 마무리
+ *    - 전환 도중 새 표정이 오면 지금 보이는 모양에서 이어서 출발 (튀지 않음)
  */
 
+#include <stdlib.h>
 #include "main.h"
 #include "drivers/lcd_st7735.h"
 #include "drivers/eyes.h"
 #include "drivers/anim.h"
+#include "timebase.h"
+#include "prof.h"
 
 /* ===== 깜빡임 설정 ===== */
 #define BLINK_INTERVAL_MS   3000    // 깜빡임 주기 (3초)
@@ -24,6 +31,94 @@ static Expression_t saved_expr = EXPR_NEUTRAL;
 static uint32_t next_blink_interval = BLINK_INTERVAL_MS;
 static uint32_t blink_duration = BLINK_DURATION_MS;
 
+/* ===== 트윈 상태 ===== */
+extern volatile uint8_t servo_moving;
+
+static EyeShape_t   tw_from, tw_to, tw_now;   // 시작 / 목표 / 현재 모양 (Q8.8)
+static Expression_t tw_target = EXPR_NEUTRAL;
+static uint32_t     tw_start = 0;
+static uint16_t     tw_dur = ANIM_TWEEN_MS;
+static uint8_t      tweening = 0;
+static AnimStats_t  stats;
+
+/* ===== 트윈 내부 함수 ===== */
+
+/**
+ * @brief smoothstep 가감속 (t: Q8.8, 0~256)
+ */
+static int32_t Ease_Q8(int32_t t)
+{
+    return ((t * t) >> 8) * (768 - 2 * t) >> 8;
+}
+
+static int16_t Lerp_Q8(int16_t a, int16_t b, int32_t t)
+{
+    return (int16_t)(a + (((int32_t)(b - a) * t) >> 8));
+}
+
+static void Shape_Lerp(EyeShape_t *out, const EyeShape_t *a, const EyeShape_t *b, int32_t t)
+{
+    out->cy      = Lerp_Q8(a->cy,      b->cy,      t);
+    out->w       = Lerp_Q8(a->w,       b->w,       t);
+    out->h       = Lerp_Q8(a->h,       b->h,       t);
+    out->r       = Lerp_Q8(a->r,       b->r,       t);
+    out->lid     = Lerp_Q8(a->lid,     b->lid,     t);
+    out->pupil_x = Lerp_Q8(a->pupil_x, b->pupil_x, t);
+    out->pupil_w = Lerp_Q8(a->pupil_w, b->pupil_w, t);
+    out->pupil_h = Lerp_Q8(a->pupil_h, b->pupil_h, t);
+}
+
+/**
+ * @brief 목표 표정이 바뀌었으면 트윈 시작
+ */
+static void Tween_Check(uint32_t now)
+{
+    Expression_t target = Eyes_GetExpression();
+    if (target == tw_target) return;
+
+    tw_from = tw_now;   // 진행 중이던 모양에서 이어서
+    Eyes_GetShape(target, &tw_to);
+    tw_dur = (target == EXPR_BLINK || tw_target == EXPR_BLINK) ? ANIM_BLINK_TWEEN_MS : ANIM_TWEEN_MS;
+    tw_target = target;
+    tw_start = now;
+    tweening = 1;
+}
+
+/**
+ * @brief 트윈 한 프레임
+ * @return 트윈 진행 중이면 1 (이번 틱은 Eyes_Update 생략)
+ */
+static uint8_t Tween_Step(uint32_t now)
+{
+    if (!tweening) return 0;
+
+    uint32_t elapsed = now - tw_start;
+    if (elapsed >= tw_dur)
+    {
+        tw_now = tw_to;
+        tweening = 0;
+        return 0;       // 마지막 프레임은 Eyes_Update가 정확한 표정으로
+    }
+
+    int32_t t = Ease_Q8((int32_t)((elapsed << 8) / tw_dur));
+    Shape_Lerp(&tw_now, &tw_from, &tw_to, t);
+
+    if (servo_moving)
+    {
+        stats.skipped++;
+        return 1;
+    }
+
+    uint32_t c0 = Time_Cycles();
+    stats.last_bands = Eyes_DrawShape(&tw_now);
+    uint32_t us = Time_CyclesToUs(Time_Cycles() - c0);
+
+    stats.last_us = (us > 0xFFFF) ? 0xFFFF : (uint16_t)us;
+    if (stats.last_us > stats.max_us) stats.max_us = stats.last_us;
+    stats.frames++;
+    return 1;
+}
+
 /**
  * @brief 애니메이션 초기화
  * @note LCD_Init()은 main에서 한 번만 호출할 것
@@ -37,6 +132,8 @@ void Anim_Init(void)
 	next_blink_interval = 1000 + (rand() % 4000);  // 1~5초
 
     Eyes_SetExpression(EXPR_NEUTRAL);
+    Eyes_GetShape(EXPR_NEUTRAL, &tw_now);
+    tw_target = EXPR_NEUTRAL;
     Eyes_Update();
     
     last_blink_time = HAL_GetTick();
@@ -102,9 +199,34 @@ void Blink_Update(void)
  */
 void Anim_Update(void)
 {
+    PROF_SCOPE(PROF_ANIM);
+    uint32_t now = HAL_GetTick();
+
     /* 깜빡임 처리 */
     Blink_Update();
 
+    /* 표정 전환 중이면 중간 프레임 */
+    Tween_Check(now);
+    if (Tween_Step(now))
+        return;
+
     /* 표정 변경 시에만 그리기 */
     Eyes_Update();
 }
+
+/**
+ * @brief 트윈 프레임 통계
+ */
+void Anim_GetStats(AnimStats_t *out)
+{
+    *out = stats;
+}
+
+void Anim_ResetStats(void)
+{
+    stats.frames = 0;
+    stats.skipped = 0;
+    stats.last_us = 0;
+    stats.max_us = 0;
+    stats.last_bands = 0;
+}
@@ -1,274 +1,246 @@
 /**
  * @file buzzer.c
- * @brief PWM 부저 드라이버 - TIM3 기반 논블로킹
+ * @brief PWM 부저 드라이버 - TIM3 DMA 버스트로 하드웨어 재생
+ *
+ * 동작:
+ * 1. PlayMelody: buzzer_seq.c가 멜로디를 단계 표로 컴파일 → 원형 버퍼 두 반쪽을 채우고 DMA 시작
+ * 2. TIM3 CC3 (출력 없음, CCR3 = 0) → 매 PWM 주기 시작마다 DMA1 Ch2 요청
+ *    → DMAR 버스트로 {ARR, RCR, CCR1} 3개를 씀 (DBA = ARR, 3 전송, RCR은 TIM3에 없어 무시됨)
+ *    → ARR/CCR1 프리로드라 다음 주기부터 적용 → 음 높이, 길이, 음량(듀티)이 전부 타이머 주기 단위
+ * 3. DMA 반쪽/전체 완료 인터럽트에서 다 쓴 반쪽을 다음 주기들로 채움
+ * 4. 멜로디가 끝나 나가는 반쪽이 전부 무음이면 DMA 정지 (PWM은 CCR1 = 0으로 계속 돎)
+ *
+ * 메인 루프는 관여하지 않음 - Anim/UI가 오래 걸려도 음 길이가 흔들리지 않음
+ *
+ * 채널: TIM3_UP은 DMA1 Ch3 (USART3 RX가 사용 중), TIM3_CH1은 Ch6 (USART2 RX)
+ *      → 비어 있는 Ch2 = TIM3_CH3 요청을 갱신 트리거로 사용
  */
 
+#include <stdio.h>
 #include "drivers/buzzer.h"
 #include "main.h"
+#include "robot_config.h"
+#include "timebase.h"
+
+#define RING_HALF       (BUZZER_RING_PERIODS / 2)
+#define RING_WORDS      (BUZZER_RING_PERIODS * BUZ_WORDS)
 
 /* ===== 내부 변수 ===== */
 static TIM_HandleTypeDef *buzzer_tim = NULL;
 static uint32_t buzzer_channel = 0;
 
-static const BuzzerNote_t *current_melody = NULL;
-static uint16_t melody_length = 0;
-static uint16_t melody_index = 0;
-static uint8_t buzzer_state = 0;  // 0: 정지, 1: 재생, 2: 쉼표
-static uint32_t buzzer_tick = 0;
-
-/* ===== 마리오 테마 ===== */
-static const BuzzerNote_t mario_theme[] = {
-    // 첫 번째 구간
-    {NOTE_E7, EIGHTH}, {NOTE_E7, EIGHTH}, {REST, EIGHTH}, {NOTE_E7, EIGHTH},
-    {REST, EIGHTH}, {NOTE_C7, EIGHTH}, {NOTE_E7, EIGHTH}, {REST, EIGHTH},
-    {NOTE_G7, QUARTER}, {REST, QUARTER}, {NOTE_G6, QUARTER}, {REST, QUARTER},
-
-    // 두 번째 구간
-    {NOTE_C7, QUARTER}, {REST, EIGHTH}, {NOTE_G6, EIGHTH}, {REST, EIGHTH},
-    {NOTE_E6, QUARTER}, {REST, EIGHTH}, {NOTE_A6, EIGHTH}, {REST, EIGHTH},
-    {NOTE_B6, EIGHTH}, {REST, EIGHTH}, {NOTE_B6, EIGHTH}, {NOTE_A6, QUARTER},
-
-    // 세 번째 구간
-    {NOTE_G6, EIGHTH}, {NOTE_E7, EIGHTH}, {NOTE_G7, EIGHTH}, {NOTE_A7, QUARTER},
-    {NOTE_F7, EIGHTH}, {NOTE_G7, EIGHTH}, {REST, EIGHTH}, {NOTE_E7, EIGHTH},
-    {REST, EIGHTH}, {NOTE_C7, EIGHTH}, {NOTE_D7, EIGHTH}, {NOTE_B6, QUARTER}
-};
-
-/* ===== 경고음 ===== */
-static const BuzzerNote_t alert_melody[] = {
-    {NOTE_C7, 150},
-    {REST, 100},
-    {NOTE_C7, 150},
-    {REST, 100},
-    {NOTE_C7, 150},
-    {REST, 0}  // 종료
-};
-
-/* ===== 멈춤음 ===== */
-static const BuzzerNote_t stop_melody[] = {
-{NOTE_E5, 180},
-{NOTE_C5, 220},
-{NOTE_G4, 260},
-{REST, 80},
-{NOTE_C4, 400}, // 낮게 길게 = 완전 정지 느낌
-{REST, 0}
-};
-
-/* ===== 오토소리 ===== */
-static const BuzzerNote_t start_melody[] = {
-    {NOTE_G5, 120},
-    {NOTE_C6, 120},
-    {NOTE_E6, 140},   // 점점 밝아짐
-    {REST,    60},
-
-    {NOTE_E6, 120},
-    {NOTE_G6, 160},   // 기대감 상승
-    {REST,    60},
-
-    {NOTE_C7, 260},   // 출발 확정! 밝게 마무리
-    {REST, 0}
-};
-
-/* ===== 리셋음 ===== */
-static const BuzzerNote_t reset_melody[] = {
-{NOTE_C5, 120},
-{NOTE_E5, 120},
-{NOTE_G5, 150},
-{REST, 80},
-{NOTE_C6, 250}, // 위로 마무리 = 리셋 완료 느낌
-{REST, 0}
-};
-
-/* ===== 엘리제를 위하여 (짧은 버전) ===== */
-static const BuzzerNote_t elise_melody[] = {
-    {NOTE_E5, EIGHTH}, {NOTE_D5, EIGHTH},
-    {NOTE_E5, EIGHTH}, {NOTE_D5, EIGHTH},
-    {NOTE_E5, EIGHTH}, {NOTE_B4, EIGHTH},
-    {NOTE_D5, EIGHTH}, {NOTE_C5, EIGHTH},
-    {NOTE_A4, QUARTER},
-    {REST, 0}
-};
-
-/* ===== 확인 소리 (OK!) ===== */
-static const BuzzerNote_t ok_melody[] = {
-    {NOTE_C6, 80},
-    {NOTE_E6, 80},
-    {NOTE_G6, 120},
-    {NOTE_C7, 200},
-    {REST, 0}  // 종료
-};
-
-/* ===== 랜덤 소리 (OK!) ===== */
-static const BuzzerNote_t idle_ping_melody[] = {
-    {NOTE_E6, 120},   // 주인님
-    {NOTE_G6, 120},
-    {NOTE_E6, 120},   // 뭐하세요
-    {NOTE_C6, 150},
-    {REST, 100},      // 살짝 쉬고
-    {NOTE_D6, 120},   // 저
-    {NOTE_E6, 120},   // 여기
-    {NOTE_G6, 150},   // 있어요~
-    {NOTE_C7, 250},   // (강조)
-    {REST, 0}         // 종료
-};
+static BuzzerSeq_t seq;
+static uint16_t ring[RING_WORDS];
+static uint8_t volume = BUZZER_VOLUME;
+static volatile uint8_t playing = 0;
+static uint8_t tail_silent = 0;             // 마지막으로 채운 반쪽이 전부 무음
+static BuzzerNote_t tone[1];                // PlayTone용
 
+static BuzzerStats_t stats;
 
 /* ===== 초기화 ===== */
 void Buzzer_Init(TIM_HandleTypeDef *htim, uint32_t channel)
 {
+    TIM_OC_InitTypeDef oc = {0};
+
     buzzer_tim = htim;
     buzzer_channel = channel;
 
+    // ARR 프리로드 - DMA가 주기 중간에 써도 다음 갱신부터 적용 (CCR1 프리로드는 MX_TIM3_Init이 켬)
+    __HAL_TIM_SET_AUTORELOAD(buzzer_tim, BUZ_REST_ARR);
+    buzzer_tim->Instance->CR1 |= TIM_CR1_ARPE;
+
+    // CH3: 핀 출력 없이 비교만 (CCR3 = 0 → 주기 시작마다 DMA 요청)
+    oc.OCMode = TIM_OCMODE_TIMING;
+    oc.Pulse = 0;
+    oc.OCPolarity = TIM_OCPOLARITY_HIGH;
+    oc.OCFastMode = TIM_OCFAST_DISABLE;
+    if (HAL_TIM_OC_ConfigChannel(buzzer_tim, &oc, TIM_CHANNEL_3) != HAL_OK)
+    {
+        Error_Handler();
+    }
+
     // PWM 시작 (초기 상태는 무음)
+    __HAL_TIM_SET_COMPARE(buzzer_tim, buzzer_channel, 0);
     HAL_TIM_PWM_Start(buzzer_tim, buzzer_channel);
     Buzzer_Stop();
 }
 
-/* ===== PWM 주파수 설정 ===== */
-static void Buzzer_SetFrequency(uint16_t freq)
+/* ===== 원형 버퍼 반쪽 채우기 ===== */
+static void Ring_Fill(uint16_t half)
 {
-    if (freq == 0 || buzzer_tim == NULL) {
-        // 무음 - PWM 정지
-        HAL_TIM_PWM_Stop(buzzer_tim, buzzer_channel);
-        return;
-    }
+    uint32_t c0 = Time_Cycles();
 
-    // 주파수 → ARR 계산
-    // TIM3: Prescaler = 1279 → 1MHz (1μs 단위)
-    // ARR = 1000000 / frequency - 1
-    uint32_t arr_value = 1000000 / freq - 1;
+    seq.volume = volume;
+    tail_silent = (BuzzerSeq_Fill(&seq, &ring[half * RING_HALF * BUZ_WORDS], RING_HALF) == 0);
 
-    // ARR 업데이트
-    __HAL_TIM_SET_AUTORELOAD(buzzer_tim, arr_value);
+    uint32_t c = Time_Cycles() - c0;
+    if (c > stats.max_fill_cycles) stats.max_fill_cycles = c;
+    stats.refills++;
+}
 
-    // 듀티 50% (음질 향상)
-    __HAL_TIM_SET_COMPARE(buzzer_tim, buzzer_channel, arr_value / 2);
+/* ===== DMA 콜백 (인터럽트) ===== */
+static void Ring_Done(uint16_t half)
+{
+    if (!playing) return;
 
-    // PWM 시작
-    HAL_TIM_PWM_Start(buzzer_tim, buzzer_channel);
+    // 채울 반쪽에 DMA가 이미 들어갔는지 (남은 전송 수로 현재 위치 확인)
+    uint32_t left = __HAL_DMA_GET_COUNTER(buzzer_tim->hdma[TIM_DMA_ID_CC3]);
+    uint8_t in_first = (left > RING_WORDS / 2);
+    if (in_first == (half == 0)) stats.late++;
+
+    if (tail_silent)
+    {
+        Buzzer_Stop();      // 지금 나가는 반쪽이 전부 무음 → 멜로디 끝
+        return;
+    }
+    Ring_Fill(half);
 }
 
-/* ===== 톤 재생 (블로킹) ===== */
-void Buzzer_PlayTone(uint16_t freq, uint16_t duration)
+void Buzzer_DmaHalfCallback(TIM_HandleTypeDef *htim)
 {
-    Buzzer_SetFrequency(freq);
-    HAL_Delay(duration);
-    Buzzer_Stop();
-    HAL_Delay(30);  // 음표 간 간격
+    if (htim == buzzer_tim) Ring_Done(0);
 }
 
+void Buzzer_DmaCpltCallback(TIM_HandleTypeDef *htim)
+{
+    if (htim == buzzer_tim) Ring_Done(1);
+}
 
+/* ===== 톤 재생 (논블로킹) ===== */
+void Buzzer_PlayTone(uint16_t freq, uint16_t duration)
+{
+    tone[0].frequency = freq;
+    tone[0].duration = duration;
+    Buzzer_PlayMelody(tone, 1);
+}
 
-/* ===== 멜로디 재생 (논블로킹 시작) ===== */
+/* ===== 멜로디 재생 (컴파일 후 DMA 시작) ===== */
 void Buzzer_PlayMelody(const BuzzerNote_t *melody, uint16_t length)
 {
-    if (melody == NULL || length == 0)
+    if (melody == NULL || length == 0 || buzzer_tim == NULL)
+        return;
+
+    Buzzer_Stop();
+    if (BuzzerSeq_Compile(&seq, melody, length) == 0)
         return;
 
-    current_melody = melody;
-    melody_length = length;
-    melody_index = 0;
-    buzzer_state = 1;  // 재생 상태
-    buzzer_tick = HAL_GetTick();
+    Ring_Fill(0);
+    Ring_Fill(1);
+
+    playing = 1;
+    stats.melodies++;
+
+    if (HAL_TIM_DMABurst_MultiWriteStart(buzzer_tim, TIM_DMABASE_ARR, TIM_DMA_CC3,
+                                         (uint32_t *)ring, TIM_DMABURSTLENGTH_3TRANSFERS,
+                                         RING_WORDS) != HAL_OK)
+    {
+        playing = 0;
+    }
+}
+
+void Buzzer_PlayTune(BuzzerTune_t tune)
+{
+    uint16_t length;
+    const BuzzerNote_t *notes = BuzzerSeq_Tune(tune, &length, NULL);
 
-    // 첫 음표 시작
-    Buzzer_SetFrequency(melody[0].frequency);
+    if (notes != NULL)
+        Buzzer_PlayMelody(notes, length);
 }
 
 /* ===== 정지 ===== */
 void Buzzer_Stop(void)
 {
     if (buzzer_tim != NULL) {
-        HAL_TIM_PWM_Stop(buzzer_tim, buzzer_channel);
+        HAL_TIM_DMABurst_WriteStop(buzzer_tim, TIM_DMA_CC3);
+        __HAL_TIM_SET_COMPARE(buzzer_tim, buzzer_channel, 0);   // 무음 (PWM은 계속)
     }
-    current_melody = NULL;
-    melody_length = 0;
-    melody_index = 0;
-    buzzer_state = 0;
+    playing = 0;
+    tail_silent = 0;
 }
 
-/* ===== 재생 중 확인 ===== */
-uint8_t Buzzer_IsPlaying(void)
+void Buzzer_SetVolume(uint8_t v)
 {
-    return (buzzer_state != 0);
+    volume = v;
 }
 
-/* ===== 업데이트 (메인 루프에서 호출) ===== */
-void Buzzer_Update(void)
+/* ===== 재생 중 확인 ===== */
+uint8_t Buzzer_IsPlaying(void)
 {
-    if (buzzer_state == 0 || current_melody == NULL)
-        return;
-
-    uint32_t now = HAL_GetTick();
-    uint32_t elapsed = now - buzzer_tick;
-
-    if (buzzer_state == 1) {  // 음표 재생 중
-        if (elapsed >= current_melody[melody_index].duration) {
-            // 음표 끝 - 무음으로 전환
-            Buzzer_SetFrequency(0);
-            buzzer_state = 2;  // 쉼표 상태
-            buzzer_tick = now;
-        }
-    }
-    else if (buzzer_state == 2) {  // 쉼표 중
-        if (elapsed >= 30) {  // 30ms 간격
-            melody_index++;
-
-            // 다음 음표 확인
-            if (melody_index >= melody_length ||
-                (current_melody[melody_index].frequency == 0 &&
-                 current_melody[melody_index].duration == 0)) {
-                // 멜로디 종료
-                Buzzer_Stop();
-            }
-            else {
-                // 다음 음표 재생
-                Buzzer_SetFrequency(current_melody[melody_index].frequency);
-                buzzer_state = 1;
-                buzzer_tick = now;
-            }
-        }
-    }
+    return playing;
 }
 
 /* ===== 미리 정의된 멜로디 ===== */
 void Buzzer_PlayMario(void)
 {
-    Buzzer_PlayMelody(mario_theme, sizeof(mario_theme) / sizeof(mario_theme[0]));
+    Buzzer_PlayTune(BUZ_TUNE_MARIO);
 }
 
 void Buzzer_PlayAlert(void)
 {
-    Buzzer_PlayMelody(alert_melody, sizeof(alert_melody) / sizeof(alert_melody[0]));
+    Buzzer_PlayTune(BUZ_TUNE_ALERT);
 }
 
 void Buzzer_PlayElise(void)
 {
-    Buzzer_PlayMelody(elise_melody, sizeof(elise_melody) / sizeof(elise_melody[0]));
+    Buzzer_PlayTune(BUZ_TUNE_ELISE);
 }
 
 void Buzzer_PlayReset(void)
 {
-    Buzzer_PlayMelody(reset_melody, sizeof(reset_melody) / sizeof(reset_melody[0]));
+    Buzzer_PlayTune(BUZ_TUNE_RESET);
 }
 
 void Buzzer_PlayStop(void)
 {
-    Buzzer_PlayMelody(stop_melody, sizeof(stop_melody) / sizeof(stop_melody[0]));
+    Buzzer_PlayTune(BUZ_TUNE_STOP);
 }
 
 void Buzzer_PlayStart(void)
 {
-    Buzzer_PlayMelody(reset_melody, sizeof(reset_melody) / sizeof(reset_melody[0]));
+    Buzzer_PlayTune(BUZ_TUNE_RESET);
 }
 
 void Buzzer_PlayOk(void)
 {
-    Buzzer_PlayMelody(ok_melody, sizeof(ok_melody) / sizeof(ok_melody[0]));
+    Buzzer_PlayTune(BUZ_TUNE_OK);
 }
 
 void Buzzer_PlayPing(void)
 {
-    Buzzer_PlayMelody(idle_ping_melody, sizeof(idle_ping_melody) / sizeof(idle_ping_melody[0]));
+    Buzzer_PlayTune(BUZ_TUNE_PING);
+}
+
+/* ===== 통계 ===== */
+void Buzzer_GetStats(BuzzerStats_t *out)
+{
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    *out = stats;
+    __set_PRIMASK(primask);
+}
+
+void Buzzer_ResetStats(void)
+{
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    stats.melodies = 0;
+    stats.refills = 0;
+    stats.max_fill_cycles = 0;
+    stats.late = 0;
+    __set_PRIMASK(primask);
 }
 
+/**
+ * @brief 부저 상태 - late가 0이 아니면 반쪽 채우기가 DMA보다 늦음 (DMA1 Ch2 우선순위 확인)
+ */
+void Buzzer_PrintStats(void)
+{
+    BuzzerStats_t s;
+    Buzzer_GetStats(&s);
+
+    printf("buzzer %s | melodies %lu refills %lu fill_max %luus late %lu\r\n",
+           playing ? "play" : "idle",
+           (unsigned long)s.melodies, (unsigned long)s.refills,
+           (unsigned long)Time_CyclesToUs(s.max_fill_cycles), (unsigned long)s.late);
+}
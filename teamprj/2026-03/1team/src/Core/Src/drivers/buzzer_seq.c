@@ -0,0 +1,274 @@
+/**
+ * @file buzzer_seq.c
+ * @brief 부저 시퀀서 - 멜로디를 단계 표로 컴파일, 주기별 {ARR, CCR} 생성
+ *
+ * 동작:
+ * 1. Compile: 음표마다 {ARR, 주기 수, 엔벨로프 경계}를 미리 계산 (재생 시작 때 1번)
+ *    - 주기 수 = 주파수 × 길이 → 음 길이가 타이머 주기 단위로 정확 (메인 루프와 무관)
+ *    - 음표 뒤에 BUZ_GAP_MS 무음 단계 (예전 Buzzer_Update의 30ms 간격과 같음)
+ * 2. Fill: DMA 원형 버퍼 절반을 채움 - 주기마다 {ARR, 0, CCR1}
+ *    - CCR1 = (ARR+1)/2 × 엔벨로프 × 음량 → 듀티가 음량
+ *    - 단계 표를 다 쓰면 무음 주기로 채우고 소리 있는 주기 수 0 반환
+ *
+ * 나눗셈은 Compile에서만 (Fill은 곱셈/시프트 + 주기당 나눗셈 1번)
+ */
+
+#include <stddef.h>
+#include "drivers/buzzer_seq.h"
+
+/* ===== 마리오 테마 ===== */
+static const BuzzerNote_t mario_theme[] = {
+    // 첫 번째 구간
+    {NOTE_E7, EIGHTH}, {NOTE_E7, EIGHTH}, {REST, EIGHTH}, {NOTE_E7, EIGHTH},
+    {REST, EIGHTH}, {NOTE_C7, EIGHTH}, {NOTE_E7, EIGHTH}, {REST, EIGHTH},
+    {NOTE_G7, QUARTER}, {REST, QUARTER}, {NOTE_G6, QUARTER}, {REST, QUARTER},
+
+    // 두 번째 구간
+    {NOTE_C7, QUARTER}, {REST, EIGHTH}, {NOTE_G6, EIGHTH}, {REST, EIGHTH},
+    {NOTE_E6, QUARTER}, {REST, EIGHTH}, {NOTE_A6, EIGHTH}, {REST, EIGHTH},
+    {NOTE_B6, EIGHTH}, {REST, EIGHTH}, {NOTE_B6, EIGHTH}, {NOTE_A6, QUARTER},
+
+    // 세 번째 구간
+    {NOTE_G6, EIGHTH}, {NOTE_E7, EIGHTH}, {NOTE_G7, EIGHTH}, {NOTE_A7, QUARTER},
+    {NOTE_F7, EIGHTH}, {NOTE_G7, EIGHTH}, {REST, EIGHTH}, {NOTE_E7, EIGHTH},
+    {REST, EIGHTH}, {NOTE_C7, EIGHTH}, {NOTE_D7, EIGHTH}, {NOTE_B6, QUARTER}
+};
+
+/* ===== 경고음 ===== */
+static const BuzzerNote_t alert_melody[] = {
+    {NOTE_C7, 150},
+    {REST, 100},
+    {NOTE_C7, 150},
+    {REST, 100},
+    {NOTE_C7, 150},
+    {REST, 0}  // 종료
+};
+
+/* ===== 멈춤음 ===== */
+static const BuzzerNote_t stop_melody[] = {
+{NOTE_E5, 180},
+{NOTE_C5, 220},
+{NOTE_G4, 260},
+{REST, 80},
+{NOTE_C4, 400}, // 낮게 길게 = 완전 정지 느낌
+{REST, 0}
+};
+
+/* ===== 오토소리 ===== */
+static const BuzzerNote_t start_melody[] = {
+    {NOTE_G5, 120},
+    {NOTE_C6, 120},
+    {NOTE_E6, 140},   // 점점 밝아짐
+    {REST,    60},
+
+    {NOTE_E6, 120},
+    {NOTE_G6, 160},   // 기대감 상승
+    {REST,    60},
+
+    {NOTE_C7, 260},   // 출발 확정! 밝게 마무리
+    {REST, 0}
+};
+
+/* ===== 리셋음 ===== */
+static const BuzzerNote_t reset_melody[] = {
+{NOTE_C5, 120},
+{NOTE_E5, 120},
+{NOTE_G5, 150},
+{REST, 80},
+{NOTE_C6, 250}, // 위로 마무리 = 리셋 완료 느낌
+{REST, 0}
+};
+
+/* ===== 엘리제를 위하여 (짧은 버전) ===== */
+static const BuzzerNote_t elise_melody[] = {
+    {NOTE_E5, EIGHTH}, {NOTE_D5, EIGHTH},
+    {NOTE_E5, EIGHTH}, {NOTE_D5, EIGHTH},
+    {NOTE_E5, EIGHTH}, {NOTE_B4, EIGHTH},
+    {NOTE_D5, EIGHTH}, {NOTE_C5, EIGHTH},
+    {NOTE_A4, QUARTER},
+    {REST, 0}
+};
+
+/* ===== 확인 소리 (OK!) ===== */
+static const BuzzerNote_t ok_melody[] = {
+    {NOTE_C6, 80},
+    {NOTE_E6, 80},
+    {NOTE_G6, 120},
+    {NOTE_C7, 200},
+    {REST, 0}  // 종료
+};
+
+/* ===== 랜덤 소리 (OK!) ===== */
+static const BuzzerNote_t idle_ping_melody[] = {
+    {NOTE_E6, 120},   // 주인님
+    {NOTE_G6, 120},
+    {NOTE_E6, 120},   // 뭐하세요
+    {NOTE_C6, 150},
+    {REST, 100},      // 살짝 쉬고
+    {NOTE_D6, 120},   // 저
+    {NOTE_E6, 120},   // 여기
+    {NOTE_G6, 150},   // 있어요~
+    {NOTE_C7, 250},   // (강조)
+    {REST, 0}         // 종료
+};
+
+#define TUNE(name, tbl) { tbl, (uint16_t)(sizeof(tbl) / sizeof(tbl[0])), name }
+
+static const struct {
+    const BuzzerNote_t *notes;
+    uint16_t length;
+    const char *name;
+} tunes[BUZ_TUNES] = {
+    [BUZ_TUNE_MARIO] = TUNE("mario", mario_theme),
+    [BUZ_TUNE_ALERT] = TUNE("alert", alert_melody),
+    [BUZ_TUNE_ELISE] = TUNE("elise", elise_melody),
+    [BUZ_TUNE_RESET] = TUNE("reset", reset_melody),
+    [BUZ_TUNE_STOP]  = TUNE("stop",  stop_melody),
+    [BUZ_TUNE_START] = TUNE("start", start_melody),
+    [BUZ_TUNE_OK]    = TUNE("ok",    ok_melody),
+    [BUZ_TUNE_PING]  = TUNE("ping",  idle_ping_melody),
+};
+
+/* ===== 내부 함수 ===== */
+
+static uint8_t Push(BuzzerSeq_t *s, uint16_t freq, uint16_t ms)
+{
+    if (s->n >= BUZ_MAX_STEPS || ms == 0) return 0;
+
+    BuzzerStep_t *st = &s->steps[s->n];
+
+    if (freq == REST)
+    {
+        st->arr = 0;
+        st->periods = ms;                       // 1ms 주기
+        st->attack = st->decay = st->release = 0;
+        s->total_us += (uint32_t)ms * 1000u;
+    }
+    else
+    {
+        uint32_t arr = BUZ_TICK_HZ / freq;      // 주기 (틱)
+        uint32_t periods = ((uint32_t)freq * ms + 500u) / 1000u;
+        if (periods == 0) periods = 1;
+        if (periods > 0xFFFF) periods = 0xFFFF;
+
+        st->arr = (uint16_t)(arr - 1);
+        st->periods = (uint16_t)periods;
+
+        /* 엔벨로프 경계 (주기 단위), 짧은 음은 어택/릴리스가 음 길이의 1/4을 넘지 않게 */
+        uint32_t a = (uint32_t)freq * BUZ_ATTACK_MS / 1000u;
+        uint32_t d = (uint32_t)freq * (BUZ_ATTACK_MS + BUZ_DECAY_MS) / 1000u;
+        uint32_t r = (uint32_t)freq * BUZ_RELEASE_MS / 1000u;
+        if (a > periods / 4) a = periods / 4;
+        if (r > periods / 4) r = periods / 4;
+        if (d > periods - r) d = periods - r;
+        if (d < a) d = a;
+
+        st->attack = (uint16_t)a;
+        st->decay = (uint16_t)d;
+        st->release = (uint16_t)(periods - r);
+        s->total_us += periods * arr;
+    }
+
+    s->n++;
+    return 1;
+}
+
+/**
+ * @brief 단계 안 위치 → 음량 (Q8, 256 = 최대)
+ */
+static uint32_t Envelope(const BuzzerStep_t *st, uint16_t pos)
+{
+    if (pos < st->attack)
+        return 256u * (pos + 1u) / (st->attack + 1u);
+
+    if (pos >= st->release)
+    {
+        uint32_t left = st->periods - pos;      // 1 .. 릴리스 길이
+        uint32_t len = st->periods - st->release;
+        return BUZ_SUSTAIN_Q8 * left / len;
+    }
+
+    if (pos < st->decay)
+    {
+        uint32_t span = st->decay - st->attack;
+        uint32_t k = pos - st->attack;
+        return 256u - (256u - BUZ_SUSTAIN_Q8) * k / span;
+    }
+
+    return BUZ_SUSTAIN_Q8;
+}
+
+/* ===== 외부 API ===== */
+
+const BuzzerNote_t *BuzzerSeq_Tune(BuzzerTune_t t, uint16_t *length, const char **name)
+{
+    if ((unsigned)t >= BUZ_TUNES) return NULL;
+
+    if (length) *length = tunes[t].length;
+    if (name) *name = tunes[t].name;
+    return tunes[t].notes;
+}
+
+/**
+ * @brief 멜로디 → 단계 표 ({REST, 0} 을 만나면 끝)
+ * @return 단계 수 (BUZ_MAX_STEPS에서 잘림)
+ */
+uint16_t BuzzerSeq_Compile(BuzzerSeq_t *s, const BuzzerNote_t *melody, uint16_t length)
+{
+    s->n = 0;
+    s->cur = 0;
+    s->pos = 0;
+    s->total_us = 0;
+
+    for (uint16_t i = 0; i < length; i++)
+    {
+        const BuzzerNote_t *nt = &melody[i];
+        if (nt->frequency == REST && nt->duration == 0) break;
+
+        if (!Push(s, nt->frequency, nt->duration)) break;
+        if (!Push(s, REST, BUZ_GAP_MS)) break;
+    }
+    return s->n;
+}
+
+/**
+ * @brief 주기 periods개를 buf에 ({ARR, 0, CCR1} × periods)
+ * @return 소리 있는 단계에서 나온 주기 수 (0 = 멜로디 끝, 나머지는 무음으로 채움)
+ */
+uint16_t BuzzerSeq_Fill(BuzzerSeq_t *s, uint16_t *buf, uint16_t periods)
+{
+    uint16_t played = 0;
+
+    for (uint16_t i = 0; i < periods; i++, buf += BUZ_WORDS)
+    {
+        while (s->cur < s->n && s->pos >= s->steps[s->cur].periods)
+        {
+            s->cur++;
+            s->pos = 0;
+        }
+
+        buf[1] = 0;
+        if (s->cur >= s->n)
+        {
+            buf[0] = BUZ_REST_ARR;
+            buf[2] = 0;
+            continue;
+        }
+
+        const BuzzerStep_t *st = &s->steps[s->cur];
+        if (st->arr == 0)
+        {
+            buf[0] = BUZ_REST_ARR;
+            buf[2] = 0;
+        }
+        else
+        {
+            uint32_t half = ((uint32_t)st->arr + 1u) >> 1;
+            buf[0] = st->arr;
+            buf[2] = (uint16_t)((half * Envelope(st, s->pos) * s->volume) >> 16);
+        }
+        s->pos++;
+        played++;
+    }
+    return played;
+}
@@ -0,0 +1,292 @@
+/**
+ * @file clcd_i2c.c
+ * @brief HD44780 문자 LCD (PCF8574 I2C 확장) 비동기 드라이버
+ *
+ * 동작:
+ * 1. CLCD_Print()는 화면 버퍼(want)에만 씀 - 버스는 건드리지 않음
+ * 2. CLCD_Flush()는 LCD에 실제로 보낸 내용(shown)과 비교해서 바뀐 칸만 골라
+ *    {DDRAM 주소 명령 + 글자들}의 니블/EN 펄스를 버퍼 하나에 모아 I2C 전송 1번으로 보냄
+ *    - 바뀐 칸 사이에 안 바뀐 칸이 1개면 그냥 다시 씀 (주소 명령과 같은 4바이트)
+ *    - 주소는 자동 증가하므로 이어지는 칸은 주소 명령 생략
+ * 3. 전송은 인터럽트(HAL_I2C_Master_Transmit_IT) → 호출한 쪽은 기다리지 않음
+ *    전송 중에 Flush를 부르면 바로 리턴하고, 쌓인 변경은 다음 Flush에서 보냄
+ *
+ * 타이밍: 100kHz에서 PCF8574 쓰기 1번 = 약 90us
+ *         → EN 펄스 폭(450ns), 명령 실행 시간(37us)이 버스 속도만으로 충족되므로 지연 루프 없음
+ *         (클리어/홈 명령(1.5ms)은 Init에서만 사용, 이후 지우기는 공백 글자로)
+ *
+ * DMA: F103은 I2C1_TX가 DMA1 채널6 고정인데 USART2 RX(uart_link.c)가 사용 중 → 인터럽트 전송
+ *
+ * 에러: NACK 등으로 전송이 끊기면 LCD 내용을 알 수 없으므로 다음 Flush에서 화면 전체 다시 보냄
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "drivers/clcd_i2c.h"
+
+static I2C_HandleTypeDef *clcd_i2c = NULL;
+static uint16_t clcd_addr = 0;
+static uint8_t  clcd_cols = 16;
+static uint8_t  clcd_rows = 2;
+static uint8_t  row_base[CLCD_MAX_ROWS];
+
+static char want[CLCD_MAX_ROWS][CLCD_MAX_COLS];     // 그리고 싶은 화면
+static char shown[CLCD_MAX_ROWS][CLCD_MAX_COLS];    // LCD에 보낸 화면
+static uint8_t dirty = 0;                           // want != shown 일 수 있음
+static uint8_t cursor = 0xFF;                       // LCD의 다음 DDRAM 주소 (0xFF = 모름)
+
+static uint8_t batch[CLCD_BATCH_MAX];
+static volatile uint8_t busy = 0;
+static volatile uint8_t resync = 0;                 // 에러 → shown 무효
+
+static ClcdStats_t stats;
+
+/* ===== 내부 함수 ===== */
+
+/**
+ * @brief HD44780 1바이트 = 니블 2개 × (EN=1, EN=0) = PCF8574 쓰기 4번
+ */
+static uint8_t Pack(uint8_t *p, uint8_t value, uint8_t rs)
+{
+    uint8_t hi = (value & 0xF0) | CLCD_BL | rs;
+    uint8_t lo = (uint8_t)(value << 4) | CLCD_BL | rs;
+
+    p[0] = hi | CLCD_EN;
+    p[1] = hi;
+    p[2] = lo | CLCD_EN;
+    p[3] = lo;
+    return 4;
+}
+
+static HAL_StatusTypeDef Send_Blocking(const uint8_t *p, uint16_t len)
+{
+    return HAL_I2C_Master_Transmit(clcd_i2c, clcd_addr, (uint8_t *)p, len, 10);
+}
+
+/* 초기화 전용: 8비트 모드에서 상위 니블만 */
+static HAL_StatusTypeDef Init_Nibble(uint8_t nibble)
+{
+    uint8_t p[2] = { (uint8_t)(nibble << 4) | CLCD_BL | CLCD_EN, (uint8_t)(nibble << 4) | CLCD_BL };
+    return Send_Blocking(p, 2);
+}
+
+static HAL_StatusTypeDef Init_Cmd(uint8_t cmd)
+{
+    uint8_t p[4];
+    return Send_Blocking(p, Pack(p, cmd, 0));
+}
+
+/* ===== 외부 API ===== */
+
+/**
+ * @brief 4비트 모드 초기화 + 화면 지우기 (부팅 시 1회, 블로킹)
+ * @param addr7 PCF8574 7비트 주소 (보통 0x27, PCF8574A는 0x3F)
+ */
+HAL_StatusTypeDef CLCD_Init(I2C_HandleTypeDef *hi2c, uint8_t addr7, uint8_t cols, uint8_t rows)
+{
+    uint32_t err = 0;
+
+    clcd_i2c  = hi2c;
+    clcd_addr = (uint16_t)(addr7 << 1);
+    clcd_cols = (cols > CLCD_MAX_COLS) ? CLCD_MAX_COLS : cols;
+    clcd_rows = (rows > CLCD_MAX_ROWS) ? CLCD_MAX_ROWS : rows;
+
+    /* 3·4번째 줄은 1·2번째 줄 바로 뒤 주소 (16x4: 0x10/0x50, 20x4: 0x14/0x54) */
+    row_base[0] = 0x00;
+    row_base[1] = 0x40;
+    row_base[2] = clcd_cols;
+    row_base[3] = 0x40 + clcd_cols;
+
+    HAL_Delay(50);                      // 전원 인가 후 40ms 이상
+
+    err |= Init_Nibble(0x03); HAL_Delay(5);
+    err |= Init_Nibble(0x03); HAL_Delay(1);
+    err |= Init_Nibble(0x03); HAL_Delay(1);
+    err |= Init_Nibble(0x02); HAL_Delay(1);   // 4비트 모드
+
+    err |= Init_Cmd(0x28);               // 4비트, 2줄(4줄 LCD도 같음), 5x8
+    err |= Init_Cmd(0x08);               // 화면 끔
+    err |= Init_Cmd(0x01);               // 지우기
+    HAL_Delay(2);
+    err |= Init_Cmd(0x06);               // 주소 자동 증가
+    err |= Init_Cmd(0x0C);               // 화면 켬, 커서 없음
+
+    memset(want, ' ', sizeof(want));
+    memset(shown, ' ', sizeof(shown));
+    dirty  = 0;
+    cursor = 0x00;
+    busy   = 0;
+    resync = (err != 0);
+
+    return err ? HAL_ERROR : HAL_OK;
+}
+
+void CLCD_Clear(void)
+{
+    for (uint8_t y = 0; y < clcd_rows; y++)
+        CLCD_PrintLine(y, "");
+}
+
+void CLCD_Print(uint8_t x, uint8_t y, const char *str)
+{
+    if (y >= clcd_rows) return;
+
+    for (; *str && x < clcd_cols; str++, x++)
+    {
+        if (want[y][x] != *str)
+        {
+            want[y][x] = *str;
+            dirty = 1;
+        }
+    }
+}
+
+void CLCD_PrintLine(uint8_t y, const char *str)
+{
+    if (y >= clcd_rows) return;
+
+    uint8_t n = (uint8_t)strnlen(str, clcd_cols);
+    CLCD_Print(0, y, str);
+
+    for (uint8_t x = n; x < clcd_cols; x++)
+    {
+        if (want[y][x] != ' ')
+        {
+            want[y][x] = ' ';
+            dirty = 1;
+        }
+    }
+}
+
+/**
+ * @brief 바뀐 칸을 모아 I2C 전송 시작 (기다리지 않음)
+ * @return 1 = 전송 시작, 0 = 보낼 것 없음/이전 전송 중
+ */
+uint8_t CLCD_Flush(void)
+{
+    if (clcd_i2c == NULL) return 0;
+
+    if (busy)
+    {
+        if (dirty) stats.busy_skips++;
+        return 0;
+    }
+
+    if (resync)
+    {
+        resync = 0;
+        memset(shown, 0, sizeof(shown));    // 어떤 글자와도 다름 → 전부 다시 보냄
+        cursor = 0xFF;
+        dirty  = 1;
+    }
+
+    if (!dirty) return 0;
+
+    uint16_t n = 0;
+    uint8_t  done = 1;
+
+    for (uint8_t y = 0; y < clcd_rows && done; y++)
+    {
+        uint8_t x = 0;
+        while (x < clcd_cols)
+        {
+            if (want[y][x] == shown[y][x]) { x++; continue; }
+
+            /* 바뀐 칸 구간 [x, end) - 안 바뀐 칸 1개 사이는 이어 붙임 */
+            uint8_t end = x + 1;
+            while (end < clcd_cols)
+            {
+                if (want[y][end] != shown[y][end]) end++;
+                else if (end + 1 < clcd_cols && want[y][end + 1] != shown[y][end + 1]) end += 2;
+                else break;
+            }
+
+            uint8_t addr = row_base[y] + x;
+            uint16_t need = (uint16_t)(end - x) * 4 + (addr != cursor ? 4 : 0);
+            if (n + need > CLCD_BATCH_MAX) { done = 0; break; }    // 나머지는 다음 Flush
+
+            if (addr != cursor)
+            {
+                n += Pack(&batch[n], 0x80 | addr, 0);
+                stats.addr_cmds++;
+            }
+            for (uint8_t i = x; i < end; i++)
+            {
+                n += Pack(&batch[n], (uint8_t)want[y][i], CLCD_RS);
+                shown[y][i] = want[y][i];
+            }
+            stats.cells += end - x;
+            cursor = addr + (end - x);
+            x = end;
+        }
+    }
+
+    dirty = !done;
+    if (n == 0) return 0;
+
+    busy = 1;
+    if (HAL_I2C_Master_Transmit_IT(clcd_i2c, clcd_addr, batch, n) != HAL_OK)
+    {
+        busy = 0;
+        resync = 1;
+        stats.errors++;
+        return 0;
+    }
+
+    stats.flushes++;
+    stats.bytes += n;
+    if (n > stats.max_bytes) stats.max_bytes = n;
+    return 1;
+}
+
+uint8_t CLCD_Busy(void)
+{
+    return busy;
+}
+
+void CLCD_Invalidate(void)
+{
+    resync = 1;
+}
+
+void CLCD_GetStats(ClcdStats_t *out)
+{
+    *out = stats;
+}
+
+void CLCD_ResetStats(void)
+{
+    stats = (ClcdStats_t){ 0 };
+}
+
+/**
+ * @brief 전송 통계 - B/flush가 갱신 1번에 실제로 버스에 나간 바이트
+ */
+void CLCD_PrintStats(void)
+{
+    uint32_t avg = stats.flushes ? stats.bytes / stats.flushes : 0;
+
+    printf("clcd flush bytes    B/flush max | cells addr | skip err\r\n");
+    printf("     %-5lu %-7lu %-7lu %-3lu | %-5lu %-4lu | %-4lu %lu\r\n",
+           (unsigned long)stats.flushes, (unsigned long)stats.bytes, (unsigned long)avg,
+           (unsigned long)stats.max_bytes, (unsigned long)stats.cells, (unsigned long)stats.addr_cmds,
+           (unsigned long)stats.busy_skips, (unsigned long)stats.errors);
+}
+
+/* ===== HAL 콜백 ===== */
+
+void HAL_I2C_MasterTxCpltCallback(I2C_HandleTypeDef *hi2c)
+{
+    if (hi2c == clcd_i2c)
+        busy = 0;
+}
+
+void HAL_I2C_ErrorCallback(I2C_HandleTypeDef *hi2c)
+{
+    if (hi2c == clcd_i2c)
+    {
+        busy = 0;
+        resync = 1;
+        stats.errors++;
+    }
+}
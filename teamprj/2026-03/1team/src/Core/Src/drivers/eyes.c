@@ -5,15 +5,23 @@
  * 최적화 내용:
  * 1. dirty flag로 변경 시에만 그리기
  * 2. 중복 호출 방지
- * 3. 영역 클리어 최적화
+ * 3. 밴드 합성기(lcd_band)로 RAM 합성 → 바뀐 밴드만 전송 (클리어/깜빡임 없음)
+ * 4. 고정 표정은 플래시 RLE 아틀라스(eyes_atlas.c)에서 바로 전송 (래스터라이즈 생략)
+ * 5. 표정 전환 중간 프레임은 파라메트릭 모양(EyeShape_t)으로 그림 (anim.c 트윈)
+ * 6. EYES_USE_PALFB 1: 밴드 합성기 대신 2bpp 팔레트 프레임버퍼(lcd_pal) - 그리기는 memset,
+ *    전송은 바뀐 행만 DMA 중에 RGB565로 확장 (RAM 5KB 밴드 버퍼 → 3.2KB + 행 정보 0.6KB)
  */
 
 #include "drivers/eyes.h"
 #include "drivers/lcd_st7735.h"
 #include "drivers/lcd_gfx.h"
+#include "drivers/lcd_band.h"
+#include "drivers/lcd_pal.h"
+#include "drivers/eyes_atlas.h"
 #include "main.h"
 #include "stm32f1xx_hal.h"   // MCU 시리즈에 맞게
-#define ANIM_FRAME_MS 250     //눈 애니 프레임  4 FPS (1000/250)
+#define EYES_USE_ATLAS 1      // 1: 플래시 아틀라스 사용, 0: 매번 도형 래스터라이즈
+#define EYES_USE_PALFB 1      // 1: 팔레트 프레임버퍼(lcd_pal), 0: 밴드 합성기(lcd_band)
 extern volatile uint8_t servo_moving;
 /* ===== 색상 정의 ===== */
 #define BLACK       0x0000
@@ -24,31 +32,46 @@ extern volatile uint8_t servo_moving;
 #define RX  120     // 오른쪽 눈 X
 #define CY  40      // 눈 Y (중앙)
 
-/* ===== 눈 영역 크기 (클리어용) ===== */
-#define EYE_W   60
-#define EYE_H   80
-#define EYE_Y   (CY - 40)
+/* ===== 그리기 대상 (두 합성기의 도형 API가 같음) ===== */
+#if EYES_USE_PALFB
+#define Canvas_Begin        Pal_Begin
+#define Canvas_Add          Pal_Add
+#define Canvas_FillRect     Pal_FillRect
+#define Canvas_RoundRect    Pal_RoundRect
+#define Canvas_ThickLine    Pal_ThickLine
+#define Canvas_Commit       Pal_Commit
+#define Canvas_Invalidate   Pal_Invalidate
+#else
+#define Canvas_Begin        Band_Begin
+#define Canvas_Add          Band_Add
+#define Canvas_FillRect     Band_FillRect
+#define Canvas_RoundRect    Band_RoundRect
+#define Canvas_ThickLine    Band_ThickLine
+#define Canvas_Commit       Band_Commit
+#define Canvas_Invalidate   Band_Invalidate
+#endif
 
 /* ===== 상태 관리 ===== */
 static Expression_t current_expr = EXPR_NEUTRAL;
 static uint8_t dirty = 1;  // 처음엔 그려야 함
 
 /* ===== 내부 함수 ===== */
+/* Eye_* 도형을 바꾸면 tools/gen_eyes_atlas.py 도 같이 고치고 다시 생성할 것 */
 
 static void Eye_Normal(int16_t cx)
 {
-    LCD_RoundRect(cx - 15, CY - 25, 30, 50, 10, EYE_COLOR);
+    Canvas_RoundRect(cx - 15, CY - 25, 30, 50, 10, EYE_COLOR);
 }
 
 static void Eye_Closed(int16_t cx)
 {
-    LCD_FillRect(cx - 15, CY - 3, 30, 6, EYE_COLOR);
+    Canvas_FillRect(cx - 15, CY - 3, 30, 6, EYE_COLOR);
 }
 
 static void Eye_Happy(int16_t cx)
 {
     /* 반원 형태 (웃는 눈) */
-    LCD_RoundRect(cx - 15, CY - 5, 30, 25, 12, EYE_COLOR);
+    Canvas_RoundRect(cx - 15, CY - 5, 30, 25, 12, EYE_COLOR);
 }
 
 static void Eye_Angry(int16_t cx, int8_t dir)
@@ -59,7 +82,7 @@ static void Eye_Angry(int16_t cx, int8_t dir)
     int16_t y0 = CY - 20 + (dir < 0 ? 15 : 0);
     int16_t y1 = CY - 20 + (dir < 0 ? 0 : 15);
 
-    LCD_ThickLine(x0, y0, x1, y1, 4, EYE_COLOR);
+    Canvas_ThickLine(x0, y0, x1, y1, 4, EYE_COLOR);
 }
 
 static void Eye_Sad(int16_t cx, int8_t dir)
@@ -70,29 +93,65 @@ static void Eye_Sad(int16_t cx, int8_t dir)
     int16_t y0 = CY - 10 + (dir < 0 ? 0 : 8);
     int16_t y1 = CY - 10 + (dir < 0 ? 8 : 0);
 
-    LCD_ThickLine(x0, y0, x1, y1, 3, EYE_COLOR);
-    LCD_FillRect(cx - 10, CY, 20, 4, EYE_COLOR);
+    Canvas_ThickLine(x0, y0, x1, y1, 3, EYE_COLOR);
+    Canvas_FillRect(cx - 10, CY, 20, 4, EYE_COLOR);
 }
 
 static void Eye_LookLeft(int16_t cx)
 {
     /* 왼쪽을 보는 눈 (동공 위치 이동) */
-    LCD_RoundRect(cx - 15, CY - 25, 30, 50, 10, EYE_COLOR);
-    LCD_FillRect(cx - 12, CY - 10, 8, 20, BLACK);  // 왼쪽에 동공
+    Canvas_RoundRect(cx - 15, CY - 25, 30, 50, 10, EYE_COLOR);
+    Canvas_FillRect(cx - 12, CY - 10, 8, 20, BLACK);  // 왼쪽에 동공
 }
 
 static void Eye_LookRight(int16_t cx)
 {
     /* 오른쪽을 보는 눈 */
-    LCD_RoundRect(cx - 15, CY - 25, 30, 50, 10, EYE_COLOR);
-    LCD_FillRect(cx + 4, CY - 10, 8, 20, BLACK);  // 오른쪽에 동공
+    Canvas_RoundRect(cx - 15, CY - 25, 30, 50, 10, EYE_COLOR);
+    Canvas_FillRect(cx + 4, CY - 10, 8, 20, BLACK);  // 오른쪽에 동공
 }
 
-static void ClearEyeArea(void)
+/* ===== 파라메트릭 모양 테이블 (Expression_t 순서) ===== */
+/* 끝 프레임은 위 Eye_* 도형(아틀라스)으로 그리므로 근사치면 충분 */
+static const EyeShape_t eye_shapes[] = {
+    /*               cy               w           h           r           lid          pupil_x      pupil_w     pupil_h */
+    [EXPR_NEUTRAL]    = { EYE_Q8(40),   EYE_Q8(30), EYE_Q8(50), EYE_Q8(10), EYE_Q8(0),   EYE_Q8(0),   EYE_Q8(0),  EYE_Q8(0)  },
+    [EXPR_BLINK]      = { EYE_Q8(40),   EYE_Q8(30), EYE_Q8(6),  EYE_Q8(1),  EYE_Q8(0),   EYE_Q8(0),   EYE_Q8(0),  EYE_Q8(0)  },
+    [EXPR_HAPPY]      = { EYE_Q8(47.5), EYE_Q8(30), EYE_Q8(25), EYE_Q8(12), EYE_Q8(0),   EYE_Q8(0),   EYE_Q8(0),  EYE_Q8(0)  },
+    [EXPR_ANGRY]      = { EYE_Q8(27.5), EYE_Q8(30), EYE_Q8(7),  EYE_Q8(3),  EYE_Q8(-15), EYE_Q8(0),   EYE_Q8(0),  EYE_Q8(0)  },
+    [EXPR_SLEEPY]     = { EYE_Q8(40),   EYE_Q8(30), EYE_Q8(6),  EYE_Q8(1),  EYE_Q8(0),   EYE_Q8(0),   EYE_Q8(0),  EYE_Q8(0)  },
+    [EXPR_SAD]        = { EYE_Q8(34),   EYE_Q8(24), EYE_Q8(5),  EYE_Q8(2),  EYE_Q8(8),   EYE_Q8(0),   EYE_Q8(0),  EYE_Q8(0)  },
+    [EXPR_LOOK_LEFT]  = { EYE_Q8(40),   EYE_Q8(30), EYE_Q8(50), EYE_Q8(10), EYE_Q8(0),   EYE_Q8(-8),  EYE_Q8(8),  EYE_Q8(20) },
+    [EXPR_LOOK_RIGHT] = { EYE_Q8(40),   EYE_Q8(30), EYE_Q8(50), EYE_Q8(10), EYE_Q8(0),   EYE_Q8(8),   EYE_Q8(8),  EYE_Q8(20) },
+};
+
+static int16_t Q8_Round(int16_t v)
 {
-    /* 양쪽 눈 영역만 클리어 (전체 화면 X) */
-    LCD_FillRect(LX - 25, EYE_Y, EYE_W, EYE_H, BLACK);
-    LCD_FillRect(RX - 25, EYE_Y, EYE_W, EYE_H, BLACK);
+    return (int16_t)((v + 128) >> 8);
+}
+
+/**
+ * @brief 파라메트릭 눈 하나를 디스플레이 리스트에 추가
+ * @param dir -1 = 왼쪽 눈, +1 = 오른쪽 눈 (눈꺼풀 기울기 좌우 대칭)
+ */
+static void Eye_Shape(int16_t cx, int8_t dir, const EyeShape_t *e)
+{
+    int16_t w    = Q8_Round(e->w);
+    int16_t h    = Q8_Round(e->h);
+    int16_t skew = Q8_Round(dir < 0 ? e->lid : -e->lid);
+    int16_t cy   = Q8_Round(e->cy);
+    if (w < 1 || h < 1) return;
+
+    /* 기울여도 중심이 cy에 오도록 시작 Y를 skew/2 만큼 올림 */
+    int16_t x0 = cx - w / 2;
+    int16_t y0 = cy - h / 2 - skew / 2;
+    GfxShape_t s = { GFX_RRECT, x0, y0, x0 + w - 1, y0 + h - 1, Q8_Round(e->r), EYE_COLOR, skew };
+    Canvas_Add(&s);
+
+    int16_t pw = Q8_Round(e->pupil_w);
+    int16_t ph = Q8_Round(e->pupil_h);
+    if (pw >= 1 && ph >= 1)
+        Canvas_FillRect(cx + Q8_Round(e->pupil_x) - pw / 2, cy - ph / 2, pw, ph, BLACK);
 }
 
 /* ===== 외부 API ===== */
@@ -102,7 +161,21 @@ static void ClearEyeArea(void)
  */
 void Eyes_Draw(Expression_t expr)
 {
-    ClearEyeArea();
+#if EYES_USE_ATLAS
+    if ((unsigned)expr < EYES_ATLAS_EXPR_COUNT)
+    {
+#if EYES_USE_PALFB
+        Pal_DrawRle(eyes_atlas_bands[expr], eyes_atlas_runs, eyes_atlas_palette);
+        Pal_Commit();
+#else
+        Band_CommitRle(eyes_atlas_bands[expr], eyes_atlas_runs, eyes_atlas_palette);
+#endif
+        dirty = 0;
+        return;
+    }
+#endif
+
+    Canvas_Begin(BLACK);
 
     switch (expr)
     {
@@ -152,6 +225,7 @@ void Eyes_Draw(Expression_t expr)
             break;
     }
 
+    Canvas_Commit();
     dirty = 0;
 }
 
@@ -196,5 +270,28 @@ void Eyes_Update(void)
  */
 void Eyes_Invalidate(void)
 {
+    Canvas_Invalidate();
     dirty = 1;
 }
+
+/**
+ * @brief 표정의 파라메트릭 모양 (트윈 시작/끝 값)
+ */
+void Eyes_GetShape(Expression_t expr, EyeShape_t *out)
+{
+    if ((unsigned)expr >= sizeof(eye_shapes) / sizeof(eye_shapes[0]))
+        expr = EXPR_NEUTRAL;
+    *out = eye_shapes[expr];
+}
+
+/**
+ * @brief 파라메트릭 모양으로 두 눈 그리기 (바뀐 밴드/열만 전송)
+ * @note  표정(current_expr)과 dirty는 건드리지 않음 → 트윈이 끝나면 Eyes_Update가 정확한 표정으로 마무리
+ */
+uint8_t Eyes_DrawShape(const EyeShape_t *s)
+{
+    Canvas_Begin(BLACK);
+    Eye_Shape(LX, -1, s);
+    Eye_Shape(RX, +1, s);
+    return Canvas_Commit();
+}
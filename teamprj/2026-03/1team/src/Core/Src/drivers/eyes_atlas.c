@@ -0,0 +1,169 @@
+/**
+ * @file eyes_atlas.c
+ * @brief 눈 표정 RLE 아틀라스 (tools/gen_eyes_atlas.py 로 생성, 직접 수정 금지)
+ */
+
+#include "drivers/eyes_atlas.h"
+
+const uint16_t eyes_atlas_palette[2] = {
+    0x0000, 0x07E0
+};
+
+const uint16_t eyes_atlas_runs[EYES_ATLAS_RUN_COUNT] = {
+    0x04FF, 0x047F, 0x100F, 0x003F, 0x100F, 0x001F, 0x001D, 0x1013, 0x003B, 0x1013, 0x003A, 0x1015,
+    0x0039, 0x1015, 0x0038, 0x1017, 0x0037, 0x1017, 0x0036, 0x1019, 0x0035, 0x1019, 0x0034, 0x101B,
+    0x0033, 0x101B, 0x0033, 0x101B, 0x0033, 0x101B, 0x0032, 0x101D, 0x0031, 0x101D, 0x0031, 0x101D,
+    0x0031, 0x101D, 0x0018, 0x0018, 0x101D, 0x0031, 0x101D, 0x0031, 0x101D, 0x0031, 0x101D, 0x0031,
+    0x101D, 0x0031, 0x101D, 0x0031, 0x101D, 0x0031, 0x101D, 0x0031, 0x101D, 0x0031, 0x101D, 0x0031,
+    0x101D, 0x0031, 0x101D, 0x0031, 0x101D, 0x0031, 0x101D, 0x0031, 0x101D, 0x0031, 0x101D, 0x0018,
+    0x0018, 0x101D, 0x0031, 0x101D, 0x0031, 0x101D, 0x0031, 0x101D, 0x0032, 0x101B, 0x0033, 0x101B,
+    0x0033, 0x101B, 0x0033, 0x101B, 0x0034, 0x1019, 0x0035, 0x1019, 0x0036, 0x1017, 0x0037, 0x1017,
+    0x0038, 0x1015, 0x0039, 0x1015, 0x003A, 0x1013, 0x003B, 0x1013, 0x001D, 0x001F, 0x100F, 0x003F,
+    0x100F, 0x047F, 0x0338, 0x101D, 0x0031, 0x101D, 0x0031, 0x101D, 0x0031, 0x101D, 0x0031, 0x101D,
+    0x0031, 0x101D, 0x0018, 0x0018, 0x101D, 0x0031, 0x101D, 0x0031, 0x101D, 0x0031, 0x101D, 0x0031,
+    0x101D, 0x0031, 0x101D, 0x0338, 0x0201, 0x100B, 0x0043, 0x100B, 0x0041, 0x100F, 0x003F, 0x100F,
+    0x003D, 0x1013, 0x003B, 0x1013, 0x003A, 0x1015, 0x0039, 0x1015, 0x0038, 0x1017, 0x0037, 0x1017,
+    0x001B, 0x001A, 0x1019, 0x0035, 0x1019, 0x0035, 0x1019, 0x0035, 0x1019, 0x0034, 0x101B, 0x0033,
+    0x101B, 0x0033, 0x101B, 0x0033, 0x101B, 0x0032, 0x101D, 0x0031, 0x101D, 0x0031, 0x101D, 0x0031,
+    0x101D, 0x0031, 0x101D, 0x0031, 0x101D, 0x0031, 0x101D, 0x0031, 0x101D, 0x0018, 0x0018, 0x101D,
+    0x0031, 0x101D, 0x0031, 0x101D, 0x0031, 0x101D, 0x0031, 0x101D, 0x0031, 0x101D, 0x0032, 0x101B,
+    0x0033, 0x101B, 0x0033, 0x101B, 0x0033, 0x101B, 0x0034, 0x1019, 0x0035, 0x1019, 0x0035, 0x1019,
+    0x0035, 0x1019, 0x0036, 0x1017, 0x0037, 0x1017, 0x001B, 0x001C, 0x1015, 0x0039, 0x1015, 0x003A,
+    0x1013, 0x003B, 0x1013, 0x003D, 0x100F, 0x003F, 0x100F, 0x0041, 0x100B, 0x0043, 0x100B, 0x02A1,
+    0x0175, 0x1002, 0x002E, 0x1003, 0x0067, 0x1005, 0x002C, 0x1006, 0x0063, 0x1007, 0x002C, 0x1008,
+    0x005F, 0x1009, 0x002C, 0x100A, 0x005B, 0x100A, 0x002E, 0x100B, 0x0057, 0x100B, 0x0031, 0x100B,
+    0x0029, 0x0029, 0x100B, 0x0035, 0x100B, 0x004F, 0x100B, 0x0039, 0x100B, 0x004B, 0x100B, 0x003D,
+    0x100B, 0x0047, 0x100B, 0x0041, 0x100B, 0x0043, 0x100B, 0x0045, 0x100B, 0x003F, 0x100B, 0x0049,
+    0x100B, 0x003B, 0x100B, 0x004D, 0x100B, 0x0037, 0x100B, 0x0051, 0x100B, 0x0019, 0x0019, 0x100B,
+    0x0055, 0x100B, 0x002F, 0x100B, 0x0059, 0x100A, 0x002D, 0x100A, 0x005D, 0x1009, 0x002C, 0x1008,
+    0x0061, 0x1007, 0x002C, 0x1006, 0x0065, 0x1005, 0x002D, 0x1003, 0x0069, 0x1002, 0x0156, 0x033A,
+    0x1003, 0x0062, 0x1003, 0x0034, 0x1006, 0x005C, 0x1006, 0x0034, 0x1009, 0x0056, 0x1009, 0x0019,
+    0x001C, 0x100A, 0x0050, 0x100A, 0x003B, 0x100A, 0x004A, 0x100A, 0x0041, 0x100A, 0x0044, 0x100A,
+    0x0047, 0x100A, 0x003E, 0x100A, 0x004D, 0x100A, 0x0038, 0x100A, 0x0053, 0x1009, 0x0034, 0x1009,
+    0x0059, 0x1006, 0x0034, 0x1006, 0x005F, 0x1003, 0x0034, 0x1003, 0x0030, 0x001D, 0x1013, 0x003B,
+    0x1013, 0x003B, 0x1013, 0x003B, 0x1013, 0x003B, 0x1013, 0x003B, 0x1013, 0x003B, 0x1013, 0x003B,
+    0x1013, 0x029D, 0x0018, 0x101D, 0x0031, 0x101D, 0x0031, 0x101D, 0x0031, 0x101D, 0x0031, 0x101D,
+    0x0031, 0x101D, 0x0031, 0x101D, 0x0031, 0x101D, 0x0031, 0x101D, 0x0031, 0x101D, 0x0031, 0x101D,
+    0x0031, 0x101D, 0x0031, 0x1002, 0x0007, 0x1012, 0x0031, 0x1002, 0x0007, 0x1012, 0x0031, 0x1002,
+    0x0007, 0x1012, 0x0031, 0x1002, 0x0007, 0x1012, 0x0018, 0x0018, 0x1002, 0x0007, 0x1012, 0x0031,
+    0x1002, 0x0007, 0x1012, 0x0031, 0x1002, 0x0007, 0x1012, 0x0031, 0x1002, 0x0007, 0x1012, 0x0031,
+    0x1002, 0x0007, 0x1012, 0x0031, 0x1002, 0x0007, 0x1012, 0x0031, 0x1002, 0x0007, 0x1012, 0x0031,
+    0x1002, 0x0007, 0x1012, 0x0031, 0x1002, 0x0007, 0x1012, 0x0031, 0x1002, 0x0007, 0x1012, 0x0031,
+    0x1002, 0x0007, 0x1012, 0x0031, 0x1002, 0x0007, 0x1012, 0x0031, 0x1002, 0x0007, 0x1012, 0x0031,
+    0x1002, 0x0007, 0x1012, 0x0031, 0x1002, 0x0007, 0x1012, 0x0031, 0x1002, 0x0007, 0x1012, 0x0018,
+    0x0018, 0x1002, 0x0007, 0x1012, 0x0031, 0x1002, 0x0007, 0x1012, 0x0031, 0x1002, 0x0007, 0x1012,
+    0x0031, 0x1002, 0x0007, 0x1012, 0x0031, 0x101D, 0x0031, 0x101D, 0x0031, 0x101D, 0x0031, 0x101D,
+    0x0031, 0x101D, 0x0031, 0x101D, 0x0031, 0x101D, 0x0031, 0x101D, 0x0031, 0x101D, 0x0031, 0x101D,
+    0x0031, 0x101D, 0x0031, 0x101D, 0x0018, 0x0018, 0x101D, 0x0031, 0x101D, 0x0031, 0x101D, 0x0031,
+    0x101D, 0x0031, 0x101D, 0x0031, 0x101D, 0x0031, 0x101D, 0x0031, 0x101D, 0x0031, 0x101D, 0x0031,
+    0x101D, 0x0031, 0x101D, 0x0031, 0x101D, 0x0031, 0x1012, 0x0007, 0x1002, 0x0031, 0x1012, 0x0007,
+    0x1002, 0x0031, 0x1012, 0x0007, 0x1002, 0x0031, 0x1012, 0x0007, 0x1002, 0x0018, 0x0018, 0x1012,
+    0x0007, 0x1002, 0x0031, 0x1012, 0x0007, 0x1002, 0x0031, 0x1012, 0x0007, 0x1002, 0x0031, 0x1012,
+    0x0007, 0x1002, 0x0031, 0x1012, 0x0007, 0x1002, 0x0031, 0x1012, 0x0007, 0x1002, 0x0031, 0x1012,
+    0x0007, 0x1002, 0x0031, 0x1012, 0x0007, 0x1002, 0x0031, 0x1012, 0x0007, 0x1002, 0x0031, 0x1012,
+    0x0007, 0x1002, 0x0031, 0x1012, 0x0007, 0x1002, 0x0031, 0x1012, 0x0007, 0x1002, 0x0031, 0x1012,
+    0x0007, 0x1002, 0x0031, 0x1012, 0x0007, 0x1002, 0x0031, 0x1012, 0x0007, 0x1002, 0x0031, 0x1012,
+    0x0007, 0x1002, 0x0018, 0x0018, 0x1012, 0x0007, 0x1002, 0x0031, 0x1012, 0x0007, 0x1002, 0x0031,
+    0x1012, 0x0007, 0x1002, 0x0031, 0x1012, 0x0007, 0x1002, 0x0031, 0x101D, 0x0031, 0x101D, 0x0031,
+    0x101D, 0x0031, 0x101D, 0x0031, 0x101D, 0x0031, 0x101D, 0x0031, 0x101D, 0x0031, 0x101D, 0x0031,
+    0x101D, 0x0031, 0x101D, 0x0031, 0x101D, 0x0031, 0x101D, 0x0018,
+};
+
+const BandRle_t eyes_atlas_bands[EYES_ATLAS_EXPR_COUNT][BAND_COUNT] = {
+    { /* EXPR_NEUTRAL */
+        {    0,   1, 0x09D6A1C5u, 255,   0 },
+        {    1,   5, 0xA87EABC5u,  32, 127 },
+        {    6,  33, 0xE6EB4A45u,  25, 134 },
+        {   39,  33, 0x04E76DC5u,  25, 134 },
+        {   39,  33, 0x04E76DC5u,  25, 134 },
+        {   39,  33, 0x04E76DC5u,  25, 134 },
+        {   39,  33, 0x04E76DC5u,  25, 134 },
+        {   72,  33, 0xDD542A45u,  25, 134 },
+        {  105,   5, 0x5AE6ABC5u,  32, 127 },
+        {    0,   1, 0x09D6A1C5u, 255,   0 },
+    },
+    { /* EXPR_BLINK */
+        {    0,   1, 0x09D6A1C5u, 255,   0 },
+        {    0,   1, 0x09D6A1C5u, 255,   0 },
+        {    0,   1, 0x09D6A1C5u, 255,   0 },
+        {    0,   1, 0x09D6A1C5u, 255,   0 },
+        {  110,  13, 0x0261EE45u,  25, 134 },
+        {  123,  13, 0xF470AE45u,  25, 134 },
+        {    0,   1, 0x09D6A1C5u, 255,   0 },
+        {    0,   1, 0x09D6A1C5u, 255,   0 },
+        {    0,   1, 0x09D6A1C5u, 255,   0 },
+        {    0,   1, 0x09D6A1C5u, 255,   0 },
+    },
+    { /* EXPR_HAPPY */
+        {    0,   1, 0x09D6A1C5u, 255,   0 },
+        {    0,   1, 0x09D6A1C5u, 255,   0 },
+        {    0,   1, 0x09D6A1C5u, 255,   0 },
+        {    0,   1, 0x09D6A1C5u, 255,   0 },
+        {  136,  21, 0xD2FF4845u,  28, 131 },
+        {  157,  33, 0xD88A75C5u,  25, 134 },
+        {  190,  33, 0x203B4345u,  25, 134 },
+        {  223,  17, 0x922FA145u,  29, 130 },
+        {    0,   1, 0x09D6A1C5u, 255,   0 },
+        {    0,   1, 0x09D6A1C5u, 255,   0 },
+    },
+    { /* EXPR_ANGRY */
+        {    0,   1, 0x09D6A1C5u, 255,   0 },
+        {    0,   1, 0x09D6A1C5u, 255,   0 },
+        {  240,  25, 0x28F26325u,  44, 117 },
+        {  265,  33, 0x7C379DC5u,  28, 133 },
+        {  298,  25, 0xA60E1225u,  23, 137 },
+        {    0,   1, 0x09D6A1C5u, 255,   0 },
+        {    0,   1, 0x09D6A1C5u, 255,   0 },
+        {    0,   1, 0x09D6A1C5u, 255,   0 },
+        {    0,   1, 0x09D6A1C5u, 255,   0 },
+        {    0,   1, 0x09D6A1C5u, 255,   0 },
+    },
+    { /* EXPR_SLEEPY */
+        {    0,   1, 0x09D6A1C5u, 255,   0 },
+        {    0,   1, 0x09D6A1C5u, 255,   0 },
+        {    0,   1, 0x09D6A1C5u, 255,   0 },
+        {    0,   1, 0x09D6A1C5u, 255,   0 },
+        {  110,  13, 0x0261EE45u,  25, 134 },
+        {  123,  13, 0xF470AE45u,  25, 134 },
+        {    0,   1, 0x09D6A1C5u, 255,   0 },
+        {    0,   1, 0x09D6A1C5u, 255,   0 },
+        {    0,   1, 0x09D6A1C5u, 255,   0 },
+        {    0,   1, 0x09D6A1C5u, 255,   0 },
+    },
+    { /* EXPR_SAD */
+        {    0,   1, 0x09D6A1C5u, 255,   0 },
+        {    0,   1, 0x09D6A1C5u, 255,   0 },
+        {    0,   1, 0x09D6A1C5u, 255,   0 },
+        {  323,  13, 0x0ECE3945u,  27, 133 },
+        {  336,  33, 0x60EBAEC5u,  29, 131 },
+        {  369,  17, 0x3D06B3C5u,  30, 129 },
+        {    0,   1, 0x09D6A1C5u, 255,   0 },
+        {    0,   1, 0x09D6A1C5u, 255,   0 },
+        {    0,   1, 0x09D6A1C5u, 255,   0 },
+        {    0,   1, 0x09D6A1C5u, 255,   0 },
+    },
+    { /* EXPR_LOOK_LEFT */
+        {    0,   1, 0x09D6A1C5u, 255,   0 },
+        {    1,   5, 0xA87EABC5u,  32, 127 },
+        {    6,  33, 0xE6EB4A45u,  25, 134 },
+        {  386,  41, 0x3045C7C5u,  25, 134 },
+        {  427,  65, 0x97ADD5C5u,  25, 134 },
+        {  427,  65, 0x97ADD5C5u,  25, 134 },
+        {  492,  41, 0xDEAAC7C5u,  25, 134 },
+        {   72,  33, 0xDD542A45u,  25, 134 },
+        {  105,   5, 0x5AE6ABC5u,  32, 127 },
+        {    0,   1, 0x09D6A1C5u, 255,   0 },
+    },
+    { /* EXPR_LOOK_RIGHT */
+        {    0,   1, 0x09D6A1C5u, 255,   0 },
+        {    1,   5, 0xA87EABC5u,  32, 127 },
+        {    6,  33, 0xE6EB4A45u,  25, 134 },
+        {  533,  41, 0xC184E7C5u,  25, 134 },
+        {  574,  65, 0x86BCA5C5u,  25, 134 },
+        {  574,  65, 0x86BCA5C5u,  25, 134 },
+        {  639,  41, 0xCE1137C5u,  25, 134 },
+        {   72,  33, 0xDD542A45u,  25, 134 },
+        {  105,   5, 0x5AE6ABC5u,  32, 127 },
+        {    0,   1, 0x09D6A1C5u, 255,   0 },
+    },
+};
@@ -0,0 +1,273 @@
+/**
+ * @file lcd_band.c
+ * @brief 밴드(스트립) 합성기 - 화면 전체를 160x8 밴드 단위로 RAM에서 합성
+ *
+ * 동작:
+ * 1. Band_* 호출은 도형을 디스플레이 리스트에 기록만 함 (SPI 사용 X)
+ * 2. Band_Commit()에서 밴드마다 모든 도형을 행 span으로 래스터라이즈
+ * 3. 밴드 해시가 이전 프레임과 같으면 건너뜀, 다르면 창 1개 + DMA 1회로 전송
+ *    창은 밴드 전체 폭이 아니라 (화면에 있던 내용 ∪ 새 내용)의 열 범위만
+ *    → 범위 밖은 두 프레임 모두 배경이므로 다시 보낼 필요 없음
+ * 4. 밴드 버퍼 2개를 번갈아 써서 전송 중에 다음 밴드를 합성
+ *
+ * RAM: 밴드 버퍼 2 x 160 x 8 x 2B = 5KB, 해시 10 x 4B, 열 범위 10 x 4B
+ *
+ * 플래시 아틀라스(RLE)도 같은 해시 테이블을 공유하므로 두 경로를 섞어 써도
+ * 실제로 바뀐 밴드만 전송됨
+ */
+
+#include "drivers/lcd_band.h"
+#include "drivers/lcd_st7735.h"
+
+static uint16_t band_buf[2][BAND_H][LCD_WIDTH];
+static uint32_t band_hash[BAND_COUNT];
+static uint16_t band_valid = 0;   // 비트 b가 0이면 밴드 b는 해시 무시하고 전송
+static int16_t  band_xl[BAND_COUNT], band_xr[BAND_COUNT];   // 화면에 배경 외 내용이 있는 열 범위
+static uint16_t shown_bg = 0x0000;  // 화면에 깔려 있는 배경색
+
+static GfxShape_t shapes[BAND_MAX_SHAPES];
+static uint8_t    shape_count = 0;
+static uint16_t   bg_color = 0x0000;
+
+/* ===== 내부 함수 ===== */
+
+/**
+ * @brief 밴드 하나 합성 (배경 → 도형 순서대로 덮어쓰기)
+ */
+static void Band_Raster(uint16_t (*buf)[LCD_WIDTH], int16_t y0, int16_t *ext_l, int16_t *ext_r)
+{
+    *ext_l = LCD_WIDTH;
+    *ext_r = -1;
+
+    for (int16_t row = 0; row < BAND_H; row++)
+    {
+        uint16_t *line = buf[row];
+        int16_t y = y0 + row;
+
+        for (int16_t x = 0; x < LCD_WIDTH; x++)
+            line[x] = bg_color;
+
+        for (uint8_t i = 0; i < shape_count; i++)
+        {
+            int16_t xl, xr;
+            if (!Gfx_ShapeRowSpan(&shapes[i], y, &xl, &xr)) continue;
+            if (xl < 0) xl = 0;
+            if (xr >= LCD_WIDTH) xr = LCD_WIDTH - 1;
+            if (xl > xr) continue;
+            if (xl < *ext_l) *ext_l = xl;
+            if (xr > *ext_r) *ext_r = xr;
+
+            uint16_t c = shapes[i].color;
+            for (int16_t x = xl; x <= xr; x++)
+                line[x] = c;
+        }
+    }
+}
+
+/**
+ * @brief FNV-1a 32bit 해시 (밴드 변경 감지용)
+ *
+ * 픽셀 비교 없이 해시만 봄 (이전 밴드를 보관할 RAM 2.5KB x 10 이 없음)
+ * 충돌 = 바뀐 밴드가 같은 해시 → 그 밴드를 안 보냄, 다음에 밴드가 또 바뀌거나 Band_Invalidate() 까지 이전 그림
+ * 확률은 바뀐 밴드당 약 2^-32: 30fps 로 10밴드가 매 프레임 바뀌어도 평균 166일에 한 번
+ * 아틀라스 표정끼리는 tools/host/band_bench.c 가 충돌 없음을 검사
+ */
+static uint32_t Band_Hash(const uint16_t *p, uint32_t n)
+{
+    uint32_t h = 2166136261u;
+    while (n--)
+    {
+        h ^= *p++;
+        h *= 16777619u;
+    }
+    return h;
+}
+
+/**
+ * @brief 밴드 해시 비교 후 갱신
+ * @return 전송이 필요하면 1
+ */
+static uint8_t Band_Changed(uint8_t b, uint32_t h)
+{
+    if (band_valid & (1u << b))
+    {
+        if (h == band_hash[b]) return 0;
+    }
+    else
+    {
+        /* 화면 내용을 모름 → 이번 전송은 전체 폭 */
+        band_xl[b] = 0;
+        band_xr[b] = LCD_WIDTH - 1;
+    }
+
+    band_hash[b] = h;
+    band_valid |= (1u << b);
+    return 1;
+}
+
+/**
+ * @brief 배경색이 바뀌면 화면 전체가 달라지므로 열 범위를 전체 폭으로
+ */
+static void Band_SetShownBg(uint16_t bg)
+{
+    if (bg == shown_bg) return;
+    shown_bg = bg;
+    for (uint8_t b = 0; b < BAND_COUNT; b++)
+    {
+        band_xl[b] = 0;
+        band_xr[b] = LCD_WIDTH - 1;
+    }
+}
+
+/**
+ * @brief 밴드 b 전송 - (이전 열 범위 ∪ 새 열 범위)만 잘라서 창 1개로
+ * @note  buf의 행들을 창 폭으로 앞당겨 채움 (dst <= src 이므로 제자리 이동 가능)
+ */
+static void Band_Send(uint8_t b, uint16_t (*buf)[LCD_WIDTH], int16_t xl, int16_t xr)
+{
+    int16_t wl = (xl < band_xl[b]) ? xl : band_xl[b];
+    int16_t wr = (xr > band_xr[b]) ? xr : band_xr[b];
+    band_xl[b] = xl;
+    band_xr[b] = xr;
+
+    if (wl > wr)
+    {
+        /* 양쪽 다 배경뿐인데 해시가 다름 (방어 코드) → 전체 폭 */
+        wl = 0;
+        wr = LCD_WIDTH - 1;
+    }
+
+    uint16_t w = (uint16_t)(wr - wl + 1);
+    uint16_t *dst = &buf[0][0];
+    if (w < LCD_WIDTH)
+    {
+        for (uint8_t row = 0; row < BAND_H; row++)
+        {
+            const uint16_t *src = &buf[row][wl];
+            for (uint16_t x = 0; x < w; x++)
+                *dst++ = src[x];
+        }
+    }
+
+    int16_t y0 = b * BAND_H;
+    LCD_SetWindow(wl, y0, wr, y0 + BAND_H - 1);
+    LCD_SubmitBuffer(&buf[0][0], (uint32_t)BAND_H * w);
+}
+
+/* ===== 외부 API ===== */
+
+void Band_Begin(uint16_t bg)
+{
+    shape_count = 0;
+    bg_color = bg;
+}
+
+void Band_Add(const GfxShape_t *s)
+{
+    if (shape_count < BAND_MAX_SHAPES)
+        shapes[shape_count++] = *s;
+}
+
+void Band_FillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
+{
+    if (w <= 0 || h <= 0) return;
+    GfxShape_t s = { GFX_RECT, x, y, x + w - 1, y + h - 1, 0, color, 0 };
+    Band_Add(&s);
+}
+
+void Band_RoundRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, uint16_t color)
+{
+    if (w <= 0 || h <= 0) return;
+    GfxShape_t s = { GFX_RRECT, x, y, x + w - 1, y + h - 1, r, color, 0 };
+    Band_Add(&s);
+}
+
+void Band_FillCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color)
+{
+    GfxShape_t s = { GFX_CIRCLE, x0, y0, x0, y0, r, color, 0 };
+    Band_Add(&s);
+}
+
+void Band_ThickLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t t, uint16_t color)
+{
+    GfxShape_t s = { GFX_LINE, x0, y0, x1, y1, t, color, 0 };
+    Band_Add(&s);
+}
+
+/**
+ * @brief 프레임 합성 후 바뀐 밴드만 전송
+ * @return 전송한 밴드 수
+ */
+uint8_t Band_Commit(void)
+{
+    uint8_t sent = 0;
+    uint8_t slot = 0;
+
+    Band_SetShownBg(bg_color);
+
+    for (uint8_t b = 0; b < BAND_COUNT; b++)
+    {
+        int16_t y0 = b * BAND_H;
+        int16_t xl, xr;
+
+        /* 전송 중인 건 slot^1 버퍼 (slot 쪽은 직전 SetWindow에서 이미 완료 확인됨) */
+        Band_Raster(band_buf[slot], y0, &xl, &xr);
+
+        uint32_t h = Band_Hash(&band_buf[slot][0][0], (uint32_t)BAND_H * LCD_WIDTH);
+        if (!Band_Changed(b, h))
+        {
+            /* 내용이 같으므로 정확한 범위로 좁혀 둠 (아틀라스 범위보다 좁을 수 있음) */
+            band_xl[b] = xl;
+            band_xr[b] = xr;
+            continue;
+        }
+
+        Band_Send(b, band_buf[slot], xl, xr);
+
+        sent++;
+        slot ^= 1;
+    }
+
+    LCD_WaitIdle();
+    return sent;
+}
+
+void Band_Invalidate(void)
+{
+    band_valid = 0;
+}
+
+/**
+ * @brief 플래시의 RLE 밴드를 디코딩하여 바뀐 밴드만 전송
+ * @note  해시는 생성기가 미리 계산 → 안 바뀐 밴드는 디코딩도 하지 않음
+ * @return 전송한 밴드 수
+ */
+uint8_t Band_CommitRle(const BandRle_t *bands, const uint16_t *runs, const uint16_t *palette)
+{
+    uint8_t sent = 0;
+    uint8_t slot = 0;
+
+    Band_SetShownBg(palette[0]);
+
+    for (uint8_t b = 0; b < BAND_COUNT; b++)
+    {
+        if (!Band_Changed(b, bands[b].hash))
+            continue;
+
+        uint16_t *dst = &band_buf[slot][0][0];
+        const uint16_t *run = &runs[bands[b].run_start];
+        for (uint16_t i = 0; i < bands[b].run_count; i++)
+        {
+            uint16_t c = palette[BAND_RLE_INDEX(run[i])];
+            uint16_t n = BAND_RLE_LEN(run[i]);
+            while (n--) *dst++ = c;
+        }
+
+        Band_Send(b, band_buf[slot], bands[b].xl, bands[b].xr);
+        sent++;
+        slot ^= 1;
+    }
+
+    LCD_WaitIdle();
+    return sent;
+}
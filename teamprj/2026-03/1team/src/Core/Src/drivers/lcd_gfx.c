@@ -3,9 +3,9 @@
  * @brief LCD 그래픽 함수 - 성능 최적화 버전
  * 
  * 최적화 내용:
- * 1. FillCircle: 수평선 기반 (픽셀 단위 → 라인 단위)
- * 2. RoundRect: 중복 영역 제거
- * 3. ThickLine: Bresenham 알고리즘 적용
+ * 1. 모든 도형을 행 span 목록으로 변환 (픽셀/스캔라인 단위 X)
+ * 2. 겹치는 span은 행 안에서 병합, 같은 span이 이어지는 행은 사각형 하나로 합침
+ * 3. 사각형마다 SetWindow 1회 + DMA 1회만 발행 (ThickLine도 원 반복 없음)
  */
 
 #include "drivers/lcd_gfx.h"
@@ -27,165 +27,434 @@ void LCD_FillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
     LCD_WriteColorFast(color, (uint32_t)w * h);
 }
 
+/* ===== span 목록 래스터라이저 ===== */
+
+#define GFX_MAX_RUNS (GFX_MAX_SHAPES * 2 + 1)
+
+typedef struct {
+    int16_t  x0, x1;    // 포함 구간
+    uint16_t color;
+    int16_t  top;       // 열린 사각형의 시작 행 (open 목록에서만 사용)
+} GfxRun_t;
+
+static GfxRun_t row_runs[GFX_MAX_RUNS];
+static GfxRun_t open_runs[GFX_MAX_RUNS];
+static uint8_t  row_n, open_n;
+
 /**
- * @brief 수평선 그리기 (내부용, 빠름)
+ * @brief 현재 행 run 목록 위에 [x0,x1] span을 덮어씀 (정렬/비중첩 유지)
  */
-static inline void LCD_HLine(int16_t x, int16_t y, int16_t w, uint16_t color)
+static void Runs_Paint(int16_t x0, int16_t x1, uint16_t color)
 {
-    if (y < 0 || y >= LCD_HEIGHT) return;
-    if (x < 0) { w += x; x = 0; }
-    if (x + w > LCD_WIDTH) w = LCD_WIDTH - x;
-    if (w <= 0) return;
+    GfxRun_t out[GFX_MAX_RUNS];
+    uint8_t n = 0;
+    uint8_t placed = 0;
+
+    for (uint8_t i = 0; i < row_n; i++)
+    {
+        GfxRun_t r = row_runs[i];
+
+        if (r.x1 < x0 || r.x0 > x1)
+        {
+            if (!placed && r.x0 > x1 && n < GFX_MAX_RUNS)
+            {
+                out[n++] = (GfxRun_t){ x0, x1, color, 0 };
+                placed = 1;
+            }
+            if (n < GFX_MAX_RUNS) out[n++] = r;
+            continue;
+        }
 
-    LCD_SetWindow(x, y, x + w - 1, y);
-    LCD_WriteColorFast(color, w);
+        /* 겹침: 새 span 왼쪽/오른쪽 잔여분만 남김 */
+        if (r.x0 < x0 && n < GFX_MAX_RUNS)
+            out[n++] = (GfxRun_t){ r.x0, x0 - 1, r.color, 0 };
+        if (!placed && n < GFX_MAX_RUNS)
+        {
+            out[n++] = (GfxRun_t){ x0, x1, color, 0 };
+            placed = 1;
+        }
+        if (r.x1 > x1 && n < GFX_MAX_RUNS)
+            out[n++] = (GfxRun_t){ x1 + 1, r.x1, r.color, 0 };
+    }
+    if (!placed && n < GFX_MAX_RUNS)
+        out[n++] = (GfxRun_t){ x0, x1, color, 0 };
+
+    /* 맞닿은 같은 색 run 병합 */
+    row_n = 0;
+    for (uint8_t i = 0; i < n; i++)
+    {
+        if (row_n > 0 &&
+            row_runs[row_n - 1].color == out[i].color &&
+            row_runs[row_n - 1].x1 + 1 == out[i].x0)
+        {
+            row_runs[row_n - 1].x1 = out[i].x1;
+        }
+        else
+        {
+            row_runs[row_n++] = out[i];
+        }
+    }
+}
+
+static void Run_Emit(const GfxRun_t *r, int16_t bottom)
+{
+    int16_t w = r->x1 - r->x0 + 1;
+    int16_t h = bottom - r->top + 1;
+
+    LCD_SetWindow(r->x0, r->top, r->x1, bottom);
+    LCD_SubmitColor(r->color, (uint32_t)w * h);
 }
 
 /**
- * @brief 원 채우기 - 수평선 기반 (10배 이상 빠름)
+ * @brief 이전 행까지 열린 사각형과 현재 행 run을 비교 - 같은 건 연장, 나머지는 출력
  */
-void LCD_FillCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color)
+static void Runs_Advance(int16_t y)
 {
-    int16_t x = r;
-    int16_t y = 0;
-    int16_t err = 1 - r;
+    GfxRun_t next[GFX_MAX_RUNS];
+    uint8_t n = 0;
+    uint8_t i = 0, j = 0;
 
-    /* 중앙 수평선 */
-    LCD_HLine(x0 - r, y0, 2 * r + 1, color);
-
-    while (x >= y)
+    while (i < open_n || j < row_n)
     {
-        y++;
-
-        if (err < 0)
+        if (i < open_n && j < row_n &&
+            open_runs[i].x0 == row_runs[j].x0 &&
+            open_runs[i].x1 == row_runs[j].x1 &&
+            open_runs[i].color == row_runs[j].color)
         {
-            err += 2 * y + 1;
+            next[n++] = open_runs[i];          // 아래로 연장
+            i++; j++;
+        }
+        else if (j >= row_n || (i < open_n && open_runs[i].x0 <= row_runs[j].x0))
+        {
+            Run_Emit(&open_runs[i], y - 1);    // 더 이상 이어지지 않음
+            i++;
         }
         else
         {
-            /* 수평선 그리기 (위/아래 대칭) */
-            LCD_HLine(x0 - x, y0 + y, 2 * x + 1, color);
-            LCD_HLine(x0 - x, y0 - y, 2 * x + 1, color);
-            x--;
-            err += 2 * (y - x + 1);
+            next[n] = row_runs[j];
+            next[n].top = y;                   // 새 사각형 시작
+            n++;
+            j++;
         }
+    }
+
+    for (uint8_t k = 0; k < n; k++) open_runs[k] = next[k];
+    open_n = n;
+}
+
+/**
+ * @brief 도형 목록을 그리는 순서대로 합성하여 최소 개수의 사각형으로 출력
+ * @note  나중 도형이 앞 도형을 덮음. 겹친 영역은 한 번만 전송됨
+ */
+void Gfx_DrawShapes(const GfxShape_t *list, uint8_t n)
+{
+    if (n == 0) return;
+    if (n > GFX_MAX_SHAPES) n = GFX_MAX_SHAPES;
 
-        if (x >= y)
+    int16_t top = 32767, bottom = -32768;
+    for (uint8_t k = 0; k < n; k++)
+    {
+        int16_t t, b;
+        Gfx_ShapeRows(&list[k], &t, &b);
+        if (t < top) top = t;
+        if (b > bottom) bottom = b;
+    }
+    if (top < 0) top = 0;
+    if (bottom >= LCD_HEIGHT) bottom = LCD_HEIGHT - 1;
+
+    open_n = 0;
+    for (int16_t y = top; y <= bottom; y++)
+    {
+        row_n = 0;
+        for (uint8_t k = 0; k < n; k++)
         {
-            LCD_HLine(x0 - y, y0 + x, 2 * y + 1, color);
-            LCD_HLine(x0 - y, y0 - x, 2 * y + 1, color);
+            int16_t xl, xr;
+            if (!Gfx_ShapeRowSpan(&list[k], y, &xl, &xr)) continue;
+            if (xl < 0) xl = 0;
+            if (xr >= LCD_WIDTH) xr = LCD_WIDTH - 1;
+            if (xl > xr) continue;
+            Runs_Paint(xl, xr, list[k].color);
         }
+        Runs_Advance(y);
     }
+
+    /* 마지막 행까지 열린 사각형 출력 */
+    row_n = 0;
+    Runs_Advance(bottom + 1);
+}
+
+/**
+ * @brief 원 채우기 - 행 span을 사각형으로 병합
+ */
+void LCD_FillCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color)
+{
+    GfxShape_t s = { GFX_CIRCLE, x0, y0, x0, y0, r, color, 0 };
+    Gfx_DrawShapes(&s, 1);
 }
 
 /**
- * @brief 둥근 모서리 사각형 - 최적화
+ * @brief 둥근 모서리 사각형 - 중앙부는 사각형 1개, 모서리 행만 개별 출력
  */
 void LCD_RoundRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, uint16_t color)
 {
-    if (r > w / 2) r = w / 2;
-    if (r > h / 2) r = h / 2;
-    if (r < 1) r = 1;
+    if (w <= 0 || h <= 0) return;
+    GfxShape_t s = { GFX_RRECT, x, y, x + w - 1, y + h - 1, r, color, 0 };
+    Gfx_DrawShapes(&s, 1);
+}
 
-    /* 중앙 직사각형 (모서리 제외) */
-    LCD_FillRect(x + r, y, w - 2 * r, h, color);
-    
-    /* 좌우 측면 */
-    LCD_FillRect(x, y + r, r, h - 2 * r, color);
-    LCD_FillRect(x + w - r, y + r, r, h - 2 * r, color);
+/**
+ * @brief 두꺼운 선 - 점마다 원을 찍지 않고 행마다 합집합 span 1개
+ */
+void LCD_ThickLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t t, uint16_t color)
+{
+    GfxShape_t s = { GFX_LINE, x0, y0, x1, y1, t, color, 0 };
+    Gfx_DrawShapes(&s, 1);
+}
 
-    /* 4개 모서리 원 (1/4씩) */
-    int16_t cx, cy;
-    int16_t px = r, py = 0;
-    int16_t err = 1 - r;
+/**
+ * @brief 수직선 그리기
+ */
+void LCD_VLine(int16_t x, int16_t y, int16_t h, uint16_t color)
+{
+    if (x < 0 || x >= LCD_WIDTH) return;
+    if (y < 0) { h += y; y = 0; }
+    if (y + h > LCD_HEIGHT) h = LCD_HEIGHT - y;
+    if (h <= 0) return;
 
-    while (px >= py)
-    {
-        /* 좌상단 모서리 */
-        cx = x + r; cy = y + r;
-        LCD_HLine(cx - px, cy - py, px, color);
-        LCD_HLine(cx - py, cy - px, py, color);
+    LCD_SetWindow(x, y, x, y + h - 1);
+    LCD_WriteColorFast(color, h);
+}
 
-        /* 우상단 모서리 */
-        cx = x + w - r - 1; cy = y + r;
-        LCD_HLine(cx + 1, cy - py, px, color);
-        LCD_HLine(cx + 1, cy - px, py, color);
+/**
+ * @brief 픽셀 하나 찍기
+ */
+void LCD_DrawPixel(int16_t x, int16_t y, uint16_t color)
+{
+    if (x < 0 || x >= LCD_WIDTH || y < 0 || y >= LCD_HEIGHT) return;
+    LCD_SetWindow(x, y, x, y);
+    LCD_WriteColorFast(color, 1);
+}
 
-        /* 좌하단 모서리 */
-        cx = x + r; cy = y + h - r - 1;
-        LCD_HLine(cx - px, cy + py, px, color);
-        LCD_HLine(cx - py, cy + px, py, color);
+/* ===== 도형 → 행 span 변환 ===== */
 
-        /* 우하단 모서리 */
-        cx = x + w - r - 1; cy = y + h - r - 1;
-        LCD_HLine(cx + 1, cy + py, px, color);
-        LCD_HLine(cx + 1, cy + px, py, color);
+/**
+ * @brief 정수 제곱근 (floor)
+ */
+static int16_t isqrt(int32_t v)
+{
+    if (v <= 0) return 0;
 
-        py++;
-        if (err < 0)
+    int32_t r = 0;
+    int32_t bit = 1L << 14;   // 반지름 128 이하면 충분
+    while (bit > v) bit >>= 2;
+
+    while (bit != 0)
+    {
+        if (v >= r + bit)
         {
-            err += 2 * py + 1;
+            v -= r + bit;
+            r = (r >> 1) + bit;
         }
         else
         {
-            px--;
-            err += 2 * (py - px + 1);
+            r >>= 1;
         }
+        bit >>= 2;
     }
+    return (int16_t)r;
 }
 
+/**
+ * @brief 반지름 r 원의 중심에서 dy 떨어진 행의 반폭 (r*r + r 보정으로 중점 원과 유사)
+ */
+static inline int16_t circle_half(int16_t r, int16_t dy)
+{
+    return isqrt((int32_t)r * r + r - (int32_t)dy * dy);
+}
+
+/**
+ * @brief 도형이 차지하는 행 범위
+ */
+void Gfx_ShapeRows(const GfxShape_t *s, int16_t *top, int16_t *bottom)
+{
+    switch (s->type)
+    {
+        case GFX_CIRCLE:
+            *top    = s->y0 - s->r;
+            *bottom = s->y0 + s->r;
+            break;
 
+        case GFX_LINE:
+        {
+            int16_t r = s->r / 2;
+            *top    = ((s->y0 < s->y1) ? s->y0 : s->y1) - r;
+            *bottom = ((s->y0 > s->y1) ? s->y0 : s->y1) + r;
+            break;
+        }
 
+        case GFX_RRECT:
+            *top    = s->y0 + ((s->skew < 0) ? s->skew : 0);
+            *bottom = s->y1 + ((s->skew > 0) ? s->skew : 0);
+            break;
 
+        default:
+            *top    = s->y0;
+            *bottom = s->y1;
+            break;
+    }
+}
 
 /**
- * @brief 두꺼운 선 - Bresenham 알고리즘
+ * @brief 두꺼운 선의 y행 span - Bresenham 점마다 찍는 원(사각형)의 합집합
  */
-void LCD_ThickLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t t, uint16_t color)
+static uint8_t line_row_span(const GfxShape_t *s, int16_t y, int16_t *xl, int16_t *xr)
 {
-    int16_t dx = (x1 > x0) ? (x1 - x0) : (x0 - x1);
-    int16_t dy = (y1 > y0) ? (y1 - y0) : (y0 - y1);
-    int16_t sx = (x0 < x1) ? 1 : -1;
-    int16_t sy = (y0 < y1) ? 1 : -1;
+    int16_t x0 = s->x0, y0 = s->y0;
+    int16_t dx = (s->x1 > x0) ? (s->x1 - x0) : (x0 - s->x1);
+    int16_t dy = (s->y1 > y0) ? (s->y1 - y0) : (y0 - s->y1);
+    int16_t sx = (x0 < s->x1) ? 1 : -1;
+    int16_t sy = (y0 < s->y1) ? 1 : -1;
     int16_t err = dx - dy;
+    int16_t t = s->r;
     int16_t r = t / 2;
+    int16_t lo = 32767, hi = -32768;
 
     while (1)
     {
-        /* 현재 위치에 원 또는 사각형 */
+        int16_t d = y - y0;
         if (t <= 2)
-            LCD_FillRect(x0 - r, y0 - r, t, t, color);
-        else
-            LCD_FillCircle(x0, y0, r, color);
+        {
+            if (d >= -r && d < t - r)
+            {
+                if (x0 - r < lo) lo = x0 - r;
+                if (x0 - r + t - 1 > hi) hi = x0 - r + t - 1;
+            }
+        }
+        else if (d >= -r && d <= r)
+        {
+            int16_t h = circle_half(r, d);
+            if (x0 - h < lo) lo = x0 - h;
+            if (x0 + h > hi) hi = x0 + h;
+        }
 
-        if (x0 == x1 && y0 == y1) break;
+        if (x0 == s->x1 && y0 == s->y1) break;
 
         int16_t e2 = 2 * err;
         if (e2 > -dy) { err -= dy; x0 += sx; }
         if (e2 <  dx) { err += dx; y0 += sy; }
     }
+
+    if (lo > hi) return 0;
+    *xl = lo;
+    *xr = hi;
+    return 1;
 }
 
 /**
- * @brief 수직선 그리기
+ * @brief x열에서 기울어진 둥근 사각형의 세로 이동량 (반올림)
  */
-void LCD_VLine(int16_t x, int16_t y, int16_t h, uint16_t color)
+static int16_t skew_offset(const GfxShape_t *s, int16_t x)
 {
-    if (x < 0 || x >= LCD_WIDTH) return;
-    if (y < 0) { h += y; y = 0; }
-    if (y + h > LCD_HEIGHT) h = LCD_HEIGHT - y;
-    if (h <= 0) return;
+    int32_t span = s->x1 - s->x0;
+    if (span <= 0) return 0;
 
-    LCD_SetWindow(x, y, x, y + h - 1);
-    LCD_WriteColorFast(color, h);
+    int32_t num = 2 * (int32_t)s->skew * (x - s->x0);
+    num += (num >= 0) ? span : -span;
+    return (int16_t)(num / (2 * span));
 }
 
 /**
- * @brief 픽셀 하나 찍기
+ * @brief 기울어진 둥근 사각형의 y행 span
+ * @note  열마다 세로로 밀린 도형(볼록)이므로 양 끝에서 안쪽으로 찾으면 구간이 나옴
  */
-void LCD_DrawPixel(int16_t x, int16_t y, uint16_t color)
+static uint8_t skew_rrect_row_span(const GfxShape_t *s, int16_t y, int16_t *xl, int16_t *xr)
 {
-    if (x < 0 || x >= LCD_WIDTH || y < 0 || y >= LCD_HEIGHT) return;
-    LCD_SetWindow(x, y, x, y);
-    LCD_WriteColorFast(color, 1);
+    GfxShape_t flat = *s;
+    flat.skew = 0;
+
+    int16_t cache_v = -32768, cache_l = 0, cache_r = -1;
+    int16_t lo = s->x0, hi = s->x1;
+
+    /* 왼쪽 끝 */
+    for (; lo <= hi; lo++)
+    {
+        int16_t v = y - skew_offset(s, lo);
+        if (v != cache_v)
+        {
+            cache_v = v;
+            if (!Gfx_ShapeRowSpan(&flat, v, &cache_l, &cache_r)) { cache_l = 0; cache_r = -1; }
+        }
+        if (lo >= cache_l && lo <= cache_r) break;
+    }
+    if (lo > hi) return 0;
+
+    /* 오른쪽 끝 */
+    for (; hi > lo; hi--)
+    {
+        int16_t v = y - skew_offset(s, hi);
+        if (v != cache_v)
+        {
+            cache_v = v;
+            if (!Gfx_ShapeRowSpan(&flat, v, &cache_l, &cache_r)) { cache_l = 0; cache_r = -1; }
+        }
+        if (hi >= cache_l && hi <= cache_r) break;
+    }
+
+    *xl = lo;
+    *xr = hi;
+    return 1;
+}
+
+/**
+ * @brief 도형과 y행의 교차 구간 [xl, xr] 계산 (클리핑 없음)
+ * @return 교차하면 1
+ */
+uint8_t Gfx_ShapeRowSpan(const GfxShape_t *s, int16_t y, int16_t *xl, int16_t *xr)
+{
+    switch (s->type)
+    {
+        case GFX_RECT:
+            if (y < s->y0 || y > s->y1) return 0;
+            *xl = s->x0;
+            *xr = s->x1;
+            return 1;
+
+        case GFX_RRECT:
+        {
+            if (s->skew != 0) return skew_rrect_row_span(s, y, xl, xr);
+            if (y < s->y0 || y > s->y1) return 0;
+
+            int16_t w = s->x1 - s->x0 + 1;
+            int16_t h = s->y1 - s->y0 + 1;
+            int16_t r = s->r;
+            if (r > w / 2) r = w / 2;
+            if (r > h / 2) r = h / 2;
+            if (r < 1) r = 1;
+
+            int16_t d = 0;
+            if (y < s->y0 + r)       d = s->y0 + r - y;
+            else if (y > s->y1 - r)  d = y - (s->y1 - r);
+
+            int16_t inset = (d == 0) ? 0 : r - circle_half(r, d);
+            *xl = s->x0 + inset;
+            *xr = s->x1 - inset;
+            return 1;
+        }
+
+        case GFX_CIRCLE:
+        {
+            int16_t d = y - s->y0;
+            if (d < -s->r || d > s->r) return 0;
+            int16_t h = circle_half(s->r, d);
+            *xl = s->x0 - h;
+            *xr = s->x0 + h;
+            return 1;
+        }
+
+        case GFX_LINE:
+            return line_row_span(s, y, xl, xr);
+
+        default:
+            return 0;
+    }
 }
@@ -0,0 +1,375 @@
+/**
+ * @file lcd_pal.c
+ * @brief 팔레트 프레임버퍼 - 화면 전체를 인덱스 픽셀로 RAM에 그리고, 전송 중에 RGB565로 확장
+ *
+ * 동작:
+ * 1. Pal_* 그리기는 프레임버퍼의 인덱스만 바꿈 (SPI 사용 X, 행 span = memset)
+ * 2. Pal_Commit()에서 행마다 해시를 이전 프레임과 비교 → 바뀐 행이 이어진 구간마다 창 1개
+ *    창의 열 범위는 (화면에 있던 내용 ∪ 새 내용), 범위 밖은 두 프레임 모두 배경
+ * 3. 전송은 LCD_SubmitIndexed - 핑퐁 DMA가 한 줄 보내는 동안 다음 줄을 팔레트로 확장
+ *    → RGB565 프레임을 RAM에 두지 않음, 전체 화면 시간 = SPI 바이트 수로 거의 고정
+ *
+ * RAM (PAL_BPP 2): 프레임버퍼 3.2KB + 행 해시 80 x 4B + 열 범위 80 x 4B
+ *      (PAL_BPP 4): 프레임버퍼 6.4KB + 같음
+ *
+ * 밴드 합성기(lcd_band)와 같은 도형/RLE 형식을 쓰므로 eyes.c에서 둘 중 하나를 골라 씀
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "drivers/lcd_pal.h"
+#include "drivers/lcd_st7735.h"
+#include "timebase.h"
+
+#define PAL_PPB     (8 / PAL_BPP)                   // 바이트당 픽셀
+#define PAL_MASK    ((1u << PAL_BPP) - 1)
+#define PAL_REP     (0xFFu / PAL_MASK)              // 인덱스 → 바이트 채움 (2bpp 0x55, 4bpp 0x11)
+#define EXT_EMPTY   0xFF                            // 열 범위 없음 (xl > xr)
+
+static uint8_t  fb[PAL_FB_SIZE] __attribute__((aligned(4)));
+static uint16_t palette[PAL_COLORS];
+static uint8_t  pal_used = 0;
+
+static uint32_t row_hash[LCD_HEIGHT];
+static uint8_t  row_xl[LCD_HEIGHT], row_xr[LCD_HEIGHT];       // 이번 프레임에서 배경 외 내용이 있는 열
+static uint8_t  shown_xl[LCD_HEIGHT], shown_xr[LCD_HEIGHT];   // 화면에 있는 배경 외 내용의 열
+static uint8_t  pal_valid = 0;      // 0이면 화면 내용을 모름 → 다음 Commit 전체 전송
+static uint8_t  bg_idx = 0;
+static uint8_t  shown_bg = 0;
+
+static PalStats_t stats;
+
+/* ===== 내부 함수 ===== */
+
+static inline void Px_Put(uint8_t *row, int16_t x, uint8_t idx)
+{
+    uint8_t s = (uint8_t)((PAL_PPB - 1 - (x & (PAL_PPB - 1))) * PAL_BPP);   // MSB 먼저
+    uint8_t *p = &row[x / PAL_PPB];
+    *p = (uint8_t)((*p & ~(PAL_MASK << s)) | (idx << s));
+}
+
+/**
+ * @brief 한 행의 [xl, xr]을 idx로 채움 (양 끝 바이트만 비트 단위, 가운데는 memset)
+ */
+static void Pal_Span(int16_t y, int16_t xl, int16_t xr, uint8_t idx)
+{
+    if (y < 0 || y >= LCD_HEIGHT) return;
+    if (xl < 0) xl = 0;
+    if (xr >= LCD_WIDTH) xr = LCD_WIDTH - 1;
+    if (xl > xr) return;
+
+    if (row_xl[y] == EXT_EMPTY || xl < row_xl[y]) row_xl[y] = (uint8_t)xl;
+    if (row_xr[y] == EXT_EMPTY || xr > row_xr[y]) row_xr[y] = (uint8_t)xr;
+
+    uint8_t *row = &fb[y * PAL_STRIDE];
+    int16_t x = xl;
+
+    while (x <= xr && (x & (PAL_PPB - 1)))
+        Px_Put(row, x++, idx);
+
+    int16_t bytes = (int16_t)((xr + 1 - x) / PAL_PPB);
+    if (bytes > 0)
+    {
+        memset(&row[x / PAL_PPB], (int)(idx * PAL_REP), (size_t)bytes);
+        x += bytes * PAL_PPB;
+    }
+
+    while (x <= xr)
+        Px_Put(row, x++, idx);
+}
+
+/**
+ * @brief 화면 내용을 모를 때 - 모든 행의 열 범위를 전체 폭으로
+ */
+static void Pal_ShownFull(void)
+{
+    memset(shown_xl, 0, sizeof(shown_xl));
+    memset(shown_xr, LCD_WIDTH - 1, sizeof(shown_xr));
+}
+
+/**
+ * @brief FNV-1a 32bit 해시 (행 변경 감지용, 4바이트 단위)
+ */
+static uint32_t Row_Hash(const uint32_t *p, uint32_t n)
+{
+    uint32_t h = 2166136261u;
+    while (n--)
+    {
+        h ^= *p++;
+        h *= 16777619u;
+    }
+    return h;
+}
+
+/**
+ * @brief 팔레트에서 가장 가까운 색 (R/G/B 각각 6bit로 맞춰 거리 비교)
+ */
+static uint8_t Pal_Nearest(uint16_t c)
+{
+    int16_t r = (c >> 11) << 1, g = (c >> 5) & 0x3F, b = (c & 0x1F) << 1;
+    uint32_t best = UINT32_MAX;
+    uint8_t  bi = 0;
+
+    for (uint8_t i = 0; i < pal_used; i++)
+    {
+        int16_t dr = r - ((palette[i] >> 11) << 1);
+        int16_t dg = g - ((palette[i] >> 5) & 0x3F);
+        int16_t db = b - ((palette[i] & 0x1F) << 1);
+        uint32_t d = (uint32_t)(dr * dr + dg * dg + db * db);
+        if (d < best)
+        {
+            best = d;
+            bi = i;
+        }
+    }
+    return bi;
+}
+
+/* ===== 외부 API ===== */
+
+void Pal_SetPalette(const uint16_t *colors, uint8_t n)
+{
+    if (n > PAL_COLORS) n = PAL_COLORS;
+    memcpy(palette, colors, n * sizeof(uint16_t));
+    pal_used = n;
+    pal_valid = 0;      // 같은 인덱스의 색이 바뀜 → 화면 전체 다시
+}
+
+/**
+ * @brief RGB565 → 인덱스 (도형 1개에 1번, 픽셀마다 부르지 않음)
+ */
+uint8_t Pal_Color(uint16_t color)
+{
+    for (uint8_t i = 0; i < pal_used; i++)
+    {
+        if (palette[i] == color) return i;
+    }
+
+    if (pal_used < PAL_COLORS)
+    {
+        palette[pal_used] = color;
+        return pal_used++;
+    }
+
+    stats.nearest++;
+    return Pal_Nearest(color);
+}
+
+void Pal_Begin(uint16_t bg)
+{
+    bg_idx = Pal_Color(bg);
+    if (bg_idx != shown_bg)
+    {
+        /* 배경이 바뀌면 화면 전체가 달라짐 */
+        shown_bg = bg_idx;
+        Pal_ShownFull();
+    }
+
+    memset(fb, (int)(bg_idx * PAL_REP), sizeof(fb));
+    memset(row_xl, EXT_EMPTY, sizeof(row_xl));
+    memset(row_xr, EXT_EMPTY, sizeof(row_xr));
+}
+
+void Pal_Add(const GfxShape_t *s)
+{
+    int16_t top, bottom;
+    uint8_t idx = Pal_Color(s->color);
+
+    Gfx_ShapeRows(s, &top, &bottom);
+    if (top < 0) top = 0;
+    if (bottom >= LCD_HEIGHT) bottom = LCD_HEIGHT - 1;
+
+    for (int16_t y = top; y <= bottom; y++)
+    {
+        int16_t xl, xr;
+        if (Gfx_ShapeRowSpan(s, y, &xl, &xr))
+            Pal_Span(y, xl, xr, idx);
+    }
+}
+
+void Pal_FillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
+{
+    if (w <= 0 || h <= 0) return;
+    GfxShape_t s = { GFX_RECT, x, y, x + w - 1, y + h - 1, 0, color, 0 };
+    Pal_Add(&s);
+}
+
+void Pal_RoundRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, uint16_t color)
+{
+    if (w <= 0 || h <= 0) return;
+    GfxShape_t s = { GFX_RRECT, x, y, x + w - 1, y + h - 1, r, color, 0 };
+    Pal_Add(&s);
+}
+
+void Pal_FillCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color)
+{
+    GfxShape_t s = { GFX_CIRCLE, x0, y0, x0, y0, r, color, 0 };
+    Pal_Add(&s);
+}
+
+void Pal_ThickLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t t, uint16_t color)
+{
+    GfxShape_t s = { GFX_LINE, x0, y0, x1, y1, t, color, 0 };
+    Pal_Add(&s);
+}
+
+/**
+ * @brief 밴드 RLE(플래시 아틀라스)를 프레임버퍼에 풀어 그림
+ * @note  palette[0] = 배경 → 배경 run은 Pal_Begin이 이미 지웠으므로 건너뜀
+ */
+void Pal_DrawRle(const BandRle_t *bands, const uint16_t *runs, const uint16_t *rle_palette)
+{
+    uint8_t map[16];
+    memset(map, EXT_EMPTY, sizeof(map));
+
+    Pal_Begin(rle_palette[0]);
+
+    for (uint8_t b = 0; b < BAND_COUNT; b++)
+    {
+        const uint16_t *run = &runs[bands[b].run_start];
+        uint16_t pos = 0;   // 밴드 안 픽셀 위치 (행 x LCD_WIDTH + 열)
+
+        for (uint16_t i = 0; i < bands[b].run_count; i++)
+        {
+            uint8_t  ri = BAND_RLE_INDEX(run[i]);
+            uint16_t n  = BAND_RLE_LEN(run[i]);
+
+            if (ri != 0)
+            {
+                if (map[ri] == EXT_EMPTY) map[ri] = Pal_Color(rle_palette[ri]);
+
+                /* run이 여러 행에 걸치면 행마다 나눠 채움 */
+                uint16_t p = pos, left = n;
+                while (left)
+                {
+                    uint16_t x = p % LCD_WIDTH;
+                    uint16_t k = (uint16_t)(LCD_WIDTH - x);
+                    if (k > left) k = left;
+                    Pal_Span((int16_t)(b * BAND_H + p / LCD_WIDTH), (int16_t)x, (int16_t)(x + k - 1), map[ri]);
+                    p += k;
+                    left -= k;
+                }
+            }
+            pos += n;
+        }
+    }
+}
+
+/**
+ * @brief 바뀐 행만 전송 (완료까지 대기 - 리턴 후 바로 다음 프레임을 그려도 됨)
+ * @return 보낸 창 수
+ */
+uint8_t Pal_Commit(void)
+{
+    uint32_t c0 = Time_Cycles();
+    uint8_t  changed[LCD_HEIGHT];
+    uint8_t  windows = 0;
+    uint16_t rows = 0;
+    uint32_t pixels = 0;
+
+    if (!pal_valid) Pal_ShownFull();
+
+    for (int16_t y = 0; y < LCD_HEIGHT; y++)
+    {
+        uint32_t h = Row_Hash((const uint32_t *)&fb[y * PAL_STRIDE], PAL_STRIDE / 4);
+        changed[y] = (!pal_valid || h != row_hash[y]);
+        row_hash[y] = h;
+    }
+    pal_valid = 1;
+
+    for (int16_t y = 0; y < LCD_HEIGHT; )
+    {
+        if (!changed[y])
+        {
+            /* 내용이 같으므로 정확한 범위로 좁혀 둠 */
+            shown_xl[y] = row_xl[y];
+            shown_xr[y] = row_xr[y];
+            y++;
+            continue;
+        }
+
+        /* 이어진 바뀐 행 = 창 1개, 열은 (화면 ∪ 새 내용) */
+        int16_t y0 = y;
+        int16_t wl = LCD_WIDTH, wr = -1;
+        while (y < LCD_HEIGHT && changed[y])
+        {
+            if (shown_xl[y] != EXT_EMPTY && shown_xl[y] < wl) wl = shown_xl[y];
+            if (shown_xr[y] != EXT_EMPTY && shown_xr[y] > wr) wr = shown_xr[y];
+            if (row_xl[y]   != EXT_EMPTY && row_xl[y]   < wl) wl = row_xl[y];
+            if (row_xr[y]   != EXT_EMPTY && row_xr[y]   > wr) wr = row_xr[y];
+            shown_xl[y] = row_xl[y];
+            shown_xr[y] = row_xr[y];
+            y++;
+        }
+
+        if (wl > wr)
+        {
+            /* 양쪽 다 배경뿐인데 해시가 다름 (방어 코드) → 전체 폭 */
+            wl = 0;
+            wr = LCD_WIDTH - 1;
+        }
+
+        LCD_Indexed_t src = {
+            fb, palette, PAL_STRIDE,
+            (uint16_t)wl, (uint16_t)(wr - wl + 1),
+            (uint16_t)y0, (uint16_t)(y - y0),
+            PAL_BPP
+        };
+        LCD_SetWindow(wl, y0, wr, y - 1);
+        LCD_SubmitIndexed(&src);
+
+        windows++;
+        rows += (uint16_t)(y - y0);
+        pixels += (uint32_t)src.w * src.h;
+    }
+
+    LCD_WaitIdle();
+
+    uint32_t c = Time_Cycles() - c0;
+    stats.frames++;
+    stats.windows += windows;
+    stats.rows += rows;
+    stats.pixels += pixels;
+    stats.last_cycles = c;
+    if (c > stats.max_cycles) stats.max_cycles = c;
+    if (pixels == (uint32_t)LCD_WIDTH * LCD_HEIGHT)
+    {
+        stats.full_frames++;
+        stats.full_cycles = c;
+    }
+    return windows;
+}
+
+void Pal_Invalidate(void)
+{
+    pal_valid = 0;
+}
+
+void Pal_GetStats(PalStats_t *out)
+{
+    *out = stats;
+}
+
+void Pal_ResetStats(void)
+{
+    stats = (PalStats_t){0};
+}
+
+/**
+ * @brief 프레임버퍼 상태 - full = 전체 화면 1장 시간 (Pal_Invalidate 뒤 Commit에서 측정)
+ */
+void Pal_PrintStats(void)
+{
+    PalStats_t s;
+    Pal_GetStats(&s);
+
+    uint32_t full_us = Time_CyclesToUs(s.full_cycles);
+    uint32_t fps10 = full_us ? 10000000u / full_us : 0;
+
+    printf("pal %dbpp %u/%d colors | frames %lu win %lu rows %lu px %lu | last %luus max %luus | full %lu x %luus (%lu.%lu fps) nearest %lu\r\n",
+           PAL_BPP, pal_used, PAL_COLORS,
+           (unsigned long)s.frames, (unsigned long)s.windows, (unsigned long)s.rows, (unsigned long)s.pixels,
+           (unsigned long)Time_CyclesToUs(s.last_cycles), (unsigned long)Time_CyclesToUs(s.max_cycles),
+           (unsigned long)s.full_frames, (unsigned long)full_us,
+           (unsigned long)(fps10 / 10), (unsigned long)(fps10 % 10), (unsigned long)s.nearest);
+}
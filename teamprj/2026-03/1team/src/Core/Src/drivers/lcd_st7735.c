@@ -3,13 +3,16 @@
  * @brief ST7735 LCD 드라이버 - 성능 최적화 버전
  * 
  * 최적화 내용:
- * 1. DMA 전송 지원 (선택적)
+ * 1. 핑퐁(더블 버퍼) DMA 파이프라인 - 전송 중 CPU 반환
  * 2. 버퍼 기반 bulk 전송
  * 3. CS 토글 최소화
+ * 4. 인덱스 픽셀 span - 팔레트 프레임버퍼를 DMA 리필 때 한 줄씩 RGB565로 확장
+ * 5. 글자 span - 문자열 전체를 창 1개로, 글리프 캐시(행 우선 비트마스크)에서 행마다 RGB565 확장
  */
 
 #include "drivers/lcd_st7735.h"
 #include "stm32f1xx_hal.h"
+#include "prof.h"
 
 volatile uint8_t spi_dma_busy = 0;
 volatile uint8_t spi_dma_done = 1;
@@ -39,9 +42,54 @@ extern SPI_HandleTypeDef hspi2;
 #define ST7735_MADCTL  0x36
 #define ST7735_COLMOD  0x3A
 
-/* ===== 전송 버퍼 (스택 절약을 위해 static) ===== */
-#define TX_BUF_SIZE 128
-static uint8_t tx_buf[TX_BUF_SIZE];
+/* ===== 전송 버퍼 (핑퐁 2개, 스택 절약을 위해 static) ===== */
+#define TX_BUF_SIZE     (LCD_WIDTH * 2)     // 한 줄 = 버퍼 1개
+#define TX_BUF_PIXELS   (TX_BUF_SIZE / 2)
+#define SPAN_TIMEOUT_MS 50
+static uint8_t tx_buf[2][TX_BUF_SIZE] __attribute__((aligned(4)));
+
+/* ===== 진행 중인 span 상태 (DMA 콜백과 공유) ===== */
+static uint16_t (*span_fill)(uint8_t idx);  // 버퍼 리필 함수, NULL이면 단색 span
+static const uint16_t *span_src = NULL;  // 픽셀 배열 span의 다음 픽셀
+static uint32_t span_remain = 0;         // 아직 버퍼로 옮기지 않은 픽셀 수
+static volatile uint16_t span_len[2];    // 버퍼별 준비된 바이트 수 (0 = 비어있음)
+static volatile uint8_t  span_active;    // 현재 DMA로 나가는 버퍼 번호
+
+/* 인덱스 span: 팔레트는 바이트 순서를 미리 바꿔 둠 → 픽셀당 16bit 저장 1번 */
+static struct {
+    const uint8_t *row;     // 현재 행 시작 바이트
+    uint16_t stride;
+    uint16_t x, w, col;     // col = 현재 행에서 다음에 보낼 열 (0 ~ w-1)
+    uint8_t  ppb_shift;     // x → 바이트 (x >> ppb_shift)
+    uint8_t  ppb_mask;      // 바이트 안 위치 (x & ppb_mask)
+    uint8_t  bpp_shift;     // 위치 → 비트 이동 (× bpp)
+    uint8_t  pix_mask;
+    uint16_t pal_be[16];    // 빅엔디안 RGB565 (최대 4bpp)
+} ix;
+
+/* 글리프 캐시: 폰트는 열 우선(바이트 = 열, 비트 = 행) → 행 우선으로 펼쳐 둠 (행 1개 = 바이트 1개)
+ * 칸 수가 한 줄 최대 글자 수보다 많아서, 문자열 하나의 글자끼리는 서로 밀어내지 않음 */
+#define GLYPH_SLOTS     32
+
+static struct {
+    uint8_t  rows[LCD_CHAR_H];  // bit0 = 왼쪽 열, 6번째 열(간격)은 0
+    uint8_t  ch;                // 0 = 빈 칸
+    uint16_t used;              // 마지막으로 쓴 문자열 번호 (LRU)
+} glyphs[GLYPH_SLOTS];
+static uint8_t  glyph_slot[95]; // 글자(32~126) → 칸 + 1 (0 = 없음)
+static uint16_t glyph_clock = 0;
+
+/* 글자 span: 문자열은 복사 (호출한 쪽 버퍼가 DMA 중에 사라져도 됨) */
+static struct {
+    uint8_t  slot[LCD_TEXT_MAX];
+    uint8_t  n;
+    uint8_t  scale;
+    uint16_t w;                 // 픽셀 폭 = n x 6 x scale
+    uint16_t row;               // 다음에 보낼 행 (0 ~ 8 x scale - 1)
+    uint16_t fg_be, bg_be;      // 빅엔디안 RGB565
+} txt;
+
+static LCD_BusStats_t bus_stats;
 
 /* ===== 내부 함수 ===== */
 
@@ -51,6 +99,8 @@ static inline void LCD_Cmd(uint8_t cmd)
     LCD_CS_LOW();
     HAL_SPI_Transmit(&hspi2, &cmd, 1, HAL_MAX_DELAY);
     LCD_CS_HIGH();
+    bus_stats.cmd_count++;
+    bus_stats.bytes++;
 }
 
 static inline void LCD_Data(uint8_t data)
@@ -59,12 +109,124 @@ static inline void LCD_Data(uint8_t data)
     LCD_CS_LOW();
     HAL_SPI_Transmit(&hspi2, &data, 1, HAL_MAX_DELAY);
     LCD_CS_HIGH();
+    bus_stats.bytes++;
+}
+
+/**
+ * @brief span 데이터를 tx_buf[idx]로 옮김 (픽셀 → 빅엔디안 바이트)
+ * @return 준비된 바이트 수
+ */
+static uint16_t Span_Fill(uint8_t idx)
+{
+    uint32_t chunk = (span_remain > TX_BUF_PIXELS) ? TX_BUF_PIXELS : span_remain;
+    uint16_t *dst = (uint16_t *)tx_buf[idx];
+    const uint16_t *src = span_src;
+
+    /* 픽셀당 16bit 저장 1번 (바이트 교환 = REV16) - 바이트 2번 저장보다 리필이 절반 */
+    for (uint32_t i = 0; i < chunk; i++)
+        dst[i] = (uint16_t)((src[i] >> 8) | (src[i] << 8));
+
+    span_src    += chunk;
+    span_remain -= chunk;
+    return (uint16_t)(chunk * 2);
+}
+
+/**
+ * @brief 인덱스 span을 tx_buf[idx]로 확장 (팔레트 룩업, 행 끝에서 다음 행으로)
+ * @note  DMA 콜백에서도 호출 - 160픽셀 한 줄이 반대편 버퍼 전송 시간 안에 끝남
+ * @return 준비된 바이트 수
+ */
+static uint16_t Span_FillIndexed(uint8_t idx)
+{
+    uint32_t chunk = (span_remain > TX_BUF_PIXELS) ? TX_BUF_PIXELS : span_remain;
+    uint16_t *dst = (uint16_t *)tx_buf[idx];
+    const uint8_t *row = ix.row;
+    uint16_t col = ix.col;
+
+    for (uint32_t i = 0; i < chunk; i++)
+    {
+        uint16_t x = ix.x + col;
+        uint8_t  s = (uint8_t)(((~x) & ix.ppb_mask) << ix.bpp_shift);   // MSB 먼저
+        *dst++ = ix.pal_be[(row[x >> ix.ppb_shift] >> s) & ix.pix_mask];
+        if (++col == ix.w)
+        {
+            col = 0;
+            row += ix.stride;
+        }
+    }
+
+    ix.row = row;
+    ix.col = col;
+    span_remain -= chunk;
+    return (uint16_t)(chunk * 2);
+}
+
+/**
+ * @brief 글자 span을 tx_buf[idx]로 확장 - 버퍼에 들어가는 만큼 행 단위로 (짧은 문자열은 여러 행)
+ * @return 준비된 바이트 수
+ */
+static uint16_t Span_FillText(uint8_t idx)
+{
+    uint16_t *dst = (uint16_t *)tx_buf[idx];
+    uint32_t rows = TX_BUF_PIXELS / txt.w;
+    uint32_t left = span_remain / txt.w;
+    if (rows > left) rows = left;
+
+    for (uint32_t r = 0; r < rows; r++, txt.row++)
+    {
+        uint8_t gr = (uint8_t)(txt.row / txt.scale);
+        for (uint8_t i = 0; i < txt.n; i++)
+        {
+            uint8_t m = glyphs[txt.slot[i]].rows[gr];
+            for (uint8_t col = 0; col < LCD_CHAR_W; col++, m >>= 1)
+            {
+                uint16_t c = (m & 1) ? txt.fg_be : txt.bg_be;
+                for (uint8_t k = 0; k < txt.scale; k++) *dst++ = c;
+            }
+        }
+    }
+
+    span_remain -= rows * txt.w;
+    return (uint16_t)(rows * txt.w * 2);
+}
+
+/**
+ * @brief span 종료 (정상/에러 공통)
+ */
+static void Span_Finish(void)
+{
+    span_len[0] = 0;
+    span_len[1] = 0;
+    span_remain = 0;
+    LCD_CS_HIGH();
+    spi_dma_done = 1;
+    spi_dma_busy = 0;
+    spi_busy = 0;
+}
+
+/**
+ * @brief tx_buf[idx] DMA 전송 시작
+ */
+static void Span_Kick(uint8_t idx)
+{
+    span_active = idx;
+    bus_stats.dma_kicks++;
+    bus_stats.bytes += span_len[idx];
+
+    if (HAL_SPI_Transmit_DMA(&hspi2, tx_buf[idx], span_len[idx]) != HAL_OK)
+    {
+        bus_stats.errors++;
+        Span_Finish();
+    }
 }
 
 /* ===== 외부 API ===== */
 
 void LCD_SetWindow(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1)
 {
+    /* 이전 span이 버스를 쓰고 있으면 끝날 때까지 대기 */
+    LCD_WaitIdle();
+
     /* CASET (Column Address Set) */
     LCD_Cmd(ST7735_CASET);
     LCD_DC_HIGH();
@@ -84,88 +246,174 @@ void LCD_SetWindow(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1)
     /* RAMWR (Memory Write 시작) */
     LCD_Cmd(ST7735_RAMWR);
 
-
+    bus_stats.windows++;
+    bus_stats.bytes += 8;
 }
 
 /**
- * @brief 색상을 count개 연속 출력 (버퍼 기반 bulk 전송)
+ * @brief 단색 span 제출 (논블로킹)
+ * @note  LCD_SetWindow 직후 호출. 완료는 LCD_IsIdle()로 확인
  */
-void LCD_WriteColorFast(uint16_t color, uint32_t count)
+void LCD_SubmitColor(uint16_t color, uint32_t count)
 {
-    uint8_t hi = color >> 8;
-    uint8_t lo = color & 0xFF;
+    if (count == 0) return;
 
-    for (int i = 0; i < TX_BUF_SIZE; i += 2)
-    {
-        tx_buf[i]     = hi;
-        tx_buf[i + 1] = lo;
-    }
+    LCD_WaitIdle();
+
+    /* 버퍼는 첫 청크만큼만 채움 (짧은 span이 버퍼 전체를 채우지 않게), 이후 청크는 같은 버퍼 재전송 */
+    uint32_t chunk = (count > TX_BUF_PIXELS) ? TX_BUF_PIXELS : count;
+    uint16_t be = (uint16_t)((color >> 8) | (color << 8));
+    uint16_t *dst = (uint16_t *)tx_buf[0];
+    for (uint32_t i = 0; i < chunk; i++)
+        dst[i] = be;
+
+    span_fill = NULL;
+    span_remain = count - chunk;
+
+    spi_busy = 1;
+    spi_dma_busy = 1;
+    spi_dma_done = 0;
+    span_len[0] = (uint16_t)(chunk * 2);
+    span_len[1] = 0;
 
-    spi_busy = 1;        // ← 전송 시작
     LCD_DC_HIGH();
     LCD_CS_LOW();
+    Span_Kick(0);
+}
 
-    uint32_t pixels_per_buf = TX_BUF_SIZE / 2;
-    while (count > 0)
-    {
-        uint32_t chunk = (count >= pixels_per_buf) ? pixels_per_buf : count;
-        HAL_SPI_Transmit(&hspi2, tx_buf, chunk * 2, HAL_MAX_DELAY);
-        count -= chunk;
-    }
+/**
+ * @brief 픽셀 배열 span 제출 (논블로킹)
+ * @note  buf는 LCD_IsIdle()이 1이 될 때까지 유지되어야 함
+ */
+void LCD_SubmitBuffer(const uint16_t *buf, uint32_t count)
+{
+    if (buf == NULL || count == 0) return;
 
-    LCD_CS_HIGH();
-    spi_busy = 0;        // ← 전송 완료
+    LCD_WaitIdle();
+
+    spi_busy = 1;
+    spi_dma_busy = 1;
+    spi_dma_done = 0;
+
+    /* 두 버퍼를 미리 채워두고 첫 번째부터 출발 (이후 리필은 콜백에서) */
+    span_fill = Span_Fill;
+    span_src = buf;
+    span_remain = count;
+    span_len[0] = Span_Fill(0);
+    span_len[1] = (span_remain > 0) ? Span_Fill(1) : 0;
+
+    LCD_DC_HIGH();
+    LCD_CS_LOW();
+    Span_Kick(0);
 }
+
 /**
- * @brief 색상 배열을 직접 전송 (이미지 출력용)
+ * @brief 인덱스 픽셀 span 제출 (논블로킹) - 팔레트 확장은 버퍼 리필 때 한 줄씩
+ * @note  LCD_SetWindow(x, y, x+w-1, y+h-1) 직후 호출. fb는 LCD_IsIdle()이 1이 될 때까지 유지
+ *        팔레트는 여기서 복사하므로 호출 후 바꿔도 됨
  */
-void LCD_WriteBuffer(uint16_t *buf, uint32_t count)
+void LCD_SubmitIndexed(const LCD_Indexed_t *src)
 {
+    if (src == NULL || src->w == 0 || src->h == 0) return;
+
+    LCD_WaitIdle();
+
+    uint8_t shift = (src->bpp >= 4) ? 2 : (src->bpp >= 2) ? 1 : 0;   // log2(bpp)
+    uint16_t colors = (uint16_t)(1u << (1u << shift));
+    for (uint16_t i = 0; i < colors; i++)
+    {
+        uint16_t c = src->palette[i];
+        ix.pal_be[i] = (uint16_t)((c >> 8) | (c << 8));
+    }
+    ix.bpp_shift = shift;
+    ix.ppb_shift = (uint8_t)(3 - shift);
+    ix.ppb_mask  = (uint8_t)((1u << (3 - shift)) - 1);
+    ix.pix_mask  = (uint8_t)(colors - 1);
+    ix.row    = src->fb + (uint32_t)src->y * src->stride;
+    ix.stride = src->stride;
+    ix.x   = src->x;
+    ix.w   = src->w;
+    ix.col = 0;
+
+    spi_busy = 1;
+    spi_dma_busy = 1;
+    spi_dma_done = 0;
+
+    span_fill = Span_FillIndexed;
+    span_remain = (uint32_t)src->w * src->h;
+    span_len[0] = Span_FillIndexed(0);
+    span_len[1] = (span_remain > 0) ? Span_FillIndexed(1) : 0;
+
     LCD_DC_HIGH();
     LCD_CS_LOW();
+    Span_Kick(0);
+}
 
-    while (count > 0)
-    {
-        uint32_t chunk = (count > TX_BUF_SIZE / 2) ? TX_BUF_SIZE / 2 : count;
+/**
+ * @brief 제출된 span 완료 여부 (폴링용)
+ */
+uint8_t LCD_IsIdle(void)
+{
+    return !spi_dma_busy;
+}
 
-        for (uint32_t i = 0; i < chunk; i++)
-        {
-            tx_buf[i * 2]     = buf[i] >> 8;
-            tx_buf[i * 2 + 1] = buf[i] & 0xFF;
-        }
+/**
+ * @brief 진행 중인 span 완료까지 대기 (타임아웃 시 강제 종료)
+ */
+void LCD_WaitIdle(void)
+{
+    if (!spi_dma_busy) return;
 
-        spi_dma_done = 0;
-        spi_dma_busy = 1;
-        if (HAL_SPI_Transmit_DMA(&hspi2, tx_buf, chunk * 2) == HAL_OK)
-        {
-            uint32_t t = HAL_GetTick();
-            while (!spi_dma_done)
-            {
-                if (HAL_GetTick() - t > 50)
-                {
-                    LCD_CS_HIGH();
-                    spi_dma_busy = 0;
-                    break;
-                }
-            }
-        }
-        else
+    uint32_t t = HAL_GetTick();
+    while (spi_dma_busy)
+    {
+        if (HAL_GetTick() - t > SPAN_TIMEOUT_MS)
         {
-            LCD_CS_HIGH();
-            spi_dma_busy = 0;
+            HAL_SPI_DMAStop(&hspi2);
+            bus_stats.errors++;
+            Span_Finish();
             break;
         }
-
-        buf   += chunk;
-        count -= chunk;
     }
 }
+
+/**
+ * @brief 색상을 count개 연속 출력 (DMA, 반환 후에도 전송 계속)
+ */
+void LCD_WriteColorFast(uint16_t color, uint32_t count)
+{
+    PROF_SCOPE(PROF_LCD_FILL);
+    LCD_SubmitColor(color, count);
+}
+
+/**
+ * @brief 색상 배열을 직접 전송 (이미지 출력용, 완료까지 대기)
+ */
+void LCD_WriteBuffer(uint16_t *buf, uint32_t count)
+{
+    LCD_SubmitBuffer(buf, count);
+    LCD_WaitIdle();
+}
+
 void LCD_Clear(uint16_t color)
 {
     LCD_SetWindow(0, 0, LCD_WIDTH - 1, LCD_HEIGHT - 1);
     LCD_WriteColorFast(color, (uint32_t)LCD_WIDTH * LCD_HEIGHT);
 }
 
+/**
+ * @brief 버스 통계 조회/초기화 (명령 수, 바이트 수)
+ */
+void LCD_GetBusStats(LCD_BusStats_t *out)
+{
+    *out = bus_stats;
+}
+
+void LCD_ResetBusStats(void)
+{
+    bus_stats = (LCD_BusStats_t){0};
+}
+
 void LCD_Init(void)
 {
     /* 하드웨어 리셋 */
@@ -195,12 +443,50 @@ void LCD_Init(void)
     HAL_Delay(100);
 }
 
+/**
+ * @brief DMA 완료 콜백 - 다음 버퍼를 바로 보내고 방금 끝난 버퍼를 다시 채움
+ */
 void HAL_SPI_TxCpltCallback(SPI_HandleTypeDef *hspi)
+{
+    if (hspi->Instance != SPI2)
+        return;
+
+    uint8_t done = span_active;
+    uint8_t next = done ^ 1;
+    span_len[done] = 0;
+
+    if (span_fill == NULL)
+    {
+        /* 단색: 같은 버퍼 재전송 */
+        if (span_remain > 0)
+        {
+            uint32_t chunk = (span_remain > TX_BUF_PIXELS) ? TX_BUF_PIXELS : span_remain;
+            span_remain -= chunk;
+            span_len[done] = (uint16_t)(chunk * 2);
+            Span_Kick(done);
+            return;
+        }
+    }
+    else if (span_len[next] != 0)
+    {
+        /* 준비된 반대편 버퍼를 먼저 출발시키고, 전송 중에 리필 */
+        Span_Kick(next);
+        if (span_remain > 0 && spi_dma_busy)
+        {
+            span_len[done] = span_fill(done);
+        }
+        return;
+    }
+
+    Span_Finish();
+}
+
+void HAL_SPI_ErrorCallback(SPI_HandleTypeDef *hspi)
 {
     if (hspi->Instance == SPI2)
     {
-        spi_dma_done = 1;
-        spi_dma_busy = 0;
+        bus_stats.errors++;
+        Span_Finish();
     }
 }
 
@@ -303,41 +589,101 @@ static const uint8_t font5x7[][5] = {
     {0x08,0x08,0x2A,0x1C,0x08}, // '~'
 };
 
-void LCD_DrawChar(uint16_t x, uint16_t y, char c, uint16_t fg, uint16_t bg)
+/**
+ * @brief 글자 → 글리프 캐시 칸 (없으면 가장 오래 안 쓴 칸에 펼침)
+ * @note  지금 문자열에서 이미 쓴 칸(used == glyph_clock)은 내보내지 않음
+ */
+static uint8_t Glyph_Get(char c)
 {
     if (c < 32 || c > 126) c = '?';
-    const uint8_t *glyph = font5x7[c - 32];
-    uint8_t buf[6 * 8 * 2];  /* 6열 x 8행 x 2바이트 */
-    int idx = 0;
+    uint8_t code = (uint8_t)(c - 32);
+    uint8_t k = glyph_slot[code];
 
-    for (int row = 0; row < 8; row++)
+    if (k-- == 0)
     {
-        for (int col = 0; col < 5; col++)
+        k = 0;
+        for (uint8_t i = 0; i < GLYPH_SLOTS; i++)
+        {
+            if (glyphs[i].ch == 0) { k = i; break; }
+            if (glyphs[i].used != glyph_clock &&
+                (glyphs[k].used == glyph_clock || (uint16_t)(glyph_clock - glyphs[i].used) > (uint16_t)(glyph_clock - glyphs[k].used)))
+                k = i;
+        }
+        if (glyphs[k].ch) glyph_slot[glyphs[k].ch - 32] = 0;
+
+        const uint8_t *g = font5x7[code];
+        for (uint8_t row = 0; row < LCD_CHAR_H; row++)
         {
-            uint16_t color = (glyph[col] & (1 << row)) ? fg : bg;
-            buf[idx++] = color >> 8;
-            buf[idx++] = color & 0xFF;
+            uint8_t m = 0;
+            for (uint8_t col = 0; col < 5; col++)
+                if (g[col] & (1u << row)) m |= (uint8_t)(1u << col);
+            glyphs[k].rows[row] = m;
         }
-        /* 6번째 열(간격)은 배경색 */
-        buf[idx++] = bg >> 8;
-        buf[idx++] = bg & 0xFF;
+        glyphs[k].ch = (uint8_t)c;
+        glyph_slot[code] = (uint8_t)(k + 1);
+        bus_stats.glyph_misses++;
     }
 
-    LCD_SetWindow(x, y, x + 5, y + 7);
+    glyphs[k].used = glyph_clock;
+    return k;
+}
+
+/**
+ * @brief 문자열 출력 - 창 1개 + DMA span 1개 (배율 1~4, 화면 밖 글자/행은 잘림)
+ * @return 그린 폭 (px), 다음 글자 x = x + 반환값
+ */
+uint16_t LCD_DrawText(uint16_t x, uint16_t y, const char *str, uint16_t fg, uint16_t bg, uint8_t scale)
+{
+    if (str == NULL || x >= LCD_WIDTH || y >= LCD_HEIGHT) return 0;
+    if (scale < 1) scale = 1;
+    if (scale > 4) scale = 4;
+
+    uint16_t cw = (uint16_t)(LCD_CHAR_W * scale);
+    uint16_t fit = (uint16_t)((LCD_WIDTH - x) / cw);
+    uint16_t n = 0;
+    while (str[n] && n < fit) n++;
+    if (n == 0) return 0;
+
+    uint16_t w = (uint16_t)(n * cw);
+    uint16_t h = (uint16_t)(LCD_CHAR_H * scale);
+    if (y + h > LCD_HEIGHT) h = (uint16_t)(LCD_HEIGHT - y);
+
+    LCD_SetWindow(x, y, x + w - 1, y + h - 1);     // 이전 span 완료 대기 포함 → 캐시를 바꿔도 안전
+
+    glyph_clock++;
+    for (uint16_t i = 0; i < n; i++)
+        txt.slot[i] = Glyph_Get(str[i]);
+    txt.n = (uint8_t)n;
+    txt.scale = scale;
+    txt.w = w;
+    txt.row = 0;
+    txt.fg_be = (uint16_t)((fg >> 8) | (fg << 8));
+    txt.bg_be = (uint16_t)((bg >> 8) | (bg << 8));
+    bus_stats.texts++;
+
+    spi_busy = 1;
+    spi_dma_busy = 1;
+    spi_dma_done = 0;
+
+    span_fill = Span_FillText;
+    span_remain = (uint32_t)w * h;
+    span_len[0] = Span_FillText(0);
+    span_len[1] = (span_remain > 0) ? Span_FillText(1) : 0;
+
     LCD_DC_HIGH();
     LCD_CS_LOW();
-    /* DMA 대신 블로킹 전송 (96바이트라 빠름) */
-    HAL_SPI_Transmit(&hspi2, buf, sizeof(buf), HAL_MAX_DELAY);
-    LCD_CS_HIGH();
+    Span_Kick(0);
+    return w;
+}
+
+void LCD_DrawChar(uint16_t x, uint16_t y, char c, uint16_t fg, uint16_t bg)
+{
+    char s[2] = { c, 0 };
+    LCD_DrawText(x, y, s, fg, bg, 1);
 }
 
 void LCD_DrawString(uint16_t x, uint16_t y, const char *str,
                     uint16_t fg, uint16_t bg)
 {
-    while (*str)
-    {
-        LCD_DrawChar(x, y, *str++, fg, bg);
-        x += 6;
-        if (x + 6 > LCD_WIDTH) break;
-    }
+    LCD_DrawText(x, y, str, fg, bg, 1);
 }
@@ -0,0 +1,191 @@
+/**
+ * @file led_fx.c
+ * @brief RGB LED 효과 플레이어 - 기술자를 프레임 단위 밝기로 풀고, 밝기를 소프트 PWM 에지 표로 컴파일
+ *
+ * 동작:
+ * 1. Start/Step: 기술자 {종류, 반복, 주기, 색 a, 색 b} → 경과 시간마다 채널별 밝기
+ *    - 깜빡임: 반주기 a / 반주기 b, 숨쉬기: a → b → a 삼각파, 페이드: a → b 한 번
+ *    - 반복이 끝나면 마지막 값에서 멈춤 (done) → 보드는 PWM 인터럽트를 끔
+ * 2. Compile: 밝기 3개 → PWM 한 주기의 에지 표
+ *    - 켜짐 시간 = 주기 × (밝기/255)² (감마 보정, 숨쉬기가 어두운 쪽에서 느리게 보임)
+ *    - min_us 보다 짧은 펄스/틈은 0%/100% (인터럽트 간격 확보), 가까운 끄기 에지는 1개로 합침
+ *    → 주기 시작 1번 + 끄기 최대 3번, 에지가 없으면 정적 (주기 인터럽트 필요 없음)
+ *
+ * 나눗셈은 프레임마다 (Step/Compile) - PWM 에지마다는 표만 읽음
+ */
+
+#include <stddef.h>
+#include "drivers/led_fx.h"
+
+/* ===== 내장 효과 ===== */
+static const struct {
+    const char *name;
+    LedFx_t fx;
+} effects[LEDFX_FX_COUNT] = {
+    [LEDFX_FX_REVERSE]  = { "reverse",  { LEDFX_BLINK,   0, 500,  { 255, 255, 0 }, { 0, 0, 0 }   } },
+    [LEDFX_FX_IDLE]     = { "idle",     { LEDFX_BREATHE, 0, 3000, { 0, 0, 8 },     { 0, 0, 200 } } },
+    [LEDFX_FX_ALERT]    = { "alert",    { LEDFX_BLINK,   3, 200,  { 255, 0, 0 },   { 0, 0, 0 }   } },
+    [LEDFX_FX_FADE_OUT] = { "fade_out", { LEDFX_FADE,    1, 800,  { 0, 255, 0 },   { 0, 0, 0 }   } },
+};
+
+/* ===== 내부 함수 ===== */
+
+static uint16_t Period(const LedFx_t *fx)
+{
+    return fx->period_ms ? fx->period_ms : 1;
+}
+
+/**
+ * @brief 섞기 비율 k (0 = a, 255 = b)로 채널별 밝기
+ */
+static void Mix(const LedFx_t *fx, uint16_t k, uint8_t out[LEDFX_CH])
+{
+    for (uint8_t c = 0; c < LEDFX_CH; c++)
+    {
+        int16_t d = (int16_t)fx->b[c] - (int16_t)fx->a[c];
+        out[c] = (uint8_t)(fx->a[c] + d * (int16_t)k / 255);
+    }
+}
+
+/**
+ * @brief 주기 안 위치 t (ms) → 섞기 비율
+ */
+static uint16_t Mix_At(const LedFx_t *fx, uint32_t t)
+{
+    uint32_t per = Period(fx);
+
+    switch (fx->kind)
+    {
+    case LEDFX_BLINK:
+        return (t < per / 2) ? 0 : 255;
+
+    case LEDFX_BREATHE:
+    {
+        uint32_t u = t * 510u / per;            // 0 .. 509
+        return (uint16_t)((u <= 255) ? u : 510 - u);
+    }
+
+    case LEDFX_FADE:
+        return (t >= per) ? 255 : (uint16_t)(t * 255u / per);
+
+    default:
+        return 0;
+    }
+}
+
+/**
+ * @brief 끄는 시각을 정렬 삽입 - min_us 안쪽이면 기존 에지에 합침 (motor.c Edge_Insert와 같음)
+ */
+static void Edge_Insert(LedFxFrame_t *f, uint16_t t, uint16_t pin, uint16_t min_us)
+{
+    uint8_t i = 0;
+    while (i < f->n && f->t[i] + min_us <= t) i++;
+
+    if (i < f->n && f->t[i] < t + min_us)
+    {
+        f->off[i] |= pin;
+        return;
+    }
+
+    for (uint8_t j = f->n; j > i; j--)
+    {
+        f->t[j] = f->t[j - 1];
+        f->off[j] = f->off[j - 1];
+    }
+    f->t[i] = t;
+    f->off[i] = pin;
+    f->n++;
+}
+
+/* ===== 외부 API ===== */
+
+const LedFx_t *LedFx_Effect(LedFxId_t id, const char **name)
+{
+    if ((unsigned)id >= LEDFX_FX_COUNT) return NULL;
+
+    if (name) *name = effects[id].name;
+    return &effects[id].fx;
+}
+
+void LedFx_Start(LedFxPlay_t *p, const LedFx_t *fx)
+{
+    p->fx = *fx;
+    p->t_ms = 0;
+    p->cycles = 0;
+    p->done = (fx->kind == LEDFX_SOLID);
+    Mix(&p->fx, Mix_At(&p->fx, 0), p->level);
+}
+
+/**
+ * @brief dt_ms 진행 → 밝기 갱신
+ * @return 밝기가 바뀌었으면 1 (에지 표를 다시 만들 때)
+ */
+uint8_t LedFx_Step(LedFxPlay_t *p, uint16_t dt_ms)
+{
+    if (p->done) return 0;
+
+    uint32_t per = Period(&p->fx);
+    uint16_t k;
+
+    p->t_ms += dt_ms;
+    if (p->fx.kind == LEDFX_FADE)
+    {
+        if (p->t_ms >= per)
+        {
+            p->t_ms = per;
+            p->done = 1;
+        }
+        k = Mix_At(&p->fx, p->t_ms);
+    }
+    else
+    {
+        while (p->t_ms >= per && !p->done)
+        {
+            p->t_ms -= per;
+            if (p->fx.repeat && ++p->cycles >= p->fx.repeat)
+                p->done = 1;
+        }
+        /* 끝난 주기의 마지막 값: 깜빡임 = b, 숨쉬기 = a */
+        if (p->done) k = (p->fx.kind == LEDFX_BLINK) ? 255 : 0;
+        else k = Mix_At(&p->fx, p->t_ms);
+    }
+
+    uint8_t next[LEDFX_CH];
+    uint8_t changed = 0;
+    Mix(&p->fx, k, next);
+    for (uint8_t c = 0; c < LEDFX_CH; c++)
+    {
+        if (next[c] != p->level[c]) changed = 1;
+        p->level[c] = next[c];
+    }
+    return changed;
+}
+
+uint16_t LedFx_OnTime(uint8_t level, uint16_t period_us)
+{
+    return (uint16_t)((uint32_t)level * level * period_us / 65025u);
+}
+
+/**
+ * @brief 밝기 3개 → PWM 한 주기 에지 표
+ * @param pin     채널별 핀 마스크 (같은 포트)
+ * @param min_us  이보다 짧은 펄스/틈은 0%/100%, 이보다 가까운 끄기 에지는 합침
+ */
+void LedFx_Compile(const uint8_t level[LEDFX_CH], const uint16_t pin[LEDFX_CH],
+                   uint16_t period_us, uint16_t min_us, LedFxFrame_t *f)
+{
+    f->all = 0;
+    f->on = 0;
+    f->n = 0;
+
+    for (uint8_t c = 0; c < LEDFX_CH; c++)
+    {
+        uint16_t on = LedFx_OnTime(level[c], period_us);
+
+        f->all |= pin[c];
+        if (on < min_us) continue;                      // 0%
+        f->on |= pin[c];
+        if (on <= period_us - min_us)
+            Edge_Insert(f, on, pin[c], min_us);         // 그보다 길면 100% (끄지 않음)
+    }
+}
@@ -1,72 +1,195 @@
+/**
+ * @file motor.c
+ * @brief 4WD DC 모터 (TC118S) - 소프트 PWM + 차동 구동 제어
+ *
+ * 동작:
+ * 1. 모터 핀 8개가 타이머 PWM 채널이 아닌 일반 GPIO (PA9/10, PB3/4/5/8/9/10)
+ *    → TIM4 CC2 연속 비교(Time_EdgeStart)로 에지 단위 소프트 PWM
+ *    - 주기 시작: 바퀴마다 방향 핀 켜고, 끄는 시각을 정렬해서 에지 목록 작성
+ *    - 끄기 에지: 그 시각에 끝나는 바퀴 핀만 끔 (가까운 에지는 1개로 합침)
+ *    → 인터럽트는 주기당 최대 5번 (고정 틱 방식이면 1us 해상도에 1000번)
+ * 2. MOTOR_PWM_US 주기 10번마다 (DRIVE_CTRL_HZ) 같은 인터럽트에서 Drive_Step()
+ *    → v, ω 혼합, 가감속 제한, (엔코더가 있으면) 좌우 PI, 불감대 보정 (drive_ctrl.c)
+ * 3. 결과 듀티에 바퀴별 MOTOR_TRIM을 곱해 다음 주기부터 적용
+ *
+ * 끄는 구간은 두 입력 모두 LOW (관성 회전) - Motor_Stop()도 같음
+ * Motor_Forward() 등 기존 함수는 Motor_Drive()로 바뀌어 가감속이 붙음, Motor_Stop()만 즉시
+ */
+
+#include <stdio.h>
 #include "drivers/motor.h"
 #include "robot_config.h"
+#include "drive_ctrl.h"
+#include "timebase.h"
+
+#define PWM_PER_CTRL    ((1000000u / DRIVE_CTRL_HZ) / MOTOR_PWM_US)
+
+#if (1000000u / DRIVE_CTRL_HZ) % MOTOR_PWM_US != 0
+#error "제어 주기가 MOTOR_PWM_US의 배수가 아님"
+#endif
+
+typedef struct {
+    GPIO_TypeDef *fwd_port;
+    uint16_t      fwd_pin;
+    GPIO_TypeDef *back_port;
+    uint16_t      back_pin;
+    uint8_t       side;         // DRIVE_L / DRIVE_R
+} Wheel_t;
+
+static const Wheel_t wheels[MOTOR_WHEELS] = {
+    { MOTOR_RFF_PORT, MOTOR_RFF_PIN, MOTOR_RFB_PORT, MOTOR_RFB_PIN, DRIVE_R },
+    { MOTOR_RBF_PORT, MOTOR_RBF_PIN, MOTOR_RBB_PORT, MOTOR_RBB_PIN, DRIVE_R },
+    { MOTOR_LFF_PORT, MOTOR_LFF_PIN, MOTOR_LFB_PORT, MOTOR_LFB_PIN, DRIVE_L },
+    { MOTOR_LBF_PORT, MOTOR_LBF_PIN, MOTOR_LBB_PORT, MOTOR_LBB_PIN, DRIVE_L },
+};
+static const int16_t trim[MOTOR_WHEELS] = MOTOR_TRIM;
+
+static Drive_t drive;
+static volatile int16_t duty[MOTOR_WHEELS];     // 다음 주기부터 쓸 듀티
+
+/* 에지 목록 (인터럽트 전용) */
+static uint16_t edge_t[MOTOR_WHEELS];           // 주기 시작부터 us
+static uint8_t  edge_mask[MOTOR_WHEELS];        // 이 시각에 끌 바퀴
+static uint8_t  edge_n = 0;
+static uint8_t  edge_k = 0;
+static uint8_t  ctrl_div = 0;
+
+#if MOTOR_ENCODER
+static volatile uint32_t enc_last[2];
+static volatile uint32_t enc_period[2];
+#endif
+
+static MotorStats_t stats;
 
 /* ===============================
  * 내부 모터 제어 유틸
  * =============================== */
 
-static void RF(MotorDir_t dir)
+static void Pin_Set(uint8_t w, MotorDir_t dir)
 {
-    if (dir == MOTOR_FORWARD) {
-        HAL_GPIO_WritePin(MOTOR_RFF_PORT, MOTOR_RFF_PIN, GPIO_PIN_SET);
-        HAL_GPIO_WritePin(MOTOR_RFB_PORT, MOTOR_RFB_PIN, GPIO_PIN_RESET);
-    }
-    else if (dir == MOTOR_BACKWARD) {
-        HAL_GPIO_WritePin(MOTOR_RFF_PORT, MOTOR_RFF_PIN, GPIO_PIN_RESET);
-        HAL_GPIO_WritePin(MOTOR_RFB_PORT, MOTOR_RFB_PIN, GPIO_PIN_SET);
-    }
-    else {
-        HAL_GPIO_WritePin(MOTOR_RFF_PORT, MOTOR_RFF_PIN, GPIO_PIN_RESET);
-        HAL_GPIO_WritePin(MOTOR_RFB_PORT, MOTOR_RFB_PIN, GPIO_PIN_RESET);
-    }
+    const Wheel_t *p = &wheels[w];
+
+    p->fwd_port->BSRR  = (dir == MOTOR_FORWARD)  ? p->fwd_pin  : (uint32_t)p->fwd_pin << 16;
+    p->back_port->BSRR = (dir == MOTOR_BACKWARD) ? p->back_pin : (uint32_t)p->back_pin << 16;
 }
 
-static void RB(MotorDir_t dir)
+/**
+ * @brief 끄는 시각을 정렬 삽입 - MOTOR_PWM_MIN_US 안쪽이면 기존 에지에 합침
+ */
+static void Edge_Insert(uint16_t t, uint8_t w)
 {
-    if (dir == MOTOR_FORWARD) {
-        HAL_GPIO_WritePin(MOTOR_RBF_PORT, MOTOR_RBF_PIN, GPIO_PIN_SET);
-        HAL_GPIO_WritePin(MOTOR_RBB_PORT, MOTOR_RBB_PIN, GPIO_PIN_RESET);
-    }
-    else if (dir == MOTOR_BACKWARD) {
-        HAL_GPIO_WritePin(MOTOR_RBF_PORT, MOTOR_RBF_PIN, GPIO_PIN_RESET);
-        HAL_GPIO_WritePin(MOTOR_RBB_PORT, MOTOR_RBB_PIN, GPIO_PIN_SET);
+    uint8_t i = 0;
+    while (i < edge_n && edge_t[i] + MOTOR_PWM_MIN_US <= t) i++;
+
+    if (i < edge_n && edge_t[i] < t + MOTOR_PWM_MIN_US)
+    {
+        edge_mask[i] |= (uint8_t)(1u << w);
+        return;
     }
-    else {
-        HAL_GPIO_WritePin(MOTOR_RBF_PORT, MOTOR_RBF_PIN, GPIO_PIN_RESET);
-        HAL_GPIO_WritePin(MOTOR_RBB_PORT, MOTOR_RBB_PIN, GPIO_PIN_RESET);
+
+    for (uint8_t j = edge_n; j > i; j--)
+    {
+        edge_t[j] = edge_t[j - 1];
+        edge_mask[j] = edge_mask[j - 1];
     }
+    edge_t[i] = t;
+    edge_mask[i] = (uint8_t)(1u << w);
+    edge_n++;
 }
 
-static void LF(MotorDir_t dir)
+/**
+ * @brief 제어 1스텝 (DRIVE_CTRL_HZ, PWM 인터럽트 안)
+ */
+static void Control_Step(void)
 {
-    if (dir == MOTOR_FORWARD) {
-        HAL_GPIO_WritePin(MOTOR_LFF_PORT, MOTOR_LFF_PIN, GPIO_PIN_SET);
-        HAL_GPIO_WritePin(MOTOR_LFB_PORT, MOTOR_LFB_PIN, GPIO_PIN_RESET);
+#if MOTOR_ENCODER
+    int16_t meas[2];
+    uint32_t now = Time_Now_us();
+
+    for (uint8_t s = 0; s < 2; s++)
+    {
+        uint32_t since = now - enc_last[s];
+        uint32_t per = enc_period[s];
+        if (since > per) per = since;                   // 펄스가 늦어지는 중 = 그만큼 느려짐
+        if (since > MOTOR_ENC_TIMEOUT_US) per = 0;      // 멈춤
+
+        int16_t sp = Drive_SpeedFromPeriod(per, MOTOR_ENC_FULL_US);
+        meas[s] = (drive.setpoint[s] < 0) ? (int16_t)-sp : sp;    // 1채널 엔코더 → 방향은 명령 부호
     }
-    else if (dir == MOTOR_BACKWARD) {
-        HAL_GPIO_WritePin(MOTOR_LFF_PORT, MOTOR_LFF_PIN, GPIO_PIN_RESET);
-        HAL_GPIO_WritePin(MOTOR_LFB_PORT, MOTOR_LFB_PIN, GPIO_PIN_SET);
+    Drive_Step(&drive, meas);
+    stats.speed[DRIVE_L] = meas[DRIVE_L];
+    stats.speed[DRIVE_R] = meas[DRIVE_R];
+#else
+    Drive_Step(&drive, NULL);
+#endif
+
+    for (uint8_t w = 0; w < MOTOR_WHEELS; w++)
+        duty[w] = (int16_t)((int32_t)drive.duty[wheels[w].side] * trim[w] / 1000);
+
+    stats.ctrl_steps++;
+}
+
+/**
+ * @brief 주기 시작 - 켤 바퀴 켜고 에지 목록 작성
+ * @return 첫 에지까지 us
+ */
+static uint16_t Period_Start(void)
+{
+    if (++ctrl_div >= PWM_PER_CTRL)
+    {
+        ctrl_div = 0;
+        Control_Step();
     }
-    else {
-        HAL_GPIO_WritePin(MOTOR_LFF_PORT, MOTOR_LFF_PIN, GPIO_PIN_RESET);
-        HAL_GPIO_WritePin(MOTOR_LFB_PORT, MOTOR_LFB_PIN, GPIO_PIN_RESET);
+
+    edge_n = 0;
+    edge_k = 0;
+
+    for (uint8_t w = 0; w < MOTOR_WHEELS; w++)
+    {
+        int16_t d = duty[w];
+        uint16_t on = (uint16_t)((uint32_t)((d < 0) ? -d : d) * MOTOR_PWM_US / 1000u);
+
+        if (on < MOTOR_PWM_MIN_US)
+        {
+            Pin_Set(w, MOTOR_STOP);
+            continue;
+        }
+
+        Pin_Set(w, (d > 0) ? MOTOR_FORWARD : MOTOR_BACKWARD);
+        if (on <= MOTOR_PWM_US - MOTOR_PWM_MIN_US)
+            Edge_Insert(on, w);                         // 그보다 길면 100% (끄지 않음)
     }
+
+    stats.periods++;
+    return edge_n ? edge_t[0] : MOTOR_PWM_US;
 }
 
-static void LB(MotorDir_t dir)
+/**
+ * @brief TIM4 CC2 콜백 (Time_EdgeStart) - 다음 호출까지 us 반환
+ */
+static uint16_t Pwm_Edge(void)
 {
-    if (dir == MOTOR_FORWARD) {
-        HAL_GPIO_WritePin(MOTOR_LBF_PORT, MOTOR_LBF_PIN, GPIO_PIN_SET);
-        HAL_GPIO_WritePin(MOTOR_LBB_PORT, MOTOR_LBB_PIN, GPIO_PIN_RESET);
-    }
-    else if (dir == MOTOR_BACKWARD) {
-        HAL_GPIO_WritePin(MOTOR_LBF_PORT, MOTOR_LBF_PIN, GPIO_PIN_RESET);
-        HAL_GPIO_WritePin(MOTOR_LBB_PORT, MOTOR_LBB_PIN, GPIO_PIN_SET);
+    uint32_t c0 = Time_Cycles();
+    uint16_t next;
+
+    if (edge_k < edge_n)
+    {
+        uint8_t m = edge_mask[edge_k];
+        for (uint8_t w = 0; w < MOTOR_WHEELS; w++)
+            if (m & (1u << w)) Pin_Set(w, MOTOR_STOP);
+
+        uint16_t t = edge_t[edge_k++];
+        next = (edge_k < edge_n) ? (uint16_t)(edge_t[edge_k] - t) : (uint16_t)(MOTOR_PWM_US - t);
+        stats.edges++;
     }
-    else {
-        HAL_GPIO_WritePin(MOTOR_LBF_PORT, MOTOR_LBF_PIN, GPIO_PIN_RESET);
-        HAL_GPIO_WritePin(MOTOR_LBB_PORT, MOTOR_LBB_PIN, GPIO_PIN_RESET);
+    else
+    {
+        next = Period_Start();
     }
+
+    uint32_t c = Time_Cycles() - c0;
+    if (c > stats.max_isr_cycles) stats.max_isr_cycles = c;
+    return next;
 }
 
 /* ===============================
@@ -75,46 +198,115 @@ static void LB(MotorDir_t dir)
 
 void Motor_Init(void)
 {
+    Drive_Init(&drive, MOTOR_ENCODER);
     Motor_Stop();
+    Time_EdgeStart(TIME_EDGE_MOTOR, MOTOR_PWM_US, Pwm_Edge);
+}
+
+/**
+ * @brief 차동 구동 명령 (천분율) - 가감속은 제어 스텝이 처리
+ * @param v 전진 속도 (음수 = 후진)
+ * @param w 회전 (양수 = 왼쪽으로, 오른쪽 바퀴가 빨라짐)
+ */
+void Motor_Drive(int16_t v, int16_t w)
+{
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    Drive_SetVW(&drive, v, w);
+    stats.v = v;
+    stats.w = w;
+    __set_PRIMASK(primask);
 }
 
 void Motor_Stop(void)
 {
-    RF(MOTOR_STOP);
-    RB(MOTOR_STOP);
-    LF(MOTOR_STOP);
-    LB(MOTOR_STOP);
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+
+    Drive_Halt(&drive);
+    stats.v = 0;
+    stats.w = 0;
+    for (uint8_t w = 0; w < MOTOR_WHEELS; w++)
+    {
+        duty[w] = 0;
+        Pin_Set(w, MOTOR_STOP);
+    }
+
+    __set_PRIMASK(primask);
 }
 
 void Motor_Forward(void)
 {
-    RF(MOTOR_FORWARD);
-    RB(MOTOR_FORWARD);
-    LF(MOTOR_FORWARD);
-    LB(MOTOR_FORWARD);
+    Motor_Drive(MOTOR_BASE_SPEED, 0);
 }
 
 void Motor_Backward(void)
 {
-    RF(MOTOR_BACKWARD);
-    RB(MOTOR_BACKWARD);
-    LF(MOTOR_BACKWARD);
-    LB(MOTOR_BACKWARD);
+    Motor_Drive(-MOTOR_BASE_SPEED, 0);
 }
 
 void Motor_Right(void)
 {
-	 LF(MOTOR_FORWARD);
-	    LB(MOTOR_FORWARD);
-	    RF(MOTOR_BACKWARD);
-	    RB(MOTOR_BACKWARD);
+    Motor_Drive(0, -MOTOR_TURN_SPEED);  // 왼쪽 바퀴 전진, 오른쪽 후진
 }
 
 void Motor_Left(void)
 {
-    LF(MOTOR_BACKWARD);
-    LB(MOTOR_BACKWARD);
-    RF(MOTOR_FORWARD);
-    RB(MOTOR_FORWARD);
+    Motor_Drive(0, MOTOR_TURN_SPEED);
+}
+
+/**
+ * @brief 엔코더 펄스 1개 (EXTI 콜백에서) - 펄스 간격을 제어 스텝이 속도로 바꿈
+ */
+void Motor_EncoderPulse(uint8_t side)
+{
+#if MOTOR_ENCODER
+    if (side > DRIVE_R) return;
+
+    uint32_t now = Time_Now_us();
+    enc_period[side] = now - enc_last[side];
+    enc_last[side] = now;
+#else
+    (void)side;
+#endif
+}
+
+void Motor_GetStats(MotorStats_t *out)
+{
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    *out = stats;
+    for (uint8_t w = 0; w < MOTOR_WHEELS; w++)
+        out->duty[w] = duty[w];
+    __set_PRIMASK(primask);
+}
+
+void Motor_ResetStats(void)
+{
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    stats.periods = 0;
+    stats.ctrl_steps = 0;
+    stats.edges = 0;
+    stats.max_isr_cycles = 0;
+    __set_PRIMASK(primask);
+}
+
+/**
+ * @brief 구동 상태 - 에지/주기가 주기당 인터럽트 수 (1 = 0%/100%만, 최대 1 + 바퀴 수)
+ */
+void Motor_PrintStats(void)
+{
+    MotorStats_t s;
+    Motor_GetStats(&s);
+
+    uint32_t per10 = s.periods ? s.edges * 10u / s.periods : 0;
 
+    printf("motor v %-5d w %-5d | duty RF %-5d RB %-5d LF %-5d LB %-5d | speed L %-5d R %-5d\r\n",
+           s.v, s.w, s.duty[MOTOR_RF], s.duty[MOTOR_RB], s.duty[MOTOR_LF], s.duty[MOTOR_LB],
+           s.speed[DRIVE_L], s.speed[DRIVE_R]);
+    printf("      periods %lu ctrl %lu edges/period %lu.%lu isr_max %luus\r\n",
+           (unsigned long)s.periods, (unsigned long)s.ctrl_steps,
+           (unsigned long)(per10 / 10), (unsigned long)(per10 % 10),
+           (unsigned long)Time_CyclesToUs(s.max_isr_cycles));
 }
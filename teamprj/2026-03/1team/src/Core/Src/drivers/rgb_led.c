@@ -1,48 +1,219 @@
-/* rgb_led.c - 주황색 수정 버전 */
+/**
+ * @file rgb_led.c
+ * @brief RGB 상태 LED - 고정 색 + 효과 재생 (깜빡임/숨쉬기/페이드)
+ *
+ * 동작:
+ * 1. RGB_Set/RGB_Off: 세 핀을 BSRR 1번으로 (재생 중인 효과는 멈춤)
+ * 2. RGB_Play: led_fx.c가 기술자를 밝기로 풀고 소프트 PWM 에지 표로 컴파일
+ *    → TIM4 CC3 연속 비교(Time_EdgeStart)가 표대로 핀을 켜고 끔 (motor.c와 같은 방식)
+ *    - 주기 시작: 켤 핀 켜기 / 끄기 에지: 그 시각에 끝나는 핀만 끔 → 주기당 인터럽트 최대 4번
+ *    - RGB_FRAME_PERIODS 주기마다 같은 인터럽트에서 효과 1스텝 (밝기가 바뀔 때만 표 다시 작성)
+ *    - 에지가 없는 프레임 (0%/100%뿐, 깜빡임 등)은 다음 스텝까지 인터럽트 1번으로 건너뜀
+ *    - 효과가 끝나고 마지막 값이 0%/100%이면 스트림 자체를 멈춤
+ * 3. 메인 루프는 관여하지 않음 - 상태 진입 동작에서 RGB_Play 한 번이면 끝
+ *
+ * 채널: PC5(R)는 타이머 채널이 없고, PC6/PC8(G/B)은 TIM3 완전 재매핑 CH1/CH3인데 TIM3는 부저 (PA6)
+ *      → 하드웨어 PWM/DMA 대신 TIM4 비교 인터럽트로 표를 재생 (CC3 DMA 요청은 SPI2와 같은 Ch5라 안 씀)
+ */
 
+#include <stdio.h>
 #include "main.h"
 #include "drivers/rgb_led.h"
+#include "robot_config.h"
+#include "timebase.h"
 
-void RGB_Init(void)
+#define PINS_ALL    (RED_Pin | GREEN_Pin | BLUE_Pin)
+#define FRAME_MS    (RGB_FRAME_PERIODS * RGB_PWM_US / 1000u)
+
+#if RGB_FRAME_PERIODS * RGB_PWM_US > 50000
+#error "효과 1스텝이 TIM4 비교 간격(16비트)보다 김"
+#endif
+
+static const uint16_t pins[LEDFX_CH] = { RED_Pin, GREEN_Pin, BLUE_Pin };
+
+/* 고정 색 → 켤 핀 (main.h RGB_COLOR_xxx) */
+static const uint16_t solid[] = {
+    [RGB_COLOR_GREEN]  = GREEN_Pin,             // 🟢 초록색
+    [RGB_COLOR_RED]    = RED_Pin,               // 🔴 빨강색
+    [RGB_COLOR_ORANGE] = GREEN_Pin | RED_Pin,   // 🟠 주황색 (GREEN + RED)
+};
+
+/* 재생 상태 (인터럽트 전용 - 시작은 인터럽트를 막고) */
+static LedFxPlay_t play;
+static LedFxFrame_t frame;
+static uint8_t edge_k = 0;
+static uint8_t frame_left = 0;          // 다음 효과 스텝까지 남은 PWM 주기
+static volatile uint8_t playing = 0;
+
+static RgbStats_t stats;
+
+/* ===== 내부 함수 ===== */
+
+static void Pins_Write(uint16_t on)
 {
-    RGB_Off();
+    RGB_PORT->BSRR = on | ((uint32_t)(PINS_ALL & ~on) << 16);
 }
 
-void RGB_Set(int color)
+static void Play_Stop(void)
+{
+    Time_EdgeStop(TIME_EDGE_RGB);
+    playing = 0;
+}
+
+/**
+ * @brief 효과 1스텝 - 밝기가 바뀌었으면 에지 표 다시 작성
+ */
+static void Frame_Step(void)
+{
+    if (LedFx_Step(&play, FRAME_MS))
+    {
+        LedFx_Compile(play.level, pins, RGB_PWM_US, RGB_PWM_MIN_US, &frame);
+        stats.compiles++;
+    }
+    stats.frames++;
+}
+
+/**
+ * @brief 주기 시작 - 켤 핀 켜기
+ * @return 첫 에지까지 us (0 = 효과 끝, 스트림 정지)
+ */
+static uint16_t Period_Start(void)
 {
-    switch (color)
+    if (frame_left == 0)
     {
-    case RGB_COLOR_GREEN:   // 0 - 🟢 초록색
+        frame_left = RGB_FRAME_PERIODS;
+        Frame_Step();
+    }
 
-        HAL_GPIO_WritePin(GPIOC, GREEN_Pin, GPIO_PIN_SET);
-        HAL_GPIO_WritePin(GPIOC, RED_Pin, GPIO_PIN_RESET);
-        HAL_GPIO_WritePin(GPIOC, BLUE_Pin, GPIO_PIN_RESET);
-        break;
+    Pins_Write(frame.on);
+    edge_k = 0;
+    stats.periods++;
 
-    case RGB_COLOR_RED:     // 1 - 🔴 빨강색
+    if (frame.n == 0)
+    {
+        if (play.done)
+        {
+            playing = 0;
+            return 0;                   // 마지막 값이 0%/100%뿐 → 핀은 그대로 두고 멈춤
+        }
+        uint16_t us = (uint16_t)(frame_left * RGB_PWM_US);     // 스텝 전까지 바뀔 게 없음
+        frame_left = 0;
+        return us;
+    }
 
-        HAL_GPIO_WritePin(GPIOC, GREEN_Pin, GPIO_PIN_RESET);
-        HAL_GPIO_WritePin(GPIOC, RED_Pin, GPIO_PIN_SET);
-        HAL_GPIO_WritePin(GPIOC, BLUE_Pin, GPIO_PIN_RESET);
-        break;
+    frame_left--;
+    return frame.t[0];
+}
 
-    case RGB_COLOR_ORANGE:  // 2 - 🟠 주황색 (GREEN + RED)
+/**
+ * @brief TIM4 CC3 콜백 (Time_EdgeStart) - 다음 호출까지 us 반환
+ */
+static uint16_t Pwm_Edge(void)
+{
+    uint32_t c0 = Time_Cycles();
+    uint16_t next;
 
-        HAL_GPIO_WritePin(GPIOC, GREEN_Pin, GPIO_PIN_SET);   // GREEN ON
-        HAL_GPIO_WritePin(GPIOC, RED_Pin, GPIO_PIN_SET);     // RED ON
-        HAL_GPIO_WritePin(GPIOC, BLUE_Pin, GPIO_PIN_RESET);  // BLUE OFF
-        break;
+    if (edge_k < frame.n)
+    {
+        RGB_PORT->BSRR = (uint32_t)frame.off[edge_k] << 16;
 
-    default:
-        RGB_Off();
-        break;
+        uint16_t t = frame.t[edge_k++];
+        next = (edge_k < frame.n) ? (uint16_t)(frame.t[edge_k] - t) : (uint16_t)(RGB_PWM_US - t);
+        stats.edges++;
+    }
+    else
+    {
+        next = Period_Start();
     }
+
+    uint32_t c = Time_Cycles() - c0;
+    if (c > stats.max_isr_cycles) stats.max_isr_cycles = c;
+    return next;
+}
+
+/* ===== 외부 API ===== */
+
+void RGB_Init(void)
+{
+    RGB_Off();
+}
+
+void RGB_Set(int color)
+{
+    Play_Stop();
+
+    if (color >= 0 && color < (int)(sizeof(solid) / sizeof(solid[0])))
+        Pins_Write(solid[color]);
+    else
+        Pins_Write(0);
 }
 
 void RGB_Off(void)
 {
+    Play_Stop();
+    Pins_Write(0);
+}
+
+/**
+ * @brief 효과 재생 시작 (기술자는 복사하므로 지역 변수여도 됨)
+ */
+void RGB_Play(const LedFx_t *fx)
+{
+    if (fx == NULL) return;
+
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+
+    LedFx_Start(&play, fx);
+    LedFx_Compile(play.level, pins, RGB_PWM_US, RGB_PWM_MIN_US, &frame);
+    edge_k = frame.n;                   // 첫 호출 = 주기 시작 (시작 밝기)
+    frame_left = RGB_FRAME_PERIODS;
+    playing = 1;
+    stats.plays++;
+    Time_EdgeStart(TIME_EDGE_RGB, 0, Pwm_Edge);
+
+    __set_PRIMASK(primask);
+}
+
+void RGB_PlayEffect(LedFxId_t id)
+{
+    RGB_Play(LedFx_Effect(id, NULL));
+}
+
+uint8_t RGB_IsPlaying(void)
+{
+    return playing;
+}
+
+void RGB_GetStats(RgbStats_t *out)
+{
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    *out = stats;
+    __set_PRIMASK(primask);
+}
+
+void RGB_ResetStats(void)
+{
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    stats.plays = 0;
+    stats.frames = 0;
+    stats.compiles = 0;
+    stats.periods = 0;
+    stats.edges = 0;
+    stats.max_isr_cycles = 0;
+    __set_PRIMASK(primask);
+}
+
+void RGB_PrintStats(void)
+{
+    RgbStats_t s;
+    RGB_GetStats(&s);
 
-    HAL_GPIO_WritePin(GPIOC, RED_Pin, GPIO_PIN_RESET);
-    HAL_GPIO_WritePin(GPIOC, GREEN_Pin, GPIO_PIN_RESET);
-    HAL_GPIO_WritePin(GPIOC, BLUE_Pin, GPIO_PIN_RESET);
+    printf("rgb %s | level R %u G %u B %u | plays %lu frames %lu compiles %lu\r\n",
+           playing ? "play" : "idle", play.level[0], play.level[1], play.level[2],
+           (unsigned long)s.plays, (unsigned long)s.frames, (unsigned long)s.compiles);
+    printf("    periods %lu edges %lu isr_max %lucyc\r\n",
+           (unsigned long)s.periods, (unsigned long)s.edges, (unsigned long)s.max_isr_cycles);
 }
@@ -1,104 +1,206 @@
+/**
+ * @file ultrasonic.c
+ * @brief HC-SR04 초음파 거리 엔진 - 타이머 트리거 + 입력캡처 + 중앙값 필터
+ *
+ * 동작:
+ * 1. TIM2 CH1 PWM이 60ms마다 TRIG에 10us 펄스 출력 (CPU 개입 없음)
+ * 2. TIM2 CH2 입력캡처로 ECHO 폭을 재서 타임스탬프와 함께 링에 저장 (ISR)
+ * 3. 같은 ISR에서 최근 N개 샘플의 중앙값 + 이상치 제거 → 최신 거리/신뢰도 게시
+ * 4. 메인 루프는 Ultrasonic_GetRange()로 시퀀스 락(seqlock) 읽기 → 기다리지 않음
+ *
+ * 서보가 돌아간 뒤에는 Ultrasonic_Restart()로 필터 창을 비워
+ * 이전 각도의 샘플이 중앙값에 섞이지 않게 함
+ */
+
 #include "drivers/ultrasonic.h"
 
-#define ULTRASONIC_TRIG_PORT GPIOA
-#define ULTRASONIC_TRIG_PIN  GPIO_PIN_0
+#define RING_MASK           (ULTRA_RING_SIZE - 1)
+#define ECHO_TIMEOUT_MS     50      // 상승→하강이 이보다 길면 에코 없음 (타이머 한 바퀴 넘김 방지)
 
 extern TIM_HandleTypeDef htim2;
 
-static volatile uint32_t ic_val1 = 0;
-static volatile uint32_t ic_val2 = 0;
-static volatile uint8_t  ic_state = 0;   // 0=RISING 대기, 1=FALLING 대기
-static volatile uint16_t distance_cm = 0;
-static volatile uint8_t  distance_ready = 0;
+/* ===== 입력캡처 상태 (ISR 전용) ===== */
+static uint32_t ic_rise = 0;
+static uint32_t ic_rise_ms = 0;
+static uint8_t  ic_state = 0;   // 0=RISING 대기, 1=FALLING 대기
+
+/* ===== 샘플 링 (ISR 쓰기, 메인 읽기) ===== */
+static UltraSample_t     ring[ULTRA_RING_SIZE];
+static volatile uint32_t ring_head = 0;     // 지금까지 들어온 샘플 수
+static volatile uint32_t epoch_start = 0;   // 필터 창 시작 (ring_head 기준)
+
+/* ===== 게시 값 (seqlock: 홀수 = 쓰는 중) ===== */
+static volatile uint32_t pub_seq = 0;
+static volatile uint16_t pub_cm = ULTRA_NO_ECHO;
+static volatile uint8_t  pub_conf = 0;
+static volatile uint8_t  pub_samples = 0;
+static volatile uint32_t pub_t_ms = 0;
+static volatile uint32_t pub_count = 0;
+
+static uint32_t read_seen = 0;              // Ultrasonic_Read() 호환용
 
-/* 트리거 펄스 */
-static void trig_pulse(void)
+/* ===== 내부 함수 ===== */
+
+/**
+ * @brief 창 안의 샘플로 중앙값/신뢰도 계산 후 게시 (ISR에서 호출)
+ */
+static void Filter_Publish(void)
 {
-    HAL_GPIO_WritePin(ULTRASONIC_TRIG_PORT, ULTRASONIC_TRIG_PIN, GPIO_PIN_SET);
-    for(volatile int i=0;i<200;i++);
-    HAL_GPIO_WritePin(ULTRASONIC_TRIG_PORT, ULTRASONIC_TRIG_PIN, GPIO_PIN_RESET);
+    uint32_t head = ring_head;
+    uint32_t n = head - epoch_start;
+    if (n > ULTRA_FILTER_N) n = ULTRA_FILTER_N;
+
+    /* 유효 폭만 삽입 정렬 */
+    uint16_t v[ULTRA_FILTER_N];
+    uint8_t nv = 0;
+    for (uint32_t i = 0; i < n; i++)
+    {
+        uint16_t w = ring[(head - 1 - i) & RING_MASK].width_us;
+        if (w == 0) continue;
+
+        uint8_t j = nv++;
+        while (j > 0 && v[j - 1] > w) { v[j] = v[j - 1]; j--; }
+        v[j] = w;
+    }
+
+    uint16_t cm = ULTRA_NO_ECHO;
+    uint8_t conf = 0;
+    if (nv > 0)
+    {
+        uint16_t med = v[nv / 2];
+        uint16_t tol = med / 8 + 2 * 58;    // 12.5% + 2cm
+        uint8_t inliers = 0;
+        for (uint8_t i = 0; i < nv; i++)
+        {
+            uint16_t d = (v[i] > med) ? v[i] - med : med - v[i];
+            if (d <= tol) inliers++;
+        }
+
+        cm = med / 58;
+        conf = (uint8_t)(inliers * 100u / n);   // 에코 없음도 분모에 포함
+    }
+
+    pub_seq++;
+    pub_cm = cm;
+    pub_conf = conf;
+    pub_samples = (uint8_t)n;
+    pub_t_ms = ring[(head - 1) & RING_MASK].t_ms;
+    pub_count = head;
+    pub_seq++;
 }
 
-void Ultrasonic_Init(void)
+static void Ring_Push(uint16_t width_us, uint32_t t_ms)
 {
-	HAL_TIM_Base_Start(&htim2);   // 타이머 카운터 시작
-	    __HAL_TIM_SET_CAPTUREPOLARITY(&htim2, TIM_CHANNEL_2, TIM_INPUTCHANNELPOLARITY_RISING);
-	    HAL_TIM_IC_Start_IT(&htim2, TIM_CHANNEL_2);
+    uint32_t head = ring_head;
+    ring[head & RING_MASK].width_us = width_us;
+    ring[head & RING_MASK].t_ms = t_ms;
+    ring_head = head + 1;
+
+    Filter_Publish();
 }
 
-void Ultrasonic_Trigger(void)
+/* ===== 외부 API ===== */
+
+void Ultrasonic_Init(void)
 {
-    distance_ready = 0;
-    trig_pulse();
+    HAL_TIM_Base_Start(&htim2);   // 타이머 카운터 시작
+    __HAL_TIM_SET_CAPTUREPOLARITY(&htim2, TIM_CHANNEL_2, TIM_INPUTCHANNELPOLARITY_RISING);
+    HAL_TIM_IC_Start_IT(&htim2, TIM_CHANNEL_2);
+    HAL_TIM_PWM_Start(&htim2, TIM_CHANNEL_1);   // TRIG 자동 펄스
 }
 
-uint16_t Ultrasonic_Read(void)
+/**
+ * @brief 필터 창 비우기 - 이후 들어오는 샘플만 중앙값에 사용
+ */
+void Ultrasonic_Restart(void)
 {
-    if(distance_ready)
-    {
-        distance_ready = 0;
-        return distance_cm;
-    }
-    return 999;
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+
+    epoch_start = ring_head;
+    pub_seq++;
+    pub_cm = ULTRA_NO_ECHO;
+    pub_conf = 0;
+    pub_samples = 0;
+    pub_seq++;
+
+    __set_PRIMASK(primask);
 }
-void Ultrasonic_IC_Callback(TIM_HandleTypeDef *htim)
-{
-    if(ic_state == 0)  // RISING 감지
-    {
-        ic_val1 = HAL_TIM_ReadCapturedValue(htim, TIM_CHANNEL_2);
-        ic_state = 1;
-        __HAL_TIM_SET_CAPTUREPOLARITY(htim, TIM_CHANNEL_2, TIM_INPUTCHANNELPOLARITY_FALLING);
-    }
-    else  // FALLING 감지 → 펄스폭 계산
-    {
-        ic_val2 = HAL_TIM_ReadCapturedValue(htim, TIM_CHANNEL_2);
 
-        uint32_t diff;
-        if(ic_val2 >= ic_val1)
-            diff = ic_val2 - ic_val1;
-        else
-            diff = (0xFFFF - ic_val1 + ic_val2);
+/**
+ * @brief 최신 필터 값 읽기 (ISR이 쓰는 중이면 다시 읽음)
+ */
+void Ultrasonic_GetRange(UltraRange_t *out)
+{
+    uint32_t s;
+    do {
+        s = pub_seq;
+        out->cm = pub_cm;
+        out->confidence = pub_conf;
+        out->samples = pub_samples;
+        out->t_ms = pub_t_ms;
+        out->seq = pub_count;
+    } while ((s & 1u) || s != pub_seq);
+}
 
-        // 노이즈 제거 후 즉시 플래그 설정 (printf 제거!)
-        if(diff > 100 && diff < 30000)
+/**
+ * @brief 최근 원시 샘플 n개 복사 (최신순)
+ * @return 실제 복사한 개수
+ */
+uint8_t Ultrasonic_GetSamples(UltraSample_t *out, uint8_t n)
+{
+    uint32_t head;
+    uint8_t got;
+    do {
+        head = ring_head;
+        got = 0;
+        while (got < n && got < ULTRA_RING_SIZE - 1 && got < head)   // 다음에 덮어쓸 칸은 제외
         {
-            distance_cm = diff / 58;
-            distance_ready = 1;  // ← 여기가 핵심!
+            out[got] = ring[(head - 1 - got) & RING_MASK];
+            got++;
         }
+    } while (head != ring_head);
 
-        ic_state = 0;
-        __HAL_TIM_SET_CAPTUREPOLARITY(htim, TIM_CHANNEL_2, TIM_INPUTCHANNELPOLARITY_RISING);
-    }
+    return got;
 }
-/* 인터럽트 콜백 */
-/*void Ultrasonic_IC_Callback(TIM_HandleTypeDef *htim)
+
+/**
+ * @brief 이전 호출 이후 새 샘플이 있으면 필터 거리, 없으면 ULTRA_NO_ECHO
+ */
+uint16_t Ultrasonic_Read(void)
 {
+    UltraRange_t r;
+    Ultrasonic_GetRange(&r);
 
-    if(ic_state == 0)  // RISING 잡음
+    if (r.seq == read_seen || r.samples == 0)
+        return ULTRA_NO_ECHO;
+
+    read_seen = r.seq;
+    return r.cm;
+}
+
+void Ultrasonic_IC_Callback(TIM_HandleTypeDef *htim)
+{
+    if (ic_state == 0)  // RISING 감지
     {
-        ic_val1 = HAL_TIM_ReadCapturedValue(htim, TIM_CHANNEL_2);
+        ic_rise = HAL_TIM_ReadCapturedValue(htim, TIM_CHANNEL_2);
+        ic_rise_ms = HAL_GetTick();
         ic_state = 1;
-
         __HAL_TIM_SET_CAPTUREPOLARITY(htim, TIM_CHANNEL_2, TIM_INPUTCHANNELPOLARITY_FALLING);
     }
-    else  // FALLING 잡음 → 펄스폭 계산
+    else  // FALLING 감지 → 펄스폭 계산
     {
-        ic_val2 = HAL_TIM_ReadCapturedValue(htim, TIM_CHANNEL_2);
-
-        uint32_t diff;
-        if(ic_val2 >= ic_val1)
-            diff = ic_val2 - ic_val1;
-        else
-            diff = (0xFFFF - ic_val1 + ic_val2);
-        printf("ic_val1=%lu, ic_val2=%lu, diff=%lu\n", ic_val1, ic_val2, diff);
-        if(diff > 100 && diff < 30000)  // 노이즈 제거
-        {
-            distance_cm = diff / 58;
-            distance_ready = 1;
-        }
+        uint32_t fall = HAL_TIM_ReadCapturedValue(htim, TIM_CHANNEL_2);
+        uint32_t now = HAL_GetTick();
+        uint32_t period = __HAL_TIM_GET_AUTORELOAD(htim) + 1;
+        uint32_t width = (fall + period - ic_rise) % period;
+
+        if (now - ic_rise_ms >= ECHO_TIMEOUT_MS || width < ULTRA_MIN_US || width > ULTRA_MAX_US)
+            width = 0;  // 에코 없음 / 범위 밖도 샘플로 기록 (신뢰도에 반영)
+
+        Ring_Push((uint16_t)width, now);
 
         ic_state = 0;
         __HAL_TIM_SET_CAPTUREPOLARITY(htim, TIM_CHANNEL_2, TIM_INPUTCHANNELPOLARITY_RISING);
     }
-
-}*/
+}
@@ -12,15 +12,24 @@
 /* Private includes ----------------------------------------------------------*/
 /* USER CODE BEGIN Includes */
 #include <stdio.h>
+#include <string.h>
 #include "drivers/ultrasonic.h"
 #include "drivers/servo.h"
 #include "robot_config.h"
 #include "robot_state.h"
+#include "scan_map.h"
 #include "drivers/motor.h"
 #include "drivers/buzzer.h"
+#include "drivers/rgb_led.h"
 #include "drivers/anim.h"
 #include "drivers/lcd_st7735.h"
+#include "drivers/lcd_pal.h"
 #include "ui_fsm.h"
+#include "scheduler.h"
+#include "timebase.h"
+#include "drivers/uart_link.h"
+#include "drivers/clcd_i2c.h"
+#include "prof.h"
 /* USER CODE END Includes */
 
 /* Private typedef -----------------------------------------------------------*/
@@ -30,12 +39,7 @@
 /* Private define ------------------------------------------------------------*/
 /* USER CODE BEGIN PD */
 #define delay_ms HAL_Delay
-#define ADDRESS   0x27 << 1
-#define RS1_EN1   0x05
-#define RS1_EN0   0x01
-#define RS0_EN1   0x04
-#define RS0_EN0   0x00
-#define BackLight 0x08
+#define CLCD_ADDR 0x27      // PCF8574 I2C 주소 (PCF8574A = 0x3F)
 /* USER CODE END PD */
 
 /* Private macro -------------------------------------------------------------*/
@@ -55,72 +59,14 @@ TIM_HandleTypeDef htim3;
 UART_HandleTypeDef huart2;
 UART_HandleTypeDef huart3;
 DMA_HandleTypeDef hdma_usart2_rx;
+DMA_HandleTypeDef hdma_usart2_tx;
 DMA_HandleTypeDef hdma_usart3_rx;
+DMA_HandleTypeDef hdma_tim3_ch3;
 
 /* USER CODE BEGIN PV */
-#define UART_RX_BUF_SIZE 256
-
-uint8_t uart2_rx_buf[UART_RX_BUF_SIZE];
-uint16_t uart2_old_pos = 0;
-
-uint8_t uart3_rx_buf[UART_RX_BUF_SIZE];
-uint16_t uart3_old_pos = 0;
-
-int delay = 0;
-int value = 0;
-
-static RobotState_t prevState = STATE_IDLE;
-int8_t scan_dir = 1;
-uint8_t scan_angle = 30;
-uint32_t last_scan_tick = 0;
-
-uint8_t start_flag = 0;
-uint8_t manual_mode = 0;
-
-uint16_t min_dist = 999;
-uint8_t  min_angle = 90;
-
-uint8_t manual_command = 0;
-uint16_t g_distance = 0;
-uint32_t debug_tick = 0;
-uint16_t last_valid_dist = 50;
-
-static uint32_t last_ping_time = 0;
-static uint32_t next_ping_interval = 0;
-
-static uint32_t echo_start_time = 0;
-
-static uint16_t read_stable_distance(void)
-{
-    uint16_t d[2];
-    int count = 0;
-
-    for(int i=0;i<2;i++)
-    {
-        uint32_t t = HAL_GetTick();
-
-        while(HAL_GetTick() - t < 40)
-        {
-            uint16_t dist = Ultrasonic_Read();
-            if(dist != 999)
-            {
-                d[count++] = dist;
-                break;
-            }
-        }
-    }
-
-    if(count == 0) return 999;
-    if(count == 1) return d[0];
-    return (d[0]+d[1])/2;
-}
-
 extern volatile uint8_t spi_dma_busy;
 extern volatile uint8_t spi_dma_done;
 extern volatile uint8_t spi_busy;
-
-volatile uint8_t servo_moving = 0;
-volatile uint32_t servo_move_tick = 0;
 /* USER CODE END PV */
 
 /* Private function prototypes -----------------------------------------------*/
@@ -135,99 +81,15 @@ static void MX_I2C1_Init(void);
 static void MX_USART2_UART_Init(void);
 static void MX_USART3_UART_Init(void);
 /* USER CODE BEGIN PFP */
-void Set_LED_By_State(RobotState_t state);
 void I2C_ScanAddresses(void);
 
-void delay_us(int us){
-    // 64MHz 기준: 루프 1회 ≈ 약 4~5 사이클
-    // 1us = 64 사이클 → 루프로 맞추려면 약 16 반복
-    value = 16;
-    delay = us * value;
-    for(volatile int i = 0; i < delay; i++);
-}
-
-void LCD_DATA(uint8_t data){
-    uint8_t temp=(data & 0xF0)|RS1_EN1|BackLight;
-    HAL_I2C_Master_Transmit(&hi2c1, ADDRESS, &temp, 1, 10);
-    temp=(data & 0xF0)|RS1_EN0|BackLight;
-    HAL_I2C_Master_Transmit(&hi2c1, ADDRESS, &temp, 1, 10);
-    delay_us(4);
-    temp=((data << 4) & 0xF0)|RS1_EN1|BackLight;
-    HAL_I2C_Master_Transmit(&hi2c1, ADDRESS, &temp, 1, 10);
-    temp=((data << 4) & 0xF0)|RS1_EN0|BackLight;
-    HAL_I2C_Master_Transmit(&hi2c1, ADDRESS, &temp, 1, 10);
-    delay_us(50);
-}
-
-void LCD_CMD(uint8_t cmd){
-    uint8_t temp=(cmd & 0xF0)|RS0_EN1|BackLight;
-    HAL_I2C_Master_Transmit(&hi2c1, ADDRESS, &temp, 1, 10);
-    temp=(cmd & 0xF0)|RS0_EN0|BackLight;
-    HAL_I2C_Master_Transmit(&hi2c1, ADDRESS, &temp, 1, 10);
-    delay_us(4);
-    temp=((cmd << 4) & 0xF0)|RS0_EN1|BackLight;
-    HAL_I2C_Master_Transmit(&hi2c1, ADDRESS, &temp, 1, 10);
-    temp=((cmd << 4) & 0xF0)|RS0_EN0|BackLight;
-    HAL_I2C_Master_Transmit(&hi2c1, ADDRESS, &temp, 1, 10);
-    delay_us(50);
-}
-
-void LCD_CMD_4bit(uint8_t cmd){
-	uint8_t temp=((cmd << 4) & 0xF0)|RS0_EN1|BackLight;
-	while(HAL_I2C_Master_Transmit(&hi2c1, ADDRESS, &temp, 1, 1000)!=HAL_OK);
-	temp=((cmd << 4) & 0xF0)|RS0_EN0|BackLight;
-	while(HAL_I2C_Master_Transmit(&hi2c1, ADDRESS, &temp, 1, 1000)!=HAL_OK);
-	delay_us(50);
-}
-
-void LCD_INIT(void){
-    HAL_Delay(100);
-    LCD_CMD_4bit(0x03); HAL_Delay(5);
-    LCD_CMD_4bit(0x03); HAL_Delay(1);
-    LCD_CMD_4bit(0x03); HAL_Delay(1);
-    LCD_CMD_4bit(0x02); HAL_Delay(1);
-    LCD_CMD(0x28);
-    LCD_CMD(0x08);
-    LCD_CMD(0x01);
-    HAL_Delay(3);
-    LCD_CMD(0x06);
-    LCD_CMD(0x0C);
-}
-
-void LCD_XY(char x, char y){
-	if      (y == 0) LCD_CMD(0x80 + x);
-	else if (y == 1) LCD_CMD(0xC0 + x);
-	else if (y == 2) LCD_CMD(0x94 + x);
-	else if (y == 3) LCD_CMD(0xD4 + x);
-}
-
-void LCD_CLEAR(void){
-    LCD_CMD(0x01);
-    HAL_Delay(3);   // delay_ms → HAL_Delay로 교체, 2ms→3ms로 여유있게
-}
-
-void LCD_PUTS(char *str){
-	while (*str) LCD_DATA(*str++);
-}
 /* USER CODE END PFP */
 
 /* Private user code ---------------------------------------------------------*/
 /* USER CODE BEGIN 0 */
 
-const char* StateToStr(RobotState_t state)
-{
-    switch (state)
-    {
-    case STATE_IDLE:   return "IDLE";
-    case STATE_SCAN:   return "SCAN";
-    case STATE_WAIT_ECHO: return "WAIT_ECHO";  // ⭐ 여기
-    case STATE_DECIDE: return "DECIDE";
-    case STATE_MOVE:   return "MOVE";
-    case STATE_ALERT:  return "ALERT";
-    case STATE_REVERSE: return "REVERSE";
-    default:           return "UNKNOWN";
-    }
-}
+static TimeCalib_t recal;           // 'c' 재보정 결과 (원샷 콜백이 채움)
+static uint8_t recal_pending = 0;   // 끝나면 Task_Uart 가 출력
 
 void I2C_ScanAddresses(void) {
     HAL_StatusTypeDef result;
@@ -250,66 +112,35 @@ void Handle_Command(uint8_t cmd)
 	printf("RX: %c (%d)\r\n", cmd, cmd);
     switch (cmd)
     {
+    /* 주행 명령은 상태기계 이벤트로 (동작/부저/출력은 robot_state.c 전이 표) */
     case 't':
     case 'T':
-        start_flag  = 1;
-        manual_mode = 0;
-        Buzzer_PlayStart();
-        printf("AUTO MODE START\r\n");
-        RobotState_Set(STATE_SCAN);
+        RobotState_Post(EV_START);
         break;
 
     case 'x':
     case 'X':
-        start_flag  = 0;
-        manual_mode = 0;
-        Motor_Stop();
-        Buzzer_PlayStop();
-         printf("STOP\r\n");
-        RobotState_Set(STATE_IDLE);
-        manual_command = 0;
+        RobotState_Post(EV_STOP);
         break;
 
     case 'w':
     case 'W':
-        manual_mode = 1;
-        start_flag  = 0;
-        Buzzer_PlayOk();
-        Motor_Forward();
-        printf("MANUAL: FORWARD\r\n");
-        RobotState_Set(STATE_MOVE);
-        manual_command = 1;
+        RobotState_Post(EV_FORWARD);
         break;
 
     case 's':
     case 'S':
-        manual_mode = 1;
-        start_flag  = 0;
-        Motor_Backward();
-        Buzzer_PlayElise();
-        RobotState_Set(STATE_REVERSE);
-        printf("MANUAL: BACKWARD\r\n");
-        manual_command = 2;
+        RobotState_Post(EV_BACK);
         break;
 
     case 'a':
     case 'A':
-        manual_mode = 1;
-        start_flag  = 0;
-        Buzzer_PlayOk();
-        Motor_Left();
-        printf("MANUAL: LEFT\r\n");
-        manual_command = 3;
+        RobotState_Post(EV_LEFT);
         break;
 
     case 'd':
     case 'D':
-        manual_mode = 1;
-        start_flag  = 0;
-        Buzzer_PlayOk();
-        Motor_Right();
-        printf("MANUAL: RIGHT\r\n");
-        manual_command = 4;
+        RobotState_Post(EV_RIGHT);
         break;
 
     case 'r':
@@ -319,31 +150,163 @@ void Handle_Command(uint8_t cmd)
         Buzzer_PlayReset();
         manual_command = 5;
         break;
+
+    case 'i':
+    case 'I':
+        Sched_PrintStats();     // 태스크별 실행/지연 통계 출력 후 초기화
+        Sched_ResetStats();
+        Link_PrintStats();      // UART 링크 수신/에러 통계
+        Link_ResetStats();
+        CLCD_PrintStats();      // 문자 LCD 갱신당 I2C 바이트
+        CLCD_ResetStats();
+        Motor_PrintStats();     // 모터 명령/듀티, 소프트 PWM 인터럽트
+        Motor_ResetStats();
+        Buzzer_PrintStats();    // 부저 DMA 반쪽 채우기 시간/지각
+        Buzzer_ResetStats();
+        Prof_PrintStats();      // 구간 기록 스트림 (tools/prof_trace.py)
+        Prof_ResetStats();
+        Pal_PrintStats();       // 눈 LCD 프레임버퍼: 보낸 창/행, 프레임 시간
+        Pal_ResetStats();
+        RGB_PrintStats();       // 상태 LED 효과: 스텝/에지 인터럽트
+        RGB_ResetStats();
+        break;
+
+    case 'l':
+    case 'L':
+    {
+        static uint8_t fx_next = 0;
+        const char *name;
+        LedFxId_t id = (LedFxId_t)(fx_next++ % LEDFX_FX_COUNT);
+        LedFx_Effect(id, &name);
+        RGB_PlayEffect(id);     // 내장 효과 차례로 미리보기 (다음 상태 전이의 RGB_Set이 멈춤)
+        printf("LED FX: %s\r\n", name);
+        break;
+    }
+
+    case 'f':
+    case 'F':
+        Eyes_Invalidate();      // 화면 전체를 1장 보내고 시간 측정 (팔레트 확장 + SPI)
+        Eyes_Draw(Eyes_GetExpression());
+        Pal_PrintStats();
+        break;
+
+    case 'm':
+    case 'M':
+        ScanMap_Print();        // 각도별 장애물 지도 (거리/신뢰도/나이)
+        break;
+
+    case 'c':
+    case 'C':
+        // 클럭/타이머 재측정 - 원샷 콜백으로 약 100ms 동안 진행, 태스크는 기다리지 않음
+        if (Time_CalibrateStart(&recal) == 0)
+            recal_pending = 1;
+        else
+            printf("CALIB BUSY\r\n");
+        break;
+    }
+}
+
+/**
+ * @brief 상태기계 전이 기록 전송 (헤더 1프레임 + 기록 2개씩, tools/fsm_trace.py 로 해석)
+ *        블로킹 송신 - 128개 기록이 115200bps에서 약 160ms
+ */
+static void Trace_Send(LinkPort_t port)
+{
+    static RobotTrace_t recs[ROBOT_TRACE_SIZE];
+    uint16_t n = RobotState_GetTrace(recs, ROBOT_TRACE_SIZE);
+    uint32_t dropped = RobotState_GetDropped();
+
+    uint8_t hdr[10];
+    memcpy(&hdr[0], &SystemCoreClock, 4);
+    memcpy(&hdr[4], &n, 2);
+    memcpy(&hdr[6], &dropped, 4);
+    Link_Send(port, LINK_T_TRACE_HDR, hdr, sizeof(hdr));
+
+    for (uint16_t i = 0; i < n; i += 2)
+    {
+        uint8_t cnt = (n - i >= 2) ? 2 : 1;
+        Link_Send(port, LINK_T_TRACE_REC, (const uint8_t *)&recs[i], (uint8_t)(cnt * sizeof(RobotTrace_t)));
     }
 }
 
-void Set_LED_By_State(RobotState_t state)
+/**
+ * @brief 바이너리 프레임 수신 (payload는 DMA 버퍼를 그대로 가리킴)
+ */
+static void Link_OnFrame(const LinkFrame_t *f)
 {
-    switch (state)
+    switch (f->type)
     {
-    case STATE_SCAN:
-    case STATE_MOVE:
-        RGB_Set(RGB_COLOR_GREEN);
+    case LINK_T_CMD:
+        for (uint8_t i = 0; i < f->len; i++)
+            Handle_Command(Link_Byte(f, i));
         break;
-    case STATE_REVERSE:
+
+    case LINK_T_PING:
+    {
+        uint8_t echo[LINK_MAX_PAYLOAD];
+        for (uint8_t i = 0; i < f->len; i++)
+            echo[i] = Link_Byte(f, i);
+        Link_Send(f->port, LINK_T_PONG, echo, f->len);
         break;
-    case STATE_ALERT:
-        RGB_Set(RGB_COLOR_RED);
+    }
+
+    case LINK_T_STATS:
+        Link_PrintStats();
         break;
-    case STATE_DECIDE:
-        RGB_Set(RGB_COLOR_ORANGE);
+
+    case LINK_T_TRACE:
+        Trace_Send(f->port);
         break;
-    default:
-        RGB_Off();
+
+    case LINK_T_PROF:
+        /* 켜면 Task_Prof가 USART2 TX DMA로 계속 내보냄 (USART3은 TX DMA 채널이 부저와 겹침) */
+        if (f->len >= 1 && Link_Byte(f, 0))
+            Prof_Start(f->port);
+        else
+            Prof_Stop();
         break;
     }
 }
 
+/* ===== 스케줄러 태스크 ===== */
+/* 주기/예산은 main()의 Sched_Add 참고, 통계는 'i' 명령으로 출력 */
+
+static void Task_Uart(void)
+{
+    // USB(UART2)/블루투스(UART3) 수신 - HT/TC/IDLE 이벤트가 있었던 포트만 파싱, 에러 시 DMA 재시작
+    Link_Poll();
+
+    if (recal_pending && !Time_CalibrateBusy())
+    {
+        recal_pending = 0;
+        Time_PrintCalibration(&recal);
+    }
+}
+
+static void Task_Robot(void)
+{
+    // 이벤트 큐가 비고 상태 타이머가 안 됐으면 바로 리턴
+    RobotState_Run();
+}
+
+static void Task_Ui(void)
+{
+    UI_Update();
+}
+
+static void Task_Prof(void)
+{
+    // 구간 기록 → 링크 프레임 → UART DMA (꺼져 있거나 이전 전송 중이면 바로 리턴)
+    Prof_Poll();
+}
+
+static void Task_Anim(void)
+{
+    /* ST7735 DMA 전송 중이면 이번 주기는 건너뜀 */
+    if (!spi_busy)
+        Anim_Update();
+}
+
 /* USER CODE END 0 */
 
 /**
@@ -385,11 +348,18 @@ int main(void)
   // UART3 초기화 (GUI 설정 전까지 수동 호출)
   MX_USART3_UART_Init();
 
-  // USB(UART2)와 블루투스(UART3) 모두 DMA 수신 시작
-  HAL_UART_Receive_DMA(&huart2, uart2_rx_buf, UART_RX_BUF_SIZE);
-  HAL_UART_Receive_DMA(&huart3, uart3_rx_buf, UART_RX_BUF_SIZE);
+  Time_Init();       // 공용 us 시계 (DWT) + TIM4 원샷 - 시간을 쓰는 모듈보다 먼저
+
+  // USB(UART2)와 블루투스(UART3) 모두 DMA 수신 시작 (IDLE/HT/TC 이벤트, 프레임 + 1글자 명령)
+  Link_Init(Link_OnFrame, Handle_Command);
+  Link_Start(LINK_PORT_USB, &huart2);
+  Link_Start(LINK_PORT_BT, &huart3);
 
  I2C_ScanAddresses();
+
+  TimeCalib_t cal;
+  Time_Calibrate(&cal);  // SystemCoreClock 설정과 실제 클럭 비교 (1% 넘게 다르면 측정값 사용)
+  Time_PrintCalibration(&cal);
 //
 
 
@@ -403,15 +373,14 @@ int main(void)
   RGB_Init();
   LCD_Init();        // ST7735 먼저 (하드웨어 리셋 포함)
   HAL_Delay(100);    // ST7735 완전히 안정화 대기
-  LCD_INIT();        // HD44780 초기화 (ST7735 리셋 영향 없이)
+  CLCD_Init(&hi2c1, CLCD_ADDR, 16, 2);   // HD44780 초기화 (부팅 때만 블로킹, 이후 갱신은 I2C 인터럽트)
   Anim_Init();
   UI_Init();
 
   Buzzer_PlayMario();
 
 
-  RobotState_Init();
-  RobotState_Set(STATE_IDLE);
+  RobotState_Init();     // IDLE 진입 (LED 끔, 중립 표정, 핑 타이머)
 
   Anim_Set(EXPR_NEUTRAL);  // 중립 표정으로 시작
 
@@ -419,6 +388,16 @@ int main(void)
   HAL_Delay(500);
 
   printf("시작하시려면 t 키를 눌러주세요.\r\n");
+
+  /* 협조형 스케줄러: 주기(ms), 1회 실행 예산(us)
+   * 데드라인(릴리스 + 주기)이 이른 순서로 실행 → UART 명령 지연은 최대 (가장 긴 태스크 실행 시간 + 1ms) */
+  Sched_Init();
+  Sched_Add("uart",   Task_Uart,     1,   200);
+  Sched_Add("robot",  Task_Robot,    1,   500);
+  Sched_Add("anim",   Task_Anim,     ANIM_FRAME_MS, 20000);
+  Sched_Add("ui",     Task_Ui,     200,   300);
+  Sched_Add("prof",   Task_Prof,     5,   200);
+  Sched_Start();
   //HAL_UART_Receive_IT(&huart2, &rx_char, 1);
 
 //  LCD_Init();
@@ -431,317 +410,11 @@ int main(void)
   /* Infinite loop */
   /* USER CODE BEGIN WHILE */
   
-  // 이미 위에서 HAL_UART_Receive_DMA가 호출되었으므로 여기서는 중복 호출하지 않습니다.
+  // 이미 위에서 Link_Start로 DMA 수신을 시작했으므로 여기서는 중복 호출하지 않습니다.
 
   while (1)
   {
-      // --- [1] UART2 (USB) 수신 처리 ---
-      uint16_t pos2 = UART_RX_BUF_SIZE - __HAL_DMA_GET_COUNTER(huart2.hdmarx);
-      if (pos2 != uart2_old_pos) {
-          if (pos2 > uart2_old_pos) {
-              for (uint16_t i = uart2_old_pos; i < pos2; i++) Handle_Command(uart2_rx_buf[i]);
-          } else {
-              for (uint16_t i = uart2_old_pos; i < UART_RX_BUF_SIZE; i++) Handle_Command(uart2_rx_buf[i]);
-              for (uint16_t i = 0; i < pos2; i++) Handle_Command(uart2_rx_buf[i]);
-          }
-          uart2_old_pos = pos2;
-      }
-
-      // --- [2] UART3 (Bluetooth) 수신 처리 ---
-      uint16_t pos3 = UART_RX_BUF_SIZE - __HAL_DMA_GET_COUNTER(huart3.hdmarx);
-      if (pos3 != uart3_old_pos) {
-          if (pos3 > uart3_old_pos) {
-              for (uint16_t i = uart3_old_pos; i < pos3; i++) Handle_Command(uart3_rx_buf[i]);
-          } else {
-              for (uint16_t i = uart3_old_pos; i < UART_RX_BUF_SIZE; i++) Handle_Command(uart3_rx_buf[i]);
-              for (uint16_t i = 0; i < pos3; i++) Handle_Command(uart3_rx_buf[i]);
-          }
-          uart3_old_pos = pos3;
-      }
-
-      // --- [3] UART 에러 복구 ---
-      if (huart2.ErrorCode != HAL_UART_ERROR_NONE) {
-          __HAL_UART_CLEAR_OREFLAG(&huart2);
-          huart2.RxState = HAL_UART_STATE_READY;
-          HAL_UART_Receive_DMA(&huart2, uart2_rx_buf, UART_RX_BUF_SIZE);
-      }
-      if (huart3.ErrorCode != HAL_UART_ERROR_NONE) {
-          __HAL_UART_CLEAR_OREFLAG(&huart3);
-          huart3.RxState = HAL_UART_STATE_READY;
-          HAL_UART_Receive_DMA(&huart3, uart3_rx_buf, UART_RX_BUF_SIZE);
-      }
-
-      RobotState_t currentState = RobotState_Get();
-      Set_LED_By_State(currentState);
-
-      Buzzer_Update();
-
-      static uint32_t ui_tick = 0;
-      uint32_t now = HAL_GetTick();
-
-
-
-
-
-
-      static uint8_t ui_busy = 0;
-
-      if (now - ui_tick >= 200)
-      {
-          ui_tick = now;
-          ui_busy = 1;
-          UI_Update();
-          ui_busy = 0;
-      }
-
-      static uint32_t anim_tick = 0;
-      if (HAL_GetTick() - anim_tick >= 50)
-      {
-          if (!spi_busy)
-          {
-              anim_tick = HAL_GetTick();
-              Anim_Update();
-          }
-      }
-      // ===== IDLE 상태 처리 (start_flag 체크 전에 실행) =====
-         if (currentState == STATE_IDLE)
-         {
-             uint32_t current_time = HAL_GetTick();
-
-             // 처음 실행 시 또는 다음 핑 시간 설정
-             if (next_ping_interval == 0) {
-                 next_ping_interval = 20000 + (rand() % 60000);  // 20~60초
-                 last_ping_time = current_time;
-             }
-
-             // 랜덤 시간이 지나면 소리 재생
-             if (current_time - last_ping_time >= next_ping_interval) {
-                 Buzzer_PlayPing();
-
-                 // 다음 핑 시간 재설정
-                 next_ping_interval = 20000 + (rand() % 60000);
-                 last_ping_time = current_time;
-             }
-         }
-
-         //상태변환시에만
-      if (currentState != prevState)
-      {
-          switch (currentState)
-          {
-			case STATE_IDLE:
-				Anim_Set(EXPR_NEUTRAL);
-				break;
-
-			case STATE_SCAN:
-				Anim_Set(EXPR_LOOK_LEFT);
-				break;
-
-			case STATE_MOVE:
-				Anim_Set(EXPR_HAPPY);
-				break;
-			case STATE_REVERSE:
-          {
-        	  Anim_Set(EXPR_SAD);
-              Motor_Backward();
-              static uint32_t reverse_blink_tick = 0;
-              uint32_t now = HAL_GetTick();
-
-              if (now - reverse_blink_tick >= 500)
-              {
-                  reverse_blink_tick = now;
-                  RGB_Set(RGB_COLOR_ORANGE);
-              }
-              else if (now - reverse_blink_tick >= 250)
-              {
-                  RGB_Off();
-              }
-              break;
-          }
-
-          case STATE_ALERT:
-        	  Anim_Set(EXPR_ANGRY);
-        	  Buzzer_PlayAlert();
-              break;
-
-          default:
-              break;
-          }
-          prevState = currentState;
-      }
-
-
-
-
-
-      if (!start_flag)
-      {
-          continue;
-      }
-
-
-
-
-
-
-      switch (currentState)
-      {
-      case STATE_IDLE:
-          break;
-
-
-      case STATE_SCAN:
-      {
-          if (HAL_GetTick() - last_scan_tick < 100) //150
-              break;
-
-          last_scan_tick = HAL_GetTick();
-          /* 새 스캔 사이클 시작점(30도, 우향)에서 최소값 리셋 */
-                  if (scan_angle == 30 && scan_dir == 1)
-                  {
-                      min_dist = 999;
-                      min_angle = 90;
-                  }
-
-          Servo_SetAngle(scan_angle);
-
-          servo_moving = 1;                    // 서보 이동 시작
-          servo_move_tick = HAL_GetTick();     // 타이머 시작
-
-          echo_start_time = HAL_GetTick();   // 서보 안정 타이머 시작
-          RobotState_Set(STATE_WAIT_ECHO);
-          break;
-      }
-
-      case STATE_WAIT_ECHO:
-      {
-          if (HAL_GetTick() - echo_start_time < 20) //80
-              break;
-
-          servo_moving = 0;   // ← 서보 안정화 완료
-
-          Ultrasonic_Trigger();
-          echo_start_time = HAL_GetTick();
-          RobotState_Set(STATE_READ_ECHO);
-          break;
-      }
-      case STATE_READ_ECHO:
-      {
-          uint16_t dist = Ultrasonic_Read();
-
-          if (dist == 999 && HAL_GetTick() - echo_start_time < 10) //50
-              break;  // 아직 에코 안 들어옴 → 대기
-
-          // 값 들어왔거나 타임아웃
-          if (dist != 999)
-          {
-              last_valid_dist = dist;
-              g_distance = dist;
-          }
-
-          if (HAL_GetTick() - debug_tick > 200)
-          {
-              debug_tick = HAL_GetTick();
-              printf("angle=%3d | dist=%3d cm\r\n", scan_angle, last_valid_dist);
-          }
-
-          if (last_valid_dist < min_dist)
-          {
-              min_dist  = last_valid_dist;
-              min_angle = scan_angle;
-          }
-
-          scan_angle += scan_dir * 10;
-
-          if (scan_angle >= 150)
-          {
-              scan_angle = 150;
-              scan_dir = -1;
-              RobotState_Set(STATE_DECIDE);
-          }
-          else if (scan_angle <= 30)
-          {
-              scan_angle = 30;
-              scan_dir = 1;
-              RobotState_Set(STATE_DECIDE);
-          }
-          else
-          {
-              RobotState_Set(STATE_SCAN);
-          }
-          break;
-      }
-
-
-      case STATE_DECIDE:
-          printf("STATE:%s | min_angle=%d | min_dist=%d cm\r\n",
-                 StateToStr(currentState), min_angle, min_dist);
-
-          if (min_dist > DIST_SAFE)
-              RobotState_Set(STATE_MOVE);
-          else
-              RobotState_Set(STATE_ALERT);
-
-
-          break;
-
-      case STATE_MOVE:
-      {
-    	  if (HAL_GetTick() - debug_tick > 200)
-    	  {
-    		  debug_tick = HAL_GetTick();
-    		  printf("STATE:%s | FORWARD\r\n", StateToStr(currentState));
-    	  }
-
-          Motor_Forward();
-          RobotState_Set(STATE_SCAN);
-          break;
-      }
-
-      case STATE_REVERSE:
-      {
-          Motor_Backward();
-          static uint32_t reverse_blink_tick = 0;
-          uint32_t now = HAL_GetTick();
-
-          if (now - reverse_blink_tick >= 500)
-          {
-              reverse_blink_tick = now;
-              RGB_Set(RGB_COLOR_ORANGE);
-          }
-          else if (now - reverse_blink_tick >= 250)
-          {
-              RGB_Off();
-          }
-
-          break;
-      }
-
-      case STATE_ALERT:
-      {
-          static uint32_t avoid_start = 0;
-          static uint8_t  avoiding = 0;
-
-          if (!avoiding)
-          {
-              if (min_angle < 90) Motor_Left();
-              else Motor_Right();
-
-              avoid_start = HAL_GetTick();
-              avoiding = 1;
-          }
-
-          if (avoiding && HAL_GetTick() - avoid_start > 120)
-          {
-              Motor_Stop();
-              avoiding = 0;
-              min_dist = 999;
-              RobotState_Set(STATE_SCAN);
-          }
-
-          break;
-      }
-      }
+      Sched_RunOnce();
 
     /* USER CODE END WHILE */
 
@@ -950,14 +623,15 @@ static void MX_TIM2_Init(void)
   TIM_ClockConfigTypeDef sClockSourceConfig = {0};
   TIM_MasterConfigTypeDef sMasterConfig = {0};
   TIM_IC_InitTypeDef sConfigIC = {0};
+  TIM_OC_InitTypeDef sConfigOC = {0};
 
   /* USER CODE BEGIN TIM2_Init 1 */
 
   /* USER CODE END TIM2_Init 1 */
   htim2.Instance = TIM2;
-  htim2.Init.Prescaler = 71;
+  htim2.Init.Prescaler = 63;
   htim2.Init.CounterMode = TIM_COUNTERMODE_UP;
-  htim2.Init.Period = 65535;
+  htim2.Init.Period = 59999;
   htim2.Init.ClockDivision = TIM_CLOCKDIVISION_DIV1;
   htim2.Init.AutoReloadPreload = TIM_AUTORELOAD_PRELOAD_DISABLE;
   if (HAL_TIM_Base_Init(&htim2) != HAL_OK)
@@ -973,6 +647,10 @@ static void MX_TIM2_Init(void)
   {
     Error_Handler();
   }
+  if (HAL_TIM_PWM_Init(&htim2) != HAL_OK)
+  {
+    Error_Handler();
+  }
   sMasterConfig.MasterOutputTrigger = TIM_TRGO_RESET;
   sMasterConfig.MasterSlaveMode = TIM_MASTERSLAVEMODE_DISABLE;
   if (HAL_TIMEx_MasterConfigSynchronization(&htim2, &sMasterConfig) != HAL_OK)
@@ -987,9 +665,18 @@ static void MX_TIM2_Init(void)
   {
     Error_Handler();
   }
+  sConfigOC.OCMode = TIM_OCMODE_PWM1;
+  sConfigOC.Pulse = 10;
+  sConfigOC.OCPolarity = TIM_OCPOLARITY_HIGH;
+  sConfigOC.OCFastMode = TIM_OCFAST_DISABLE;
+  if (HAL_TIM_PWM_ConfigChannel(&htim2, &sConfigOC, TIM_CHANNEL_1) != HAL_OK)
+  {
+    Error_Handler();
+  }
   /* USER CODE BEGIN TIM2_Init 2 */
 
   /* USER CODE END TIM2_Init 2 */
+  HAL_TIM_MspPostInit(&htim2);
 
 }
 
@@ -1104,6 +791,9 @@ static void MX_DMA_Init(void)
   __HAL_RCC_DMA1_CLK_ENABLE();
 
   /* DMA interrupt init */
+  /* DMA1_Channel7_IRQn interrupt configuration (USART2_TX, 구간 기록 스트림) */
+  HAL_NVIC_SetPriority(DMA1_Channel7_IRQn, 3, 0);
+  HAL_NVIC_EnableIRQ(DMA1_Channel7_IRQn);
   /* DMA1_Channel5_IRQn interrupt configuration */
   HAL_NVIC_SetPriority(DMA1_Channel5_IRQn, 0, 0);
   HAL_NVIC_EnableIRQ(DMA1_Channel5_IRQn);
@@ -1135,7 +825,7 @@ static void MX_GPIO_Init(void)
   HAL_GPIO_WritePin(GPIOC, BUZZER_Pin|RED_Pin|GREEN_Pin|BLUE_Pin, GPIO_PIN_RESET);
 
   /*Configure GPIO pin Output Level */
-  HAL_GPIO_WritePin(GPIOA, TRIG_Pin|GPIOA_Pin|LBF_Pin|LFB_Pin, GPIO_PIN_RESET);
+  HAL_GPIO_WritePin(GPIOA, GPIOA_Pin|LBF_Pin|LFB_Pin, GPIO_PIN_RESET);
 
   /*Configure GPIO pin Output Level */
   HAL_GPIO_WritePin(GPIOB, LBB_Pin|GPIOB_Pin|LFF_Pin|RFF_Pin
@@ -1151,8 +841,8 @@ static void MX_GPIO_Init(void)
   GPIO_InitStruct.Speed = GPIO_SPEED_FREQ_LOW;
   HAL_GPIO_Init(GPIOC, &GPIO_InitStruct);
 
-  /*Configure GPIO pins : TRIG_Pin LBF_Pin LFB_Pin */
-  GPIO_InitStruct.Pin = TRIG_Pin|LBF_Pin|LFB_Pin;
+  /*Configure GPIO pins : LBF_Pin LFB_Pin */
+  GPIO_InitStruct.Pin = LBF_Pin|LFB_Pin;
   GPIO_InitStruct.Mode = GPIO_MODE_OUTPUT_PP;
   GPIO_InitStruct.Pull = GPIO_NOPULL;
   GPIO_InitStruct.Speed = GPIO_SPEED_FREQ_LOW;
@@ -1208,8 +898,15 @@ static void MX_GPIO_Init(void)
 /* USER CODE BEGIN 4 */
 void HAL_TIM_IC_CaptureCallback(TIM_HandleTypeDef *htim) { if(htim->Instance == TIM2 && htim->Channel == HAL_TIM_ACTIVE_CHANNEL_2) { Ultrasonic_IC_Callback(htim); } }
 
+/* 부저 DMA 버스트 (TIM3 CC3 요청) 반쪽/전체 완료 → 다 쓴 반쪽 다시 채움 */
+void HAL_TIM_PWM_PulseFinishedHalfCpltCallback(TIM_HandleTypeDef *htim) { if(htim->Instance == TIM3) { Buzzer_DmaHalfCallback(htim); } }
+void HAL_TIM_PWM_PulseFinishedCallback(TIM_HandleTypeDef *htim) { if(htim->Instance == TIM3) { Buzzer_DmaCpltCallback(htim); } }
+
 int _write(int file, char *ptr, int len)
 {
+    // 구간 기록 스트림(DMA) 송신 중이면 끝날 때까지 (아니면 HAL_BUSY로 버려짐)
+    Link_TxWait(LINK_PORT_USB);
+
     // UART 에러 상태(Overrun 등) 확인 및 강제 클리어
     if (__HAL_UART_GET_FLAG(&huart2, UART_FLAG_ORE) != RESET) {
         __HAL_UART_CLEAR_OREFLAG(&huart2);
@@ -1226,21 +923,8 @@ int _write(int file, char *ptr, int len)
 
 void HAL_UART_ErrorCallback(UART_HandleTypeDef *huart)
 {
-    if(huart->Instance == USART3)
-    {
-        // 에러 플래그 확인 및 클리어
-        uint32_t err = HAL_UART_GetError(huart);
-        if (err & HAL_UART_ERROR_ORE) {
-            __HAL_UART_CLEAR_OREFLAG(huart);
-        }
-        
-        // UART 상태 강제 초기화 (송수신 가능 상태로)
-        huart->gState = HAL_UART_STATE_READY;
-        huart->RxState = HAL_UART_STATE_READY;
-        
-        // DMA 수신 재시작
-        HAL_UART_Receive_DMA(&huart3, uart3_rx_buf, UART_RX_BUF_SIZE);
-    }
+    // DMA 수신이 멈췄으면 Link_Poll()이 메인 컨텍스트에서 재시작
+    Link_ErrorCallback(huart);
 }
 /* USER CODE END 4 */
 
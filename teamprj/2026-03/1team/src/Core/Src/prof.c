@@ -0,0 +1,187 @@
+/**
+ * @file prof.c
+ * @brief 핫패스 구간 기록 - DWT 사이클 도장을 잠금 없는 RAM 링에 쌓고 UART DMA로 내보냄
+ *
+ * 기록 (Prof_Mark, 어느 컨텍스트에서나):
+ * 1. LDREX로 head를 읽고 DWT CYCCNT를 찍은 뒤 STREX로 head+1 (칸 예약)
+ *    - 그 사이에 인터럽트가 들어와 기록하면 예외 복귀가 모니터를 지워 STREX 실패 → 다시 찍음
+ *    → 링 순서 = 시각 순서 (PC가 CYCCNT 한 바퀴를 차이로 풀 수 있음)
+ * 2. 예약한 칸에 {cyc, tag, ctx} 쓰기 - ctx = IPSR (0 = 메인, 그 밖 = 예외 번호)
+ * 3. 링이 가득 차면 새 기록을 버리고 dropped (인터럽트와 겹치면 근사치)
+ *
+ * 내보내기 (Prof_Poll, 메인 컨텍스트만):
+ * - 읽는 쪽이 메인이므로, 메인이 여기 있는 동안 예약만 되고 안 써진 칸은 없음
+ *   (메인의 Prof_Mark는 끝났고, 인터럽트의 Prof_Mark는 메인으로 돌아오기 전에 끝남)
+ * - 링크 프레임(uart_link.h LINK_T_PROF_*)으로 묶어 USART2 TX DMA 1번 → CPU는 프레임 만들기만
+ * - 이전 DMA가 안 끝났으면 바로 리턴 (printf/Link_Send는 Link_TxWait로 DMA 뒤에 나감)
+ *
+ * 처리량: 기록 1개 = 6바이트 + 프레임(4개당 4바이트) = 7바이트 → 115200bps에서 약 1600개/초
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "prof.h"
+#include "drivers/uart_link.h"
+#include "stm32f1xx_hal.h"
+
+#define RING_MASK   (PROF_RING_SIZE - 1)
+#define REC_SIZE    6               // 전송 형식 (cyc u32, tag u8, ctx u8)
+#define REC_PER_FRAME   (LINK_MAX_PAYLOAD / REC_SIZE)
+
+typedef struct {
+    uint32_t cyc;
+    uint8_t  tag;                   // id | PROF_F_END
+    uint8_t  ctx;                   // IPSR 예외 번호
+} ProfRec_t;
+
+static const char *const prof_name[PROF_COUNT] = {
+    "Anim_Update",
+    "UI_Update",
+    "LCD_WriteColorFast",
+    "Link_Poll",
+};
+
+static ProfRec_t ring[PROF_RING_SIZE];
+static volatile uint32_t head;      // 다음에 예약할 칸 (LDREX/STREX)
+static volatile uint32_t tail;      // 다음에 보낼 칸 (메인만 씀, Prof_Mark는 가득 찼는지만 봄)
+
+volatile uint8_t prof_on = 0;
+static uint8_t  tx_port;
+static uint8_t  need_hdr;           // 헤더 + 이름 프레임부터
+static uint32_t hdr_dropped;        // 마지막 헤더에 실은 dropped
+
+static uint8_t tx_buf[(LINK_MAX_PAYLOAD + LINK_OVERHEAD) * (PROF_TX_FRAMES + 1 + PROF_COUNT)];
+static ProfStats_t stats;
+
+/* ===== 기록 ===== */
+
+void Prof_Mark(uint8_t tag)
+{
+    uint32_t h, cyc;
+
+    do {
+        h = __LDREXW(&head);
+        if (h - tail >= PROF_RING_SIZE)
+        {
+            __CLREX();
+            stats.dropped++;
+            return;
+        }
+        cyc = DWT->CYCCNT;
+    } while (__STREXW(h + 1u, &head));
+
+    ProfRec_t *r = &ring[h & RING_MASK];
+    r->cyc = cyc;
+    r->tag = tag;
+    r->ctx = (uint8_t)__get_IPSR();
+    stats.records++;
+}
+
+/* ===== 내보내기 ===== */
+
+static uint16_t Put_Header(uint16_t n)
+{
+    uint8_t p[8];
+    uint32_t dropped = stats.dropped;
+
+    memcpy(&p[0], &SystemCoreClock, 4);
+    memcpy(&p[4], &dropped, 4);
+    hdr_dropped = dropped;
+    return (uint16_t)(n + Link_Encode(&tx_buf[n], LINK_T_PROF_HDR, p, sizeof(p)));
+}
+
+static uint16_t Put_Names(uint16_t n)
+{
+    for (uint8_t i = 0; i < PROF_COUNT; i++)
+    {
+        uint8_t p[LINK_MAX_PAYLOAD];
+        uint8_t len = (uint8_t)strlen(prof_name[i]);
+        if (len > LINK_MAX_PAYLOAD - 1) len = LINK_MAX_PAYLOAD - 1;
+
+        p[0] = i;
+        memcpy(&p[1], prof_name[i], len);
+        n = (uint16_t)(n + Link_Encode(&tx_buf[n], LINK_T_PROF_NAME, p, (uint8_t)(len + 1)));
+    }
+    return n;
+}
+
+/**
+ * @brief 쌓인 기록을 프레임으로 묶어 DMA 송신 (스케줄러 태스크, 메인 컨텍스트)
+ */
+void Prof_Poll(void)
+{
+    if (!prof_on || Link_TxBusy((LinkPort_t)tx_port)) return;
+
+    uint16_t n = 0;
+    if (need_hdr)
+    {
+        n = Put_Names(Put_Header(0));
+        need_hdr = 0;
+    }
+    else if (stats.dropped != hdr_dropped)
+    {
+        n = Put_Header(0);          // PC가 이 위치에서 열린 구간을 버림
+    }
+
+    uint32_t fill = head - tail;
+    if (fill > stats.max_fill) stats.max_fill = fill;
+
+    for (uint8_t f = 0; f < PROF_TX_FRAMES && tail != head; f++)
+    {
+        uint8_t p[REC_PER_FRAME * REC_SIZE];
+        uint8_t k = 0;
+
+        while (k < REC_PER_FRAME && tail != head)
+        {
+            const ProfRec_t *r = &ring[tail & RING_MASK];
+            memcpy(&p[k * REC_SIZE], &r->cyc, 4);
+            p[k * REC_SIZE + 4] = r->tag;
+            p[k * REC_SIZE + 5] = r->ctx;
+            k++;
+            tail++;                 // 칸 반환 (복사했으므로 DMA와 무관)
+        }
+        n = (uint16_t)(n + Link_Encode(&tx_buf[n], LINK_T_PROF_REC, p, (uint8_t)(k * REC_SIZE)));
+        stats.sent += k;
+    }
+
+    if (n == 0) return;
+    if (Link_SendDma((LinkPort_t)tx_port, tx_buf, n) == HAL_OK)
+        stats.tx_bytes += n;
+}
+
+/* ===== 외부 API ===== */
+
+void Prof_Start(uint8_t port)
+{
+    tail = head;                    // 꺼져 있던 동안 남은 것 없음, 새로 시작
+    tx_port = port;
+    need_hdr = 1;
+    prof_on = 1;
+}
+
+void Prof_Stop(void)
+{
+    prof_on = 0;                    // 남은 기록은 버림 (다음 Start에서 tail = head)
+}
+
+void Prof_GetStats(ProfStats_t *out)
+{
+    *out = stats;
+}
+
+void Prof_ResetStats(void)
+{
+    stats = (ProfStats_t){ 0 };
+    hdr_dropped = 0;
+}
+
+/**
+ * @brief 기록/전송 통계 - dropped가 늘면 PROF_RING_SIZE를 키우거나 구간을 줄임
+ */
+void Prof_PrintStats(void)
+{
+    printf("prof %s: rec %lu drop %lu sent %lu tx %lu B, ring max %lu/%u\r\n",
+           prof_on ? "on" : "off",
+           (unsigned long)stats.records, (unsigned long)stats.dropped, (unsigned long)stats.sent,
+           (unsigned long)stats.tx_bytes, (unsigned long)stats.max_fill, (unsigned)PROF_RING_SIZE);
+}
@@ -1,20 +1,570 @@
+/**
+ * @file robot_state.c
+ * @brief 로봇 동작 상태기계 - 표 기반 계층형 FSM
+ *
+ * 상태 계층:
+ *   ROOT ─┬─ IDLE
+ *         ├─ AUTO ─┬─ SWEEP ─┬─ SCAN        (다음 각도까지 간격 대기 → 서보 이동)
+ *         │        │         ├─ WAIT_ECHO   (서보 안정 대기)
+ *         │        │         └─ READ_ECHO   (초음파 샘플 대기)
+ *         │        ├─ DECIDE
+ *         │        └─ ALERT                 (회피 회전)
+ *         ├─ MOVE       (자동: 전진 후 바로 SCAN / 수동: 'w', 'a', 'd')
+ *         └─ REVERSE    (수동 's')
+ *
+ * 동작:
+ * 1. 상태마다 진입(entry)/탈출(exit) 동작 + 전이 표 {이벤트, 조건, 동작, 다음 상태}
+ * 2. 현재 상태 표에 맞는 줄이 없으면 상위 상태 표를 찾음 (정지/수동 명령은 ROOT 한 곳에만)
+ * 3. 전이: 공통 조상까지 exit → 전이 동작 → 목표 상태까지 entry
+ * 4. 이벤트는 큐로만 들어옴 (UART 명령, 상태 타이머, 구독 상태의 초음파 새 샘플, 진입 동작의 완료 이벤트)
+ *    → 큐가 비고 타이머가 안 됐으면 RobotState_Run()은 비교 몇 번으로 끝
+ * 5. 처리한 이벤트마다 {DWT 시각, 큐 진입 시각, 이벤트, from, to}를 링에 기록
+ *    → tools/fsm_trace.py 로 판단 지연(마지막 초음파 샘플 → 회피 동작) 재구성
+ * 6. 측정값은 각도별 장애물 지도(scan_map.c)에 쌓임 → DECIDE는 지도만 봄
+ *    - 정면 범위 칸이 막히면 스윕 도중이라도 바로 EV_OBSTACLE → DECIDE
+ *    - 스윕 끝에서는 지도 전체(이전 방향 스윕 포함)로 전진/회피 판단
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
 #include "robot_state.h"
+#include "robot_config.h"
+#include "scan_map.h"
+#include "timebase.h"
+#include "drivers/ultrasonic.h"
+#include "drivers/servo.h"
+#include "drivers/motor.h"
+#include "drivers/buzzer.h"
+#include "drivers/anim.h"
+#include "drivers/rgb_led.h"
 
-/* ★ 전역(파일 내부) 상태 변수 */
-static RobotState_t currentState = STATE_IDLE;
+/* ===== 동작 시간 ===== */
+#define SCAN_STEP_MS        100     // 각도 간격 (이전 각도 시작 → 다음 각도 시작)
+#define SERVO_SETTLE_MS     20      // 서보 이동 후 측정 시작까지
+#define ALERT_TURN_MS       300     // 회피 회전 시간 (가속 0.2초 포함 → 예전 최고속 120ms와 같은 회전량)
+#define DEBUG_PRINT_MS      200
 
-void RobotState_Init(void)
+/* ===== 로봇 변수 (UI/애니메이션과 공유) ===== */
+uint8_t  start_flag = 0;
+uint8_t  manual_mode = 0;
+uint8_t  manual_command = 0;
+uint8_t  scan_angle = SERVO_MIN_ANGLE;
+uint16_t g_distance = 0;
+volatile uint8_t servo_moving = 0;
+
+/* ===== 스캔 상태 ===== */
+static int8_t   scan_dir = 1;
+static uint16_t last_valid_dist = 50;
+static uint8_t  last_angle = SERVO_MIN_ANGLE;
+static uint32_t last_scan_tick = 0;
+static uint32_t debug_tick = 0;
+static UltraRange_t range;              // 마지막으로 읽은 초음파 값 (SF_RANGE 상태에서 갱신)
+static uint32_t range_seq = 0;
+
+/* ===== FSM 정의 ===== */
+#define ST_AUTO         (STATE_READ_ECHO + 1)
+#define ST_SWEEP        (STATE_READ_ECHO + 2)
+#define ST_ROOT         (STATE_READ_ECHO + 3)
+#define ST_COUNT        (STATE_READ_ECHO + 4)
+#define ST_NONE         0xFF    // 전이 표: 내부 전이 / 상태 표: 부모 없음
+#define ST_MAX_DEPTH    4       // SCAN → SWEEP → AUTO → ROOT
+
+#define SF_RANGE        0x01    // 초음파 새 샘플마다 EV_RANGE
+
+typedef uint8_t (*FsmGuard_t)(void);
+typedef void    (*FsmAction_t)(void);
+
+typedef struct {
+    uint8_t     event;
+    FsmGuard_t  guard;      // NULL = 항상
+    FsmAction_t action;     // NULL = 없음
+    uint8_t     target;     // ST_NONE = 내부 전이 (exit/entry 없이 동작만)
+} FsmRow_t;
+
+typedef struct {
+    const char     *name;
+    uint8_t         parent;
+    uint8_t         flags;
+    FsmAction_t     entry;
+    FsmAction_t     exit;
+    const FsmRow_t *rows;
+    uint8_t         nrows;
+} FsmState_t;
+
+typedef struct {
+    uint8_t  ev;
+    uint32_t cyc;
+} FsmEvent_t;
+
+#define EVQ_MASK        (ROBOT_EVQ_SIZE - 1)
+#define TRACE_MASK      (ROBOT_TRACE_SIZE - 1)
+
+static uint8_t cur = STATE_IDLE;
+
+static FsmEvent_t evq[ROBOT_EVQ_SIZE];
+static volatile uint8_t  evq_head = 0;     // 쓰기 (Post, 인터럽트 막고)
+static volatile uint8_t  evq_tail = 0;     // 읽기 (Run, 메인 전용)
+static volatile uint32_t evq_dropped = 0;
+
+static uint32_t tmr_start = 0;
+static uint32_t tmr_ms = 0;
+static uint8_t  tmr_armed = 0;
+
+static RobotTrace_t trace[ROBOT_TRACE_SIZE];
+static uint32_t     trace_head = 0;
+
+/* ===== 타이머 (상태가 바뀌면 자동 취소) ===== */
+
+static void Timer_Arm(uint32_t ms)
 {
-    currentState = STATE_IDLE;
+    tmr_start = HAL_GetTick();
+    tmr_ms = ms;
+    tmr_armed = 1;
 }
 
-void RobotState_Set(RobotState_t state)
+/* ===== 조건 (guard) ===== */
+
+static uint8_t G_Auto(void)        { return start_flag; }
+static uint8_t G_PathClear(void)   { return !ScanMap_FrontBlocked(); }
+
+/* 최소 샘플이 서로 맞으면 바로, 어긋나면 필터 창(ULTRA_FILTER_N)이 찰 때까지 */
+static uint8_t G_Enough(void)
 {
-    currentState = state;
+    if (range.samples >= ULTRA_FILTER_N) return 1;
+    return range.samples >= SCAN_ECHO_SAMPLES && range.confidence >= SCAN_ECHO_CONF;
+}
+
+static uint8_t G_SweepEnd(void)
+{
+    int16_t next = (int16_t)scan_angle + scan_dir * SERVO_STEP_ANGLE;
+    return next >= SERVO_MAX_ANGLE || next <= SERVO_MIN_ANGLE;
+}
+
+static uint8_t G_EnoughAtEnd(void) { return G_Enough() && G_SweepEnd(); }
+
+/* ===== 명령 (ROOT 전이 동작) ===== */
+
+static void Cmd_Start(void)
+{
+    start_flag  = 1;
+    manual_mode = 0;
+    ScanMap_Clear();            // 정지해 있던 동안의 지도는 믿을 수 없음
+    Buzzer_PlayStart();
+    printf("AUTO MODE START\r\n");
+}
+
+static void Cmd_Stop(void)
+{
+    start_flag  = 0;
+    manual_mode = 0;
+    Motor_Stop();
+    Buzzer_PlayStop();
+    printf("STOP\r\n");
+    manual_command = 0;
+}
+
+static void Cmd_Manual(uint8_t command)
+{
+    manual_mode = 1;
+    start_flag  = 0;
+    manual_command = command;
+}
+
+static void Cmd_Forward(void) { Cmd_Manual(1); Buzzer_PlayOk();    printf("MANUAL: FORWARD\r\n"); }
+static void Cmd_Back(void)    { Cmd_Manual(2); Buzzer_PlayElise(); printf("MANUAL: BACKWARD\r\n"); }
+static void Cmd_Left(void)    { Cmd_Manual(3); Buzzer_PlayOk();    printf("MANUAL: LEFT\r\n"); }
+static void Cmd_Right(void)   { Cmd_Manual(4); Buzzer_PlayOk();    printf("MANUAL: RIGHT\r\n"); }
+
+/* ===== IDLE ===== */
+
+static void Idle_ArmPing(void)
+{
+    Timer_Arm(20000 + (rand() % 60000));    // 20~60초마다 핑
+}
+
+static void Idle_Entry(void)
+{
+    RGB_Off();
+    Anim_Set(EXPR_NEUTRAL);
+    Idle_ArmPing();
+}
+
+static void Idle_Ping(void)
+{
+    Buzzer_PlayPing();
+    Idle_ArmPing();
+}
+
+/* ===== SWEEP (SCAN → WAIT_ECHO → READ_ECHO 반복) ===== */
+
+static void Sweep_Entry(void)
+{
+    RGB_Set(RGB_COLOR_GREEN);
+    Anim_Set(EXPR_LOOK_LEFT);
+}
+
+static void Sweep_Exit(void)
+{
+    servo_moving = 0;   // 서보 이동 중에 빠져나가도 애니메이션이 멈춰 있지 않게
+}
+
+static void Scan_Entry(void)
+{
+    uint32_t now = HAL_GetTick();
+
+    if (now - debug_tick > DEBUG_PRINT_MS)
+    {
+        debug_tick = now;
+        printf("angle=%3d | dist=%3d cm\r\n", last_angle, last_valid_dist);
+    }
+
+    uint32_t since = now - last_scan_tick;
+    Timer_Arm(since >= SCAN_STEP_MS ? 0 : SCAN_STEP_MS - since);
+}
+
+static void Scan_Step(void)
+{
+    last_scan_tick = HAL_GetTick();
+
+    Servo_SetAngle(scan_angle);
+    servo_moving = 1;
+}
+
+static void WaitEcho_Entry(void)
+{
+    Timer_Arm(SERVO_SETTLE_MS);
+}
+
+static void WaitEcho_Done(void)
+{
+    servo_moving = 0;       // 서보 안정화 완료
+    Ultrasonic_Restart();   // 이 각도에서 들어오는 샘플만 사용 (트리거는 TIM2가 60ms마다)
+}
+
+static void ReadEcho_Entry(void)
+{
+    Timer_Arm(SCAN_ECHO_TIMEOUT_MS);    // 샘플이 안 들어와도 다음 각도로
+}
+
+static void Scan_Record(void)
+{
+    if (range.samples >= SCAN_ECHO_SAMPLES)     // 타임아웃에 샘플이 모자라면 지도에 반영 안 함
+    {
+        if (range.cm != ULTRA_NO_ECHO)
+        {
+            last_valid_dist = range.cm;
+            g_distance = range.cm;
+        }
+
+        if (ScanMap_Update(scan_angle, range.cm))
+            RobotState_Post(EV_OBSTACLE);   // 스윕 끝을 기다리지 않고 바로 판단
+    }
+
+    last_angle = scan_angle;
+    scan_angle += scan_dir * SERVO_STEP_ANGLE;
+
+    if (scan_angle >= SERVO_MAX_ANGLE)
+    {
+        scan_angle = SERVO_MAX_ANGLE;
+        scan_dir = -1;
+    }
+    else if (scan_angle <= SERVO_MIN_ANGLE)
+    {
+        scan_angle = SERVO_MIN_ANGLE;
+        scan_dir = 1;
+    }
+}
+
+/* ===== DECIDE / MOVE / ALERT ===== */
+
+static void Decide_Log(const char *result)
+{
+    printf("STATE:DECIDE | angle=%d | blocked=0x%04X -> %s\r\n", last_angle, ScanMap_BlockedMask(), result);
+}
+
+static void Decide_Entry(void)
+{
+    RGB_Set(RGB_COLOR_ORANGE);
+    RobotState_Post(EV_DONE);   // 판단은 같은 Run 안에서 바로 (로그는 모터 명령 뒤에)
+}
+
+static void Move_Entry(void)
+{
+    RGB_Set(RGB_COLOR_GREEN);
+    Anim_Set(EXPR_HAPPY);
+
+    if (start_flag)                 Motor_Forward();
+    else if (manual_command == 3)   Motor_Left();
+    else if (manual_command == 4)   Motor_Right();
+    else                            Motor_Forward();
+
+    if (start_flag)
+        Decide_Log("MOVE");
+
+    RobotState_Post(EV_DONE);       // 자동이면 바로 다음 스캔
+}
+
+static void Alert_Entry(void)
+{
+    if (ScanMap_TurnSide() < 0) Motor_Left();
+    else Motor_Right();
+
+    RGB_Set(RGB_COLOR_RED);
+    Anim_Set(EXPR_ANGRY);
+    Buzzer_PlayAlert();
+    Timer_Arm(ALERT_TURN_MS);
+
+    Decide_Log("ALERT");
+}
+
+static void Alert_Done(void)
+{
+    Motor_Stop();
+    ScanMap_Clear();    // 돌았으니 이전 지도는 방향이 틀림
+}
+
+/* ===== REVERSE (수동 후진, LED 깜빡임) ===== */
+
+static void Reverse_Entry(void)
+{
+    Anim_Set(EXPR_SAD);
+    Motor_Backward();
+    RGB_PlayEffect(LEDFX_FX_REVERSE);  // 주황 250ms 깜빡임 - TIM4 인터럽트가 재생 (다음 상태의 RGB_Set이 멈춤)
+}
+
+/* ===== 전이 표 ===== */
+#define ROWS(r)     r, (uint8_t)(sizeof(r) / sizeof(r[0]))
+
+static const FsmRow_t rows_root[] = {
+    { EV_START,   NULL, Cmd_Start,   STATE_SCAN    },
+    { EV_STOP,    NULL, Cmd_Stop,    STATE_IDLE    },
+    { EV_FORWARD, NULL, Cmd_Forward, STATE_MOVE    },
+    { EV_BACK,    NULL, Cmd_Back,    STATE_REVERSE },
+    { EV_LEFT,    NULL, Cmd_Left,    STATE_MOVE    },
+    { EV_RIGHT,   NULL, Cmd_Right,   STATE_MOVE    },
+};
+
+static const FsmRow_t rows_idle[] = {
+    { EV_TIMEOUT, NULL, Idle_Ping, ST_NONE },
+};
+
+static const FsmRow_t rows_sweep[] = {
+    { EV_OBSTACLE, NULL, NULL, STATE_DECIDE },
+};
+
+static const FsmRow_t rows_scan[] = {
+    { EV_TIMEOUT, NULL, Scan_Step, STATE_WAIT_ECHO },
+};
+
+static const FsmRow_t rows_wait_echo[] = {
+    { EV_TIMEOUT, NULL, WaitEcho_Done, STATE_READ_ECHO },
+};
+
+static const FsmRow_t rows_read_echo[] = {
+    { EV_RANGE,   G_EnoughAtEnd, Scan_Record, STATE_DECIDE },
+    { EV_RANGE,   G_Enough,      Scan_Record, STATE_SCAN   },
+    { EV_TIMEOUT, G_SweepEnd,    Scan_Record, STATE_DECIDE },
+    { EV_TIMEOUT, NULL,          Scan_Record, STATE_SCAN   },
+};
+
+static const FsmRow_t rows_decide[] = {
+    { EV_DONE, G_PathClear, NULL, STATE_MOVE  },
+    { EV_DONE, NULL,        NULL, STATE_ALERT },
+};
+
+static const FsmRow_t rows_move[] = {
+    { EV_DONE, G_Auto, NULL, STATE_SCAN },
+};
+
+static const FsmRow_t rows_alert[] = {
+    { EV_TIMEOUT, NULL, Alert_Done, STATE_SCAN },
+};
+
+static const FsmState_t states[ST_COUNT] = {
+    /*                  name         parent    flags     entry           exit        rows */
+    [STATE_IDLE]      = { "IDLE",      ST_ROOT,  0,        Idle_Entry,     NULL,       ROWS(rows_idle)      },
+    [STATE_SCAN]      = { "SCAN",      ST_SWEEP, 0,        Scan_Entry,     NULL,       ROWS(rows_scan)      },
+    [STATE_WAIT_ECHO] = { "WAIT_ECHO", ST_SWEEP, 0,        WaitEcho_Entry, NULL,       ROWS(rows_wait_echo) },
+    [STATE_DECIDE]    = { "DECIDE",    ST_AUTO,  0,        Decide_Entry,   NULL,       ROWS(rows_decide)    },
+    [STATE_MOVE]      = { "MOVE",      ST_ROOT,  0,        Move_Entry,     NULL,       ROWS(rows_move)      },
+    [STATE_REVERSE]   = { "REVERSE",   ST_ROOT,  0,        Reverse_Entry,  NULL,       NULL, 0              },
+    [STATE_ALERT]     = { "ALERT",     ST_AUTO,  0,        Alert_Entry,    NULL,       ROWS(rows_alert)     },
+    [STATE_READ_ECHO] = { "READ_ECHO", ST_SWEEP, SF_RANGE, ReadEcho_Entry, NULL,       ROWS(rows_read_echo) },
+    [ST_AUTO]         = { "AUTO",      ST_ROOT,  0,        NULL,           NULL,       NULL, 0              },
+    [ST_SWEEP]        = { "SWEEP",     ST_AUTO,  0,        Sweep_Entry,    Sweep_Exit, ROWS(rows_sweep)     },
+    [ST_ROOT]         = { "ROOT",      ST_NONE,  0,        NULL,           NULL,       ROWS(rows_root)      },
+};
+
+/* ===== FSM 엔진 ===== */
+
+static void Trace_Record(const FsmEvent_t *e, uint8_t from, uint8_t flags)
+{
+    RobotTrace_t *t = &trace[trace_head & TRACE_MASK];
+    t->cyc = Time_Cycles();
+    t->post_cyc = e->cyc;
+    t->event = e->ev;
+    t->from = from;
+    t->to = cur;
+    t->flags = flags;
+    trace_head++;
+}
+
+/**
+ * @brief 외부 전이: 공통 조상까지 exit → 동작 → 목표까지 entry
+ */
+static void Transition(uint8_t target, FsmAction_t action)
+{
+    uint8_t path[ST_MAX_DEPTH];     // 목표 → ROOT
+    uint8_t depth = 0;
+    for (uint8_t s = target; s != ST_NONE && depth < ST_MAX_DEPTH; s = states[s].parent)
+        path[depth++] = s;
+
+    tmr_armed = 0;
+
+    /* 목표 경로에 있는 상위 상태를 만날 때까지 exit (자기 자신으로 가는 전이는 한 번 나갔다 들어옴) */
+    uint8_t lca = depth;
+    for (uint8_t s = cur; s != ST_NONE; s = states[s].parent)
+    {
+        if (s != target)
+        {
+            uint8_t k = 0;
+            while (k < depth && path[k] != s) k++;
+            if (k < depth) { lca = k; break; }
+        }
+        if (states[s].exit) states[s].exit();
+    }
+
+    if (action) action();
+
+    cur = target;
+    while (lca-- > 0)
+        if (states[path[lca]].entry) states[path[lca]].entry();
+}
+
+static void Dispatch(const FsmEvent_t *e)
+{
+    for (uint8_t s = cur; s != ST_NONE; s = states[s].parent)
+    {
+        const FsmState_t *st = &states[s];
+        for (uint8_t i = 0; i < st->nrows; i++)
+        {
+            const FsmRow_t *r = &st->rows[i];
+            if (r->event != e->ev) continue;
+            if (r->guard && !r->guard()) continue;
+
+            uint8_t from = cur;
+            if (r->target == ST_NONE)
+            {
+                if (r->action) r->action();
+                Trace_Record(e, from, ROBOT_TRACE_INTERNAL);
+            }
+            else
+            {
+                Transition(r->target, r->action);
+                Trace_Record(e, from, 0);
+            }
+            return;
+        }
+    }
+    /* 어느 표에도 없으면 무시 (기록 안 함) */
+}
+
+/* ===== 외부 API ===== */
+
+void RobotState_Init(void)
+{
+    evq_head = evq_tail = 0;
+    trace_head = 0;
+    tmr_armed = 0;
+
+    ScanMap_Init();
+
+    cur = STATE_IDLE;
+    Idle_Entry();
 }
 
-/* ★ 이 함수가 없어서 에러 난 거임 */
 RobotState_t RobotState_Get(void)
 {
-    return currentState;
+    return (RobotState_t)cur;
+}
+
+const char *RobotState_Name(RobotState_t state)
+{
+    return (state < ST_COUNT) ? states[state].name : "UNKNOWN";
+}
+
+/**
+ * @brief 이벤트 넣기 - 큐 진입 시각(DWT)도 같이 저장
+ * @return 1 = 성공, 0 = 큐 가득 (버림)
+ */
+uint8_t RobotState_Post(RobotEvent_t ev)
+{
+    uint8_t ok = 0;
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+
+    if ((uint8_t)(evq_head - evq_tail) < ROBOT_EVQ_SIZE)
+    {
+        evq[evq_head & EVQ_MASK].ev = (uint8_t)ev;
+        evq[evq_head & EVQ_MASK].cyc = Time_Cycles();
+        evq_head++;
+        ok = 1;
+    }
+    else
+    {
+        evq_dropped++;
+    }
+
+    __set_PRIMASK(primask);
+    return ok;
+}
+
+/**
+ * @brief 상태기계 1회 (스케줄러 태스크) - 타이머/초음파 확인 후 큐가 빌 때까지 처리
+ */
+void RobotState_Run(void)
+{
+    if (tmr_armed && HAL_GetTick() - tmr_start >= tmr_ms)
+    {
+        tmr_armed = 0;
+        RobotState_Post(EV_TIMEOUT);
+    }
+
+    if (states[cur].flags & SF_RANGE)
+    {
+        Ultrasonic_GetRange(&range);
+        if (range.seq != range_seq)
+        {
+            range_seq = range.seq;
+            RobotState_Post(EV_RANGE);
+        }
+    }
+
+    /* 진입 동작이 넣은 완료 이벤트까지 이번에 처리 (한 번에 큐 크기까지만) */
+    for (uint8_t n = 0; n < ROBOT_EVQ_SIZE && evq_tail != evq_head; n++)
+    {
+        FsmEvent_t e = evq[evq_tail & EVQ_MASK];
+        evq_tail++;
+        Dispatch(&e);
+    }
+}
+
+/**
+ * @brief 전이 기록 복사 (오래된 것부터)
+ * @return 복사한 개수
+ */
+uint16_t RobotState_GetTrace(RobotTrace_t *out, uint16_t max)
+{
+    uint32_t n = (trace_head < ROBOT_TRACE_SIZE) ? trace_head : ROBOT_TRACE_SIZE;
+    if (n > max) n = max;
+
+    for (uint32_t i = 0; i < n; i++)
+        out[i] = trace[(trace_head - n + i) & TRACE_MASK];
+
+    return (uint16_t)n;
+}
+
+uint32_t RobotState_GetDropped(void)
+{
+    return evq_dropped;
 }
@@ -0,0 +1,157 @@
+/**
+ * @file scan_map.c
+ * @brief 서보 스윕 극좌표 장애물 지도
+ *
+ * 동작:
+ * 1. 서보 한 칸(SERVO_STEP_ANGLE)마다 칸 1개 {거리, 신뢰도, 갱신 시각}
+ *    → 스윕 방향과 상관없이 측정할 때마다 그 칸만 갱신 (스윕을 처음부터 다시 할 필요 없음)
+ * 2. 신뢰도: 이전 값과 비슷하면 +1, 다르면 1부터 다시, 에코 없음이면 -1 (0 = 모름)
+ *    → 막힘은 측정 1번으로 바로 (초음파 드라이버가 이미 중앙값 필터),
+ *      풀림은 같은 물체를 여러 번 본 칸일수록 늦게 (에코 한 번 빠져도 안 풀림)
+ * 3. 칸이 바뀔 때마다 막힘 비트마스크를 같이 고침
+ *    → 정면 판단/회전 방향은 마스크 AND/비트 수 세기로 끝 (칸 수와 무관)
+ * 4. 오래된 칸은 측정 1번마다 1칸씩 돌아가며 확인해서 지움 (13칸 → 약 1.3초에 한 바퀴)
+ *
+ * 지도는 로봇 좌표계 기준이라 회전하면 틀어짐 → 회피 회전 뒤 ScanMap_Clear()
+ */
+
+#include <stdio.h>
+#include "scan_map.h"
+#include "main.h"
+#include "drivers/ultrasonic.h"
+
+#define BIN_OF(angle)   (((angle) - SERVO_MIN_ANGLE) / SERVO_STEP_ANGLE)
+#define BITS(lo, hi)    ((uint16_t)(((1u << ((hi) + 1)) - 1u) & ~((1u << (lo)) - 1u)))
+
+#define CENTER_BIN      BIN_OF(SERVO_CENTER_ANGLE)
+#define CONE_MASK       BITS(BIN_OF(SERVO_CENTER_ANGLE - MAP_CONE_DEG), BIN_OF(SERVO_CENTER_ANGLE + MAP_CONE_DEG))
+#define LOW_MASK        BITS(0, CENTER_BIN - 1)
+#define HIGH_MASK       BITS(CENTER_BIN + 1, MAP_BINS - 1)
+
+#if SERVO_CENTER_ANGLE - MAP_CONE_DEG < SERVO_MIN_ANGLE || SERVO_CENTER_ANGLE + MAP_CONE_DEG > SERVO_MAX_ANGLE
+#error "MAP_CONE_DEG가 서보 스윕 범위를 넘음"
+#endif
+
+static ScanBin_t bins[MAP_BINS];
+static uint16_t  blocked = 0;       // bit i = bins[i] 막힘
+static uint8_t   expire_idx = 0;
+
+/* ===== 내부 ===== */
+
+static uint8_t Is_Blocked(const ScanBin_t *b)
+{
+    return b->conf > 0 && b->cm <= DIST_SAFE;
+}
+
+static void Bin_Forget(uint8_t idx)
+{
+    bins[idx].cm = ULTRA_NO_ECHO;
+    bins[idx].conf = 0;
+    blocked &= (uint16_t)~(1u << idx);
+}
+
+static void Expire_One(uint32_t now)
+{
+    uint8_t i = expire_idx;
+    expire_idx = (uint8_t)((i + 1) % MAP_BINS);
+
+    if (bins[i].conf && now - bins[i].tick > MAP_MAX_AGE_MS)
+        Bin_Forget(i);
+}
+
+/* ===== 외부 API ===== */
+
+void ScanMap_Init(void)
+{
+    ScanMap_Clear();
+    expire_idx = 0;
+}
+
+void ScanMap_Clear(void)
+{
+    for (uint8_t i = 0; i < MAP_BINS; i++)
+    {
+        Bin_Forget(i);
+        bins[i].tick = 0;
+    }
+}
+
+/**
+ * @brief 한 각도의 측정값 반영
+ * @param angle 서보 각도 (SERVO_MIN_ANGLE..SERVO_MAX_ANGLE)
+ * @param cm    거리, ULTRA_NO_ECHO = 에코 없음(앞이 비어 있음)
+ * @return 1 = 이 칸이 정면 범위 안에서 막힘 (바로 판단할 것)
+ */
+uint8_t ScanMap_Update(uint8_t angle, uint16_t cm)
+{
+    if (angle < SERVO_MIN_ANGLE || angle > SERVO_MAX_ANGLE) return 0;
+
+    uint8_t idx = (uint8_t)BIN_OF(angle + SERVO_STEP_ANGLE / 2);
+    uint32_t now = HAL_GetTick();
+    ScanBin_t *b = &bins[idx];
+
+    if (cm == ULTRA_NO_ECHO)
+    {
+        if (b->conf) b->conf--;
+        if (b->conf == 0) b->cm = ULTRA_NO_ECHO;
+    }
+    else if (b->conf && (cm > b->cm ? cm - b->cm : b->cm - cm) <= MAP_AGREE_CM)
+    {
+        b->cm = cm;
+        if (b->conf < MAP_CONF_MAX) b->conf++;
+    }
+    else
+    {
+        b->cm = cm;
+        b->conf = 1;
+    }
+    b->tick = now;
+
+    uint16_t bit = (uint16_t)(1u << idx);
+    if (Is_Blocked(b)) blocked |= bit;
+    else blocked &= (uint16_t)~bit;
+
+    Expire_One(now);
+
+    return (blocked & bit & CONE_MASK) != 0;
+}
+
+uint8_t ScanMap_FrontBlocked(void)
+{
+    return (blocked & CONE_MASK) != 0;
+}
+
+/**
+ * @brief 회피 방향 - 막힌 칸이 더 많은 쪽 (같으면 +1)
+ */
+int8_t ScanMap_TurnSide(void)
+{
+    int low  = __builtin_popcount(blocked & LOW_MASK);
+    int high = __builtin_popcount(blocked & HIGH_MASK);
+    return (low > high) ? -1 : 1;
+}
+
+uint16_t ScanMap_BlockedMask(void)
+{
+    return blocked;
+}
+
+const ScanBin_t *ScanMap_Bin(uint8_t idx)
+{
+    return (idx < MAP_BINS) ? &bins[idx] : NULL;
+}
+
+void ScanMap_Print(void)
+{
+    uint32_t now = HAL_GetTick();
+
+    printf("angle  cm   conf age_ms  (blocked=0x%04X cone=0x%04X)\r\n", blocked, CONE_MASK);
+    for (uint8_t i = 0; i < MAP_BINS; i++)
+    {
+        const ScanBin_t *b = &bins[i];
+        printf("%3d    %-4u %-4u %-6lu %s\r\n",
+               SERVO_MIN_ANGLE + i * SERVO_STEP_ANGLE, b->cm, b->conf,
+               b->conf ? (unsigned long)(now - b->tick) : 0UL,
+               (blocked >> i) & 1 ? "X" : "");
+    }
+}
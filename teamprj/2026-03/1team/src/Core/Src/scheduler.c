@@ -0,0 +1,157 @@
+/**
+ * @file scheduler.c
+ * @brief 협조형(cooperative) 데드라인 스케줄러
+ *
+ * 동작:
+ * 1. 태스크마다 주기(period)와 실행 예산(budget)을 등록
+ * 2. 릴리스 시각이 지난 태스크 중 데드라인(릴리스 + 주기)이 가장 이른 것 1개 실행 (EDF)
+ * 3. 실행이 끝나면 다음 릴리스 = 이전 릴리스 + 주기 (위상 유지, 드리프트 없음)
+ *    한 주기 이상 밀렸으면 그만큼 건너뛰고 missed에 기록
+ * 4. 릴리스 → 시작 지연(지터), 실행 시간, 예산 초과를 태스크별로 누적
+ *
+ * 선점이 없으므로 어떤 태스크의 최악 응답 지연 = 가장 긴 다른 태스크의 실행 시간 + 자기 주기
+ * → Sched_PrintStats()의 max exec / max late 로 바로 확인 가능
+ *
+ * 시간: timebase.c의 Time_Now_us() (DWT 사이클 누적, 다른 모듈과 같은 시계)
+ */
+
+#include <stdio.h>
+#include "scheduler.h"
+#include "timebase.h"
+#if SCHED_IDLE_WFI
+#include "main.h"           // __WFI (CMSIS)
+#endif
+
+typedef struct {
+    const char  *name;
+    SchedFn_t    fn;
+    uint32_t     period_us;
+    uint32_t     budget_us;
+    uint32_t     release_us;    // 다음 릴리스 시각
+    SchedStats_t stats;
+} SchedTask_t;
+
+static SchedTask_t tasks[SCHED_MAX_TASKS];
+static uint8_t     task_count = 0;
+
+/* ===== 외부 API ===== */
+
+void Sched_Init(void)
+{
+    task_count = 0;
+}
+
+/**
+ * @brief 태스크 등록
+ * @param period_ms 주기 (1 이상)
+ * @param budget_us 1회 실행 예산 (넘으면 overruns 증가, 실행은 계속)
+ * @return 태스크 id, 가득 찼으면 -1
+ */
+int8_t Sched_Add(const char *name, SchedFn_t fn, uint16_t period_ms, uint32_t budget_us)
+{
+    if (task_count >= SCHED_MAX_TASKS || fn == NULL) return -1;
+    if (period_ms == 0) period_ms = 1;
+
+    SchedTask_t *t = &tasks[task_count];
+    t->name = name;
+    t->fn = fn;
+    t->period_us = (uint32_t)period_ms * 1000u;
+    t->budget_us = budget_us;
+    t->release_us = Time_Now_us();
+    t->stats = (SchedStats_t){ 0 };
+
+    return (int8_t)task_count++;
+}
+
+void Sched_Start(void)
+{
+    uint32_t now = Time_Now_us();
+    for (uint8_t i = 0; i < task_count; i++)
+        tasks[i].release_us = now;
+}
+
+/**
+ * @brief 스케줄러 1회 (메인 루프에서 계속 호출)
+ */
+void Sched_RunOnce(void)
+{
+    uint32_t now = Time_Now_us();
+    SchedTask_t *pick = NULL;
+    uint32_t pick_deadline = 0;
+
+    for (uint8_t i = 0; i < task_count; i++)
+    {
+        SchedTask_t *t = &tasks[i];
+        if ((int32_t)(now - t->release_us) < 0) continue;   // 아직 릴리스 전
+
+        uint32_t deadline = t->release_us + t->period_us;
+        if (pick == NULL || (int32_t)(deadline - pick_deadline) < 0)
+        {
+            pick = t;
+            pick_deadline = deadline;
+        }
+    }
+
+    if (pick == NULL)
+    {
+#if SCHED_IDLE_WFI
+        __WFI();
+#endif
+        return;
+    }
+
+    uint32_t late = now - pick->release_us;
+    pick->fn();
+    uint32_t end = Time_Now_us();
+    uint32_t exec = end - now;
+
+    SchedStats_t *s = &pick->stats;
+    s->runs++;
+    s->sum_late_us += late;
+    if (late > s->max_late_us) s->max_late_us = late;
+    if (exec > s->max_exec_us) s->max_exec_us = exec;
+    if (exec > pick->budget_us) s->overruns++;
+
+    /* 다음 릴리스 (한 주기 이상 밀렸으면 건너뜀) */
+    pick->release_us += pick->period_us;
+    uint32_t behind = end - pick->release_us;
+    if ((int32_t)behind >= (int32_t)pick->period_us)
+    {
+        uint32_t skip = behind / pick->period_us;
+        pick->release_us += skip * pick->period_us;
+        s->missed += skip;
+    }
+}
+
+void Sched_GetStats(uint8_t id, SchedStats_t *out)
+{
+    if (id < task_count)
+        *out = tasks[id].stats;
+}
+
+void Sched_ResetStats(void)
+{
+    for (uint8_t i = 0; i < task_count; i++)
+        tasks[i].stats = (SchedStats_t){ 0 };
+}
+
+/**
+ * @brief 태스크별 통계 출력 (UART printf)
+ */
+void Sched_PrintStats(void)
+{
+    printf("task     period  budget | runs     exec_max  late_max  late_avg | over  miss\r\n");
+    for (uint8_t i = 0; i < task_count; i++)
+    {
+        SchedTask_t *t = &tasks[i];
+        SchedStats_t *s = &t->stats;
+        uint32_t avg = s->runs ? s->sum_late_us / s->runs : 0;
+
+        printf("%-8s %4lums %6luus | %-8lu %6luus  %6luus  %6luus | %-5lu %lu\r\n",
+               t->name,
+               (unsigned long)(t->period_us / 1000u), (unsigned long)t->budget_us,
+               (unsigned long)s->runs,
+               (unsigned long)s->max_exec_us, (unsigned long)s->max_late_us, (unsigned long)avg,
+               (unsigned long)s->overruns, (unsigned long)s->missed);
+    }
+}
@@ -22,6 +22,8 @@
 #include "stm32f1xx_it.h"
 /* Private includes ----------------------------------------------------------*/
 /* USER CODE BEGIN Includes */
+#include "drivers/uart_link.h"
+#include "timebase.h"
 /* USER CODE END Includes */
 
 /* Private typedef -----------------------------------------------------------*/
@@ -58,11 +60,14 @@
 extern DMA_HandleTypeDef hdma_spi2_tx;
 extern TIM_HandleTypeDef htim2;
 extern DMA_HandleTypeDef hdma_usart2_rx;
+extern DMA_HandleTypeDef hdma_usart2_tx;
 extern DMA_HandleTypeDef hdma_usart3_rx;
+extern DMA_HandleTypeDef hdma_tim3_ch3;
 extern UART_HandleTypeDef huart2;
 extern UART_HandleTypeDef huart3;
 extern SPI_HandleTypeDef hspi2;
 /* USER CODE BEGIN EV */
+extern I2C_HandleTypeDef hi2c1;
 void SPI2_IRQHandler(void)
 {
     HAL_SPI_IRQHandler(&hspi2);
@@ -255,6 +260,7 @@ void TIM2_IRQHandler(void)
 void USART2_IRQHandler(void)
 {
   /* USER CODE BEGIN USART2_IRQn 0 */
+  Link_IRQ(&huart2);
 
   /* USER CODE END USART2_IRQn 0 */
   HAL_UART_IRQHandler(&huart2);
@@ -264,6 +270,14 @@ void USART2_IRQHandler(void)
 }
 
 /* USER CODE BEGIN 1 */
+/**
+  * @brief This function handles DMA1 channel2 global interrupt (buzzer TIM3_CH3 burst).
+  */
+void DMA1_Channel2_IRQHandler(void)
+{
+  HAL_DMA_IRQHandler(&hdma_tim3_ch3);
+}
+
 /**
   * @brief This function handles DMA1 channel3 global interrupt.
   */
@@ -277,6 +291,39 @@ void DMA1_Channel3_IRQHandler(void)
   */
 void USART3_IRQHandler(void)
 {
+  Link_IRQ(&huart3);
   HAL_UART_IRQHandler(&huart3);
 }
+
+/**
+  * @brief This function handles I2C1 event interrupt.
+  */
+void I2C1_EV_IRQHandler(void)
+{
+  HAL_I2C_EV_IRQHandler(&hi2c1);
+}
+
+/**
+  * @brief This function handles I2C1 error interrupt.
+  */
+void I2C1_ER_IRQHandler(void)
+{
+  HAL_I2C_ER_IRQHandler(&hi2c1);
+}
+
+/**
+  * @brief This function handles DMA1 channel7 global interrupt (USART2_TX, profiling stream).
+  */
+void DMA1_Channel7_IRQHandler(void)
+{
+  HAL_DMA_IRQHandler(&hdma_usart2_tx);
+}
+
+/**
+  * @brief This function handles TIM4 global interrupt (timebase one-shot).
+  */
+void TIM4_IRQHandler(void)
+{
+  Time_IRQ();
+}
 /* USER CODE END 1 */
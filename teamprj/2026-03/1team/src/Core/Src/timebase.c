@@ -0,0 +1,458 @@
+/**
+ * @file timebase.c
+ * @brief 공용 us 시간축 - DWT 사이클 카운터 + TIM4 원샷 타이머
+ *
+ * 동작:
+ * 1. Time_Now_us(): DWT CYCCNT 증가분을 us로 누적 (나머지 사이클은 다음 호출로 넘김 → 드리프트 없음)
+ *    - 인터럽트를 잠깐 막고 갱신하므로 ISR에서도 호출 가능
+ *    - CYCCNT는 64MHz에서 67초마다 한 바퀴 → 스케줄러가 매 루프 부르므로 문제 없음
+ * 2. Time_Oneshot(): TIM4를 1MHz 자유 카운터로 돌리고, 가장 이른 원샷 시각에 CC1 비교 인터럽트
+ *    - 16비트라 50ms 넘게 남았으면 중간에 한 번 깨어나서 다시 맞춤
+ *    - 콜백은 인터럽트 컨텍스트 → 짧게 (플래그/이벤트 Post 정도)
+ *    → 수백 us 대기를 바쁜 루프로 태우지 않고 예약
+ * 3. Time_EdgeStart(): TIM4 CC2/CC3를 콜백이 돌려준 간격만큼 계속 앞으로 옮김 (스트림마다 사용자 1명)
+ *    - TIME_EDGE_MOTOR = CC2 (모터 소프트 PWM), TIME_EDGE_RGB = CC3 (RGB LED 효과)
+ *    - 이전 비교 시각 기준으로 더하므로 인터럽트가 늦어도 주기가 밀리지 않음
+ * 4. Time_CalibrateStart(): SysTick(ms)으로 DWT 주파수를 재서 SystemCoreClock 설정과 비교,
+ *    1% 넘게 다르면 측정값을 사용 (클럭 설정 실수 검출). TIM4 주기, 호출 비용, 원샷 지연도 같이 보고
+ *    - 원샷 콜백이 단계를 이어 가므로 부른 태스크는 기다리지 않음 (SysTick 경계는 10us 원샷으로 찾음)
+ *    - Time_Calibrate(): 부팅용, 시작 후 끝날 때까지 기다림
+ *
+ * 바쁜 대기(Time_Delay_us)는 센서 트리거 펄스처럼 수십 us 이하에만 사용
+ */
+
+#include <stdio.h>
+#include "timebase.h"
+#include "main.h"
+
+#define TIM_MAX_STEP_US     50000   // 16비트 카운터 한 바퀴(65.5ms)보다 짧게
+#define TIM_MIN_STEP_US     2       // 이보다 가까우면 바로 인터럽트
+
+/* 스트림 id → 비교 채널 (0 = CC2, 1 = CC3), SR/DIER/EGR 에서 비트 자리가 같음 */
+#define EDGE_CCR(id)        ((&TIM4->CCR1)[(id) + 1u])
+#define EDGE_BIT(id)        ((uint32_t)TIM_SR_CC1IF << ((id) + 1u))
+
+typedef struct {
+    uint32_t deadline;
+    TimeFn_t fn;
+    void    *arg;
+    uint8_t  active;
+} TimeSlot_t;
+
+static uint32_t cyc_per_us = 64;
+static uint32_t cyc_last = 0;
+static uint32_t cyc_rem  = 0;
+static uint32_t us_now   = 0;
+
+static TimeSlot_t slots[TIME_ONESHOT_SLOTS];
+static TimeEdgeFn_t edge_fn[TIME_EDGE_STREAMS];
+
+/* ===== 내부 함수 ===== */
+
+static uint32_t Tim4_Clock(void)
+{
+    uint32_t hz = HAL_RCC_GetPCLK1Freq();
+    if ((RCC->CFGR & RCC_CFGR_PPRE1) != RCC_CFGR_PPRE1_DIV1)
+        hz *= 2;                        // APB1 분주가 있으면 타이머 클럭은 2배
+    return hz;
+}
+
+/**
+ * @brief 가장 이른 원샷 시각에 CC1 비교 설정 (인터럽트 막힌 상태에서 호출)
+ */
+static void Oneshot_Arm(void)
+{
+    uint8_t  found = 0;
+    uint32_t next = 0;
+    uint32_t now = Time_Now_us();
+
+    for (uint8_t i = 0; i < TIME_ONESHOT_SLOTS; i++)
+    {
+        if (!slots[i].active) continue;
+        if (!found || Time_Diff_us(slots[i].deadline, next) < 0)
+        {
+            next = slots[i].deadline;
+            found = 1;
+        }
+    }
+
+    if (!found)
+    {
+        TIM4->DIER &= ~TIM_DIER_CC1IE;
+        return;
+    }
+
+    int32_t left = Time_Diff_us(next, now);
+    if (left < TIM_MIN_STEP_US)
+    {
+        TIM4->DIER |= TIM_DIER_CC1IE;
+        TIM4->EGR = TIM_EGR_CC1G;       // 이미 지남 → 바로 인터럽트
+        return;
+    }
+    if (left > TIM_MAX_STEP_US) left = TIM_MAX_STEP_US;
+
+    uint16_t ccr = (uint16_t)(TIM4->CNT + (uint32_t)left);
+    TIM4->CCR1 = ccr;
+    TIM4->SR = ~TIM_SR_CC1IF;
+    TIM4->DIER |= TIM_DIER_CC1IE;
+
+    /* 설정하는 사이에 카운터가 지나쳤으면 (남은 값이 left보다 커짐) 바로 인터럽트 */
+    if ((uint16_t)(ccr - TIM4->CNT) > (uint16_t)left)
+        TIM4->EGR = TIM_EGR_CC1G;
+}
+
+/* ===== 외부 API ===== */
+
+void Time_Init(void)
+{
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    cyc_per_us = SystemCoreClock / 1000000u;
+    if (cyc_per_us == 0) cyc_per_us = 1;
+    cyc_last = DWT->CYCCNT;
+    cyc_rem = 0;
+    us_now = 0;
+
+    for (uint8_t i = 0; i < TIME_ONESHOT_SLOTS; i++)
+        slots[i].active = 0;
+    for (uint8_t i = 0; i < TIME_EDGE_STREAMS; i++)
+        edge_fn[i] = NULL;
+
+    /* TIM4: 1MHz 자유 카운터, CC1 = 원샷 비교, CC2/CC3 = 연속 비교 (NVIC는 HAL_MspInit) */
+    __HAL_RCC_TIM4_CLK_ENABLE();
+    TIM4->CR1 = 0;
+    TIM4->PSC = Tim4_Clock() / 1000000u - 1;
+    TIM4->ARR = 0xFFFF;
+    TIM4->CCMR1 = 0;                    // CC1/CC2 = 출력 비교 (핀 출력 없음, 동결)
+    TIM4->CCMR2 = 0;                    // CC3 도 같음
+    TIM4->DIER = 0;
+    TIM4->EGR = TIM_EGR_UG;             // PSC 바로 적용
+    TIM4->SR = 0;
+    TIM4->CR1 = TIM_CR1_CEN;
+}
+
+uint32_t Time_Cycles(void)
+{
+    return DWT->CYCCNT;
+}
+
+uint32_t Time_CyclesToUs(uint32_t cycles)
+{
+    return cycles / cyc_per_us;
+}
+
+uint32_t Time_Now_us(void)
+{
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+
+    uint32_t c = DWT->CYCCNT;
+    uint32_t d = (c - cyc_last) + cyc_rem;
+    cyc_last = c;
+    us_now += d / cyc_per_us;
+    cyc_rem = d % cyc_per_us;
+    uint32_t now = us_now;
+
+    __set_PRIMASK(primask);
+    return now;
+}
+
+void Time_WaitUntil_us(uint32_t deadline_us)
+{
+    while (Time_Diff_us(Time_Now_us(), deadline_us) < 0);
+}
+
+void Time_Delay_us(uint32_t us)
+{
+    /* 사이클로 직접 비교 → 호출 비용 외 오차 없음 (67초 미만) */
+    uint32_t c0 = DWT->CYCCNT;
+    uint32_t n = us * cyc_per_us;
+    while (DWT->CYCCNT - c0 < n);
+}
+
+/**
+ * @brief delay_us 뒤에 fn(arg) 1번 실행 (TIM4 인터럽트 컨텍스트)
+ * @return 원샷 id (Time_Cancel용), 빈 칸 없으면 -1
+ */
+int8_t Time_Oneshot(uint32_t delay_us, TimeFn_t fn, void *arg)
+{
+    int8_t id = -1;
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+
+    for (uint8_t i = 0; i < TIME_ONESHOT_SLOTS; i++)
+    {
+        if (!slots[i].active)
+        {
+            slots[i].deadline = Time_Now_us() + delay_us;
+            slots[i].fn = fn;
+            slots[i].arg = arg;
+            slots[i].active = 1;
+            id = (int8_t)i;
+            Oneshot_Arm();
+            break;
+        }
+    }
+
+    __set_PRIMASK(primask);
+    return id;
+}
+
+void Time_Cancel(int8_t id)
+{
+    if (id < 0 || id >= TIME_ONESHOT_SLOTS) return;
+
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    slots[id].active = 0;
+    Oneshot_Arm();
+    __set_PRIMASK(primask);
+}
+
+/**
+ * @brief first_us 뒤부터 fn()을 부르고, fn이 돌려준 us 뒤에 다시 부름 (TIM4 인터럽트 컨텍스트)
+ * @param id TIME_EDGE_MOTOR / TIME_EDGE_RGB - 같은 id로 다시 부르면 이전 fn을 대신함
+ */
+void Time_EdgeStart(uint8_t id, uint16_t first_us, TimeEdgeFn_t fn)
+{
+    if (id >= TIME_EDGE_STREAMS) return;
+
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+
+    edge_fn[id] = fn;
+    EDGE_CCR(id) = (uint16_t)(TIM4->CNT + (first_us < TIM_MIN_STEP_US ? TIM_MIN_STEP_US : first_us));
+    TIM4->SR = ~EDGE_BIT(id);
+    TIM4->DIER |= EDGE_BIT(id);
+
+    __set_PRIMASK(primask);
+}
+
+void Time_EdgeStop(uint8_t id)
+{
+    if (id >= TIME_EDGE_STREAMS) return;
+
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();                    // DIER은 원샷 인터럽트도 고침
+    TIM4->DIER &= ~EDGE_BIT(id);
+    edge_fn[id] = NULL;
+    __set_PRIMASK(primask);
+}
+
+static void Edge_IRQ(uint8_t id)
+{
+    TIM4->SR = ~EDGE_BIT(id);
+
+    uint16_t d = edge_fn[id] ? edge_fn[id]() : 0;
+    if (d == 0)
+    {
+        Time_EdgeStop(id);
+        return;
+    }
+
+    uint16_t ccr = (uint16_t)(EDGE_CCR(id) + d);
+    EDGE_CCR(id) = ccr;
+    if ((uint16_t)(ccr - TIM4->CNT) > d)
+        TIM4->EGR = EDGE_BIT(id);       // 콜백이 간격보다 오래 걸림 → 바로 다음 호출 (위상은 유지)
+}
+
+/**
+ * @brief TIM4_IRQHandler에서 호출 - CC2/CC3 연속 비교, 시각이 된 원샷 실행 후 다음 것 예약
+ */
+void Time_IRQ(void)
+{
+    uint32_t sr = TIM4->SR & TIM4->DIER;
+
+    for (uint8_t i = 0; i < TIME_EDGE_STREAMS; i++)
+        if (sr & EDGE_BIT(i)) Edge_IRQ(i);
+    if (!(sr & TIM_SR_CC1IF)) return;
+    TIM4->SR = ~TIM_SR_CC1IF;
+
+    uint32_t now = Time_Now_us();
+    for (uint8_t i = 0; i < TIME_ONESHOT_SLOTS; i++)
+    {
+        if (slots[i].active && Time_Diff_us(now, slots[i].deadline) >= 0)
+        {
+            slots[i].active = 0;
+            slots[i].fn(slots[i].arg);
+        }
+    }
+
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    Oneshot_Arm();
+    __set_PRIMASK(primask);
+}
+
+/* ===== 보정 (원샷 콜백이 단계를 이어 감) ===== */
+
+#define CALIB_POLL_US       10      // SysTick 경계를 찾는 원샷 간격 (경계 오차가 이 이하)
+#define CALIB_TIM_MS        10      // TIM4 를 잴 구간 (16비트 한 바퀴 65ms 안)
+
+enum { CAL_IDLE, CAL_EDGE0, CAL_LATE, CAL_TIM, CAL_EDGE1 };
+
+static struct {
+    TimeCalib_t *out;
+    volatile uint8_t step;
+    volatile int8_t  id;    // 걸어 둔 원샷 (취소용)
+    uint32_t tick;          // EDGE0: 시작 때 SysTick, 이후: 시작 경계의 SysTick
+    uint32_t c0, c_tim;     // 시작 경계 / TIM 샘플 때 DWT
+    uint16_t n0, n_tim;     // 같은 순간의 TIM4
+    uint32_t mark_us;       // 200us 원샷을 건 시각
+} cal = { .id = -1 };
+
+static void Calib_Step(void *arg);
+
+static void Calib_Arm(uint32_t delay_us)
+{
+    cal.id = Time_Oneshot(delay_us, Calib_Step, NULL);
+    if (cal.id < 0) cal.step = CAL_IDLE;    // 슬롯이 없으면 그만 (안 잰 값은 0 / -1)
+}
+
+/* DWT 와 TIM4 를 같은 순간에 (SysTick 이 끼어들지 않게) */
+static uint32_t Calib_Sample(uint16_t *tim)
+{
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    uint32_t c = DWT->CYCCNT;
+    *tim = (uint16_t)TIM4->CNT;
+    __set_PRIMASK(primask);
+    return c;
+}
+
+static void Calib_Finish(uint32_t c1)
+{
+    TimeCalib_t *out = cal.out;
+
+    out->measured_hz = (c1 - cal.c0) / TIME_CALIB_MS * 1000u;
+    out->error_ppm = (int32_t)(((int64_t)out->measured_hz - out->core_hz) * 1000000 / out->core_hz);
+
+    /* TIM4 틱 / DWT 사이클 x 측정 클럭 → 틱/ms */
+    uint32_t dc = cal.c_tim - cal.c0;
+    uint64_t ticks = (uint64_t)(uint16_t)(cal.n_tim - cal.n0) * out->measured_hz;
+    out->tim_ticks_per_ms = dc ? (uint32_t)((ticks / 1000u + dc / 2) / dc) : 0;
+
+    /* 1% 넘게 다르면 SystemCoreClock 설정이 틀린 것 → 측정값으로 */
+    if (out->error_ppm > 10000 || out->error_ppm < -10000)
+    {
+        uint32_t primask = __get_PRIMASK();
+        __disable_irq();
+        Time_Now_us();                              // 이전 배율로 지금까지 정산
+        cyc_per_us = (out->measured_hz + 500000u) / 1000000u;
+        if (cyc_per_us == 0) cyc_per_us = 1;
+        __set_PRIMASK(primask);
+    }
+
+    __DMB();                // 결과를 다 쓴 뒤에 완료 표시
+    cal.step = CAL_IDLE;
+}
+
+/**
+ * @brief 보정 단계 (TIM4 인터럽트 컨텍스트) - 경계를 기다릴 때는 CALIB_POLL_US 뒤에 다시 옴
+ */
+static void Calib_Step(void *arg)
+{
+    (void)arg;
+    cal.id = -1;
+    uint32_t now = Time_Now_us();
+
+    switch (cal.step)
+    {
+    case CAL_EDGE0:         // SysTick 이 바뀐 직후를 시작으로
+        if (HAL_GetTick() == cal.tick) { Calib_Arm(CALIB_POLL_US); break; }
+        cal.tick = HAL_GetTick();
+        cal.c0 = Calib_Sample(&cal.n0);
+        cal.mark_us = now;
+        cal.step = CAL_LATE;
+        Calib_Arm(200);
+        break;
+
+    case CAL_LATE:          // 200us 원샷이 늦은 시간
+        cal.out->oneshot_late_us = Time_Diff_us(now, cal.mark_us + 200);
+        cal.step = CAL_TIM;
+        Calib_Arm(CALIB_TIM_MS * 1000u - 200u);
+        break;
+
+    case CAL_TIM:           // TIM4 비율은 끝에서 측정 클럭으로 환산
+        cal.c_tim = Calib_Sample(&cal.n_tim);
+        cal.step = CAL_EDGE1;
+        Calib_Arm((TIME_CALIB_MS - CALIB_TIM_MS - 1u) * 1000u);    // 끝 경계 1ms 앞부터 찾음
+        break;
+
+    case CAL_EDGE1:         // TIME_CALIB_MS 번째 SysTick 경계
+        if (HAL_GetTick() - cal.tick < TIME_CALIB_MS) { Calib_Arm(CALIB_POLL_US); break; }
+        Calib_Finish(DWT->CYCCNT);
+        break;
+
+    default:
+        break;
+    }
+}
+
+/**
+ * @brief 보정 시작 - 호출 비용만 여기서 재고 (수십 us), 나머지는 원샷 콜백으로 약 TIME_CALIB_MS 동안
+ * @param out 끝날 때까지 살아 있어야 함 (static 등), Time_CalibrateBusy() 가 0이 되면 읽음
+ * @return 0, 이미 진행 중이거나 원샷 슬롯이 없으면 -1
+ */
+int8_t Time_CalibrateStart(TimeCalib_t *out)
+{
+    if (cal.step != CAL_IDLE) return -1;
+
+    out->core_hz = SystemCoreClock;
+    out->measured_hz = 0;
+    out->error_ppm = 0;
+    out->tim_ticks_per_ms = 0;
+    out->oneshot_late_us = -1;
+
+    /* 호출 비용 */
+    uint32_t c0 = DWT->CYCCNT;
+    for (uint8_t i = 0; i < 100; i++) Time_Now_us();
+    out->now_cycles = (DWT->CYCCNT - c0) / 100u;
+
+    c0 = DWT->CYCCNT;
+    Time_Delay_us(10);
+    out->delay10_cycles = DWT->CYCCNT - c0;
+
+    cal.out = out;
+    cal.tick = HAL_GetTick();
+    cal.step = CAL_EDGE0;
+    Calib_Arm(CALIB_POLL_US);
+    return cal.step != CAL_IDLE ? 0 : -1;
+}
+
+uint8_t Time_CalibrateBusy(void)
+{
+    return cal.step != CAL_IDLE;
+}
+
+/**
+ * @brief 부팅 보정 - 시작 후 끝날 때까지 기다림 (약 TIME_CALIB_MS) - 인터럽트가 켜진 뒤, 스케줄러 전에 호출
+ */
+void Time_Calibrate(TimeCalib_t *out)
+{
+    if (Time_CalibrateStart(out) < 0) return;
+
+    uint32_t t = HAL_GetTick();
+    while (Time_CalibrateBusy() && HAL_GetTick() - t < TIME_CALIB_MS + 20u);
+
+    if (Time_CalibrateBusy())           // 원샷이 안 울림 (TIM4 문제) → 슬롯을 비우고 안 잰 값은 0 / -1
+    {
+        uint32_t primask = __get_PRIMASK();
+        __disable_irq();
+        if (cal.id >= 0) Time_Cancel(cal.id);
+        cal.id = -1;
+        cal.step = CAL_IDLE;
+        __set_PRIMASK(primask);
+    }
+}
+
+void Time_PrintCalibration(const TimeCalib_t *c)
+{
+    printf("timebase: core %lu Hz, measured %lu Hz (%ld ppm), cyc/us %lu\r\n",
+           (unsigned long)c->core_hz, (unsigned long)c->measured_hz, (long)c->error_ppm,
+           (unsigned long)cyc_per_us);
+    printf("          TIM4 %lu ticks/ms, Now_us %lu cyc, Delay_us(10) %lu cyc, oneshot(200us) late %ld us\r\n",
+           (unsigned long)c->tim_ticks_per_ms, (unsigned long)c->now_cycles,
+           (unsigned long)c->delay10_cycles, (long)c->oneshot_late_us);
+}
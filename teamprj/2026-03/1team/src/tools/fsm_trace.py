@@ -0,0 +1,155 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+로봇 상태기계 전이 기록 해석기 (PC에서 실행)
+
+보드에 LINK_T_TRACE 프레임을 보내 robot_state.c 의 전이 기록 링을 받아오고,
+DWT 사이클 타임스탬프로 상태별 체류 시간, 큐 대기 시간, 판단 지연을 계산합니다.
+
+판단 지연 = DECIDE 직전 마지막 초음파 샘플/타임아웃 이벤트가 큐에 들어간 시각
+          → DECIDE 에서 MOVE/ALERT 로 나간 시각 (모터 명령은 그 진입 동작 안)
+          DECIDE 로 들어간 이벤트별로 따로 (READ_ECHO→DECIDE = 스윕 끝, OBSTACLE = 스윕 도중 지도 막힘)
+
+Usage:
+  python fsm_trace.py COM5                    # 받아서 분석 (--save trace.bin 으로 원본 저장)
+  python fsm_trace.py --file trace.bin        # 저장한 원본 다시 분석
+  python fsm_trace.py --file trace.bin -v     # 전이 목록도 출력
+
+robot_state.h 의 RobotState_t / RobotEvent_t 순서를 바꾸면 아래 이름 표도 같이 고치세요.
+"""
+
+import os
+import struct
+import sys
+import time
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+from uart_link import decode, encode  # noqa: E402
+
+T_TRACE, T_TRACE_HDR, T_TRACE_REC = 0x04, 0x84, 0x85
+
+STATES = ["IDLE", "SCAN", "WAIT_ECHO", "DECIDE", "MOVE", "REVERSE", "ALERT", "READ_ECHO"]
+EVENTS = ["NONE", "START", "STOP", "FORWARD", "BACK", "LEFT", "RIGHT", "TIMEOUT", "RANGE", "DONE", "OBSTACLE"]
+ST_DECIDE = STATES.index("DECIDE")
+ST_READ_ECHO = STATES.index("READ_ECHO")
+TRACE_INTERNAL = 0x01
+
+REC = struct.Struct("<IIBBBB")      # RobotTrace_t (12바이트)
+
+
+def name(table, i):
+    return table[i] if i < len(table) else f"?{i}"
+
+
+def parse(raw):
+    frames, _ = decode(raw)
+    clock, count, dropped, recs = 64_000_000, None, 0, []
+    for ftype, payload in frames:
+        if ftype == T_TRACE_HDR and len(payload) == 10:
+            clock, count, dropped = struct.unpack("<IHI", payload)
+            recs = []
+        elif ftype == T_TRACE_REC:
+            for off in range(0, len(payload) - REC.size + 1, REC.size):
+                recs.append(REC.unpack_from(payload, off))
+    return clock, count, dropped, recs
+
+
+def stats(values):
+    if not values:
+        return "-"
+    return f"n={len(values)}  min {min(values):.1f}  avg {sum(values) / len(values):.1f}  max {max(values):.1f} us"
+
+
+def analyze(clock, count, dropped, recs, verbose):
+    us = lambda cyc: (cyc & 0xFFFFFFFF) * 1e6 / clock    # noqa: E731  (CYCCNT 한 바퀴 넘김 처리)
+
+    print(f"clock {clock / 1e6:.0f} MHz  기록 {len(recs)}/{count}  큐 넘침 {dropped}")
+    if not recs:
+        return
+
+    t0 = recs[0][0]
+    queue_wait = {}
+    dwell = {}
+    decide = {}
+    entered = None
+    sample = None
+    to_decide = None
+
+    for cyc, post, ev, frm, to, flags in recs:
+        queue_wait.setdefault(name(EVENTS, ev), []).append(us(cyc - post))
+
+        if verbose:
+            kind = "  (내부)" if flags & TRACE_INTERNAL else ""
+            print(f"{us(cyc - t0) / 1000:10.2f} ms  {name(EVENTS, ev):8s} "
+                  f"{name(STATES, frm):>9s} -> {name(STATES, to):9s}  대기 {us(cyc - post):7.1f} us{kind}")
+
+        if flags & TRACE_INTERNAL:
+            continue
+
+        if entered is not None:
+            dwell.setdefault(name(STATES, frm), []).append(us(cyc - entered) / 1000)
+        entered = cyc
+
+        if frm == ST_READ_ECHO:
+            sample = post
+        if to == ST_DECIDE and sample is not None:
+            to_decide = (name(EVENTS, ev), sample)
+        elif frm == ST_DECIDE and to_decide is not None:
+            decide.setdefault(to_decide[0], []).append(us(cyc - to_decide[1]))
+            to_decide = None
+
+    print("\n판단 지연 (마지막 초음파 이벤트 → MOVE/ALERT), DECIDE 진입 이벤트별:")
+    for ev, v in decide.items():
+        print(f"  {ev:8s} {stats(v)}")
+    if not decide:
+        print("  -")
+
+    print("\n이벤트 큐 대기 (Post → 처리 끝):")
+    for ev, v in queue_wait.items():
+        print(f"  {ev:8s} {stats(v)}")
+
+    print("\n상태 체류 (ms):")
+    for st, v in dwell.items():
+        print(f"  {st:9s} n={len(v):<4d} avg {sum(v) / len(v):8.1f}  max {max(v):8.1f}")
+
+
+def capture(port, save):
+    import serial
+    ser = serial.Serial(port, int(os.environ.get("BAUD", "115200")), timeout=0.05)
+    ser.reset_input_buffer()
+    ser.write(encode(T_TRACE))
+    raw = b""
+    deadline = time.time() + 1.5
+    while time.time() < deadline:
+        raw += ser.read(4096)
+        _, count, _, recs = parse(raw)
+        if count is not None and len(recs) >= count:
+            break
+    if save:
+        with open(save, "wb") as f:
+            f.write(raw)
+    return raw
+
+
+def main():
+    args = sys.argv[1:]
+    verbose = "-v" in args
+    args = [a for a in args if a != "-v"]
+    save = None
+    if "--save" in args:
+        save = args[args.index("--save") + 1]
+
+    if len(args) >= 2 and args[0] == "--file":
+        with open(args[1], "rb") as f:
+            raw = f.read()
+    elif args:
+        raw = capture(args[0], save)
+    else:
+        print(__doc__)
+        sys.exit(1)
+
+    analyze(*parse(raw), verbose)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,301 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+눈 표정 아틀라스 생성기 (PC에서 실행)
+
+eyes.c 의 도형 배치와 lcd_gfx.c 의 행 span 래스터라이저를 그대로 옮겨
+8개 표정을 160x80 RGB565 로 미리 그린 뒤, 밴드(160x8) 단위 RLE 로 압축하여
+플래시용 const 배열(eyes_atlas.c / eyes_atlas.h)을 만듭니다.
+
+- 같은 내용의 밴드는 표정 사이에서 공유 (검은 밴드 등)
+- 밴드 해시는 lcd_band.c Band_Hash() 와 같은 FNV-1a → 안 바뀐 밴드는 디코딩도 생략
+- 밴드마다 배경이 아닌 열 범위(xl, xr)를 저장 → 바뀐 밴드도 그 범위만 전송
+
+Usage:
+  python gen_eyes_atlas.py            # ../Core 아래 파일 갱신
+  python gen_eyes_atlas.py --check    # 생성 결과만 출력 (파일 쓰지 않음)
+
+eyes.c 의 Eye_* 도형을 바꾸면 이 스크립트의 EXPRESSIONS 도 같이 수정하고 다시 실행하세요.
+"""
+
+import os
+import sys
+from math import isqrt
+
+LCD_WIDTH = 160
+LCD_HEIGHT = 80
+BAND_H = 8
+BAND_COUNT = LCD_HEIGHT // BAND_H
+SPI_BPS = 8_000_000      # SPI2: APB1 32MHz / 4
+
+BLACK = 0x0000
+EYE_COLOR = 0x07E0
+
+LX, RX, CY = 40, 120, 40
+
+RECT, RRECT, CIRCLE, LINE = range(4)
+
+# ===== eyes.c 도형 배치 (Band_* 호출과 1:1) =====
+
+def fill_rect(x, y, w, h, c):
+    return (RECT, x, y, x + w - 1, y + h - 1, 0, c)
+
+def round_rect(x, y, w, h, r, c):
+    return (RRECT, x, y, x + w - 1, y + h - 1, r, c)
+
+def thick_line(x0, y0, x1, y1, t, c):
+    return (LINE, x0, y0, x1, y1, t, c)
+
+def eye_normal(cx):
+    return [round_rect(cx - 15, CY - 25, 30, 50, 10, EYE_COLOR)]
+
+def eye_closed(cx):
+    return [fill_rect(cx - 15, CY - 3, 30, 6, EYE_COLOR)]
+
+def eye_happy(cx):
+    return [round_rect(cx - 15, CY - 5, 30, 25, 12, EYE_COLOR)]
+
+def eye_angry(cx, d):
+    y0 = CY - 20 + (15 if d < 0 else 0)
+    y1 = CY - 20 + (0 if d < 0 else 15)
+    return [thick_line(cx - 15, y0, cx + 15, y1, 4, EYE_COLOR)]
+
+def eye_sad(cx, d):
+    y0 = CY - 10 + (0 if d < 0 else 8)
+    y1 = CY - 10 + (8 if d < 0 else 0)
+    return [thick_line(cx - 12, y0, cx + 12, y1, 3, EYE_COLOR),
+            fill_rect(cx - 10, CY, 20, 4, EYE_COLOR)]
+
+def eye_look_left(cx):
+    return eye_normal(cx) + [fill_rect(cx - 12, CY - 10, 8, 20, BLACK)]
+
+def eye_look_right(cx):
+    return eye_normal(cx) + [fill_rect(cx + 4, CY - 10, 8, 20, BLACK)]
+
+# Expression_t 순서 (eyes.h)
+EXPRESSIONS = [
+    ("NEUTRAL",    eye_normal(LX) + eye_normal(RX)),
+    ("BLINK",      eye_closed(LX) + eye_closed(RX)),
+    ("HAPPY",      eye_happy(LX) + eye_happy(RX)),
+    ("ANGRY",      eye_angry(LX, -1) + eye_angry(RX, +1)),
+    ("SLEEPY",     eye_closed(LX) + eye_closed(RX)),
+    ("SAD",        eye_sad(LX, -1) + eye_sad(RX, +1)),
+    ("LOOK_LEFT",  eye_look_left(LX) + eye_look_left(RX)),
+    ("LOOK_RIGHT", eye_look_right(LX) + eye_look_right(RX)),
+]
+
+# ===== lcd_gfx.c Gfx_ShapeRowSpan 포팅 =====
+
+def circle_half(r, dy):
+    v = r * r + r - dy * dy
+    return isqrt(v) if v > 0 else 0
+
+def line_row_span(s, y):
+    _, x0, y0, x1, y1, t, _ = s
+    dx, dy = abs(x1 - x0), abs(y1 - y0)
+    sx = 1 if x0 < x1 else -1
+    sy = 1 if y0 < y1 else -1
+    err = dx - dy
+    r = t // 2
+    lo, hi = 32767, -32768
+    while True:
+        d = y - y0
+        if t <= 2:
+            if -r <= d < t - r:
+                lo, hi = min(lo, x0 - r), max(hi, x0 - r + t - 1)
+        elif -r <= d <= r:
+            h = circle_half(r, d)
+            lo, hi = min(lo, x0 - h), max(hi, x0 + h)
+        if x0 == x1 and y0 == y1:
+            break
+        e2 = 2 * err
+        if e2 > -dy:
+            err -= dy
+            x0 += sx
+        if e2 < dx:
+            err += dx
+            y0 += sy
+    return (lo, hi) if lo <= hi else None
+
+def row_span(s, y):
+    kind, x0, y0, x1, y1, r, _ = s
+    if kind == RECT:
+        return (x0, x1) if y0 <= y <= y1 else None
+    if kind == RRECT:
+        if y < y0 or y > y1:
+            return None
+        w, h = x1 - x0 + 1, y1 - y0 + 1
+        r = max(1, min(r, w // 2, h // 2))
+        d = 0
+        if y < y0 + r:
+            d = y0 + r - y
+        elif y > y1 - r:
+            d = y - (y1 - r)
+        inset = 0 if d == 0 else r - circle_half(r, d)
+        return (x0 + inset, x1 - inset)
+    if kind == CIRCLE:
+        d = y - y0
+        if d < -r or d > r:
+            return None
+        h = circle_half(r, d)
+        return (x0 - h, x0 + h)
+    if kind == LINE:
+        return line_row_span(s, y)
+    return None
+
+def render(shapes):
+    fb = [[BLACK] * LCD_WIDTH for _ in range(LCD_HEIGHT)]
+    for y in range(LCD_HEIGHT):
+        for s in shapes:
+            span = row_span(s, y)
+            if span is None:
+                continue
+            xl, xr = max(span[0], 0), min(span[1], LCD_WIDTH - 1)
+            for x in range(xl, xr + 1):
+                fb[y][x] = s[6]
+    return fb
+
+# ===== RLE / 해시 =====
+
+def fnv1a(pixels):
+    h = 2166136261
+    for p in pixels:
+        h ^= p
+        h = (h * 16777619) & 0xFFFFFFFF
+    return h
+
+def rle(pixels, palette):
+    runs = []
+    i = 0
+    while i < len(pixels):
+        c = pixels[i]
+        n = 1
+        while i + n < len(pixels) and pixels[i + n] == c and n < 4096:
+            n += 1
+        runs.append((palette.index(c) << 12) | (n - 1))
+        i += n
+    return runs
+
+def extent(pixels, bg):
+    """배경이 아닌 열 범위, 비었으면 (255, 0)"""
+    cols = [i % LCD_WIDTH for i, c in enumerate(pixels) if c != bg]
+    return (min(cols), max(cols)) if cols else (255, 0)
+
+def window(prev, cur):
+    """lcd_band.c Band_Send() 와 같은 창 폭 (이전 ∪ 새 범위)"""
+    wl, wr = min(prev[3], cur[3]), max(prev[4], cur[4])
+    return LCD_WIDTH if wl > wr else wr - wl + 1
+
+def build():
+    frames = [render(shapes) for _, shapes in EXPRESSIONS]
+
+    palette = []
+    for fb in frames:
+        for row in fb:
+            for c in row:
+                if c not in palette:
+                    palette.append(c)
+    if len(palette) > 16:
+        sys.exit("팔레트 색상이 16개를 넘습니다")
+
+    runs = []
+    band_index = {}          # 밴드 내용 → (run_start, run_count)
+    table = []
+    for fb in frames:
+        bands = []
+        for b in range(BAND_COUNT):
+            pixels = tuple(c for row in fb[b * BAND_H:(b + 1) * BAND_H] for c in row)
+            if pixels not in band_index:
+                enc = rle(pixels, palette)
+                band_index[pixels] = (len(runs), len(enc))
+                runs.extend(enc)
+            start, count = band_index[pixels]
+            xl, xr = extent(pixels, palette[0])
+            bands.append((start, count, fnv1a(pixels), xl, xr))
+        table.append(bands)
+    return palette, runs, table, frames
+
+# ===== 출력 =====
+
+def emit(palette, runs, table):
+    h = []
+    h.append("/**")
+    h.append(" * @file eyes_atlas.h")
+    h.append(" * @brief 눈 표정 RLE 아틀라스 (tools/gen_eyes_atlas.py 로 생성, 직접 수정 금지)")
+    h.append(" */")
+    h.append("")
+    h.append("#ifndef __EYES_ATLAS_H")
+    h.append("#define __EYES_ATLAS_H")
+    h.append("")
+    h.append("#include <stdint.h>")
+    h.append('#include "lcd_band.h"')
+    h.append("")
+    h.append("#define EYES_ATLAS_EXPR_COUNT  %d" % len(table))
+    h.append("#define EYES_ATLAS_RUN_COUNT   %d" % len(runs))
+    h.append("")
+    h.append("extern const uint16_t  eyes_atlas_palette[%d];" % len(palette))
+    h.append("extern const uint16_t  eyes_atlas_runs[EYES_ATLAS_RUN_COUNT];")
+    h.append("extern const BandRle_t eyes_atlas_bands[EYES_ATLAS_EXPR_COUNT][BAND_COUNT];")
+    h.append("")
+    h.append("#endif /* __EYES_ATLAS_H */")
+
+    c = []
+    c.append("/**")
+    c.append(" * @file eyes_atlas.c")
+    c.append(" * @brief 눈 표정 RLE 아틀라스 (tools/gen_eyes_atlas.py 로 생성, 직접 수정 금지)")
+    c.append(" */")
+    c.append("")
+    c.append('#include "drivers/eyes_atlas.h"')
+    c.append("")
+    c.append("const uint16_t eyes_atlas_palette[%d] = {" % len(palette))
+    c.append("    " + ", ".join("0x%04X" % p for p in palette))
+    c.append("};")
+    c.append("")
+    c.append("const uint16_t eyes_atlas_runs[EYES_ATLAS_RUN_COUNT] = {")
+    for i in range(0, len(runs), 12):
+        c.append("    " + ", ".join("0x%04X" % r for r in runs[i:i + 12]) + ",")
+    c.append("};")
+    c.append("")
+    c.append("const BandRle_t eyes_atlas_bands[EYES_ATLAS_EXPR_COUNT][BAND_COUNT] = {")
+    for (name, _), bands in zip(EXPRESSIONS, table):
+        c.append("    { /* EXPR_%s */" % name)
+        for start, count, hsh, xl, xr in bands:
+            c.append("        { %4d, %3d, 0x%08Xu, %3d, %3d }," % (start, count, hsh, xl, xr))
+        c.append("    },")
+    c.append("};")
+    return "\r\n".join(h) + "\r\n", "\r\n".join(c) + "\r\n"
+
+def report(palette, runs, table, frames):
+    flash = len(palette) * 2 + len(runs) * 2 + len(table) * BAND_COUNT * 12
+    raw = len(table) * LCD_WIDTH * LCD_HEIGHT * 2
+    print("팔레트 %d색, run %d개, 밴드 테이블 %d개" % (len(palette), len(runs), len(table) * BAND_COUNT))
+    print("플래시 사용량: %d bytes (비압축 %d bytes)" % (flash, raw))
+    print()
+
+    # NEUTRAL 에서 각 표정으로 바뀔 때 실제로 나가는 밴드 (두 경로 공통)
+    print("%-11s %6s %6s %8s %8s" % ("NEUTRAL→", "runs", "bands", "bus(B)", "bus(ms)"))
+    for (name, _), bands in zip(EXPRESSIONS, table):
+        n = sum(b[1] for b in bands)
+        changed = [(ref, b) for b, ref in zip(bands, table[0]) if b[2] != ref[2]]
+        # 픽셀 + CASET/RASET/RAMWR
+        bus = sum(BAND_H * window(ref, b) * 2 + 11 for ref, b in changed)
+        changed = len(changed)
+        print("%-11s %6d %6d %8d %8.1f" % (name, n, changed, bus, bus * 8 * 1000 / SPI_BPS))
+
+def main():
+    palette, runs, table, frames = build()
+    report(palette, runs, table, frames)
+    if "--check" in sys.argv:
+        return
+    here = os.path.dirname(os.path.abspath(__file__))
+    core = os.path.join(here, "..", "Core")
+    hdr, src = emit(palette, runs, table)
+    with open(os.path.join(core, "Inc", "drivers", "eyes_atlas.h"), "w", newline="") as f:
+        f.write(hdr)
+    with open(os.path.join(core, "Src", "drivers", "eyes_atlas.c"), "w", newline="") as f:
+        f.write(src)
+    print()
+    print("eyes_atlas.h / eyes_atlas.c 생성 완료")
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,191 @@
+/**
+ * @file anim_bench.c
+ * @brief 표정 전환 트윈 프레임 시간 측정 (PC에서 실행) - 프레임마다 SPI 바이트/창, 버스 시간, 호스트 사이클
+ *
+ *   gcc -O2 -fno-tree-vectorize -Wall -Ivboard -I../../Core/Inc anim_bench.c spi_count.c \
+ *       ../../Core/Src/drivers/anim.c ../../Core/Src/drivers/eyes.c ../../Core/Src/drivers/eyes_atlas.c \
+ *       ../../Core/Src/drivers/lcd_pal.c ../../Core/Src/drivers/lcd_band.c ../../Core/Src/drivers/lcd_gfx.c \
+ *       ../../Core/Src/drivers/lcd_st7735.c -o anim_bench
+ *   ./anim_bench                # 표 + 예산/화면 검사, 종료 코드 0 = 통과
+ *
+ * main 루프처럼 ANIM_FRAME_MS 마다 Anim_Update() 를 부름 (HAL SPI 는 spi_count.c 대역)
+ * 가상 시간 = HAL_Delay 누적 + 전송 바이트 x 1us → 전송이 길면 트윈도 그만큼 진행
+ * 8 x 7 전환마다 Anim_Init() 로 시작 (깜빡임 타이머 초기화, 1초 안에 끝나므로 깜빡임이 끼지 않음)
+ * 열:
+ *   프레임   = 트윈 중간 프레임 수 (AnimStats_t.frames)
+ *   B/프레임 = 프레임당 평균 / 최대 SPI 바이트 (창 설정 + 픽셀)
+ *   버스 ms  = 최대 프레임 바이트 x 1us (8Mbit/s) - ANIM_FRAME_MS 안에 들어와야 함
+ *   cyc      = 최대 프레임 호스트 사이클 (합성 + DMA 완료 콜백, 픽셀 디코드 없이 REPEAT 번 중 최소)
+ * 검사:
+ *   1. 모든 프레임 버스 시간 < ANIM_FRAME_MS, 트윈 프레임 수 >= 전환 시간 / ANIM_FRAME_MS - 1
+ *   2. 전환이 끝난 뒤 화면 = 아틀라스 표정을 새로 그린 화면 (Eyes_Invalidate + Eyes_Draw)
+ *   3. 끝난 뒤 Anim_Update 는 전송 0
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "stm32f1xx_hal.h"
+#include "drivers/lcd_st7735.h"
+#include "drivers/eyes.h"
+#include "drivers/anim.h"
+#include "timebase.h"
+#include "spi_count.h"
+
+#define EXPR_COUNT      8
+#define REPEAT          5       // 사이클은 반복 중 최소 (호스트 잡음 제거)
+#define SETTLE_FRAMES   12      // 이전 표정으로 자리잡기 (트윈 180ms + Eyes_Update 100ms 간격)
+#define RUN_FRAMES      14      // 전환 측정 (420ms)
+#define FULL_FRAME_B    (LCD_WIDTH * LCD_HEIGHT * 2)
+
+static const char *expr_name[EXPR_COUNT] = {
+    "NEUTRAL", "BLINK", "HAPPY", "ANGRY", "SLEEPY", "SAD", "LOOK_LEFT", "LOOK_RIGHT"
+};
+
+static uint16_t gram_end[256][256];
+static int fails = 0;
+
+#define CHECK(cond, ...) do { if (!(cond)) { printf("  FAIL: " __VA_ARGS__); printf("\n"); fails++; } } while (0)
+
+/* ===== anim.c / eyes.c 가 부르는 보드 심볼 ===== */
+
+volatile uint8_t servo_moving = 0;
+
+uint32_t Time_Cycles(void)
+{
+    return (uint32_t)SpiCount_Cycles();
+}
+
+uint32_t Time_CyclesToUs(uint32_t cycles)
+{
+    return cycles / 72u;        // 보드와 같은 환산 (AnimStats_t 용, 여기서는 안 씀)
+}
+
+/* ===== 전환 하나 ===== */
+
+typedef struct {
+    uint32_t frames;            // 트윈 중간 프레임
+    uint32_t sent;              // 바이트를 보낸 프레임
+    uint64_t bytes;
+    uint32_t windows;
+    uint32_t max_bytes;
+    uint64_t max_cyc;
+    uint32_t after_bytes;       // 끝난 뒤 프레임
+} Result_t;
+
+static void Frame(Result_t *r, uint8_t count_after)
+{
+    HAL_Delay(ANIM_FRAME_MS);
+    SpiCount_t k0 = spi_count;
+    uint64_t c0 = SpiCount_Cycles();
+    Anim_Update();
+    SpiCount_Pump();                    // 남은 DMA = 인터럽트
+    uint64_t cyc = SpiCount_Cycles() - c0;
+    if (!r) return;
+
+    uint32_t b = (uint32_t)(spi_count.bytes - k0.bytes);
+    if (count_after) { r->after_bytes += b; return; }
+    if (b) r->sent++;
+    r->bytes += b;
+    r->windows += spi_count.windows - k0.windows;
+    if (b > r->max_bytes) r->max_bytes = b;
+    if (cyc > r->max_cyc) r->max_cyc = cyc;
+}
+
+static void Transition(Expression_t from, Expression_t to, Result_t *r)
+{
+    AnimStats_t st;
+
+    memset(r, 0, sizeof(*r));
+    Anim_Init();
+    Anim_Set(from);
+    for (int i = 0; i < SETTLE_FRAMES; i++) Frame(NULL, 0);
+
+    Anim_ResetStats();
+    Anim_Set(to);
+    for (int i = 0; i < RUN_FRAMES; i++) Frame(r, 0);
+    Anim_GetStats(&st);
+    r->frames = st.frames;
+    Frame(r, 1);
+}
+
+int main(void)
+{
+    Result_t  r;
+    uint64_t  best_cyc[EXPR_COUNT][EXPR_COUNT];
+    uint32_t  worst_b = 0;
+
+    LCD_Init();
+    LCD_Clear(0x0000);
+    SpiCount_Pump();
+
+    /* 1) 사이클만 (픽셀 디코드 끔) */
+    spi_gram_on = 0;
+    memset(best_cyc, 0xFF, sizeof(best_cyc));
+    for (int rep = 0; rep < REPEAT; rep++)
+        for (int from = 0; from < EXPR_COUNT; from++)
+            for (int to = 0; to < EXPR_COUNT; to++)
+            {
+                if (from == to) continue;
+                Transition((Expression_t)from, (Expression_t)to, &r);
+                if (r.max_cyc < best_cyc[from][to]) best_cyc[from][to] = r.max_cyc;
+            }
+
+    /* 2) 바이트 + 화면 검사 */
+    spi_gram_on = 1;
+    Eyes_Invalidate();
+    printf("표정 전환 트윈 (%dms 마다 Anim_Update, 전환 %dms / 깜빡임 %dms, 전체 화면 1장 = %d B = %.1f ms)\n\n",
+           ANIM_FRAME_MS, ANIM_TWEEN_MS, ANIM_BLINK_TWEEN_MS, FULL_FRAME_B, FULL_FRAME_B * (double)SPI_BYTE_NS / 1e6);
+    printf("  목표        | 프레임 | B/프레임 평균  최대 | 버스 ms | 창/프레임 |      cyc\n");   // 한글 2칸 폭으로 맞춤
+
+    for (int to = 0; to < EXPR_COUNT; to++)
+    {
+        uint32_t frames = 0, sent = 0, max_b = 0, windows = 0, n = 0;
+        uint64_t bytes = 0, max_cyc = 0;
+
+        for (int from = 0; from < EXPR_COUNT; from++)
+        {
+            if (from == to) continue;
+            Transition((Expression_t)from, (Expression_t)to, &r);
+            n++;
+
+            uint32_t tw = (to == EXPR_BLINK || from == EXPR_BLINK) ? ANIM_BLINK_TWEEN_MS : ANIM_TWEEN_MS;
+            CHECK(r.frames + 1 >= tw / ANIM_FRAME_MS, "%s → %s: 트윈 프레임 %u (전환 %ums)",
+                  expr_name[from], expr_name[to], r.frames, tw);
+            CHECK(r.max_bytes * SPI_BYTE_NS < ANIM_FRAME_MS * 1000000u, "%s → %s: 프레임 %u B 가 %dms 를 넘음",
+                  expr_name[from], expr_name[to], r.max_bytes, ANIM_FRAME_MS);
+            CHECK(r.after_bytes == 0, "%s → %s: 끝난 뒤에도 %u B 전송", expr_name[from], expr_name[to], r.after_bytes);
+            CHECK(Eyes_GetExpression() == (Expression_t)to, "%s → %s: 중간에 깜빡임이 끼어듦",
+                  expr_name[from], expr_name[to]);
+
+            memcpy(gram_end, spi_gram, sizeof(gram_end));
+            Eyes_Invalidate();
+            Eyes_Draw((Expression_t)to);
+            SpiCount_Pump();
+            CHECK(memcmp(spi_gram, gram_end, sizeof(gram_end)) == 0, "%s → %s: 끝 화면이 아틀라스 표정과 다름",
+                  expr_name[from], expr_name[to]);
+
+            frames += r.frames;
+            sent += r.sent;
+            bytes += r.bytes;
+            windows += r.windows;
+            if (r.max_bytes > max_b) max_b = r.max_bytes;
+            if (best_cyc[from][to] > max_cyc) max_cyc = best_cyc[from][to];
+        }
+
+        printf("  %-11s | %6.1f | %13llu %5u | %7.1f | %9.1f | %8llu\n", expr_name[to], (double)frames / n,
+               (unsigned long long)(sent ? bytes / sent : 0), max_b, max_b * (double)SPI_BYTE_NS / 1e6,
+               sent ? (double)windows / sent : 0.0, (unsigned long long)max_cyc);
+        if (max_b > worst_b) worst_b = max_b;
+    }
+
+    printf("\n  최대 프레임 %u B = 버스 %.1f ms (%dms 의 %.0f%%), 전체 화면 다시 그리기의 %.0f%%\n", worst_b,
+           worst_b * (double)SPI_BYTE_NS / 1e6, ANIM_FRAME_MS, worst_b * (double)SPI_BYTE_NS / 1e4 / ANIM_FRAME_MS,
+           100.0 * worst_b / FULL_FRAME_B);
+
+    LCD_BusStats_t st;
+    LCD_GetBusStats(&st);
+    CHECK(st.errors == 0, "드라이버 DMA 오류/타임아웃 %u", st.errors);
+
+    printf("\n%s\n", fails ? "# FAIL" : "# OK");
+    return fails ? 1 : 0;
+}
@@ -0,0 +1,261 @@
+/**
+ * @file band_bench.c
+ * @brief 밴드 합성기 측정 (PC에서 실행) - 표정 전환마다 SPI 명령/창/바이트를 전체 다시 그리기와 비교
+ *
+ *   gcc -O2 -fno-tree-vectorize -Wall -Ivboard -I../../Core/Inc band_bench.c spi_count.c \
+ *       ../../Core/Src/drivers/lcd_st7735.c ../../Core/Src/drivers/lcd_gfx.c \
+ *       ../../Core/Src/drivers/lcd_band.c ../../Core/Src/drivers/eyes_atlas.c -o band_bench
+ *   ./band_bench                # 표 + 화면/전송량 검사, 종료 코드 0 = 통과
+ *
+ * 경로 (HAL SPI 는 spi_count.c 대역):
+ *   전체    = user-002 전 Eyes_Draw: 눈 영역 2개 클리어 + 도형마다 LCD_* (도형마다 창)
+ *   밴드    = Band_Begin / Band_* / Band_Commit (바뀐 밴드만, 밴드당 창 1개)
+ *   아틀라스 = Band_CommitRle (eyes_atlas.c, 래스터라이즈 없음)
+ * 검사:
+ *   1. 8 x 7 전환마다 세 경로의 화면(디코드한 GRAM)이 같음
+ *   2. 밴드/아틀라스 바이트 <= 전체 다시 그리기
+ *   3. 같은 표정을 다시 그리면 밴드/아틀라스는 전송 0
+ *   4. 아틀라스 밴드 80개: 저장된 해시 = 풀어낸 픽셀의 FNV-1a, 내용이 다른데 해시가 같은 쌍 없음
+ *      (lcd_band.c 는 해시만 비교하므로 충돌 = 밴드 안 보냄)
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "drivers/lcd_st7735.h"
+#include "drivers/lcd_gfx.h"
+#include "drivers/lcd_band.h"
+#include "drivers/eyes.h"
+#include "drivers/eyes_atlas.h"
+#include "spi_count.h"
+
+#define BLACK       0x0000
+#define EYE_COLOR   0x07E0
+#define LX          40
+#define RX          120
+#define CY          40
+#define EXPR_COUNT  8
+
+static const char *expr_name[EXPR_COUNT] = {
+    "NEUTRAL", "BLINK", "HAPPY", "ANGRY", "SLEEPY", "SAD", "LOOK_LEFT", "LOOK_RIGHT"
+};
+
+static uint16_t gram_ref[256][256];
+static int fails = 0;
+
+#define CHECK(cond, ...) do { if (!(cond)) { printf("  FAIL: " __VA_ARGS__); printf("\n"); fails++; } } while (0)
+
+/* ===== 표정 도형 (eyes.c Eye_* 와 같음, 바꾸면 같이 고칠 것) ===== */
+
+typedef struct {
+    void (*fill_rect)(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t c);
+    void (*round_rect)(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, uint16_t c);
+    void (*thick_line)(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t t, uint16_t c);
+} Canvas_t;
+
+static const Canvas_t lcd_canvas  = { LCD_FillRect, LCD_RoundRect, LCD_ThickLine };
+static const Canvas_t band_canvas = { Band_FillRect, Band_RoundRect, Band_ThickLine };
+
+static void Eye(const Canvas_t *cv, Expression_t e, int16_t cx, int8_t dir)
+{
+    switch (e)
+    {
+        case EXPR_NEUTRAL:
+            cv->round_rect(cx - 15, CY - 25, 30, 50, 10, EYE_COLOR);
+            break;
+        case EXPR_BLINK:
+        case EXPR_SLEEPY:
+            cv->fill_rect(cx - 15, CY - 3, 30, 6, EYE_COLOR);
+            break;
+        case EXPR_HAPPY:
+            cv->round_rect(cx - 15, CY - 5, 30, 25, 12, EYE_COLOR);
+            break;
+        case EXPR_ANGRY:
+            cv->thick_line(cx - 15, CY - 20 + (dir < 0 ? 15 : 0), cx + 15, CY - 20 + (dir < 0 ? 0 : 15), 4, EYE_COLOR);
+            break;
+        case EXPR_SAD:
+            cv->thick_line(cx - 12, CY - 10 + (dir < 0 ? 0 : 8), cx + 12, CY - 10 + (dir < 0 ? 8 : 0), 3, EYE_COLOR);
+            cv->fill_rect(cx - 10, CY, 20, 4, EYE_COLOR);
+            break;
+        case EXPR_LOOK_LEFT:
+            cv->round_rect(cx - 15, CY - 25, 30, 50, 10, EYE_COLOR);
+            cv->fill_rect(cx - 12, CY - 10, 8, 20, BLACK);
+            break;
+        case EXPR_LOOK_RIGHT:
+            cv->round_rect(cx - 15, CY - 25, 30, 50, 10, EYE_COLOR);
+            cv->fill_rect(cx + 4, CY - 10, 8, 20, BLACK);
+            break;
+    }
+}
+
+/* ===== 아틀라스 해시 (lcd_band.c Band_Hash 와 같음) ===== */
+
+static uint16_t atlas_px[EXPR_COUNT][BAND_COUNT][BAND_H * LCD_WIDTH];
+
+static uint32_t Fnv1a(const uint16_t *p, uint32_t n)
+{
+    uint32_t h = 2166136261u;
+    while (n--)
+    {
+        h ^= *p++;
+        h *= 16777619u;
+    }
+    return h;
+}
+
+static void Check_AtlasHashes(void)
+{
+    uint32_t unique = 0;
+
+    for (int e = 0; e < EXPR_COUNT; e++)
+    {
+        for (int b = 0; b < BAND_COUNT; b++)
+        {
+            const BandRle_t *r = &eyes_atlas_bands[e][b];
+            uint16_t *px = atlas_px[e][b];
+            uint32_t n = 0;
+            for (uint16_t i = 0; i < r->run_count; i++)
+            {
+                uint16_t run = eyes_atlas_runs[r->run_start + i];
+                for (uint32_t k = 0; k < BAND_RLE_LEN(run) && n < BAND_H * LCD_WIDTH; k++)
+                    px[n++] = eyes_atlas_palette[BAND_RLE_INDEX(run)];
+            }
+            CHECK(n == BAND_H * LCD_WIDTH, "아틀라스 %s 밴드 %d: 픽셀 %u개", expr_name[e], b, n);
+            CHECK(Fnv1a(px, n) == r->hash, "아틀라스 %s 밴드 %d: 해시가 픽셀과 다름 (다시 생성할 것)", expr_name[e], b);
+        }
+    }
+
+    for (int i = 0; i < EXPR_COUNT * BAND_COUNT; i++)
+    {
+        const BandRle_t *ri = &eyes_atlas_bands[i / BAND_COUNT][i % BAND_COUNT];
+        int dup = 0;
+        for (int j = 0; j < i && !dup; j++)
+        {
+            const BandRle_t *rj = &eyes_atlas_bands[j / BAND_COUNT][j % BAND_COUNT];
+            if (ri->hash != rj->hash) continue;
+            dup = 1;
+            CHECK(memcmp(atlas_px[i / BAND_COUNT][i % BAND_COUNT], atlas_px[j / BAND_COUNT][j % BAND_COUNT],
+                         sizeof(atlas_px[0][0])) == 0,
+                  "해시 충돌: %s 밴드 %d / %s 밴드 %d", expr_name[i / BAND_COUNT], i % BAND_COUNT,
+                  expr_name[j / BAND_COUNT], j % BAND_COUNT);
+        }
+        if (!dup) unique++;
+    }
+    printf("  아틀라스 밴드 %d개 중 내용이 다른 밴드 %u개, 같은 해시는 같은 내용인지 검사\n\n", EXPR_COUNT * BAND_COUNT, unique);
+}
+
+/* ===== 경로 ===== */
+
+typedef enum { PATH_FULL = 0, PATH_BAND, PATH_ATLAS, PATH_COUNT } Path_t;
+static const char *path_name[PATH_COUNT] = { "전체", "밴드", "아틀라스" };
+
+static void Draw(Path_t p, Expression_t e)
+{
+    switch (p)
+    {
+        case PATH_FULL:
+            LCD_FillRect(LX - 25, 0, 60, 80, BLACK);     // user-002 전 ClearEyeArea
+            LCD_FillRect(RX - 25, 0, 60, 80, BLACK);
+            Eye(&lcd_canvas, e, LX, -1);
+            Eye(&lcd_canvas, e, RX, +1);
+            break;
+        case PATH_BAND:
+            Band_Begin(BLACK);
+            Eye(&band_canvas, e, LX, -1);
+            Eye(&band_canvas, e, RX, +1);
+            Band_Commit();
+            break;
+        case PATH_ATLAS:
+            Band_CommitRle(eyes_atlas_bands[e], eyes_atlas_runs, eyes_atlas_palette);
+            break;
+        default:
+            break;
+    }
+    LCD_WaitIdle();
+    SpiCount_Pump();
+}
+
+/* 화면을 검정으로 맞춘 뒤 from 을 그려 둠 (밴드 해시/열 범위도 화면과 같게) */
+static void Prime(Path_t p, Expression_t from)
+{
+    LCD_Clear(BLACK);
+    LCD_WaitIdle();
+    SpiCount_Pump();
+    Band_Invalidate();
+    Band_Begin(BLACK);
+    Band_Commit();              // 해시 = 검은 화면
+    Draw(p, from);
+}
+
+int main(void)
+{
+    SpiCount_t sum[PATH_COUNT][EXPR_COUNT];
+    uint32_t   n_to[EXPR_COUNT] = { 0 };
+
+    memset(sum, 0, sizeof(sum));
+    LCD_Init();
+    Check_AtlasHashes();
+
+    for (int to = 0; to < EXPR_COUNT; to++)
+    {
+        for (int from = 0; from < EXPR_COUNT; from++)
+        {
+            if (from == to) continue;
+            n_to[to]++;
+
+            for (int p = 0; p < PATH_COUNT; p++)
+            {
+                Prime((Path_t)p, (Expression_t)from);
+                SpiCount_Reset();
+                Draw((Path_t)p, (Expression_t)to);
+
+                SpiCount_t *s = &sum[p][to];
+                s->cmds += spi_count.cmds;
+                s->windows += spi_count.windows;
+                s->bytes += spi_count.bytes;
+                s->wait_bytes += spi_count.wait_bytes;
+
+                if (p == PATH_FULL)
+                {
+                    memcpy(gram_ref, spi_gram, sizeof(gram_ref));
+                    continue;
+                }
+                CHECK(memcmp(spi_gram, gram_ref, sizeof(gram_ref)) == 0, "%s → %s: %s 화면이 전체 다시 그리기와 다름",
+                      expr_name[from], expr_name[to], path_name[p]);
+
+                SpiCount_Reset();
+                Draw((Path_t)p, (Expression_t)to);
+                CHECK(spi_count.bytes == 0, "%s: %s 를 다시 그렸는데 %llu B 전송", path_name[p], expr_name[to],
+                      (unsigned long long)spi_count.bytes);
+            }
+        }
+    }
+
+    printf("표정 전환 (다른 7개 표정에서 바뀔 때 평균, 명령 = DC=LOW 바이트, 창 = RAMWR)\n\n");
+    printf("  목표        | 전체 (명령/창/바이트) | 밴드                 | 아틀라스\n");   // 한글 2칸 폭으로 맞춤
+    uint64_t total[PATH_COUNT] = { 0 };
+    for (int to = 0; to < EXPR_COUNT; to++)
+    {
+        printf("  %-11s", expr_name[to]);
+        for (int p = 0; p < PATH_COUNT; p++)
+        {
+            const SpiCount_t *s = &sum[p][to];
+            printf(" | %5u %4u %10llu", s->cmds / n_to[to], s->windows / n_to[to],
+                   (unsigned long long)(s->bytes / n_to[to]));
+            total[p] += s->bytes;
+        }
+        printf("\n");
+        CHECK(sum[PATH_BAND][to].bytes <= sum[PATH_FULL][to].bytes, "%s: 밴드가 전체보다 많이 보냄", expr_name[to]);
+        CHECK(sum[PATH_ATLAS][to].bytes <= sum[PATH_FULL][to].bytes, "%s: 아틀라스가 전체보다 많이 보냄", expr_name[to]);
+    }
+    printf("\n  전환 56번 합계 바이트: 전체 %llu, 밴드 %llu (%.0f%%), 아틀라스 %llu (%.0f%%)\n",
+           (unsigned long long)total[PATH_FULL],
+           (unsigned long long)total[PATH_BAND], 100.0 * total[PATH_BAND] / total[PATH_FULL],
+           (unsigned long long)total[PATH_ATLAS], 100.0 * total[PATH_ATLAS] / total[PATH_FULL]);
+
+    LCD_BusStats_t st;
+    LCD_GetBusStats(&st);
+    CHECK(st.errors == 0, "드라이버 DMA 오류/타임아웃 %u", st.errors);
+
+    printf("\n%s\n", fails ? "# FAIL" : "# OK");
+    return fails ? 1 : 0;
+}
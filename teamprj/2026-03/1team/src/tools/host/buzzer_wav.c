@@ -0,0 +1,188 @@
+/**
+ * @file buzzer_wav.c
+ * @brief 부저 시퀀서 렌더러 (PC에서 실행) - buzzer_seq.c 출력을 WAV로
+ *
+ *   gcc -O2 -I../../Core/Inc buzzer_wav.c ../../Core/Src/drivers/buzzer_seq.c -o buzzer_wav
+ *   ./buzzer_wav                # 내장 멜로디 전부 → buzzer_<이름>.wav + 음 길이 오차 표
+ *   ./buzzer_wav mario 128      # 멜로디 하나, 음량 128
+ *
+ * 보드와 같은 경로:
+ *   - BUZZER_RING_PERIODS 주기짜리 원형 버퍼를 반쪽씩 BuzzerSeq_Fill() (DMA HT/TC 콜백과 같음)
+ *   - 주기 k 시작에 DMA가 쓴 {ARR, CCR1}은 프리로드라 주기 k+1부터 적용
+ *   - 나가는 반쪽이 전부 무음이면 정지 (buzzer.c Ring_Done)
+ * 파형: 1MHz 타이머 틱마다 PWM 출력 (CNT < CCR1 → 1) → 48kHz 구간 평균 + 직류 제거, 16비트 모노
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "drivers/buzzer_seq.h"
+
+#define RING_PERIODS    64          // robot_config.h BUZZER_RING_PERIODS
+#define RING_HALF       (RING_PERIODS / 2)
+#define WAV_RATE        48000
+#define MAX_SAMPLES     (WAV_RATE * 20)
+
+static BuzzerSeq_t seq;
+static uint16_t ring[RING_PERIODS * BUZ_WORDS];
+static int16_t pcm[MAX_SAMPLES];
+
+/* ===== 1MHz PWM → 48kHz ===== */
+typedef struct {
+    uint32_t n;             // 출력 샘플 수
+    double   acc;           // 지금 샘플 구간의 high 틱 합
+    double   pos;           // 지금 샘플 구간에서 지난 틱
+    double   dc;            // 직류 추정 (1차 저역)
+} Resample_t;
+
+static void Emit_Ticks(Resample_t *r, uint32_t ticks, uint8_t level)
+{
+    const double span = 1e6 / WAV_RATE;         // 샘플 1개 = 20.83틱
+    double left = ticks;
+
+    while (left > 0 && r->n < MAX_SAMPLES)
+    {
+        double take = span - r->pos;
+        if (take > left) take = left;
+
+        if (level) r->acc += take;
+        r->pos += take;
+        left -= take;
+
+        if (r->pos >= span - 1e-9)
+        {
+            double v = r->acc / span;           // 0..1 평균 듀티
+            r->dc += (v - r->dc) * 0.002;       // 직류 제거 (약 15Hz 고역 통과)
+            double s = (v - r->dc) * 2.0 * 30000.0;
+            if (s > 32767) s = 32767;
+            if (s < -32768) s = -32768;
+            pcm[r->n++] = (int16_t)s;
+            r->acc = 0;
+            r->pos = 0;
+        }
+    }
+}
+
+static void Wav_Write(const char *path, const int16_t *s, uint32_t n)
+{
+    FILE *f = fopen(path, "wb");
+    if (!f) { perror(path); return; }
+
+    uint32_t data = n * 2u, riff = 36u + data, fmt = 16u, rate = WAV_RATE, bps = WAV_RATE * 2u;
+    uint16_t pcm_fmt = 1, ch = 1, align = 2, bits = 16;
+
+    fwrite("RIFF", 1, 4, f); fwrite(&riff, 4, 1, f); fwrite("WAVE", 1, 4, f);
+    fwrite("fmt ", 1, 4, f); fwrite(&fmt, 4, 1, f);
+    fwrite(&pcm_fmt, 2, 1, f); fwrite(&ch, 2, 1, f); fwrite(&rate, 4, 1, f);
+    fwrite(&bps, 4, 1, f); fwrite(&align, 2, 1, f); fwrite(&bits, 2, 1, f);
+    fwrite("data", 1, 4, f); fwrite(&data, 4, 1, f);
+    fwrite(s, 2, n, f);
+    fclose(f);
+}
+
+/* ===== 음 길이 오차 (주기 단위로 잘린 만큼) ===== */
+static void Print_Timing(const char *name, const BuzzerNote_t *m, uint16_t len, uint32_t played_us)
+{
+    uint32_t want_us = 0;
+    int32_t worst = 0;
+    uint16_t k = 0;
+
+    for (uint16_t i = 0; i < len && k < seq.n; i++)
+    {
+        if (m[i].frequency == REST && m[i].duration == 0) break;
+
+        const BuzzerStep_t *st = &seq.steps[k];
+        uint32_t got = st->arr ? (uint32_t)st->periods * (st->arr + 1u) : (uint32_t)st->periods * 1000u;
+        int32_t err = (int32_t)got - (int32_t)m[i].duration * 1000;
+        if (abs(err) > abs(worst)) worst = err;
+
+        want_us += (m[i].duration + BUZ_GAP_MS) * 1000u;
+        k += 2;                                 // 음표 + 간격
+    }
+
+    printf("%-6s steps %3u | 악보 %6.1fms 컴파일 %6.1fms 재생 %6.1fms | 음표당 최대 오차 %+5dus\n",
+           name, seq.n, want_us / 1000.0, seq.total_us / 1000.0, played_us / 1000.0, worst);
+}
+
+/**
+ * @brief 멜로디 1개 렌더 - 보드의 DMA 원형 버퍼 순서 그대로
+ * @return 샘플 수
+ */
+static uint32_t Render(const BuzzerNote_t *m, uint16_t len, uint8_t volume, uint32_t *played_us,
+                       uint32_t *fills)
+{
+    Resample_t r = {0};
+    uint16_t cur_arr = BUZ_REST_ARR, cur_ccr = 0;   // 지금 주기에 적용 중인 값 (프리로드)
+    uint8_t tail_silent;
+
+    BuzzerSeq_Compile(&seq, m, len);
+    seq.volume = volume;
+
+    BuzzerSeq_Fill(&seq, &ring[0], RING_HALF);
+    tail_silent = (BuzzerSeq_Fill(&seq, &ring[RING_HALF * BUZ_WORDS], RING_HALF) == 0);
+    *fills = 2;
+    *played_us = 0;
+
+    for (uint32_t p = 0; r.n < MAX_SAMPLES; p++)
+    {
+        uint16_t idx = (uint16_t)(p % RING_PERIODS);
+
+        /* 주기 시작: 지금 값으로 1주기 출력하는 동안 DMA가 다음 값을 씀 */
+        uint16_t *w = &ring[idx * BUZ_WORDS];
+        uint32_t ticks = cur_arr + 1u;
+        uint32_t high = (cur_ccr < ticks) ? cur_ccr : ticks;
+        Emit_Ticks(&r, high, 1);
+        Emit_Ticks(&r, ticks - high, 0);
+        *played_us += ticks;
+
+        cur_arr = w[0];
+        cur_ccr = w[2];
+
+        /* 반쪽 끝 → HT/TC 콜백 */
+        if (idx == RING_HALF - 1 || idx == RING_PERIODS - 1)
+        {
+            uint16_t half = (idx == RING_HALF - 1) ? 0 : 1;
+            if (tail_silent) break;
+            tail_silent = (BuzzerSeq_Fill(&seq, &ring[half * RING_HALF * BUZ_WORDS], RING_HALF) == 0);
+            (*fills)++;
+        }
+    }
+    return r.n;
+}
+
+int main(int argc, char **argv)
+{
+    const char *only = (argc > 1) ? argv[1] : NULL;
+    uint8_t volume = (argc > 2) ? (uint8_t)atoi(argv[2]) : 255;
+    int found = 0;
+
+    printf("링 %d주기 (반쪽 %d), 엔벨로프 A %dms D %dms S %d/256 R %dms, 음량 %u\n\n",
+           RING_PERIODS, RING_HALF, BUZ_ATTACK_MS, BUZ_DECAY_MS, BUZ_SUSTAIN_Q8, BUZ_RELEASE_MS, volume);
+
+    for (int t = 0; t < BUZ_TUNES; t++)
+    {
+        uint16_t len;
+        const char *name;
+        const BuzzerNote_t *m = BuzzerSeq_Tune((BuzzerTune_t)t, &len, &name);
+
+        if (only && strcmp(only, name) != 0) continue;
+        found = 1;
+
+        uint32_t played_us, fills;
+        uint32_t n = Render(m, len, volume, &played_us, &fills);
+        Print_Timing(name, m, len, played_us);
+
+        char path[64];
+        snprintf(path, sizeof(path), "buzzer_%s.wav", name);
+        Wav_Write(path, pcm, n);
+        printf("       → %s (%u 샘플, 반쪽 채우기 %u번)\n", path, n, fills);
+    }
+
+    if (!found)
+    {
+        fprintf(stderr, "멜로디 이름: mario alert elise reset stop start ok ping\n");
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,290 @@
+/**
+ * @file clcd_check.c
+ * @brief clcd_i2c.c 전송 검사 (PC에서 실행) - PCF8574 대역 + HD44780 니블/EN 디코더로 화면을 되살려 비교
+ *
+ *   gcc -O2 -Wall -Ivboard -I../../Core/Inc clcd_check.c ../../Core/Src/drivers/clcd_i2c.c -o clcd_check
+ *   ./clcd_check                # 크기별 통계 + 검사, 종료 코드 0 = 통과
+ *
+ * HAL I2C 대역 (여기서 구현):
+ *   - HAL_I2C_Master_Transmit    = 블로킹 (Init) → 바로 디코더로
+ *   - HAL_I2C_Master_Transmit_IT = 디코더로 보내고 전송 중 표시, 완료/에러 콜백은 검사가 부름
+ * 디코더 = PCF8574 P0 RS, P1 RW, P2 EN, P3 BL, P4~7 D4~D7 → HD44780 (vboard_dev.c Clcd_Write 와 같은 규칙)
+ *   - EN 하강 에지에 니블 래치, 기능 설정(DL=0) 전까지는 명령 1번 = 니블 1개
+ *   - 2줄 모드 DDRAM: 0x00~0x27 / 0x40~0x67, 줄 끝에서 다음 줄로 자동 증가 (20x4 의 3·4번째 줄 = +cols)
+ *   - 펄스 규칙: EN 1 → 0 사이에 데이터/RS 가 안 바뀜, RW = 0, BL = 1, 전송 끝에 니블이 남지 않음
+ * 검사 (16x2, 20x4, 16x4 각각):
+ *   1. Init 뒤 4비트 모드 + 2줄 + 화면 켬 + 자동 증가, 화면 공백
+ *   2. 무작위 Print/PrintLine 뒤 Flush → 디코더 화면 = 기대 화면 (고정 시드, 매번 같음)
+ *   3. 안 바뀌면 Flush 가 아무것도 안 보냄, 전송 중 Flush 는 skip 후 다음 Flush 에서 보냄
+ *   4. I2C 에러 (주소 NACK = 0바이트 / 중간 끊김) 뒤 다음 Flush 에서 화면 전체 복구
+ *   5. 거리 숫자 3자리만 바뀜 = 주소 명령 포함 16 B (README)
+ * 중간 끊김은 HD44780 바이트(쓰기 4번) 경계에서만 냄 - 니블 하나만 들어가면 4비트 재초기화가 필요 (드라이버는 안 함)
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "stm32f1xx_hal.h"
+#include "drivers/clcd_i2c.h"
+
+#define ROUNDS          600
+#define CLCD_ADDR7      0x27
+
+static int fails = 0;
+
+#define CHECK(cond, ...) do { if (!(cond)) { printf("  FAIL: " __VA_ARGS__); printf("\n"); fails++; } } while (0)
+
+/* ===== HD44780 디코더 ===== */
+
+static struct {
+    uint8_t  prev;
+    uint8_t  four_bit, two_line, on, inc;
+    uint8_t  have_hi, hi;
+    uint8_t  addr;
+    char     ddram[0x80];
+    uint32_t pulse_errors;      // EN 1 → 0 사이에 데이터/RS 바뀜, RW = 1, BL = 0
+} lcd;
+
+static void Lcd_Exec(uint8_t rs, uint8_t v)
+{
+    if (rs)
+    {
+        lcd.ddram[lcd.addr] = (char)v;
+        if (lcd.addr == 0x27) lcd.addr = 0x40;
+        else if (lcd.addr == 0x67) lcd.addr = 0x00;
+        else lcd.addr++;
+        return;
+    }
+
+    if (v & 0x80)      lcd.addr = v & 0x7F;
+    else if (v & 0x20) { lcd.four_bit = !(v & 0x10); lcd.two_line = (v & 0x08) != 0; }
+    else if (v & 0x08) lcd.on = (v & 0x04) != 0;
+    else if (v & 0x04) lcd.inc = (v & 0x02) != 0;
+    else if (v & 0x02) lcd.addr = 0;
+    else if (v & 0x01) { memset(lcd.ddram, ' ', sizeof(lcd.ddram)); lcd.addr = 0; lcd.inc = 1; }
+}
+
+static void Lcd_Write(const uint8_t *data, uint16_t n)
+{
+    for (uint16_t i = 0; i < n; i++)
+    {
+        uint8_t b = data[i];
+        if ((b & 0x02) || !(b & CLCD_BL)) lcd.pulse_errors++;
+
+        if ((lcd.prev & CLCD_EN) && !(b & CLCD_EN))
+        {
+            if ((lcd.prev ^ b) & (0xF0 | CLCD_RS)) lcd.pulse_errors++;
+
+            uint8_t nib = lcd.prev >> 4, rs = lcd.prev & CLCD_RS;
+            if (!lcd.four_bit)
+                Lcd_Exec(rs, (uint8_t)(nib << 4));
+            else if (!lcd.have_hi)
+            {
+                lcd.hi = nib;
+                lcd.have_hi = 1;
+            }
+            else
+            {
+                Lcd_Exec(rs, (uint8_t)((lcd.hi << 4) | nib));
+                lcd.have_hi = 0;
+            }
+        }
+        lcd.prev = b;
+    }
+}
+
+/* ===== HAL I2C 대역 ===== */
+
+static I2C_HandleTypeDef hi2c;
+static uint8_t  it_busy;
+static uint8_t  fail_start;             // 1 = Transmit_IT 가 HAL_BUSY
+static int32_t  cut_at = -1;            // >= 0 = 이만큼만 LCD 에 들어가고 에러 콜백
+
+void HAL_Delay(uint32_t Delay) { (void)Delay; }
+
+HAL_StatusTypeDef HAL_I2C_Master_Transmit(I2C_HandleTypeDef *h, uint16_t addr, uint8_t *p, uint16_t n, uint32_t t)
+{
+    (void)h; (void)t;
+    CHECK(addr == CLCD_ADDR7 << 1, "블로킹 전송 주소 %02X", addr);
+    Lcd_Write(p, n);
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_I2C_Master_Transmit_IT(I2C_HandleTypeDef *h, uint16_t addr, uint8_t *p, uint16_t n)
+{
+    (void)h;
+    CHECK(!it_busy, "전송 중에 새 전송 시작");
+    CHECK(addr == CLCD_ADDR7 << 1, "IT 전송 주소 %02X", addr);
+    if (fail_start) return HAL_BUSY;
+
+    Lcd_Write(p, cut_at >= 0 && cut_at < n ? (uint16_t)cut_at : n);
+    it_busy = 1;
+    return HAL_OK;
+}
+
+/* 전송 끝 (인터럽트) */
+static void I2c_Done(void)
+{
+    if (!it_busy) return;
+    it_busy = 0;
+    if (cut_at >= 0)
+    {
+        cut_at = -1;
+        HAL_I2C_ErrorCallback(&hi2c);
+    }
+    else
+        HAL_I2C_MasterTxCpltCallback(&hi2c);
+}
+
+/* ===== 기대 화면 (CLCD_Print / CLCD_PrintLine 과 같은 규칙) ===== */
+
+static uint8_t cols, rows;
+static char    model[CLCD_MAX_ROWS][CLCD_MAX_COLS];
+
+static void Model_Print(uint8_t x, uint8_t y, const char *s)
+{
+    CLCD_Print(x, y, s);
+    if (y >= rows) return;
+    for (; *s && x < cols; s++, x++) model[y][x] = *s;
+}
+
+static void Model_PrintLine(uint8_t y, const char *s)
+{
+    CLCD_PrintLine(y, s);
+    if (y >= rows) return;
+    uint8_t x = 0;
+    for (; *s && x < cols; s++, x++) model[y][x] = *s;
+    for (; x < cols; x++) model[y][x] = ' ';
+}
+
+static uint8_t Screen_Ok(void)
+{
+    const uint8_t base[CLCD_MAX_ROWS] = { 0x00, 0x40, cols, (uint8_t)(0x40 + cols) };
+
+    for (uint8_t y = 0; y < rows; y++)
+        for (uint8_t x = 0; x < cols; x++)
+            if (lcd.ddram[base[y] + x] != model[y][x]) return 0;
+    return 1;
+}
+
+static uint32_t rng = 88172645u;
+
+static uint32_t Rand(uint32_t n)
+{
+    rng ^= rng << 13;
+    rng ^= rng >> 17;
+    rng ^= rng << 5;
+    return rng % n;
+}
+
+static void Rand_Text(char *s, uint8_t max)
+{
+    static const char set[] = "0123456789 ABCDEFGHIJKLMNOPQRSTUVWXYZ:.-cm";
+    uint8_t n = (uint8_t)Rand(max + 1u);
+    for (uint8_t i = 0; i < n; i++) s[i] = set[Rand(sizeof(set) - 1)];
+    s[n] = 0;
+}
+
+/* Flush + 전송 끝까지, 보낸 바이트 반환 */
+static uint32_t Flush_All(void)
+{
+    ClcdStats_t a, b;
+    CLCD_GetStats(&a);
+    if (CLCD_Flush()) I2c_Done();
+    CLCD_GetStats(&b);
+    return b.bytes - a.bytes;
+}
+
+/* ===== 크기 하나 ===== */
+
+static void Check_Geometry(uint8_t c, uint8_t r)
+{
+    char s[CLCD_MAX_COLS + 1];
+    ClcdStats_t st;
+
+    cols = c;
+    rows = r;
+    memset(&lcd, 0, sizeof(lcd));
+    memset(lcd.ddram, 0x5A, sizeof(lcd.ddram));         // 전원 인가 직후 쓰레기
+    memset(model, ' ', sizeof(model));
+
+    CHECK(CLCD_Init(&hi2c, CLCD_ADDR7, c, r) == HAL_OK, "%ux%u Init", c, r);
+    CHECK(lcd.four_bit && lcd.two_line && lcd.on && lcd.inc && !lcd.have_hi,
+          "%ux%u Init 뒤 모드 (4bit %u, 2줄 %u, 켬 %u, 증가 %u)", c, r, lcd.four_bit, lcd.two_line, lcd.on, lcd.inc);
+    CHECK(Screen_Ok(), "%ux%u Init 뒤 화면이 공백 아님", c, r);
+    CHECK(Flush_All() == 0, "%ux%u 안 바뀐 화면을 보냄", c, r);
+    CLCD_ResetStats();
+
+    uint32_t skips = 0, errors = 0, bad = 0;
+    for (uint32_t i = 0; i < ROUNDS; i++)
+    {
+        uint8_t y = (uint8_t)Rand(r);
+        Rand_Text(s, c);
+        if (Rand(2)) Model_PrintLine(y, s);
+        else Model_Print((uint8_t)Rand(c), y, s);
+
+        if (i % 50 == 19 || i % 50 == 31 || i % 50 == 43)
+            Model_Print(0, y, model[y][0] == '#' ? "%" : "#");     // 반드시 보낼 것이 있게
+
+        switch (i % 50)
+        {
+        case 7:                 /* 전송 중 Flush → skip, 끝난 뒤 Flush 에서 */
+            if (CLCD_Flush())
+            {
+                Model_Print(0, y, model[y][0] == '#' ? "%" : "#");
+                CHECK(!CLCD_Flush(), "전송 중인데 Flush 가 시작됨");
+                skips++;
+                I2c_Done();
+            }
+            break;
+        case 19:                /* 주소 NACK: 아무것도 안 들어감 */
+            cut_at = 0;
+            errors++;
+            break;
+        case 31:                /* 중간에서 끊김 (HD44780 바이트 경계) */
+            cut_at = 4 * (int32_t)Rand(3);
+            errors++;
+            break;
+        case 43:                /* 전송 시작 실패 */
+            fail_start = 1;
+            CHECK(!CLCD_Flush(), "시작 실패인데 1 반환");
+            fail_start = 0;
+            errors++;
+            break;
+        }
+
+        Flush_All();
+        Flush_All();                                    // 에러였으면 여기서 전체 복구
+
+        if (!Screen_Ok()) bad++;
+    }
+    CHECK(bad == 0, "%ux%u: %u/%u 라운드에서 LCD 화면 != 화면 버퍼", c, r, bad, ROUNDS);
+    CHECK(lcd.pulse_errors == 0, "%ux%u: 펄스 규칙 위반 %u", c, r, lcd.pulse_errors);
+    CHECK(!lcd.have_hi, "%ux%u: 니블이 하나 남음", c, r);
+
+    CLCD_GetStats(&st);
+    CHECK(st.busy_skips >= skips, "%ux%u: skip %u (예상 >= %u)", c, r, st.busy_skips, skips);
+    CHECK(st.errors == errors, "%ux%u: 에러 %u (예상 %u)", c, r, st.errors, errors);
+    CHECK(st.max_bytes <= (uint32_t)r * (c + 1u) * 4u, "%ux%u: 최대 %u B > 화면 전체", c, r, st.max_bytes);
+
+    printf("  %2ux%u | %5u %7u %7u %5u | %5u %4u | %4u %u\n", c, r, st.flushes, st.bytes,
+           st.flushes ? st.bytes / st.flushes : 0, st.max_bytes, st.cells, st.addr_cmds, st.busy_skips, st.errors);
+
+    /* 거리 숫자 3자리 */
+    Model_PrintLine(1, "DIST: 123cm");
+    Flush_All();
+    uint32_t n = (Model_PrintLine(1, "DIST: 456cm"), Flush_All());
+    CHECK(n == 16 && Screen_Ok(), "%ux%u: 숫자 3자리 갱신 %u B (예상 16)", c, r, n);
+}
+
+int main(void)
+{
+    printf("HD44780 + PCF8574 디코더 (무작위 갱신 %d번, 50번마다 skip/NACK/끊김/시작 실패)\n\n", ROUNDS);
+    printf("  크기 | flush   bytes B/flush   max | cells addr | skip err\n");    // 한글 2칸 폭으로 맞춤
+
+    Check_Geometry(16, 2);
+    Check_Geometry(20, 4);
+    Check_Geometry(16, 4);
+
+    printf("\n%s\n", fails ? "# FAIL" : "# OK");
+    return fails ? 1 : 0;
+}
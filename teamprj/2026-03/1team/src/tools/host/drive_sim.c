@@ -0,0 +1,191 @@
+/**
+ * @file drive_sim.c
+ * @brief 차동 구동 제어 시뮬레이션 (PC에서 실행) - drive_ctrl.c + 모터 모델
+ *
+ *   gcc -O2 -I../../Core/Inc drive_sim.c ../../Core/Src/drive_ctrl.c -o drive_sim
+ *   ./drive_sim            # 세 방식 비교
+ *   ./drive_sim -v         # 10ms마다 좌우 설정값/듀티/속도 출력 (closed)
+ *
+ * 모터 모델 (좌우 각각, 1ms 적분):
+ *   - 1차 지연: 속도' = (이득 × 유효 전압 - 속도 - 부하) / 시정수
+ *   - 유효 전압: 듀티가 정지 마찰(불감대)을 넘은 만큼만
+ *   - 오른쪽 모터가 10% 약함 (실제 TT 기어모터 편차 정도) → 개루프 직진이 휨
+ *   - 전류 ∝ 듀티 - 속도 (역기전력) → 출발/역회전 순간의 돌입 전류
+ *   - 엔코더: 최고속에서 MOTOR_ENC_FULL_US 간격 펄스 → motor.c와 같은 방식으로 속도 측정
+ *
+ * 비교:
+ *   bang   : 기존 방식 (ON/OFF, 듀티 0 또는 ±최대가 바로)
+ *   open   : 가감속 제한 + 불감대 보정 (엔코더 없음, 기본 설정)
+ *   closed : open + 좌우 PI (MOTOR_ENCODER=1)
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "drive_ctrl.h"
+
+#define SIM_DT_US       1000
+#define CTRL_EVERY      (1000000 / DRIVE_CTRL_HZ / SIM_DT_US)
+#define TAU_MS          80.0
+#define DEADZONE        280.0       // 실제 정지 마찰 (보정값 DRIVE_DUTY_MIN과 일부러 다르게)
+#define LOAD            20.0
+#define ENC_FULL_US     15000.0     // robot_config.h MOTOR_ENC_FULL_US
+#define ENC_TIMEOUT_US  200000u     // robot_config.h MOTOR_ENC_TIMEOUT_US
+
+#define BASE_SPEED      700         // robot_config.h MOTOR_BASE_SPEED
+#define TURN_SPEED      600
+
+enum { MODE_BANG, MODE_OPEN, MODE_CLOSED };
+
+typedef struct {
+    double   speed;         // 천분율
+    double   phase;         // 엔코더 위상 (펄스 단위)
+    uint32_t enc_last;
+    uint32_t enc_period;
+} Plant_t;
+
+typedef struct {
+    double peak_current;    // 정격 스톨 전류 = 1
+    double overshoot;       // 첫 전진 구간 좌우 평균 속도 최대 / 목표 - 1 (%)
+    double drift;           // 좌우 이동 거리 차이 합 (직진 구간) → 방향 틀어짐
+    int    rise_ms;         // 출발 → 좌우 평균 속도가 목표의 90% 도달
+    int    max_step;        // 1ms 사이 최대 듀티 변화 (충격)
+} Result_t;
+
+static const double gain[2] = { 1.00, 0.90 };
+
+/* 명령 시나리오 (ms): 정지 → 전진 → 제자리 좌회전 → 전진 → 후진 → 정지 */
+static void Command(uint32_t t_ms, int16_t *v, int16_t *w)
+{
+    *v = 0; *w = 0;
+    if (t_ms >= 100 && t_ms < 2100)  *v = BASE_SPEED;
+    if (t_ms >= 2100 && t_ms < 2900) *w = TURN_SPEED;
+    if (t_ms >= 2900 && t_ms < 4400) *v = BASE_SPEED;
+    if (t_ms >= 4400 && t_ms < 5400) *v = -BASE_SPEED;
+}
+
+static double Plant_Step(Plant_t *p, int16_t duty, double g, uint32_t now_us, Result_t *r)
+{
+    double u = duty;
+    double a = (u < 0) ? -u : u;
+    double eff = (a > DEADZONE) ? (a - DEADZONE) * 1000.0 / (1000.0 - DEADZONE) : 0.0;
+    if (u < 0) eff = -eff;
+
+    double drive = g * eff;
+    double load = (p->speed > 1) ? LOAD : (p->speed < -1) ? -LOAD : 0;
+    if (eff == 0 && p->speed > -LOAD && p->speed < LOAD) { load = 0; p->speed *= 0.5; }
+
+    p->speed += (drive - p->speed - load) * (SIM_DT_US / 1000.0) / TAU_MS;
+
+    double cur = (u - p->speed) / 1000.0;     // 정격 스톨 전류 = 1
+    if (cur < 0) cur = -cur;
+    if (cur > r->peak_current) r->peak_current = cur;
+
+    /* 엔코더 펄스 */
+    double sp = (p->speed < 0) ? -p->speed : p->speed;
+    p->phase += sp / 1000.0 * SIM_DT_US / ENC_FULL_US;
+    while (p->phase >= 1.0)
+    {
+        p->phase -= 1.0;
+        p->enc_period = now_us - p->enc_last;
+        p->enc_last = now_us;
+    }
+    return p->speed;
+}
+
+/* motor.c Control_Step 과 같은 측정 */
+static int16_t Measure(const Plant_t *p, uint32_t now, int16_t setpoint)
+{
+    uint32_t since = now - p->enc_last;
+    uint32_t per = p->enc_period;
+    if (since > per) per = since;
+    if (since > ENC_TIMEOUT_US) per = 0;
+
+    int16_t sp = Drive_SpeedFromPeriod(per, (uint32_t)ENC_FULL_US);
+    return (setpoint < 0) ? (int16_t)-sp : sp;
+}
+
+static Result_t Run(int mode, int verbose)
+{
+    Drive_t d;
+    Plant_t plant[2];
+    Result_t r = { 0 };
+    int16_t duty[2] = { 0, 0 }, prev[2] = { 0, 0 };
+    double dist[2] = { 0, 0 };
+
+    memset(plant, 0, sizeof(plant));
+    Drive_Init(&d, mode == MODE_CLOSED);
+    r.rise_ms = -1;
+
+    for (uint32_t t = 0; t < 6000; t++)
+    {
+        uint32_t now = t * SIM_DT_US + 1;
+        int16_t v, w;
+        Command(t, &v, &w);
+
+        if (t % CTRL_EVERY == 0)
+        {
+            if (mode == MODE_BANG)
+            {
+                int32_t l = v - w, rr = v + w;
+                duty[0] = (int16_t)((l > 0) ? 1000 : (l < 0) ? -1000 : 0);
+                duty[1] = (int16_t)((rr > 0) ? 1000 : (rr < 0) ? -1000 : 0);
+            }
+            else
+            {
+                int16_t meas[2] = { Measure(&plant[0], now, d.setpoint[0]), Measure(&plant[1], now, d.setpoint[1]) };
+                Drive_SetVW(&d, v, w);
+                Drive_Step(&d, meas);
+                duty[0] = d.duty[0];
+                duty[1] = d.duty[1];
+            }
+        }
+
+        for (int s = 0; s < 2; s++)
+        {
+            int step = duty[s] - prev[s];
+            if (step < 0) step = -step;
+            if (step > r.max_step) r.max_step = step;
+            prev[s] = duty[s];
+
+            double sp = Plant_Step(&plant[s], duty[s], gain[s], now, &r);
+            dist[s] += sp;
+        }
+
+        /* 첫 전진 구간: 90% 도달 시간, 좌우 거리 차이 */
+        if (t >= 100 && t < 2100)
+        {
+            double target = (mode == MODE_BANG) ? (1000.0 - LOAD) * (gain[0] + gain[1]) / 2 : BASE_SPEED;
+            double avg = (plant[0].speed + plant[1].speed) / 2;
+            if (r.rise_ms < 0 && avg >= 0.9 * target)
+                r.rise_ms = (int)(t - 100);
+            if ((avg / target - 1.0) * 100.0 > r.overshoot)
+                r.overshoot = (avg / target - 1.0) * 100.0;
+        }
+        if (t == 2100)
+            r.drift = (dist[0] - dist[1]) / 1000.0;
+
+        if (verbose && mode == MODE_CLOSED && t % 10 == 0)
+            printf("%5u v %5d w %5d | sp %5d %5d duty %5d %5d | speed %6.1f %6.1f\n",
+                   (unsigned)t, v, w, d.setpoint[0], d.setpoint[1], duty[0], duty[1],
+                   plant[0].speed, plant[1].speed);
+    }
+    return r;
+}
+
+int main(int argc, char **argv)
+{
+    int verbose = (argc > 1 && strcmp(argv[1], "-v") == 0);
+    static const char *names[] = { "bang", "open", "closed" };
+
+    Result_t res[3];
+    for (int m = 0; m < 3; m++)
+        res[m] = Run(m, verbose);
+    if (verbose) return 0;
+
+    printf("시나리오: 전진 2s → 좌회전 0.8s → 전진 1.5s → 후진 1s (오른쪽 모터 10%% 약함)\n");
+    printf("mode    rise(90%%)  overshoot  peak_I  max_duty_step  drift(직진 2s, 좌-우)\n");
+    for (int m = 0; m < 3; m++)
+        printf("%-7s %6d ms  %6.1f%%    %6.2f  %6d         %+8.2f\n", names[m], res[m].rise_ms,
+               res[m].overshoot, res[m].peak_current, res[m].max_step, res[m].drift);
+    return 0;
+}
@@ -0,0 +1,384 @@
+/**
+ * @file gfx_bench.c
+ * @brief span 래스터라이저 측정 (PC에서 실행) - 이전 도형별 HLine 경로와 SPI 명령/창/바이트/호스트 사이클 비교
+ *
+ *   gcc -O2 -fno-tree-vectorize -Wall -Ivboard -I../../Core/Inc gfx_bench.c spi_count.c \
+ *       ../../Core/Src/drivers/lcd_st7735.c ../../Core/Src/drivers/lcd_gfx.c -o gfx_bench
+ *   ./gfx_bench                 # 표 + 화면 검사, 종료 코드 0 = 통과
+ *
+ * 경로 (HAL SPI 는 spi_count.c 대역, 전송은 셋 다 지금 드라이버):
+ *   이전 = user-003 전 lcd_gfx.c 를 그대로 옮김 (수평선마다 창, ThickLine 은 Bresenham 점마다 FillCircle)
+ *   span = 지금 LCD_* (도형 하나씩 Gfx_DrawShapes)
+ *   목록 = 표정 하나의 도형 전부를 Gfx_DrawShapes 한 번에 (도형 사이 겹침도 병합)
+ * 검사:
+ *   1. span 과 목록의 화면(디코드한 GRAM)이 같음
+ *   2. 사각형/둥근 사각형만 쓰는 장면은 이전 경로와도 화면이 같고 바이트 <= 이전 (겹쳐 그리기만 사라짐)
+ *      원은 중점 원 → 행마다 isqrt 반폭, ThickLine 은 원 도장 → 평행 띠 + 원 캡으로 바뀌어
+ *      테두리 픽셀이 다름 (개수만 출력)
+ *   3. span/목록 창 수 <= 이전
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "stm32f1xx_hal.h"
+#include "drivers/lcd_st7735.h"
+#include "drivers/lcd_gfx.h"
+#include "drivers/eyes.h"
+#include "spi_count.h"
+
+#define REPEAT      50
+#define BLACK       0x0000
+#define EYE_COLOR   0x07E0
+#define LX          40
+#define RX          120
+#define CY          40
+
+static uint16_t gram_old[256][256];
+static uint16_t gram_span[256][256];
+static int fails = 0;
+
+#define CHECK(cond, ...) do { if (!(cond)) { printf("  FAIL: " __VA_ARGS__); printf("\n"); fails++; } } while (0)
+
+/* ===== 이전 경로 (user-003 전 lcd_gfx.c) ===== */
+
+static void Old_FillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
+{
+    if (x < 0) { w += x; x = 0; }
+    if (y < 0) { h += y; y = 0; }
+    if (x + w > LCD_WIDTH)  w = LCD_WIDTH - x;
+    if (y + h > LCD_HEIGHT) h = LCD_HEIGHT - y;
+    if (w <= 0 || h <= 0) return;
+
+    LCD_SetWindow(x, y, x + w - 1, y + h - 1);
+    LCD_WriteColorFast(color, (uint32_t)w * h);
+}
+
+static void Old_HLine(int16_t x, int16_t y, int16_t w, uint16_t color)
+{
+    if (y < 0 || y >= LCD_HEIGHT) return;
+    if (x < 0) { w += x; x = 0; }
+    if (x + w > LCD_WIDTH) w = LCD_WIDTH - x;
+    if (w <= 0) return;
+
+    LCD_SetWindow(x, y, x + w - 1, y);
+    LCD_WriteColorFast(color, w);
+}
+
+static void Old_FillCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color)
+{
+    int16_t x = r;
+    int16_t y = 0;
+    int16_t err = 1 - r;
+
+    Old_HLine(x0 - r, y0, 2 * r + 1, color);
+
+    while (x >= y)
+    {
+        y++;
+
+        if (err < 0)
+        {
+            err += 2 * y + 1;
+        }
+        else
+        {
+            Old_HLine(x0 - x, y0 + y, 2 * x + 1, color);
+            Old_HLine(x0 - x, y0 - y, 2 * x + 1, color);
+            x--;
+            err += 2 * (y - x + 1);
+        }
+
+        if (x >= y)
+        {
+            Old_HLine(x0 - y, y0 + x, 2 * y + 1, color);
+            Old_HLine(x0 - y, y0 - x, 2 * y + 1, color);
+        }
+    }
+}
+
+static void Old_RoundRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, uint16_t color)
+{
+    if (r > w / 2) r = w / 2;
+    if (r > h / 2) r = h / 2;
+    if (r < 1) r = 1;
+
+    Old_FillRect(x + r, y, w - 2 * r, h, color);
+    Old_FillRect(x, y + r, r, h - 2 * r, color);
+    Old_FillRect(x + w - r, y + r, r, h - 2 * r, color);
+
+    int16_t cx, cy;
+    int16_t px = r, py = 0;
+    int16_t err = 1 - r;
+
+    while (px >= py)
+    {
+        cx = x + r; cy = y + r;
+        Old_HLine(cx - px, cy - py, px, color);
+        Old_HLine(cx - py, cy - px, py, color);
+
+        cx = x + w - r - 1; cy = y + r;
+        Old_HLine(cx + 1, cy - py, px, color);
+        Old_HLine(cx + 1, cy - px, py, color);
+
+        cx = x + r; cy = y + h - r - 1;
+        Old_HLine(cx - px, cy + py, px, color);
+        Old_HLine(cx - py, cy + px, py, color);
+
+        cx = x + w - r - 1; cy = y + h - r - 1;
+        Old_HLine(cx + 1, cy + py, px, color);
+        Old_HLine(cx + 1, cy + px, py, color);
+
+        py++;
+        if (err < 0)
+        {
+            err += 2 * py + 1;
+        }
+        else
+        {
+            px--;
+            err += 2 * (py - px + 1);
+        }
+    }
+}
+
+static void Old_ThickLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t t, uint16_t color)
+{
+    int16_t dx = (x1 > x0) ? (x1 - x0) : (x0 - x1);
+    int16_t dy = (y1 > y0) ? (y1 - y0) : (y0 - y1);
+    int16_t sx = (x0 < x1) ? 1 : -1;
+    int16_t sy = (y0 < y1) ? 1 : -1;
+    int16_t err = dx - dy;
+    int16_t r = t / 2;
+
+    while (1)
+    {
+        if (t <= 2)
+            Old_FillRect(x0 - r, y0 - r, t, t, color);
+        else
+            Old_FillCircle(x0, y0, r, color);
+
+        if (x0 == x1 && y0 == y1) break;
+
+        int16_t e2 = 2 * err;
+        if (e2 > -dy) { err -= dy; x0 += sx; }
+        if (e2 <  dx) { err += dx; y0 += sy; }
+    }
+}
+
+/* ===== 목록 경로: 도형을 모아 두었다가 한 번에 ===== */
+
+static GfxShape_t list[GFX_MAX_SHAPES];
+static uint8_t list_n;
+
+static void List_Add(uint8_t type, int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t r, uint16_t color)
+{
+    if (list_n >= GFX_MAX_SHAPES) return;
+    GfxShape_t s = { type, x0, y0, x1, y1, r, color, 0 };
+    list[list_n++] = s;
+}
+
+static void List_FillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
+{
+    List_Add(GFX_RECT, x, y, x + w - 1, y + h - 1, 0, color);
+}
+
+static void List_RoundRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, uint16_t color)
+{
+    List_Add(GFX_RRECT, x, y, x + w - 1, y + h - 1, r, color);
+}
+
+static void List_FillCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color)
+{
+    List_Add(GFX_CIRCLE, x0, y0, x0, y0, r, color);
+}
+
+static void List_ThickLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t t, uint16_t color)
+{
+    List_Add(GFX_LINE, x0, y0, x1, y1, t, color);
+}
+
+/* ===== 장면: 표정 도형 (eyes.c Eye_* 와 같음) + 도형 하나씩 ===== */
+
+typedef struct {
+    void (*fill_rect)(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t c);
+    void (*round_rect)(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, uint16_t c);
+    void (*fill_circle)(int16_t x0, int16_t y0, int16_t r, uint16_t c);
+    void (*thick_line)(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t t, uint16_t c);
+} Canvas_t;
+
+typedef enum { PATH_OLD = 0, PATH_SPAN, PATH_LIST, PATH_COUNT } Path_t;
+
+static const Canvas_t canvas[PATH_COUNT] = {
+    [PATH_OLD]  = { Old_FillRect, Old_RoundRect, Old_FillCircle, Old_ThickLine },
+    [PATH_SPAN] = { LCD_FillRect, LCD_RoundRect, LCD_FillCircle, LCD_ThickLine },
+    [PATH_LIST] = { List_FillRect, List_RoundRect, List_FillCircle, List_ThickLine },
+};
+
+static void Eye(const Canvas_t *cv, Expression_t e, int16_t cx, int8_t dir)
+{
+    switch (e)
+    {
+        case EXPR_NEUTRAL:
+            cv->round_rect(cx - 15, CY - 25, 30, 50, 10, EYE_COLOR);
+            break;
+        case EXPR_BLINK:
+        case EXPR_SLEEPY:
+            cv->fill_rect(cx - 15, CY - 3, 30, 6, EYE_COLOR);
+            break;
+        case EXPR_HAPPY:
+            cv->round_rect(cx - 15, CY - 5, 30, 25, 12, EYE_COLOR);
+            break;
+        case EXPR_ANGRY:
+            cv->thick_line(cx - 15, CY - 20 + (dir < 0 ? 15 : 0), cx + 15, CY - 20 + (dir < 0 ? 0 : 15), 4, EYE_COLOR);
+            break;
+        case EXPR_SAD:
+            cv->thick_line(cx - 12, CY - 10 + (dir < 0 ? 0 : 8), cx + 12, CY - 10 + (dir < 0 ? 8 : 0), 3, EYE_COLOR);
+            cv->fill_rect(cx - 10, CY, 20, 4, EYE_COLOR);
+            break;
+        case EXPR_LOOK_LEFT:
+            cv->round_rect(cx - 15, CY - 25, 30, 50, 10, EYE_COLOR);
+            cv->fill_rect(cx - 12, CY - 10, 8, 20, BLACK);
+            break;
+        case EXPR_LOOK_RIGHT:
+            cv->round_rect(cx - 15, CY - 25, 30, 50, 10, EYE_COLOR);
+            cv->fill_rect(cx + 4, CY - 10, 8, 20, BLACK);
+            break;
+    }
+}
+
+typedef struct {
+    const char *name;
+    int         expr;       // -1 = 아래 shape 하나
+    uint8_t     exact;      // 이전 경로와 화면이 같아야 함 (사각형/둥근 사각형만)
+    void      (*shape)(const Canvas_t *cv);
+} Scene_t;
+
+static void Shape_RoundRect(const Canvas_t *cv) { cv->round_rect(65, 15, 30, 50, 10, EYE_COLOR); }
+static void Shape_Circle(const Canvas_t *cv)    { cv->fill_circle(80, 40, 10, EYE_COLOR); }
+static void Shape_Line(const Canvas_t *cv)      { cv->thick_line(65, 35, 95, 20, 4, EYE_COLOR); }
+
+static const Scene_t scenes[] = {
+    { "RoundRect 30x50 r10", -1, 1, Shape_RoundRect },
+    { "FillCircle r10",      -1, 0, Shape_Circle },
+    { "ThickLine 30px t4",   -1, 0, Shape_Line },
+    { "NEUTRAL",     EXPR_NEUTRAL,    1, NULL },
+    { "BLINK",       EXPR_BLINK,      1, NULL },
+    { "HAPPY",       EXPR_HAPPY,      1, NULL },
+    { "ANGRY",       EXPR_ANGRY,      0, NULL },
+    { "SAD",         EXPR_SAD,        0, NULL },
+    { "LOOK_LEFT",   EXPR_LOOK_LEFT,  1, NULL },
+    { "LOOK_RIGHT",  EXPR_LOOK_RIGHT, 1, NULL },
+};
+
+static const char *path_name[PATH_COUNT] = { "이전 ", "span ", "목록 " };   // 표에서 5칸
+
+static void Draw(const Scene_t *s, Path_t p)
+{
+    const Canvas_t *cv = &canvas[p];
+
+    list_n = 0;
+    if (s->expr < 0)
+    {
+        s->shape(cv);
+    }
+    else
+    {
+        Eye(cv, (Expression_t)s->expr, LX, -1);
+        Eye(cv, (Expression_t)s->expr, RX, +1);
+    }
+    if (p == PATH_LIST) Gfx_DrawShapes(list, list_n);
+    LCD_WaitIdle();
+}
+
+/* 검은 화면에서 시작, 사이클은 픽셀 디코드 없이 REPEAT 번 중 최소, 카운터는 마지막 1번 (디코드 포함) */
+static uint64_t Run(const Scene_t *s, Path_t p)
+{
+    uint64_t best = UINT64_MAX;
+
+    spi_gram_on = 0;
+    for (int r = 0; r < REPEAT; r++)
+    {
+        uint64_t c0 = SpiCount_Cycles();
+        Draw(s, p);
+        SpiCount_Pump();
+        uint64_t c1 = SpiCount_Cycles();
+        if (c1 - c0 < best) best = c1 - c0;
+    }
+
+    spi_gram_on = 1;
+    memset(spi_gram, 0, sizeof(spi_gram));      // BLACK
+    SpiCount_Reset();
+    Draw(s, p);
+    SpiCount_Pump();
+    return best;
+}
+
+static uint32_t Gram_Diff(uint16_t (*a)[256], uint16_t (*b)[256])
+{
+    uint32_t n = 0;
+    for (int y = 0; y < 256; y++)
+        for (int x = 0; x < 256; x++)
+            n += a[y][x] != b[y][x];
+    return n;
+}
+
+int main(void)
+{
+    LCD_Init();
+    printf("도형 래스터라이즈 (검은 화면에 한 번 그리기, 명령 = DC=LOW 바이트, 창 = RAMWR, 사이클 = %d번 중 최소)\n\n",
+           REPEAT);
+    printf("  장면                 경로    명령    창   바이트       cyc\n");     // 한글 2칸 폭으로 맞춤
+
+    SpiCount_t tot[PATH_COUNT];
+    memset(tot, 0, sizeof(tot));
+
+    for (size_t i = 0; i < sizeof(scenes) / sizeof(scenes[0]); i++)
+    {
+        const Scene_t *s = &scenes[i];
+        SpiCount_t k[PATH_COUNT];
+
+        for (int p = 0; p < PATH_COUNT; p++)
+        {
+            uint64_t cyc = Run(s, (Path_t)p);
+            k[p] = spi_count;
+            if (s->expr >= 0)
+            {
+                tot[p].cmds += k[p].cmds;
+                tot[p].windows += k[p].windows;
+                tot[p].bytes += k[p].bytes;
+            }
+            printf("  %-20s %s %6u %5u %8llu %9llu\n", p == 0 ? s->name : "", path_name[p],
+                   k[p].cmds, k[p].windows, (unsigned long long)k[p].bytes, (unsigned long long)cyc);
+
+            if (p == PATH_OLD) memcpy(gram_old, spi_gram, sizeof(gram_old));
+            if (p == PATH_SPAN) memcpy(gram_span, spi_gram, sizeof(gram_span));
+        }
+
+        /* 지금 spi_gram = 목록 경로 */
+        CHECK(Gram_Diff(spi_gram, gram_span) == 0, "%s: 목록 경로 화면이 span 과 다름", s->name);
+        uint32_t diff = Gram_Diff(gram_span, gram_old);
+        if (s->exact) CHECK(diff == 0, "%s: span 화면이 이전 경로와 %u 픽셀 다름", s->name, diff);
+        else if (diff) printf("  %-20s (이전 경로와 테두리 %u 픽셀 다름)\n", "", diff);
+
+        for (int p = PATH_SPAN; p < PATH_COUNT; p++)
+        {
+            CHECK(k[p].windows <= k[PATH_OLD].windows, "%s %s: 창 %u > 이전 %u", s->name, path_name[p],
+                  k[p].windows, k[PATH_OLD].windows);
+            if (s->exact)
+                CHECK(k[p].bytes <= k[PATH_OLD].bytes, "%s %s: 바이트 %llu > 이전 %llu", s->name, path_name[p],
+                      (unsigned long long)k[p].bytes, (unsigned long long)k[PATH_OLD].bytes);
+        }
+    }
+
+    printf("\n  표정 7개 합계 (SLEEPY = BLINK 제외)\n");
+    for (int p = 0; p < PATH_COUNT; p++)
+        printf("  %s 명령 %6u  창 %5u  바이트 %8llu\n", path_name[p], tot[p].cmds, tot[p].windows,
+               (unsigned long long)tot[p].bytes);
+
+    LCD_BusStats_t st;
+    LCD_GetBusStats(&st);
+    CHECK(st.errors == 0, "드라이버 DMA 오류/타임아웃 %u", st.errors);
+
+    printf("\n%s\n", fails ? "# FAIL" : "# OK");
+    return fails ? 1 : 0;
+}
@@ -0,0 +1,201 @@
+/**
+ * @file lcd_bench.c
+ * @brief ST7735 핑퐁 DMA 파이프라인 측정 (PC에서 실행) - 이전 블로킹 경로와 바이트/호스트 사이클 비교
+ *
+ *   gcc -O2 -fno-tree-vectorize -Wall -Ivboard -I../../Core/Inc lcd_bench.c spi_count.c ../../Core/Src/drivers/lcd_st7735.c -o lcd_bench
+ *   ./lcd_bench                 # 표 + 화면/바이트 검사, 종료 코드 0 = 통과
+ *
+ * HAL SPI 는 spi_count.c 대역 (바이트만 세고 바로 끝남) → 호스트 사이클은 드라이버 코드 비용
+ * -fno-tree-vectorize: Cortex-M3 에는 SIMD 가 없으므로 리필 루프를 PC 에서도 스칼라로 비교
+ * 이전 경로는 user-001 전 lcd_st7735.c 를 그대로 옮김:
+ *   - WriteColorFast: 128B 버퍼를 HAL_SPI_Transmit 로 반복 (CPU가 전송 내내 대기)
+ *   - WriteBuffer: 64픽셀마다 DMA 를 걸고 끝날 때까지 돌았음 → 여기서는 같은 크기의 블로킹 전송
+ * 열:
+ *   대기 B  = CPU가 버스를 기다린 바이트 (보드에서 1B = 1us 멈춤)
+ *   제출 cyc = 함수가 돌아올 때까지, 합계 cyc = DMA 완료 콜백(리필) 포함 (반복 중 최소)
+ *   B/cyc   = 전송 바이트 / 합계 사이클
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "stm32f1xx_hal.h"
+#include "drivers/lcd_st7735.h"
+#include "spi_count.h"
+
+#define REPEAT      50
+#define OLD_BUF     128
+
+extern SPI_HandleTypeDef hspi2;
+
+static uint16_t image[LCD_WIDTH * LCD_HEIGHT];
+static uint16_t gram_old[256][256];
+static int fails = 0;
+
+#define CHECK(cond, ...) do { if (!(cond)) { printf("  FAIL: " __VA_ARGS__); printf("\n"); fails++; } } while (0)
+
+/* ===== 이전 경로 (블로킹) ===== */
+
+#define OLD_DATA_BEGIN()    (GPIOA->BSRR = GPIO_PIN_8, GPIOB->BRR = GPIO_PIN_12)    // DC=HIGH, CS=LOW
+#define OLD_DATA_END()      (GPIOB->BSRR = GPIO_PIN_12)
+
+static void Old_WriteColor(uint16_t color, uint32_t count)
+{
+    static uint8_t buf[OLD_BUF];
+
+    for (int i = 0; i < OLD_BUF; i += 2)
+    {
+        buf[i]     = color >> 8;
+        buf[i + 1] = color & 0xFF;
+    }
+    OLD_DATA_BEGIN();
+    while (count > 0)
+    {
+        uint32_t chunk = (count >= OLD_BUF / 2) ? OLD_BUF / 2 : count;
+        HAL_SPI_Transmit(&hspi2, buf, (uint16_t)(chunk * 2), HAL_MAX_DELAY);
+        count -= chunk;
+    }
+    OLD_DATA_END();
+}
+
+static void Old_WriteBuffer(const uint16_t *src, uint32_t count)
+{
+    static uint8_t buf[OLD_BUF];
+
+    OLD_DATA_BEGIN();
+    while (count > 0)
+    {
+        uint32_t chunk = (count > OLD_BUF / 2) ? OLD_BUF / 2 : count;
+        for (uint32_t i = 0; i < chunk; i++)
+        {
+            buf[i * 2]     = src[i] >> 8;
+            buf[i * 2 + 1] = src[i] & 0xFF;
+        }
+        HAL_SPI_Transmit(&hspi2, buf, (uint16_t)(chunk * 2), HAL_MAX_DELAY);
+        src += chunk;
+        count -= chunk;
+    }
+    OLD_DATA_END();
+}
+
+/* ===== 시나리오 (mode 0 = 이전, 1 = 새 경로 + 대기, 2 = 새 경로 제출만) ===== */
+
+typedef struct {
+    const char *name;
+    void (*run)(int mode);
+} Scene_t;
+
+static void Scene_Clear(int mode)
+{
+    LCD_SetWindow(0, 0, LCD_WIDTH - 1, LCD_HEIGHT - 1);
+    if (mode == 0) Old_WriteColor(0x07E0, (uint32_t)LCD_WIDTH * LCD_HEIGHT);
+    else LCD_WriteColorFast(0x07E0, (uint32_t)LCD_WIDTH * LCD_HEIGHT);
+    if (mode == 1) LCD_WaitIdle();
+}
+
+static void Scene_Image(int mode)
+{
+    LCD_SetWindow(0, 0, LCD_WIDTH - 1, LCD_HEIGHT - 1);
+    if (mode == 0) Old_WriteBuffer(image, (uint32_t)LCD_WIDTH * LCD_HEIGHT);
+    else if (mode == 1) LCD_WriteBuffer(image, (uint32_t)LCD_WIDTH * LCD_HEIGHT);
+    else LCD_SubmitBuffer(image, (uint32_t)LCD_WIDTH * LCD_HEIGHT);
+}
+
+static void Scene_Tiles(int mode)
+{
+    for (uint16_t y = 0; y + 10 <= LCD_HEIGHT; y += 10)
+    {
+        for (uint16_t x = 0; x + 10 <= LCD_WIDTH; x += 10)
+        {
+            uint16_t c = (uint16_t)(x * 409 + y * 1031);
+            LCD_SetWindow(x, y, x + 9, y + 9);      // 이전 span 완료 대기 포함
+            if (mode == 0) Old_WriteColor(c, 100);
+            else LCD_SubmitColor(c, 100);
+        }
+    }
+    if (mode == 1) LCD_WaitIdle();
+}
+
+static const Scene_t scenes[] = {
+    { "전체 단색 160x80",    Scene_Clear },
+    { "이미지 160x80",       Scene_Image },
+    { "10x10 사각형 128개",  Scene_Tiles },
+};
+
+static const char *mode_name[] = { "이전 (블로킹)", "새 + 대기", "새 (제출만)" };
+
+/* 사이클은 픽셀 디코드 없이 REPEAT 번 중 최소 (호스트 잡음 제거), 그 뒤 1번 더 디코드해서 gram 에 그림 */
+static void Run(const Scene_t *s, int mode)
+{
+    uint64_t submit = UINT64_MAX, total = UINT64_MAX;
+
+    spi_gram_on = 0;
+    SpiCount_Reset();
+    for (int r = 0; r < REPEAT; r++)
+    {
+        uint64_t c0 = SpiCount_Cycles();
+        s->run(mode);
+        uint64_t c1 = SpiCount_Cycles();
+        SpiCount_Pump();                    // 남은 DMA = 인터럽트
+        uint64_t c2 = SpiCount_Cycles();
+        if (c1 - c0 < submit) submit = c1 - c0;
+        if (c2 - c0 < total)  total  = c2 - c0;
+    }
+
+    SpiCount_t k = spi_count;
+
+    spi_gram_on = 1;
+    memset(spi_gram, 0, sizeof(spi_gram));
+    SpiCount_Reset();
+    s->run(mode);
+    SpiCount_Pump();
+
+    printf("  %-14s %7llu  %5u  %4u/%-5u %7llu  %9llu  %9llu  %6.3f\n", mode_name[mode],
+           (unsigned long long)(k.bytes / REPEAT), k.windows / REPEAT, k.blk_calls / REPEAT, k.dma_calls / REPEAT,
+           (unsigned long long)(k.wait_bytes / REPEAT),
+           (unsigned long long)submit, (unsigned long long)total,
+           (double)k.bytes / REPEAT / (double)total);
+}
+
+int main(void)
+{
+    for (uint32_t i = 0; i < LCD_WIDTH * LCD_HEIGHT; i++)
+        image[i] = (uint16_t)(i * 2654435761u >> 16);
+
+    LCD_Init();
+    printf("ST7735 전송 경로 (프레임당, %d번 반복 중 최소 사이클, 사이클 = 호스트 %s)\n", REPEAT,
+#if defined(__x86_64__) || defined(__i386__)
+           "TSC"
+#else
+           "ns"
+#endif
+           );
+
+    for (size_t i = 0; i < sizeof(scenes) / sizeof(scenes[0]); i++)
+    {
+        const Scene_t *s = &scenes[i];
+        printf("\n%s\n  %-14s %7s  %5s  %10s %7s  %9s  %9s  %6s\n", s->name,
+               "경로", "바이트", "창", "블록/DMA", "대기 B", "제출 cyc", "합계 cyc", "B/cyc");
+
+        Run(s, 0);
+        uint64_t old_bytes = spi_count.bytes;
+        memcpy(gram_old, spi_gram, sizeof(gram_old));
+
+        for (int mode = 1; mode <= 2; mode++)
+        {
+            Run(s, mode);
+            CHECK(spi_count.bytes == old_bytes, "%s %s: 바이트 %llu (이전 %llu)", s->name, mode_name[mode],
+                  (unsigned long long)spi_count.bytes, (unsigned long long)old_bytes);
+            CHECK(memcmp(spi_gram, gram_old, sizeof(gram_old)) == 0, "%s %s: 화면이 이전 경로와 다름", s->name, mode_name[mode]);
+            if (mode == 2 && spi_count.windows == 1)     // 창 1개: 픽셀은 전부 DMA 뒤에서
+                CHECK(spi_count.wait_bytes == 11u,
+                      "%s: 제출 경로가 픽셀 전송을 기다림 (대기 %llu B)", s->name, (unsigned long long)spi_count.wait_bytes);
+        }
+    }
+
+    LCD_BusStats_t st;
+    LCD_GetBusStats(&st);
+    CHECK(st.errors == 0, "드라이버 DMA 오류/타임아웃 %u", st.errors);
+
+    printf("\n%s\n", fails ? "# FAIL" : "# OK");
+    return fails ? 1 : 0;
+}
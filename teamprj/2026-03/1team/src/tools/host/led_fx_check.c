@@ -0,0 +1,200 @@
+/**
+ * @file led_fx_check.c
+ * @brief RGB LED 효과 플레이어 검사기 (PC에서 실행) - led_fx.c 출력을 보드와 같은 순서로 돌려 검사
+ *
+ *   gcc -O2 -Wall -I../../Core/Inc led_fx_check.c ../../Core/Src/drivers/led_fx.c -o led_fx_check
+ *   ./led_fx_check              # 에지 표 검사 + 내장 효과 전부 (타임라인, 평균 듀티), 종료 코드 0 = 통과
+ *   ./led_fx_check idle         # 효과 하나만, 100ms마다 밝기 막대
+ *
+ * 보드와 같은 경로 (drivers/rgb_led.c):
+ *   - RGB_FRAME_PERIODS × RGB_PWM_US 마다 LedFx_Step(), 바뀌면 LedFx_Compile()
+ *   - 주기 시작에 on 켜고 t[k]에 off[k] 끔 → 1us 단위로 핀 상태를 재서 채널별 켜짐 시간
+ * 검사:
+ *   1. 밝기 0~255 조합마다 에지 표: 오름차순, 간격/양 끝 min_us 이상, 채널당 끄기 1번, 켜짐 시간 오차 < min_us
+ *   2. 효과마다: 시작 밝기, 끝나는 시각 (repeat × 주기), 끝난 뒤 밝기 (깜빡임 = b, 숨쉬기 = a, 페이드 = b)
+ *   3. 깜빡임: 밝기가 바뀌는 시각이 반주기 경계에서 한 프레임 안쪽
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "drivers/led_fx.h"
+
+#define PWM_US          2000        // robot_config.h RGB_PWM_US
+#define PWM_MIN_US      8           // RGB_PWM_MIN_US
+#define FRAME_PERIODS   10          // RGB_FRAME_PERIODS
+#define FRAME_MS        (FRAME_PERIODS * PWM_US / 1000)
+#define RUN_MS          6000        // 무한 반복 효과를 돌려볼 시간
+
+static const uint16_t pins[LEDFX_CH] = { 1u << 5, 1u << 6, 1u << 8 };   // PC5, PC6, PC8
+static const char ch_name[LEDFX_CH] = { 'R', 'G', 'B' };
+static int fails = 0;
+
+#define CHECK(cond, ...) do { if (!(cond)) { printf("  FAIL: " __VA_ARGS__); printf("\n"); fails++; } } while (0)
+
+/* ===== PWM 한 주기 재생 → 채널별 켜짐 us ===== */
+static void Frame_OnTime(const LedFxFrame_t *f, uint32_t on_us[LEDFX_CH])
+{
+    uint16_t odr = f->on;
+    uint8_t k = 0;
+
+    for (uint8_t c = 0; c < LEDFX_CH; c++) on_us[c] = 0;
+    for (uint16_t t = 0; t < PWM_US; t++)
+    {
+        while (k < f->n && f->t[k] == t) odr &= (uint16_t)~f->off[k++];
+        for (uint8_t c = 0; c < LEDFX_CH; c++)
+            if (odr & pins[c]) on_us[c]++;
+    }
+}
+
+/* ===== 검사 1: 에지 표 ===== */
+static void Check_Compile(void)
+{
+    uint32_t tables = 0;
+    uint32_t max_err = 0;
+    uint8_t lv[LEDFX_CH];
+    LedFxFrame_t f;
+
+    for (uint16_t r = 0; r < 256; r += 5)
+    for (uint16_t g = 0; g < 256; g += 3)
+    for (uint16_t b = 0; b < 256; b += 7)
+    {
+        lv[0] = (uint8_t)r; lv[1] = (uint8_t)g; lv[2] = (uint8_t)b;
+        LedFx_Compile(lv, pins, PWM_US, PWM_MIN_US, &f);
+        tables++;
+
+        uint16_t seen = 0;
+        for (uint8_t k = 0; k < f.n; k++)
+        {
+            uint16_t prev = k ? f.t[k - 1] : 0;
+            if (f.t[k] < prev + PWM_MIN_US || f.t[k] > PWM_US - PWM_MIN_US || (f.off[k] & seen) || (f.off[k] & ~f.on))
+            {
+                CHECK(0, "표 %u/%u/%u 에지 %u (t %u, off 0x%03X)", r, g, b, k, f.t[k], f.off[k]);
+                return;
+            }
+            seen |= f.off[k];
+        }
+
+        uint32_t on_us[LEDFX_CH];
+        Frame_OnTime(&f, on_us);
+        for (uint8_t c = 0; c < LEDFX_CH; c++)
+        {
+            uint32_t want = LedFx_OnTime(lv[c], PWM_US);
+            uint32_t err = (on_us[c] > want) ? on_us[c] - want : want - on_us[c];
+            if (err > max_err) max_err = err;
+            if (err >= PWM_MIN_US)
+            {
+                CHECK(0, "표 %u/%u/%u %c 켜짐 %uus (기대 %uus)", r, g, b, ch_name[c], on_us[c], want);
+                return;
+            }
+        }
+    }
+    printf("에지 표 %u개: 켜짐 시간 최대 오차 %uus (< %uus)\n\n", tables, max_err, PWM_MIN_US);
+}
+
+/* ===== 검사 2, 3: 효과 재생 ===== */
+static void Play_Effect(LedFxId_t id, uint8_t bars)
+{
+    const char *name;
+    const LedFx_t *fx = LedFx_Effect(id, &name);
+    LedFxPlay_t p;
+    LedFxFrame_t f;
+    uint32_t on_us[LEDFX_CH];
+    uint64_t sum_us[LEDFX_CH] = { 0 };
+    uint32_t compiles = 1, edges = 0, t_ms = 0, done_ms = 0, changes = 0;
+    uint8_t prev[LEDFX_CH];
+
+    printf("%-9s kind %u repeat %u period %ums\n", name, fx->kind, fx->repeat, fx->period_ms);
+
+    LedFx_Start(&p, fx);
+    CHECK(memcmp(p.level, fx->a, LEDFX_CH) == 0, "%s 시작 밝기가 a가 아님", name);
+    LedFx_Compile(p.level, pins, PWM_US, PWM_MIN_US, &f);
+    memcpy(prev, p.level, LEDFX_CH);
+
+    while (t_ms < RUN_MS)
+    {
+        /* 한 프레임 = FRAME_PERIODS 주기 (에지가 없으면 보드는 인터럽트 1번) */
+        Frame_OnTime(&f, on_us);
+        for (uint8_t c = 0; c < LEDFX_CH; c++) sum_us[c] += (uint64_t)on_us[c] * FRAME_PERIODS;
+        edges += (uint32_t)f.n * FRAME_PERIODS;
+
+        if (bars && t_ms % 100 == 0)
+        {
+            printf("  %5ums", t_ms);
+            for (uint8_t c = 0; c < LEDFX_CH; c++)
+                printf("  %c %3u %-16.*s", ch_name[c], p.level[c], p.level[c] / 16, "################");
+            printf("\n");
+        }
+
+        if (p.done) break;
+        t_ms += FRAME_MS;
+        if (LedFx_Step(&p, FRAME_MS))
+        {
+            LedFx_Compile(p.level, pins, PWM_US, PWM_MIN_US, &f);
+            compiles++;
+        }
+        if (p.done && done_ms == 0) done_ms = t_ms;
+
+        /* 깜빡임: 바뀌는 시각 = 반주기 경계 (프레임 단위로 늦을 수 있음) */
+        if (fx->kind == LEDFX_BLINK && memcmp(prev, p.level, LEDFX_CH) != 0)
+        {
+            uint32_t half = fx->period_ms / 2;
+            uint32_t late = t_ms % half;
+            CHECK(late < FRAME_MS, "%s %ums에 바뀜 (반주기 %ums 경계에서 %ums 늦음)", name, t_ms, half, late);
+            changes++;
+        }
+        memcpy(prev, p.level, LEDFX_CH);
+    }
+
+    /* 끝나는 시각과 끝난 뒤 밝기 */
+    if (fx->kind == LEDFX_SOLID)
+    {
+        CHECK(p.done, "%s 고정 색이 바로 끝나지 않음", name);
+    }
+    else if (fx->kind == LEDFX_FADE || fx->repeat)
+    {
+        uint32_t want = (fx->kind == LEDFX_FADE) ? fx->period_ms : (uint32_t)fx->repeat * fx->period_ms;
+        const uint8_t *end = (fx->kind == LEDFX_BREATHE) ? fx->a : fx->b;
+        CHECK(p.done, "%s %ums 안에 끝나지 않음", name, RUN_MS);
+        CHECK(done_ms >= want && done_ms < want + FRAME_MS, "%s %ums에 끝남 (기대 %ums)", name, done_ms, want);
+        CHECK(memcmp(p.level, end, LEDFX_CH) == 0, "%s 끝난 뒤 밝기 %u/%u/%u", name, p.level[0], p.level[1], p.level[2]);
+    }
+    else
+    {
+        CHECK(!p.done, "%s 무한 반복인데 끝남", name);
+    }
+
+    uint32_t span = t_ms ? t_ms : 1;
+    printf("  %s %ums, 에지 표 %u번, 끄기 에지 %u개, 평균 듀티 R %.1f%% G %.1f%% B %.1f%%",
+           p.done ? "끝" : "재생", t_ms, compiles, edges,
+           sum_us[0] / 10.0 / span, sum_us[1] / 10.0 / span, sum_us[2] / 10.0 / span);
+    if (fx->kind == LEDFX_BLINK) printf(", 깜빡임 전환 %u번", changes);
+    printf("\n\n");
+}
+
+int main(int argc, char **argv)
+{
+    if (argc > 1)
+    {
+        for (int i = 0; i < LEDFX_FX_COUNT; i++)
+        {
+            const char *name;
+            LedFx_Effect((LedFxId_t)i, &name);
+            if (strcmp(argv[1], name) == 0)
+            {
+                Play_Effect((LedFxId_t)i, 1);
+                return fails ? 1 : 0;
+            }
+        }
+        printf("효과 이름: reverse idle alert fade_out\n");
+        return 2;
+    }
+
+    Check_Compile();
+    for (int i = 0; i < LEDFX_FX_COUNT; i++)
+        Play_Effect((LedFxId_t)i, 0);
+
+    printf("%s\n", fails ? "# FAIL" : "# OK");
+    return fails ? 1 : 0;
+}
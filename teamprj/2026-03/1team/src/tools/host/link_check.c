@@ -0,0 +1,314 @@
+/**
+ * @file link_check.c
+ * @brief uart_link.c 수신 파서 검사 (PC에서 실행) - DMA 원형 버퍼에 바이트 스트림을 넣고 Link_Poll()
+ *
+ *   gcc -O2 -Wall -Ivboard -I../../Core/Inc link_check.c ../../Core/Src/drivers/uart_link.c -o link_check
+ *   ./link_check                # 종료 코드 0 = 통과
+ *
+ * HAL 대역 (여기서 구현):
+ *   - HAL_UARTEx_ReceiveToIdle_DMA = 버퍼/크기만 기억, DMA 카운터(CNDTR) = 크기
+ *   - Rx_Write() = DMA가 바이트를 씀 (CNDTR 감소, 반/끝에서 HT/TC 이벤트 = ISR)
+ *   - Rx_Idle()  = 줄이 쉬면 오는 IDLE 이벤트
+ *   - HAL_GetTick = 가상 ms (덜 들어온 프레임 시간 초과용)
+ * 검사:
+ *   1. 1글자 명령 (프레임 밖 바이트) 그대로 전달
+ *   2. 이벤트 두 번에 나뉜 프레임, 버퍼 끝에서 감긴 payload (Link_Byte)
+ *   3. CRC 틀린 프레임은 통째로 버림 (payload가 1글자 명령으로 새지 않음)
+ *   4. 덜 들어온 프레임은 LINK_FRAME_TIMEOUT_MS 뒤 SYNC만 버림
+ *   5. 밀린 바이트 > 256 - LINK_RX_GUARD → 전부 dropped, 다음 프레임은 정상
+ *   6. 콜백이 도는 동안 DMA가 안 읽은 구간을 덮음 → dropped (덮인 바이트가 명령으로 실행되지 않음)
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "stm32f1xx_hal.h"
+#include "drivers/uart_link.h"
+#include "timebase.h"
+
+static int fails = 0;
+
+#define CHECK(cond, ...) do { if (!(cond)) { printf("  FAIL: " __VA_ARGS__); printf("\n"); fails++; } } while (0)
+
+/* ===== HAL 대역 ===== */
+
+static USART_TypeDef       usart;
+static DMA_Channel_TypeDef dma_ch;
+static DMA_HandleTypeDef   hdma = { .Instance = &dma_ch };
+static UART_HandleTypeDef  huart = { .Instance = &usart, .hdmarx = &hdma };
+
+static uint8_t *dma_buf;
+static uint16_t dma_size;
+static uint32_t tick_ms;
+
+volatile uint8_t prof_on = 0;
+void Prof_Mark(uint8_t tag) { (void)tag; }
+
+void Vb_DisableIrq(void) { }
+void Vb_EnableIrq(void) { }
+uint32_t Vb_GetPrimask(void) { return 0; }
+void Vb_SetPrimask(uint32_t m) { (void)m; }
+
+uint32_t HAL_GetTick(void) { return tick_ms; }
+uint32_t Time_Cycles(void) { return 0; }
+
+HAL_StatusTypeDef HAL_UARTEx_ReceiveToIdle_DMA(UART_HandleTypeDef *h, uint8_t *pData, uint16_t Size)
+{
+    dma_buf = pData;
+    dma_size = Size;
+    dma_ch.CNDTR = Size;
+    h->RxState = HAL_UART_STATE_BUSY_RX;
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_UART_Transmit(UART_HandleTypeDef *h, const uint8_t *pData, uint16_t Size, uint32_t Timeout)
+{
+    (void)h; (void)pData; (void)Size; (void)Timeout;
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_UART_Transmit_DMA(UART_HandleTypeDef *h, const uint8_t *pData, uint16_t Size)
+{
+    (void)h; (void)pData; (void)Size;
+    return HAL_OK;
+}
+
+/* DMA 원형 수신 - 반/끝을 지날 때 HAL과 같이 HT(Size/2)/TC(Size) 이벤트 */
+static void Rx_Write(const uint8_t *data, uint32_t n)
+{
+    for (uint32_t i = 0; i < n; i++)
+    {
+        dma_buf[dma_size - dma_ch.CNDTR] = data[i];
+        if (--dma_ch.CNDTR == 0)
+        {
+            dma_ch.CNDTR = dma_size;
+            HAL_UARTEx_RxEventCallback(&huart, dma_size);
+        }
+        else if (dma_ch.CNDTR == dma_size / 2)
+            HAL_UARTEx_RxEventCallback(&huart, dma_size / 2);
+    }
+}
+
+static void Rx_Idle(void)
+{
+    HAL_UARTEx_RxEventCallback(&huart, (uint16_t)(dma_size - dma_ch.CNDTR));
+}
+
+static void Rx_Fill(uint8_t c, uint32_t n)
+{
+    for (uint32_t i = 0; i < n; i++) Rx_Write(&c, 1);
+}
+
+/* ===== 콜백 기록 ===== */
+
+static char    legacy[512];
+static uint32_t legacy_n;
+static uint8_t  got_type, got_len, got_payload[LINK_MAX_PAYLOAD];
+static uint32_t got_frames;
+static uint32_t flood_in_cb;            // > 0 이면 프레임 콜백 안에서 이만큼 수신 (긴 콜백 흉내)
+
+static void On_Byte(uint8_t c)
+{
+    if (legacy_n < sizeof(legacy) - 1) legacy[legacy_n++] = (char)c;
+    legacy[legacy_n] = 0;
+}
+
+static void On_Frame(const LinkFrame_t *f)
+{
+    got_frames++;
+    got_type = f->type;
+    got_len = f->len;
+    for (uint8_t i = 0; i < f->len; i++) got_payload[i] = Link_Byte(f, i);
+
+    if (flood_in_cb)
+    {
+        uint32_t n = flood_in_cb;
+        flood_in_cb = 0;
+        Rx_Fill('z', n);
+        Rx_Idle();
+    }
+}
+
+static void Clear(void)
+{
+    legacy_n = 0;
+    legacy[0] = 0;
+    got_frames = 0;
+    got_len = 0;
+    got_type = 0;
+}
+
+static uint8_t Frame(uint8_t *out, uint8_t type, const char *payload)
+{
+    return Link_Encode(out, type, (const uint8_t *)payload, (uint8_t)strlen(payload));
+}
+
+static LinkStats_t Stats(void)
+{
+    LinkStats_t s;
+    Link_GetStats(LINK_PORT_USB, &s);
+    return s;
+}
+
+static uint8_t Payload_Is(const char *s)
+{
+    return got_len == strlen(s) && memcmp(got_payload, s, got_len) == 0;
+}
+
+/* ===== 검사 ===== */
+
+static void Check_Legacy(void)
+{
+    Clear();
+    Rx_Write((const uint8_t *)"txw", 3);
+    Rx_Idle();
+    Link_Poll();
+    CHECK(strcmp(legacy, "txw") == 0, "1글자 명령 \"%s\" (예상 \"txw\")", legacy);
+    CHECK(Stats().legacy == 3 && got_frames == 0, "legacy %u, 프레임 %u", Stats().legacy, got_frames);
+}
+
+static void Check_Split(void)
+{
+    uint8_t f[LINK_MAX_PAYLOAD + LINK_OVERHEAD];
+    uint8_t n = Frame(f, LINK_T_CMD, "hello");
+
+    Clear();
+    Rx_Write((const uint8_t *)"a", 1);
+    Rx_Write(f, 3);
+    Rx_Idle();
+    Link_Poll();
+    CHECK(got_frames == 0 && strcmp(legacy, "a") == 0, "앞 조각만으로 프레임 %u, 명령 \"%s\"", got_frames, legacy);
+
+    tick_ms += 5;
+    Rx_Write(f + 3, n - 3u);
+    Rx_Write((const uint8_t *)"b", 1);
+    Rx_Idle();
+    Link_Poll();
+    CHECK(got_frames == 1 && got_type == LINK_T_CMD && Payload_Is("hello"), "나뉜 프레임 (프레임 %u, type %02X, len %u)",
+          got_frames, got_type, got_len);
+    CHECK(strcmp(legacy, "ab") == 0, "나뉜 프레임 앞뒤 명령 \"%s\" (예상 \"ab\")", legacy);
+
+    /* 버퍼 끝에서 감기게: 쓰기 위치를 끝 4바이트 전으로 */
+    Clear();
+    uint32_t pos = (uint32_t)(dma_size - dma_ch.CNDTR);
+    uint32_t pad = (dma_size - 4u - pos) & (dma_size - 1u);
+    Rx_Fill('.', pad);
+    Rx_Idle();
+    Link_Poll();
+    Clear();
+    n = Frame(f, LINK_T_PING, "wrap-around");
+    Rx_Write(f, n);
+    Rx_Idle();
+    Link_Poll();
+    CHECK(got_frames == 1 && Payload_Is("wrap-around"), "버퍼 끝에서 감긴 프레임 (프레임 %u, len %u)", got_frames, got_len);
+}
+
+static void Check_Crc(void)
+{
+    uint8_t f[LINK_MAX_PAYLOAD + LINK_OVERHEAD];
+    uint8_t n = Frame(f, LINK_T_CMD, "tx");
+    uint32_t crc0 = Stats().crc_errors;
+
+    Clear();
+    f[n - 1] ^= 0x5A;
+    Rx_Write(f, n);
+    Rx_Write((const uint8_t *)"w", 1);
+    Rx_Idle();
+    Link_Poll();
+    CHECK(Stats().crc_errors == crc0 + 1, "CRC 에러 %u (예상 %u)", Stats().crc_errors, crc0 + 1);
+    CHECK(got_frames == 0 && strcmp(legacy, "w") == 0, "CRC 틀린 프레임: 프레임 %u, 명령 \"%s\" (예상 \"w\")",
+          got_frames, legacy);
+}
+
+static void Check_Timeout(void)
+{
+    const uint8_t head[2] = { LINK_SYNC, 3 };
+    uint32_t len0 = Stats().len_errors;
+
+    Clear();
+    Rx_Write(head, 2);
+    Rx_Idle();
+    Link_Poll();
+    tick_ms += LINK_FRAME_TIMEOUT_MS - 1;
+    Link_Poll();
+    CHECK(Stats().len_errors == len0 && legacy_n == 0, "시간 초과 전에 SYNC를 버림");
+
+    tick_ms += 2;
+    Link_Poll();
+    CHECK(Stats().len_errors == len0 + 1, "덜 들어온 프레임 시간 초과 len %u (예상 %u)", Stats().len_errors, len0 + 1);
+    CHECK(legacy_n == 1 && legacy[0] == 3, "시간 초과 뒤 SYNC 다음 바이트부터 재동기 안 됨");
+}
+
+static void Check_Backlog(void)
+{
+    uint8_t f[LINK_MAX_PAYLOAD + LINK_OVERHEAD];
+    uint32_t drop0 = Stats().dropped;
+    uint32_t over = LINK_RX_BUF_SIZE - LINK_RX_GUARD + 10;
+
+    /* Poll 없이 240B 넘게 밀림 (HT/TC 이벤트만) */
+    Clear();
+    Rx_Fill('q', over);
+    Rx_Idle();
+    Link_Poll();
+    CHECK(Stats().dropped == drop0 + over, "밀린 %u B 중 dropped %u", over, Stats().dropped - drop0);
+    CHECK(legacy_n == 0, "덮인 구간에서 명령 %u개 실행", legacy_n);
+
+    uint8_t n = Frame(f, LINK_T_CMD, "ok");
+    Rx_Write(f, n);
+    Rx_Idle();
+    Link_Poll();
+    CHECK(got_frames == 1 && Payload_Is("ok"), "overrun 뒤 프레임 못 받음");
+}
+
+static void Check_CallbackOverrun(void)
+{
+    uint8_t f[LINK_MAX_PAYLOAD + LINK_OVERHEAD];
+    uint8_t n = Frame(f, LINK_T_CMD, "slow");
+    uint32_t drop0;
+
+    /* 1) 콜백 중 가드 안쪽만 들어옴 → 버리지 않고 다음 Poll에서 정상 처리 */
+    Clear();
+    drop0 = Stats().dropped;
+    flood_in_cb = 100;
+    Rx_Write(f, n);
+    Rx_Idle();
+    Link_Poll();
+    Link_Poll();
+    CHECK(Stats().dropped == drop0, "가드 안쪽인데 dropped %u", Stats().dropped - drop0);
+    CHECK(got_frames == 1 && legacy_n == 100, "콜백 중 받은 100 B 중 %u 처리", legacy_n);
+
+    /* 2) 콜백 중 250B → DMA가 뒤에 기다리던 "ab" 와 콜백 중 받은 것을 덮을 수 있음 → 전부 버림 */
+    Clear();
+    drop0 = Stats().dropped;
+    flood_in_cb = 250;
+    Rx_Write(f, n);
+    Rx_Write((const uint8_t *)"ab", 2);
+    Rx_Idle();
+    Link_Poll();
+    Link_Poll();
+    CHECK(Stats().dropped == drop0 + 252, "콜백 중 overrun dropped %u (예상 252)", Stats().dropped - drop0);
+    CHECK(got_frames == 1 && legacy_n == 0, "덮였을 수 있는 바이트 %u개가 명령으로 실행됨", legacy_n);
+
+    Clear();
+    n = Frame(f, LINK_T_CMD, "next");
+    Rx_Write(f, n);
+    Rx_Idle();
+    Link_Poll();
+    CHECK(got_frames == 1 && Payload_Is("next"), "콜백 overrun 뒤 프레임 못 받음");
+}
+
+int main(void)
+{
+    Link_Init(On_Frame, On_Byte);
+    CHECK(Link_Start(LINK_PORT_USB, &huart) == HAL_OK, "Link_Start");
+
+    Check_Legacy();
+    Check_Split();
+    Check_Crc();
+    Check_Timeout();
+    Check_Backlog();
+    Check_CallbackOverrun();
+
+    Link_PrintStats();
+    printf("\n%s\n", fails ? "# FAIL" : "# OK");
+    return fails ? 1 : 0;
+}
@@ -0,0 +1,139 @@
+/**
+ * @file sched_sim.c
+ * @brief scheduler.c 지터/데드라인 측정 (PC에서 실행) - 가상 us 시계로 main.c 태스크 구성을 10초 돌림
+ *
+ *   gcc -O2 -Wall -DSCHED_IDLE_WFI=0 -I../../Core/Inc sched_sim.c ../../Core/Src/scheduler.c -o sched_sim
+ *   ./sched_sim                 # 시나리오별 Sched_PrintStats 표 + 검사, 종료 코드 0 = 통과
+ *
+ * Time_Now_us() 는 여기서 구현하는 가상 시계 (HAL, timebase.c 없음)
+ *   - 태스크 실행 = 아래 실행 시간 모델만큼 시계를 앞으로 (난수는 고정 시드 → 결과가 매번 같음)
+ *   - 릴리스된 태스크가 없으면 다음 SysTick(1ms 경계)까지 건너뜀 (보드의 __WFI 와 같음)
+ * 태스크 = main.c 의 Sched_Add 와 같은 주기/예산, 실행 시간은 보드 측정값을 본뜬 모델:
+ *   uart  15us, 50번에 1번 명령 프레임 120us
+ *   robot 40us, 100번에 1번 상태 전이 350us
+ *   anim  트윈 중(4프레임에 1번) 3~9ms (anim_bench 최대 프레임 11KB 중 CPU 몫), 아니면 50us
+ *   ui    250us, prof 30us
+ * 시나리오 "전체 다시 그리기" 는 anim 프레임마다 25.6ms (user-002 전 화면 전체 전송) → 지연이 어떻게 번지는지
+ * 검사 (보통 시나리오):
+ *   1. 태스크마다 릴리스 수 (runs + missed) = 시간 / 주기
+ *   2. anim 은 예산 초과/놓침 0
+ *   3. 비선점 상한: 태스크의 최대 지연 <= 다른 태스크 최대 실행 시간 합 + 1ms (SysTick 간격)
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "scheduler.h"
+#include "timebase.h"
+#include "drivers/anim.h"
+
+#define SIM_US          10000000u   // 10초
+#define TICK_US         1000u       // SysTick
+
+static int fails = 0;
+
+#define CHECK(cond, ...) do { if (!(cond)) { printf("  FAIL: " __VA_ARGS__); printf("\n"); fails++; } } while (0)
+
+/* ===== 가상 시계 ===== */
+
+static uint32_t sim_us;
+
+uint32_t Time_Now_us(void)
+{
+    return sim_us;
+}
+
+static uint32_t rng = 2463534242u;
+
+static uint32_t Rand(uint32_t n)
+{
+    rng ^= rng << 13;
+    rng ^= rng >> 17;
+    rng ^= rng << 5;
+    return rng % n;
+}
+
+/* ===== 태스크 (실행 시간 모델) ===== */
+
+static uint8_t full_redraw;
+
+static void Task_Uart(void)  { sim_us += Rand(50) == 0 ? 120 : 15; }
+static void Task_Robot(void) { sim_us += Rand(100) == 0 ? 350 : 40; }
+static void Task_Ui(void)    { sim_us += 250; }
+static void Task_Prof(void)  { sim_us += 30; }
+
+static void Task_Anim(void)
+{
+    if (full_redraw) sim_us += 25600;
+    else sim_us += Rand(4) == 0 ? 3000 + Rand(6001) : 50;
+}
+
+typedef struct {
+    const char *name;
+    SchedFn_t   fn;
+    uint16_t    period_ms;
+    uint32_t    budget_us;
+} TaskDef_t;
+
+static const TaskDef_t defs[] = {          // main.c 와 같은 순서/값
+    { "uart",  Task_Uart,  1,             200   },
+    { "robot", Task_Robot, 1,             500   },
+    { "anim",  Task_Anim,  ANIM_FRAME_MS, 20000 },
+    { "ui",    Task_Ui,    200,           300   },
+    { "prof",  Task_Prof,  5,             200   },
+};
+#define TASK_N  (sizeof(defs) / sizeof(defs[0]))
+
+/* ===== 시나리오 ===== */
+
+static void Run(const char *name, uint8_t heavy, SchedStats_t *st)
+{
+    sim_us = 0;
+    full_redraw = heavy;
+
+    Sched_Init();
+    for (uint8_t i = 0; i < TASK_N; i++)
+        Sched_Add(defs[i].name, defs[i].fn, defs[i].period_ms, defs[i].budget_us);
+    Sched_Start();
+
+    uint32_t end = sim_us + SIM_US;
+    while (Time_Diff_us(sim_us, end) < 0)
+    {
+        uint32_t before = sim_us;
+        Sched_RunOnce();
+        if (sim_us == before)                           // 아무것도 안 돌았음 → 다음 SysTick
+            sim_us = (sim_us / TICK_US + 1) * TICK_US;
+    }
+
+    printf("\n%s (%u초)\n", name, SIM_US / 1000000u);
+    Sched_PrintStats();
+    for (uint8_t i = 0; i < TASK_N; i++)
+        Sched_GetStats(i, &st[i]);
+}
+
+int main(void)
+{
+    SchedStats_t st[TASK_N], heavy[TASK_N];
+
+    printf("협조형 스케줄러 (가상 시계, main.c 태스크 구성)\n");
+    Run("보통 (트윈 프레임 3~9ms)", 0, st);
+    Run("전체 다시 그리기 (anim 프레임 25.6ms)", 1, heavy);
+
+    for (uint8_t i = 0; i < TASK_N; i++)
+    {
+        const TaskDef_t *d = &defs[i];
+        uint32_t releases = SIM_US / (d->period_ms * 1000u);
+        uint32_t got = st[i].runs + st[i].missed;
+        CHECK(got + 1 >= releases && got <= releases + 1, "%s: 릴리스 %u (예상 %u)", d->name, got, releases);
+
+        uint32_t others = TICK_US;
+        for (uint8_t j = 0; j < TASK_N; j++)
+            if (j != i) others += st[j].max_exec_us;
+        CHECK(st[i].max_late_us <= others, "%s: 최대 지연 %u us > 상한 %u us", d->name, st[i].max_late_us, others);
+    }
+    CHECK(st[2].overruns == 0 && st[2].missed == 0, "anim: 예산 초과 %u, 놓침 %u", st[2].overruns, st[2].missed);
+    CHECK(heavy[2].overruns > 0, "전체 다시 그리기 시나리오에서 anim 예산 초과가 안 잡힘");
+
+    printf("\n  uart 최대 지연: 보통 %u us, 전체 다시 그리기 %u us\n", st[0].max_late_us, heavy[0].max_late_us);
+    printf("\n%s\n", fails ? "# FAIL" : "# OK");
+    return fails ? 1 : 0;
+}
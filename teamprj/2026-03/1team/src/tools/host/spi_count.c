@@ -0,0 +1,193 @@
+/**
+ * @file spi_count.c
+ * @brief SPI2 대역 (PC) - LCD 드라이버용 HAL 몇 개 + 바이트/명령 카운터 + GRAM 디코드
+ *
+ * 링크: lcd_st7735.c (+ lcd_gfx.c 등) + 이 파일 + 시험 main, include 는 -Ivboard -I../../Core/Inc
+ * 구현하는 심볼: HAL_SPI_Transmit / _DMA / DMAStop, HAL_GetTick, HAL_Delay, vb_gpio, vb_spi,
+ *               hspi2, prof_on, Prof_Mark (기록 끔)
+ */
+
+#include <string.h>
+#include <time.h>
+#include "stm32f1xx_hal.h"
+#include "spi_count.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+GPIO_TypeDef vb_gpio[5];
+SPI_TypeDef vb_spi[3];
+SPI_HandleTypeDef hspi2 = { .Instance = SPI2, .State = HAL_SPI_STATE_READY };
+
+volatile uint8_t prof_on = 0;
+void Prof_Mark(uint8_t tag) { (void)tag; }
+
+SpiCount_t spi_count;
+uint16_t spi_gram[256][256];
+uint8_t  spi_gram_on = 1;
+
+static uint32_t delay_ms;           // HAL_Delay 누적 (가상 ms)
+static uint8_t  dma_pending;        // 완료 콜백을 기다리는 DMA 전송
+
+/* ST7735 디코더 */
+static struct {
+    uint8_t  cmd;
+    uint8_t  n;                 // 명령 뒤 데이터 바이트 순번
+    uint8_t  p[4];
+    uint8_t  xs, xe, ys, ye;
+    uint16_t x, y;
+    uint8_t  hi, half;          // 픽셀 상위 바이트 대기
+} dec;
+
+/* BSRR/BRR 쓰기 → ODR (드라이버는 SPI 호출 사이에 핀마다 한 번만 씀) */
+static void Gpio_Sync(void)
+{
+    for (int i = 0; i < 5; i++)
+    {
+        GPIO_TypeDef *g = &vb_gpio[i];
+        g->ODR &= ~(g->BRR | (g->BSRR >> 16));
+        g->ODR |= g->BSRR & 0xFFFFu;
+        g->BRR = 0;
+        g->BSRR = 0;
+    }
+}
+
+static void Dec_Pixel(uint16_t c)
+{
+    if (dec.y <= dec.ye && dec.x < 256 && dec.y < 256)
+    {
+        spi_gram[dec.y][dec.x] = c;
+        spi_count.pixels++;
+    }
+    if (++dec.x > dec.xe)
+    {
+        dec.x = dec.xs;
+        dec.y++;
+    }
+}
+
+static void Dec_Bytes(const uint8_t *p, uint16_t n)
+{
+    Gpio_Sync();
+
+    if (!(vb_gpio[0].ODR & GPIO_PIN_8))     // DC=LOW: 명령
+    {
+        for (uint16_t i = 0; i < n; i++)
+        {
+            dec.cmd = p[i];
+            dec.n = 0;
+            dec.half = 0;
+            if (dec.cmd == 0x2C)            // RAMWR
+            {
+                dec.x = dec.xs;
+                dec.y = dec.ys;
+                spi_count.windows++;
+            }
+        }
+        spi_count.cmds += n;
+        return;
+    }
+
+    if (dec.cmd == 0x2C && !spi_gram_on) return;
+
+    for (uint16_t i = 0; i < n; i++)
+    {
+        uint8_t b = p[i];
+        if (dec.cmd == 0x2C)
+        {
+            if (dec.half) Dec_Pixel((uint16_t)(dec.hi << 8 | b));
+            else dec.hi = b;
+            dec.half ^= 1;
+        }
+        else if (dec.n < 4)
+        {
+            dec.p[dec.n++] = b;
+            if (dec.n == 4 && dec.cmd == 0x2A) { dec.xs = dec.p[1]; dec.xe = dec.p[3]; }
+            if (dec.n == 4 && dec.cmd == 0x2B) { dec.ys = dec.p[1]; dec.ye = dec.p[3]; }
+        }
+    }
+}
+
+static void Dma_Complete(uint8_t waited)
+{
+    while (dma_pending)
+    {
+        dma_pending = 0;
+        if (waited) spi_count.wait_bytes += hspi2.TxXferSize;
+        hspi2.TxXferCount = 0;
+        hspi2.State = HAL_SPI_STATE_READY;
+        HAL_SPI_TxCpltCallback(&hspi2);     // 다음 버퍼를 걸면 dma_pending 이 다시 1
+    }
+}
+
+void SpiCount_Pump(void)
+{
+    Dma_Complete(0);
+}
+
+void SpiCount_Reset(void)
+{
+    memset(&spi_count, 0, sizeof(spi_count));
+}
+
+uint64_t SpiCount_Cycles(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (uint64_t)t.tv_sec * 1000000000ull + (uint64_t)t.tv_nsec;
+#endif
+}
+
+/* ===== HAL ===== */
+
+uint32_t HAL_GetTick(void)
+{
+    Dma_Complete(1);        // 대기 루프에서 부름 → 전송이 끝날 때까지 CPU가 기다린 셈
+    return (uint32_t)(spi_count.bytes * SPI_BYTE_NS / 1000000u) + delay_ms;
+}
+
+void HAL_Delay(uint32_t Delay)
+{
+    delay_ms += Delay;
+}
+
+HAL_StatusTypeDef HAL_SPI_Transmit(SPI_HandleTypeDef *hspi, uint8_t *pData, uint16_t Size, uint32_t Timeout)
+{
+    (void)Timeout;
+    if (hspi->State != HAL_SPI_STATE_READY) return HAL_BUSY;
+    if (!pData || Size == 0) return HAL_ERROR;
+
+    Dec_Bytes(pData, Size);
+    spi_count.blk_calls++;
+    spi_count.blk_bytes += Size;
+    spi_count.wait_bytes += Size;
+    spi_count.bytes += Size;
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_SPI_Transmit_DMA(SPI_HandleTypeDef *hspi, uint8_t *pData, uint16_t Size)
+{
+    if (hspi->State != HAL_SPI_STATE_READY) return HAL_BUSY;
+    if (!pData || Size == 0) return HAL_ERROR;
+
+    hspi->State = HAL_SPI_STATE_BUSY_TX;
+    hspi->TxXferSize = Size;
+    hspi->TxXferCount = Size;
+    Dec_Bytes(pData, Size);         // 전송 중에는 버퍼를 안 건드리므로 시작할 때 디코드
+    spi_count.dma_calls++;
+    spi_count.dma_bytes += Size;
+    spi_count.bytes += Size;
+    dma_pending = 1;
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_SPI_DMAStop(SPI_HandleTypeDef *hspi)
+{
+    dma_pending = 0;
+    hspi->State = HAL_SPI_STATE_READY;
+    return HAL_OK;
+}
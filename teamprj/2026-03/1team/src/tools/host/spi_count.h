@@ -0,0 +1,41 @@
+/**
+ * @file spi_count.h
+ * @brief SPI2 대역 (PC) - LCD 드라이버가 부르는 HAL을 바이트 카운터로 바꿈
+ *
+ * vboard/stm32f1xx_hal.h 의 타입만 쓰고 가상 보드 없이 링크 (시계/인터럽트 모델 없음)
+ * → 호스트 사이클이 거의 드라이버 코드만의 비용
+ *
+ * - HAL_SPI_Transmit: 바로 끝남, 바이트는 "CPU 대기" 로 셈 (보드에서는 전송 시간만큼 멈춤)
+ * - HAL_SPI_Transmit_DMA: 대기 목록에만 올림 → SpiCount_Pump() 가 TxCplt 콜백 (인터럽트 대신)
+ *   드라이버가 HAL_GetTick() 으로 기다리면 그 안에서 끝내고 "CPU 대기" 로 셈
+ * - DC(PA8) 로 명령/데이터 구분, CASET/RASET/RAMWR 를 풀어서 gram 에 그림 (화면 비교용)
+ */
+
+#ifndef SPI_COUNT_H
+#define SPI_COUNT_H
+
+#include <stdint.h>
+
+#define SPI_BYTE_NS     1000u       // SPI2 8Mbit/s (분주 4) → 바이트 1us
+
+typedef struct {
+    uint32_t cmds;          // 명령 바이트 (DC=LOW)
+    uint32_t windows;       // RAMWR 수
+    uint64_t bytes;         // 전체
+    uint32_t blk_calls;     // HAL_SPI_Transmit
+    uint32_t dma_calls;     // HAL_SPI_Transmit_DMA
+    uint64_t blk_bytes;
+    uint64_t dma_bytes;
+    uint64_t wait_bytes;    // CPU가 버스를 기다린 바이트 (블로킹 + 대기 루프 안에서 끝난 DMA)
+    uint64_t pixels;        // GRAM에 쓴 픽셀
+} SpiCount_t;
+
+extern SpiCount_t spi_count;
+extern uint16_t spi_gram[256][256];     // [행][열] 패널 좌표 (오프셋 포함), RGB565
+extern uint8_t  spi_gram_on;            // 0 = 픽셀 디코드 생략 (사이클 측정 때)
+
+void SpiCount_Reset(void);              // 카운터만 (gram 은 유지)
+void SpiCount_Pump(void);               // 대기 중인 DMA 전부 완료 (인터럽트가 들어온 것처럼)
+uint64_t SpiCount_Cycles(void);         // 호스트 사이클 (x86 TSC, 그 외 ns)
+
+#endif /* SPI_COUNT_H */
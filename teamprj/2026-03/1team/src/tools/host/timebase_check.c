@@ -0,0 +1,186 @@
+/**
+ * @file timebase_check.c
+ * @brief timebase_host.c 검사 (PC에서 실행) - 보드 시간축 API 를 clock_gettime/POSIX 타이머로 돌려봄
+ *
+ *   gcc -O2 -Wall -DSCHED_IDLE_WFI=0 -Ivboard -I../../Core/Inc timebase_check.c timebase_host.c \
+ *       ../../Core/Src/scheduler.c ../../Core/Src/scan_map.c -o timebase_check -lrt -lpthread
+ *   ./timebase_check            # 종료 코드 0 = 통과
+ *
+ * 링크 규칙 (README "공용 시간축"):
+ *   - scheduler.c 는 HAL 없이 -DSCHED_IDLE_WFI=0 만으로 링크
+ *   - scan_map.c 처럼 HAL_GetTick / 드라이버 헤더를 쓰는 모듈은 -Ivboard (HAL 타입) + HAL_GetTick 만 여기서 구현
+ * 실제 시계라 허용 오차는 넉넉하게 (CI 에서 스레드가 늦게 깨어나도 통과하도록)
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "stm32f1xx_hal.h"
+#include "timebase.h"
+#include "scheduler.h"
+#include "scan_map.h"
+#include "drivers/ultrasonic.h"
+
+#define LATE_MAX_US     50000   // 원샷/스트림 허용 지연 (부하 걸린 PC)
+
+static int fails = 0;
+
+#define CHECK(cond, ...) do { if (!(cond)) { printf("  FAIL: " __VA_ARGS__); printf("\n"); fails++; } } while (0)
+
+/* scan_map.c 가 부름 - 보드의 SysTick 대신 같은 시간축 */
+uint32_t HAL_GetTick(void)
+{
+    return Time_Now_us() / 1000u;
+}
+
+/* ===== 원샷 ===== */
+
+static volatile uint32_t fired_at;
+static volatile uint32_t fired_n;
+
+static void On_Fire(void *arg)
+{
+    fired_at = Time_Now_us();
+    fired_n += (uint32_t)(uintptr_t)arg;
+}
+
+static void Check_Oneshot(void)
+{
+    fired_n = 0;
+    uint32_t t0 = Time_Now_us();
+    int8_t id = Time_Oneshot(2000, On_Fire, (void *)1);
+    CHECK(id >= 0, "원샷 슬롯 없음");
+    Time_Delay_us(2000 + LATE_MAX_US);
+    CHECK(fired_n == 1, "2ms 원샷이 %u번 실행", fired_n);
+    int32_t late = Time_Diff_us(fired_at, t0 + 2000);
+    CHECK(late >= 0 && late < LATE_MAX_US, "2ms 원샷 지연 %ld us", (long)late);
+    printf("  oneshot(2000us) late %ld us\n", (long)late);
+
+    /* 취소하면 안 불림 */
+    fired_n = 0;
+    id = Time_Oneshot(5000, On_Fire, (void *)1);
+    Time_Cancel(id);
+    Time_Delay_us(20000);
+    CHECK(fired_n == 0, "취소한 원샷이 실행됨");
+
+    /* 슬롯이 다 차면 -1, 취소하면 다시 빔 */
+    int8_t ids[TIME_ONESHOT_SLOTS];
+    for (int i = 0; i < TIME_ONESHOT_SLOTS; i++)
+    {
+        ids[i] = Time_Oneshot(1000000, On_Fire, (void *)1);
+        CHECK(ids[i] >= 0, "슬롯 %d 못 얻음", i);
+    }
+    CHECK(Time_Oneshot(1000000, On_Fire, (void *)1) < 0, "슬롯 %d개를 넘겨 걸림", TIME_ONESHOT_SLOTS);
+    for (int i = 0; i < TIME_ONESHOT_SLOTS; i++) Time_Cancel(ids[i]);
+    id = Time_Oneshot(1000000, On_Fire, (void *)1);
+    CHECK(id >= 0, "취소 뒤에도 슬롯이 없음");
+    Time_Cancel(id);
+}
+
+/* ===== 연속 비교 스트림 ===== */
+
+static volatile uint32_t edge_n;
+
+static uint16_t On_Edge(void)
+{
+    edge_n++;
+    return 1000;
+}
+
+static void Check_Edge(void)
+{
+    edge_n = 0;
+    Time_EdgeStart(TIME_EDGE_MOTOR, 1000, On_Edge);
+    Time_Delay_us(50000);
+    Time_EdgeStop(TIME_EDGE_MOTOR);
+    uint32_t n = edge_n;
+    Time_Delay_us(5000);
+    printf("  edge(1000us) x 50ms = %u\n", n);
+    CHECK(n >= 25 && n <= 51, "1ms 스트림이 50ms 동안 %u번", n);
+    CHECK(edge_n == n, "EdgeStop 뒤에도 호출됨");
+}
+
+/* ===== 스케줄러 (실제 시계) ===== */
+
+static void Task_Nop(void) { }
+
+static void Check_Sched(void)
+{
+    SchedStats_t a, b;
+
+    Sched_Init();
+    int8_t ia = Sched_Add("a", Task_Nop, 5, 100);
+    int8_t ib = Sched_Add("b", Task_Nop, 10, 100);
+    Sched_Start();
+    uint32_t end = Time_Now_us() + 200000;
+    while (Time_Diff_us(Time_Now_us(), end) < 0)
+        Sched_RunOnce();
+    Sched_GetStats((uint8_t)ia, &a);
+    Sched_GetStats((uint8_t)ib, &b);
+    printf("  sched 200ms: a(5ms) %u runs late max %u us, b(10ms) %u runs late max %u us\n",
+           a.runs, a.max_late_us, b.runs, b.max_late_us);
+    CHECK(a.runs + a.missed >= 39 && a.runs + a.missed <= 42, "5ms 태스크 릴리스 %u", a.runs + a.missed);
+    CHECK(b.runs + b.missed >= 19 && b.runs + b.missed <= 22, "10ms 태스크 릴리스 %u", b.runs + b.missed);
+}
+
+/* ===== 보정 시작은 기다리지 않음 (uart 태스크의 'c') ===== */
+
+static void Check_CalibAsync(void)
+{
+    static TimeCalib_t c;
+
+    uint32_t a = Time_Now_us();
+    int8_t r = Time_CalibrateStart(&c);
+    uint32_t d = Time_Now_us() - a;
+    CHECK(r == 0, "Time_CalibrateStart 실패");
+    CHECK(d < 2000, "Time_CalibrateStart 가 %u us 걸림 (기다리면 안 됨)", d);
+    CHECK(Time_CalibrateStart(&c) < 0, "진행 중에 두 번째 시작이 받아들여짐");
+
+    while (Time_CalibrateBusy() && Time_Diff_us(Time_Now_us(), a) < 200000);
+    CHECK(!Time_CalibrateBusy(), "보정이 200ms 안에 안 끝남");
+    CHECK(c.oneshot_late_us >= 0 && c.oneshot_late_us < LATE_MAX_US, "비동기 보정 원샷 지연 %ld us", (long)c.oneshot_late_us);
+}
+
+/* ===== scan_map (HAL_GetTick = 위) ===== */
+
+static void Check_ScanMap(void)
+{
+    ScanMap_Init();
+    CHECK(!ScanMap_FrontBlocked(), "빈 지도가 막힘");
+    CHECK(ScanMap_Update(SERVO_CENTER_ANGLE, DIST_SAFE - 10) == 1, "정면 %dcm 가 막힘이 아님", DIST_SAFE - 10);
+    CHECK(ScanMap_Bin(0) != NULL && ScanMap_Bin(MAP_BINS) == NULL, "ScanMap_Bin 범위");
+    ScanMap_Update(SERVO_CENTER_ANGLE, ULTRA_NO_ECHO);
+    CHECK(!ScanMap_FrontBlocked(), "신뢰도 1 칸이 에코 없음 1번으로 안 풀림");
+}
+
+int main(void)
+{
+    TimeCalib_t c;
+
+    Time_Init();
+    uint32_t a = Time_Now_us();
+    Time_Delay_us(500);
+    uint32_t d = Time_Now_us() - a;
+    CHECK(d >= 500 && d < 500 + LATE_MAX_US, "Delay_us(500) = %u us", d);
+    int32_t skew = Time_Diff_us(Time_CyclesToUs(Time_Cycles()), Time_Now_us());
+    CHECK(skew >= -2 && skew <= 2, "Time_Cycles 와 Time_Now_us 가 %ld us 어긋남", (long)skew);
+
+    Check_Oneshot();
+    Check_Edge();
+    Check_Sched();
+    Check_ScanMap();
+    Check_CalibAsync();
+
+    Time_Calibrate(&c);
+    Time_PrintCalibration(&c);
+    CHECK(c.oneshot_late_us >= 0 && c.oneshot_late_us < LATE_MAX_US, "보정 원샷 지연 %ld us", (long)c.oneshot_late_us);
+
+    /* 보정이 원샷 슬롯을 남기지 않음 (울렸으면 비고, 시간 초과면 Time_Cancel) */
+    int8_t ids[TIME_ONESHOT_SLOTS];
+    for (int i = 0; i < TIME_ONESHOT_SLOTS; i++)
+        ids[i] = Time_Oneshot(1000000, On_Fire, (void *)1);
+    CHECK(ids[TIME_ONESHOT_SLOTS - 1] >= 0, "보정 뒤 원샷 슬롯이 남아 있음");
+    for (int i = 0; i < TIME_ONESHOT_SLOTS; i++) Time_Cancel(ids[i]);
+
+    printf("\n%s\n", fails ? "# FAIL" : "# OK");
+    return fails ? 1 : 0;
+}
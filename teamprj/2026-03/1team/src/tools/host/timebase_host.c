@@ -0,0 +1,300 @@
+/**
+ * @file timebase_host.c
+ * @brief 공용 us 시간축 - PC 구현 (Core/Inc/timebase.h 와 같은 API)
+ *
+ * 보드 없이 scheduler.c, scan_map.c 같은 모듈을 PC에서 돌려볼 때 timebase.c 대신 링크
+ *   gcc -DSCHED_IDLE_WFI=0 -Ivboard -I../../Core/Inc my_test.c ../../Core/Src/scheduler.c timebase_host.c -lrt -lpthread
+ *   - scheduler.c: -DSCHED_IDLE_WFI=0 이면 HAL 헤더를 안 씀
+ *   - main.h / 드라이버 헤더를 쓰는 모듈(scan_map.c 등): -Ivboard 로 HAL 타입을 받고, 부르는 HAL 함수만 시험 쪽에서 구현
+ *     (예: HAL_GetTick = Time_Now_us() / 1000, tools/host/timebase_check.c)
+ *
+ * - Time_Now_us / Time_Cycles: clock_gettime(CLOCK_MONOTONIC) (사이클은 64MHz로 환산)
+ * - Time_Oneshot: POSIX 타이머 (SIGEV_THREAD) → 콜백은 별도 스레드, 인터럽트 막기 대신 뮤텍스
+ * - Time_EdgeStart: 스트림마다 스레드 1개가 clock_nanosleep(절대 시각)으로 간격을 누적 (보드의 CC2/CC3처럼 위상 유지)
+ * - Time_CalibrateStart: clock_getres, 호출 비용을 바로 채우고 원샷 지연은 콜백(타이머 스레드)에서 채움
+ *   Time_Calibrate 는 시작 후 끝날 때까지 기다림 (보드와 같은 순서)
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <time.h>
+#include <signal.h>
+#include <pthread.h>
+#include "timebase.h"
+
+#define HOST_CORE_HZ    64000000u   // 보드와 같은 환산 (Time_Cycles 값 비교용)
+
+typedef struct {
+    timer_t  timer;
+    TimeFn_t fn;
+    void    *arg;
+    uint8_t  active;
+    uint8_t  created;
+} HostSlot_t;
+
+static HostSlot_t slots[TIME_ONESHOT_SLOTS];
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+static struct timespec t0;
+
+typedef struct {
+    pthread_t thread;
+    volatile TimeEdgeFn_t fn;
+    volatile uint8_t run;
+    uint16_t first;
+} HostEdge_t;
+
+static HostEdge_t edges[TIME_EDGE_STREAMS];
+
+/* ===== 내부 함수 ===== */
+
+static uint64_t Elapsed_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)(ts.tv_sec - t0.tv_sec) * 1000000000u + (uint64_t)(ts.tv_nsec - t0.tv_nsec);
+}
+
+static void Slot_Fire(union sigval sv)
+{
+    HostSlot_t *s = (HostSlot_t *)sv.sival_ptr;
+    TimeFn_t fn = NULL;
+    void *arg = NULL;
+
+    pthread_mutex_lock(&lock);
+    if (s->active)
+    {
+        s->active = 0;
+        fn = s->fn;
+        arg = s->arg;
+    }
+    pthread_mutex_unlock(&lock);
+
+    if (fn) fn(arg);
+}
+
+/* ===== 외부 API ===== */
+
+void Time_Init(void)
+{
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+
+    pthread_mutex_lock(&lock);
+    for (uint8_t i = 0; i < TIME_ONESHOT_SLOTS; i++)
+    {
+        if (slots[i].created) timer_delete(slots[i].timer);
+        slots[i].active = 0;
+        slots[i].created = 0;
+    }
+    pthread_mutex_unlock(&lock);
+}
+
+uint32_t Time_Cycles(void)
+{
+    return (uint32_t)(Elapsed_ns() * (HOST_CORE_HZ / 1000000u) / 1000u);
+}
+
+uint32_t Time_CyclesToUs(uint32_t cycles)
+{
+    return cycles / (HOST_CORE_HZ / 1000000u);
+}
+
+uint32_t Time_Now_us(void)
+{
+    return (uint32_t)(Elapsed_ns() / 1000u);
+}
+
+void Time_WaitUntil_us(uint32_t deadline_us)
+{
+    while (Time_Diff_us(Time_Now_us(), deadline_us) < 0);
+}
+
+void Time_Delay_us(uint32_t us)
+{
+    Time_WaitUntil_us(Time_Now_us() + us);
+}
+
+int8_t Time_Oneshot(uint32_t delay_us, TimeFn_t fn, void *arg)
+{
+    int8_t id = -1;
+
+    pthread_mutex_lock(&lock);
+    for (uint8_t i = 0; i < TIME_ONESHOT_SLOTS; i++)
+    {
+        HostSlot_t *s = &slots[i];
+        if (s->active) continue;
+
+        if (!s->created)
+        {
+            struct sigevent sev = { 0 };
+            sev.sigev_notify = SIGEV_THREAD;
+            sev.sigev_notify_function = Slot_Fire;
+            sev.sigev_value.sival_ptr = s;
+            if (timer_create(CLOCK_MONOTONIC, &sev, &s->timer) != 0) break;
+            s->created = 1;
+        }
+
+        struct itimerspec its = { 0 };
+        its.it_value.tv_sec  = delay_us / 1000000u;
+        its.it_value.tv_nsec = (long)(delay_us % 1000000u) * 1000 + (delay_us == 0);  // 0이면 타이머가 꺼짐
+        s->fn = fn;
+        s->arg = arg;
+        s->active = 1;
+        timer_settime(s->timer, 0, &its, NULL);
+        id = (int8_t)i;
+        break;
+    }
+    pthread_mutex_unlock(&lock);
+    return id;
+}
+
+void Time_Cancel(int8_t id)
+{
+    if (id < 0 || id >= TIME_ONESHOT_SLOTS) return;
+
+    pthread_mutex_lock(&lock);
+    if (slots[id].created)
+    {
+        struct itimerspec off = { 0 };
+        timer_settime(slots[id].timer, 0, &off, NULL);
+    }
+    slots[id].active = 0;
+    pthread_mutex_unlock(&lock);
+}
+
+static void *Edge_Thread(void *arg)
+{
+    HostEdge_t *e = (HostEdge_t *)arg;
+    struct timespec at;
+    uint32_t d = e->first;
+
+    clock_gettime(CLOCK_MONOTONIC, &at);
+    while (e->run && d != 0)
+    {
+        at.tv_nsec += (long)d * 1000;
+        while (at.tv_nsec >= 1000000000L) { at.tv_nsec -= 1000000000L; at.tv_sec++; }
+        clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &at, NULL);
+
+        TimeEdgeFn_t fn = e->fn;
+        if (!e->run || fn == NULL) break;
+        d = fn();
+    }
+    e->run = 0;
+    return NULL;
+}
+
+void Time_EdgeStart(uint8_t id, uint16_t first_us, TimeEdgeFn_t fn)
+{
+    if (id >= TIME_EDGE_STREAMS) return;
+
+    HostEdge_t *e = &edges[id];
+    Time_EdgeStop(id);
+    e->fn = fn;
+    e->first = first_us ? first_us : 1;
+    e->run = 1;
+    if (pthread_create(&e->thread, NULL, Edge_Thread, e) != 0)
+        e->run = 0;
+}
+
+void Time_EdgeStop(uint8_t id)
+{
+    if (id >= TIME_EDGE_STREAMS) return;
+
+    HostEdge_t *e = &edges[id];
+    if (e->fn != NULL)
+    {
+        e->run = 0;
+        pthread_join(e->thread, NULL);
+        e->fn = NULL;
+    }
+}
+
+void Time_IRQ(void)
+{
+    /* PC에서는 타이머 스레드가 직접 콜백 */
+}
+
+/* ===== 보정 보고 ===== */
+
+/* 콜백과 취소가 엇갈려도 끝난 보정의 out 에는 쓰지 않도록 cal_lock 안에서만 완료 처리 */
+static pthread_mutex_t cal_lock = PTHREAD_MUTEX_INITIALIZER;
+static TimeCalib_t *cal_out;
+static uint32_t cal_start;
+static int8_t cal_id = -1;
+static volatile uint8_t cal_busy = 0;
+
+static void Calib_Mark(void *arg)
+{
+    (void)arg;
+    int32_t late = Time_Diff_us(Time_Now_us(), cal_start + 200);
+
+    pthread_mutex_lock(&cal_lock);
+    if (cal_busy)
+    {
+        cal_out->oneshot_late_us = late;
+        cal_id = -1;
+        cal_busy = 0;
+    }
+    pthread_mutex_unlock(&cal_lock);
+}
+
+int8_t Time_CalibrateStart(TimeCalib_t *out)
+{
+    if (cal_busy) return -1;
+
+    struct timespec res;
+    clock_getres(CLOCK_MONOTONIC, &res);
+
+    out->core_hz = HOST_CORE_HZ;
+    out->measured_hz = HOST_CORE_HZ;    // 환산값이므로 오차 없음
+    out->error_ppm = 0;
+    out->tim_ticks_per_ms = res.tv_nsec ? (uint32_t)(1000000 / res.tv_nsec) : 0;  // 시계 해상도 (틱/ms)
+
+    uint32_t c0 = Time_Cycles();
+    for (uint8_t i = 0; i < 100; i++) Time_Now_us();
+    out->now_cycles = (Time_Cycles() - c0) / 100u;
+
+    c0 = Time_Cycles();
+    Time_Delay_us(10);
+    out->delay10_cycles = Time_Cycles() - c0;
+    out->oneshot_late_us = -1;
+
+    pthread_mutex_lock(&cal_lock);
+    cal_out = out;
+    cal_busy = 1;
+    cal_start = Time_Now_us();
+    cal_id = Time_Oneshot(200, Calib_Mark, NULL);
+    if (cal_id < 0) cal_busy = 0;
+    pthread_mutex_unlock(&cal_lock);
+    return cal_busy ? 0 : -1;
+}
+
+uint8_t Time_CalibrateBusy(void)
+{
+    return cal_busy;
+}
+
+void Time_Calibrate(TimeCalib_t *out)
+{
+    if (Time_CalibrateStart(out) < 0) return;
+
+    uint32_t start = Time_Now_us();
+    while (cal_busy && Time_Diff_us(Time_Now_us(), start) < 100000);
+
+    pthread_mutex_lock(&cal_lock);
+    if (cal_busy)                       // 안 울렸으면 슬롯을 비움 (값은 -1)
+    {
+        Time_Cancel(cal_id);
+        cal_id = -1;
+        cal_busy = 0;
+    }
+    pthread_mutex_unlock(&cal_lock);
+}
+
+void Time_PrintCalibration(const TimeCalib_t *c)
+{
+    printf("timebase(host): %lu Hz 환산, clock %lu ticks/ms\n",
+           (unsigned long)c->core_hz, (unsigned long)c->tim_ticks_per_ms);
+    printf("                Now_us %lu cyc, Delay_us(10) %lu cyc, oneshot(200us) late %ld us\n",
+           (unsigned long)c->now_cycles, (unsigned long)c->delay10_cycles, (long)c->oneshot_late_us);
+}
@@ -0,0 +1,805 @@
+/**
+ * @file stm32f1xx_hal.h
+ * @brief 가상 보드 HAL - 펌웨어가 쓰는 STM32F1 HAL 부분만 (PC 빌드용, 구현은 vboard_*.c)
+ *
+ * -Ivboard 를 Core/Inc 보다 먼저 줘서 실제 HAL 대신 이 헤더를 씀 → Core/Src 는 그대로 빌드
+ * - 상수/비트 값은 F1 HAL/CMSIS 와 같음 (레지스터를 직접 만지는 timebase.c, motor.c 가 그대로 동작)
+ * - GPIO/USART/DMA/RCC 레지스터는 고정 주소 구조체 (motor.c 의 static 표가 초기화 가능)
+ * - TIMx/DWT 는 접근할 때마다 Vb_Tim()/Vb_Dwt() 가 가상 시계를 진행 → 바쁜 대기도 끝남
+ */
+
+#ifndef __STM32F1xx_HAL_H
+#define __STM32F1xx_HAL_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define __IO        volatile
+#define __weak      __attribute__((weak))
+#define UNUSED(X)   (void)(X)
+
+#define SET_BIT(REG, BIT)       ((REG) |= (BIT))
+#define CLEAR_BIT(REG, BIT)     ((REG) &= ~(BIT))
+#define READ_BIT(REG, BIT)      ((REG) & (BIT))
+
+typedef enum { RESET = 0, SET = !RESET } FlagStatus, ITStatus;
+typedef enum { DISABLE = 0, ENABLE = !DISABLE } FunctionalState;
+
+typedef enum {
+    HAL_OK = 0x00U,
+    HAL_ERROR = 0x01U,
+    HAL_BUSY = 0x02U,
+    HAL_TIMEOUT = 0x03U
+} HAL_StatusTypeDef;
+
+typedef enum { HAL_UNLOCKED = 0x00U, HAL_LOCKED = 0x01U } HAL_LockTypeDef;
+
+#define HAL_MAX_DELAY       0xFFFFFFFFU
+
+extern uint32_t SystemCoreClock;
+
+/* ===== 인터럽트 번호 (STM32F103xB) ===== */
+typedef enum {
+    NonMaskableInt_IRQn     = -14,
+    HardFault_IRQn          = -13,
+    MemoryManagement_IRQn   = -12,
+    BusFault_IRQn           = -11,
+    UsageFault_IRQn         = -10,
+    SVCall_IRQn             = -5,
+    DebugMonitor_IRQn       = -4,
+    PendSV_IRQn             = -2,
+    SysTick_IRQn            = -1,
+    EXTI0_IRQn              = 6,
+    EXTI1_IRQn              = 7,
+    EXTI2_IRQn              = 8,
+    EXTI3_IRQn              = 9,
+    EXTI4_IRQn              = 10,
+    DMA1_Channel1_IRQn      = 11,
+    DMA1_Channel2_IRQn      = 12,
+    DMA1_Channel3_IRQn      = 13,
+    DMA1_Channel4_IRQn      = 14,
+    DMA1_Channel5_IRQn      = 15,
+    DMA1_Channel6_IRQn      = 16,
+    DMA1_Channel7_IRQn      = 17,
+    EXTI9_5_IRQn            = 23,
+    TIM1_UP_IRQn            = 25,
+    TIM1_CC_IRQn            = 27,
+    TIM2_IRQn               = 28,
+    TIM3_IRQn               = 29,
+    TIM4_IRQn               = 30,
+    I2C1_EV_IRQn            = 31,
+    I2C1_ER_IRQn            = 32,
+    SPI1_IRQn               = 35,
+    SPI2_IRQn               = 36,
+    USART1_IRQn             = 37,
+    USART2_IRQn             = 38,
+    USART3_IRQn             = 39,
+    EXTI15_10_IRQn          = 40
+} IRQn_Type;
+
+/* ===== 레지스터 블록 ===== */
+typedef struct {
+    __IO uint32_t CRL, CRH, IDR, ODR, BSRR, BRR, LCKR;
+} GPIO_TypeDef;
+
+typedef struct {
+    __IO uint32_t CR1, CR2, SMCR, DIER, SR, EGR, CCMR1, CCMR2, CCER, CNT, PSC, ARR, RCR,
+                  CCR1, CCR2, CCR3, CCR4, BDTR, DCR, DMAR;
+} TIM_TypeDef;
+
+typedef struct {
+    __IO uint32_t SR, DR, BRR, CR1, CR2, CR3, GTPR;
+} USART_TypeDef;
+
+typedef struct {
+    __IO uint32_t CR1, CR2, SR, DR, CRCPR, RXCRCR, TXCRCR, I2SCFGR, I2SPR;
+} SPI_TypeDef;
+
+typedef struct {
+    __IO uint32_t CR1, CR2, OAR1, OAR2, DR, SR1, SR2, CCR, TRISE;
+} I2C_TypeDef;
+
+typedef struct {
+    __IO uint32_t CCR, CNDTR, CPAR, CMAR;
+} DMA_Channel_TypeDef;
+
+typedef struct {
+    __IO uint32_t CR, CFGR, CIR, APB2RSTR, APB1RSTR, AHBENR, APB2ENR, APB1ENR, BDCR, CSR;
+} RCC_TypeDef;
+
+typedef struct {
+    __IO uint32_t CTRL, CYCCNT;
+} DWT_Type;
+
+typedef struct {
+    __IO uint32_t DHCSR, DCRSR, DCRDR, DEMCR;
+} CoreDebug_Type;
+
+/* 고정 주소 블록 (vboard_core.c) */
+extern GPIO_TypeDef vb_gpio[5];
+extern USART_TypeDef vb_usart[4];
+extern SPI_TypeDef vb_spi[3];
+extern I2C_TypeDef vb_i2c[3];
+extern DMA_Channel_TypeDef vb_dma_ch[8];
+extern RCC_TypeDef vb_rcc;
+extern CoreDebug_Type vb_coredebug;
+
+/* 접근 = 가상 시계 진행 */
+TIM_TypeDef *Vb_Tim(uint8_t n);
+DWT_Type *Vb_Dwt(void);
+
+#define GPIOA           (&vb_gpio[0])
+#define GPIOB           (&vb_gpio[1])
+#define GPIOC           (&vb_gpio[2])
+#define GPIOD           (&vb_gpio[3])
+#define GPIOE           (&vb_gpio[4])
+#define USART1          (&vb_usart[1])
+#define USART2          (&vb_usart[2])
+#define USART3          (&vb_usart[3])
+#define SPI1            (&vb_spi[1])
+#define SPI2            (&vb_spi[2])
+#define I2C1            (&vb_i2c[1])
+#define I2C2            (&vb_i2c[2])
+#define DMA1_Channel1   (&vb_dma_ch[1])
+#define DMA1_Channel2   (&vb_dma_ch[2])
+#define DMA1_Channel3   (&vb_dma_ch[3])
+#define DMA1_Channel4   (&vb_dma_ch[4])
+#define DMA1_Channel5   (&vb_dma_ch[5])
+#define DMA1_Channel6   (&vb_dma_ch[6])
+#define DMA1_Channel7   (&vb_dma_ch[7])
+#define RCC             (&vb_rcc)
+#define CoreDebug       (&vb_coredebug)
+#define TIM1            (Vb_Tim(1))
+#define TIM2            (Vb_Tim(2))
+#define TIM3            (Vb_Tim(3))
+#define TIM4            (Vb_Tim(4))
+#define DWT             (Vb_Dwt())
+
+/* ===== 코어 ===== */
+void Vb_DisableIrq(void);
+void Vb_EnableIrq(void);
+uint32_t Vb_GetPrimask(void);
+void Vb_SetPrimask(uint32_t m);
+void Vb_Wfi(void);
+uint32_t Vb_GetIpsr(void);
+uint32_t Vb_Ldrex(volatile uint32_t *addr);
+uint32_t Vb_Strex(uint32_t value, volatile uint32_t *addr);
+void Vb_Clrex(void);
+
+#define __disable_irq()     Vb_DisableIrq()
+#define __enable_irq()      Vb_EnableIrq()
+#define __get_PRIMASK()     Vb_GetPrimask()
+#define __set_PRIMASK(m)    Vb_SetPrimask(m)
+#define __WFI()             Vb_Wfi()
+#define __get_IPSR()        Vb_GetIpsr()
+#define __LDREXW(p)         Vb_Ldrex(p)
+#define __STREXW(v, p)      Vb_Strex((v), (p))
+#define __CLREX()           Vb_Clrex()
+#define __NOP()             ((void)0)
+#define __DSB()             ((void)0)
+#define __ISB()             ((void)0)
+#define __DMB()             ((void)0)
+
+#define DWT_CTRL_CYCCNTENA_Msk          (1UL << 0)
+#define CoreDebug_DEMCR_TRCENA_Msk      (1UL << 24)
+
+/* ===== RCC ===== */
+#define RCC_CFGR_PPRE1                  0x00000700U
+#define RCC_CFGR_PPRE1_DIV1             0x00000000U
+#define RCC_CFGR_PPRE1_DIV2             0x00000400U
+
+#define RCC_OSCILLATORTYPE_HSE          0x00000001U
+#define RCC_OSCILLATORTYPE_HSI          0x00000002U
+#define RCC_HSE_ON                      0x00010000U
+#define RCC_HSI_ON                      0x00000001U
+#define RCC_HSICALIBRATION_DEFAULT      0x10U
+#define RCC_PLL_NONE                    0x00000000U
+#define RCC_PLL_OFF                     0x00000001U
+#define RCC_PLL_ON                      0x00000002U
+#define RCC_PLLSOURCE_HSI_DIV2          0x00000000U
+#define RCC_PLLSOURCE_HSE               0x00010000U
+#define RCC_PLL_MUL9                    0x001C0000U
+#define RCC_PLL_MUL16                   0x00380000U
+#define RCC_CLOCKTYPE_SYSCLK            0x00000001U
+#define RCC_CLOCKTYPE_HCLK              0x00000002U
+#define RCC_CLOCKTYPE_PCLK1             0x00000004U
+#define RCC_CLOCKTYPE_PCLK2             0x00000008U
+#define RCC_SYSCLKSOURCE_HSI            0x00000000U
+#define RCC_SYSCLKSOURCE_PLLCLK         0x00000002U
+#define RCC_SYSCLK_DIV1                 0x00000000U
+#define RCC_HCLK_DIV1                   0x00000000U
+#define RCC_HCLK_DIV2                   0x00000400U
+#define FLASH_LATENCY_0                 0x00000000U
+#define FLASH_LATENCY_1                 0x00000001U
+#define FLASH_LATENCY_2                 0x00000002U
+
+typedef struct {
+    uint32_t PLLState;
+    uint32_t PLLSource;
+    uint32_t PLLMUL;
+} RCC_PLLInitTypeDef;
+
+typedef struct {
+    uint32_t OscillatorType;
+    uint32_t HSEState;
+    uint32_t HSEPredivValue;
+    uint32_t LSEState;
+    uint32_t HSIState;
+    uint32_t HSICalibrationValue;
+    uint32_t LSIState;
+    RCC_PLLInitTypeDef PLL;
+} RCC_OscInitTypeDef;
+
+typedef struct {
+    uint32_t ClockType;
+    uint32_t SYSCLKSource;
+    uint32_t AHBCLKDivider;
+    uint32_t APB1CLKDivider;
+    uint32_t APB2CLKDivider;
+} RCC_ClkInitTypeDef;
+
+/* 클럭 게이트는 모델 없음 */
+#define __HAL_RCC_AFIO_CLK_ENABLE()     ((void)0)
+#define __HAL_RCC_PWR_CLK_ENABLE()      ((void)0)
+#define __HAL_RCC_DMA1_CLK_ENABLE()     ((void)0)
+#define __HAL_RCC_GPIOA_CLK_ENABLE()    ((void)0)
+#define __HAL_RCC_GPIOB_CLK_ENABLE()    ((void)0)
+#define __HAL_RCC_GPIOC_CLK_ENABLE()    ((void)0)
+#define __HAL_RCC_GPIOD_CLK_ENABLE()    ((void)0)
+#define __HAL_RCC_TIM1_CLK_ENABLE()     ((void)0)
+#define __HAL_RCC_TIM2_CLK_ENABLE()     ((void)0)
+#define __HAL_RCC_TIM3_CLK_ENABLE()     ((void)0)
+#define __HAL_RCC_TIM4_CLK_ENABLE()     ((void)0)
+#define __HAL_RCC_TIM1_CLK_DISABLE()    ((void)0)
+#define __HAL_RCC_TIM2_CLK_DISABLE()    ((void)0)
+#define __HAL_RCC_TIM3_CLK_DISABLE()    ((void)0)
+#define __HAL_RCC_SPI2_CLK_ENABLE()     ((void)0)
+#define __HAL_RCC_SPI2_CLK_DISABLE()    ((void)0)
+#define __HAL_RCC_I2C1_CLK_ENABLE()     ((void)0)
+#define __HAL_RCC_I2C1_CLK_DISABLE()    ((void)0)
+#define __HAL_RCC_USART2_CLK_ENABLE()   ((void)0)
+#define __HAL_RCC_USART2_CLK_DISABLE()  ((void)0)
+#define __HAL_RCC_USART3_CLK_ENABLE()   ((void)0)
+#define __HAL_RCC_USART3_CLK_DISABLE()  ((void)0)
+#define __HAL_AFIO_REMAP_SWJ_NOJTAG()   ((void)0)
+
+/* ===== GPIO ===== */
+#define GPIO_PIN_0      ((uint16_t)0x0001)
+#define GPIO_PIN_1      ((uint16_t)0x0002)
+#define GPIO_PIN_2      ((uint16_t)0x0004)
+#define GPIO_PIN_3      ((uint16_t)0x0008)
+#define GPIO_PIN_4      ((uint16_t)0x0010)
+#define GPIO_PIN_5      ((uint16_t)0x0020)
+#define GPIO_PIN_6      ((uint16_t)0x0040)
+#define GPIO_PIN_7      ((uint16_t)0x0080)
+#define GPIO_PIN_8      ((uint16_t)0x0100)
+#define GPIO_PIN_9      ((uint16_t)0x0200)
+#define GPIO_PIN_10     ((uint16_t)0x0400)
+#define GPIO_PIN_11     ((uint16_t)0x0800)
+#define GPIO_PIN_12     ((uint16_t)0x1000)
+#define GPIO_PIN_13     ((uint16_t)0x2000)
+#define GPIO_PIN_14     ((uint16_t)0x4000)
+#define GPIO_PIN_15     ((uint16_t)0x8000)
+#define GPIO_PIN_All    ((uint16_t)0xFFFF)
+
+#define GPIO_MODE_INPUT         0x00000000U
+#define GPIO_MODE_OUTPUT_PP     0x00000001U
+#define GPIO_MODE_OUTPUT_OD     0x00000011U
+#define GPIO_MODE_AF_PP         0x00000002U
+#define GPIO_MODE_AF_OD         0x00000012U
+#define GPIO_MODE_AF_INPUT      GPIO_MODE_INPUT
+#define GPIO_MODE_ANALOG        0x00000003U
+#define GPIO_MODE_IT_RISING     0x10110000U
+#define GPIO_MODE_IT_FALLING    0x10210000U
+#define GPIO_NOPULL             0x00000000U
+#define GPIO_PULLUP             0x00000001U
+#define GPIO_PULLDOWN           0x00000002U
+#define GPIO_SPEED_FREQ_LOW     0x00000002U
+#define GPIO_SPEED_FREQ_MEDIUM  0x00000001U
+#define GPIO_SPEED_FREQ_HIGH    0x00000003U
+
+typedef enum { GPIO_PIN_RESET = 0, GPIO_PIN_SET } GPIO_PinState;
+
+typedef struct {
+    uint32_t Pin;
+    uint32_t Mode;
+    uint32_t Pull;
+    uint32_t Speed;
+} GPIO_InitTypeDef;
+
+/* ===== DMA ===== */
+#define DMA_PERIPH_TO_MEMORY        0x00000000U
+#define DMA_MEMORY_TO_PERIPH        0x00000010U
+#define DMA_MEMORY_TO_MEMORY        0x00004000U
+#define DMA_PINC_ENABLE             0x00000040U
+#define DMA_PINC_DISABLE            0x00000000U
+#define DMA_MINC_ENABLE             0x00000080U
+#define DMA_MINC_DISABLE            0x00000000U
+#define DMA_PDATAALIGN_BYTE         0x00000000U
+#define DMA_PDATAALIGN_HALFWORD     0x00000100U
+#define DMA_PDATAALIGN_WORD         0x00000200U
+#define DMA_MDATAALIGN_BYTE         0x00000000U
+#define DMA_MDATAALIGN_HALFWORD     0x00000400U
+#define DMA_MDATAALIGN_WORD         0x00000800U
+#define DMA_NORMAL                  0x00000000U
+#define DMA_CIRCULAR                0x00000020U
+#define DMA_PRIORITY_LOW            0x00000000U
+#define DMA_PRIORITY_MEDIUM         0x00001000U
+#define DMA_PRIORITY_HIGH           0x00002000U
+#define DMA_PRIORITY_VERY_HIGH      0x00003000U
+
+typedef enum {
+    HAL_DMA_STATE_RESET = 0x00U,
+    HAL_DMA_STATE_READY = 0x01U,
+    HAL_DMA_STATE_BUSY = 0x02U,
+    HAL_DMA_STATE_TIMEOUT = 0x03U
+} HAL_DMA_StateTypeDef;
+
+typedef struct {
+    uint32_t Direction;
+    uint32_t PeriphInc;
+    uint32_t MemInc;
+    uint32_t PeriphDataAlignment;
+    uint32_t MemDataAlignment;
+    uint32_t Mode;
+    uint32_t Priority;
+} DMA_InitTypeDef;
+
+typedef struct __DMA_HandleTypeDef {
+    DMA_Channel_TypeDef *Instance;
+    DMA_InitTypeDef Init;
+    HAL_LockTypeDef Lock;
+    HAL_DMA_StateTypeDef State;
+    void *Parent;
+    void (*XferCpltCallback)(struct __DMA_HandleTypeDef *hdma);
+    void (*XferHalfCpltCallback)(struct __DMA_HandleTypeDef *hdma);
+    void (*XferErrorCallback)(struct __DMA_HandleTypeDef *hdma);
+    void (*XferAbortCallback)(struct __DMA_HandleTypeDef *hdma);
+    __IO uint32_t ErrorCode;
+} DMA_HandleTypeDef;
+
+#define __HAL_LINKDMA(__HANDLE__, __PPP_DMA_FIELD__, __DMA_HANDLE__) \
+    do { (__HANDLE__)->__PPP_DMA_FIELD__ = &(__DMA_HANDLE__); (__DMA_HANDLE__).Parent = (__HANDLE__); } while (0)
+
+#define __HAL_DMA_GET_COUNTER(__HANDLE__)   ((__HANDLE__)->Instance->CNDTR)
+
+/* ===== TIM ===== */
+#define TIM_CR1_CEN         0x0001U
+#define TIM_CR1_UDIS        0x0002U
+#define TIM_CR1_URS         0x0004U
+#define TIM_CR1_ARPE        0x0080U
+#define TIM_DIER_UIE        0x0001U
+#define TIM_DIER_CC1IE      0x0002U
+#define TIM_DIER_CC2IE      0x0004U
+#define TIM_DIER_CC3IE      0x0008U
+#define TIM_DIER_CC4IE      0x0010U
+#define TIM_DIER_UDE        0x0100U
+#define TIM_DIER_CC1DE      0x0200U
+#define TIM_DIER_CC2DE      0x0400U
+#define TIM_DIER_CC3DE      0x0800U
+#define TIM_DIER_CC4DE      0x1000U
+#define TIM_SR_UIF          0x0001U
+#define TIM_SR_CC1IF        0x0002U
+#define TIM_SR_CC2IF        0x0004U
+#define TIM_SR_CC3IF        0x0008U
+#define TIM_SR_CC4IF        0x0010U
+#define TIM_EGR_UG          0x0001U
+#define TIM_EGR_CC1G        0x0002U
+#define TIM_EGR_CC2G        0x0004U
+#define TIM_EGR_CC3G        0x0008U
+#define TIM_EGR_CC4G        0x0010U
+#define TIM_CCER_CC1E       0x0001U
+#define TIM_CCER_CC1P       0x0002U
+#define TIM_CCMR1_CC1S      0x0003U
+#define TIM_CCMR1_OC1PE     0x0008U
+#define TIM_CCMR1_OC1M      0x0070U
+#define TIM_BDTR_MOE        0x8000U
+
+#define TIM_CHANNEL_1       0x00000000U
+#define TIM_CHANNEL_2       0x00000004U
+#define TIM_CHANNEL_3       0x00000008U
+#define TIM_CHANNEL_4       0x0000000CU
+#define TIM_CHANNEL_ALL     0x0000003CU
+
+#define TIM_COUNTERMODE_UP                  0x00000000U
+#define TIM_CLOCKDIVISION_DIV1              0x00000000U
+#define TIM_AUTORELOAD_PRELOAD_DISABLE      0x00000000U
+#define TIM_AUTORELOAD_PRELOAD_ENABLE       TIM_CR1_ARPE
+#define TIM_CLOCKSOURCE_INTERNAL            0x00001000U
+#define TIM_TRGO_RESET                      0x00000000U
+#define TIM_MASTERSLAVEMODE_DISABLE         0x00000000U
+#define TIM_OCMODE_TIMING                   0x00000000U
+#define TIM_OCMODE_ACTIVE                   0x00000010U
+#define TIM_OCMODE_INACTIVE                 0x00000020U
+#define TIM_OCMODE_TOGGLE                   0x00000030U
+#define TIM_OCMODE_PWM1                     0x00000060U
+#define TIM_OCMODE_PWM2                     0x00000070U
+#define TIM_OCPOLARITY_HIGH                 0x00000000U
+#define TIM_OCPOLARITY_LOW                  0x00000002U
+#define TIM_OCNPOLARITY_HIGH                0x00000000U
+#define TIM_OCFAST_DISABLE                  0x00000000U
+#define TIM_OCIDLESTATE_RESET               0x00000000U
+#define TIM_OCNIDLESTATE_RESET              0x00000000U
+#define TIM_INPUTCHANNELPOLARITY_RISING     0x00000000U
+#define TIM_INPUTCHANNELPOLARITY_FALLING    0x00000002U
+#define TIM_ICSELECTION_DIRECTTI            0x00000001U
+#define TIM_ICPSC_DIV1                      0x00000000U
+#define TIM_OSSR_DISABLE                    0x00000000U
+#define TIM_OSSI_DISABLE                    0x00000000U
+#define TIM_LOCKLEVEL_OFF                   0x00000000U
+#define TIM_BREAK_DISABLE                   0x00000000U
+#define TIM_BREAKPOLARITY_HIGH              0x00002000U
+#define TIM_AUTOMATICOUTPUT_DISABLE         0x00000000U
+
+#define TIM_DMA_UPDATE                      TIM_DIER_UDE
+#define TIM_DMA_CC1                         TIM_DIER_CC1DE
+#define TIM_DMA_CC2                         TIM_DIER_CC2DE
+#define TIM_DMA_CC3                         TIM_DIER_CC3DE
+#define TIM_DMA_CC4                         TIM_DIER_CC4DE
+#define TIM_DMA_ID_UPDATE                   ((uint16_t)0x0000)
+#define TIM_DMA_ID_CC1                      ((uint16_t)0x0001)
+#define TIM_DMA_ID_CC2                      ((uint16_t)0x0002)
+#define TIM_DMA_ID_CC3                      ((uint16_t)0x0003)
+#define TIM_DMA_ID_CC4                      ((uint16_t)0x0004)
+#define TIM_DMABASE_ARR                     0x0000000BU
+#define TIM_DMABURSTLENGTH_1TRANSFER        0x00000000U
+#define TIM_DMABURSTLENGTH_2TRANSFERS       0x00000100U
+#define TIM_DMABURSTLENGTH_3TRANSFERS       0x00000200U
+#define TIM_DMABURSTLENGTH_4TRANSFERS       0x00000300U
+
+typedef enum {
+    HAL_TIM_ACTIVE_CHANNEL_1 = 0x01U,
+    HAL_TIM_ACTIVE_CHANNEL_2 = 0x02U,
+    HAL_TIM_ACTIVE_CHANNEL_3 = 0x04U,
+    HAL_TIM_ACTIVE_CHANNEL_4 = 0x08U,
+    HAL_TIM_ACTIVE_CHANNEL_CLEARED = 0x00U
+} HAL_TIM_ActiveChannel;
+
+typedef enum {
+    HAL_TIM_STATE_RESET = 0x00U,
+    HAL_TIM_STATE_READY = 0x01U,
+    HAL_TIM_STATE_BUSY = 0x02U
+} HAL_TIM_StateTypeDef;
+
+typedef struct {
+    uint32_t Prescaler;
+    uint32_t CounterMode;
+    uint32_t Period;
+    uint32_t ClockDivision;
+    uint32_t RepetitionCounter;
+    uint32_t AutoReloadPreload;
+} TIM_Base_InitTypeDef;
+
+typedef struct {
+    uint32_t OCMode;
+    uint32_t Pulse;
+    uint32_t OCPolarity;
+    uint32_t OCNPolarity;
+    uint32_t OCFastMode;
+    uint32_t OCIdleState;
+    uint32_t OCNIdleState;
+} TIM_OC_InitTypeDef;
+
+typedef struct {
+    uint32_t ICPolarity;
+    uint32_t ICSelection;
+    uint32_t ICPrescaler;
+    uint32_t ICFilter;
+} TIM_IC_InitTypeDef;
+
+typedef struct {
+    uint32_t ClockSource;
+    uint32_t ClockPolarity;
+    uint32_t ClockPrescaler;
+    uint32_t ClockFilter;
+} TIM_ClockConfigTypeDef;
+
+typedef struct {
+    uint32_t MasterOutputTrigger;
+    uint32_t MasterSlaveMode;
+} TIM_MasterConfigTypeDef;
+
+typedef struct {
+    uint32_t OffStateRunMode;
+    uint32_t OffStateIDLEMode;
+    uint32_t LockLevel;
+    uint32_t DeadTime;
+    uint32_t BreakState;
+    uint32_t BreakPolarity;
+    uint32_t AutomaticOutput;
+} TIM_BreakDeadTimeConfigTypeDef;
+
+typedef struct {
+    TIM_TypeDef *Instance;
+    TIM_Base_InitTypeDef Init;
+    HAL_TIM_ActiveChannel Channel;
+    DMA_HandleTypeDef *hdma[7];
+    HAL_LockTypeDef Lock;
+    __IO HAL_TIM_StateTypeDef State;
+} TIM_HandleTypeDef;
+
+#define __HAL_TIM_SET_COMPARE(__HANDLE__, __CHANNEL__, __COMPARE__) \
+    (*(__IO uint32_t *)(&((__HANDLE__)->Instance->CCR1) + ((__CHANNEL__) >> 2U)) = (__COMPARE__))
+#define __HAL_TIM_GET_COMPARE(__HANDLE__, __CHANNEL__) \
+    (*(__IO uint32_t *)(&((__HANDLE__)->Instance->CCR1) + ((__CHANNEL__) >> 2U)))
+#define __HAL_TIM_SET_AUTORELOAD(__HANDLE__, __AUTORELOAD__) \
+    do { (__HANDLE__)->Instance->ARR = (__AUTORELOAD__); (__HANDLE__)->Init.Period = (__AUTORELOAD__); } while (0)
+#define __HAL_TIM_GET_AUTORELOAD(__HANDLE__)    ((__HANDLE__)->Instance->ARR)
+#define __HAL_TIM_SET_COUNTER(__HANDLE__, __COUNTER__)  ((__HANDLE__)->Instance->CNT = (__COUNTER__))
+#define __HAL_TIM_GET_COUNTER(__HANDLE__)       ((__HANDLE__)->Instance->CNT)
+#define __HAL_TIM_SET_CAPTUREPOLARITY(__HANDLE__, __CHANNEL__, __POLARITY__) \
+    do { (__HANDLE__)->Instance->CCER &= ~(TIM_CCER_CC1P << (__CHANNEL__)); \
+         (__HANDLE__)->Instance->CCER |= ((__POLARITY__) << (__CHANNEL__)); } while (0)
+
+/* ===== SPI ===== */
+#define SPI_MODE_MASTER             0x00000104U
+#define SPI_DIRECTION_2LINES        0x00000000U
+#define SPI_DATASIZE_8BIT           0x00000000U
+#define SPI_POLARITY_LOW            0x00000000U
+#define SPI_PHASE_1EDGE             0x00000000U
+#define SPI_NSS_SOFT                0x00000200U
+#define SPI_BAUDRATEPRESCALER_2     0x00000000U
+#define SPI_BAUDRATEPRESCALER_4     0x00000008U
+#define SPI_BAUDRATEPRESCALER_8     0x00000010U
+#define SPI_BAUDRATEPRESCALER_16    0x00000018U
+#define SPI_BAUDRATEPRESCALER_32    0x00000020U
+#define SPI_FIRSTBIT_MSB            0x00000000U
+#define SPI_TIMODE_DISABLE          0x00000000U
+#define SPI_CRCCALCULATION_DISABLE  0x00000000U
+
+typedef enum {
+    HAL_SPI_STATE_RESET = 0x00U,
+    HAL_SPI_STATE_READY = 0x01U,
+    HAL_SPI_STATE_BUSY = 0x02U,
+    HAL_SPI_STATE_BUSY_TX = 0x03U
+} HAL_SPI_StateTypeDef;
+
+typedef struct {
+    uint32_t Mode;
+    uint32_t Direction;
+    uint32_t DataSize;
+    uint32_t CLKPolarity;
+    uint32_t CLKPhase;
+    uint32_t NSS;
+    uint32_t BaudRatePrescaler;
+    uint32_t FirstBit;
+    uint32_t TIMode;
+    uint32_t CRCCalculation;
+    uint32_t CRCPolynomial;
+} SPI_InitTypeDef;
+
+typedef struct __SPI_HandleTypeDef {
+    SPI_TypeDef *Instance;
+    SPI_InitTypeDef Init;
+    uint8_t *pTxBuffPtr;
+    uint16_t TxXferSize;
+    __IO uint16_t TxXferCount;
+    DMA_HandleTypeDef *hdmatx;
+    DMA_HandleTypeDef *hdmarx;
+    HAL_LockTypeDef Lock;
+    __IO HAL_SPI_StateTypeDef State;
+    __IO uint32_t ErrorCode;
+} SPI_HandleTypeDef;
+
+/* ===== I2C ===== */
+#define I2C_DUTYCYCLE_2             0x00000000U
+#define I2C_ADDRESSINGMODE_7BIT     0x00004000U
+#define I2C_DUALADDRESS_DISABLE     0x00000000U
+#define I2C_GENERALCALL_DISABLE     0x00000000U
+#define I2C_NOSTRETCH_DISABLE       0x00000000U
+#define HAL_I2C_ERROR_NONE          0x00000000U
+#define HAL_I2C_ERROR_AF            0x00000004U
+
+typedef enum {
+    HAL_I2C_STATE_RESET = 0x00U,
+    HAL_I2C_STATE_READY = 0x20U,
+    HAL_I2C_STATE_BUSY = 0x24U,
+    HAL_I2C_STATE_BUSY_TX = 0x21U
+} HAL_I2C_StateTypeDef;
+
+typedef struct {
+    uint32_t ClockSpeed;
+    uint32_t DutyCycle;
+    uint32_t OwnAddress1;
+    uint32_t AddressingMode;
+    uint32_t DualAddressMode;
+    uint32_t OwnAddress2;
+    uint32_t GeneralCallMode;
+    uint32_t NoStretchMode;
+} I2C_InitTypeDef;
+
+typedef struct {
+    I2C_TypeDef *Instance;
+    I2C_InitTypeDef Init;
+    uint8_t *pBuffPtr;
+    uint16_t XferSize;
+    __IO uint16_t XferCount;
+    DMA_HandleTypeDef *hdmatx;
+    DMA_HandleTypeDef *hdmarx;
+    HAL_LockTypeDef Lock;
+    __IO HAL_I2C_StateTypeDef State;
+    __IO uint32_t ErrorCode;
+    __IO uint32_t Devaddress;
+} I2C_HandleTypeDef;
+
+/* ===== UART ===== */
+#define USART_SR_PE         0x0001U
+#define USART_SR_FE         0x0002U
+#define USART_SR_NE         0x0004U
+#define USART_SR_ORE        0x0008U
+#define USART_SR_IDLE       0x0010U
+#define USART_SR_RXNE       0x0020U
+#define USART_SR_TC         0x0040U
+#define USART_SR_TXE        0x0080U
+#define USART_CR1_IDLEIE    0x0010U
+#define USART_CR1_TCIE      0x0040U
+#define USART_CR1_RXNEIE    0x0020U
+#define USART_CR1_PEIE      0x0100U
+#define USART_CR3_EIE       0x0001U
+#define USART_CR3_DMAR      0x0040U
+#define USART_CR3_DMAT      0x0080U
+
+#define UART_FLAG_PE        USART_SR_PE
+#define UART_FLAG_FE        USART_SR_FE
+#define UART_FLAG_NE        USART_SR_NE
+#define UART_FLAG_ORE       USART_SR_ORE
+#define UART_FLAG_IDLE      USART_SR_IDLE
+#define UART_FLAG_RXNE      USART_SR_RXNE
+
+#define UART_WORDLENGTH_8B      0x00000000U
+#define UART_STOPBITS_1         0x00000000U
+#define UART_PARITY_NONE        0x00000000U
+#define UART_MODE_TX_RX         0x0000000CU
+#define UART_HWCONTROL_NONE     0x00000000U
+#define UART_OVERSAMPLING_16    0x00000000U
+
+#define HAL_UART_RECEPTION_STANDARD     0x00000000U
+#define HAL_UART_RECEPTION_TOIDLE       0x00000001U
+#define HAL_UART_RXEVENT_TC             0x00000000U
+#define HAL_UART_RXEVENT_HT             0x00000001U
+#define HAL_UART_RXEVENT_IDLE           0x00000002U
+
+typedef enum {
+    HAL_UART_STATE_RESET = 0x00U,
+    HAL_UART_STATE_READY = 0x20U,
+    HAL_UART_STATE_BUSY = 0x24U,
+    HAL_UART_STATE_BUSY_TX = 0x21U,
+    HAL_UART_STATE_BUSY_RX = 0x22U,
+    HAL_UART_STATE_BUSY_TX_RX = 0x23U,
+    HAL_UART_STATE_TIMEOUT = 0xA0U,
+    HAL_UART_STATE_ERROR = 0xE0U
+} HAL_UART_StateTypeDef;
+
+typedef struct {
+    uint32_t BaudRate;
+    uint32_t WordLength;
+    uint32_t StopBits;
+    uint32_t Parity;
+    uint32_t Mode;
+    uint32_t HwFlowCtl;
+    uint32_t OverSampling;
+} UART_InitTypeDef;
+
+typedef struct __UART_HandleTypeDef {
+    USART_TypeDef *Instance;
+    UART_InitTypeDef Init;
+    const uint8_t *pTxBuffPtr;
+    uint16_t TxXferSize;
+    __IO uint16_t TxXferCount;
+    uint8_t *pRxBuffPtr;
+    uint16_t RxXferSize;
+    __IO uint16_t RxXferCount;
+    __IO uint32_t ReceptionType;
+    __IO uint32_t RxEventType;
+    DMA_HandleTypeDef *hdmatx;
+    DMA_HandleTypeDef *hdmarx;
+    HAL_LockTypeDef Lock;
+    __IO HAL_UART_StateTypeDef gState;
+    __IO HAL_UART_StateTypeDef RxState;
+    __IO uint32_t ErrorCode;
+} UART_HandleTypeDef;
+
+#define __HAL_UART_GET_FLAG(__HANDLE__, __FLAG__)   (((__HANDLE__)->Instance->SR & (__FLAG__)) == (__FLAG__))
+#define __HAL_UART_CLEAR_PEFLAG(__HANDLE__) \
+    do { (__HANDLE__)->Instance->SR &= ~(uint32_t)(USART_SR_PE | USART_SR_FE | USART_SR_NE | USART_SR_ORE | USART_SR_IDLE); } while (0)
+#define __HAL_UART_CLEAR_OREFLAG(__HANDLE__)    __HAL_UART_CLEAR_PEFLAG(__HANDLE__)
+#define __HAL_UART_CLEAR_IDLEFLAG(__HANDLE__)   __HAL_UART_CLEAR_PEFLAG(__HANDLE__)
+
+/* ===== HAL 함수 ===== */
+
+/* 코어 / 시계 */
+HAL_StatusTypeDef HAL_Init(void);
+void HAL_MspInit(void);
+void HAL_IncTick(void);
+uint32_t HAL_GetTick(void);
+void HAL_Delay(uint32_t Delay);
+HAL_StatusTypeDef HAL_RCC_OscConfig(RCC_OscInitTypeDef *RCC_OscInitStruct);
+HAL_StatusTypeDef HAL_RCC_ClockConfig(RCC_ClkInitTypeDef *RCC_ClkInitStruct, uint32_t FLatency);
+uint32_t HAL_RCC_GetHCLKFreq(void);
+uint32_t HAL_RCC_GetPCLK1Freq(void);
+uint32_t HAL_RCC_GetPCLK2Freq(void);
+void HAL_NVIC_SetPriority(IRQn_Type IRQn, uint32_t PreemptPriority, uint32_t SubPriority);
+void HAL_NVIC_EnableIRQ(IRQn_Type IRQn);
+void HAL_NVIC_DisableIRQ(IRQn_Type IRQn);
+
+/* GPIO */
+void HAL_GPIO_Init(GPIO_TypeDef *GPIOx, GPIO_InitTypeDef *GPIO_Init);
+void HAL_GPIO_DeInit(GPIO_TypeDef *GPIOx, uint32_t GPIO_Pin);
+GPIO_PinState HAL_GPIO_ReadPin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin);
+void HAL_GPIO_WritePin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin, GPIO_PinState PinState);
+void HAL_GPIO_TogglePin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin);
+
+/* DMA */
+HAL_StatusTypeDef HAL_DMA_Init(DMA_HandleTypeDef *hdma);
+HAL_StatusTypeDef HAL_DMA_DeInit(DMA_HandleTypeDef *hdma);
+void HAL_DMA_IRQHandler(DMA_HandleTypeDef *hdma);
+
+/* TIM */
+HAL_StatusTypeDef HAL_TIM_Base_Init(TIM_HandleTypeDef *htim);
+HAL_StatusTypeDef HAL_TIM_Base_Start(TIM_HandleTypeDef *htim);
+HAL_StatusTypeDef HAL_TIM_PWM_Init(TIM_HandleTypeDef *htim);
+HAL_StatusTypeDef HAL_TIM_PWM_ConfigChannel(TIM_HandleTypeDef *htim, TIM_OC_InitTypeDef *sConfig, uint32_t Channel);
+HAL_StatusTypeDef HAL_TIM_PWM_Start(TIM_HandleTypeDef *htim, uint32_t Channel);
+HAL_StatusTypeDef HAL_TIM_PWM_Stop(TIM_HandleTypeDef *htim, uint32_t Channel);
+HAL_StatusTypeDef HAL_TIM_OC_ConfigChannel(TIM_HandleTypeDef *htim, TIM_OC_InitTypeDef *sConfig, uint32_t Channel);
+HAL_StatusTypeDef HAL_TIM_IC_Init(TIM_HandleTypeDef *htim);
+HAL_StatusTypeDef HAL_TIM_IC_ConfigChannel(TIM_HandleTypeDef *htim, TIM_IC_InitTypeDef *sConfig, uint32_t Channel);
+HAL_StatusTypeDef HAL_TIM_IC_Start_IT(TIM_HandleTypeDef *htim, uint32_t Channel);
+HAL_StatusTypeDef HAL_TIM_ConfigClockSource(TIM_HandleTypeDef *htim, TIM_ClockConfigTypeDef *sClockSourceConfig);
+HAL_StatusTypeDef HAL_TIMEx_MasterConfigSynchronization(TIM_HandleTypeDef *htim, TIM_MasterConfigTypeDef *sMasterConfig);
+HAL_StatusTypeDef HAL_TIMEx_ConfigBreakDeadTime(TIM_HandleTypeDef *htim, TIM_BreakDeadTimeConfigTypeDef *sBreakDeadTimeConfig);
+HAL_StatusTypeDef HAL_TIM_DMABurst_MultiWriteStart(TIM_HandleTypeDef *htim, uint32_t BurstBaseAddress,
+                                                   uint32_t BurstRequestSrc, uint32_t *BurstBuffer,
+                                                   uint32_t BurstLength, uint32_t DataLength);
+HAL_StatusTypeDef HAL_TIM_DMABurst_WriteStop(TIM_HandleTypeDef *htim, uint32_t BurstRequestSrc);
+uint32_t HAL_TIM_ReadCapturedValue(TIM_HandleTypeDef *htim, uint32_t Channel);
+void HAL_TIM_IRQHandler(TIM_HandleTypeDef *htim);
+void HAL_TIM_Base_MspInit(TIM_HandleTypeDef *htim);
+void HAL_TIM_Base_MspDeInit(TIM_HandleTypeDef *htim);
+void HAL_TIM_PWM_MspInit(TIM_HandleTypeDef *htim);
+void HAL_TIM_IC_MspInit(TIM_HandleTypeDef *htim);
+void HAL_TIM_PeriodElapsedCallback(TIM_HandleTypeDef *htim);
+void HAL_TIM_OC_DelayElapsedCallback(TIM_HandleTypeDef *htim);
+void HAL_TIM_IC_CaptureCallback(TIM_HandleTypeDef *htim);
+void HAL_TIM_PWM_PulseFinishedCallback(TIM_HandleTypeDef *htim);
+void HAL_TIM_PWM_PulseFinishedHalfCpltCallback(TIM_HandleTypeDef *htim);
+
+/* SPI */
+HAL_StatusTypeDef HAL_SPI_Init(SPI_HandleTypeDef *hspi);
+HAL_StatusTypeDef HAL_SPI_Transmit(SPI_HandleTypeDef *hspi, uint8_t *pData, uint16_t Size, uint32_t Timeout);
+HAL_StatusTypeDef HAL_SPI_Transmit_DMA(SPI_HandleTypeDef *hspi, uint8_t *pData, uint16_t Size);
+HAL_StatusTypeDef HAL_SPI_DMAStop(SPI_HandleTypeDef *hspi);
+void HAL_SPI_IRQHandler(SPI_HandleTypeDef *hspi);
+void HAL_SPI_MspInit(SPI_HandleTypeDef *hspi);
+void HAL_SPI_MspDeInit(SPI_HandleTypeDef *hspi);
+void HAL_SPI_TxCpltCallback(SPI_HandleTypeDef *hspi);
+void HAL_SPI_ErrorCallback(SPI_HandleTypeDef *hspi);
+
+/* I2C */
+HAL_StatusTypeDef HAL_I2C_Init(I2C_HandleTypeDef *hi2c);
+HAL_StatusTypeDef HAL_I2C_Master_Transmit(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint8_t *pData,
+                                          uint16_t Size, uint32_t Timeout);
+HAL_StatusTypeDef HAL_I2C_Master_Transmit_IT(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint8_t *pData,
+                                             uint16_t Size);
+HAL_StatusTypeDef HAL_I2C_IsDeviceReady(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint32_t Trials,
+                                        uint32_t Timeout);
+void HAL_I2C_EV_IRQHandler(I2C_HandleTypeDef *hi2c);
+void HAL_I2C_ER_IRQHandler(I2C_HandleTypeDef *hi2c);
+void HAL_I2C_MspInit(I2C_HandleTypeDef *hi2c);
+void HAL_I2C_MspDeInit(I2C_HandleTypeDef *hi2c);
+void HAL_I2C_MasterTxCpltCallback(I2C_HandleTypeDef *hi2c);
+void HAL_I2C_ErrorCallback(I2C_HandleTypeDef *hi2c);
+
+/* UART */
+HAL_StatusTypeDef HAL_UART_Init(UART_HandleTypeDef *huart);
+HAL_StatusTypeDef HAL_UART_Transmit(UART_HandleTypeDef *huart, const uint8_t *pData, uint16_t Size, uint32_t Timeout);
+HAL_StatusTypeDef HAL_UART_Transmit_DMA(UART_HandleTypeDef *huart, const uint8_t *pData, uint16_t Size);
+HAL_StatusTypeDef HAL_UARTEx_ReceiveToIdle_DMA(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size);
+void HAL_UART_IRQHandler(UART_HandleTypeDef *huart);
+void HAL_UART_MspInit(UART_HandleTypeDef *huart);
+void HAL_UART_MspDeInit(UART_HandleTypeDef *huart);
+void HAL_UART_ErrorCallback(UART_HandleTypeDef *huart);
+void HAL_UART_TxCpltCallback(UART_HandleTypeDef *huart);
+void HAL_UARTEx_RxEventCallback(UART_HandleTypeDef *huart, uint16_t Size);
+
+#endif /* __STM32F1xx_HAL_H */
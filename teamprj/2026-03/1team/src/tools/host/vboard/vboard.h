@@ -0,0 +1,120 @@
+/**
+ * @file vboard.h
+ * @brief 가상 보드 (PC에서 펌웨어 전체 실행) - 가상 시계, 인터럽트, 주변장치 모델
+ *
+ * 빌드 (src/tools/host 에서, CMakeLists.txt 의 robot_host 타깃):
+ *   cmake -S . -B build && cmake --build build
+ *   → vboard_*.c + Core/Src, Core/Src/drivers 의 .c 전부 (syscalls, sysmem, system_stm32 제외),
+ *     펌웨어 main은 -Dmain=Firmware_Main 으로 이름만 바꿈
+ *   ./build/robot_host -t 5000 -u 2000:t -p lcd.png      # 5초, 2초에 USB로 't', LCD를 PNG로
+ *
+ * 구조:
+ * - 가상 시각(ns)은 펌웨어가 시계를 볼 때(DWT, TIMx, HAL_GetTick)와 HAL 호출 때만 진행
+ *   → 같은 입력이면 실행마다 결과가 같음 (-x 로 호스트 실행 시간을 섞을 수 있음)
+ * - Vb_Advance(): 다음 사건(SysTick, 타이머 갱신/비교, 에코 에지, DMA/I2C/UART 완료)을 시각 순서로 처리,
+ *   같은 시각의 사건을 다 처리한 뒤 NVIC 우선순위대로 stm32f1xx_it.c 핸들러 호출 (중첩 가능)
+ * - __WFI / HAL_Delay 는 다음 사건으로 바로 건너뜀
+ */
+
+#ifndef VBOARD_H
+#define VBOARD_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include "stm32f1xx_hal.h"
+
+#define VB_CORE_HZ      64000000u
+#define VB_TIMCLK_HZ    64000000u   // APB1 ×2, APB2 ×1 둘 다 64MHz
+#define VB_MS           1000000ull  // ns
+
+/* ===== 설정 (vboard_main.c 에서 채움) ===== */
+typedef struct {
+    uint64_t end_ns;            // 실행 시간
+    uint32_t poll_ns;           // 시계 읽기/HAL 호출 1번 비용
+    double   host_scale;        // 0 = 결정적, >0 = 호스트 실행 시간 × 배율을 가상 시간에 더함
+    uint32_t snap_ms;           // LCD 스냅샷 주기 (0 = 끝날 때만)
+    const char *png;            // LCD PNG 경로 (NULL = 안 씀)
+    uint8_t  png_zoom;
+    uint8_t  quiet;             // 펌웨어 UART 출력 숨김
+    FILE    *log;               // 버스 로그 (NULL = 안 씀)
+    FILE    *raw;               // USB(USART2) 송신 원본 (-r, tools/*.py --file 로 해석)
+} VbConfig_t;
+
+extern VbConfig_t vb_cfg;
+extern uint64_t vb_now;         // 가상 시각 ns
+extern uint8_t vb_stop;         // 1 = 끝내는 중 (사건/인터럽트 처리 안 함)
+
+/* ===== 시계 / 사건 (vboard_core.c) ===== */
+void Vb_Poll(void);                         // 레지스터 쓰기 반영 + poll_ns 진행
+void Vb_Busy(uint64_t ns);                  // 블로킹 전송처럼 시간만 보냄 (인터럽트는 들어옴)
+void Vb_Advance(uint64_t target);
+void Vb_Sleep(void);                        // 다음 사건까지
+void Vb_Dispatch(void);
+void Vb_SyncRegs(void);
+
+typedef struct {
+    const char *name;
+    uint64_t (*next)(void);                 // 다음 사건 시각 (없으면 UINT64_MAX)
+    void (*fire)(void);
+} VbSource_t;
+void Vb_AddSource(const VbSource_t *s);
+
+/* 주변장치 → 인터럽트 요청 (수준 감지: level()이 1인 동안 계속 요청, 핸들러가 플래그를 지워야 끝남) */
+void Vb_IrqLevel(IRQn_Type irq, int (*level)(void));
+
+/* DMA 채널 (vboard_core.c) */
+typedef struct {
+    DMA_HandleTypeDef *h;
+    uint8_t  on;
+    uint8_t  circ;
+    uint8_t  ie_ht, ie_tc;
+    uint8_t  flags;             // VB_DMA_HT | VB_DMA_TC
+    uint8_t  ht_done;
+    uint8_t  width;             // 메모리 쪽 1/2 바이트
+    uint8_t *mem;
+    uint16_t total;
+    uint32_t transfers;
+} VbDma_t;
+#define VB_DMA_HT   0x01
+#define VB_DMA_TC   0x02
+
+VbDma_t *Vb_DmaOf(DMA_HandleTypeDef *h);
+void Vb_DmaStart(DMA_HandleTypeDef *h, void *mem, uint16_t n, uint8_t ie);
+void Vb_DmaStop(DMA_HandleTypeDef *h);
+uint8_t *Vb_DmaNext(VbDma_t *d);            // 다음 전송 위치 + 카운터/HT/TC 처리 (NULL = 꺼짐)
+
+/* 타이머 (vboard_core.c) */
+uint16_t Vb_TimCapture(uint8_t n, uint8_t ch, uint8_t rising);   // 입력캡처 에지 → 1 = 캡처됨
+uint32_t Vb_TimCompare(uint8_t n, uint8_t ch);
+uint64_t Vb_TimNextUpdate(uint8_t n);
+TIM_TypeDef *Vb_TimPeek(uint8_t n);         // 시계 진행 없이 레지스터 보기 (장치 모델용)
+void Vb_OnTimUpdate(uint8_t n, void (*fn)(uint64_t t));
+
+/* 버스 (vboard_bus.c) */
+void Vb_BusInit(void);
+void Vb_UartInject(uint8_t port, uint64_t t_ns, const uint8_t *data, uint32_t len);
+void Vb_BusPrintStats(FILE *f);
+
+/* 장치 모델 (vboard_dev.c) */
+void Vb_DevInit(void);
+void Lcd_Spi(const uint8_t *p, uint16_t n);             // ST7735 (SPI2, CS = PB12, DC = PA8)
+void Lcd_WritePng(const char *path, uint8_t zoom);
+uint32_t Lcd_Pixels(void);
+void Clcd_Write(const uint8_t *data, uint16_t n);       // PCF8574 → HD44780
+void Clcd_Print(FILE *f);
+void Sonar_AddStep(uint64_t t_ns, uint16_t cm);         // 정면 거리 변화 (-d)
+void Sonar_AddSector(uint8_t a0, uint8_t a1, uint16_t cm);  // 서보 각도 구간 장애물 (-o)
+void Sonar_SetNoise(uint16_t cm);
+void Rgb_Gpio(uint16_t odr);                            // 상태 LED (PC5/PC6/PC8) 켜짐 시간 누적
+void Vb_DevPrintStats(FILE *f);
+
+/* 코어 통계 (vboard_core.c) */
+void Vb_CorePrintStats(FILE *f, double host_s);
+
+/* 로그 */
+void Vb_Log(const char *fmt, ...) __attribute__((format(printf, 1, 2)));
+
+/* 끝 (vboard_main.c) */
+void Vb_Finish(void);
+
+#endif /* VBOARD_H */
@@ -0,0 +1,708 @@
+/**
+ * @file vboard_bus.c
+ * @brief 가상 보드 버스 - SPI2 (ST7735), I2C1 (PCF8574 문자 LCD), USART2/3 (링크)
+ *
+ * 시간 모델:
+ * - SPI: 바이트 = 8 × 분주비 / PCLK1 (분주 4 → 1us), 블로킹은 그만큼 Vb_Busy, DMA는 끝 시각에 TC
+ * - I2C: 9비트 / ClockSpeed (100kHz → 90us) 단계, 인터럽트 전송은 단계마다 EV 인터럽트 1번
+ *        (핸들러가 끝난 뒤 다음 단계 예약 → 클럭 스트레칭처럼 핸들러가 늦으면 버스도 늦음)
+ * - UART: 글자 = 10비트 / 보율, 수신은 -u/-b 로 넣은 바이트를 DMA 버퍼에 쓰고 1글자 쉬면 IDLE
+ *   송신 DMA는 시작할 때 내용을 내보내고 글자 시간 뒤 TC → DMA 인터럽트 → USART TC 인터럽트 (HAL 순서)
+ *   USB 송신 → 터미널 (링크 프레임은 빼고), -r 파일에는 그대로
+ *
+ * 로그 (-l): 트랜잭션마다 [가상 ms] 버스 내용 한 줄
+ */
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "vboard.h"
+
+/* ===== SPI2 ===== */
+static struct {
+    SPI_HandleTypeDef *h;
+    uint8_t  active;            // DMA 전송 중
+    uint64_t t_end;
+    uint64_t bytes_blk, bytes_dma;
+    uint32_t xfers_blk, xfers_dma, stops;
+    uint64_t busy_ns;
+} spi;
+
+static uint64_t Spi_ByteNs(SPI_HandleTypeDef *h)
+{
+    uint32_t div = 2u << (h->Init.BaudRatePrescaler >> 3);
+    return 8ull * div * 1000000000ull / HAL_RCC_GetPCLK1Freq();
+}
+
+__weak void HAL_SPI_MspInit(SPI_HandleTypeDef *hspi) { UNUSED(hspi); }
+__weak void HAL_SPI_MspDeInit(SPI_HandleTypeDef *hspi) { UNUSED(hspi); }
+__weak void HAL_SPI_TxCpltCallback(SPI_HandleTypeDef *hspi) { UNUSED(hspi); }
+__weak void HAL_SPI_ErrorCallback(SPI_HandleTypeDef *hspi) { UNUSED(hspi); }
+
+HAL_StatusTypeDef HAL_SPI_Init(SPI_HandleTypeDef *hspi)
+{
+    if (!hspi) return HAL_ERROR;
+    if (hspi->State == HAL_SPI_STATE_RESET)
+    {
+        hspi->Lock = HAL_UNLOCKED;
+        HAL_SPI_MspInit(hspi);
+    }
+    spi.h = hspi;
+    hspi->ErrorCode = 0;
+    hspi->State = HAL_SPI_STATE_READY;
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_SPI_Transmit(SPI_HandleTypeDef *hspi, uint8_t *pData, uint16_t Size, uint32_t Timeout)
+{
+    UNUSED(Timeout);
+    Vb_Poll();
+    if (hspi->State != HAL_SPI_STATE_READY) return HAL_BUSY;
+    if (!pData || Size == 0) return HAL_ERROR;
+
+    hspi->State = HAL_SPI_STATE_BUSY_TX;
+    Lcd_Spi(pData, Size);
+    spi.bytes_blk += Size;
+    spi.xfers_blk++;
+
+    uint64_t ns = Size * Spi_ByteNs(hspi);
+    spi.busy_ns += ns;
+    Vb_Busy(ns);
+    hspi->State = HAL_SPI_STATE_READY;
+    return HAL_OK;
+}
+
+static void Spi_DmaTxCplt(DMA_HandleTypeDef *hdma)
+{
+    SPI_HandleTypeDef *hspi = (SPI_HandleTypeDef *)hdma->Parent;
+    hspi->TxXferCount = 0;
+    hspi->State = HAL_SPI_STATE_READY;
+    HAL_SPI_TxCpltCallback(hspi);
+}
+
+HAL_StatusTypeDef HAL_SPI_Transmit_DMA(SPI_HandleTypeDef *hspi, uint8_t *pData, uint16_t Size)
+{
+    Vb_Poll();
+    if (hspi->State != HAL_SPI_STATE_READY) return HAL_BUSY;
+    if (!pData || Size == 0 || !hspi->hdmatx) return HAL_ERROR;
+
+    hspi->State = HAL_SPI_STATE_BUSY_TX;
+    hspi->pTxBuffPtr = pData;
+    hspi->TxXferSize = Size;
+    hspi->TxXferCount = Size;
+    hspi->hdmatx->XferCpltCallback = Spi_DmaTxCplt;
+    hspi->hdmatx->XferHalfCpltCallback = NULL;
+    hspi->hdmatx->XferErrorCallback = NULL;
+    Vb_DmaStart(hspi->hdmatx, pData, Size, 1);
+
+    /* 전송 중에는 버퍼를 안 건드리므로 시작할 때 핀(DC/CS)과 같이 장치에 넘김 */
+    Lcd_Spi(pData, Size);
+    spi.bytes_dma += Size;
+    spi.xfers_dma++;
+
+    uint64_t ns = Size * Spi_ByteNs(hspi);
+    spi.busy_ns += ns;
+    spi.t_end = vb_now + ns;
+    spi.active = 1;
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_SPI_DMAStop(SPI_HandleTypeDef *hspi)
+{
+    Vb_Poll();
+    spi.active = 0;
+    spi.stops++;
+    if (hspi->hdmatx) Vb_DmaStop(hspi->hdmatx);
+    hspi->State = HAL_SPI_STATE_READY;
+    return HAL_OK;
+}
+
+void HAL_SPI_IRQHandler(SPI_HandleTypeDef *hspi)
+{
+    UNUSED(hspi);               // 에러 인터럽트만 켜져 있고 모델에는 에러 없음
+}
+
+static uint64_t Spi_Next(void)
+{
+    return spi.active ? spi.t_end : UINT64_MAX;
+}
+
+static void Spi_Fire(void)
+{
+    VbDma_t *d = Vb_DmaOf(spi.h->hdmatx);
+
+    spi.active = 0;
+    while (d && Vb_DmaNext(d));     // 남은 전송 → TC
+}
+
+static const VbSource_t spi_src = { "SPI2", Spi_Next, Spi_Fire };
+
+/* ===== I2C1 ===== */
+#define I2C_DEV_CLCD    0x27
+
+static struct {
+    I2C_HandleTypeDef *h;
+    uint8_t  active;
+    uint8_t  ev, er;            // 인터럽트 요청
+    uint16_t step, steps;       // 시작+주소, 데이터 n, 정지
+    uint64_t t_next;
+    uint32_t xfers, bytes, nacks, probes;
+    uint64_t busy_ns;
+} i2c;
+
+static uint64_t I2c_StepNs(I2C_HandleTypeDef *h)
+{
+    uint32_t hz = h->Init.ClockSpeed ? h->Init.ClockSpeed : 100000u;
+    return 9ull * 1000000000ull / hz;
+}
+
+static uint8_t I2c_Present(uint16_t addr)
+{
+    return (addr >> 1) == I2C_DEV_CLCD;
+}
+
+static void I2c_Deliver(uint16_t addr, const uint8_t *p, uint16_t n)
+{
+    i2c.xfers++;
+    i2c.bytes += n;
+    if ((addr >> 1) == I2C_DEV_CLCD) Clcd_Write(p, n);
+    if (vb_cfg.log)
+    {
+        fprintf(vb_cfg.log, "[%10.3f] I2C  0x%02X %3u:", vb_now / 1e6, addr >> 1, n);
+        for (uint16_t i = 0; i < n && i < 16; i++) fprintf(vb_cfg.log, " %02X", p[i]);
+        fprintf(vb_cfg.log, n > 16 ? " ...\n" : "\n");
+    }
+}
+
+__weak void HAL_I2C_MspInit(I2C_HandleTypeDef *hi2c) { UNUSED(hi2c); }
+__weak void HAL_I2C_MspDeInit(I2C_HandleTypeDef *hi2c) { UNUSED(hi2c); }
+__weak void HAL_I2C_MasterTxCpltCallback(I2C_HandleTypeDef *hi2c) { UNUSED(hi2c); }
+__weak void HAL_I2C_ErrorCallback(I2C_HandleTypeDef *hi2c) { UNUSED(hi2c); }
+
+HAL_StatusTypeDef HAL_I2C_Init(I2C_HandleTypeDef *hi2c)
+{
+    if (!hi2c) return HAL_ERROR;
+    if (hi2c->State == HAL_I2C_STATE_RESET)
+    {
+        hi2c->Lock = HAL_UNLOCKED;
+        HAL_I2C_MspInit(hi2c);
+    }
+    i2c.h = hi2c;
+    hi2c->ErrorCode = HAL_I2C_ERROR_NONE;
+    hi2c->State = HAL_I2C_STATE_READY;
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_I2C_Master_Transmit(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint8_t *pData,
+                                          uint16_t Size, uint32_t Timeout)
+{
+    UNUSED(Timeout);
+    Vb_Poll();
+    if (hi2c->State != HAL_I2C_STATE_READY) return HAL_BUSY;
+
+    hi2c->State = HAL_I2C_STATE_BUSY_TX;
+    hi2c->ErrorCode = HAL_I2C_ERROR_NONE;
+
+    if (!I2c_Present(DevAddress))
+    {
+        i2c.nacks++;
+        Vb_Busy(I2c_StepNs(hi2c));
+        hi2c->ErrorCode = HAL_I2C_ERROR_AF;
+        hi2c->State = HAL_I2C_STATE_READY;
+        return HAL_ERROR;
+    }
+
+    uint64_t ns = (Size + 1u) * I2c_StepNs(hi2c) + 20000u;     // + 시작/정지
+    i2c.busy_ns += ns;
+    Vb_Busy(ns);
+    I2c_Deliver(DevAddress, pData, Size);
+    hi2c->State = HAL_I2C_STATE_READY;
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_I2C_IsDeviceReady(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint32_t Trials,
+                                        uint32_t Timeout)
+{
+    UNUSED(Timeout);
+    Vb_Poll();
+    if (hi2c->State != HAL_I2C_STATE_READY) return HAL_BUSY;
+
+    for (uint32_t i = 0; i < Trials; i++)
+    {
+        i2c.probes++;
+        Vb_Busy(I2c_StepNs(hi2c) + 10000u);
+        if (I2c_Present(DevAddress)) return HAL_OK;
+    }
+    return HAL_ERROR;
+}
+
+HAL_StatusTypeDef HAL_I2C_Master_Transmit_IT(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint8_t *pData,
+                                             uint16_t Size)
+{
+    Vb_Poll();
+    if (hi2c->State != HAL_I2C_STATE_READY) return HAL_BUSY;
+
+    hi2c->State = HAL_I2C_STATE_BUSY_TX;
+    hi2c->ErrorCode = HAL_I2C_ERROR_NONE;
+    hi2c->Devaddress = DevAddress;
+    hi2c->pBuffPtr = pData;
+    hi2c->XferSize = Size;
+    hi2c->XferCount = Size;
+
+    i2c.active = 1;
+    i2c.step = 0;
+    i2c.steps = Size + 2u;
+    i2c.t_next = vb_now + I2c_StepNs(hi2c);
+    i2c.busy_ns += i2c.steps * I2c_StepNs(hi2c);
+    return HAL_OK;
+}
+
+void HAL_I2C_EV_IRQHandler(I2C_HandleTypeDef *hi2c)
+{
+    Vb_Poll();
+    if (!i2c.ev) return;
+    i2c.ev = 0;
+    i2c.step++;
+
+    if (i2c.step == 1 && !I2c_Present((uint16_t)hi2c->Devaddress))
+    {
+        i2c.er = 1;             // 주소 NACK → ER 인터럽트
+        return;
+    }
+
+    if (i2c.step >= i2c.steps)
+    {
+        i2c.active = 0;
+        hi2c->XferCount = 0;
+        hi2c->State = HAL_I2C_STATE_READY;
+        I2c_Deliver((uint16_t)hi2c->Devaddress, hi2c->pBuffPtr, hi2c->XferSize);
+        HAL_I2C_MasterTxCpltCallback(hi2c);
+        return;
+    }
+
+    if (i2c.step > 1 && hi2c->XferCount) hi2c->XferCount--;
+    i2c.t_next = vb_now + I2c_StepNs(hi2c);     // 핸들러가 끝난 뒤부터 다음 단계
+}
+
+void HAL_I2C_ER_IRQHandler(I2C_HandleTypeDef *hi2c)
+{
+    Vb_Poll();
+    if (!i2c.er) return;
+    i2c.er = 0;
+    i2c.active = 0;
+    i2c.nacks++;
+    hi2c->ErrorCode |= HAL_I2C_ERROR_AF;
+    hi2c->State = HAL_I2C_STATE_READY;
+    HAL_I2C_ErrorCallback(hi2c);
+}
+
+static uint64_t I2c_Next(void)
+{
+    return (i2c.active && !i2c.ev && !i2c.er) ? i2c.t_next : UINT64_MAX;
+}
+
+static void I2c_Fire(void)
+{
+    i2c.ev = 1;
+}
+
+static int I2c_EvLevel(void) { return i2c.ev; }
+static int I2c_ErLevel(void) { return i2c.er; }
+
+static const VbSource_t i2c_src = { "I2C1", I2c_Next, I2c_Fire };
+
+/* ===== USART2/3 ===== */
+#define RX_QUEUE    4096
+
+typedef struct {
+    uint64_t t;                 // 이 시각 이후에 보냄
+    uint8_t  b;
+} RxByte_t;
+
+typedef struct {
+    UART_HandleTypeDef *h;
+    RxByte_t q[RX_QUEUE];
+    uint16_t n, rd;
+    uint64_t last;              // 마지막 바이트 도착 시각
+    uint64_t t_idle;            // IDLE 검출 시각 (0 = 없음)
+    uint8_t  tx_active;         // 송신 DMA 중
+    uint64_t t_tx_end;
+    uint32_t tx_bytes, rx_bytes, rx_dropped, tx_dma;
+} UartPort_t;
+
+static UartPort_t uart[4];
+
+static UartPort_t *Uart_Of(UART_HandleTypeDef *h)
+{
+    for (uint8_t i = 1; i < 4; i++)
+        if (h->Instance == &vb_usart[i]) return &uart[i];
+    return NULL;
+}
+
+static uint64_t Uart_CharNs(const UartPort_t *u)
+{
+    uint32_t baud = (u->h && u->h->Init.BaudRate) ? u->h->Init.BaudRate : 115200u;
+    return 10ull * 1000000000ull / baud;
+}
+
+static uint64_t Uart_NextByte(const UartPort_t *u)
+{
+    if (u->rd >= u->n) return UINT64_MAX;
+    uint64_t t = u->last + Uart_CharNs(u);
+    return (u->q[u->rd].t > t) ? u->q[u->rd].t : t;
+}
+
+void Vb_UartInject(uint8_t port, uint64_t t_ns, const uint8_t *data, uint32_t len)
+{
+    UartPort_t *u = &uart[port & 3u];
+
+    for (uint32_t i = 0; i < len && u->n < RX_QUEUE; i++)
+    {
+        /* 시각 순서로 끼워 넣음 (같은 시각이면 넣은 순서) */
+        uint16_t k = u->n++;
+        while (k > u->rd && u->q[k - 1].t > t_ns)
+        {
+            u->q[k] = u->q[k - 1];
+            k--;
+        }
+        u->q[k].t = t_ns;
+        u->q[k].b = data[i];
+    }
+}
+
+/* 글자(UTF-8 포함)면 문자열로, 아니면 (링크 프레임) 16진수로 */
+static void Uart_LogTx(const char *name, const uint8_t *p, uint16_t n)
+{
+    uint8_t text = 1;
+    for (uint16_t i = 0; i < n; i++)
+        if (p[i] < 0x20 && p[i] != '\r' && p[i] != '\n') text = 0;
+
+    fprintf(vb_cfg.log, "[%10.3f] %s TX %3u: ", vb_now / 1e6, name, n);
+    if (text)
+    {
+        fputc('"', vb_cfg.log);
+        for (uint16_t i = 0; i < n; i++)
+        {
+            if (p[i] == '\r')      fputs("\\r", vb_cfg.log);
+            else if (p[i] == '\n') fputs("\\n", vb_cfg.log);
+            else                   fputc(p[i], vb_cfg.log);
+        }
+        fputs("\"\n", vb_cfg.log);
+        return;
+    }
+    for (uint16_t i = 0; i < n && i < 24; i++) fprintf(vb_cfg.log, "%02X ", p[i]);
+    fputs(n > 24 ? "...\n" : "\n", vb_cfg.log);
+}
+
+static uint8_t Crc8(const uint8_t *p, uint16_t n)
+{
+    uint8_t c = 0;
+    for (uint16_t i = 0; i < n; i++)
+    {
+        c ^= p[i];
+        for (uint8_t b = 0; b < 8; b++)
+            c = (c & 0x80) ? (uint8_t)((c << 1) ^ 0x07) : (uint8_t)(c << 1);
+    }
+    return c;
+}
+
+/* 송신 내용 → 터미널(USB, 링크 프레임은 건너뜀, CRLF → LF) / -r 원본 / 로그 */
+static void Uart_Out(UART_HandleTypeDef *huart, const uint8_t *p, uint16_t n)
+{
+    uint8_t usb = (huart->Instance == USART2);
+
+    if (usb && vb_cfg.raw) fwrite(p, 1, n, vb_cfg.raw);
+    if (vb_cfg.log) Uart_LogTx(usb ? "USB" : "BT ", p, n);
+    if (!usb || vb_cfg.quiet) return;
+
+    char out[256];
+    uint16_t k = 0;
+    for (uint16_t i = 0; i < n; i++)
+    {
+        if (p[i] == 0xA5 && i + 1u < n && p[i + 1] <= 24u && i + 4u + p[i + 1] <= n &&
+            Crc8(&p[i + 1], (uint16_t)(p[i + 1] + 2u)) == p[i + 3 + p[i + 1]])
+        {
+            i = (uint16_t)(i + 3u + p[i + 1]);
+            continue;
+        }
+        if (p[i] == '\r') continue;
+        out[k++] = (char)p[i];
+        if (k == sizeof(out)) { (void)!write(STDOUT_FILENO, out, k); k = 0; }
+    }
+    if (k) (void)!write(STDOUT_FILENO, out, k);
+}
+
+__weak void HAL_UART_MspInit(UART_HandleTypeDef *huart) { UNUSED(huart); }
+__weak void HAL_UART_MspDeInit(UART_HandleTypeDef *huart) { UNUSED(huart); }
+__weak void HAL_UART_ErrorCallback(UART_HandleTypeDef *huart) { UNUSED(huart); }
+__weak void HAL_UART_TxCpltCallback(UART_HandleTypeDef *huart) { UNUSED(huart); }
+__weak void HAL_UARTEx_RxEventCallback(UART_HandleTypeDef *huart, uint16_t Size) { UNUSED(huart); UNUSED(Size); }
+
+HAL_StatusTypeDef HAL_UART_Init(UART_HandleTypeDef *huart)
+{
+    UartPort_t *u;
+
+    if (!huart || !(u = Uart_Of(huart))) return HAL_ERROR;
+    if (huart->gState == HAL_UART_STATE_RESET)
+    {
+        huart->Lock = HAL_UNLOCKED;
+        HAL_UART_MspInit(huart);
+    }
+    u->h = huart;
+    huart->Instance->SR = USART_SR_TXE | USART_SR_TC;
+    huart->ErrorCode = 0;
+    huart->gState = HAL_UART_STATE_READY;
+    huart->RxState = HAL_UART_STATE_READY;
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_UART_Transmit(UART_HandleTypeDef *huart, const uint8_t *pData, uint16_t Size, uint32_t Timeout)
+{
+    UartPort_t *u = Uart_Of(huart);
+
+    UNUSED(Timeout);
+    Vb_Poll();
+    if (huart->gState != HAL_UART_STATE_READY) return HAL_BUSY;
+    if (!pData || Size == 0) return HAL_ERROR;
+
+    huart->gState = HAL_UART_STATE_BUSY_TX;
+    u->tx_bytes += Size;
+    Uart_Out(huart, pData, Size);
+
+    Vb_Busy(Size * Uart_CharNs(u));
+    huart->gState = HAL_UART_STATE_READY;
+    return HAL_OK;
+}
+
+/* stm32f1xx_hal_uart.c UART_DMATransmitCplt: DMAT 끄고 TC 인터럽트로 끝을 기다림 */
+static void Uart_DmaTxCplt(DMA_HandleTypeDef *hdma)
+{
+    UART_HandleTypeDef *huart = (UART_HandleTypeDef *)hdma->Parent;
+    huart->TxXferCount = 0;
+    CLEAR_BIT(huart->Instance->CR3, USART_CR3_DMAT);
+    SET_BIT(huart->Instance->CR1, USART_CR1_TCIE);
+}
+
+HAL_StatusTypeDef HAL_UART_Transmit_DMA(UART_HandleTypeDef *huart, const uint8_t *pData, uint16_t Size)
+{
+    UartPort_t *u = Uart_Of(huart);
+
+    Vb_Poll();
+    if (huart->gState != HAL_UART_STATE_READY) return HAL_BUSY;
+    if (!pData || Size == 0 || !huart->hdmatx) return HAL_ERROR;
+
+    huart->gState = HAL_UART_STATE_BUSY_TX;
+    huart->pTxBuffPtr = pData;
+    huart->TxXferSize = Size;
+    huart->TxXferCount = Size;
+    huart->hdmatx->XferCpltCallback = Uart_DmaTxCplt;
+    huart->hdmatx->XferHalfCpltCallback = NULL;
+    huart->hdmatx->XferErrorCallback = NULL;
+    Vb_DmaStart(huart->hdmatx, (void *)pData, Size, 1);
+
+    huart->Instance->SR &= ~USART_SR_TC;
+    SET_BIT(huart->Instance->CR3, USART_CR3_DMAT);
+
+    /* 시작할 때 내보냄 (펌웨어는 TC 전에 버퍼를 안 건드림) */
+    u->tx_bytes += Size;
+    u->tx_dma++;
+    Uart_Out(huart, pData, Size);
+    u->tx_active = 1;
+    u->t_tx_end = vb_now + Size * Uart_CharNs(u);
+    return HAL_OK;
+}
+
+static void Uart_DmaRxHalf(DMA_HandleTypeDef *hdma)
+{
+    UART_HandleTypeDef *huart = (UART_HandleTypeDef *)hdma->Parent;
+    huart->RxEventType = HAL_UART_RXEVENT_HT;
+    HAL_UARTEx_RxEventCallback(huart, huart->RxXferSize / 2u);
+}
+
+static void Uart_DmaRxCplt(DMA_HandleTypeDef *hdma)
+{
+    UART_HandleTypeDef *huart = (UART_HandleTypeDef *)hdma->Parent;
+
+    if (hdma->Init.Mode != DMA_CIRCULAR)
+    {
+        CLEAR_BIT(huart->Instance->CR1, USART_CR1_IDLEIE);
+        CLEAR_BIT(huart->Instance->CR3, USART_CR3_EIE | USART_CR3_DMAR);
+        huart->RxState = HAL_UART_STATE_READY;
+    }
+    huart->RxEventType = HAL_UART_RXEVENT_TC;
+    HAL_UARTEx_RxEventCallback(huart, huart->RxXferSize);
+}
+
+HAL_StatusTypeDef HAL_UARTEx_ReceiveToIdle_DMA(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size)
+{
+    Vb_Poll();
+    if (huart->RxState != HAL_UART_STATE_READY) return HAL_BUSY;
+    if (!pData || Size == 0 || !huart->hdmarx) return HAL_ERROR;
+
+    huart->ReceptionType = HAL_UART_RECEPTION_TOIDLE;
+    huart->pRxBuffPtr = pData;
+    huart->RxXferSize = Size;
+    huart->ErrorCode = 0;
+    huart->RxState = HAL_UART_STATE_BUSY_RX;
+
+    huart->hdmarx->XferCpltCallback = Uart_DmaRxCplt;
+    huart->hdmarx->XferHalfCpltCallback = Uart_DmaRxHalf;
+    huart->hdmarx->XferErrorCallback = NULL;
+    Vb_DmaStart(huart->hdmarx, pData, Size, 1);
+
+    __HAL_UART_CLEAR_OREFLAG(huart);
+    if (huart->Init.Parity != UART_PARITY_NONE) SET_BIT(huart->Instance->CR1, USART_CR1_PEIE);
+    SET_BIT(huart->Instance->CR3, USART_CR3_EIE | USART_CR3_DMAR);
+    SET_BIT(huart->Instance->CR1, USART_CR1_IDLEIE);
+    return HAL_OK;
+}
+
+/* stm32f1xx_hal_uart.c: 에러(EIE일 때) → DMA 수신 중단 후 ErrorCallback, IDLE → RxEvent(받은 만큼) */
+void HAL_UART_IRQHandler(UART_HandleTypeDef *huart)
+{
+    USART_TypeDef *r = huart->Instance;
+    uint32_t err = r->SR & (USART_SR_PE | USART_SR_FE | USART_SR_NE | USART_SR_ORE);
+
+    Vb_Poll();
+    if (err && (r->CR3 & USART_CR3_EIE))
+    {
+        huart->ErrorCode |= err;
+        r->SR &= ~err;
+        if (r->CR3 & USART_CR3_DMAR)
+        {
+            CLEAR_BIT(r->CR3, USART_CR3_DMAR);
+            Vb_DmaStop(huart->hdmarx);
+            CLEAR_BIT(r->CR1, USART_CR1_IDLEIE | USART_CR1_PEIE);
+            CLEAR_BIT(r->CR3, USART_CR3_EIE);
+            huart->RxState = HAL_UART_STATE_READY;
+        }
+        HAL_UART_ErrorCallback(huart);
+        return;
+    }
+
+    if (huart->ReceptionType == HAL_UART_RECEPTION_TOIDLE && (r->SR & USART_SR_IDLE) && (r->CR1 & USART_CR1_IDLEIE))
+    {
+        r->SR &= ~USART_SR_IDLE;
+        if (r->CR3 & USART_CR3_DMAR)
+        {
+            uint16_t left = (uint16_t)__HAL_DMA_GET_COUNTER(huart->hdmarx);
+            if (left > 0 && left < huart->RxXferSize)
+            {
+                huart->RxXferCount = left;
+                huart->RxEventType = HAL_UART_RXEVENT_IDLE;
+                HAL_UARTEx_RxEventCallback(huart, (uint16_t)(huart->RxXferSize - left));
+            }
+        }
+    }
+
+    if ((r->SR & USART_SR_TC) && (r->CR1 & USART_CR1_TCIE))
+    {
+        CLEAR_BIT(r->CR1, USART_CR1_TCIE);
+        huart->gState = HAL_UART_STATE_READY;
+        HAL_UART_TxCpltCallback(huart);
+    }
+}
+
+static int Uart_Level(uint8_t i)
+{
+    USART_TypeDef *r = &vb_usart[i];
+    return ((r->SR & USART_SR_IDLE) && (r->CR1 & USART_CR1_IDLEIE)) ||
+           ((r->SR & USART_SR_TC) && (r->CR1 & USART_CR1_TCIE)) ||
+           ((r->SR & (USART_SR_PE | USART_SR_FE | USART_SR_NE | USART_SR_ORE)) && (r->CR3 & USART_CR3_EIE));
+}
+
+static int Uart_Level2(void) { return Uart_Level(2); }
+static int Uart_Level3(void) { return Uart_Level(3); }
+
+static uint64_t Uart_Next(void)
+{
+    uint64_t best = UINT64_MAX;
+
+    for (uint8_t i = 2; i < 4; i++)
+    {
+        uint64_t t = Uart_NextByte(&uart[i]);
+        if (t < best) best = t;
+        if (uart[i].t_idle && uart[i].t_idle < best) best = uart[i].t_idle;
+        if (uart[i].tx_active && uart[i].t_tx_end < best) best = uart[i].t_tx_end;
+    }
+    return best;
+}
+
+static void Uart_Fire(void)
+{
+    for (uint8_t i = 2; i < 4; i++)
+    {
+        UartPort_t *u = &uart[i];
+
+        if (u->tx_active && u->t_tx_end <= vb_now)
+        {
+            VbDma_t *d = Vb_DmaOf(u->h->hdmatx);
+            u->tx_active = 0;
+            while (d && Vb_DmaNext(d));     // 남은 전송 → TC
+            vb_usart[i].SR |= USART_SR_TC;
+            return;
+        }
+        if (u->t_idle && u->t_idle <= vb_now && u->t_idle <= Uart_NextByte(u))
+        {
+            u->t_idle = 0;
+            vb_usart[i].SR |= USART_SR_IDLE;
+            return;
+        }
+        if (Uart_NextByte(u) <= vb_now)
+        {
+            uint8_t b = u->q[u->rd++].b;
+            VbDma_t *d = u->h ? Vb_DmaOf(u->h->hdmarx) : NULL;
+            uint8_t *p = (u->h && u->h->RxState == HAL_UART_STATE_BUSY_RX && (vb_usart[i].CR3 & USART_CR3_DMAR) && d)
+                         ? Vb_DmaNext(d) : NULL;
+
+            u->last = vb_now;
+            u->t_idle = vb_now + Uart_CharNs(u);
+            if (p)
+            {
+                *p = b;
+                u->rx_bytes++;
+            }
+            else
+            {
+                u->rx_dropped++;
+                vb_usart[i].SR |= USART_SR_ORE;
+            }
+            if (vb_cfg.log)
+                fprintf(vb_cfg.log, "[%10.3f] %s RX %02X%s\n", vb_now / 1e6, i == 2 ? "USB" : "BT ", b, p ? "" : " (버림)");
+            return;
+        }
+    }
+}
+
+static const VbSource_t uart_src = { "USART", Uart_Next, Uart_Fire };
+
+/* ===== 초기화 / 통계 ===== */
+void Vb_BusInit(void)
+{
+    Vb_AddSource(&spi_src);
+    Vb_AddSource(&i2c_src);
+    Vb_AddSource(&uart_src);
+    Vb_IrqLevel(I2C1_EV_IRQn, I2c_EvLevel);
+    Vb_IrqLevel(I2C1_ER_IRQn, I2c_ErLevel);
+    Vb_IrqLevel(USART2_IRQn, Uart_Level2);
+    Vb_IrqLevel(USART3_IRQn, Uart_Level3);
+}
+
+void Vb_BusPrintStats(FILE *f)
+{
+    double v = vb_now ? (double)vb_now : 1.0;
+
+    fprintf(f, "\nSPI2  블로킹 %u번 %llu B, DMA %u번 %llu B, 강제 정지 %u, 버스 사용률 %.1f%%\n",
+            (unsigned)spi.xfers_blk, (unsigned long long)spi.bytes_blk,
+            (unsigned)spi.xfers_dma, (unsigned long long)spi.bytes_dma, (unsigned)spi.stops,
+            100.0 * spi.busy_ns / v);
+    fprintf(f, "I2C1  전송 %u번 %u B, NACK %u, 주소 확인 %u, 버스 사용률 %.1f%%\n",
+            (unsigned)i2c.xfers, (unsigned)i2c.bytes, (unsigned)i2c.nacks, (unsigned)i2c.probes,
+            100.0 * i2c.busy_ns / v);
+    for (uint8_t i = 2; i < 4; i++)
+        fprintf(f, "USART%u 송신 %u B (DMA %u번), 수신 %u B, 버림 %u B\n", i,
+                (unsigned)uart[i].tx_bytes, (unsigned)uart[i].tx_dma,
+                (unsigned)uart[i].rx_bytes, (unsigned)uart[i].rx_dropped);
+}
@@ -0,0 +1,1224 @@
+/**
+ * @file vboard_core.c
+ * @brief 가상 보드 코어 - 가상 시계, 사건 처리, NVIC, SysTick, GPIO, DMA, TIM1~4
+ *
+ * 레지스터 쓰기 반영 (Vb_SyncRegs):
+ * - GPIO: BSRR/BRR → ODR 후 0으로 (같은 레지스터를 동기화 사이에 2번 쓰면 앞 값은 잃음)
+ * - TIM: 지난 동기화 때 값(s)과 비교해서 펌웨어가 쓴 것을 찾음
+ *   SR = rc_w0 (0 쓴 비트만 지움), CNT 쓰기 = 기준 시각 재설정, CEN, EGR(UG/CCxG)
+ * - TIMx/DWT 접근, HAL 호출마다 Vb_Poll() → 동기화 + poll_ns 진행
+ *
+ * 타이머: 카운터는 저장하지 않고 (지금 - 마지막 갱신 시각)으로 계산
+ * - 갱신 사건: upd_t + (ARR+1)틱, 비교 사건: upd_t + CCRx틱 (출력 비교 채널, CCxIE 또는 CCxDE)
+ * - 같은 시각이면 갱신 먼저 (CCR=0 비교가 새 주기 시작에 맞음)
+ * - CCxDE → DMA 버스트 (DCR의 DBA부터 DBL+1개 레지스터에 DMA 버퍼 값)
+ */
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "vboard.h"
+
+/* ===== 레지스터 블록 ===== */
+GPIO_TypeDef vb_gpio[5];
+USART_TypeDef vb_usart[4];
+SPI_TypeDef vb_spi[3];
+I2C_TypeDef vb_i2c[3];
+DMA_Channel_TypeDef vb_dma_ch[8];
+RCC_TypeDef vb_rcc;
+CoreDebug_Type vb_coredebug;
+static DWT_Type dwt;
+
+uint32_t SystemCoreClock = 8000000u;            // 리셋 직후 HSI, SystemClock_Config에서 64MHz
+uint64_t vb_now;
+uint8_t vb_stop;
+VbConfig_t vb_cfg = { .poll_ns = 100, .png_zoom = 3 };
+
+static __IO uint32_t uwTick;
+static uint8_t primask;
+
+#define VB_TICK_PRIORITY    0u      // stm32f1xx_hal_conf.h TICK_INT_PRIORITY
+
+/* ===== 호스트 시각 ===== */
+static uint64_t Host_Ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+/* ===== 사건 원천 ===== */
+#define MAX_SOURCES     16
+
+static const VbSource_t *sources[MAX_SOURCES];
+static uint8_t n_sources;
+
+void Vb_AddSource(const VbSource_t *s)
+{
+    if (n_sources < MAX_SOURCES) sources[n_sources++] = s;
+}
+
+static uint64_t Next_Event(int *which)
+{
+    uint64_t best = UINT64_MAX;
+    *which = -1;
+
+    for (uint8_t i = 0; i < n_sources; i++)
+    {
+        uint64_t t = sources[i]->next();
+        if (t < best)
+        {
+            best = t;
+            *which = i;
+        }
+    }
+    return best;
+}
+
+/* ===== NVIC ===== */
+
+/* stm32f1xx_it.c 핸들러 (없는 것은 NULL) */
+extern void SysTick_Handler(void) __attribute__((weak));
+extern void DMA1_Channel1_IRQHandler(void) __attribute__((weak));
+extern void DMA1_Channel2_IRQHandler(void) __attribute__((weak));
+extern void DMA1_Channel3_IRQHandler(void) __attribute__((weak));
+extern void DMA1_Channel4_IRQHandler(void) __attribute__((weak));
+extern void DMA1_Channel5_IRQHandler(void) __attribute__((weak));
+extern void DMA1_Channel6_IRQHandler(void) __attribute__((weak));
+extern void DMA1_Channel7_IRQHandler(void) __attribute__((weak));
+extern void TIM2_IRQHandler(void) __attribute__((weak));
+extern void TIM3_IRQHandler(void) __attribute__((weak));
+extern void TIM4_IRQHandler(void) __attribute__((weak));
+extern void I2C1_EV_IRQHandler(void) __attribute__((weak));
+extern void I2C1_ER_IRQHandler(void) __attribute__((weak));
+extern void SPI2_IRQHandler(void) __attribute__((weak));
+extern void USART2_IRQHandler(void) __attribute__((weak));
+extern void USART3_IRQHandler(void) __attribute__((weak));
+
+typedef struct {
+    IRQn_Type irq;
+    const char *name;
+    void (*handler)(void);
+    int (*level)(void);
+    uint8_t en;
+    uint8_t prio;
+    uint32_t count;
+    uint64_t virt_ns;           // 핸들러 안에서 지난 가상 시간 (중첩 포함)
+    uint64_t host_ns;
+} VbIrq_t;
+
+static int Systick_Level(void);
+static int Dma_Level1(void), Dma_Level2(void), Dma_Level3(void), Dma_Level4(void);
+static int Dma_Level5(void), Dma_Level6(void), Dma_Level7(void);
+static int Tim_Level2(void), Tim_Level3(void), Tim_Level4(void);
+
+/* 표 순서 = 같은 우선순위일 때 먼저 (예외 번호 순) */
+static VbIrq_t irqs[] = {
+    { .irq = SysTick_IRQn,        .name = "SysTick",   .level = Systick_Level },
+    { .irq = DMA1_Channel1_IRQn,  .name = "DMA1_CH1",  .level = Dma_Level1 },
+    { .irq = DMA1_Channel2_IRQn,  .name = "DMA1_CH2",  .level = Dma_Level2 },
+    { .irq = DMA1_Channel3_IRQn,  .name = "DMA1_CH3",  .level = Dma_Level3 },
+    { .irq = DMA1_Channel4_IRQn,  .name = "DMA1_CH4",  .level = Dma_Level4 },
+    { .irq = DMA1_Channel5_IRQn,  .name = "DMA1_CH5",  .level = Dma_Level5 },
+    { .irq = DMA1_Channel6_IRQn,  .name = "DMA1_CH6",  .level = Dma_Level6 },
+    { .irq = DMA1_Channel7_IRQn,  .name = "DMA1_CH7",  .level = Dma_Level7 },
+    { .irq = TIM2_IRQn,           .name = "TIM2",      .level = Tim_Level2 },
+    { .irq = TIM3_IRQn,           .name = "TIM3",      .level = Tim_Level3 },
+    { .irq = TIM4_IRQn,           .name = "TIM4",      .level = Tim_Level4 },
+    { .irq = I2C1_EV_IRQn,        .name = "I2C1_EV" },
+    { .irq = I2C1_ER_IRQn,        .name = "I2C1_ER" },
+    { .irq = SPI2_IRQn,           .name = "SPI2" },
+    { .irq = USART2_IRQn,         .name = "USART2" },
+    { .irq = USART3_IRQn,         .name = "USART3" },
+};
+#define N_IRQS  (sizeof(irqs) / sizeof(irqs[0]))
+
+static uint8_t cur_prio = 0xFF;         // 실행 중인 핸들러 우선순위 (0xFF = 스레드)
+static uint8_t cur_exc;                 // IPSR (실행 중인 예외 번호, 0 = 스레드)
+static uint8_t excl;                    // LDREX 배타 모니터 (예외 진입/복귀 때 지움)
+static uint64_t irq_total;
+static uint8_t systick_pend;
+
+static VbIrq_t *Irq_Of(IRQn_Type irq)
+{
+    for (uint8_t i = 0; i < N_IRQS; i++)
+        if (irqs[i].irq == irq) return &irqs[i];
+    return NULL;
+}
+
+static void Irq_Bind(void)
+{
+    static uint8_t done;
+    if (done) return;
+    done = 1;
+
+    void (*h[])(void) = {
+        SysTick_Handler,
+        DMA1_Channel1_IRQHandler, DMA1_Channel2_IRQHandler, DMA1_Channel3_IRQHandler,
+        DMA1_Channel4_IRQHandler, DMA1_Channel5_IRQHandler, DMA1_Channel6_IRQHandler,
+        DMA1_Channel7_IRQHandler,
+        TIM2_IRQHandler, TIM3_IRQHandler, TIM4_IRQHandler,
+        I2C1_EV_IRQHandler, I2C1_ER_IRQHandler, SPI2_IRQHandler,
+        USART2_IRQHandler, USART3_IRQHandler,
+    };
+    for (uint8_t i = 0; i < N_IRQS; i++)
+        irqs[i].handler = h[i];
+}
+
+void Vb_IrqLevel(IRQn_Type irq, int (*level)(void))
+{
+    VbIrq_t *q = Irq_Of(irq);
+    if (q) q->level = level;
+}
+
+static int Irq_Pending(const VbIrq_t *q)
+{
+    return q->en && q->handler && q->level && q->level();
+}
+
+/**
+ * @brief 요청 중이고 지금 우선순위보다 높은 인터럽트를 모두 실행 (핸들러 안에서 다시 불리면 중첩)
+ */
+void Vb_Dispatch(void)
+{
+    static uint64_t storm_t, storm_n;
+
+    Irq_Bind();
+    while (!vb_stop)
+    {
+        Vb_SyncRegs();
+        if (primask) return;
+
+        VbIrq_t *best = NULL;
+        uint8_t bp = cur_prio;
+        for (uint8_t i = 0; i < N_IRQS; i++)
+        {
+            if (irqs[i].prio < bp && Irq_Pending(&irqs[i]))
+            {
+                best = &irqs[i];
+                bp = irqs[i].prio;
+            }
+        }
+        if (!best) return;
+
+        /* 플래그를 안 지우는 핸들러 → 같은 시각에 끝없이 재진입 */
+        if (vb_now != storm_t) { storm_t = vb_now; storm_n = 0; }
+        if (++storm_n > 1000000u)
+        {
+            fprintf(stderr, "[vboard] %s 인터럽트가 %.3fms에서 멈추지 않음 (플래그 안 지움?)\n",
+                    best->name, vb_now / 1e6);
+            exit(2);
+        }
+
+        if (best->irq == SysTick_IRQn) systick_pend = 0;    // 예외 진입 때 보류 해제
+
+        uint8_t saved = cur_prio, saved_exc = cur_exc;
+        uint64_t v0 = vb_now, h0 = Host_Ns();
+        cur_prio = bp;
+        cur_exc = (uint8_t)(best->irq + 16);
+        excl = 0;
+        best->handler();
+        excl = 0;
+        cur_exc = saved_exc;
+        cur_prio = saved;
+        best->count++;
+        best->virt_ns += vb_now - v0;
+        best->host_ns += Host_Ns() - h0;
+        irq_total++;
+    }
+}
+
+/* ===== 시계 ===== */
+static uint64_t host_last;
+
+/**
+ * @brief target까지 사건을 시각 순서로 처리 - 같은 시각 사건을 다 처리한 뒤 인터럽트
+ */
+void Vb_Advance(uint64_t target)
+{
+    while (!vb_stop)
+    {
+        int w;
+        Vb_SyncRegs();
+        uint64_t t = Next_Event(&w);
+        if (w < 0 || t > target) break;
+        if (t > vb_now) vb_now = t;
+
+        do {
+            sources[w]->fire();
+            t = Next_Event(&w);
+        } while (w >= 0 && t <= vb_now && !vb_stop);
+
+        Vb_Dispatch();
+    }
+    if (target > vb_now) vb_now = target;
+    Vb_Dispatch();
+}
+
+void Vb_Poll(void)
+{
+    uint64_t cost = vb_cfg.poll_ns;
+
+    if (vb_cfg.host_scale > 0)
+    {
+        uint64_t h = Host_Ns();
+        if (host_last) cost += (uint64_t)((double)(h - host_last) * vb_cfg.host_scale);
+    }
+    Vb_Advance(vb_now + cost);
+    if (vb_cfg.host_scale > 0) host_last = Host_Ns();
+}
+
+void Vb_Busy(uint64_t ns)
+{
+    Vb_Advance(vb_now + ns);
+}
+
+void Vb_Sleep(void)
+{
+    int w;
+    Vb_SyncRegs();
+    uint64_t t = Next_Event(&w);
+    if (w < 0)
+    {
+        fprintf(stderr, "[vboard] 기다릴 사건이 없음 (%.3fms)\n", vb_now / 1e6);
+        exit(2);
+    }
+    Vb_Advance(t > vb_now ? t : vb_now);
+}
+
+/* ===== 코어 (PRIMASK, WFI) ===== */
+void Vb_DisableIrq(void)
+{
+    primask = 1;
+}
+
+void Vb_EnableIrq(void)
+{
+    primask = 0;
+    Vb_Dispatch();
+}
+
+uint32_t Vb_GetPrimask(void)
+{
+    return primask;
+}
+
+void Vb_SetPrimask(uint32_t m)
+{
+    primask = (uint8_t)(m & 1u);
+    if (!primask) Vb_Dispatch();
+}
+
+uint32_t Vb_GetIpsr(void)
+{
+    return cur_exc;
+}
+
+/* LDREX/STREX: 사이에 인터럽트가 실행됐으면 STREX 실패 (Cortex-M3 예외 복귀 = CLREX) */
+uint32_t Vb_Ldrex(volatile uint32_t *addr)
+{
+    excl = 1;
+    return *addr;
+}
+
+uint32_t Vb_Strex(uint32_t value, volatile uint32_t *addr)
+{
+    if (!excl) return 1;
+    excl = 0;
+    *addr = value;
+    return 0;
+}
+
+void Vb_Clrex(void)
+{
+    excl = 0;
+}
+
+/**
+ * @brief 인터럽트가 하나라도 실행될 때까지 잠 (PRIMASK=1이면 요청만 생겨도 깸)
+ */
+void Vb_Wfi(void)
+{
+    uint64_t n = irq_total;
+
+    for (;;)
+    {
+        Vb_Sleep();
+        if (irq_total != n || vb_stop) return;
+        if (primask)
+        {
+            for (uint8_t i = 0; i < N_IRQS; i++)
+                if (irqs[i].prio < cur_prio && Irq_Pending(&irqs[i])) return;
+        }
+    }
+}
+
+/* ===== SysTick (1ms) ===== */
+static uint8_t systick_on;
+static uint64_t systick_next;
+
+static uint64_t Systick_Next(void)
+{
+    return systick_on ? systick_next : UINT64_MAX;
+}
+
+static void Systick_Fire(void)
+{
+    systick_pend = 1;
+    systick_next += VB_MS;
+}
+
+static int Systick_Level(void)
+{
+    return systick_pend;
+}
+
+static const VbSource_t systick_src = { "SysTick", Systick_Next, Systick_Fire };
+
+/* ===== GPIO ===== */
+static void Gpio_Sync(void)
+{
+    for (uint8_t i = 0; i < 5; i++)
+    {
+        GPIO_TypeDef *g = &vb_gpio[i];
+        if (g->BSRR)
+        {
+            uint32_t v = g->BSRR;
+            g->ODR = (g->ODR & ~(v >> 16)) | (v & 0xFFFFu);
+            g->BSRR = 0;
+        }
+        if (g->BRR)
+        {
+            g->ODR &= ~(g->BRR & 0xFFFFu);
+            g->BRR = 0;
+        }
+        g->IDR = g->ODR;
+    }
+    Rgb_Gpio((uint16_t)GPIOC->ODR);
+}
+
+void HAL_GPIO_Init(GPIO_TypeDef *GPIOx, GPIO_InitTypeDef *GPIO_Init)
+{
+    UNUSED(GPIOx);
+    UNUSED(GPIO_Init);
+}
+
+void HAL_GPIO_DeInit(GPIO_TypeDef *GPIOx, uint32_t GPIO_Pin)
+{
+    UNUSED(GPIOx);
+    UNUSED(GPIO_Pin);
+}
+
+void HAL_GPIO_WritePin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin, GPIO_PinState PinState)
+{
+    Vb_Poll();
+    GPIOx->BSRR = PinState ? GPIO_Pin : ((uint32_t)GPIO_Pin << 16);
+    Gpio_Sync();
+}
+
+void HAL_GPIO_TogglePin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin)
+{
+    Vb_Poll();
+    GPIOx->ODR ^= GPIO_Pin;
+    Gpio_Sync();
+}
+
+GPIO_PinState HAL_GPIO_ReadPin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin)
+{
+    Vb_Poll();
+    return (GPIOx->IDR & GPIO_Pin) ? GPIO_PIN_SET : GPIO_PIN_RESET;
+}
+
+/* ===== DMA ===== */
+static VbDma_t dma[8];
+
+VbDma_t *Vb_DmaOf(DMA_HandleTypeDef *h)
+{
+    for (uint8_t i = 1; i < 8; i++)
+        if (h && h->Instance == &vb_dma_ch[i]) return &dma[i];
+    return NULL;
+}
+
+static int Dma_Level(uint8_t i)
+{
+    const VbDma_t *d = &dma[i];
+    return ((d->flags & VB_DMA_HT) && d->ie_ht) || ((d->flags & VB_DMA_TC) && d->ie_tc);
+}
+
+static int Dma_Level1(void) { return Dma_Level(1); }
+static int Dma_Level2(void) { return Dma_Level(2); }
+static int Dma_Level3(void) { return Dma_Level(3); }
+static int Dma_Level4(void) { return Dma_Level(4); }
+static int Dma_Level5(void) { return Dma_Level(5); }
+static int Dma_Level6(void) { return Dma_Level(6); }
+static int Dma_Level7(void) { return Dma_Level(7); }
+
+/**
+ * @brief 채널 시작 (HAL_DMA_Start_IT와 같음: TC 인터럽트, 반쪽 콜백이 있으면 HT도)
+ */
+void Vb_DmaStart(DMA_HandleTypeDef *h, void *mem, uint16_t n, uint8_t ie)
+{
+    VbDma_t *d = Vb_DmaOf(h);
+    if (!d) return;
+
+    d->h = h;
+    d->mem = (uint8_t *)mem;
+    d->total = n;
+    d->circ = (h->Init.Mode == DMA_CIRCULAR);
+    d->width = (h->Init.MemDataAlignment == DMA_MDATAALIGN_WORD) ? 4 :
+               (h->Init.MemDataAlignment == DMA_MDATAALIGN_HALFWORD) ? 2 : 1;
+    d->flags = 0;
+    d->ht_done = 0;
+    d->ie_tc = ie;
+    d->ie_ht = ie && (h->XferHalfCpltCallback != NULL);
+    d->on = 1;
+
+    h->Instance->CNDTR = n;
+    h->Instance->CMAR = (uint32_t)(uintptr_t)mem;
+    h->Instance->CCR |= 1u;
+    h->State = HAL_DMA_STATE_BUSY;
+}
+
+void Vb_DmaStop(DMA_HandleTypeDef *h)
+{
+    VbDma_t *d = Vb_DmaOf(h);
+    if (!d) return;
+
+    d->on = 0;
+    d->flags = 0;
+    h->Instance->CCR &= ~1u;
+    h->State = HAL_DMA_STATE_READY;
+}
+
+/**
+ * @brief 전송 1번 - 메모리 위치를 돌려주고 CNDTR 감소, 반/끝 플래그, 원형이면 다시 채움
+ */
+uint8_t *Vb_DmaNext(VbDma_t *d)
+{
+    DMA_Channel_TypeDef *c;
+
+    if (!d->on || !d->h) return NULL;
+    c = d->h->Instance;
+    if (c->CNDTR == 0) return NULL;
+
+    uint8_t *p = d->mem + (uint32_t)(d->total - c->CNDTR) * d->width;
+    c->CNDTR--;
+    d->transfers++;
+
+    if (!d->ht_done && c->CNDTR <= d->total / 2u)
+    {
+        d->ht_done = 1;
+        d->flags |= VB_DMA_HT;
+    }
+    if (c->CNDTR == 0)
+    {
+        d->flags |= VB_DMA_TC;
+        if (d->circ)
+        {
+            c->CNDTR = d->total;
+            d->ht_done = 0;
+        }
+    }
+    return p;
+}
+
+HAL_StatusTypeDef HAL_DMA_Init(DMA_HandleTypeDef *hdma)
+{
+    VbDma_t *d = Vb_DmaOf(hdma);
+    if (!d) return HAL_ERROR;
+
+    d->h = hdma;
+    d->on = 0;
+    hdma->ErrorCode = 0;
+    hdma->State = HAL_DMA_STATE_READY;
+    hdma->Lock = HAL_UNLOCKED;
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_DMA_DeInit(DMA_HandleTypeDef *hdma)
+{
+    VbDma_t *d = Vb_DmaOf(hdma);
+    if (!d) return HAL_ERROR;
+
+    d->on = 0;
+    d->flags = 0;
+    hdma->State = HAL_DMA_STATE_RESET;
+    return HAL_OK;
+}
+
+/* stm32f1xx_hal_dma.c 와 같은 순서: HT 먼저, 다음 진입에서 TC */
+void HAL_DMA_IRQHandler(DMA_HandleTypeDef *hdma)
+{
+    VbDma_t *d = Vb_DmaOf(hdma);
+    if (!d) return;
+
+    Vb_Poll();
+    if ((d->flags & VB_DMA_HT) && d->ie_ht)
+    {
+        if (!d->circ) d->ie_ht = 0;
+        d->flags &= ~VB_DMA_HT;
+        if (hdma->XferHalfCpltCallback) hdma->XferHalfCpltCallback(hdma);
+    }
+    else if ((d->flags & VB_DMA_TC) && d->ie_tc)
+    {
+        if (!d->circ)
+        {
+            d->ie_ht = d->ie_tc = 0;
+            d->on = 0;
+            hdma->Instance->CCR &= ~1u;
+            hdma->State = HAL_DMA_STATE_READY;
+        }
+        d->flags &= ~VB_DMA_TC;
+        if (hdma->XferCpltCallback) hdma->XferCpltCallback(hdma);
+    }
+}
+
+/* ===== TIM ===== */
+typedef struct {
+    TIM_TypeDef r;              // 펌웨어가 보는 레지스터
+    TIM_TypeDef s;              // 지난 동기화 때 값
+    uint8_t  run;
+    uint64_t upd_t;             // 마지막 갱신 사건 (CNT = 0) 시각
+    uint32_t arr, psc;          // 적용 중인 값 (프리로드)
+    uint64_t cc_next[4];        // 이 시각 전 비교 일치는 이미 처리함
+    uint32_t updates, compares, captures, bursts;
+    void (*on_update)(uint64_t t);
+} VbTim_t;
+
+static VbTim_t tim[5];
+
+/* TIMx_CHy DMA 요청 → DMA1 채널 (RM0008 표 78) */
+static const uint8_t tim_dma_ch[5][4] = {
+    [1] = { 2, 0, 6, 4 },
+    [2] = { 5, 7, 1, 7 },
+    [3] = { 6, 0, 2, 3 },
+    [4] = { 1, 4, 5, 0 },
+};
+
+static uint64_t Tim_Ns(const VbTim_t *t, uint64_t ticks)
+{
+    return ticks * (t->psc + 1u) * 1000000000ull / VB_TIMCLK_HZ;
+}
+
+static uint32_t Tim_Count(const VbTim_t *t)
+{
+    if (!t->run) return t->r.CNT & 0xFFFFu;
+
+    uint64_t ticks = (vb_now - t->upd_t) * VB_TIMCLK_HZ / ((t->psc + 1u) * 1000000000ull);
+    return (ticks > t->arr) ? t->arr : (uint32_t)ticks;     // 같은 시각 갱신 사건 처리 전
+}
+
+static uint8_t Tim_IsInput(const VbTim_t *t, uint8_t ch)
+{
+    uint32_t ccmr = (ch < 2) ? t->r.CCMR1 : t->r.CCMR2;
+    return ((ccmr >> ((ch & 1u) * 8u)) & TIM_CCMR1_CC1S) != 0;
+}
+
+static void Tim_Flag(VbTim_t *t, uint32_t f)
+{
+    t->r.SR |= f;
+    t->s.SR |= f;
+}
+
+static void Tim_Burst(VbTim_t *t, uint8_t n, uint8_t ch)
+{
+    uint8_t c = tim_dma_ch[n][ch];
+    if (!c) return;
+
+    VbDma_t *d = &dma[c];
+    uint32_t dba = t->r.DCR & 0x1Fu, dbl = ((t->r.DCR >> 8) & 0x1Fu) + 1u;
+    volatile uint32_t *rr = &t->r.CR1, *ss = &t->s.CR1;
+
+    for (uint32_t i = 0; i < dbl && dba + i < 20u; i++)
+    {
+        uint8_t *p = Vb_DmaNext(d);
+        if (!p) break;
+        uint32_t v = (d->width == 2) ? *(uint16_t *)p : (d->width == 4) ? *(uint32_t *)p : *p;
+        rr[dba + i] = v;
+        ss[dba + i] = v;
+    }
+    t->bursts++;
+}
+
+/* 비교 일치 / 캡처 / CCxG: 플래그 + DMA 요청 */
+static void Tim_CcEvent(VbTim_t *t, uint8_t n, uint8_t ch)
+{
+    if (Tim_IsInput(t, ch))
+    {
+        (&t->r.CCR1)[ch] = Tim_Count(t);
+        (&t->s.CCR1)[ch] = (&t->r.CCR1)[ch];
+    }
+    Tim_Flag(t, TIM_SR_CC1IF << ch);
+    if (t->r.DIER & (TIM_DIER_CC1DE << ch)) Tim_Burst(t, n, ch);
+}
+
+static void Tim_Sync(uint8_t n)
+{
+    VbTim_t *t = &tim[n];
+    TIM_TypeDef *r = &t->r, *s = &t->s;
+
+    if (r->SR != s->SR) r->SR = s->SR & r->SR;      // rc_w0
+
+    if (r->CNT != s->CNT && t->run)
+        t->upd_t = vb_now - Tim_Ns(t, r->CNT & 0xFFFFu);
+
+    if ((r->CR1 ^ s->CR1) & TIM_CR1_CEN)
+    {
+        if (r->CR1 & TIM_CR1_CEN)
+        {
+            t->run = 1;
+            t->upd_t = vb_now - Tim_Ns(t, r->CNT & 0xFFFFu);
+            for (uint8_t ch = 0; ch < 4; ch++) t->cc_next[ch] = 0;
+        }
+        else
+        {
+            r->CNT = Tim_Count(t);
+            t->run = 0;
+        }
+    }
+
+    if (r->EGR)
+    {
+        uint32_t e = r->EGR;
+        r->EGR = 0;
+        if (e & TIM_EGR_UG)
+        {
+            t->psc = r->PSC & 0xFFFFu;
+            t->arr = r->ARR & 0xFFFFu;
+            t->upd_t = vb_now;
+            r->CNT = 0;
+            r->SR |= TIM_SR_UIF;
+        }
+        for (uint8_t ch = 0; ch < 4; ch++)
+            if (e & (TIM_EGR_CC1G << ch)) Tim_CcEvent(t, n, ch);
+    }
+
+    if (!(r->CR1 & TIM_CR1_ARPE)) t->arr = r->ARR & 0xFFFFu;
+    if (t->run) r->CNT = Tim_Count(t);
+    *s = *r;
+}
+
+/* 다음 사건: kind -1 = 갱신, 0..3 = 비교 */
+static uint64_t Tim_NextEvent(VbTim_t *t, int *kind)
+{
+    uint64_t best;
+
+    *kind = -1;
+    if (!t->run) return UINT64_MAX;
+
+    best = t->upd_t + Tim_Ns(t, t->arr + 1u);
+    for (uint8_t ch = 0; ch < 4; ch++)
+    {
+        if (!(t->r.DIER & ((TIM_DIER_CC1IE | TIM_DIER_CC1DE) << ch)) || Tim_IsInput(t, ch)) continue;
+
+        uint32_t ccr = (&t->r.CCR1)[ch] & 0xFFFFu;
+        if (ccr > t->arr) continue;
+
+        uint64_t tc = t->upd_t + Tim_Ns(t, ccr);
+        if (tc < vb_now || tc < t->cc_next[ch]) continue;
+        if (tc < best)
+        {
+            best = tc;
+            *kind = ch;
+        }
+    }
+    return best;
+}
+
+static uint64_t Timers_Next(void)
+{
+    uint64_t best = UINT64_MAX;
+    int k;
+
+    for (uint8_t n = 1; n <= 4; n++)
+    {
+        uint64_t t = Tim_NextEvent(&tim[n], &k);
+        if (t < best) best = t;
+    }
+    return best;
+}
+
+static void Timers_Fire(void)
+{
+    uint64_t best = UINT64_MAX;
+    uint8_t bn = 0;
+    int bk = -1;
+
+    for (uint8_t n = 1; n <= 4; n++)
+    {
+        int k;
+        uint64_t t = Tim_NextEvent(&tim[n], &k);
+        if (t < best)
+        {
+            best = t;
+            bn = n;
+            bk = k;
+        }
+    }
+    if (!bn) return;
+
+    VbTim_t *t = &tim[bn];
+    if (bk < 0)
+    {
+        t->upd_t = best;
+        t->arr = t->r.ARR & 0xFFFFu;
+        t->psc = t->r.PSC & 0xFFFFu;
+        t->r.CNT = t->s.CNT = 0;
+        for (uint8_t ch = 0; ch < 4; ch++) t->cc_next[ch] = 0;
+        Tim_Flag(t, TIM_SR_UIF);
+        t->updates++;
+        if (t->on_update) t->on_update(best);
+    }
+    else
+    {
+        t->cc_next[bk] = best + 1u;
+        t->compares++;
+        Tim_CcEvent(t, bn, (uint8_t)bk);
+    }
+}
+
+static const VbSource_t tim_src = { "TIM", Timers_Next, Timers_Fire };
+
+static int Tim_Level(uint8_t n)
+{
+    return (tim[n].r.SR & tim[n].r.DIER & 0x1Fu) != 0;
+}
+
+static int Tim_Level2(void) { return Tim_Level(2); }
+static int Tim_Level3(void) { return Tim_Level(3); }
+static int Tim_Level4(void) { return Tim_Level(4); }
+
+TIM_TypeDef *Vb_Tim(uint8_t n)
+{
+    Vb_Poll();
+    Tim_Sync(n);
+    return &tim[n].r;
+}
+
+TIM_TypeDef *Vb_TimPeek(uint8_t n)
+{
+    return &tim[n].r;
+}
+
+DWT_Type *Vb_Dwt(void)
+{
+    Vb_Poll();
+    dwt.CYCCNT = (uint32_t)(vb_now * VB_CORE_HZ / 1000000000ull);
+    return &dwt;
+}
+
+void Vb_SyncRegs(void)
+{
+    Gpio_Sync();
+    for (uint8_t n = 1; n <= 4; n++) Tim_Sync(n);
+}
+
+uint16_t Vb_TimCapture(uint8_t n, uint8_t ch, uint8_t rising)
+{
+    VbTim_t *t = &tim[n];
+    uint8_t falling = (t->r.CCER >> (ch * 4u + 1u)) & 1u;
+
+    Tim_Sync(n);
+    if (!t->run || !(t->r.CCER & (TIM_CCER_CC1E << (ch * 4u))) || !Tim_IsInput(t, ch)) return 0;
+    if (falling == rising) return 0;
+
+    t->captures++;
+    Tim_CcEvent(t, n, ch);
+    return 1;
+}
+
+uint32_t Vb_TimCompare(uint8_t n, uint8_t ch)
+{
+    return (&tim[n].r.CCR1)[ch];
+}
+
+uint64_t Vb_TimNextUpdate(uint8_t n)
+{
+    return tim[n].run ? tim[n].upd_t + Tim_Ns(&tim[n], tim[n].arr + 1u) : UINT64_MAX;
+}
+
+void Vb_OnTimUpdate(uint8_t n, void (*fn)(uint64_t t))
+{
+    tim[n].on_update = fn;
+}
+
+/* ===== HAL TIM ===== */
+static uint8_t Tim_No(TIM_TypeDef *inst)
+{
+    for (uint8_t n = 1; n <= 4; n++)
+        if (inst == &tim[n].r) return n;
+    return 0;
+}
+
+static void Tim_BaseConfig(TIM_HandleTypeDef *htim)
+{
+    uint8_t n = Tim_No(htim->Instance);
+    TIM_TypeDef *r = &tim[n].r;
+
+    Vb_Poll();
+    r->CR1 = (r->CR1 & ~TIM_CR1_ARPE) | htim->Init.AutoReloadPreload;
+    r->ARR = htim->Init.Period;
+    r->PSC = htim->Init.Prescaler;
+    r->RCR = htim->Init.RepetitionCounter;
+    r->EGR = TIM_EGR_UG;
+    Tim_Sync(n);
+    r->SR = ~TIM_SR_UIF;        // HAL: UG로 생긴 갱신 플래그 지움
+    Tim_Sync(n);
+}
+
+__weak void HAL_TIM_Base_MspInit(TIM_HandleTypeDef *htim) { UNUSED(htim); }
+__weak void HAL_TIM_Base_MspDeInit(TIM_HandleTypeDef *htim) { UNUSED(htim); }
+__weak void HAL_TIM_PWM_MspInit(TIM_HandleTypeDef *htim) { UNUSED(htim); }
+__weak void HAL_TIM_IC_MspInit(TIM_HandleTypeDef *htim) { UNUSED(htim); }
+__weak void HAL_TIM_PeriodElapsedCallback(TIM_HandleTypeDef *htim) { UNUSED(htim); }
+__weak void HAL_TIM_OC_DelayElapsedCallback(TIM_HandleTypeDef *htim) { UNUSED(htim); }
+__weak void HAL_TIM_IC_CaptureCallback(TIM_HandleTypeDef *htim) { UNUSED(htim); }
+__weak void HAL_TIM_PWM_PulseFinishedCallback(TIM_HandleTypeDef *htim) { UNUSED(htim); }
+__weak void HAL_TIM_PWM_PulseFinishedHalfCpltCallback(TIM_HandleTypeDef *htim) { UNUSED(htim); }
+
+static HAL_StatusTypeDef Tim_Init(TIM_HandleTypeDef *htim, void (*msp)(TIM_HandleTypeDef *))
+{
+    if (!htim || !Tim_No(htim->Instance)) return HAL_ERROR;
+
+    if (htim->State == HAL_TIM_STATE_RESET)
+    {
+        htim->Lock = HAL_UNLOCKED;
+        msp(htim);
+    }
+    Tim_BaseConfig(htim);
+    htim->State = HAL_TIM_STATE_READY;
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_TIM_Base_Init(TIM_HandleTypeDef *htim) { return Tim_Init(htim, HAL_TIM_Base_MspInit); }
+HAL_StatusTypeDef HAL_TIM_PWM_Init(TIM_HandleTypeDef *htim) { return Tim_Init(htim, HAL_TIM_PWM_MspInit); }
+HAL_StatusTypeDef HAL_TIM_IC_Init(TIM_HandleTypeDef *htim) { return Tim_Init(htim, HAL_TIM_IC_MspInit); }
+
+HAL_StatusTypeDef HAL_TIM_ConfigClockSource(TIM_HandleTypeDef *htim, TIM_ClockConfigTypeDef *sClockSourceConfig)
+{
+    UNUSED(htim);
+    UNUSED(sClockSourceConfig);
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_TIMEx_MasterConfigSynchronization(TIM_HandleTypeDef *htim, TIM_MasterConfigTypeDef *sMasterConfig)
+{
+    UNUSED(htim);
+    UNUSED(sMasterConfig);
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_TIMEx_ConfigBreakDeadTime(TIM_HandleTypeDef *htim, TIM_BreakDeadTimeConfigTypeDef *sBreakDeadTimeConfig)
+{
+    UNUSED(htim);
+    UNUSED(sBreakDeadTimeConfig);
+    return HAL_OK;
+}
+
+/* 채널 설정: CCMRx 바이트 (모드/선택), CCRx, CCER 극성 */
+static void Tim_ChConfig(TIM_HandleTypeDef *htim, uint32_t Channel, uint32_t ccmr, uint32_t ccr, uint32_t pol)
+{
+    uint8_t n = Tim_No(htim->Instance), k = (uint8_t)(Channel >> 2);
+    TIM_TypeDef *r = &tim[n].r;
+    volatile uint32_t *m = (k < 2) ? &r->CCMR1 : &r->CCMR2;
+    uint32_t sh = (k & 1u) * 8u;
+
+    Vb_Poll();
+    *m = (*m & ~(0xFFu << sh)) | ((ccmr & 0xFFu) << sh);
+    (&r->CCR1)[k] = ccr;
+    r->CCER = (r->CCER & ~(TIM_CCER_CC1P << Channel)) | (pol << Channel);
+    Tim_Sync(n);
+}
+
+HAL_StatusTypeDef HAL_TIM_PWM_ConfigChannel(TIM_HandleTypeDef *htim, TIM_OC_InitTypeDef *sConfig, uint32_t Channel)
+{
+    Tim_ChConfig(htim, Channel, sConfig->OCMode | TIM_CCMR1_OC1PE, sConfig->Pulse, sConfig->OCPolarity);
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_TIM_OC_ConfigChannel(TIM_HandleTypeDef *htim, TIM_OC_InitTypeDef *sConfig, uint32_t Channel)
+{
+    Tim_ChConfig(htim, Channel, sConfig->OCMode, sConfig->Pulse, sConfig->OCPolarity);
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_TIM_IC_ConfigChannel(TIM_HandleTypeDef *htim, TIM_IC_InitTypeDef *sConfig, uint32_t Channel)
+{
+    uint32_t ccr = (&htim->Instance->CCR1)[Channel >> 2];
+    Tim_ChConfig(htim, Channel, sConfig->ICSelection | sConfig->ICPrescaler | (sConfig->ICFilter << 4),
+                 ccr, sConfig->ICPolarity);
+    return HAL_OK;
+}
+
+static HAL_StatusTypeDef Tim_Start(TIM_HandleTypeDef *htim, uint32_t Channel, uint32_t dier)
+{
+    uint8_t n = Tim_No(htim->Instance);
+    TIM_TypeDef *r = &tim[n].r;
+
+    Vb_Poll();
+    r->DIER |= dier;
+    if (Channel != TIM_CHANNEL_ALL) r->CCER |= TIM_CCER_CC1E << Channel;
+    if (n == 1) r->BDTR |= TIM_BDTR_MOE;
+    r->CR1 |= TIM_CR1_CEN;
+    Tim_Sync(n);
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_TIM_Base_Start(TIM_HandleTypeDef *htim)
+{
+    return Tim_Start(htim, TIM_CHANNEL_ALL, 0);
+}
+
+HAL_StatusTypeDef HAL_TIM_PWM_Start(TIM_HandleTypeDef *htim, uint32_t Channel)
+{
+    return Tim_Start(htim, Channel, 0);
+}
+
+HAL_StatusTypeDef HAL_TIM_IC_Start_IT(TIM_HandleTypeDef *htim, uint32_t Channel)
+{
+    return Tim_Start(htim, Channel, TIM_DIER_CC1IE << (Channel >> 2));
+}
+
+HAL_StatusTypeDef HAL_TIM_PWM_Stop(TIM_HandleTypeDef *htim, uint32_t Channel)
+{
+    uint8_t n = Tim_No(htim->Instance);
+    TIM_TypeDef *r = &tim[n].r;
+
+    Vb_Poll();
+    r->CCER &= ~(TIM_CCER_CC1E << Channel);
+    if ((r->CCER & 0x1111u) == 0) r->CR1 &= ~TIM_CR1_CEN;
+    Tim_Sync(n);
+    return HAL_OK;
+}
+
+uint32_t HAL_TIM_ReadCapturedValue(TIM_HandleTypeDef *htim, uint32_t Channel)
+{
+    return (&htim->Instance->CCR1)[Channel >> 2];
+}
+
+static HAL_TIM_ActiveChannel Tim_DmaChannel(TIM_HandleTypeDef *htim, DMA_HandleTypeDef *hdma)
+{
+    for (uint8_t id = TIM_DMA_ID_CC1; id <= TIM_DMA_ID_CC4; id++)
+        if (htim->hdma[id] == hdma) return (HAL_TIM_ActiveChannel)(1u << (id - 1u));
+    return HAL_TIM_ACTIVE_CHANNEL_CLEARED;
+}
+
+static void Tim_DmaPulseCplt(DMA_HandleTypeDef *hdma)
+{
+    TIM_HandleTypeDef *htim = (TIM_HandleTypeDef *)hdma->Parent;
+    htim->Channel = Tim_DmaChannel(htim, hdma);
+    HAL_TIM_PWM_PulseFinishedCallback(htim);
+    htim->Channel = HAL_TIM_ACTIVE_CHANNEL_CLEARED;
+}
+
+static void Tim_DmaPulseHalf(DMA_HandleTypeDef *hdma)
+{
+    TIM_HandleTypeDef *htim = (TIM_HandleTypeDef *)hdma->Parent;
+    htim->Channel = Tim_DmaChannel(htim, hdma);
+    HAL_TIM_PWM_PulseFinishedHalfCpltCallback(htim);
+    htim->Channel = HAL_TIM_ACTIVE_CHANNEL_CLEARED;
+}
+
+static uint16_t Tim_DmaId(uint32_t src)
+{
+    switch (src)
+    {
+        case TIM_DMA_CC1: return TIM_DMA_ID_CC1;
+        case TIM_DMA_CC2: return TIM_DMA_ID_CC2;
+        case TIM_DMA_CC3: return TIM_DMA_ID_CC3;
+        case TIM_DMA_CC4: return TIM_DMA_ID_CC4;
+        default:          return TIM_DMA_ID_UPDATE;
+    }
+}
+
+HAL_StatusTypeDef HAL_TIM_DMABurst_MultiWriteStart(TIM_HandleTypeDef *htim, uint32_t BurstBaseAddress,
+                                                   uint32_t BurstRequestSrc, uint32_t *BurstBuffer,
+                                                   uint32_t BurstLength, uint32_t DataLength)
+{
+    uint8_t n = Tim_No(htim->Instance);
+    DMA_HandleTypeDef *h = htim->hdma[Tim_DmaId(BurstRequestSrc)];
+
+    if (!n || !h || !BurstBuffer) return HAL_ERROR;
+
+    h->XferCpltCallback = Tim_DmaPulseCplt;
+    h->XferHalfCpltCallback = Tim_DmaPulseHalf;
+    h->XferErrorCallback = NULL;
+
+    Vb_Poll();
+    Vb_DmaStart(h, BurstBuffer, (uint16_t)DataLength, 1);
+    tim[n].r.DCR = BurstBaseAddress | BurstLength;
+    tim[n].r.DIER |= BurstRequestSrc;
+    Tim_Sync(n);
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_TIM_DMABurst_WriteStop(TIM_HandleTypeDef *htim, uint32_t BurstRequestSrc)
+{
+    uint8_t n = Tim_No(htim->Instance);
+    DMA_HandleTypeDef *h = htim->hdma[Tim_DmaId(BurstRequestSrc)];
+
+    Vb_Poll();
+    tim[n].r.DIER &= ~BurstRequestSrc;
+    Tim_Sync(n);
+    if (h) Vb_DmaStop(h);
+    return HAL_OK;
+}
+
+/* stm32f1xx_hal_tim.c HAL_TIM_IRQHandler 와 같은 순서 (CC1..4 → 갱신) */
+void HAL_TIM_IRQHandler(TIM_HandleTypeDef *htim)
+{
+    uint8_t n = Tim_No(htim->Instance);
+    TIM_TypeDef *r = &tim[n].r;
+
+    Vb_Poll();
+    for (uint8_t ch = 0; ch < 4; ch++)
+    {
+        uint32_t f = TIM_SR_CC1IF << ch;
+
+        Tim_Sync(n);
+        if (!((r->SR & f) && (r->DIER & f))) continue;
+
+        r->SR = ~f;
+        Tim_Sync(n);
+        htim->Channel = (HAL_TIM_ActiveChannel)(1u << ch);
+        if (Tim_IsInput(&tim[n], ch))
+        {
+            HAL_TIM_IC_CaptureCallback(htim);
+        }
+        else
+        {
+            HAL_TIM_OC_DelayElapsedCallback(htim);
+            HAL_TIM_PWM_PulseFinishedCallback(htim);
+        }
+        htim->Channel = HAL_TIM_ACTIVE_CHANNEL_CLEARED;
+    }
+
+    Tim_Sync(n);
+    if ((r->SR & TIM_SR_UIF) && (r->DIER & TIM_DIER_UIE))
+    {
+        r->SR = ~TIM_SR_UIF;
+        Tim_Sync(n);
+        HAL_TIM_PeriodElapsedCallback(htim);
+    }
+}
+
+/* ===== HAL 코어 / RCC / NVIC ===== */
+__weak void HAL_MspInit(void) { }
+
+HAL_StatusTypeDef HAL_Init(void)
+{
+    Irq_Bind();
+    Vb_AddSource(&systick_src);
+    Vb_AddSource(&tim_src);
+
+    /* HAL_InitTick: 1ms SysTick */
+    systick_on = 1;
+    systick_next = vb_now + VB_MS;
+    HAL_NVIC_SetPriority(SysTick_IRQn, VB_TICK_PRIORITY, 0);
+    Irq_Of(SysTick_IRQn)->en = 1;
+
+    HAL_MspInit();
+    return HAL_OK;
+}
+
+void HAL_IncTick(void)
+{
+    uwTick++;
+}
+
+uint32_t HAL_GetTick(void)
+{
+    Vb_Poll();
+    return uwTick;
+}
+
+void HAL_Delay(uint32_t Delay)
+{
+    uint32_t tickstart = HAL_GetTick();
+    uint32_t wait = Delay;
+
+    if (wait < HAL_MAX_DELAY) wait++;
+    while ((HAL_GetTick() - tickstart) < wait)
+        Vb_Sleep();
+}
+
+HAL_StatusTypeDef HAL_RCC_OscConfig(RCC_OscInitTypeDef *RCC_OscInitStruct)
+{
+    UNUSED(RCC_OscInitStruct);
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_RCC_ClockConfig(RCC_ClkInitTypeDef *RCC_ClkInitStruct, uint32_t FLatency)
+{
+    UNUSED(FLatency);
+    vb_rcc.CFGR = (vb_rcc.CFGR & ~RCC_CFGR_PPRE1) | (RCC_ClkInitStruct->APB1CLKDivider & RCC_CFGR_PPRE1);
+    SystemCoreClock = VB_CORE_HZ;
+    return HAL_OK;
+}
+
+uint32_t HAL_RCC_GetHCLKFreq(void)
+{
+    return SystemCoreClock;
+}
+
+uint32_t HAL_RCC_GetPCLK1Freq(void)
+{
+    return ((vb_rcc.CFGR & RCC_CFGR_PPRE1) == RCC_CFGR_PPRE1_DIV2) ? SystemCoreClock / 2u : SystemCoreClock;
+}
+
+uint32_t HAL_RCC_GetPCLK2Freq(void)
+{
+    return SystemCoreClock;
+}
+
+void HAL_NVIC_SetPriority(IRQn_Type IRQn, uint32_t PreemptPriority, uint32_t SubPriority)
+{
+    VbIrq_t *q = Irq_Of(IRQn);
+    UNUSED(SubPriority);            // 그룹 4 (서브 우선순위 없음)
+    if (q) q->prio = (uint8_t)PreemptPriority;
+}
+
+void HAL_NVIC_EnableIRQ(IRQn_Type IRQn)
+{
+    VbIrq_t *q = Irq_Of(IRQn);
+    if (q) q->en = 1;
+}
+
+void HAL_NVIC_DisableIRQ(IRQn_Type IRQn)
+{
+    VbIrq_t *q = Irq_Of(IRQn);
+    if (q) q->en = 0;
+}
+
+/* ===== 통계 ===== */
+void Vb_CorePrintStats(FILE *f, double host_s)
+{
+    double virt_s = vb_now / 1e9;
+
+    fprintf(f, "가상 %.3fs / 호스트 %.3fs (실시간의 %.1f배), SysTick %u\n",
+            virt_s, host_s, host_s > 0 ? virt_s / host_s : 0.0, (unsigned)uwTick);
+
+    fprintf(f, "\n인터럽트      우선  횟수       가상 평균(us) 호스트 평균(us)\n");
+    for (uint8_t i = 0; i < N_IRQS; i++)
+    {
+        const VbIrq_t *q = &irqs[i];
+        if (!q->count) continue;
+        fprintf(f, "  %-10s  %3u  %9u  %12.2f  %14.3f\n", q->name, q->prio, (unsigned)q->count,
+                q->virt_ns / 1e3 / q->count, q->host_ns / 1e3 / q->count);
+    }
+
+    fprintf(f, "\n타이머  갱신      비교      캡처    DMA 버스트\n");
+    for (uint8_t n = 1; n <= 4; n++)
+    {
+        const VbTim_t *t = &tim[n];
+        fprintf(f, "  TIM%u  %8u  %8u  %6u  %8u\n", n, (unsigned)t->updates, (unsigned)t->compares,
+                (unsigned)t->captures, (unsigned)t->bursts);
+    }
+
+    fprintf(f, "\nDMA 전송:");
+    for (uint8_t i = 1; i < 8; i++)
+        if (dma[i].transfers) fprintf(f, " CH%u %u", i, (unsigned)dma[i].transfers);
+    fprintf(f, "\n");
+}
@@ -0,0 +1,499 @@
+/**
+ * @file vboard_dev.c
+ * @brief 가상 보드 장치 - ST7735 (SPI 디코더 → PNG), HD44780 (PCF8574 4비트), HC-SR04 (에코 모델)
+ *
+ * ST7735: CS(PB12) low 동안 DC(PA8) low = 명령, high = 인자/픽셀
+ *   CASET/RASET 창 안에 RAMWR 픽셀(RGB565 빅엔디안)을 순서대로, 창 끝에서 처음으로 (실제 칩과 같음)
+ *   MADCTL 0x60 → 창 좌표가 곧 화면 좌표, 보이는 곳 = 열 0~159, 행 Y_OFFSET(26)~+79
+ * HD44780: EN(P2) 하강 에지에 니블 래치, 기능 설정(DL=0) 전까지는 8비트 명령 1번 = 니블 1개
+ * HC-SR04: TIM2 갱신(= TRIG 펄스 시작)마다 10us + 450us 뒤 에코 상승, 거리 × 58us 뒤 하강
+ *   거리 = min(정면 거리 표(-d), 서보 각도가 들어간 장애물 구간(-o)) + 잡음(-n)
+ *   서보 각도 = (TIM1 CCR4 - 500) × 180 / 2000
+ * RGB LED: GPIOC ODR 의 PC5(R)/PC6(G)/PC8(B) 가 바뀔 때마다 켜짐 시간 누적 → 채널별 평균 듀티
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "vboard.h"
+
+/* ===== ST7735 ===== */
+#define GRAM_W      256
+#define GRAM_H      256
+#define VIEW_X      0
+#define VIEW_Y      26      // lcd_st7735.c Y_OFFSET
+#define VIEW_W      160
+#define VIEW_H      80
+
+static struct {
+    uint16_t gram[GRAM_H][GRAM_W];
+    uint8_t  cmd;
+    uint8_t  argn;
+    uint8_t  args[4];
+    uint16_t xs, xe, ys, ye, x, y;
+    uint8_t  hi, half;          // 픽셀 상위 바이트 대기
+    uint32_t pixels, cmds, windows;
+} lcd;
+
+#define ST_CASET    0x2A
+#define ST_RASET    0x2B
+#define ST_RAMWR    0x2C
+
+static void Lcd_Pixel(uint16_t c)
+{
+    if (lcd.y < GRAM_H && lcd.x < GRAM_W) lcd.gram[lcd.y][lcd.x] = c;
+    lcd.pixels++;
+
+    if (++lcd.x > lcd.xe)
+    {
+        lcd.x = lcd.xs;
+        if (++lcd.y > lcd.ye) lcd.y = lcd.ys;
+    }
+}
+
+static void Lcd_Byte(uint8_t dc, uint8_t b)
+{
+    if (!dc)
+    {
+        lcd.cmd = b;
+        lcd.argn = 0;
+        lcd.half = 0;
+        lcd.cmds++;
+        if (b == ST_RAMWR)
+        {
+            lcd.x = lcd.xs;
+            lcd.y = lcd.ys;
+        }
+        return;
+    }
+
+    switch (lcd.cmd)
+    {
+        case ST_CASET:
+        case ST_RASET:
+            if (lcd.argn < 4) lcd.args[lcd.argn++] = b;
+            if (lcd.argn == 4)
+            {
+                uint16_t s = (uint16_t)((lcd.args[0] << 8) | lcd.args[1]);
+                uint16_t e = (uint16_t)((lcd.args[2] << 8) | lcd.args[3]);
+                if (lcd.cmd == ST_CASET) { lcd.xs = s; lcd.xe = e; }
+                else                     { lcd.ys = s; lcd.ye = e; lcd.windows++; }
+                lcd.argn++;
+            }
+            break;
+
+        case ST_RAMWR:
+            if (!lcd.half)
+            {
+                lcd.hi = b;
+                lcd.half = 1;
+            }
+            else
+            {
+                Lcd_Pixel((uint16_t)((lcd.hi << 8) | b));
+                lcd.half = 0;
+            }
+            break;
+
+        default:
+            break;
+    }
+}
+
+void Lcd_Spi(const uint8_t *p, uint16_t n)
+{
+    if (vb_gpio[1].ODR & GPIO_PIN_12) return;       // CS high → 다른 장치
+    uint8_t dc = (vb_gpio[0].ODR & GPIO_PIN_8) != 0;
+
+    for (uint16_t i = 0; i < n; i++)
+        Lcd_Byte(dc, p[i]);
+}
+
+uint32_t Lcd_Pixels(void)
+{
+    return lcd.pixels;
+}
+
+/* PNG: 무압축 deflate (저장 블록) + CRC32/Adler32 - zlib 없이 */
+static uint32_t crc_table[256];
+
+static uint32_t Crc32(uint32_t c, const uint8_t *p, uint32_t n)
+{
+    if (!crc_table[1])
+    {
+        for (uint32_t i = 0; i < 256; i++)
+        {
+            uint32_t v = i;
+            for (int k = 0; k < 8; k++) v = (v & 1u) ? 0xEDB88320u ^ (v >> 1) : v >> 1;
+            crc_table[i] = v;
+        }
+    }
+    c ^= 0xFFFFFFFFu;
+    while (n--) c = crc_table[(c ^ *p++) & 0xFFu] ^ (c >> 8);
+    return c ^ 0xFFFFFFFFu;
+}
+
+static void Put32(uint8_t *p, uint32_t v)
+{
+    p[0] = (uint8_t)(v >> 24); p[1] = (uint8_t)(v >> 16); p[2] = (uint8_t)(v >> 8); p[3] = (uint8_t)v;
+}
+
+static void Png_Chunk(FILE *f, const char *type, const uint8_t *data, uint32_t n)
+{
+    uint8_t hdr[8];
+    Put32(hdr, n);
+    memcpy(hdr + 4, type, 4);
+    uint32_t crc = Crc32(Crc32(0, hdr + 4, 4), data, n);
+
+    fwrite(hdr, 1, 8, f);
+    if (n) fwrite(data, 1, n, f);
+    Put32(hdr, crc);
+    fwrite(hdr, 1, 4, f);
+}
+
+void Lcd_WritePng(const char *path, uint8_t zoom)
+{
+    if (zoom == 0) zoom = 1;
+
+    uint32_t w = VIEW_W * zoom, h = VIEW_H * zoom, row = 1u + w * 3u, raw_n = row * h;
+    uint8_t *raw = malloc(raw_n);
+    uint32_t blocks = (raw_n + 65534u) / 65535u;
+    uint8_t *z = malloc(2u + raw_n + blocks * 5u + 4u);
+    FILE *f = fopen(path, "wb");
+
+    if (!raw || !z || !f)
+    {
+        perror(path);
+        free(raw);
+        free(z);
+        if (f) fclose(f);
+        return;
+    }
+
+    /* 필터 0 + RGB888 */
+    for (uint32_t yy = 0; yy < h; yy++)
+    {
+        uint8_t *o = raw + yy * row;
+        *o++ = 0;
+        for (uint32_t xx = 0; xx < w; xx++)
+        {
+            uint16_t c = lcd.gram[VIEW_Y + yy / zoom][VIEW_X + xx / zoom];
+            uint8_t r5 = c >> 11, g6 = (c >> 5) & 0x3F, b5 = c & 0x1F;
+            *o++ = (uint8_t)((r5 << 3) | (r5 >> 2));
+            *o++ = (uint8_t)((g6 << 2) | (g6 >> 4));
+            *o++ = (uint8_t)((b5 << 3) | (b5 >> 2));
+        }
+    }
+
+    /* zlib: 78 01 + 저장 블록들 + Adler32 */
+    uint32_t zn = 0, a = 1, b = 0;
+    z[zn++] = 0x78;
+    z[zn++] = 0x01;
+    for (uint32_t off = 0; off < raw_n; )
+    {
+        uint32_t len = raw_n - off;
+        if (len > 65535u) len = 65535u;
+        z[zn++] = (off + len == raw_n) ? 1 : 0;
+        z[zn++] = (uint8_t)len;
+        z[zn++] = (uint8_t)(len >> 8);
+        z[zn++] = (uint8_t)~len;
+        z[zn++] = (uint8_t)(~len >> 8);
+        memcpy(z + zn, raw + off, len);
+        zn += len;
+        off += len;
+    }
+    for (uint32_t i = 0; i < raw_n; i++)
+    {
+        a = (a + raw[i]) % 65521u;
+        b = (b + a) % 65521u;
+    }
+    Put32(z + zn, (b << 16) | a);
+    zn += 4;
+
+    uint8_t ihdr[13];
+    Put32(ihdr, w);
+    Put32(ihdr + 4, h);
+    ihdr[8] = 8;        // 비트 깊이
+    ihdr[9] = 2;        // RGB
+    ihdr[10] = ihdr[11] = ihdr[12] = 0;
+
+    fwrite("\x89PNG\r\n\x1a\n", 1, 8, f);
+    Png_Chunk(f, "IHDR", ihdr, sizeof(ihdr));
+    Png_Chunk(f, "IDAT", z, zn);
+    Png_Chunk(f, "IEND", NULL, 0);
+    fclose(f);
+    free(raw);
+    free(z);
+}
+
+/* ===== HD44780 (PCF8574: P0 RS, P1 RW, P2 EN, P3 BL, P4~7 D4~D7) ===== */
+#define PCF_RS      0x01
+#define PCF_EN      0x04
+#define PCF_BL      0x08
+
+static struct {
+    uint8_t  prev;
+    uint8_t  four_bit;
+    uint8_t  have_hi, hi;
+    uint8_t  addr;              // DDRAM 주소
+    uint8_t  cgram;             // 1 = CGRAM 쓰는 중
+    uint8_t  inc;
+    uint8_t  on, bl;
+    char     ddram[2][40];
+    char     shown[2][17];
+    uint32_t writes, changes;
+} clcd = { .inc = 1 };
+
+static void Clcd_Exec(uint8_t rs, uint8_t v)
+{
+    if (rs)
+    {
+        if (clcd.cgram) return;
+        clcd.ddram[clcd.addr >= 0x40][(clcd.addr & 0x3F) % 40] = (char)v;
+        clcd.writes++;
+        uint8_t col = (uint8_t)(((clcd.addr & 0x3F) + (clcd.inc ? 1 : 39)) % 40);
+        clcd.addr = (uint8_t)((clcd.addr & 0x40) | col);
+        return;
+    }
+
+    if (v & 0x80)      { clcd.addr = v & 0x7F; clcd.cgram = 0; }
+    else if (v & 0x40) { clcd.cgram = 1; }
+    else if (v & 0x20) { if (!(v & 0x10) && !clcd.four_bit) clcd.four_bit = 1; }
+    else if (v & 0x08) { clcd.on = (v & 0x04) != 0; }
+    else if (v & 0x04) { clcd.inc = (v & 0x02) != 0; }
+    else if (v & 0x02) { clcd.addr = 0; clcd.cgram = 0; }
+    else if (v & 0x01)
+    {
+        memset(clcd.ddram, ' ', sizeof(clcd.ddram));
+        clcd.addr = 0;
+        clcd.inc = 1;
+        clcd.cgram = 0;
+    }
+}
+
+static void Clcd_View(char out[2][17])
+{
+    for (uint8_t r = 0; r < 2; r++)
+    {
+        for (uint8_t c = 0; c < 16; c++)
+        {
+            char ch = clcd.ddram[r][c];
+            out[r][c] = (ch >= 0x20 && ch < 0x7F) ? ch : (ch == 0 ? ' ' : '?');
+        }
+        out[r][16] = 0;
+    }
+}
+
+void Clcd_Write(const uint8_t *data, uint16_t n)
+{
+    for (uint16_t i = 0; i < n; i++)
+    {
+        uint8_t b = data[i];
+        clcd.bl = (b & PCF_BL) != 0;
+
+        if ((clcd.prev & PCF_EN) && !(b & PCF_EN))
+        {
+            uint8_t nib = clcd.prev >> 4, rs = clcd.prev & PCF_RS;
+
+            if (!clcd.four_bit)
+            {
+                Clcd_Exec(rs, (uint8_t)(nib << 4));     // 8비트 모드: 아래 4비트 선은 0
+                clcd.have_hi = 0;
+            }
+            else if (!clcd.have_hi)
+            {
+                clcd.hi = nib;
+                clcd.have_hi = 1;
+            }
+            else
+            {
+                Clcd_Exec(rs, (uint8_t)((clcd.hi << 4) | nib));
+                clcd.have_hi = 0;
+            }
+        }
+        clcd.prev = b;
+    }
+
+    char v[2][17];
+    Clcd_View(v);
+    if (memcmp(v, clcd.shown, sizeof(v)) != 0)
+    {
+        memcpy(clcd.shown, v, sizeof(v));
+        clcd.changes++;
+        if (vb_cfg.log) fprintf(vb_cfg.log, "[%10.3f] CLCD |%s|%s|\n", vb_now / 1e6, v[0], v[1]);
+    }
+}
+
+void Clcd_Print(FILE *f)
+{
+    char v[2][17];
+    Clcd_View(v);
+    fprintf(f, "문자 LCD (%s, 백라이트 %s, 글자 %u, 화면 바뀜 %u번)\n",
+            clcd.on ? "켜짐" : "꺼짐", clcd.bl ? "켜짐" : "꺼짐", (unsigned)clcd.writes, (unsigned)clcd.changes);
+    fprintf(f, "  +----------------+\n  |%s|\n  |%s|\n  +----------------+\n", v[0], v[1]);
+}
+
+/* ===== HC-SR04 ===== */
+#define SONAR_MAX_STEPS     32
+#define SONAR_MAX_SECTORS   16
+#define SONAR_NO_ECHO_US    38000u
+#define SONAR_DELAY_NS      460000ull      // TRIG 10us + 버스트 약 450us
+
+static struct {
+    struct { uint64_t t; uint16_t cm; } steps[SONAR_MAX_STEPS];
+    uint8_t n_steps;
+    struct { uint8_t a0, a1; uint16_t cm; } sectors[SONAR_MAX_SECTORS];
+    uint8_t n_sectors;
+    uint16_t noise;
+    uint32_t lcg;
+
+    uint64_t t_rise, t_fall;    // UINT64_MAX = 없음
+    uint16_t last_cm;
+    uint8_t  last_angle;
+    uint32_t pings, captures;
+} sonar = { .lcg = 12345u, .t_rise = UINT64_MAX, .t_fall = UINT64_MAX };
+
+void Sonar_AddStep(uint64_t t_ns, uint16_t cm)
+{
+    if (sonar.n_steps >= SONAR_MAX_STEPS) return;
+
+    uint8_t k = sonar.n_steps++;
+    while (k > 0 && sonar.steps[k - 1].t > t_ns)
+    {
+        sonar.steps[k] = sonar.steps[k - 1];
+        k--;
+    }
+    sonar.steps[k].t = t_ns;
+    sonar.steps[k].cm = cm;
+}
+
+void Sonar_AddSector(uint8_t a0, uint8_t a1, uint16_t cm)
+{
+    if (sonar.n_sectors >= SONAR_MAX_SECTORS) return;
+    sonar.sectors[sonar.n_sectors].a0 = a0;
+    sonar.sectors[sonar.n_sectors].a1 = a1;
+    sonar.sectors[sonar.n_sectors].cm = cm;
+    sonar.n_sectors++;
+}
+
+void Sonar_SetNoise(uint16_t cm)
+{
+    sonar.noise = cm;
+}
+
+static uint8_t Servo_Angle(void)
+{
+    int32_t ccr = (int32_t)Vb_TimCompare(1, 3);
+    int32_t a = (ccr - 500) * 180 / 2000;
+    return (uint8_t)(a < 0 ? 0 : a > 180 ? 180 : a);
+}
+
+static uint16_t Sonar_Distance(uint64_t t)
+{
+    uint16_t cm = 0;            // 0 = 장애물 없음
+    uint8_t ang = Servo_Angle();
+
+    for (uint8_t i = 0; i < sonar.n_steps && sonar.steps[i].t <= t; i++)
+        cm = sonar.steps[i].cm;
+
+    for (uint8_t i = 0; i < sonar.n_sectors; i++)
+    {
+        if (ang >= sonar.sectors[i].a0 && ang <= sonar.sectors[i].a1 && (cm == 0 || sonar.sectors[i].cm < cm))
+            cm = sonar.sectors[i].cm;
+    }
+
+    if (cm && sonar.noise)
+    {
+        sonar.lcg = sonar.lcg * 1103515245u + 12345u;
+        int32_t d = (int32_t)((sonar.lcg >> 16) % (2u * sonar.noise + 1u)) - sonar.noise;
+        int32_t v = (int32_t)cm + d;
+        cm = (uint16_t)(v < 2 ? 2 : v);
+    }
+
+    sonar.last_angle = ang;
+    sonar.last_cm = cm;
+    return cm;
+}
+
+/* TIM2 갱신 = CH1 PWM 펄스(TRIG) 시작 */
+static void Sonar_Trigger(uint64_t t)
+{
+    TIM_TypeDef *r = Vb_TimPeek(2);
+    if (!(r->CCER & TIM_CCER_CC1E)) return;
+
+    uint16_t cm = Sonar_Distance(t);
+    uint64_t width_us = (cm == 0 || cm >= 400) ? SONAR_NO_ECHO_US : (uint64_t)cm * 58u;
+
+    sonar.pings++;
+    sonar.t_rise = t + SONAR_DELAY_NS;
+    sonar.t_fall = sonar.t_rise + width_us * 1000u;
+}
+
+static uint64_t Sonar_Next(void)
+{
+    return (sonar.t_rise != UINT64_MAX) ? sonar.t_rise : sonar.t_fall;
+}
+
+static void Sonar_Fire(void)
+{
+    if (sonar.t_rise != UINT64_MAX)
+    {
+        sonar.t_rise = UINT64_MAX;
+        sonar.captures += Vb_TimCapture(2, 1, 1);
+    }
+    else
+    {
+        sonar.t_fall = UINT64_MAX;
+        sonar.captures += Vb_TimCapture(2, 1, 0);
+    }
+}
+
+static const VbSource_t sonar_src = { "HC-SR04", Sonar_Next, Sonar_Fire };
+
+/* ===== 초기화 / 통계 ===== */
+void Vb_DevInit(void)
+{
+    memset(clcd.ddram, ' ', sizeof(clcd.ddram));
+    Vb_AddSource(&sonar_src);
+    Vb_OnTimUpdate(2, Sonar_Trigger);
+}
+
+/* ===== RGB LED ===== */
+static const uint16_t rgb_pin[3] = { 1u << 5, 1u << 6, 1u << 8 };
+
+static struct {
+    uint16_t odr;
+    uint64_t since;             // 마지막 변화 시각
+    uint64_t on_ns[3];
+    uint32_t changes;
+} rgb;
+
+static void Rgb_Account(void)
+{
+    for (uint8_t c = 0; c < 3; c++)
+        if (rgb.odr & rgb_pin[c]) rgb.on_ns[c] += vb_now - rgb.since;
+    rgb.since = vb_now;
+}
+
+void Rgb_Gpio(uint16_t odr)
+{
+    uint16_t mask = rgb_pin[0] | rgb_pin[1] | rgb_pin[2];
+    if (((odr ^ rgb.odr) & mask) == 0) return;
+
+    Rgb_Account();
+    rgb.odr = odr;
+    rgb.changes++;
+}
+
+void Vb_DevPrintStats(FILE *f)
+{
+    Rgb_Account();
+    double t = vb_now ? (double)vb_now : 1.0;
+
+    fprintf(f, "\nST7735 명령 %u, 창 %u, 픽셀 %u\n", (unsigned)lcd.cmds, (unsigned)lcd.windows, (unsigned)lcd.pixels);
+    fprintf(f, "HC-SR04 핑 %u, 에지 캡처 %u, 마지막 %ucm @ 서보 %u도\n",
+            (unsigned)sonar.pings, (unsigned)sonar.captures, sonar.last_cm, sonar.last_angle);
+    fprintf(f, "RGB LED 평균 듀티 R %.1f%% G %.1f%% B %.1f%%, 핀 변화 %u\n",
+            rgb.on_ns[0] * 100.0 / t, rgb.on_ns[1] * 100.0 / t, rgb.on_ns[2] * 100.0 / t,
+            (unsigned)rgb.changes);
+}
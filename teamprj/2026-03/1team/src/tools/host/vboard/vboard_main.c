@@ -0,0 +1,253 @@
+/**
+ * @file vboard_main.c
+ * @brief 가상 보드 실행기 - 옵션 처리 후 펌웨어 main() (Firmware_Main) 실행
+ *
+ *   -t ms          실행 시간 (기본 3000)
+ *   -u ms:글자     그 시각에 USB(USART2)로 입력 (\n \r \xHH 가능, @파일 = 파일 내용)
+ *   -b ms:글자     블루투스(USART3)로 입력
+ *   -d cm[@ms]     정면 거리 (ms부터, 여러 번 가능, 0 = 장애물 없음)
+ *   -o a0-a1:cm    서보 각도 a0~a1도에 장애물
+ *   -n cm          초음파 잡음 (±cm 균등)
+ *   -p 파일.png    끝날 때 LCD 화면
+ *   -s ms          LCD 스냅샷 주기 (파일_<ms>.png)
+ *   -z 배율        PNG 확대 (기본 3)
+ *   -l 파일        버스 로그 (- = stderr)
+ *   -r 파일        USB 송신 원본 바이트 (링크 프레임 포함 → tools/prof_trace.py --file 등)
+ *   -c ns          시계 읽기/HAL 호출 1번 비용 (기본 100)
+ *   -x 배율        호스트 실행 시간 × 배율을 가상 시간에 더함 (기본 0 = 결정적)
+ *   -w 초          호스트 시간 제한 (기본 60, 펌웨어가 멈췄을 때)
+ *   -q             펌웨어 출력 숨김
+ *
+ * 펌웨어 printf → stdout(여기서 _write로 연결) → HAL_UART_Transmit → 터미널 (보드와 같은 경로, 전송 시간 포함)
+ */
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <signal.h>
+#include <unistd.h>
+#include <time.h>
+#include "vboard.h"
+
+#undef main                     // -Dmain=Firmware_Main 은 펌웨어 main.c 용
+
+extern int Firmware_Main(void);
+extern int _write(int file, char *ptr, int len);
+
+static struct timespec host_t0;
+static uint64_t snap_next = UINT64_MAX;
+
+void Vb_Log(const char *fmt, ...)
+{
+    va_list ap;
+
+    if (!vb_cfg.log) return;
+    fprintf(vb_cfg.log, "[%10.3f] ", vb_now / 1e6);
+    va_start(ap, fmt);
+    vfprintf(vb_cfg.log, fmt, ap);
+    va_end(ap);
+    fputc('\n', vb_cfg.log);
+}
+
+static double Host_Seconds(void)
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (t.tv_sec - host_t0.tv_sec) + (t.tv_nsec - host_t0.tv_nsec) / 1e9;
+}
+
+void Vb_Finish(void)
+{
+    if (vb_stop) return;
+    vb_stop = 1;
+
+    fflush(stdout);
+    fprintf(stderr, "\n===== 가상 보드 =====\n");
+    Vb_CorePrintStats(stderr, Host_Seconds());
+    Vb_BusPrintStats(stderr);
+    Vb_DevPrintStats(stderr);
+    fprintf(stderr, "\n");
+    Clcd_Print(stderr);
+
+    if (vb_cfg.png)
+    {
+        Lcd_WritePng(vb_cfg.png, vb_cfg.png_zoom);
+        fprintf(stderr, "LCD → %s\n", vb_cfg.png);
+    }
+    if (vb_cfg.log && vb_cfg.log != stderr) fclose(vb_cfg.log);
+    if (vb_cfg.raw) fclose(vb_cfg.raw);
+    exit(0);
+}
+
+/* ===== 끝 / 스냅샷 사건 ===== */
+static uint64_t End_Next(void)
+{
+    return vb_cfg.end_ns;
+}
+
+static void End_Fire(void)
+{
+    Vb_Finish();
+}
+
+static const VbSource_t end_src = { "END", End_Next, End_Fire };
+
+static uint64_t Snap_Next(void)
+{
+    return snap_next;
+}
+
+static void Snap_Fire(void)
+{
+    char path[512];
+    const char *dot = strrchr(vb_cfg.png, '.');
+    int base = dot ? (int)(dot - vb_cfg.png) : (int)strlen(vb_cfg.png);
+
+    snprintf(path, sizeof(path), "%.*s_%06llu.png", base, vb_cfg.png, (unsigned long long)(snap_next / VB_MS));
+    Lcd_WritePng(path, vb_cfg.png_zoom);
+    snap_next += (uint64_t)vb_cfg.snap_ms * VB_MS;
+}
+
+static const VbSource_t snap_src = { "SNAP", Snap_Next, Snap_Fire };
+
+/* ===== 펌웨어 stdout → _write ===== */
+static ssize_t Stdout_Write(void *cookie, const char *buf, size_t n)
+{
+    UNUSED(cookie);
+    if (vb_stop) return (ssize_t)n;
+    _write(1, (char *)buf, (int)n);
+    return (ssize_t)n;
+}
+
+static void Wall_Timeout(int sig)
+{
+    static const char msg[] = "\n[vboard] 호스트 시간 제한 - 펌웨어가 시계를 안 보는 무한 루프?\n";
+    UNUSED(sig);
+    (void)!write(STDERR_FILENO, msg, sizeof(msg) - 1);
+    _exit(3);
+}
+
+/* ===== 옵션 ===== */
+static uint32_t Unescape(const char *s, uint8_t *out, uint32_t max)
+{
+    uint32_t n = 0;
+
+    if (s[0] == '@')
+    {
+        FILE *f = fopen(s + 1, "rb");
+        if (!f) { perror(s + 1); exit(1); }
+        n = (uint32_t)fread(out, 1, max, f);
+        fclose(f);
+        return n;
+    }
+
+    while (*s && n < max)
+    {
+        if (s[0] == '\\' && s[1])
+        {
+            s++;
+            if (*s == 'n')      { out[n++] = '\n'; s++; }
+            else if (*s == 'r') { out[n++] = '\r'; s++; }
+            else if (*s == 'x') { out[n++] = (uint8_t)strtoul(s + 1, (char **)&s, 16); }
+            else                { out[n++] = (uint8_t)*s++; }
+        }
+        else
+        {
+            out[n++] = (uint8_t)*s++;
+        }
+    }
+    return n;
+}
+
+static void Inject(uint8_t port, const char *arg)
+{
+    static uint8_t buf[4096];
+    char *colon;
+    uint64_t ms = strtoull(arg, &colon, 10);
+
+    if (*colon != ':') { fprintf(stderr, "형식: ms:글자 (%s)\n", arg); exit(1); }
+    uint32_t n = Unescape(colon + 1, buf, sizeof(buf));
+    Vb_UartInject(port, ms * VB_MS, buf, n);
+}
+
+static void Usage(const char *prog)
+{
+    fprintf(stderr,
+            "사용법: %s [-t ms] [-u ms:글자] [-b ms:글자] [-d cm[@ms]] [-o a0-a1:cm] [-n cm]\n"
+            "          [-p lcd.png] [-s ms] [-z 배율] [-l 로그] [-r 원본] [-c ns] [-x 배율] [-w 초] [-q]\n", prog);
+    exit(1);
+}
+
+int main(int argc, char **argv)
+{
+    uint32_t end_ms = 3000, wall_s = 60;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "t:u:b:d:o:n:p:s:z:l:r:c:x:w:qh")) != -1)
+    {
+        switch (opt)
+        {
+            case 't': end_ms = (uint32_t)strtoul(optarg, NULL, 10); break;
+            case 'u': Inject(2, optarg); break;
+            case 'b': Inject(3, optarg); break;
+            case 'd':
+            {
+                char *at;
+                uint16_t cm = (uint16_t)strtoul(optarg, &at, 10);
+                uint64_t ms = (*at == '@') ? strtoull(at + 1, NULL, 10) : 0;
+                Sonar_AddStep(ms * VB_MS, cm);
+                break;
+            }
+            case 'o':
+            {
+                unsigned a0, a1, cm;
+                if (sscanf(optarg, "%u-%u:%u", &a0, &a1, &cm) != 3) Usage(argv[0]);
+                Sonar_AddSector((uint8_t)a0, (uint8_t)a1, (uint16_t)cm);
+                break;
+            }
+            case 'n': Sonar_SetNoise((uint16_t)strtoul(optarg, NULL, 10)); break;
+            case 'p': vb_cfg.png = optarg; break;
+            case 's': vb_cfg.snap_ms = (uint32_t)strtoul(optarg, NULL, 10); break;
+            case 'z': vb_cfg.png_zoom = (uint8_t)strtoul(optarg, NULL, 10); break;
+            case 'l':
+                vb_cfg.log = strcmp(optarg, "-") ? fopen(optarg, "w") : stderr;
+                if (!vb_cfg.log) { perror(optarg); return 1; }
+                break;
+            case 'r':
+                vb_cfg.raw = fopen(optarg, "wb");
+                if (!vb_cfg.raw) { perror(optarg); return 1; }
+                break;
+            case 'c': vb_cfg.poll_ns = (uint32_t)strtoul(optarg, NULL, 10); break;
+            case 'x': vb_cfg.host_scale = strtod(optarg, NULL); break;
+            case 'w': wall_s = (uint32_t)strtoul(optarg, NULL, 10); break;
+            case 'q': vb_cfg.quiet = 1; break;
+            default:  Usage(argv[0]);
+        }
+    }
+
+    vb_cfg.end_ns = (uint64_t)end_ms * VB_MS;
+    if (vb_cfg.snap_ms && vb_cfg.png) snap_next = (uint64_t)vb_cfg.snap_ms * VB_MS;
+
+    cookie_io_functions_t io = { .write = Stdout_Write };
+    FILE *fw = fopencookie(NULL, "w", io);
+    if (fw)
+    {
+        setvbuf(fw, NULL, _IOLBF, 256);
+        stdout = fw;
+    }
+
+    signal(SIGALRM, Wall_Timeout);
+    alarm(wall_s);
+    clock_gettime(CLOCK_MONOTONIC, &host_t0);
+
+    Vb_AddSource(&end_src);
+    Vb_AddSource(&snap_src);
+    Vb_BusInit();
+    Vb_DevInit();
+
+    Firmware_Main();
+    Vb_Finish();
+    return 0;
+}
@@ -0,0 +1,194 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+구간 기록 스트림 해석기 (PC에서 실행)
+
+보드에 LINK_T_PROF 프레임을 보내 prof.c 의 구간 기록을 켜고, USART2 TX DMA로 오는
+{DWT 사이클, id|끝, IPSR} 기록을 받아 구간별 실행 시간 히스토그램과 타임라인을 만듭니다.
+
+  - 구간 이름/클럭은 보드가 스트림 앞에 보냄 (prof.h 에 구간을 추가해도 여기는 그대로)
+  - CYCCNT 한 바퀴(64MHz에서 67초)는 앞 기록과의 차이로 풀어서 이어 붙임
+  - 컨텍스트(IPSR)별로 시작/끝을 짝지음 → 인터럽트 안 구간은 따로, 중첩된 구간은 포함 시간
+  - 링이 넘친 곳(헤더의 dropped 증가)에서는 열린 구간을 버림
+
+Usage:
+  python prof_trace.py COM5 5                        # 5초 받아서 분석 (--save prof.bin 으로 원본 저장)
+  python prof_trace.py --file prof.bin               # 저장한 원본 다시 분석
+  python prof_trace.py --file prof.bin --json t.json # + Chrome trace / Perfetto 타임라인 (ui.perfetto.dev)
+
+가상 보드: ./robot_host -t 3000 -u '500:\\xA5\\x01\\x05\\x01\\x2D' -r prof.bin  → --file prof.bin
+"""
+
+import json
+import os
+import struct
+import sys
+import time
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+from uart_link import decode, encode  # noqa: E402
+
+T_PROF, T_PROF_HDR, T_PROF_NAME, T_PROF_REC = 0x05, 0x86, 0x87, 0x88
+F_END = 0x80
+
+REC = struct.Struct("<IBB")         # cyc, tag, ctx (6바이트)
+
+
+def ctx_name(ctx):
+    if ctx == 0:
+        return "main"
+    if ctx == 15:
+        return "SysTick"
+    return f"IRQ{ctx - 16}"
+
+
+def parse(raw):
+    """프레임 → (clock_hz, {id: 이름}, [(t_cyc 64비트, tag, ctx) 또는 ("drop", n)])"""
+    frames, _ = decode(raw)
+    clock, names, events = 64_000_000, {}, []
+    last_cyc, t, dropped = None, 0, None
+
+    for ftype, payload in frames:
+        if ftype == T_PROF_HDR and len(payload) == 8:
+            clock, d = struct.unpack("<II", payload)
+            if dropped is not None and d != dropped:
+                events.append(("drop", (d - dropped) & 0xFFFFFFFF))
+            dropped = d
+        elif ftype == T_PROF_NAME and payload:
+            names[payload[0]] = payload[1:].decode("ascii", "replace")
+        elif ftype == T_PROF_REC:
+            for off in range(0, len(payload) - REC.size + 1, REC.size):
+                cyc, tag, ctx = REC.unpack_from(payload, off)
+                if last_cyc is not None:
+                    t += (cyc - last_cyc) & 0xFFFFFFFF
+                last_cyc = cyc
+                events.append((t, tag, ctx))
+    return clock, names, events
+
+
+def pair(events):
+    """시작/끝 짝짓기 → [(id, ctx, 시작 cyc, 길이 cyc, 깊이)], 짝 없는 기록 수"""
+    spans, stacks, lost = [], {}, 0
+    for ev in events:
+        if ev[0] == "drop":
+            lost += sum(len(s) for s in stacks.values())
+            stacks = {}
+            continue
+        t, tag, ctx = ev
+        sid, stack = tag & ~F_END, stacks.setdefault(ctx, [])
+        if not tag & F_END:
+            stack.append((sid, t))
+            continue
+        for k in range(len(stack) - 1, -1, -1):
+            if stack[k][0] == sid:
+                lost += len(stack) - 1 - k         # 끝이 빠진 안쪽 구간
+                spans.append((sid, ctx, stack[k][1], t - stack[k][1], k))
+                del stack[k:]
+                break
+        else:
+            lost += 1
+    lost += sum(len(s) for s in stacks.values())
+    return spans, lost
+
+
+def percentile(sorted_v, p):
+    return sorted_v[min(len(sorted_v) - 1, int(len(sorted_v) * p / 100))]
+
+
+def histogram(us_values, width=40):
+    """2배 간격 구간 (1us 미만, 1~2, 2~4 ...), 빈 구간은 생략"""
+    buckets = {}
+    for v in us_values:
+        b = 0 if v < 1 else int(v).bit_length()
+        buckets[b] = buckets.get(b, 0) + 1
+    top = max(buckets.values())
+    lines = []
+    for b in sorted(buckets):
+        n = buckets[b]
+        lo, hi = (0, 1) if b == 0 else (1 << (b - 1), 1 << b)
+        lines.append(f"    {lo:>7d} ~ {hi:<7d} us {n:6d} {'#' * max(1, n * width // top)}")
+    return lines
+
+
+def analyze(clock, names, events, spans, lost):
+    us = lambda cyc: cyc * 1e6 / clock     # noqa: E731
+    recs = [e for e in events if e[0] != "drop"]
+    drops = sum(e[1] for e in events if e[0] == "drop")
+    span_s = us(recs[-1][0] - recs[0][0]) / 1e6 if len(recs) > 1 else 0
+
+    print(f"clock {clock / 1e6:.0f} MHz  기록 {len(recs)}  구간 {len(spans)}  "
+          f"길이 {span_s:.2f} s  링 넘침 {drops}  짝 없음 {lost}")
+
+    by = {}
+    for sid, ctx, _, dur, _ in spans:
+        by.setdefault((sid, ctx), []).append(us(dur))
+
+    for (sid, ctx), v in sorted(by.items()):
+        v.sort()
+        total = sum(v)
+        load = 100 * total / (span_s * 1e6) if span_s else 0
+        print(f"\n{names.get(sid, f'id{sid}')} [{ctx_name(ctx)}]  n={len(v)}  "
+              f"{len(v) / span_s if span_s else 0:.1f}/s  CPU {load:.2f}%")
+        print(f"  min {v[0]:.1f}  p50 {percentile(v, 50):.1f}  avg {total / len(v):.1f}  "
+              f"p95 {percentile(v, 95):.1f}  p99 {percentile(v, 99):.1f}  max {v[-1]:.1f} us")
+        print("\n".join(histogram(v)))
+
+
+def chrome_trace(clock, names, spans, path):
+    """Chrome trace 형식 (chrome://tracing, ui.perfetto.dev): 완료 이벤트 "X", tid = 컨텍스트"""
+    us = lambda cyc: cyc * 1e6 / clock     # noqa: E731
+    ev = [{"name": "process_name", "ph": "M", "pid": 1, "args": {"name": "STM32F103"}}]
+    for ctx in sorted({s[1] for s in spans}):
+        ev.append({"name": "thread_name", "ph": "M", "pid": 1, "tid": ctx, "args": {"name": ctx_name(ctx)}})
+    for sid, ctx, t0, dur, depth in sorted(spans, key=lambda s: (s[2], -s[3])):
+        ev.append({"name": names.get(sid, f"id{sid}"), "ph": "X", "pid": 1, "tid": ctx,
+                   "ts": round(us(t0), 3), "dur": round(us(dur), 3), "args": {"depth": depth, "cycles": dur}})
+    with open(path, "w", encoding="utf-8") as f:
+        json.dump({"traceEvents": ev, "displayTimeUnit": "ns"}, f)
+    print(f"\n타임라인 → {path} ({len(spans)} 구간)")
+
+
+def capture(port, seconds, save):
+    import serial
+    ser = serial.Serial(port, int(os.environ.get("BAUD", "115200")), timeout=0.05)
+    ser.reset_input_buffer()
+    ser.write(encode(T_PROF, b"\x01"))
+    raw = b""
+    deadline = time.time() + seconds
+    while time.time() < deadline:
+        raw += ser.read(4096)
+    ser.write(encode(T_PROF, b"\x00"))
+    raw += ser.read(4096)
+    if save:
+        with open(save, "wb") as f:
+            f.write(raw)
+    return raw
+
+
+def main():
+    args = sys.argv[1:]
+    opts = {}
+    for key in ("--save", "--json"):
+        if key in args:
+            i = args.index(key)
+            opts[key] = args[i + 1]
+            del args[i:i + 2]
+
+    if len(args) >= 2 and args[0] == "--file":
+        with open(args[1], "rb") as f:
+            raw = f.read()
+    elif args:
+        raw = capture(args[0], float(args[1]) if len(args) > 1 else 5.0, opts.get("--save"))
+    else:
+        print(__doc__)
+        sys.exit(1)
+
+    clock, names, events = parse(raw)
+    spans, lost = pair(events)
+    analyze(clock, names, events, spans, lost)
+    if "--json" in opts:
+        chrome_trace(clock, names, spans, opts["--json"])
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,91 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+스윕 판단 지연 시뮬레이션 (PC에서 실행)
+
+robot_state.c 의 스윕 타이밍(각도 간격 100ms, 30~150도 10도씩 왕복)으로
+정면 범위에 장애물이 갑자기 나타났을 때 회피 판단까지 걸리는 시간을 비교합니다.
+
+  old : 스윕 끝(30/150도)에서만 판단, 한 사이클 동안의 최소 거리로 (지도 이전 방식)
+  map : scan_map.c 지도 - 정면 범위 칸이 막히는 측정에서 바로 판단
+
+Usage:
+  python scan_sim.py                  # 2000회
+  python scan_sim.py --trials 10000 --seed 1
+"""
+
+import random
+import sys
+
+SERVO_MIN, SERVO_MAX, SERVO_STEP, SERVO_CENTER = 30, 150, 10, 90
+SCAN_STEP_MS = 100      # robot_state.c SCAN_STEP_MS
+SETTLE_MS = 20          # SERVO_SETTLE_MS
+TRIG_MS = 60            # TIM2 트리거 주기 → 서보 안정 후 첫 샘플까지 0~60ms
+CONE_DEG = 30           # scan_map.h MAP_CONE_DEG
+DIST_SAFE = 40
+
+
+def sweep(rng, start_idx, start_dir, horizon_ms):
+    """(측정 시각, 각도, 스윕 끝 여부) - 각도 간격마다 1번"""
+    angles = list(range(SERVO_MIN, SERVO_MAX + 1, SERVO_STEP))
+    i, d, t = start_idx, start_dir, 0.0
+    while t < horizon_ms:
+        meas = t + SETTLE_MS + rng.uniform(0, TRIG_MS)
+        nxt = i + d
+        end = nxt < 0 or nxt >= len(angles)
+        yield meas, angles[i], end, d
+        if end:
+            d = -d
+            nxt = i + d
+        i = nxt
+        t += SCAN_STEP_MS
+
+
+def trial(rng, dist_cm):
+    n = (SERVO_MAX - SERVO_MIN) // SERVO_STEP + 1
+    start_idx = rng.randrange(n)
+    start_dir = rng.choice((-1, 1))
+    t_obs = rng.uniform(0, 2 * (n - 1) * SCAN_STEP_MS)
+    obs_angle = rng.choice([a for a in range(SERVO_MIN, SERVO_MAX + 1, SERVO_STEP)
+                            if abs(a - SERVO_CENTER) <= CONE_DEG])
+
+    old = new = None
+    min_dist = 999
+    for meas, angle, end, d in sweep(rng, start_idx, start_dir, 10_000):
+        cm = dist_cm if (angle == obs_angle and meas >= t_obs) else 999
+
+        # old: 최소 각도에서 우향으로 출발할 때 리셋, 스윕 끝에서 판단
+        if angle == SERVO_MIN and d == 1:
+            min_dist = 999
+        min_dist = min(min_dist, cm)
+        if old is None and end and min_dist <= DIST_SAFE:
+            old = meas - t_obs
+
+        # map: 그 칸이 측정되는 순간
+        if new is None and cm <= DIST_SAFE:
+            new = meas - t_obs
+
+        if old is not None and new is not None:
+            return old, new
+    return old, new
+
+
+def summary(v):
+    v = sorted(v)
+    return f"avg {sum(v) / len(v):7.0f}  p95 {v[int(len(v) * 0.95)]:7.0f}  max {v[-1]:7.0f} ms"
+
+
+def main():
+    args = sys.argv[1:]
+    trials = int(args[args.index("--trials") + 1]) if "--trials" in args else 2000
+    seed = int(args[args.index("--seed") + 1]) if "--seed" in args else 0
+    rng = random.Random(seed)
+
+    res = [trial(rng, 30) for _ in range(trials)]
+    print(f"장애물 등장 → 회피 판단 (정면 ±{CONE_DEG}도, {trials}회)")
+    print(f"  old  {summary([r[0] for r in res])}")
+    print(f"  map  {summary([r[1] for r in res])}")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,135 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+UART 프레임 링크 도구 (PC에서 실행, pyserial 필요)
+
+uart_link.c 와 같은 프레임 형식으로 명령/핑을 보내고, 핑 왕복으로 링크 처리량을 잽니다.
+  [0xA5][len][type][payload × len][crc8]   crc8 = CRC-8(0x07) over len, type, payload
+
+Usage:
+  python uart_link.py COM5 cmd t          # 프레임으로 't' 명령 (자동 주행 시작)
+  python uart_link.py COM5 ping 500       # 24바이트 핑 500번 → 왕복/처리량, 끝나면 통계 요청
+  python uart_link.py COM5 flood 20000    # 응답 없이 핑 프레임만 연속 송신 → 'i' 통계로 drop/cyc/B 확인
+  python uart_link.py --check             # 인코더/디코더 자체 확인 (시리얼 없이)
+
+보드 쪽 파서 처리량은 'i' 명령 출력의 cyc/B (64MHz / cyc/B = 최대 바이트/초) 로 확인합니다.
+"""
+
+import os
+import sys
+import time
+
+SYNC = 0xA5
+MAX_PAYLOAD = 24        # uart_link.h LINK_MAX_PAYLOAD
+T_CMD, T_PING, T_PONG, T_STATS = 0x01, 0x02, 0x82, 0x03
+
+
+def crc8(data):
+    c = 0
+    for b in data:
+        c ^= b
+        for _ in range(8):
+            c = ((c << 1) ^ 0x07) & 0xFF if c & 0x80 else (c << 1) & 0xFF
+    return c
+
+
+def encode(ftype, payload=b""):
+    assert len(payload) <= MAX_PAYLOAD
+    body = bytes([len(payload), ftype]) + bytes(payload)
+    return bytes([SYNC]) + body + bytes([crc8(body)])
+
+
+def decode(stream):
+    """바이트열에서 프레임 추출 → ([(type, payload)], 남은 바이트). 프레임 밖 바이트(printf 텍스트)는 버림"""
+    frames = []
+    i = 0
+    while True:
+        i = stream.find(bytes([SYNC]), i)
+        if i < 0:
+            return frames, b""
+        if len(stream) - i < 2:
+            return frames, stream[i:]
+        n = stream[i + 1]
+        if n > MAX_PAYLOAD:
+            i += 1
+            continue
+        if len(stream) - i < n + 4:
+            return frames, stream[i:]
+        body = stream[i + 1:i + 3 + n]
+        if crc8(body) == stream[i + 3 + n]:
+            frames.append((body[1], bytes(body[2:])))
+            i += n + 4
+        else:
+            i += 1
+
+
+def ping_payload(k):
+    # 0x80 이상만 사용 → 프레임이 깨져도 1글자 명령('t', 'w' ...)으로 해석될 일이 없음
+    return bytes(0x80 | ((k + j) & 0x7F) for j in range(MAX_PAYLOAD))
+
+
+def run_ping(ser, count):
+    rx = b""
+    ok = 0
+    t0 = time.perf_counter()
+    for k in range(count):
+        want = ping_payload(k)
+        ser.write(encode(T_PING, want))
+        deadline = time.perf_counter() + 0.2
+        got = None
+        while got is None and time.perf_counter() < deadline:
+            rx += ser.read(ser.in_waiting or 1)
+            frames, rx = decode(rx)
+            for ftype, payload in frames:
+                if ftype == T_PONG and payload == want:
+                    got = payload
+        ok += got is not None
+    dt = time.perf_counter() - t0
+    nbytes = count * (MAX_PAYLOAD + 4) * 2
+    print(f"ping {ok}/{count}  {dt * 1000 / count:.2f} ms/왕복  {nbytes / dt / 1000:.1f} kB/s (양방향)")
+
+
+def run_flood(ser, count):
+    t0 = time.perf_counter()
+    for k in range(count):
+        ser.write(encode(T_PING, ping_payload(k)))
+    ser.flush()
+    dt = time.perf_counter() - t0
+    print(f"flood {count} 프레임 {count * (MAX_PAYLOAD + 4) / dt / 1000:.1f} kB/s 송신")
+
+
+def self_check():
+    f = encode(T_CMD, b"t")
+    frames, rest = decode(b"RX: junk\xa5" + f + encode(T_PONG, ping_payload(3))[:-1] + b"\x00" + f[:3])
+    assert frames == [(T_CMD, b"t")] and rest == f[:3], (frames, rest)
+    assert crc8(b"123456789") == 0xF4      # CRC-8/SMBUS 확인값
+    print("ok", f.hex(" "))
+
+
+def main():
+    if len(sys.argv) >= 2 and sys.argv[1] == "--check":
+        self_check()
+        return
+    if len(sys.argv) < 3:
+        print(__doc__)
+        sys.exit(1)
+
+    import serial
+    ser = serial.Serial(sys.argv[1], int(os.environ.get("BAUD", "115200")), timeout=0.05)
+    cmd = sys.argv[2]
+    arg = sys.argv[3] if len(sys.argv) > 3 else ""
+
+    if cmd == "cmd":
+        ser.write(encode(T_CMD, arg.encode()))
+    elif cmd == "ping":
+        run_ping(ser, int(arg or 100))
+        ser.write(encode(T_STATS))
+    elif cmd == "flood":
+        run_flood(ser, int(arg or 10000))
+        ser.write(b"i")
+    time.sleep(0.3)
+    sys.stdout.write(ser.read(4096).decode("utf-8", "replace"))
+
+
+if __name__ == "__main__":
+    main()